@@ -58,6 +58,27 @@ extern HcclResult HcclCommInitClusterInfoConfig(const char *clusterInfo, uint32_
 extern HcclResult HcclCreateSubCommConfig(HcclComm *comm, uint32_t rankNum, uint32_t *rankIds,
     uint64_t subCommId, uint32_t subCommRankId, HcclCommConfig *config, HcclComm *subComm);
 
+/**
+ * @brief Split the global communication into several groups of sub communications in one call.
+ *
+ * @param comm A pointer identifying the global communication resource.
+ * @param splitNum A integer identifying the number of splits.
+ * @param colors An array of [splitNum][rankSize] identifying the color of every rank in every split,
+ * ranks with the same color join the same sub communication, HCCL_SPLIT_NOCOLOR means not joining.
+ * @param keys An array of [splitNum][rankSize] identifying the rank order in the sub communication,
+ * ties are broken by the rank in global communication. nullptr means ordering by the global rank.
+ * @param splitIds An array of [splitNum] identifying the identify of every split in global communication,
+ * every splitId should be unique.
+ * @param config A pointer identifying config params shared by all sub communications, commName must be empty,
+ * sub communication names are generated by the splitId and the color.
+ * @param subComms An array of [splitNum] identifying the initialized communication resources,
+ * nullptr if the rank does not join the split.
+ * @return HcclResult
+ * @see HcclCommDestroy()
+ */
+extern HcclResult HcclCommSplitBatchConfig(HcclComm *comm, uint32_t splitNum, const uint32_t *colors,
+    const uint32_t *keys, const uint64_t *splitIds, HcclCommConfig *config, HcclComm *subComms);
+
 /**
  * @brief Get hccl root info.
  *
@@ -385,6 +406,24 @@ extern const char *HcclGetErrorString(HcclResult code);
 */
 extern HcclResult HcclBatchSendRecv(HcclSendRecvItem* sendRecvInfo, uint32_t itemNum, HcclComm comm, aclrtStream stream);
 
+/**
+ * @brief Start a group. AllReduce, Broadcast, AllGather and ReduceScatter called before the matching
+ * @ref HcclGroupEnd() on this thread are only recorded. Groups can be nested.
+ * Other operators (Send, Recv, AlltoAll, Reduce, Scatter, Barrier, ...) would run ahead of the recorded ones,
+ * so they return HCCL_E_NOT_SUPPORT inside a group.
+ * @return HcclResult
+ */
+extern HcclResult HcclGroupStart();
+
+/**
+ * @brief End a group and launch the recorded operators. Small AllReduce/Broadcast operators with the same comm,
+ * stream, data type, reduction type and root are packed into one collective, the others are launched one by one.
+ * Operators in a group must not depend on each other. The fusion buffers cached by a communicator are bounded
+ * to 64MB in total, evicting the buffer of another stream synchronizes that stream first.
+ * @return HcclResult
+ */
+extern HcclResult HcclGroupEnd();
+
 /**
  * @brief Get a number that represents the capability of comm configuration.
 */
@@ -480,6 +519,58 @@ extern HcclResult HcclCommDeactivateCommMemory(HcclComm comm, void *virPtr);
  * @param nRanks A integer identifying the rank size of the ranks need switch.
  */
 extern HcclResult HcclCommWorkingDevNicSet(HcclComm comm, uint32_t *ranks, bool *useBackup, uint32_t nRanks);
+
+/**
+ * @brief Create a persistent AllReduce operator. Parameters are checked and the algorithm and resources are
+ * resolved once here, nothing is launched until @ref HcclPersistentOpStart().
+ * @param sendBuf A pointer identifying the input data address of the operator.
+ * @param recvBuf A pointer identifying the output data address of the operator.
+ * @param count An integer(u64) identifying the number of the output data.
+ * @param dataType The data type of the operator.
+ * @param op The reduction type of the operator.
+ * @param comm A pointer identifying the communication resource based on.
+ * @param stream A pointer identifying the stream every start is launched on.
+ * @param persistentOp A pointer identifying the created persistent operator.
+ * @return HcclResult
+ */
+extern HcclResult HcclAllReduceInit(void *sendBuf, void *recvBuf, uint64_t count, HcclDataType dataType,
+    HcclReduceOp op, HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp);
+
+/**
+ * @brief Create a persistent AllGather operator, see @ref HcclAllReduceInit().
+ */
+extern HcclResult HcclAllGatherInit(void *sendBuf, void *recvBuf, uint64_t sendCount, HcclDataType dataType,
+    HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp);
+
+/**
+ * @brief Create a persistent ReduceScatter operator, see @ref HcclAllReduceInit().
+ */
+extern HcclResult HcclReduceScatterInit(void *sendBuf, void *recvBuf, uint64_t recvCount, HcclDataType dataType,
+    HcclReduceOp op, HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp);
+
+/**
+ * @brief Create a persistent Broadcast operator, see @ref HcclAllReduceInit().
+ */
+extern HcclResult HcclBroadcastInit(void *buf, uint64_t count, HcclDataType dataType, uint32_t root, HcclComm comm,
+    aclrtStream stream, HcclPersistentOp *persistentOp);
+
+/**
+ * @brief Launch a persistent operator with the buffers, counts and stream given at creation.
+ * The content of the buffers may change between starts, the addresses must stay valid.
+ * Parameter checks, algorithm selection and resource resolution are skipped, the tasks of the resolved plan are
+ * still orchestrated on every start.
+ * @param persistentOp A handle created by one of the Hccl*Init() interfaces.
+ * @return HcclResult
+ */
+extern HcclResult HcclPersistentOpStart(HcclPersistentOp persistentOp);
+
+/**
+ * @brief Free a persistent operator. A handle still alive when its communicator is destroyed becomes invalid,
+ * @ref HcclPersistentOpStart() on it fails and this interface only releases the handle.
+ * @param persistentOp A handle created by one of the Hccl*Init() interfaces.
+ * @return HcclResult
+ */
+extern HcclResult HcclPersistentOpFree(HcclPersistentOp persistentOp);
 #ifdef __cplusplus
 }
 #endif // __cplusplus
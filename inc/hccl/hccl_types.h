@@ -53,6 +53,11 @@ typedef enum {
  */
 typedef void *HcclComm;
 
+/**
+ * @brief handle to HCCL persistent operator
+ */
+typedef void *HcclPersistentOp;
+
 /**
  * @brief HCCL Reduction opperation
  */
@@ -115,6 +120,8 @@ const uint32_t HCCL_COMM_DEFAULT_OP_EXPANSION_MODE = 0;
 // 0xffffffff表示用户未配置TC或SL
 const uint32_t HCCL_COMM_TRAFFIC_CLASS_CONFIG_NOT_SET = 0xffffffff;
 const uint32_t HCCL_COMM_SERVICE_LEVEL_CONFIG_NOT_SET = 0xffffffff;
+// 批量切分时表示该rank不加入对应切分
+const uint32_t HCCL_SPLIT_NOCOLOR = 0xffffffff;
 
 typedef struct HcclCommConfigDef {
     char reserved[HCCL_COMM_CONFIG_INFO_BYTES];
@@ -236,6 +236,14 @@ HcclResult ExecutorBase::Prepare(u64 reduceAttrBitMap, std::vector<Stream> &mesh
     return HCCL_E_PARA;
 }
 
+// AllReduceDBT
+HcclResult ExecutorBase::Prepare(u64 reduceAttrBitMap, std::vector<Stream> &subStreams,
+    std::vector<std::shared_ptr<LocalNotify>> &mainSignals, std::vector<std::shared_ptr<LocalNotify>> &subSignals,
+    const std::vector<LINK> &secondTreeLinks)
+{
+    return HCCL_E_PARA;
+}
+
 // AlltoAllVPairWise
 HcclResult ExecutorBase::Prepare(AlltoAllVBufferInfo &sendBuffer, AlltoAllVBufferInfo &recvBuffer,
     bool isAlltoAllZCopyMode, const Stream &stream, HcclWorkflowMode workMode,
@@ -902,6 +910,20 @@ HcclResult ExecutorBase::ExecuteBarrier(std::shared_ptr<Transport> link, Stream
     return HCCL_SUCCESS;
 }
 
+HcclResult ExecutorBase::ExecuteTreeBarrier(const u32 parent, const std::vector<u32> &children,
+    const std::vector<LINK> &links, Stream &stream)
+{
+    if (parent != INVALID_VALUE_RANKID) {
+        CHK_SMART_PTR_NULL(links[parent]);
+        CHK_RET(ExecuteBarrier(links[parent], stream));
+    }
+    for (const u32 child : children) {
+        CHK_SMART_PTR_NULL(links[child]);
+        CHK_RET(ExecuteBarrier(links[child], stream));
+    }
+    return HCCL_SUCCESS;
+}
+
 HcclResult ExecutorBase::ExecuteBarrier(const std::shared_ptr<Transport> &preLink,
                                         const std::shared_ptr<Transport> &aftLink,
                                         u32 notifyIdx)
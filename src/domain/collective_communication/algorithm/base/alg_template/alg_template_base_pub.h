@@ -160,6 +160,11 @@ enum TemplateType {
 
     TEMPLATE_REDUCESCATTER_PLANT_LOCAL_REDUCE = 95, // ReduceScatterPlantLocalReduce RS规约保序单机
     TEMPLATE_REDUCESCATTER_PLANT_LOCAL_REDUCE_COMBINE = 96, // ReduceScatterPlantLocalReduceCombine RS规约保序跨机
+    TEMPLATE_ALL_REDUCE_DBT = 97,                   // AllReduceDBT 双二叉树allreduce
+    TEMPLATE_BROADCAST_CHAIN = 98,                  // BroadcastChain 流水链式broadcast
+    TEMPLATE_BROADCAST_KNOMIAL = 99,                // BroadcastKnomial 流水k叉树broadcast
+    TEMPLATE_REDUCE_CHAIN = 100,                    // ReduceChain 流水链式reduce
+    TEMPLATE_REDUCE_KNOMIAL = 101,                  // ReduceKnomial 流水k叉树reduce
 
     TEMPLATE_NATIVE_MAX_NUM,                        // 内置template最大值
 
@@ -232,6 +237,7 @@ struct PrepareData {
     u32 devNumInlocalPod = 0;
     u32 rankIdxInPod = 0;
     u64 reduceAttr = 0;
+    u32 segmentNum = 0; // 流水切分段数, 0表示不切分
 
     AlgOpContext algOpContext;
     bool isA2AlltoallvMutliModule = false;
@@ -325,6 +331,11 @@ public:
     virtual HcclResult Prepare(DeviceMem &sendMem, DeviceMem &recvMem, StageAlltoAllVAddrInfo &sendAddrInfo, 
         StageAlltoAllVAddrInfo &recvAddrInfo, bool isAlltoAllZCopyMode, Stream &mainStream);
 
+    // AllReduceDBT: 两棵树分别在subStreams上执行, 第二棵树使用secondTreeLinks
+    virtual HcclResult Prepare(u64 reduceAttrBitMap, std::vector<Stream> &subStreams,
+        std::vector<std::shared_ptr<LocalNotify>> &mainSignals, std::vector<std::shared_ptr<LocalNotify>> &subSignals,
+        const std::vector<LINK> &secondTreeLinks);
+
     /* 7个参数 */
     virtual HcclResult Prepare(u64 reduceAttrBitMap, std::vector<Stream> &meshStreams, 
         std::vector<std::shared_ptr<LocalNotify>> &meshSignal, std::vector<std::shared_ptr<LocalNotify>> &meshSignalAux, 
@@ -582,6 +593,9 @@ protected:
     HcclResult ExecuteBarrier(const std::shared_ptr<Transport> &preLink,
         const std::shared_ptr<Transport> &aftLink, u32 notifyIdx, Stream &stream);
     HcclResult ExecuteBarrier(std::shared_ptr<Transport> link, Stream &stream);
+    // 树形算法收尾: 先与父节点同步再与子节点同步, parent为INVALID_VALUE_RANKID表示树根
+    HcclResult ExecuteTreeBarrier(const u32 parent, const std::vector<u32> &children,
+        const std::vector<LINK> &links, Stream &stream);
     HcclResult ExecuteRxSync(std::shared_ptr<Transport> link, UserMemType srcMemType, u64 srcOffset,
         void *dst, u64 len, Stream &stream) const;
     HcclResult ExecuteTxSync(std::shared_ptr<Transport> link, UserMemType dstMemType, u64 dstOffset,
@@ -62,6 +62,7 @@ const uint32_t ALIGN_CONST = 128;
 // alltoallv_direct_fullmesh_pub.h
 const uint32_t ALLTOALLV_DIRECT_FULLMESH_SDMA_CONCURRENT_SIZE =  8; // SDMA链路上的并发数量
 const uint32_t ALLTOALLV_DIRECT_FULLMESH_RDMA_CONCURRENT_SIZE =  1; // RDMA链路上的并发数量
+const uint32_t ALLTOALLV_DIRECT_FULLMESH_RDMA_SLOT_NUM = 2; // RDMA每个lane收发各自的槽位数(ping-pong)
 const uint32_t RANK_SET_COMPUTE_CONST = 2; // 计算对端Rank用到的常量
 const uint32_t ALLTOALLV_DIRECT_FULLMESH_BIG_SIZE = 1 * 1024 * 1024; // 大数据量走并发拷贝的标准
 
@@ -378,6 +378,18 @@ AllReduceAHCBase::~AllReduceAHCBase()
 {
 }
  
+HcclResult AllReduceAHCBase::PreparePipeline(const Stream &subStream,
+    const std::shared_ptr<LocalNotify> &signalMainToSub, const std::shared_ptr<LocalNotify> &signalSubToMain)
+{
+    CHK_PTR_NULL(subStream.ptr());
+    CHK_SMART_PTR_NULL(signalMainToSub);
+    CHK_SMART_PTR_NULL(signalSubToMain);
+    subStream_ = subStream;
+    signalMainToSub_ = signalMainToSub;
+    signalSubToMain_ = signalSubToMain;
+    return HCCL_SUCCESS;
+}
+
 HcclResult AllReduceAHCBase::RunAsync(const u32 rank, const u32 rankSize,
     const std::vector<LINK> &links)
 {  
@@ -392,6 +404,16 @@ HcclResult AllReduceAHCBase::RunAsync(const u32 rank, const u32 rankSize,
     CHK_PRT_RET(rankSize == 1, HCCL_INFO("[AllReduceAHCBase][RunAsync] rankSize[%u], do nothing.",
         rankSize), HCCL_SUCCESS);
  
+    intraPlanCache_.clear();
+    u32 chunkNum = CalcPipelineChunkNum();
+    if (chunkNum > 1) {
+        ret = RunPipelined(rank, links, chunkNum);
+        CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[AllReduceAHCBase][RunAsync]rank[%u] count[%llu] failed in "\
+            "pipelined run, chunkNum[%u]", rank, count_, chunkNum), ret);
+        HCCL_INFO("[AllReduceAHCBase][RunAsync] pipelined finished: rank[%u] chunkNum[%u]", rank, chunkNum);
+        return HCCL_SUCCESS;
+    }
+
     HCCL_DEBUG("[AllReduceAHCBase][RunAsync] rank[%u] begin intra rs", rank);
  
     ret = RunIntraReduceScatter(rank, links, commAHCBaseInfo_);
@@ -417,7 +439,126 @@ HcclResult AllReduceAHCBase::RunAsync(const u32 rank, const u32 rankSize,
     HCCL_INFO("[AllReduceAHCBase][RunAsync] finished: rank[%u]", rank);
     return HCCL_SUCCESS;
 }
- 
+
+/*
+ * 分块数只依赖各rank一致的count_与scratch大小, 保证所有rank按相同的分块顺序执行。
+ * 每个分块的input/output/scratch互不重叠, scratch不足完整数据量时不做流水
+ */
+u32 AllReduceAHCBase::CalcPipelineChunkNum() const
+{
+    if (subStream_.ptr() == nullptr || signalMainToSub_ == nullptr || signalSubToMain_ == nullptr) {
+        return 1;
+    }
+    u64 totalBytes = count_ * DataUnitSize(dataType_);
+    if (inputMem_.size() < totalBytes || outputMem_.size() < totalBytes || scratchMem_.size() < totalBytes) {
+        return 1;
+    }
+    u64 chunkNum = std::min(static_cast<u64>(AHC_PIPELINE_MAX_CHUNK_NUM), totalBytes / AHC_PIPELINE_MIN_CHUNK_SIZE);
+    return std::max(static_cast<u32>(chunkNum), 1U);
+}
+
+HcclResult AllReduceAHCBase::SwitchToChunk(u32 chunkIdx, u32 chunkNum, Stream &stream)
+{
+    u32 unitSize = DataUnitSize(dataType_);
+    CHK_PRT_RET(unitSize == 0, HCCL_ERROR("[AllReduceAHCBase][SwitchToChunk]invalid dataType[%d]", dataType_),
+        HCCL_E_PARA);
+    // 分块按HCCL_MIN_SLICE_ALIGN对齐, 最后一块承担余量
+    u64 alignCount = std::max(HCCL_MIN_SLICE_ALIGN / unitSize, static_cast<u64>(1));
+    u64 chunkCount = (fullCount_ + chunkNum - 1) / chunkNum;
+    chunkCount = (chunkCount + alignCount - 1) / alignCount * alignCount;
+    u64 offsetCount = std::min(chunkCount * chunkIdx, fullCount_);
+    u64 curCount = (chunkIdx == chunkNum - 1) ? (fullCount_ - offsetCount) :
+        std::min(chunkCount, fullCount_ - offsetCount);
+    u64 offset = offsetCount * unitSize;
+    u64 size = curCount * unitSize;
+
+    inputMem_ = fullInputMem_.range(offset, size);
+    outputMem_ = fullOutputMem_.range(offset, size);
+    scratchMem_ = fullScratchMem_.range(offset, size);
+    count_ = curCount;
+    baseOffset_ = fullBaseOffset_ + offset;
+    stream_ = stream;
+    return HCCL_SUCCESS;
+}
+
+/*
+ * 第stage步: 主流执行分块stage的组内reduce-scatter与分块stage-2的组内allgather,
+ * 从流执行分块stage-1的组间allreduce。组内/组间阶段使用不相交的链路, 每条链路只在一条流上使用,
+ * 且各rank的阶段顺序一致; 每步前后主从流同步, 保证分块内三个阶段的先后依赖
+ */
+HcclResult AllReduceAHCBase::RunPipelined(const u32 rank, const std::vector<LINK> &links, u32 chunkNum)
+{
+    fullInputMem_ = inputMem_;
+    fullOutputMem_ = outputMem_;
+    fullScratchMem_ = scratchMem_;
+    fullCount_ = count_;
+    fullBaseOffset_ = baseOffset_;
+    mainStream_ = stream_;
+
+    HcclResult ret = RunPipelineStages(rank, links, chunkNum);
+
+    // 无论成功与否都恢复为完整buffer
+    inputMem_ = fullInputMem_;
+    outputMem_ = fullOutputMem_;
+    scratchMem_ = fullScratchMem_;
+    count_ = fullCount_;
+    baseOffset_ = fullBaseOffset_;
+    stream_ = mainStream_;
+    return ret;
+}
+
+HcclResult AllReduceAHCBase::RunPipelineStages(const u32 rank, const std::vector<LINK> &links, u32 chunkNum)
+{
+    for (u32 stage = 0; stage < chunkNum + 2; stage++) {
+        bool hasInter = stage >= 1 && stage <= chunkNum;
+        if (hasInter) {
+            CHK_RET(LocalNotify::Post(mainStream_, dispatcher_, signalMainToSub_, INVALID_VALUE_STAGE));
+            CHK_RET(LocalNotify::Wait(subStream_, dispatcher_, signalMainToSub_, INVALID_VALUE_STAGE));
+        }
+        if (stage < chunkNum) {
+            CHK_RET(SwitchToChunk(stage, chunkNum, mainStream_));
+            HcclResult ret = RunIntraReduceScatter(rank, links, commAHCBaseInfo_);
+            CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[AllReduceAHCBase][RunPipelineStages]rank[%u] chunk[%u] "\
+                "failed in RunIntraReduceScatter step", rank, stage), ret);
+        }
+        if (stage >= 2) {
+            CHK_RET(SwitchToChunk(stage - 2, chunkNum, mainStream_));
+            HcclResult ret = RunIntraAllGather(rank, links, commAHCBaseInfo_);
+            CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[AllReduceAHCBase][RunPipelineStages]rank[%u] chunk[%u] "\
+                "failed in RunIntraAllGather step", rank, stage - 2), ret);
+        }
+        if (hasInter) {
+            CHK_RET(SwitchToChunk(stage - 1, chunkNum, subStream_));
+            HcclResult ret = RunInterAllReduce(rank, links, commAHCBaseInfo_);
+            CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[AllReduceAHCBase][RunPipelineStages]rank[%u] chunk[%u] "\
+                "failed in RunInterAllReduce step", rank, stage - 1), ret);
+            CHK_RET(LocalNotify::Post(subStream_, dispatcher_, signalSubToMain_, INVALID_VALUE_STAGE));
+            CHK_RET(LocalNotify::Wait(mainStream_, dispatcher_, signalSubToMain_, INVALID_VALUE_STAGE));
+        }
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceAHCBase::GetIntraPlan(const u32 rank, const std::vector<LINK> &links,
+    const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo, AHCIntraPlan *&plan)
+{
+    auto iter = intraPlanCache_.find(count_);
+    if (iter != intraPlanCache_.end()) {
+        plan = &iter->second;
+        return HCCL_SUCCESS;
+    }
+
+    AHCIntraPlan newPlan;
+    CHK_RET(commAHCBaseInfo->GetIntraAlgTemplateOpInstance(AHCOpType::AHC_OP_TYPE_REDUCE_SCATTER, newPlan.rsAlg,
+        dispatcher_, reduceAttr_, extendFlag_, ahcExtendPreparePara_));
+    CHK_RET(commAHCBaseInfo->GetIntraAlgTemplateOpInstance(AHCOpType::AHC_OP_TYPE_ALLGATHER, newPlan.agAlg,
+        dispatcher_, reduceAttr_, extendFlag_, ahcExtendPreparePara_));
+    CHK_RET(commAHCBaseInfo->CalcIntraSlicesAndLinks(rank, DataUnitSize(dataType_), count_, links, newPlan.links,
+        newPlan.slices));
+    plan = &(intraPlanCache_[count_] = std::move(newPlan));
+    return HCCL_SUCCESS;
+}
+
 HcclResult AllReduceAHCBase::RunIntraReduceScatter(const u32 rank, const std::vector<LINK> &links,
     const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo)
 {
@@ -426,24 +567,19 @@ HcclResult AllReduceAHCBase::RunIntraReduceScatter(const u32 rank, const std::ve
  
     u32 intraRank = commAHCBaseInfo->GetIntraRank(rank);
  
-    // 创建执行算子实列
-    std::unique_ptr<AlgTemplateBase> tempAlg;
-    commAHCBaseInfo->GetIntraAlgTemplateOpInstance(AHCOpType::AHC_OP_TYPE_REDUCE_SCATTER, tempAlg, dispatcher_, reduceAttr_,
-        extendFlag_, ahcExtendPreparePara_);
- 
-    std::vector<Slice> intraSlices;
-    std::vector<LINK> intraLinks;
-    CHK_RET(commAHCBaseInfo->CalcIntraSlicesAndLinks(rank, DataUnitSize(dataType_), count_, links, intraLinks, intraSlices));
+    // 创建执行算子实列及切片, 同一数据量复用
+    AHCIntraPlan *plan = nullptr;
+    CHK_RET(GetIntraPlan(rank, links, commAHCBaseInfo, plan));
  
     // 长度不足2，直接跳过
-    if (intraLinks.size() <= 1) {
+    if (plan->links.size() <= 1) {
         return HCCL_SUCCESS;
     }
  
     HCCL_DEBUG("[AllReduceAHCBase][RunIntraReduceScatter] run inst rank[%u] intraRank[%u], IntraSize=%u",
-        rank, intraRank, intraLinks.size());
+        rank, intraRank, plan->links.size());
  
-    CHK_RET(RunInstance(intraRank, intraLinks, intraSlices, tempAlg, AHCOpType::AHC_OP_TYPE_REDUCE_SCATTER));
+    CHK_RET(RunInstance(intraRank, plan->links, plan->slices, plan->rsAlg, AHCOpType::AHC_OP_TYPE_REDUCE_SCATTER));
  
     HCCL_DEBUG("[AllReduceAHCBase][RunIntraReduceScatter] end intra reduce scatter rank[%u]", rank);
  
@@ -458,25 +594,19 @@ HcclResult AllReduceAHCBase::RunIntraAllGather(const u32 rank, const std::vector
     // 获取当前rank的组内rank
     u32 intraRank = commAHCBaseInfo->GetIntraRank(rank);
  
-    // 创建执行算子实列
-    std::unique_ptr<AlgTemplateBase> tempAlg;
-    commAHCBaseInfo->GetIntraAlgTemplateOpInstance(AHCOpType::AHC_OP_TYPE_ALLGATHER, tempAlg, dispatcher_, reduceAttr_,
-        extendFlag_, ahcExtendPreparePara_);
- 
-    std::vector<Slice> intraSlices;
-    std::vector<LINK> intraLinks;
- 
-    CHK_RET(commAHCBaseInfo->CalcIntraSlicesAndLinks(rank, DataUnitSize(dataType_), count_, links, intraLinks, intraSlices));
+    // 创建执行算子实列及切片, 同一数据量复用
+    AHCIntraPlan *plan = nullptr;
+    CHK_RET(GetIntraPlan(rank, links, commAHCBaseInfo, plan));
  
     // 长度不足2，直接跳过
-    if (intraLinks.size() <= 1) {
+    if (plan->links.size() <= 1) {
         return HCCL_SUCCESS;
     }
  
     HCCL_DEBUG("[AllReduceAHCBase][RunIntraAllGather] run inst rank[%u] intraRank[%u], IntraSize=%u",
-        rank, intraRank, intraLinks.size());
+        rank, intraRank, plan->links.size());
  
-    CHK_RET(RunInstance(intraRank, intraLinks, intraSlices, tempAlg, AHCOpType::AHC_OP_TYPE_ALLGATHER));
+    CHK_RET(RunInstance(intraRank, plan->links, plan->slices, plan->agAlg, AHCOpType::AHC_OP_TYPE_ALLGATHER));
  
     HCCL_DEBUG("[AllReduceAHCBase][RunIntraAllGather] end intra allgather rank[%u]", rank);
     return HCCL_SUCCESS;
@@ -13,13 +13,26 @@
  
 #include <cmath>
 #include <algorithm>
+#include <map>
 #include "alg_template_base_pub.h"
 #include "asymmetric_hierarchical_concatenate_base_pub.h"
 #include "comm_ahc_base_pub.h"
 #include "device_capacity.h"
  
 namespace hccl {
- 
+// 流水模式下单个分块的最小数据量。组间阶段按逻辑卡逐个执行, 每个分块都要重复其固定开销,
+// 分组大小不均时逻辑卡较多, 分块过小会比串行更慢
+constexpr u64 AHC_PIPELINE_MIN_CHUNK_SIZE = 4 * 1024 * 1024;
+constexpr u32 AHC_PIPELINE_MAX_CHUNK_NUM = 4;
+
+// 组内reduce-scatter与allgather共用的切片规划, 同一数据量的分块复用
+struct AHCIntraPlan {
+    std::unique_ptr<AlgTemplateBase> rsAlg;
+    std::unique_ptr<AlgTemplateBase> agAlg;
+    std::vector<Slice> slices;
+    std::vector<LINK> links;
+};
+
 class AHCAlgTemplateBase : public AlgTemplateBase {
 public:
     explicit AHCAlgTemplateBase(const HcclDispatcher dispatcher);
@@ -77,12 +90,33 @@ public:
     explicit AllReduceAHCBase(const HcclDispatcher dispatcher);
     ~AllReduceAHCBase() override;
  
+    /* 单算子模式下可选调用, 数据按分块流水: 组内阶段在主流, 组间阶段在subStream上与相邻分块的组内阶段并发 */
+    HcclResult PreparePipeline(const Stream &subStream, const std::shared_ptr<LocalNotify> &signalMainToSub,
+        const std::shared_ptr<LocalNotify> &signalSubToMain);
     HcclResult RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links) override;
 private:
     HcclResult RunIntraReduceScatter(const u32 rank, const std::vector<LINK> &links,
         const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo);
     HcclResult RunIntraAllGather(const u32 rank, const std::vector<LINK> &links,
         const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo);
+    HcclResult GetIntraPlan(const u32 rank, const std::vector<LINK> &links,
+        const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo, AHCIntraPlan *&plan);
+    u32 CalcPipelineChunkNum() const;
+    HcclResult RunPipelined(const u32 rank, const std::vector<LINK> &links, u32 chunkNum);
+    HcclResult RunPipelineStages(const u32 rank, const std::vector<LINK> &links, u32 chunkNum);
+    HcclResult SwitchToChunk(u32 chunkIdx, u32 chunkNum, Stream &stream);
+
+    std::map<u64, AHCIntraPlan> intraPlanCache_; // 以分块数据量为key
+    Stream subStream_;
+    std::shared_ptr<LocalNotify> signalMainToSub_;
+    std::shared_ptr<LocalNotify> signalSubToMain_;
+    // 流水模式下记录的完整buffer, 分块执行时inputMem_等成员指向当前分块
+    DeviceMem fullInputMem_;
+    DeviceMem fullOutputMem_;
+    DeviceMem fullScratchMem_;
+    u64 fullCount_ = 0;
+    u64 fullBaseOffset_ = 0;
+    Stream mainStream_;
     virtual HcclResult RunInterAllReduce(const u32 rank, const std::vector<LINK> &links,
         const std::unique_ptr<CommAHCBaseInfo> &commAHCBaseInfo) = 0;
 };
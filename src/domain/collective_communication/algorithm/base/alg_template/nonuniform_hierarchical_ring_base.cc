@@ -9,9 +9,21 @@
  */
 
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <typeindex>
 #include "nonuniform_hierarchical_ring_base.h"
 
 namespace hccl {
+namespace {
+// 步骤描述缓存的key: (算法类型, rankSize, rank, slice数, 是否保序)
+using NHRScheduleKey = std::tuple<std::type_index, u32, u32, u64, bool>;
+// 缓存条目超过上限时整体清空, 已被模板持有的步骤描述不受影响
+constexpr u32 NHR_SCHEDULE_CACHE_MAX_SIZE = 1024;
+
+std::mutex g_nhrCacheMutex;
+}
 
 NHRBase::NHRBase(const HcclDispatcher dispatcher)
     : AlgTemplateBase(dispatcher)
@@ -24,18 +36,41 @@ NHRBase::~NHRBase()
 
 void NHRBase::GetRankMapping(const u32 rankSize, bool keepOrder)
 {
-    std::vector<u32> tree;
-    for (u32 i = 0; i < rankSize; i++) {
-        tree.push_back(i);
-    }
-
+    keepOrder_ = keepOrder;
     if (keepOrder) {
         HCCL_DEBUG("[NHRBase][GetRankMapping] keep order and disable tree mapping, just return");
-        sliceMap_ = tree;
+        sliceMap_.resize(rankSize);
+        for (u32 i = 0; i < rankSize; i++) {
+            sliceMap_[i] = i;
+        }
         return;
     }
 
-    // 其他的再进行计算
+    // tree映射只与rankSize相关, 进程内缓存, 避免每次下发都重排
+    static std::map<u32, std::vector<u32>> rankMappingCache;
+    {
+        std::lock_guard<std::mutex> lock(g_nhrCacheMutex);
+        auto iter = rankMappingCache.find(rankSize);
+        if (iter != rankMappingCache.end()) {
+            sliceMap_ = iter->second;
+            return;
+        }
+    }
+
+    CalcRankMapping(rankSize, sliceMap_);
+
+    std::lock_guard<std::mutex> lock(g_nhrCacheMutex);
+    rankMappingCache.emplace(rankSize, sliceMap_);
+    return;
+}
+
+void NHRBase::CalcRankMapping(const u32 rankSize, std::vector<u32> &sliceMap)
+{
+    std::vector<u32> tree;
+    for (u32 i = 0; i < rankSize; i++) {
+        tree.push_back(i);
+    }
+
     std::vector<u32> tmp(rankSize);
     u32 nSteps = GetStepNumInterServer(rankSize);
 
@@ -71,12 +106,10 @@ void NHRBase::GetRankMapping(const u32 rankSize, bool keepOrder)
     }
 
     // 因为取的是tree中rank的idx，所以直接返回反向的映射
-    sliceMap_.resize(rankSize);
+    sliceMap.resize(rankSize);
     for (u32 i = 0; i < rankSize; i++) {
-        sliceMap_[tree[i]] = i;
+        sliceMap[tree[i]] = i;
     }
-
-    return;
 }
 
 void NHRBase::FetchRankMapping(std::vector<u32> &sliceMap)
@@ -154,6 +187,98 @@ u32 NHRBase::GetStepNumInterServer(u32 rankSize)
     return nSteps;
 }
 
+HcclResult NHRBase::GetStepSchedule(u32 rank, u32 rankSize, std::shared_ptr<const NHRStepSchedule> &schedule)
+{
+    static std::map<NHRScheduleKey, std::shared_ptr<const NHRStepSchedule>> scheduleCache;
+    NHRScheduleKey key(std::type_index(typeid(*this)), rankSize, rank, static_cast<u64>(slices_.size()), keepOrder_);
+    {
+        std::lock_guard<std::mutex> lock(g_nhrCacheMutex);
+        auto iter = scheduleCache.find(key);
+        if (iter != scheduleCache.end()) {
+            schedule = iter->second;
+            return HCCL_SUCCESS;
+        }
+    }
+
+    u32 nSteps = GetStepNumInterServer(rankSize);
+    std::shared_ptr<NHRStepSchedule> newSchedule(new (std::nothrow) NHRStepSchedule(nSteps));
+    CHK_SMART_PTR_NULL(newSchedule);
+    for (u32 step = 0; step < nSteps; step++) {
+        InterServerAlgoStep &stepInfo = (*newSchedule)[step];
+        CHK_RET(GetStepInfo(step, nSteps, rank, rankSize, stepInfo));
+        GetSliceRanges(stepInfo.txSliceIdxs, stepInfo.txSliceRanges);
+        GetSliceRanges(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges);
+    }
+    HCCL_DEBUG("[NHRBase][GetStepSchedule] rank[%u] rankSize[%u] sliceNum[%llu] keepOrder[%d] nSteps[%u] built",
+        rank, rankSize, static_cast<u64>(slices_.size()), keepOrder_, nSteps);
+
+    std::lock_guard<std::mutex> lock(g_nhrCacheMutex);
+    if (scheduleCache.size() >= NHR_SCHEDULE_CACHE_MAX_SIZE) {
+        scheduleCache.clear();
+    }
+    scheduleCache.emplace(key, newSchedule);
+    schedule = newSchedule;
+    return HCCL_SUCCESS;
+}
+
+// 编号排序后按连续编号切分区间; 重复编号单独成段, 与MergeSlices对重复slice的处理保持一致
+void NHRBase::GetSliceRanges(const std::vector<u32> &sliceIdxs, std::vector<SliceIdxRange> &sliceRanges)
+{
+    sliceRanges.clear();
+    std::vector<u32> sortedIdxs(sliceIdxs);
+    std::sort(sortedIdxs.begin(), sortedIdxs.end());
+    for (u32 idx : sortedIdxs) {
+        if (!sliceRanges.empty() && sliceRanges.back().endIdx == idx) {
+            sliceRanges.back().endIdx = idx + 1;
+        } else {
+            SliceIdxRange range;
+            range.beginIdx = idx;
+            range.endIdx = idx + 1;
+            sliceRanges.push_back(range);
+        }
+    }
+}
+
+bool NHRBase::IsSliceContiguous(const std::vector<Slice> &slices)
+{
+    for (u32 i = 1; i < slices.size(); i++) {
+        if (slices[i - 1].offset + slices[i - 1].size != slices[i].offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void NHRBase::CollectSlices(const std::vector<u32> &sliceIdxs, const std::vector<SliceIdxRange> &sliceRanges,
+    const std::vector<Slice> &slices, bool isContiguous, std::vector<Slice> &collected)
+{
+    collected.clear();
+    if (!isNeedMerge || !isContiguous) {
+        collected.reserve(sliceIdxs.size());
+        for (u32 idx : sliceIdxs) {
+            collected.push_back(slices[idx]);
+        }
+        MergeSlices(collected);
+        return;
+    }
+
+    // slices按编号首尾相接, 编号连续的区间即为连续内存, 结果与逐个取出后MergeSlices一致
+    collected.reserve(sliceRanges.size());
+    for (const SliceIdxRange &range : sliceRanges) {
+        const Slice &lastSlice = slices[range.endIdx - 1];
+        u64 offset = slices[range.beginIdx].offset;
+        u64 size = lastSlice.offset + lastSlice.size - offset;
+        if (!collected.empty() && collected.back().offset + collected.back().size == offset) {
+            collected.back().size += size;
+            continue;
+        }
+        Slice merged;
+        merged.offset = offset;
+        merged.size = size;
+        collected.push_back(merged);
+    }
+}
+
 // NHR每步的算法描述原理函数
 HcclResult NHRBase::GetStepInfo(u32 step, u32 nSteps, u32 rank, u32 rankSize, InterServerAlgoStep &stepInfo)
 {
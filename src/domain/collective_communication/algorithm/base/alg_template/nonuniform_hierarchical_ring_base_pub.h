@@ -12,10 +12,17 @@
 #define NONUNIFORM_HIERARCHICAL_RING_BASE_PUB_H
 
 #include <cmath>
+#include <memory>
 #include "alg_template_base_pub.h"
 
 namespace hccl {
 
+// 一段编号连续的slice: [beginIdx, endIdx)
+struct SliceIdxRange {
+    u32 beginIdx = 0;
+    u32 endIdx = 0;
+};
+
 using InterServerAlgoStep = struct InterServerAlgoStepDef {
     u32 step = 0;
     u32 myRank = 0;
@@ -25,12 +32,17 @@ using InterServerAlgoStep = struct InterServerAlgoStepDef {
     u32 fromRank = 0;
     std::vector<u32> txSliceIdxs;
     std::vector<u32> rxSliceIdxs;
+    // txSliceIdxs/rxSliceIdxs排序后按编号连续合并得到的区间, 由GetStepSchedule填充
+    std::vector<SliceIdxRange> txSliceRanges;
+    std::vector<SliceIdxRange> rxSliceRanges;
 
     InterServerAlgoStepDef() : nSlices(0)
     {
     }
 };
 
+using NHRStepSchedule = std::vector<InterServerAlgoStep>;
+
 class NHRBase : public AlgTemplateBase {
 public:
     explicit NHRBase(const HcclDispatcher dispatcher);
@@ -49,11 +61,24 @@ protected:
 
     virtual HcclResult GetStepInfo(u32 step, u32 nSteps, u32 rank, u32 rankSize, InterServerAlgoStep &stepInfo);
 
+    // 获取全部步骤的描述, 按(算法, rankSize, rank, slice数, 是否保序)在进程内缓存, 只读共享
+    HcclResult GetStepSchedule(u32 rank, u32 rankSize, std::shared_ptr<const NHRStepSchedule> &schedule);
+
+    // 按编号取出slices并合并; slices首尾相接时直接按区间拼接, 否则逐个取出后MergeSlices
+    void CollectSlices(const std::vector<u32> &sliceIdxs, const std::vector<SliceIdxRange> &sliceRanges,
+        const std::vector<Slice> &slices, bool isContiguous, std::vector<Slice> &collected);
+
+    static bool IsSliceContiguous(const std::vector<Slice> &slices);
+
     std::vector<u32> sliceMap_;
 
     bool isNeedMerge = false;
 
 private:
+    void CalcRankMapping(const u32 rankSize, std::vector<u32> &sliceMap);
+    static void GetSliceRanges(const std::vector<u32> &sliceIdxs, std::vector<SliceIdxRange> &sliceRanges);
+
+    bool keepOrder_ = false;
 };
 }  // hccl
 
@@ -108,7 +108,7 @@ HcclResult AllGatherNHR::SdmaRx(const LINK &linkLeft, const LINK &linkRight, std
     return HCCL_SUCCESS;
 }
 
-HcclResult AllGatherNHR::RdmaTxRx(const LINK &linkLeft, const LINK &linkRight, InterServerAlgoStep &stepInfo, 
+HcclResult AllGatherNHR::RdmaTxRx(const LINK &linkLeft, const LINK &linkRight, const InterServerAlgoStep &stepInfo,
     std::vector<Slice> &txSlices, std::vector<Slice> &rxSlices)
 {
     HcclResult ret = HCCL_SUCCESS;
@@ -139,10 +139,16 @@ HcclResult AllGatherNHR::RunAllGather(u32 rank, u32 rankSize, const std::vector<
     // 计算通信步数
     u32 nSteps = GetStepNumInterServer(rankSize);
 
+    // 步骤描述只与rank拓扑相关, 从缓存获取, 此处只需按本次的slice大小换算
+    std::shared_ptr<const NHRStepSchedule> schedule;
+    CHK_RET(GetStepSchedule(rank, rankSize, schedule));
+    CHK_PRT_RET(schedule->size() != nSteps, HCCL_ERROR("[AllGatherNHR][RunAllGather] rank[%u] schedule size[%llu] "
+        "is not equal to nSteps[%u]", rank, schedule->size(), nSteps), HCCL_E_INTERNAL);
+    bool isContiguous = IsSliceContiguous(outputSlices);
+
     // 逐步编排任务
     for (u32 step = 0; step < nSteps; step++) {
-        InterServerAlgoStep stepInfo;
-        GetStepInfo(step, nSteps, rank, rankSize, stepInfo);
+        const InterServerAlgoStep &stepInfo = (*schedule)[step];
 
         LINK linkLeft = links[stepInfo.fromRank];
         CHK_SMART_PTR_NULL(linkLeft);
@@ -156,18 +162,9 @@ HcclResult AllGatherNHR::RunAllGather(u32 rank, u32 rankSize, const std::vector<
         HCCL_DEBUG("[AllGatherNHR][RunAllGather] rank[%u] rankSize[%u] recvFrom[%u] sendTo[%u] step[%u] nSteps[%u] "
             "nSlices[%u]", rank, rankSize, stepInfo.fromRank, stepInfo.toRank, step, nSteps, stepInfo.nSlices);
 
-        for (u32 i = 0; i < stepInfo.nSlices; i++) {
-            txSlices.push_back(outputSlices[stepInfo.txSliceIdxs[i]]);
-            rxSlices.push_back(outputSlices[stepInfo.rxSliceIdxs[i]]);
-
-            HCCL_DEBUG("[AllGatherNHR][RunAllGather] i[%u] rxSliceIndex[%u] txSliceIndex[%u] rx data offset[%llu] "
-                "size[%llu]", i, stepInfo.rxSliceIdxs[i], stepInfo.txSliceIdxs[i],
-                outputSlices[stepInfo.rxSliceIdxs[i]].offset, outputSlices[stepInfo.rxSliceIdxs[i]].size);
-        }
-
         // 合并连续slices
-        MergeSlices(rxSlices);
-        MergeSlices(txSlices); 
+        CollectSlices(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, outputSlices, isContiguous, rxSlices);
+        CollectSlices(stepInfo.txSliceIdxs, stepInfo.txSliceRanges, outputSlices, isContiguous, txSlices);
 
         if (linkLeft->IsSpInlineReduce() && linkRight->IsSpInlineReduce()) {
             ret = SdmaRx(linkLeft, linkRight, rxSlices);
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "all_reduce_dbt.h"
+#include "alg_template_register.h"
+
+namespace hccl {
+namespace {
+// 按rank的最低有效位构造二叉树, 0号rank为根, 任意rankSize均可构造且每个节点最多两个子节点
+void GetBinaryTree(const u32 rank, const u32 rankSize, DBTreeNode &node)
+{
+    node.parent = DBT_INVALID_RANK;
+    node.children.clear();
+
+    u32 bit = 1;
+    while (bit < rankSize && (bit & rank) == 0) {
+        bit <<= 1;
+    }
+    if (rank == 0) {
+        if (rankSize > 1) {
+            node.children.push_back(bit >> 1);
+        }
+        return;
+    }
+
+    u32 up = (rank ^ bit) | (bit << 1);
+    if (up >= rankSize) {
+        up = rank ^ bit;
+    }
+    node.parent = up;
+
+    u32 lowBit = bit >> 1;
+    if (lowBit == 0) {
+        return;
+    }
+    node.children.push_back(rank - lowBit);
+    u32 down = rank + lowBit;
+    while (lowBit != 0 && down >= rankSize) {
+        lowBit >>= 1;
+        down = rank + lowBit;
+    }
+    if (lowBit != 0) {
+        node.children.push_back(down);
+    }
+}
+
+// 第二棵树: 偶数rankSize取镜像, 奇数rankSize整体平移一位, 保证一棵树的叶子在另一棵树中是中间节点
+void GetDBTreeNode(const u32 rank, const u32 rankSize, const u32 treeIdx, DBTreeNode &node)
+{
+    if (treeIdx == 0) {
+        GetBinaryTree(rank, rankSize, node);
+        return;
+    }
+
+    const bool isMirror = (rankSize % 2 == 0);
+    auto toVirtual = [isMirror, rankSize](u32 r) {
+        return isMirror ? (rankSize - 1 - r) : ((r + rankSize - 1) % rankSize);
+    };
+    auto toReal = [isMirror, rankSize](u32 r) {
+        return isMirror ? (rankSize - 1 - r) : ((r + 1) % rankSize);
+    };
+
+    GetBinaryTree(toVirtual(rank), rankSize, node);
+    if (node.parent != DBT_INVALID_RANK) {
+        node.parent = toReal(node.parent);
+    }
+    for (u32 &child : node.children) {
+        child = toReal(child);
+    }
+}
+}
+
+void GetDoubleBinaryTree(const u32 rank, const u32 rankSize, DBTreeNode &tree0, DBTreeNode &tree1)
+{
+    GetDBTreeNode(rank, rankSize, 0, tree0);
+    GetDBTreeNode(rank, rankSize, 1, tree1);
+}
+
+// 两棵树同构, 按最低有效位构造的树深度为ceil(log2(rankSize))
+u32 GetDepthOfDBT(const u32 rankSize)
+{
+    u32 depth = 0;
+    while ((static_cast<u64>(1) << depth) < rankSize) {
+        depth++;
+    }
+    return depth;
+}
+
+u32 GetChunkNumOfDBT(const u64 dataSize)
+{
+    u64 chunkNum = (dataSize + DBT_CHUNK_SIZE - 1) / DBT_CHUNK_SIZE;
+    if (chunkNum == 0) {
+        chunkNum = 1;
+    }
+    return static_cast<u32>((chunkNum > DBT_MAX_CHUNK_NUM) ? DBT_MAX_CHUNK_NUM : chunkNum);
+}
+
+AllReduceDBT::AllReduceDBT(const HcclDispatcher dispatcher) : AlgTemplateBase(dispatcher)
+{
+}
+
+AllReduceDBT::~AllReduceDBT()
+{
+}
+
+HcclResult AllReduceDBT::Prepare(u64 reduceAttrBitMap, HcomCollOpInfo *opInfo)
+{
+    reduceAttr_ = reduceAttrBitMap;
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::Prepare(u64 reduceAttrBitMap, std::vector<Stream> &subStreams,
+    std::vector<std::shared_ptr<LocalNotify>> &mainSignals, std::vector<std::shared_ptr<LocalNotify>> &subSignals,
+    const std::vector<LINK> &secondTreeLinks)
+{
+    reduceAttr_ = reduceAttrBitMap;
+    subStreams_ = subStreams;
+    mainSignals_ = mainSignals;
+    subSignals_ = subSignals;
+    secondTreeLinks_ = secondTreeLinks;
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::SimpleCheck(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
+{
+    CHK_SMART_PTR_NULL(dispatcher_);
+    CHK_PTR_NULL(stream_.ptr());
+    if (!outputMem_ || !inputMem_) {
+        HCCL_ERROR("[AllReduceDBT][RunAsync]rank[%u] run_async inputmem or outputmem is null", rank);
+        return HCCL_E_PTR;
+    }
+    if (links.size() < rankSize) {
+        HCCL_ERROR("[AllReduceDBT][RunAsync]rank[%u] linksize[%llu] is less than rankSize[%u]", rank, links.size(),
+            rankSize);
+        return HCCL_E_INTERNAL;
+    }
+    return HCCL_SUCCESS;
+}
+
+// 前一半数据走第一棵树, 后一半走第二棵树, 按数据类型对齐
+HcclResult AllReduceDBT::CalcTreeSlices(std::vector<Slice> &treeSlices)
+{
+    const u32 unitSize = SIZE_TABLE[dataType_];
+    const u64 tree0Count = (count_ + 1) / DBT_TREE_NUM;
+
+    treeSlices.resize(DBT_TREE_NUM);
+    treeSlices[0].offset = 0;
+    treeSlices[0].size = tree0Count * unitSize;
+    treeSlices[1].offset = treeSlices[0].size;
+    treeSlices[1].size = (count_ - tree0Count) * unitSize;
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::CalcChunkSlices(const Slice &treeSlice, std::vector<Slice> &chunkSlices) const
+{
+    const u32 unitSize = SIZE_TABLE[dataType_];
+    const u64 treeCount = treeSlice.size / unitSize;
+    const u64 chunkNum = (treeCount < chunkNum_) ? treeCount : chunkNum_;
+    const u64 baseCount = treeCount / chunkNum;
+    const u64 residueCount = treeCount % chunkNum;
+
+    chunkSlices.resize(chunkNum);
+    u64 offset = treeSlice.offset;
+    for (u64 i = 0; i < chunkNum; i++) {
+        chunkSlices[i].offset = offset;
+        chunkSlices[i].size = (baseCount + ((i < residueCount) ? 1 : 0)) * unitSize;
+        offset += chunkSlices[i].size;
+    }
+    return HCCL_SUCCESS;
+}
+
+// dbt allreduce算法的函数入口
+HcclResult AllReduceDBT::RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
+{
+    CHK_RET(SimpleCheck(rank, rankSize, links));
+    HCCL_INFO("AllReduceDBT run: rank[%u] ranksize[%u] inputMem[%p] outputMem[%p] count[%llu]",
+        rank, rankSize, inputMem_.ptr(), outputMem_.ptr(), count_);
+
+    // 如果ranksize为1, 从input->output
+    if (rankSize == 1) {
+        if (inputMem_ != outputMem_) {
+            CHK_RET(HcclD2DMemcpyAsync(dispatcher_, outputMem_, inputMem_, stream_));
+        }
+        return HCCL_SUCCESS;
+    }
+    CHK_PRT_RET(count_ == 0, HCCL_INFO("[AllReduceDBT][RunAsync] count_[%llu], do nothing.", count_), HCCL_SUCCESS);
+
+    // 子节点上送与父节点接收之间只通过数据信号同步, 不走inline reduce的握手流程
+    const u64 reduceAttr = reduceAttr_ & ~INLINE_REDUCE_BITMASK;
+    senderInfo_.reset(new (std::nothrow) Sender(dataType_, reductionOp_, reduceAttr));
+    CHK_SMART_PTR_NULL(senderInfo_);
+    reducerInfo_.reset(new (std::nothrow) Reducer(dataType_, reductionOp_, reduceAttr));
+    CHK_SMART_PTR_NULL(reducerInfo_);
+
+    std::vector<Slice> treeSlices;
+    CHK_RET(CalcTreeSlices(treeSlices));
+    chunkNum_ = GetChunkNumOfDBT(treeSlices[0].size);
+    const u32 depth = GetDepthOfDBT(rankSize);
+
+    // 两棵树各有独立的link和从流时并行执行, 否则在主流上依次执行, 避免共用同一条link的两棵树之间信号错序
+    const bool isParallel = subStreams_.size() >= DBT_TREE_NUM && mainSignals_.size() >= DBT_TREE_NUM &&
+        subSignals_.size() >= DBT_TREE_NUM && secondTreeLinks_.size() >= rankSize;
+    if (isParallel) {
+        CHK_RET(RunTreesParallel(rank, rankSize, depth, treeSlices, links));
+    } else {
+        for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+            const std::vector<LINK> &treeLinks = (treeIdx == 1 && secondTreeLinks_.size() >= rankSize) ?
+                secondTreeLinks_ : links;
+            CHK_PRT_RET(RunTreeOnStream(rank, rankSize, treeIdx, depth, treeSlices[treeIdx], stream_,
+                treeLinks) != HCCL_SUCCESS,
+                HCCL_ERROR("[AllReduceDBT][RunAsync]rank[%u] tree[%u] run failed", rank, treeIdx), HCCL_E_INTERNAL);
+        }
+    }
+
+    HCCL_INFO("AllReduceDBT finished: rank[%u] ranksize[%u] chunkNum[%u] depth[%u]", rank, rankSize, chunkNum_,
+        depth);
+    return HCCL_SUCCESS;
+}
+
+// 主流通知两条从流启动, 两棵树分别在从流上执行, 全部完成后从流通知主流
+HcclResult AllReduceDBT::RunTreesParallel(const u32 rank, const u32 rankSize, const u32 depth,
+    const std::vector<Slice> &treeSlices, const std::vector<LINK> &links)
+{
+    for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+        CHK_RET(LocalNotify::Post(stream_, dispatcher_, subSignals_[treeIdx], profilerInput_.stage));
+        CHK_RET(LocalNotify::Wait(subStreams_[treeIdx], dispatcher_, subSignals_[treeIdx], profilerInput_.stage));
+    }
+    for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+        const std::vector<LINK> &treeLinks = (treeIdx == 0) ? links : secondTreeLinks_;
+        CHK_PRT_RET(RunTreeOnStream(rank, rankSize, treeIdx, depth, treeSlices[treeIdx], subStreams_[treeIdx],
+            treeLinks) != HCCL_SUCCESS,
+            HCCL_ERROR("[AllReduceDBT][RunTreesParallel]rank[%u] tree[%u] run failed", rank, treeIdx),
+            HCCL_E_INTERNAL);
+    }
+    for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+        CHK_RET(LocalNotify::Post(subStreams_[treeIdx], dispatcher_, mainSignals_[treeIdx], profilerInput_.stage));
+        CHK_RET(LocalNotify::Wait(stream_, dispatcher_, mainSignals_[treeIdx], profilerInput_.stage));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::RunTreeOnStream(const u32 rank, const u32 rankSize, const u32 treeIdx, const u32 depth,
+    const Slice &treeSlice, Stream &stream, const std::vector<LINK> &links)
+{
+    if (treeSlice.size == 0) {
+        return HCCL_SUCCESS;
+    }
+    DBTreeNode node;
+    GetDBTreeNode(rank, rankSize, treeIdx, node);
+    bool waitParentAck = false;
+    if (node.parent != DBT_INVALID_RANK) {
+        DBTreeNode parentNode;
+        GetDBTreeNode(node.parent, rankSize, treeIdx, parentNode);
+        waitParentAck = (parentNode.children.size() > 1 && parentNode.children[1] == rank);
+    }
+    return RunTree(rank, node, waitParentAck, depth, treeSlice, stream, links);
+}
+
+// 第s步上行reduce第s个chunk, 同时下行broadcast第(s - depth)个chunk, 使上下两个方向的链路同时被利用
+HcclResult AllReduceDBT::RunTree(const u32 rank, const DBTreeNode &node, const bool waitParentAck, const u32 depth,
+    const Slice &treeSlice, Stream &stream, const std::vector<LINK> &links)
+{
+    std::vector<Slice> chunkSlices;
+    CHK_RET(CalcChunkSlices(treeSlice, chunkSlices));
+    const u32 chunkNum = chunkSlices.size();
+
+    for (u32 step = 0; step < chunkNum + depth; step++) {
+        if (step < chunkNum) {
+            CHK_RET(RunReduceChunk(rank, node, waitParentAck, chunkSlices[step], stream, links));
+        }
+        if (step >= depth) {
+            CHK_RET(RunBroadcastChunk(node, chunkSlices[step - depth], stream, links));
+        }
+    }
+
+    if (barrierSwitchOn_) {
+        CHK_RET(ExecuteTreeBarrier(node.parent, node.children, links, stream));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::RunReduceChunk(const u32 rank, const DBTreeNode &node, const bool waitParentAck,
+    const Slice &chunk, Stream &stream, const std::vector<LINK> &links)
+{
+    DeviceMem inChunk = inputMem_.range(chunk.offset, chunk.size);
+    DeviceMem outChunk = outputMem_.range(chunk.offset, chunk.size);
+    CHK_PTR_NULL(inChunk.ptr());
+    CHK_PTR_NULL(outChunk.ptr());
+
+    // 子节点数据先落到output对应位置再规约进input; 第二个子节点需等第一个子节点的数据规约完成后才能写入
+    for (u32 i = 0; i < node.children.size(); i++) {
+        const LINK &childLink = links[node.children[i]];
+        CHK_SMART_PTR_NULL(childLink);
+        if (i > 0) {
+            CHK_RET(childLink->TxAck(stream));
+        }
+        CHK_RET(reducerInfo_->run(dispatcher_, childLink, baseOffset_ + chunk.offset, inChunk, inChunk, outChunk,
+            stream));
+    }
+
+    if (node.parent == DBT_INVALID_RANK) {
+        // 树根上规约完成即为最终结果
+        if (inputMem_ != outputMem_) {
+            CHK_RET(HcclD2DMemcpyAsync(dispatcher_, outChunk, inChunk, stream));
+        }
+        return HCCL_SUCCESS;
+    }
+
+    const LINK &parentLink = links[node.parent];
+    CHK_SMART_PTR_NULL(parentLink);
+    if (waitParentAck) {
+        CHK_RET(parentLink->RxAck(stream));
+    }
+    HCCL_DEBUG("[AllReduceDBT][RunReduceChunk]rank[%u] send to parent[%u] offset[%llu] size[%llu]", rank,
+        node.parent, chunk.offset, chunk.size);
+    CHK_RET(senderInfo_->run(parentLink, baseOffset_ + chunk.offset, inChunk, stream));
+    return HCCL_SUCCESS;
+}
+
+HcclResult AllReduceDBT::RunBroadcastChunk(const DBTreeNode &node, const Slice &chunk, Stream &stream,
+    const std::vector<LINK> &links)
+{
+    void *outPtr = static_cast<u8 *>(outputMem_.ptr()) + chunk.offset;
+    if (node.parent != DBT_INVALID_RANK) {
+        CHK_RET(links[node.parent]->RxAsync(UserMemType::OUTPUT_MEM, baseOffset_ + chunk.offset, outPtr, chunk.size,
+            stream));
+    }
+    for (const u32 child : node.children) {
+        CHK_RET(links[child]->TxAsync(UserMemType::OUTPUT_MEM, baseOffset_ + chunk.offset, outPtr, chunk.size,
+            stream));
+    }
+    return HCCL_SUCCESS;
+}
+
+REGISTER_TEMPLATE(TemplateType::TEMPLATE_ALL_REDUCE_DBT, AllReduceDBT);
+}  // namespace hccl
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ALL_REDUCE_DBT_H
+#define ALL_REDUCE_DBT_H
+
+#include "all_reduce_dbt_pub.h"
+
+namespace hccl {
+constexpr u64 DBT_CHUNK_SIZE = 128 * 1024; // 每个chunk的目标大小
+constexpr u32 DBT_MAX_CHUNK_NUM = 8;       // 流水chunk数上限, 过多的chunk会放大每步的启动时延
+}  // namespace hccl
+
+#endif  /* ALL_REDUCE_DBT_H */
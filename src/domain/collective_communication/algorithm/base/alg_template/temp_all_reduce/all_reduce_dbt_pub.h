@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ALL_REDUCE_DBT_PUB_H
+#define ALL_REDUCE_DBT_PUB_H
+
+#include "alg_template_base_pub.h"
+#include "mem_host_pub.h"
+#include "mem_device_pub.h"
+#include "stream_pub.h"
+
+#include "reducer_pub.h"
+#include "sender_pub.h"
+
+namespace hccl {
+// 双二叉树allreduce: 数据对半分给两棵互补的二叉树, 每棵树内按chunk流水执行reduce上行和broadcast下行
+class AllReduceDBT : public AlgTemplateBase {
+public:
+    using AlgTemplateBase::Prepare;
+    explicit AllReduceDBT(const HcclDispatcher dispatcher);
+    ~AllReduceDBT() override;
+
+    HcclResult Prepare(u64 reduceAttrBitMap, HcomCollOpInfo *opInfo = nullptr) override;
+    HcclResult Prepare(u64 reduceAttrBitMap, std::vector<Stream> &subStreams,
+        std::vector<std::shared_ptr<LocalNotify>> &mainSignals, std::vector<std::shared_ptr<LocalNotify>> &subSignals,
+        const std::vector<LINK> &secondTreeLinks) override;
+
+    HcclResult RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links) override;
+
+private:
+    HcclResult SimpleCheck(const u32 rank, const u32 rankSize, const std::vector<LINK> &links);
+    HcclResult CalcTreeSlices(std::vector<Slice> &treeSlices);
+    HcclResult CalcChunkSlices(const Slice &treeSlice, std::vector<Slice> &chunkSlices) const;
+
+    HcclResult RunTreesParallel(const u32 rank, const u32 rankSize, const u32 depth,
+        const std::vector<Slice> &treeSlices, const std::vector<LINK> &links);
+    HcclResult RunTreeOnStream(const u32 rank, const u32 rankSize, const u32 treeIdx, const u32 depth,
+        const Slice &treeSlice, Stream &stream, const std::vector<LINK> &links);
+    HcclResult RunTree(const u32 rank, const DBTreeNode &node, const bool waitParentAck, const u32 depth,
+        const Slice &treeSlice, Stream &stream, const std::vector<LINK> &links);
+    HcclResult RunReduceChunk(const u32 rank, const DBTreeNode &node, const bool waitParentAck,
+        const Slice &chunk, Stream &stream, const std::vector<LINK> &links);
+    HcclResult RunBroadcastChunk(const DBTreeNode &node, const Slice &chunk, Stream &stream,
+        const std::vector<LINK> &links);
+
+    u64 reduceAttr_ = 0; /* 0x1:表示data_type + reduce_type支持inlinereduce  */
+    u32 chunkNum_ = 1;
+    std::unique_ptr<Sender> senderInfo_;
+    std::unique_ptr<Reducer> reducerInfo_;
+    std::vector<Stream> subStreams_;
+    std::vector<std::shared_ptr<LocalNotify>> mainSignals_;
+    std::vector<std::shared_ptr<LocalNotify>> subSignals_;
+    std::vector<LINK> secondTreeLinks_;
+};
+}  // namespace hccl
+#endif /* ALL_REDUCE_DBT_PUB_H */
@@ -124,8 +124,14 @@ HcclResult AlltoAllVDirectFullMesh::Prepare(PrepareData &param)
         "sdmaDataBlockSize_[%llu], BigCountFlag[%d], stepSize[%u]", userRank_, cclInMem_.size(), sdmaDataBlockSize_, isBigCount_,
         algOpContext_.mc2Handler.stepSize);
 
-    // 一半的CCLOut用来发送RDMA数据，另一半用来接收RDMA数据，因此需要除以2
-    rdmaDataBlockSize_ = cclOutMem_.size() / std::max(1u, rdmaConcurrentNum_) / 2;
+    // 一半的CCLOut用来发送RDMA数据，另一半用来接收RDMA数据，每个lane的收发各有两个槽位交替使用
+    rdmaDataBlockSize_ = cclOutMem_.size() / std::max(1u, rdmaConcurrentNum_) / 2 /
+        ALLTOALLV_DIRECT_FULLMESH_RDMA_SLOT_NUM;
+    if (rdmaDataBlockSize_ > HCCL_MIN_SLICE_ALIGN_910B) {
+        rdmaDataBlockSize_ = (rdmaDataBlockSize_ / HCCL_MIN_SLICE_ALIGN_910B) * HCCL_MIN_SLICE_ALIGN_910B;
+    }
+    CHK_PRT_RET(totalRdmaRankNum_ > 0 && rdmaDataBlockSize_ == 0,
+        HCCL_ERROR("[AlltoAllVDirectFullMesh][Prepare]rdmaDataBlockSize_ is zero."), HCCL_E_INTERNAL);
 
     return HCCL_SUCCESS;
 }
@@ -638,7 +644,34 @@ u32 AlltoAllVDirectFullMesh::GetPreSrcRank(u32& curDstRank)
     return curDstRank--;
 }
 
-void AlltoAllVDirectFullMesh::GenRdmaSendInfo(u32 dstRank, std::vector<SendDataBlock>& sendInfo)
+u64 AlltoAllVDirectFullMesh::GetRdmaSendSlotOffset(u32 slotIdx, u32 step) const
+{
+    return (slotIdx * ALLTOALLV_DIRECT_FULLMESH_RDMA_SLOT_NUM + step % ALLTOALLV_DIRECT_FULLMESH_RDMA_SLOT_NUM) *
+        rdmaDataBlockSize_;
+}
+
+u64 AlltoAllVDirectFullMesh::GetRdmaRecvSlotOffset(u32 slotIdx, u32 step) const
+{
+    // CCL out的后一半用于接收
+    return GetRdmaSendSlotOffset(slotIdx + rdmaConcurrentNum_, step);
+}
+
+void AlltoAllVDirectFullMesh::GetRdmaSlotIdx(u32 dstRank, u32 srcRank, u32 lane, RdmaSlotIdx &slotIdx) const
+{
+    if (isSuPodAsym_) {
+        // 非对称场景各rank的通信顺序不一致, 仍按rank号选择槽位
+        slotIdx.sendSlot = dstRank % rdmaConcurrentNum_;
+        slotIdx.recvSlot = srcRank % rdmaConcurrentNum_;
+        slotIdx.remoteSlot = userRank_ % rdmaConcurrentNum_;
+    } else {
+        // 同一对rank在两端处于同一位置, 因此处于同一lane, 按lane选择槽位
+        slotIdx.sendSlot = lane;
+        slotIdx.recvSlot = lane;
+        slotIdx.remoteSlot = lane;
+    }
+}
+
+void AlltoAllVDirectFullMesh::GenRdmaSendInfo(u32 dstRank, u32 slotIdx, std::vector<SendDataBlock>& sendInfo)
 {
     const SendRecvInfo& localSendRecvInfo = *localSendRecvInfoPtr_;
     u64 sendOffset = localSendRecvInfo.sendOffset[dstRank];
@@ -648,8 +681,7 @@ void AlltoAllVDirectFullMesh::GenRdmaSendInfo(u32 dstRank, std::vector<SendDataB
         SendDataBlock sendData;
         sendData.userInOffset = sendOffset;
         sendData.sendLen = curSendLength;
-        u32 index = dstRank % rdmaConcurrentNum_;
-        sendData.scratchOffset = rdmaDataBlockSize_ * index;
+        sendData.scratchOffset = GetRdmaSendSlotOffset(slotIdx, sendInfo.size());
         sendInfo.push_back(sendData);
         sendOffset += curSendLength;
         sendLength -= curSendLength;
@@ -660,7 +692,7 @@ void AlltoAllVDirectFullMesh::GenRdmaSendInfo(u32 dstRank, std::vector<SendDataB
     return;
 }
 
-void AlltoAllVDirectFullMesh::GenRdmaRecvInfo(u32 srcRank, std::vector<RecvDataBlock>& recvInfo)
+void AlltoAllVDirectFullMesh::GenRdmaRecvInfo(u32 srcRank, u32 slotIdx, std::vector<RecvDataBlock>& recvInfo)
 {
     const SendRecvInfo& localSendRecvInfo = *localSendRecvInfoPtr_;
     u64 recvOffset = localSendRecvInfo.recvOffset[srcRank];
@@ -670,8 +702,7 @@ void AlltoAllVDirectFullMesh::GenRdmaRecvInfo(u32 srcRank, std::vector<RecvDataB
         RecvDataBlock recvData;
         recvData.recvOffset = recvOffset;
         recvData.recvLen = curRecvLength;
-        u32 index = srcRank % rdmaConcurrentNum_;
-        recvData.scratchOffset = rdmaDataBlockSize_ * index + rdmaDataBlockSize_ * rdmaConcurrentNum_;
+        recvData.scratchOffset = GetRdmaRecvSlotOffset(slotIdx, recvInfo.size());
         recvInfo.push_back(recvData);
         recvOffset += curRecvLength;
         recvLength -= curRecvLength;
@@ -696,54 +727,66 @@ HcclResult AlltoAllVDirectFullMesh::CopyDataForSend(u32 dstRank, std::vector<Sen
     return HCCL_SUCCESS;
 }
 
-// 从流完成RDMA数据的收发
-HcclResult AlltoAllVDirectFullMesh::SendRecvRdmaData(u32 dstRank, u32 srcRank, std::vector<SendDataBlock>& sendInfo,
-    std::vector<RecvDataBlock>& recvInfo, u32 curStep, Stream strem)
+/*
+ * 从流完成与一对rank的RDMA数据收发, 收发各使用两个槽位交替(ping-pong):
+ * 第curStep块发出后即拷贝第curStep+1块到另一个槽位, 与网卡传输重叠;
+ * 收到第curStep块后即通知对端可以写另一个槽位, 对端的下一块传输与本端的拷出重叠。
+ * 每个notify同一时刻最多只有一次未被消费的record。
+ */
+HcclResult AlltoAllVDirectFullMesh::SendRecvRdmaData(u32 dstRank, u32 srcRank, const RdmaSlotIdx &slotIdx,
+    Stream strem)
 {
     const LINK& sendTransport = links_[dstRank];
     const LINK& recvTransport = links_[srcRank];
-    HCCL_DEBUG("[AlltoAllVDirectFullMesh][SendRecvRdmaData] userRank[%u], dstRank[%u], srcRank[%u]",
-        userRank_, dstRank, srcRank);
-    u32 minStep = std::min(sendInfo.size(), recvInfo.size());
-    CHK_PTR_NULL(sendTransport);
-    CHK_PTR_NULL(recvTransport);
-    if (curStep < minStep) {
-        CHK_RET(recvTransport->TxAck(strem));
-        CHK_RET(sendTransport->RxAck(strem));
-        u64 sendSrcOffset = (dstRank % rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        void* srcPtr = static_cast<u8 *>(cclOutMem_.ptr()) + sendSrcOffset;
-        u32 dstIndex = userRank_ % rdmaConcurrentNum_;
-        u64 sendDstOffset = (dstIndex + rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        CHK_RET(sendTransport->TxAsync(UserMemType::OUTPUT_MEM, sendDstOffset, srcPtr,
-            sendInfo[curStep].sendLen, strem));
-
-        u64 recvDstOffset = (srcRank % rdmaConcurrentNum_ + rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        void* dstPtr = static_cast<u8 *>(cclOutMem_.ptr()) + recvDstOffset;
-        u64 recvSrcOffset = (userRank_ % rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        CHK_RET(recvTransport->RxAsync(UserMemType::OUTPUT_MEM, recvSrcOffset, dstPtr,
-            recvInfo[curStep].recvLen, strem));
-        CHK_RET(recvTransport->PostFinAck(strem));
-        CHK_RET(sendTransport->WaitFinAck(strem));
-        HCCL_DEBUG("[AlltoAllVDirectFullMesh][SendRecvRdmaData] sendSrcOffset[%llu], sendDstOffset[%llu]," \
-            "recvDstOffset[%llu], recvSrcOffset[%llu], srcPtr[%p], dstPtr[%p]",sendSrcOffset,
-            sendDstOffset, recvDstOffset, recvSrcOffset, srcPtr, dstPtr);
-    } else if (curStep < sendInfo.size()) {
-        CHK_RET(sendTransport->RxAck(strem));
-        u64 sendSrcOffset = (dstRank % rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        void* srcPtr = static_cast<u8 *>(cclOutMem_.ptr()) + sendSrcOffset;
-        u32 dstIndex = userRank_ % rdmaConcurrentNum_;
-        u64 sendDstOffset = (dstIndex + rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        CHK_RET(sendTransport->TxAsync(UserMemType::OUTPUT_MEM, sendDstOffset, srcPtr,
-            sendInfo[curStep].sendLen, strem));
-        CHK_RET(sendTransport->WaitFinAck(strem));
-    } else {
+
+    std::vector<SendDataBlock> sendInfo;
+    std::vector<RecvDataBlock> recvInfo;
+    GenRdmaSendInfo(dstRank, slotIdx.sendSlot, sendInfo);
+    GenRdmaRecvInfo(srcRank, slotIdx.recvSlot, recvInfo);
+    u32 sendStep = sendInfo.size();
+    u32 recvStep = recvInfo.size();
+    // 按需建链时无数据交互的对端没有链路, 仅校验实际收发的链路
+    if (sendStep > 0) {
+        CHK_PTR_NULL(sendTransport);
+    }
+    if (recvStep > 0) {
+        CHK_PTR_NULL(recvTransport);
+    }
+    u32 totalStep = std::max(sendStep, recvStep);
+    HCCL_DEBUG("[AlltoAllVDirectFullMesh][SendRecvRdmaData] userRank[%u], dstRank[%u], srcRank[%u], " \
+        "sendStep[%u], recvStep[%u]", userRank_, dstRank, srcRank, sendStep, recvStep);
+
+    if (recvStep > 0) {
         CHK_RET(recvTransport->TxAck(strem));
-        u64 recvDstOffset = (srcRank % rdmaConcurrentNum_ + rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        void* dstPtr = static_cast<u8 *>(cclOutMem_.ptr()) + recvDstOffset;
-        u64 recvSrcOffset = (userRank_ % rdmaConcurrentNum_) * rdmaDataBlockSize_;
-        CHK_RET(recvTransport->RxAsync(UserMemType::OUTPUT_MEM, recvSrcOffset, dstPtr,
-            recvInfo[curStep].recvLen, strem));
-        CHK_RET(recvTransport->PostFinAck(strem));
+    }
+    CHK_RET(CopyDataForSend(dstRank, sendInfo, 0, strem));
+    for (u32 curStep = 0; curStep < totalStep; curStep++) {
+        if (curStep < sendStep) {
+            CHK_RET(sendTransport->RxAck(strem));
+            void* srcPtr = static_cast<u8 *>(cclOutMem_.ptr()) + sendInfo[curStep].scratchOffset;
+            u64 sendDstOffset = GetRdmaRecvSlotOffset(slotIdx.remoteSlot, curStep);
+            CHK_RET(sendTransport->TxAsync(UserMemType::OUTPUT_MEM, sendDstOffset, srcPtr,
+                sendInfo[curStep].sendLen, strem));
+            HCCL_DEBUG("[AlltoAllVDirectFullMesh][SendRecvRdmaData] step[%u] sendSrcOffset[%llu], " \
+                "sendDstOffset[%llu]", curStep, sendInfo[curStep].scratchOffset, sendDstOffset);
+        }
+        // 另一个发送槽位上的数据已在上一步确认被对端收走, 可以提前准备下一块
+        CHK_RET(CopyDataForSend(dstRank, sendInfo, curStep + 1, strem));
+        if (curStep < recvStep) {
+            void* dstPtr = static_cast<u8 *>(cclOutMem_.ptr()) + recvInfo[curStep].scratchOffset;
+            u64 recvSrcOffset = GetRdmaSendSlotOffset(slotIdx.remoteSlot, curStep);
+            CHK_RET(recvTransport->RxAsync(UserMemType::OUTPUT_MEM, recvSrcOffset, dstPtr,
+                recvInfo[curStep].recvLen, strem));
+            CHK_RET(recvTransport->PostFinAck(strem));
+            // 另一个接收槽位上的数据已在上一步拷出, 允许对端开始写下一块
+            if (curStep + 1 < recvStep) {
+                CHK_RET(recvTransport->TxAck(strem));
+            }
+        }
+        if (curStep < sendStep) {
+            CHK_RET(sendTransport->WaitFinAck(strem));
+        }
+        CHK_RET(CopyRecvDataToOutput(srcRank, recvInfo, curStep, strem));
     }
     return HCCL_SUCCESS;
 }
@@ -755,11 +798,10 @@ HcclResult AlltoAllVDirectFullMesh::CopyRecvDataToOutput(u32 srcRank, std::vecto
     if (curStep >= recvInfo.size()) {
         return HCCL_SUCCESS;
     }
-    u64 srcOffset = (srcRank % rdmaConcurrentNum_ + rdmaConcurrentNum_) * rdmaDataBlockSize_;
-    DeviceMem src = cclOutMem_.range(srcOffset, recvInfo[curStep].recvLen);
+    DeviceMem src = cclOutMem_.range(recvInfo[curStep].scratchOffset, recvInfo[curStep].recvLen);
     DeviceMem dst = userOutput_.range(recvInfo[curStep].recvOffset, recvInfo[curStep].recvLen);
     HCCL_DEBUG("[AlltoAllVDirectFullMesh][CopyRecvDataToOutput] userRank[%u], srcRank[%u], srcOffset[%llu]," \
-        "recvInfo[curStep].recvOffset[%llu], recvLen[%llu]", userRank_, srcRank, srcOffset,
+        "recvInfo[curStep].recvOffset[%llu], recvLen[%llu]", userRank_, srcRank, recvInfo[curStep].scratchOffset,
         recvInfo[curStep].recvOffset, recvInfo[curStep].recvLen);
     CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dst, src, strem));
     return HCCL_SUCCESS;
@@ -768,26 +810,34 @@ HcclResult AlltoAllVDirectFullMesh::CopyRecvDataToOutput(u32 srcRank, std::vecto
 HcclResult AlltoAllVDirectFullMesh::ProcessSingleGroupRdmaData(std::vector<u32>& dstRanks, std::vector<u32>& srcRanks)
 {
     for (u32 index = 0; index < dstRanks.size(); index++) {
-        u32 dstRank = dstRanks[index];
-        u32 srcRank = srcRanks[index];
-        Stream strem = rdmaSubStreams_[index + 1];
-
-        std::vector<SendDataBlock> sendInfo;
-        std::vector<RecvDataBlock> recvInfo;
-        GenRdmaSendInfo(dstRank, sendInfo);
-        GenRdmaRecvInfo(srcRank, recvInfo);
-        u32 totalStep = std::max(sendInfo.size(), recvInfo.size());
-
-        for (u32 curStep = 0; curStep < totalStep; curStep++) {
-            CHK_RET(CopyDataForSend(dstRank, sendInfo, curStep, strem));
-            CHK_RET(SendRecvRdmaData(dstRank, srcRank, sendInfo, recvInfo, curStep, strem));
-            CHK_RET(CopyRecvDataToOutput(srcRank, recvInfo, curStep, strem));
-        }
+        RdmaSlotIdx slotIdx;
+        GetRdmaSlotIdx(dstRanks[index], srcRanks[index], index, slotIdx);
+        CHK_RET(SendRecvRdmaData(dstRanks[index], srcRanks[index], slotIdx, rdmaSubStreams_[index + 1]));
     }
 
     return HCCL_SUCCESS;
 }
 
+/*
+ * 对称场景下第i个通信对在所有rank上都位于位置i, 因此将位置i固定分配到lane i % rdmaConcurrentNum_:
+ * 每个lane依次处理自己的通信对, 不同lane之间无需按轮次同步, 小数据量的lane可以提前开始下一个对端。
+ */
+HcclResult AlltoAllVDirectFullMesh::ProcessLaneRdmaData(std::vector<u32>& dstRanks, std::vector<u32>& srcRanks)
+{
+    CHK_RET(ExecEmptyTask(userInput_, userOutput_, rdmaSubStreams_[0], dispatcher_));
+    CHK_RET(RdmaControlNotifySubStart());
+    CHK_RET(ExecEmptyTask(userInput_, userOutput_, rdmaSubStreams_[0], dispatcher_));
+    for (u32 pos = 0; pos < dstRanks.size(); pos++) {
+        u32 lane = pos % rdmaConcurrentNum_;
+        RdmaSlotIdx slotIdx;
+        GetRdmaSlotIdx(dstRanks[pos], srcRanks[pos], lane, slotIdx);
+        CHK_RET(SendRecvRdmaData(dstRanks[pos], srcRanks[pos], slotIdx, rdmaSubStreams_[lane + 1]));
+    }
+    CHK_RET(SubNotifyRdmaControlFinish());
+    CHK_RET(ExecEmptyTask(userInput_, userOutput_, rdmaSubStreams_[0], dispatcher_));
+    return HCCL_SUCCESS;
+}
+
 HcclResult AlltoAllVDirectFullMesh::ProcessRdmaData()
 {
     // RDMA通信轮次
@@ -807,6 +857,16 @@ HcclResult AlltoAllVDirectFullMesh::ProcessRdmaData()
     } else {
         curDstRank = (userRank_ + devNumInlocalPod_) % userRankSize_;
         curSrcRank = (userRank_ + userRankSize_ - devNumInlocalPod_) % userRankSize_;
+
+        std::vector<u32> dstRanks;
+        std::vector<u32> srcRanks;
+        for (u32 i = 0; i < totalRdmaRankNum_; i++) {
+            dstRanks.push_back(GetNextDstRank(curDstRank));
+            srcRanks.push_back(GetPreSrcRank(curSrcRank));
+        }
+        CHK_RET(ProcessLaneRdmaData(dstRanks, srcRanks));
+        HCCL_INFO("[AlltoAllVDirectFullMesh][ProcessRdmaData] done");
+        return HCCL_SUCCESS;
     }
 
     for (u32 round = 0; round < rdmaRoundNum; round++) {
@@ -817,11 +877,7 @@ HcclResult AlltoAllVDirectFullMesh::ProcessRdmaData()
         std::vector<u32> srcRanks;
         for (u32 i = 0; i < curProcessRankNum; i++) {
             dstRanks.push_back(GetNextDstRank(curDstRank));
-            if (isSuPodAsym_) {
-                srcRanks.push_back(dstRanks.back());
-            } else {
-                srcRanks.push_back(GetPreSrcRank(curSrcRank));
-            }
+            srcRanks.push_back(dstRanks.back());
         }
         CHK_RET(ExecEmptyTask(userInput_, userOutput_, rdmaSubStreams_[0], dispatcher_));
         CHK_RET(RdmaControlNotifySubStart());
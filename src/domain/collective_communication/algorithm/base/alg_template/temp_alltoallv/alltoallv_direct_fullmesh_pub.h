@@ -63,14 +63,22 @@ private:
     HcclResult SubNotifyRdmaControlFinish();
     u32 GetNextDstRank(u32& curDstRank);
     u32 GetPreSrcRank(u32& curDstRank);
-    void GenRdmaSendInfo(u32 dstRank, std::vector<SendDataBlock>& sendInfo);
-    void GenRdmaRecvInfo(u32 srcRank, std::vector<RecvDataBlock>& recvInfo);
+    struct RdmaSlotIdx {
+        u32 sendSlot;   // 本端发送槽位
+        u32 recvSlot;   // 本端接收槽位
+        u32 remoteSlot; // 对端接收本端数据的槽位
+    };
+    u64 GetRdmaSendSlotOffset(u32 slotIdx, u32 step) const;
+    u64 GetRdmaRecvSlotOffset(u32 slotIdx, u32 step) const;
+    void GetRdmaSlotIdx(u32 dstRank, u32 srcRank, u32 lane, RdmaSlotIdx &slotIdx) const;
+    void GenRdmaSendInfo(u32 dstRank, u32 slotIdx, std::vector<SendDataBlock>& sendInfo);
+    void GenRdmaRecvInfo(u32 srcRank, u32 slotIdx, std::vector<RecvDataBlock>& recvInfo);
     HcclResult CopyDataForSend(u32 dstRank, std::vector<SendDataBlock>& sendInfo, u32 curStep, Stream strem);
-    HcclResult SendRecvRdmaData(u32 dstRank, u32 srcRank, std::vector<SendDataBlock>& sendInfo,
-        std::vector<RecvDataBlock>& recvInfo, u32 curStep, Stream strem);
+    HcclResult SendRecvRdmaData(u32 dstRank, u32 srcRank, const RdmaSlotIdx &slotIdx, Stream strem);
     HcclResult CopyRecvDataToOutput(u32 srcRank, std::vector<RecvDataBlock>& recvInfo,
         u32 curStep, Stream strem);
     HcclResult ProcessSingleGroupRdmaData(std::vector<u32>& dstRanks, std::vector<u32>& srcRanks);
+    HcclResult ProcessLaneRdmaData(std::vector<u32>& dstRanks, std::vector<u32>& srcRanks);
     HcclResult ProcessRdmaData();
     HcclResult RunRDMA();
 
@@ -47,6 +47,10 @@ HcclResult AlltoAllVPairWise::Prepare(AlltoAllVBufferInfo &sendBuffer, AlltoAllV
     workMode_ = workMode;
     rankSendDisplsMapPtr_ = &rankSendDisplsMap;
     rankRecvDisplsMapPtr_ = &rankRecvDisplsMap;
+    window_ = 1;
+    subStreams_.clear();
+    signalMainToSub_.clear();
+    signalSubToMain_.clear();
 
     if (workMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
         CHK_PRT_RET((!isAlltoAllZCopyMode_ && scratchInputMem.size() != scratchOutputMem.size()),
@@ -61,6 +65,7 @@ HcclResult AlltoAllVPairWise::Prepare(AlltoAllVBufferInfo &sendBuffer, AlltoAllV
         scratchOutputMem_ = scratchOutputMem;
         scratchMemSize_ = scratchInputMem.size();
     }
+    slotSize_ = scratchMemSize_;
 
     sendBuffer_ = sendBuffer;
     recvBuffer_ = recvBuffer;
@@ -72,6 +77,36 @@ HcclResult AlltoAllVPairWise::Prepare(AlltoAllVBufferInfo &sendBuffer, AlltoAllV
     return HCCL_SUCCESS;
 }
 
+HcclResult AlltoAllVPairWise::PrepareWindow(u32 window, std::vector<Stream> &subStreams,
+    const std::vector<std::shared_ptr<LocalNotify>> &signalMainToSub,
+    const std::vector<std::shared_ptr<LocalNotify>> &signalSubToMain)
+{
+    CHK_PRT_RET(workMode_ != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE,
+        HCCL_ERROR("[AlltoAllVPairWise][PrepareWindow]window is only supported in op base mode"), HCCL_E_NOT_SUPPORT);
+    if (window <= 1) {
+        return HCCL_SUCCESS;
+    }
+    CHK_PRT_RET(subStreams.size() < window - 1 || signalMainToSub.size() < window - 1 ||
+        signalSubToMain.size() < window - 1,
+        HCCL_ERROR("[AlltoAllVPairWise][PrepareWindow]window[%u] exceeds resource, subStreams[%zu] "
+        "signalMainToSub[%zu] signalSubToMain[%zu]", window, subStreams.size(), signalMainToSub.size(),
+        signalSubToMain.size()), HCCL_E_PARA);
+
+    if (!isAlltoAllZCopyMode_) {
+        // 每个在途步独占一段scratch, 对端写入本端scratchOutput的同一偏移
+        u64 slotSize = (scratchMemSize_ / window) / HCCL_MIN_SLICE_ALIGN * HCCL_MIN_SLICE_ALIGN;
+        CHK_PRT_RET(slotSize == 0, HCCL_ERROR("[AlltoAllVPairWise][PrepareWindow]scratchMemSize[%llu] is too small "
+            "for window[%u]", scratchMemSize_, window), HCCL_E_PARA);
+        slotSize_ = slotSize;
+    }
+    window_ = window;
+    subStreams_.assign(subStreams.begin(), subStreams.begin() + (window - 1));
+    signalMainToSub_.assign(signalMainToSub.begin(), signalMainToSub.begin() + (window - 1));
+    signalSubToMain_.assign(signalSubToMain.begin(), signalSubToMain.begin() + (window - 1));
+    HCCL_INFO("[AlltoAllVPairWise][PrepareWindow]window[%u] slotSize[%llu]", window_, slotSize_);
+    return HCCL_SUCCESS;
+}
+
 HcclResult AlltoAllVPairWise::RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
 {
     HCCL_INFO("[AlltoAllVPairWise][RunAsync]: rank[%u] transportSize[%llu]", rank, links.size());
@@ -86,7 +121,9 @@ HcclResult AlltoAllVPairWise::RunAsync(const u32 rank, const u32 rankSize, const
         HCCL_E_PARA);
 
     CHK_RET(LocalCopy(rank));
-    if (workMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE &&
+    if (window_ > 1) {
+        CHK_RET(RunWindowedAlltoAll(rank, rankSize, links));
+    } else if (workMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE &&
         !isAlltoAllZCopyMode_) { // 单算子 && BCopy模式
         CHK_RET(RunBCopyAlltoAll(rank, rankSize, links));
     } else {
@@ -109,61 +146,114 @@ HcclResult AlltoAllVPairWise::LocalCopy(const u32 rank)
     return HCCL_SUCCESS;
 }
 
+/*
+ * 步骤i与步骤rankSize-i使用同一对链路(本端到rank+i的链路即步骤rankSize-i的prev链路), 成组后按组号轮转到window_条流上。
+ * 各rank的分组与流分配一致, 同一链路上的收发顺序在两端相同, 每条流上按组号递增执行, 不会产生环形等待
+ */
+HcclResult AlltoAllVPairWise::RunWindowedAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
+{
+    bool isBCopy = !isAlltoAllZCopyMode_;
+    for (u32 streamIndex = 0; streamIndex < window_ - 1; streamIndex++) {
+        CHK_RET(LocalNotify::Post(stream_, dispatcher_, signalMainToSub_[streamIndex], INVALID_VALUE_STAGE));
+        CHK_RET(LocalNotify::Wait(subStreams_[streamIndex], dispatcher_, signalMainToSub_[streamIndex],
+            INVALID_VALUE_STAGE));
+    }
+
+    u32 groupNum = rankSize / 2;
+    for (u32 group = 0; group < groupNum; group++) {
+        u32 slot = group % window_;
+        Stream &stream = (slot == 0) ? stream_ : subStreams_[slot - 1];
+        u32 step = group + 1;
+        u32 pairStep = rankSize - step;
+        HCCL_DEBUG("[AlltoAllVPairWise][RunWindowedAlltoAll]: rank[%u] group[%u] steps[%u, %u] slot[%u]",
+            rank, group, step, pairStep, slot);
+        if (isBCopy) {
+            CHK_RET(RunBCopyStep(rank, rankSize, step, slot, stream, links));
+            if (pairStep != step) {
+                CHK_RET(RunBCopyStep(rank, rankSize, pairStep, slot, stream, links));
+            }
+        } else {
+            CHK_RET(RunZCopyStep(rank, rankSize, step, stream, links));
+            if (pairStep != step) {
+                CHK_RET(RunZCopyStep(rank, rankSize, pairStep, stream, links));
+            }
+        }
+    }
+
+    for (u32 streamIndex = 0; streamIndex < window_ - 1; streamIndex++) {
+        CHK_RET(LocalNotify::Post(subStreams_[streamIndex], dispatcher_, signalSubToMain_[streamIndex],
+            INVALID_VALUE_STAGE));
+        CHK_RET(LocalNotify::Wait(stream_, dispatcher_, signalSubToMain_[streamIndex], INVALID_VALUE_STAGE));
+    }
+    return HCCL_SUCCESS;
+}
+
 HcclResult AlltoAllVPairWise::RunBCopyAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
 {
     for (u32 i = 1; i < rankSize; i++) {
-        u32 prevRank = (rank + rankSize - i) % rankSize;
-        u32 nextRank = (rank + i) % rankSize;
-        std::shared_ptr<Transport> prevTransport = links[prevRank];
-        std::shared_ptr<Transport> nextTransport = links[nextRank];
-
-        CHK_SMART_PTR_NULL(prevTransport);
-        CHK_SMART_PTR_NULL(nextTransport);
-
-        HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyAlltoAll]: prevRank[%u] nextRank[%u], step[%u]", prevRank, nextRank, i);
-
-        u64 sendBytes = sendBuffer_.counts[nextRank] * sendDataUnitBytes_;
-        u64 recvBytes = recvBuffer_.counts[prevRank] * recvDataUnitBytes_;
-
-        u64 sendDispBytes = sendBuffer_.displs[nextRank] * sendDataUnitBytes_;
-        u64 recvDispBytes = recvBuffer_.displs[prevRank] * recvDataUnitBytes_;
-
-        // scratchMemSize_ 的合法性已经在 Prepare 函数中校验
-        u32 sendTimes = (sendBytes / scratchMemSize_) + ((sendBytes % scratchMemSize_) == 0 ? 0 : 1);
-        u32 recvTimes = (recvBytes / scratchMemSize_) + ((recvBytes % scratchMemSize_) == 0 ? 0 : 1);
-
-        HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyAlltoAll]: rank[%u] "\
-                   "sendTimes[%u] recvTimes[%u] sendBytes[%llu] recvBytes[%llu] scratchMemSize_[%llu]",
-                   rank, sendTimes, recvTimes, sendBytes, recvBytes, scratchMemSize_);
-
-        u32 curSendTime = 0;
-        u32 curRecvTime = 0;
-        while (sendTimes != 0 || recvTimes != 0) {
-            u8 *sendAddr =
-                reinterpret_cast<u8 *>(sendBuffer_.mem.ptr()) + sendDispBytes + curSendTime * scratchMemSize_;
-            u8 *recvAddr =
-                reinterpret_cast<u8 *>(recvBuffer_.mem.ptr()) + recvDispBytes + curRecvTime * scratchMemSize_;
-            u64 curSendBytes = 0;
-            u64 curRecvBytes = 0;
-            CHK_RET(CalcSendRecvCounts(sendTimes, curSendTime, sendBytes, curSendBytes));
-            CHK_RET(CalcSendRecvCounts(recvTimes, curRecvTime, recvBytes, curRecvBytes));
-
-            HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyAlltoAll]: "\
-                        "curSendTime[%llu] curRecvTime[%llu] curSendBytes[%llu] curRecvBytes[%llu]",
-                curSendTime, curRecvTime, curSendBytes, curRecvBytes);
-
-            HcclResult ret = SendRecv(curSendBytes, curRecvBytes, sendAddr, recvAddr, prevTransport, nextTransport);
-            CHK_PRT_RET(ret != HCCL_SUCCESS,
-                HCCL_ERROR("[AlltoAllVPairWise][RunBCopyAlltoAll]: errNo[0x%016llx] "\
-                "curSendBytes[%llu] curRecvBytes[%llu] sendAddr[%p] recvAddr[%p]",
-                HCCL_ERROR_CODE(ret), curSendBytes, curRecvBytes, sendAddr, recvAddr),
-                ret);
-
-            curSendTime = curSendBytes != 0 ? curSendTime + 1 : curSendTime;
-            curRecvTime = curRecvBytes != 0 ? curRecvTime + 1 : curRecvTime;
-            if (curSendTime == sendTimes && curRecvTime == recvTimes) {
-                break;
-            }
+        CHK_RET(RunBCopyStep(rank, rankSize, i, 0, stream_, links));
+    }
+
+    return HCCL_SUCCESS;
+}
+
+HcclResult AlltoAllVPairWise::RunBCopyStep(const u32 rank, const u32 rankSize, u32 step, u32 slot, Stream &stream,
+    const std::vector<LINK> &links)
+{
+    u32 prevRank = (rank + rankSize - step) % rankSize;
+    u32 nextRank = (rank + step) % rankSize;
+    std::shared_ptr<Transport> prevTransport = links[prevRank];
+    std::shared_ptr<Transport> nextTransport = links[nextRank];
+
+    CHK_SMART_PTR_NULL(prevTransport);
+    CHK_SMART_PTR_NULL(nextTransport);
+
+    HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyStep]: prevRank[%u] nextRank[%u], step[%u] slot[%u]",
+        prevRank, nextRank, step, slot);
+
+    u64 sendBytes = sendBuffer_.counts[nextRank] * sendDataUnitBytes_;
+    u64 recvBytes = recvBuffer_.counts[prevRank] * recvDataUnitBytes_;
+
+    u64 sendDispBytes = sendBuffer_.displs[nextRank] * sendDataUnitBytes_;
+    u64 recvDispBytes = recvBuffer_.displs[prevRank] * recvDataUnitBytes_;
+    u64 slotOffset = slot * slotSize_;
+
+    // slotSize_ 的合法性已经在 Prepare/PrepareWindow 函数中校验
+    u32 sendTimes = (sendBytes / slotSize_) + ((sendBytes % slotSize_) == 0 ? 0 : 1);
+    u32 recvTimes = (recvBytes / slotSize_) + ((recvBytes % slotSize_) == 0 ? 0 : 1);
+
+    HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyStep]: rank[%u] "\
+               "sendTimes[%u] recvTimes[%u] sendBytes[%llu] recvBytes[%llu] slotSize_[%llu]",
+               rank, sendTimes, recvTimes, sendBytes, recvBytes, slotSize_);
+
+    u32 curSendTime = 0;
+    u32 curRecvTime = 0;
+    while (sendTimes != 0 || recvTimes != 0) {
+        u8 *sendAddr =
+            reinterpret_cast<u8 *>(sendBuffer_.mem.ptr()) + sendDispBytes + curSendTime * slotSize_;
+        u8 *recvAddr =
+            reinterpret_cast<u8 *>(recvBuffer_.mem.ptr()) + recvDispBytes + curRecvTime * slotSize_;
+        u64 curSendBytes = 0;
+        u64 curRecvBytes = 0;
+        CHK_RET(CalcSendRecvCounts(sendTimes, curSendTime, sendBytes, curSendBytes));
+        CHK_RET(CalcSendRecvCounts(recvTimes, curRecvTime, recvBytes, curRecvBytes));
+
+        HCCL_DEBUG("[AlltoAllVPairWise][RunBCopyStep]: "\
+                    "curSendTime[%llu] curRecvTime[%llu] curSendBytes[%llu] curRecvBytes[%llu]",
+            curSendTime, curRecvTime, curSendBytes, curRecvBytes);
+
+        HcclResult ret = SendRecv(curSendBytes, curRecvBytes, sendAddr, recvAddr, slotOffset, stream,
+            prevTransport, nextTransport);
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[AlltoAllVPairWise][RunBCopyStep]: errNo[0x%016llx] "\
+            "curSendBytes[%llu] curRecvBytes[%llu] sendAddr[%p] recvAddr[%p]",
+            HCCL_ERROR_CODE(ret), curSendBytes, curRecvBytes, sendAddr, recvAddr),
+            ret);
+
+        curSendTime = curSendBytes != 0 ? curSendTime + 1 : curSendTime;
+        curRecvTime = curRecvBytes != 0 ? curRecvTime + 1 : curRecvTime;
+        if (curSendTime == sendTimes && curRecvTime == recvTimes) {
+            break;
         }
     }
 
@@ -176,12 +266,12 @@ HcclResult AlltoAllVPairWise::CalcSendRecvCounts(u32 times, u32 curTime, u64 tot
         curBytes = 0;
     } else if (times == 1 && curTime == times - 1) { // 只发一次
         curBytes = totalBytes;
-    } else if (times > 1 && totalBytes % scratchMemSize_ == 0 && curTime < times) {
-        curBytes = scratchMemSize_;
-    } else if (times > 1 && totalBytes % scratchMemSize_ != 0 && curTime < times - 1) {
-        curBytes = scratchMemSize_;
-    } else if (times > 1 && totalBytes % scratchMemSize_ != 0 && curTime == times - 1) {
-        curBytes = totalBytes % scratchMemSize_;
+    } else if (times > 1 && totalBytes % slotSize_ == 0 && curTime < times) {
+        curBytes = slotSize_;
+    } else if (times > 1 && totalBytes % slotSize_ != 0 && curTime < times - 1) {
+        curBytes = slotSize_;
+    } else if (times > 1 && totalBytes % slotSize_ != 0 && curTime == times - 1) {
+        curBytes = totalBytes % slotSize_;
     } else {
         curBytes = 0;
     }
@@ -189,97 +279,126 @@ HcclResult AlltoAllVPairWise::CalcSendRecvCounts(u32 times, u32 curTime, u64 tot
 }
 
 HcclResult AlltoAllVPairWise::SendRecv(u64 curSendBytes, u64 curRecvBytes, u8 *sendAddr, u8 *recvAddr,
-    std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport)
+    u64 slotOffset, Stream &stream, std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport)
 {
     if (curRecvBytes > 0) {
-        CHK_RET(prevTransport->TxAck(stream_)); // transport sync record
+        CHK_RET(prevTransport->TxAck(stream)); // transport sync record
     }
     if (curSendBytes > 0) {
-        CHK_RET(nextTransport->RxAck(stream_)); // transport sync wait
+        CHK_RET(nextTransport->RxAck(stream)); // transport sync wait
         DeviceMem srcMem1 = DeviceMem::create(sendAddr, curSendBytes);
-        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, scratchInputMem_, srcMem1, stream_));
+        DeviceMem dstMem1 = scratchInputMem_.range(slotOffset, curSendBytes);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem1, srcMem1, stream));
         // send payload + notify
-        CHK_RET(nextTransport->TxAsync(UserMemType::OUTPUT_MEM, 0, scratchInputMem_.ptr(), curSendBytes, stream_));
+        CHK_RET(nextTransport->TxAsync(UserMemType::OUTPUT_MEM, slotOffset, dstMem1.ptr(), curSendBytes, stream));
     }
     if (curRecvBytes > 0) {
-        CHK_RET(prevTransport->RxAsync(UserMemType::INPUT_MEM, 0, scratchOutputMem_.ptr(), curRecvBytes, stream_));
+        DeviceMem srcMem = scratchOutputMem_.range(slotOffset, curRecvBytes);
+        CHK_RET(prevTransport->RxAsync(UserMemType::INPUT_MEM, slotOffset, srcMem.ptr(), curRecvBytes, stream));
         DeviceMem dstMem = DeviceMem::create(recvAddr, curRecvBytes);
-        DeviceMem srcMem = scratchOutputMem_.range(0, curRecvBytes);
-        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, stream_));
-        CHK_RET(prevTransport->TxAck(stream_)); // record
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, stream));
+        CHK_RET(prevTransport->TxAck(stream)); // record
     }
     if (curSendBytes > 0) {
-        CHK_RET(nextTransport->RxAck(stream_)); // wait
-        CHK_RET(nextTransport->TxDataSignal(stream_)); // record
+        CHK_RET(nextTransport->RxAck(stream)); // wait
+        CHK_RET(nextTransport->TxDataSignal(stream)); // record
     }
     if (curRecvBytes > 0) {
-        CHK_RET(prevTransport->RxDataSignal(stream_)); // wait
-        CHK_RET(prevTransport->RxWaitDone(stream_));
+        CHK_RET(prevTransport->RxDataSignal(stream)); // wait
+        CHK_RET(prevTransport->RxWaitDone(stream));
     }
     if (curSendBytes > 0) {
-        CHK_RET(nextTransport->TxWaitDone(stream_));
+        CHK_RET(nextTransport->TxWaitDone(stream));
     }
     return HCCL_SUCCESS;
 }
 
-HcclResult AlltoAllVPairWise::SendRecv(TxMemoryInfo txMemoryInfo, RxMemoryInfo rxMemoryInfo,
+HcclResult AlltoAllVPairWise::SendRecv(TxMemoryInfo txMemoryInfo, RxMemoryInfo rxMemoryInfo, Stream &stream,
     std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport)
 {
+    // 收发两个方向分别按数据量跳过, 对端按相同的数据量判断, 握手两端一致
+    bool needSend = txMemoryInfo.len > 0;
+    bool needRecv = rxMemoryInfo.len > 0;
     // send payload + notify
-    CHK_RET(nextTransport->TxAsync(txMemoryInfo.dstMemType, txMemoryInfo.dstOffset, txMemoryInfo.src,
-        txMemoryInfo.len, stream_));
-    CHK_RET(prevTransport->RxAsync(rxMemoryInfo.srcMemType, rxMemoryInfo.srcOffset, rxMemoryInfo.dst,
-        rxMemoryInfo.len, stream_));
-    CHK_RET(prevTransport->TxAck(stream_)); // record
-    CHK_RET(nextTransport->RxAck(stream_)); // wait
-    CHK_RET(nextTransport->TxDataSignal(stream_)); // record
-    CHK_RET(prevTransport->RxDataSignal(stream_)); // wait
-    CHK_RET(prevTransport->RxWaitDone(stream_));
-    CHK_RET(nextTransport->TxWaitDone(stream_));
+    if (needSend) {
+        CHK_RET(nextTransport->TxAsync(txMemoryInfo.dstMemType, txMemoryInfo.dstOffset, txMemoryInfo.src,
+            txMemoryInfo.len, stream));
+    }
+    if (needRecv) {
+        CHK_RET(prevTransport->RxAsync(rxMemoryInfo.srcMemType, rxMemoryInfo.srcOffset, rxMemoryInfo.dst,
+            rxMemoryInfo.len, stream));
+        CHK_RET(prevTransport->TxAck(stream)); // record
+    }
+    if (needSend) {
+        CHK_RET(nextTransport->RxAck(stream)); // wait
+        CHK_RET(nextTransport->TxDataSignal(stream)); // record
+    }
+    if (needRecv) {
+        CHK_RET(prevTransport->RxDataSignal(stream)); // wait
+        CHK_RET(prevTransport->RxWaitDone(stream));
+    }
+    if (needSend) {
+        CHK_RET(nextTransport->TxWaitDone(stream));
+    }
     return HCCL_SUCCESS;
 }
 
 HcclResult AlltoAllVPairWise::RunZCopyAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
 {
     for (u32 i = 1; i < rankSize; i++) {
-        u32 prevRank = (rank + rankSize - i) % rankSize;
-        u32 nextRank = (rank + i) % rankSize;
-        std::shared_ptr<Transport> prevTransport = links[prevRank];
-        std::shared_ptr<Transport> nextTransport = links[nextRank];
-
-        CHK_SMART_PTR_NULL(prevTransport);
-        CHK_SMART_PTR_NULL(nextTransport);
-
-        HCCL_DEBUG("[AlltoAllVPairWise][RunZCopyAlltoAll]: prevRank[%u] nextRank[%u], step[%u]", prevRank, nextRank, i);
+        CHK_RET(RunZCopyStep(rank, rankSize, i, stream_, links));
+    }
 
-        CHK_RET(prevTransport->TxAck(stream_)); // transport sync record
-        CHK_RET(nextTransport->RxAck(stream_)); // transport sync wait
+    return HCCL_SUCCESS;
+}
 
-        u64 sendBytes = sendBuffer_.counts[nextRank] * sendDataUnitBytes_;
-        u64 recvBytes = recvBuffer_.counts[prevRank] * recvDataUnitBytes_;
-        u64 sendDispBytes = sendBuffer_.displs[nextRank] * sendDataUnitBytes_;
-        u64 recvDispBytes = recvBuffer_.displs[prevRank] * recvDataUnitBytes_;
-        u8 *sendAddr = reinterpret_cast<u8 *>(sendBuffer_.mem.ptr()) + sendDispBytes;
-        u8 *recvAddr = reinterpret_cast<u8 *>(recvBuffer_.mem.ptr()) + recvDispBytes;
+HcclResult AlltoAllVPairWise::RunZCopyStep(const u32 rank, const u32 rankSize, u32 step, Stream &stream,
+    const std::vector<LINK> &links)
+{
+    u32 prevRank = (rank + rankSize - step) % rankSize;
+    u32 nextRank = (rank + step) % rankSize;
+    std::shared_ptr<Transport> prevTransport = links[prevRank];
+    std::shared_ptr<Transport> nextTransport = links[nextRank];
 
-        u64 dstOffset = rankRecvDisplsMapPtr_->at(nextRank)[rank];
-        u64 srcOffset = rankSendDisplsMapPtr_->at(prevRank)[rank];
+    CHK_SMART_PTR_NULL(prevTransport);
+    CHK_SMART_PTR_NULL(nextTransport);
 
-        TxMemoryInfo txMemoryInfo{UserMemType::OUTPUT_MEM, dstOffset, sendAddr, sendBytes};
-        RxMemoryInfo rxMemoryInfo{UserMemType::INPUT_MEM, srcOffset, recvAddr, recvBytes};
+    HCCL_DEBUG("[AlltoAllVPairWise][RunZCopyStep]: prevRank[%u] nextRank[%u], step[%u]", prevRank, nextRank, step);
 
-        HCCL_DEBUG("[AlltoAllVPairWise][RunZCopyAlltoAll]: sendBytes[%llu] recvBytes[%llu] sendDispBytes[%llu]" \
-            " dstOffset[%llu]", sendBytes, recvBytes, sendDispBytes, dstOffset);
-        HcclResult ret = SendRecv(txMemoryInfo, rxMemoryInfo, prevTransport, nextTransport);
-        CHK_PRT_RET(ret != HCCL_SUCCESS,
-            HCCL_ERROR("[AlltoAllVPairWise][RunZCopyAlltoAll]errNo[0x%016llx] "\
-            "sendBytes[%llu] recvBytes[%llu] sendAddr[%p] dstOffset[%llu]",
-            HCCL_ERROR_CODE(ret), sendBytes, recvBytes, sendAddr, dstOffset),
-            ret);
+    u64 sendBytes = sendBuffer_.counts[nextRank] * sendDataUnitBytes_;
+    u64 recvBytes = recvBuffer_.counts[prevRank] * recvDataUnitBytes_;
+    if (sendBytes == 0 && recvBytes == 0) {
+        return HCCL_SUCCESS;
     }
+    if (recvBytes > 0) {
+        CHK_RET(prevTransport->TxAck(stream)); // transport sync record
+    }
+    if (sendBytes > 0) {
+        CHK_RET(nextTransport->RxAck(stream)); // transport sync wait
+    }
+    u64 sendDispBytes = sendBuffer_.displs[nextRank] * sendDataUnitBytes_;
+    u64 recvDispBytes = recvBuffer_.displs[prevRank] * recvDataUnitBytes_;
+    u8 *sendAddr = reinterpret_cast<u8 *>(sendBuffer_.mem.ptr()) + sendDispBytes;
+    u8 *recvAddr = reinterpret_cast<u8 *>(recvBuffer_.mem.ptr()) + recvDispBytes;
+
+    u64 dstOffset = rankRecvDisplsMapPtr_->at(nextRank)[rank];
+    u64 srcOffset = rankSendDisplsMapPtr_->at(prevRank)[rank];
+
+    TxMemoryInfo txMemoryInfo{UserMemType::OUTPUT_MEM, dstOffset, sendAddr, sendBytes};
+    RxMemoryInfo rxMemoryInfo{UserMemType::INPUT_MEM, srcOffset, recvAddr, recvBytes};
+
+    HCCL_DEBUG("[AlltoAllVPairWise][RunZCopyStep]: sendBytes[%llu] recvBytes[%llu] sendDispBytes[%llu]" \
+        " dstOffset[%llu]", sendBytes, recvBytes, sendDispBytes, dstOffset);
+    HcclResult ret = SendRecv(txMemoryInfo, rxMemoryInfo, stream, prevTransport, nextTransport);
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[AlltoAllVPairWise][RunZCopyStep]errNo[0x%016llx] "\
+        "sendBytes[%llu] recvBytes[%llu] sendAddr[%p] dstOffset[%llu]",
+        HCCL_ERROR_CODE(ret), sendBytes, recvBytes, sendAddr, dstOffset),
+        ret);
 
     return HCCL_SUCCESS;
 }
+
 HcclResult AlltoAllVPairWise::GetNslbAdjInfo(const u32 rank, const u32 rankSize,
                                          const std::vector<LINK> &links, AdjInfo& nslbAdjInfo)
 {
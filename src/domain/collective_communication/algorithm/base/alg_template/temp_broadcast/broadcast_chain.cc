@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include "broadcast_chain_pub.h"
+#include "device_capacity.h"
+#include "alg_template_register.h"
+
+namespace hccl {
+constexpr u32 PIPELINE_MAX_SEGMENT_NUM = 32;                // 段数上限, 每多一段多一轮ack和数据信号
+constexpr u64 PIPELINE_MIN_SEGMENT_SIZE = 32 * 1024;        // 单段最小字节数, 再小时启动开销占主导
+
+namespace {
+using TreeNodeFunc = std::function<void(const u32 rank, PipelineTreeNode &node)>;
+
+// 一棵流水树的形状: 单个rank每段最多发送maxChildNum次, 首段在lastArriveStep步后到达最远的rank
+struct PipelineTreeShape {
+    u32 maxChildNum = 0;
+    u32 lastArriveStep = 0;
+};
+
+// 父节点按children顺序串行发送, 第k个子节点比父节点晚k+1步收到首段
+PipelineTreeShape GetTreeShape(const u32 rankSize, const TreeNodeFunc &getNode)
+{
+    PipelineTreeShape shape;
+    std::vector<u32> arriveStep(rankSize, 0);
+    std::vector<u32> visitQueue = {0};
+    PipelineTreeNode node;
+    for (u32 i = 0; i < visitQueue.size(); i++) {
+        u32 rank = visitQueue[i];
+        getNode(rank, node);
+        shape.maxChildNum = std::max<u32>(shape.maxChildNum, node.children.size());
+        for (u32 k = 0; k < node.children.size(); k++) {
+            u32 child = node.children[k];
+            arriveStep[child] = arriveStep[rank] + k + 1;
+            shape.lastArriveStep = std::max(shape.lastArriveStep, arriveStep[child]);
+            visitQueue.push_back(child);
+        }
+    }
+    return shape;
+}
+
+// alpha-beta模型: T(m) = (a * m + b) * (alpha + S / (m * B)), 其中a = maxChildNum, b = lastArriveStep - a
+double CalcPipelineCost(const PipelineTreeShape &shape, const u64 dataSize, const double bytesPerUs,
+    const double delay, const u32 segmentNum)
+{
+    double stepNum = static_cast<double>(shape.maxChildNum) * (segmentNum - 1) + shape.lastArriveStep;
+    return stepNum * (delay + static_cast<double>(dataSize) / segmentNum / bytesPerUs);
+}
+
+// 对T(m)求导得 m* = sqrt(b * S / (a * alpha * B)), 取其上下相邻整数中耗时更小者
+u32 CalcOptimalSegmentNum(const PipelineTreeShape &shape, const u64 dataSize, const double bytesPerUs,
+    const double delay)
+{
+    if (shape.maxChildNum == 0 || shape.lastArriveStep <= shape.maxChildNum) {
+        return 1;
+    }
+    u64 maxSegmentNum = std::min<u64>(PIPELINE_MAX_SEGMENT_NUM, dataSize / PIPELINE_MIN_SEGMENT_SIZE);
+    if (maxSegmentNum <= 1) {
+        return 1;
+    }
+    double b = shape.lastArriveStep - shape.maxChildNum;
+    double best = std::sqrt(b * dataSize / (shape.maxChildNum * delay * bytesPerUs));
+    u32 lower = static_cast<u32>(std::max(1.0, std::min(std::floor(best), static_cast<double>(maxSegmentNum))));
+    u32 upper = std::min<u32>(lower + 1, maxSegmentNum);
+    return (CalcPipelineCost(shape, dataSize, bytesPerUs, delay, upper) <
+        CalcPipelineCost(shape, dataSize, bytesPerUs, delay, lower)) ? upper : lower;
+}
+}
+
+void GetChainTreeNode(const u32 rank, const u32 rankSize, const u32 root, PipelineTreeNode &node)
+{
+    node.parent = INVALID_VALUE_RANKID;
+    node.children.clear();
+    u32 vRank = (rank + rankSize - root) % rankSize;
+    if (vRank != 0) {
+        node.parent = (rank + rankSize - 1) % rankSize;
+    }
+    if (vRank + 1 < rankSize) {
+        node.children.push_back((rank + 1) % rankSize);
+    }
+}
+
+// 以root为0重新编号后按radix进制构造: 父节点为去掉最低非零位的编号, 子节点在更低的位上依次加1..radix-1
+void GetKnomialTreeNode(const u32 rank, const u32 rankSize, const u32 root, const u32 radix, PipelineTreeNode &node)
+{
+    node.parent = INVALID_VALUE_RANKID;
+    node.children.clear();
+    u32 vRank = (rank + rankSize - root) % rankSize;
+
+    u64 mask = 1;
+    while (mask < rankSize && (vRank / mask) % radix == 0) {
+        mask *= radix;
+    }
+    if (vRank != 0) {
+        u32 vParent = vRank - ((vRank / mask) % radix) * mask;
+        node.parent = (vParent + root) % rankSize;
+    }
+
+    // 高位上的子节点子树更大, 先发送
+    for (u64 level = mask / radix; level > 0; level /= radix) {
+        for (u32 digit = 1; digit < radix; digit++) {
+            u64 vChild = vRank + digit * level;
+            if (vChild >= rankSize) {
+                break;
+            }
+            node.children.push_back((vChild + root) % rankSize);
+        }
+    }
+}
+
+HcclResult CalcPipelinePlan(const u64 dataSize, const u32 rankSize, const u32 userRankSize,
+    const u32 devNumPerAggregation, const float delay, PipelinePlan &plan)
+{
+    plan = PipelinePlan();
+    if (rankSize <= 1) {
+        return HCCL_SUCCESS;
+    }
+
+    float bandWidth; // 网卡出口带宽, 单位GB/s
+    CHK_RET(GetBandWidthPerNPU(1, userRankSize, devNumPerAggregation, bandWidth));
+    const double bytesPerUs = static_cast<double>(bandWidth) * 1000;
+    CHK_PRT_RET(bytesPerUs <= 0, HCCL_ERROR("[CalcPipelinePlan]bandWidth[%f] is invalid", bandWidth),
+        HCCL_E_INTERNAL);
+    CHK_PRT_RET(delay <= 0, HCCL_ERROR("[CalcPipelinePlan]delay[%f] is invalid", delay), HCCL_E_PARA);
+
+    PipelineTreeShape chainShape = GetTreeShape(rankSize, [rankSize](const u32 rank, PipelineTreeNode &node) {
+        GetChainTreeNode(rank, rankSize, 0, node);
+    });
+    PipelineTreeShape knomialShape = GetTreeShape(rankSize, [rankSize](const u32 rank, PipelineTreeNode &node) {
+        GetKnomialTreeNode(rank, rankSize, 0, KNOMIAL_TREE_RADIX, node);
+    });
+
+    u32 chainSegNum = CalcOptimalSegmentNum(chainShape, dataSize, bytesPerUs, delay);
+    u32 knomialSegNum = CalcOptimalSegmentNum(knomialShape, dataSize, bytesPerUs, delay);
+    double chainCost = CalcPipelineCost(chainShape, dataSize, bytesPerUs, delay, chainSegNum);
+    double knomialCost = CalcPipelineCost(knomialShape, dataSize, bytesPerUs, delay, knomialSegNum);
+
+    plan.useKnomialTree = knomialCost < chainCost;
+    plan.segmentNum = plan.useKnomialTree ? knomialSegNum : chainSegNum;
+    plan.costUs = plan.useKnomialTree ? knomialCost : chainCost;
+    HCCL_INFO("[CalcPipelinePlan]dataSize[%llu] rankSize[%u] chain[seg %u, %.2f us] knomial[seg %u, %.2f us]",
+        dataSize, rankSize, chainSegNum, chainCost, knomialSegNum, knomialCost);
+    return HCCL_SUCCESS;
+}
+
+void GetPipelineSegments(const u64 count, const u32 unitSize, const u32 segmentNum, std::vector<Slice> &segments)
+{
+    u64 segNum = (segmentNum == 0) ? 1 : segmentNum;
+    segNum = (count < segNum) ? count : segNum;
+    segments.clear();
+    if (segNum == 0) {
+        return;
+    }
+    const u64 baseCount = count / segNum;
+    const u64 residueCount = count % segNum;
+    segments.resize(segNum);
+    u64 offset = 0;
+    for (u64 i = 0; i < segNum; i++) {
+        segments[i].offset = offset;
+        segments[i].size = (baseCount + ((i < residueCount) ? 1 : 0)) * unitSize;
+        offset += segments[i].size;
+    }
+}
+
+BroadcastChain::BroadcastChain(const HcclDispatcher dispatcher) : AlgTemplateBase(dispatcher)
+{
+}
+
+BroadcastChain::~BroadcastChain()
+{
+}
+
+HcclResult BroadcastChain::Prepare(PrepareData &param)
+{
+    segmentNum_ = (param.segmentNum == 0) ? 1 : param.segmentNum;
+    return AlgTemplateBase::Prepare(param.inputMem, param.outputMem, param.scratchMem, param.count,
+        param.dataType, param.stream, HCCL_REDUCE_RESERVED, param.root,
+        std::vector<Slice>(0), param.baseOffset);
+}
+
+void BroadcastChain::CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const
+{
+    GetChainTreeNode(rank, rankSize, root_, node);
+}
+
+HcclResult BroadcastChain::CheckLinks(const PipelineTreeNode &node, const std::vector<LINK> &links) const
+{
+    if (node.parent != INVALID_VALUE_RANKID) {
+        CHK_SMART_PTR_NULL(links[node.parent]);
+    }
+    for (const u32 child : node.children) {
+        CHK_SMART_PTR_NULL(links[child]);
+    }
+    return HCCL_SUCCESS;
+}
+
+// 流水broadcast算法的函数入口
+HcclResult BroadcastChain::RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
+{
+    CHK_SMART_PTR_NULL(dispatcher_);
+    CHK_PTR_NULL(stream_.ptr());
+    CHK_PRT_RET(!outputMem_ || !inputMem_,
+        HCCL_ERROR("[BroadcastChain][RunAsync]rank[%u] inputmem or outputmem is null", rank), HCCL_E_PTR);
+    CHK_PRT_RET(links.size() < rankSize,
+        HCCL_ERROR("[BroadcastChain][RunAsync]rank[%u] linksize[%zu] is less than rankSize[%u]", rank,
+        links.size(), rankSize), HCCL_E_INTERNAL);
+    CHK_PRT_RET(root_ >= rankSize,
+        HCCL_ERROR("[BroadcastChain][RunAsync]rank[%u] root[%u] is out of rankSize[%u]", rank, root_, rankSize),
+        HCCL_E_PARA);
+    HCCL_INFO("BroadcastChain run: rank[%u] ranksize[%u] root[%u] inputMem[%p] outputMem[%p] count[%llu] "
+        "segmentNum[%u]", rank, rankSize, root_, inputMem_.ptr(), outputMem_.ptr(), count_, segmentNum_);
+
+    const u32 unitSize = DataUnitSize(dataType_);
+    CHK_PRT_RET(unitSize == 0, HCCL_ERROR("[BroadcastChain][RunAsync]rank[%u] unit data size is zero", rank),
+        HCCL_E_INTERNAL);
+    CHK_PRT_RET(count_ == 0, HCCL_INFO("[BroadcastChain][RunAsync] count_[%llu], do nothing.", count_),
+        HCCL_SUCCESS);
+
+    // root的数据在input上, 逐段转发均基于output进行
+    if (rank == root_ && inputMem_ != outputMem_) {
+        DeviceMem src = inputMem_.range(baseOffset_, count_ * unitSize);
+        DeviceMem dst = outputMem_.range(baseOffset_, count_ * unitSize);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dst, src, stream_));
+    }
+    if (rankSize == 1) {
+        return HCCL_SUCCESS;
+    }
+
+    PipelineTreeNode node;
+    CalcTreeNode(rank, rankSize, node);
+    CHK_RET(CheckLinks(node, links));
+
+    std::vector<Slice> segments;
+    GetPipelineSegments(count_, unitSize, segmentNum_, segments);
+
+    // 子节点先告知父节点本端output可写, 之后每收完一段再授权下一段, 保证同一link上最多一段数据在途
+    if (node.parent != INVALID_VALUE_RANKID) {
+        CHK_RET(links[node.parent]->TxAck(stream_));
+    }
+    for (u32 segIdx = 0; segIdx < segments.size(); segIdx++) {
+        CHK_PRT_RET(RunSegment(node, segments[segIdx], segIdx + 1 == segments.size(), links) != HCCL_SUCCESS,
+            HCCL_ERROR("[BroadcastChain][RunAsync]rank[%u] segment[%u] offset[%llu] size[%llu] run failed", rank,
+            segIdx, segments[segIdx].offset, segments[segIdx].size), HCCL_E_INTERNAL);
+    }
+
+    if (barrierSwitchOn_) {
+        CHK_RET(ExecuteTreeBarrier(node.parent, node.children, links, stream_));
+    }
+    HCCL_INFO("BroadcastChain finished: rank[%u] ranksize[%u] segmentNum[%zu]", rank, rankSize, segments.size());
+    return HCCL_SUCCESS;
+}
+
+HcclResult BroadcastChain::RunSegment(const PipelineTreeNode &node, const Slice &segment, const bool isLastSegment,
+    const std::vector<LINK> &links)
+{
+    const u64 dstOffset = baseOffset_ + segment.offset;
+    void *segPtr = static_cast<u8 *>(outputMem_.ptr()) + dstOffset;
+    if (node.parent != INVALID_VALUE_RANKID) {
+        const LINK &parentLink = links[node.parent];
+        CHK_RET(parentLink->RxAsync(UserMemType::OUTPUT_MEM, dstOffset, segPtr, segment.size, stream_));
+        if (!isLastSegment) {
+            CHK_RET(parentLink->TxAck(stream_));
+        }
+    }
+    for (const u32 child : node.children) {
+        const LINK &childLink = links[child];
+        CHK_RET(childLink->RxAck(stream_));
+        CHK_RET(childLink->TxAsync(UserMemType::OUTPUT_MEM, dstOffset, segPtr, segment.size, stream_));
+    }
+    return HCCL_SUCCESS;
+}
+
+BroadcastKnomial::BroadcastKnomial(const HcclDispatcher dispatcher) : BroadcastChain(dispatcher)
+{
+}
+
+BroadcastKnomial::~BroadcastKnomial()
+{
+}
+
+void BroadcastKnomial::CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const
+{
+    GetKnomialTreeNode(rank, rankSize, root_, KNOMIAL_TREE_RADIX, node);
+}
+
+REGISTER_TEMPLATE(TemplateType::TEMPLATE_BROADCAST_CHAIN, BroadcastChain);
+REGISTER_TEMPLATE(TemplateType::TEMPLATE_BROADCAST_KNOMIAL, BroadcastKnomial);
+}  // namespace hccl
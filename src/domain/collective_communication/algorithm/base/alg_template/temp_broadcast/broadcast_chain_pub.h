@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef BROADCAST_CHAIN_PUB_H
+#define BROADCAST_CHAIN_PUB_H
+
+#include "alg_template_base_pub.h"
+#include "mem_device_pub.h"
+#include "stream_pub.h"
+
+namespace hccl {
+// 流水链式broadcast: 数据切成segmentNum段, root沿链逐段下发, 每个rank收到一段后立即转发给下一个rank
+class BroadcastChain : public AlgTemplateBase {
+public:
+    using AlgTemplateBase::Prepare;
+    explicit BroadcastChain(const HcclDispatcher dispatcher);
+    ~BroadcastChain() override;
+
+    HcclResult Prepare(PrepareData &param) override;
+
+    HcclResult RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links) override;
+
+protected:
+    virtual void CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const;
+
+private:
+    HcclResult CheckLinks(const PipelineTreeNode &node, const std::vector<LINK> &links) const;
+    HcclResult RunSegment(const PipelineTreeNode &node, const Slice &segment, const bool isLastSegment,
+        const std::vector<LINK> &links);
+
+    u32 segmentNum_ = 1;
+};
+
+// 流水k叉树broadcast: 与链式相同的逐段转发流程, 树深为ceil(log_k(rankSize)), 适合中等数据量
+class BroadcastKnomial : public BroadcastChain {
+public:
+    explicit BroadcastKnomial(const HcclDispatcher dispatcher);
+    ~BroadcastKnomial() override;
+
+protected:
+    void CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const override;
+};
+}  // namespace hccl
+
+#endif /* BROADCAST_CHAIN_PUB_H */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "reduce_chain_pub.h"
+#include "alg_template_register.h"
+
+namespace hccl {
+ReduceChain::ReduceChain(const HcclDispatcher dispatcher) : AlgTemplateBase(dispatcher)
+{
+}
+
+ReduceChain::~ReduceChain()
+{
+}
+
+HcclResult ReduceChain::Prepare(PrepareData &param)
+{
+    reduceAttr_ = param.reduceAttr;
+    segmentNum_ = (param.segmentNum == 0) ? 1 : param.segmentNum;
+    return AlgTemplateBase::Prepare(param.inputMem, param.outputMem, param.scratchMem, param.count,
+        param.dataType, param.stream, param.reductionOp, param.root,
+        std::vector<Slice>(0), param.baseOffset);
+}
+
+void ReduceChain::CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const
+{
+    GetChainTreeNode(rank, rankSize, root_, node);
+}
+
+HcclResult ReduceChain::CheckLinks(const PipelineTreeNode &node, const std::vector<LINK> &links) const
+{
+    if (node.parent != INVALID_VALUE_RANKID) {
+        CHK_SMART_PTR_NULL(links[node.parent]);
+    }
+    for (const u32 child : node.children) {
+        CHK_SMART_PTR_NULL(links[child]);
+    }
+    return HCCL_SUCCESS;
+}
+
+// 流水reduce算法的函数入口
+HcclResult ReduceChain::RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
+{
+    CHK_SMART_PTR_NULL(dispatcher_);
+    CHK_PTR_NULL(stream_.ptr());
+    CHK_PRT_RET(!outputMem_ || !inputMem_,
+        HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] inputmem or outputmem is null", rank), HCCL_E_PTR);
+    HCCL_INFO("ReduceChain run: rank[%u] ranksize[%u] root[%u] inputMem[%p] outputMem[%p] count[%llu] "
+        "segmentNum[%u]", rank, rankSize, root_, inputMem_.ptr(), outputMem_.ptr(), count_, segmentNum_);
+
+    // 如果ranksize为1, 从input->output
+    if (rankSize == 1) {
+        if (inputMem_ != outputMem_) {
+            CHK_RET(HcclD2DMemcpyAsync(dispatcher_, outputMem_, inputMem_, stream_));
+        }
+        return HCCL_SUCCESS;
+    }
+    CHK_PRT_RET(links.size() < rankSize,
+        HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] linksize[%zu] is less than rankSize[%u]", rank,
+        links.size(), rankSize), HCCL_E_INTERNAL);
+    CHK_PRT_RET(root_ >= rankSize,
+        HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] root[%u] is out of rankSize[%u]", rank, root_, rankSize),
+        HCCL_E_PARA);
+    // 子节点的数据先落到output对应位置再规约进input, 两者不能是同一块内存
+    CHK_PRT_RET(inputMem_ == outputMem_,
+        HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] inputmem and outputmem must be different", rank), HCCL_E_PARA);
+
+    const u32 unitSize = DataUnitSize(dataType_);
+    CHK_PRT_RET(unitSize == 0, HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] unit data size is zero", rank),
+        HCCL_E_INTERNAL);
+    CHK_PRT_RET(count_ == 0, HCCL_INFO("[ReduceChain][RunAsync] count_[%llu], do nothing.", count_), HCCL_SUCCESS);
+
+    // 父节点用ack逐段授权子节点写入, 不走inline reduce的握手流程
+    const u64 reduceAttr = reduceAttr_ & ~INLINE_REDUCE_BITMASK;
+    senderInfo_.reset(new (std::nothrow) Sender(dataType_, reductionOp_, reduceAttr));
+    CHK_SMART_PTR_NULL(senderInfo_);
+    reducerInfo_.reset(new (std::nothrow) Reducer(dataType_, reductionOp_, reduceAttr));
+    CHK_SMART_PTR_NULL(reducerInfo_);
+
+    PipelineTreeNode node;
+    CalcTreeNode(rank, rankSize, node);
+    CHK_RET(CheckLinks(node, links));
+
+    std::vector<Slice> segments;
+    GetPipelineSegments(count_, unitSize, segmentNum_, segments);
+    for (u32 segIdx = 0; segIdx < segments.size(); segIdx++) {
+        CHK_PRT_RET(RunSegment(node, segments[segIdx], links) != HCCL_SUCCESS,
+            HCCL_ERROR("[ReduceChain][RunAsync]rank[%u] segment[%u] offset[%llu] size[%llu] run failed", rank,
+            segIdx, segments[segIdx].offset, segments[segIdx].size), HCCL_E_INTERNAL);
+    }
+
+    if (barrierSwitchOn_) {
+        CHK_RET(ExecuteTreeBarrier(node.parent, node.children, links, stream_));
+    }
+    HCCL_INFO("ReduceChain finished: rank[%u] ranksize[%u] segmentNum[%zu]", rank, rankSize, segments.size());
+    return HCCL_SUCCESS;
+}
+
+// 子节点依次获得授权后把本段写入父节点output, 父节点规约进input; 同一时刻每段output只有一个子节点在写
+HcclResult ReduceChain::RunSegment(const PipelineTreeNode &node, const Slice &segment,
+    const std::vector<LINK> &links)
+{
+    DeviceMem inSeg = inputMem_.range(segment.offset, segment.size);
+    DeviceMem outSeg = outputMem_.range(segment.offset, segment.size);
+    CHK_PTR_NULL(inSeg.ptr());
+    CHK_PTR_NULL(outSeg.ptr());
+    const u64 remoteOffset = baseOffset_ + segment.offset;
+
+    for (const u32 child : node.children) {
+        const LINK &childLink = links[child];
+        CHK_RET(childLink->TxAck(stream_));
+        CHK_RET(reducerInfo_->run(dispatcher_, childLink, remoteOffset, inSeg, inSeg, outSeg, stream_));
+    }
+
+    if (node.parent == INVALID_VALUE_RANKID) {
+        // root上规约完成即为最终结果
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, outSeg, inSeg, stream_));
+        return HCCL_SUCCESS;
+    }
+
+    const LINK &parentLink = links[node.parent];
+    CHK_RET(parentLink->RxAck(stream_));
+    CHK_RET(senderInfo_->run(parentLink, remoteOffset, inSeg, stream_));
+    return HCCL_SUCCESS;
+}
+
+ReduceKnomial::ReduceKnomial(const HcclDispatcher dispatcher) : ReduceChain(dispatcher)
+{
+}
+
+ReduceKnomial::~ReduceKnomial()
+{
+}
+
+void ReduceKnomial::CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const
+{
+    GetKnomialTreeNode(rank, rankSize, root_, KNOMIAL_TREE_RADIX, node);
+}
+
+REGISTER_TEMPLATE(TemplateType::TEMPLATE_REDUCE_CHAIN, ReduceChain);
+REGISTER_TEMPLATE(TemplateType::TEMPLATE_REDUCE_KNOMIAL, ReduceKnomial);
+}  // namespace hccl
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef REDUCE_CHAIN_PUB_H
+#define REDUCE_CHAIN_PUB_H
+
+#include "alg_template_base_pub.h"
+#include "reducer_pub.h"
+#include "sender_pub.h"
+
+namespace hccl {
+// 流水链式reduce: 数据切成segmentNum段, 每段从链尾逐跳规约到root, 各段在链上流水推进
+class ReduceChain : public AlgTemplateBase {
+public:
+    using AlgTemplateBase::Prepare;
+    explicit ReduceChain(const HcclDispatcher dispatcher);
+    ~ReduceChain() override;
+
+    HcclResult Prepare(PrepareData &param) override;
+
+    HcclResult RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links) override;
+
+protected:
+    virtual void CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const;
+
+private:
+    HcclResult CheckLinks(const PipelineTreeNode &node, const std::vector<LINK> &links) const;
+    HcclResult RunSegment(const PipelineTreeNode &node, const Slice &segment, const std::vector<LINK> &links);
+
+    u64 reduceAttr_ = 0; /* 0x1:表示data_type + reduce_type支持inlinereduce  */
+    u32 segmentNum_ = 1;
+    std::unique_ptr<Sender> senderInfo_;
+    std::unique_ptr<Reducer> reducerInfo_;
+};
+
+// 流水k叉树reduce: 父节点依次规约各子节点的同一段后再上送, 树深为ceil(log_k(rankSize))
+class ReduceKnomial : public ReduceChain {
+public:
+    explicit ReduceKnomial(const HcclDispatcher dispatcher);
+    ~ReduceKnomial() override;
+
+protected:
+    void CalcTreeNode(const u32 rank, const u32 rankSize, PipelineTreeNode &node) const override;
+};
+}  // namespace hccl
+
+#endif /* REDUCE_CHAIN_PUB_H */
@@ -38,7 +38,7 @@ HcclResult ReduceScatterNHR::RunAsync(const u32 rank, const u32 rankSize, const
 
     if (isNeedMerge == true) {
         // 获取tree映射，存储到类对象的成员变量中
-        GetSliceMap(rankSize);
+        GetRankMapping(rankSize);
     }
 
     // 判断rank_size == 1
@@ -96,73 +96,6 @@ HcclResult ReduceScatterNHR::RunAsync(const u32 rank, const u32 rankSize, const
     return HCCL_SUCCESS;
 }
 
-void ReduceScatterNHR::GetSliceMap(const u32 rankSize)
-{
-    std::vector<u32> tree;
-    for (u32 i = 0; i < rankSize; i++) {
-        tree.push_back(i);
-    }
-
-    // 其他的再进行计算
-    std::vector<u32> tmp(rankSize);
-    u32 nSteps = 0;
-    for (u32 tmp = rankSize - 1; tmp != 0; tmp >>= 1, nSteps++) {
-    }
-
-    u32 len = rankSize;
-
-    for (u32 step = 0; step < nSteps; step++) {
-        u32 nSlices = (rankSize - 1 + (1 << step)) / (1 << (step + 1));
-        if (nSlices <= 1) {
-            break;
-        }
-
-        bool endFlag = false;
-
-        for (u32 part = 0; part * len < rankSize; part++) {
-            u32 start = part * len;
-            u32 end = std::min(start + len, rankSize);
-            Reorder(start, end, len, tree, tmp);
-
-            if (((end - start) & 1) == 1) {
-                endFlag = true;
-            }
-        }
-
-        for (u32 i = 0; i < rankSize; i++) {
-            tree[i] = tmp[i];
-        }
-
-        if (endFlag) {
-            break;
-        }
-
-        len >>= 1;
-    }
-
-    // 因为取的是tree中rank的idx，所以直接返回反向的映射
-    sliceMap_.resize(rankSize);
-    for (u32 i = 0; i < rankSize; i++) {
-        sliceMap_[tree[i]] = i;
-    }
-
-    return;
-}
-
-void ReduceScatterNHR::Reorder(u32 start, u32 end, u32 len, std::vector<u32> &tree, std::vector<u32> &tmp)
-{
-    const u32 idxTwo = 2;
-
-    for (u32 i = start; i < end; i++) {
-        u32 offset = i - start;
-        if ((offset & 1) == 0) {
-            tmp[start + offset / idxTwo] = tree[i];
-        } else {
-            tmp[start + (offset + len) / idxTwo] = tree[i];
-        }
-    }
-}
-
 HcclResult ReduceScatterNHR::SimpleCheck(const u32 rank, const u32 rankSize, const std::vector<LINK> &links)
 {
     // 判断stream, dispatcher是否为空
@@ -225,7 +158,7 @@ HcclResult ReduceScatterNHR::InlineReduceRx(const LINK &linkLeft, std::vector<Sl
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::InlineReduceRxLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+HcclResult ReduceScatterNHR::InlineReduceRxLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
     const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     std::vector<ReducerMemoryInfo> rxReduceMems;
@@ -272,7 +205,7 @@ HcclResult ReduceScatterNHR::TbeReduceRx(const LINK &linkLeft, std::vector<Slice
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::TbeReduceRxLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+HcclResult ReduceScatterNHR::TbeReduceRxLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
     const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     void *srcMemPtr = nullptr;
@@ -302,7 +235,7 @@ HcclResult ReduceScatterNHR::TbeReduceRxLastStep(const LINK &linkLeft, InterServ
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::RunDestReducerLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+HcclResult ReduceScatterNHR::RunDestReducerLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
     const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     HcclResult ret = HCCL_SUCCESS;
@@ -325,29 +258,19 @@ HcclResult ReduceScatterNHR::RunDestReducerLastStep(const LINK &linkLeft, InterS
 }
 
  HcclResult ReduceScatterNHR::GetRxSlices(std::vector<Slice> &rxSlices, std::vector<Slice> &rxSlicestemp,
-    InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
+    const InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices,
+    const std::vector<Slice> &outputSlices)
 {
-    for (u32 i = 0; i < stepInfo.nSlices; i++) {
-        rxSlices.push_back(inputSlices[stepInfo.rxSliceIdxs[i]]);
-        rxSlicestemp.push_back(outputSlices[stepInfo.rxSliceIdxs[i]]);
-        HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] i[%u] rxSliceIndex[%u] rx offset[%llu] size[%llu]",
-            i, stepInfo.rxSliceIdxs[i], outputSlices[stepInfo.rxSliceIdxs[i]].offset,
-            outputSlices[stepInfo.rxSliceIdxs[i]].size);
-    }
-
-    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] rxslices size [%u], rxslices temp size [%u]",
-        rxSlices.size(), rxSlicestemp.size());
-
     // 合并连续slices
-    MergeSlices(rxSlices);
-    MergeSlices(rxSlicestemp);
-    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] merged rxslices size [%u], merged rxslices temp size [%u]",
-        rxSlices.size(), rxSlicestemp.size());
+    CollectSlices(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, inputSlices, isInputContiguous_, rxSlices);
+    CollectSlices(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, outputSlices, isOutputContiguous_, rxSlicestemp);
+    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] nSlices[%u] merged rxslices size [%u], merged rxslices temp size "
+        "[%u]", stepInfo.nSlices, rxSlices.size(), rxSlicestemp.size());
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::SdmaReducer(const u32 nSteps, const LINK &linkLeft, InterServerAlgoStep &stepInfo,
-    const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
+HcclResult ReduceScatterNHR::SdmaReducer(const u32 nSteps, const LINK &linkLeft,
+    const InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     HcclResult ret = HCCL_SUCCESS;
     std::vector<Slice> rxSlices;
@@ -388,10 +311,17 @@ HcclResult ReduceScatterNHR::RunReduceScatterNHR(const u32 rank, const u32 rankS
     // 计算通信步数
     u32 nSteps = GetStepNumInterServer(rankSize);
 
+    // 步骤描述只与rank拓扑相关, 从缓存获取, 此处只需按本次的slice大小换算
+    std::shared_ptr<const NHRStepSchedule> schedule;
+    CHK_RET(GetStepSchedule(rank, rankSize, schedule));
+    CHK_PRT_RET(schedule->size() != nSteps, HCCL_ERROR("[ReduceScatterNHR][RunReduceScatterNHR] rank[%u] "
+        "schedule size[%llu] is not equal to nSteps[%u]", rank, schedule->size(), nSteps), HCCL_E_INTERNAL);
+    isInputContiguous_ = IsSliceContiguous(inputSlices);
+    isOutputContiguous_ = IsSliceContiguous(outputSlices);
+
     // 逐步编排任务
     for (u32 step = 0; step < nSteps; step++) {
-        InterServerAlgoStep stepInfo;
-        GetStepInfo(step, nSteps, rank, rankSize, stepInfo);
+        const InterServerAlgoStep &stepInfo = (*schedule)[step];
 
         // 链的关系没有变化，区别的是发送的slice编号，因为重排tree不影响每棵树节点间的连接关系
         LINK linkLeft = links[stepInfo.fromRank];
@@ -435,27 +365,17 @@ HcclResult ReduceScatterNHR::RunReduceScatterNHR(const u32 rank, const u32 rankS
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::RunSourceSender(const LINK &link, InterServerAlgoStep &stepInfo,
+HcclResult ReduceScatterNHR::RunSourceSender(const LINK &link, const InterServerAlgoStep &stepInfo,
     const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     std::vector<Slice> txSlices;
     std::vector<Slice> txSlicestemp;
-    for (u32 i = 0; i < stepInfo.nSlices; i++) {
-        txSlices.push_back(inputSlices[stepInfo.txSliceIdxs[i]]);
-        txSlicestemp.push_back(outputSlices[stepInfo.txSliceIdxs[i]]);
-        HCCL_DEBUG("[ReduceScatterNHR][RunSourceSender] i[%u] txSliceIndex[%u] tx data offset[%llu] size[%llu]",
-            i, stepInfo.txSliceIdxs[i], outputSlices[stepInfo.txSliceIdxs[i]].offset,
-            outputSlices[stepInfo.txSliceIdxs[i]].size);
-    }
-    HCCL_DEBUG("[ReduceScatterNHR][RunSourceSender] txSlices size [%u], txSlices temp size [%u]",
-        txSlices.size(), txSlicestemp.size());
-        
     // 合并连续slices
-    MergeSlices(txSlices);
-    MergeSlices(txSlicestemp);
-    HCCL_DEBUG("[ReduceScatterNHR][RunSourceSender] merged txSlices size [%u], merged txSlices temp size [%u]",
-        txSlices.size(), txSlicestemp.size());
-    
+    CollectSlices(stepInfo.txSliceIdxs, stepInfo.txSliceRanges, inputSlices, isInputContiguous_, txSlices);
+    CollectSlices(stepInfo.txSliceIdxs, stepInfo.txSliceRanges, outputSlices, isOutputContiguous_, txSlicestemp);
+    HCCL_DEBUG("[ReduceScatterNHR][RunSourceSender] nSlices[%u] merged txSlices size [%u], merged txSlices temp "
+        "size [%u]", stepInfo.nSlices, txSlices.size(), txSlicestemp.size());
+
     std::vector<SenderMemoryInfo> txMems;
     for (u64 i = 0; i < txSlices.size(); i++) {
         DeviceMem srcMem = inputMem_.range(txSlices[i].offset, txSlices[i].size);
@@ -468,27 +388,16 @@ HcclResult ReduceScatterNHR::RunSourceSender(const LINK &link, InterServerAlgoSt
     return HCCL_SUCCESS;
 }
 
-HcclResult ReduceScatterNHR::RunDestReducer(const LINK &link, InterServerAlgoStep &stepInfo,
+HcclResult ReduceScatterNHR::RunDestReducer(const LINK &link, const InterServerAlgoStep &stepInfo,
     const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices)
 {
     std::vector<Slice> rxSlices;
     std::vector<Slice> rxSlicestemp;
-    for (u32 i = 0; i < stepInfo.nSlices; i++) {
-        rxSlices.push_back(inputSlices[stepInfo.rxSliceIdxs[i]]);
-        rxSlicestemp.push_back(outputSlices[stepInfo.rxSliceIdxs[i]]);
-        HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] i[%u] rxSliceIndex[%u] rx offset[%llu] size[%llu]",
-            i, stepInfo.rxSliceIdxs[i], outputSlices[stepInfo.rxSliceIdxs[i]].offset,
-            outputSlices[stepInfo.rxSliceIdxs[i]].size);
-    }
-
-    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] rxslices size [%u], rxslices temp size [%u]",
-        rxSlices.size(), rxSlicestemp.size());
-
     // 合并连续slices
-    MergeSlices(rxSlices);
-    MergeSlices(rxSlicestemp);
-    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] merged rxslices size [%u], merged rxslices temp size [%u]",
-        rxSlices.size(), rxSlicestemp.size());
+    CollectSlices(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, inputSlices, isInputContiguous_, rxSlices);
+    CollectSlices(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, outputSlices, isOutputContiguous_, rxSlicestemp);
+    HCCL_DEBUG("[ReduceScatterNHR][RunDestReducer] nSlices[%u] merged rxslices size [%u], merged rxslices temp size "
+        "[%u]", stepInfo.nSlices, rxSlices.size(), rxSlicestemp.size());
 
     std::vector<ReducerMemoryInfo> rxReduceMems;
     for (u64 i = 0; i < rxSlices.size(); i++) {
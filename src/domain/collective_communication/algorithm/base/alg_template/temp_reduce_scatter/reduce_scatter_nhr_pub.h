@@ -40,10 +40,10 @@ private:
 
     HcclResult RunReduceScatterNHR(const u32 rank, const u32 rankSize, const std::vector<LINK> &links,
         const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
-    HcclResult RunSourceSender(const LINK &link, InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices,
-        const std::vector<Slice> &outputSlices);
-    HcclResult RunDestReducer(const LINK &link, InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices,
-        const std::vector<Slice> &outputSlices);
+    HcclResult RunSourceSender(const LINK &link, const InterServerAlgoStep &stepInfo,
+        const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
+    HcclResult RunDestReducer(const LINK &link, const InterServerAlgoStep &stepInfo,
+        const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
 
     HcclResult GetStepInfo(u32 step, u32 nSteps, u32 rank, u32 rankSize, InterServerAlgoStep &stepInfo) override;
 
@@ -51,31 +51,31 @@ private:
 
     HcclResult InlineReduceRx(const LINK &linkLeft, std::vector<Slice> &rxSlices, std::vector<Slice> &rxSlicestemp);
 
-    HcclResult InlineReduceRxLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+    HcclResult InlineReduceRxLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
         const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
 
     HcclResult TbeReduceRx(const LINK &linkLeft, std::vector<Slice> &rxSlices, std::vector<Slice> &rxSlicestemp);
 
-    HcclResult TbeReduceRxLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+    HcclResult TbeReduceRxLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
         const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
 
-    HcclResult RunDestReducerLastStep(const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+    HcclResult RunDestReducerLastStep(const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
         const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
 
     HcclResult GetRxSlices(std::vector<Slice> &rxSlices, std::vector<Slice> &rxSlicestemp,
-        InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
+        const InterServerAlgoStep &stepInfo, const std::vector<Slice> &inputSlices,
+        const std::vector<Slice> &outputSlices);
 
-    HcclResult SdmaReducer(const u32 nSteps, const LINK &linkLeft, InterServerAlgoStep &stepInfo,
+    HcclResult SdmaReducer(const u32 nSteps, const LINK &linkLeft, const InterServerAlgoStep &stepInfo,
         const std::vector<Slice> &inputSlices, const std::vector<Slice> &outputSlices);
 
-    void GetSliceMap(const u32 rankSize);
-
-    static void Reorder(u32 start, u32 end, u32 len, std::vector<u32> &tree, std::vector<u32> &tmp);
-
     u64 reduceAttr_ = 0; /* 0x1:表示data_type + reduce_type支持inlinereduce  */
 
     std::unique_ptr<Sender> senderInfo_;
     std::unique_ptr<Reducer> reducerInfo_;
+
+    bool isInputContiguous_ = false;  /* 本次下发的inputSlices是否按编号首尾相接 */
+    bool isOutputContiguous_ = false; /* 本次下发的outputSlices是否按编号首尾相接 */
 };
 } // hccl
 
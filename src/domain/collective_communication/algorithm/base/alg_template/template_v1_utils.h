@@ -85,6 +85,35 @@ bool ShouldUseBinaryBroadcastOfNB(const u64 dataSize, const u32 rankSize, const
 
 // all_reduce_nb_pub.h
 const u64 GetSliceSizeOfNB(const u64 dataSize, const u32 rankSize);
+
+// all_reduce_dbt_pub.h
+constexpr u32 DBT_INVALID_RANK = 0xFFFFFFFF;
+constexpr u32 DBT_TREE_NUM = 2;
+struct DBTreeNode {
+    u32 parent = DBT_INVALID_RANK;  // 树根无父节点
+    std::vector<u32> children;      // 最多两个子节点
+};
+void GetDoubleBinaryTree(const u32 rank, const u32 rankSize, DBTreeNode &tree0, DBTreeNode &tree1);
+u32 GetDepthOfDBT(const u32 rankSize);
+u32 GetChunkNumOfDBT(const u64 dataSize);
+
+// broadcast_chain_pub.h
+constexpr u32 KNOMIAL_TREE_RADIX = 4;   // k叉树的基数
+struct PipelineTreeNode {
+    u32 parent = INVALID_VALUE_RANKID;  // 树根无父节点
+    std::vector<u32> children;          // 按发送顺序排列, 子树大的在前
+};
+constexpr float LINK_STATIC_LATENCY_US = 60;   // 链路端到端静态时延, 算法代价模型的默认alpha
+struct PipelinePlan {
+    bool useKnomialTree = false;
+    u32 segmentNum = 1;
+    double costUs = 0.0;                // 按alpha-beta模型估算的耗时
+};
+void GetChainTreeNode(const u32 rank, const u32 rankSize, const u32 root, PipelineTreeNode &node);
+void GetKnomialTreeNode(const u32 rank, const u32 rankSize, const u32 root, const u32 radix, PipelineTreeNode &node);
+HcclResult CalcPipelinePlan(const u64 dataSize, const u32 rankSize, const u32 userRankSize,
+    const u32 devNumPerAggregation, const float delay, PipelinePlan &plan);
+void GetPipelineSegments(const u64 count, const u32 unitSize, const u32 segmentNum, std::vector<Slice> &segments);
 }  // namespace hccl
 
 #endif /* HCCL_TEMPLATE_UTILS_H */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include "calc_chain_transport_req.h"
+#include "template_v1_utils.h"
+
+namespace hccl {
+CalcChainTransportReq::CalcChainTransportReq(std::vector<std::vector<u32>> &subCommPlaneVector,
+    std::vector<bool> &isBridgeVector, u32 userRank)
+    : CalcTransportReqBase(subCommPlaneVector, isBridgeVector, userRank)
+{
+}
+
+CalcChainTransportReq::~CalcChainTransportReq()
+{
+}
+
+HcclResult CalcChainTransportReq::CalcTransportRequest(const std::string &tag, TransportMemType inputMemType,
+    TransportMemType outputMemType, const CommParaInfo &commParaInfo,
+    std::vector<SingleSubCommTransport> &commTransport, u32 subUserRankRoot)
+{
+    u32 ringSize = subCommPlaneVector_.size();
+    commTransport.resize(ringSize);
+
+    for (u32 ringIndex = 0; ringIndex < ringSize; ringIndex++) {
+        if (commParaInfo.commPlane == COMM_LEVEL1 && !isBridgeVector_[ringIndex]) {
+            continue; // 跳出本次循环
+        }
+
+        u32 rank = GetSubCollectiveRank(subCommPlaneVector_[ringIndex]);
+        if (rank == INVALID_VALUE_RANKID) {
+            continue;
+        }
+
+        u32 rankSize = subCommPlaneVector_[ringIndex].size();
+        SingleSubCommTransport &subCommTransport = commTransport[ringIndex];
+        subCommTransport.transportRequests.resize(rankSize);
+        // 只有一张卡时不需要建链
+        if (rankSize == HCCL_RANK_SIZE_EQ_ONE) {
+            HCCL_INFO("comm base needn't to create links, rankSize_[%u].", rankSize);
+            return HCCL_SUCCESS;
+        }
+
+        // 本平面内的root序号, 平面内不含root时按root未知处理
+        u32 root = INVALID_VALUE_RANKID;
+        auto rootIter = std::find(subCommPlaneVector_[ringIndex].begin(), subCommPlaneVector_[ringIndex].end(),
+            subUserRankRoot);
+        if (rootIter != subCommPlaneVector_[ringIndex].end()) {
+            root = static_cast<u32>(rootIter - subCommPlaneVector_[ringIndex].begin());
+        }
+
+        std::set<u32> dstRanks;
+        CHK_RET(CalcDstRanks(rank, rankSize, root, dstRanks));
+        for (u32 targetRankPos : dstRanks) {
+            TransportRequest &tmpTransport = subCommTransport.transportRequests[targetRankPos];
+            tmpTransport.isValid = true;
+            tmpTransport.localUserRank  = userRank_;
+            tmpTransport.remoteUserRank = subCommPlaneVector_[ringIndex][targetRankPos];
+            tmpTransport.inputMemType = inputMemType;
+            tmpTransport.outputMemType = outputMemType;
+            HCCL_INFO("[CommFactory][CalcChainCommInfo] param_.tag[%s] ringIndex[%u], localRank[%u], \
+                remoteRank[%u], inputMemType[%d], outputMemType[%d]", tag.c_str(), ringIndex, userRank_,
+                tmpTransport.remoteUserRank, inputMemType, outputMemType);
+        }
+        subCommTransport.enableUseOneDoorbell = true;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CalcChainTransportReq::CalcDstRanks(const u32 rank, const u32 rankSize, const u32 root,
+    std::set<u32> &dstRanks)
+{
+    if (root < rankSize) {
+        // 执行时按数据量在流水链和k叉树之间选择, 两棵树的父子节点都需要建链
+        PipelineTreeNode nodes[2];
+        GetChainTreeNode(rank, rankSize, root, nodes[0]);
+        GetKnomialTreeNode(rank, rankSize, root, KNOMIAL_TREE_RADIX, nodes[1]);
+        for (const PipelineTreeNode &node : nodes) {
+            if (node.parent != INVALID_VALUE_RANKID) {
+                dstRanks.insert(node.parent);
+            }
+            dstRanks.insert(node.children.begin(), node.children.end());
+        }
+        return HCCL_SUCCESS;
+    }
+
+    for (u64 level = 1; level < rankSize; level *= KNOMIAL_TREE_RADIX) {
+        for (u64 digit = 1; digit < KNOMIAL_TREE_RADIX && digit * level < rankSize; digit++) {
+            u32 distance = static_cast<u32>(digit * level);
+            dstRanks.insert((rank + distance) % rankSize);
+            dstRanks.insert((rank + rankSize - distance) % rankSize);
+        }
+    }
+    dstRanks.erase(rank);
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CALC_CHAIN_TRANSPORT_REQ_H
+#define CALC_CHAIN_TRANSPORT_REQ_H
+
+#include "calc_transport_req_base.h"
+
+namespace hccl {
+// 已知root时只与流水链和k叉树上的父节点、子节点建链; root未知时退化为任意root下会用到的对端,
+// 即距离为j * k^i (0 < j < k)的rank
+class CalcChainTransportReq : public CalcTransportReqBase {
+public:
+    explicit CalcChainTransportReq(std::vector<std::vector<u32>> &subCommPlaneVector,
+        std::vector<bool> &isBridgeVector, u32 userRank);
+
+    ~CalcChainTransportReq() override;
+
+    HcclResult CalcTransportRequest(const std::string &tag, TransportMemType inputMemType,
+        TransportMemType outputMemType, const CommParaInfo &commParaInfo,
+        std::vector<SingleSubCommTransport> &commTransport, u32 subUserRankRoot = INVALID_VALUE_RANKID) override;
+
+    static HcclResult CalcDstRanks(const u32 rank, const u32 rankSize, const u32 root, std::set<u32> &dstRanks);
+};
+}  // namespace hccl
+#endif /* CALC_CHAIN_TRANSPORT_REQ_H */
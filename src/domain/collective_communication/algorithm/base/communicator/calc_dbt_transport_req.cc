@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "calc_dbt_transport_req.h"
+#include "template_v1_utils.h"
+
+namespace hccl {
+CalcDBTTransportReq::CalcDBTTransportReq(std::vector<std::vector<u32>> &subCommPlaneVector,
+    std::vector<bool> &isBridgeVector, u32 userRank)
+    : CalcTransportReqBase(subCommPlaneVector, isBridgeVector, userRank)
+{
+}
+
+CalcDBTTransportReq::~CalcDBTTransportReq()
+{
+}
+
+HcclResult CalcDBTTransportReq::CalcTransportRequest(const std::string &tag, TransportMemType inputMemType,
+    TransportMemType outputMemType, const CommParaInfo &commParaInfo,
+    std::vector<SingleSubCommTransport> &commTransport, u32 subUserRankRoot)
+{
+    (void)subUserRankRoot;
+    u32 ringSize = subCommPlaneVector_.size();
+    commTransport.resize(ringSize);
+
+    for (u32 ringIndex = 0; ringIndex < ringSize; ringIndex++) {
+        if ((commParaInfo.commPlane == COMM_LEVEL1 || commParaInfo.commPlane == COMM_LEVEL1_DBT_TREE) &&
+            !isBridgeVector_[ringIndex]) {
+            continue; // 跳出本次循环
+        }
+
+        u32 rank = GetSubCollectiveRank(subCommPlaneVector_[ringIndex]);
+        if (rank == INVALID_VALUE_RANKID) {
+            continue;
+        }
+
+        u32 rankSize = subCommPlaneVector_[ringIndex].size();
+        SingleSubCommTransport &subCommTransport = commTransport[ringIndex];
+        subCommTransport.transportRequests.resize(rankSize);
+        // 只有一张卡时不需要建链
+        if (rankSize == HCCL_RANK_SIZE_EQ_ONE) {
+            HCCL_INFO("comm base needn't to create links, rankSize_[%u].", rankSize);
+            return HCCL_SUCCESS;
+        }
+
+        std::set<u32> dstRanks;
+        CHK_RET(CalcDstRanks(rank, rankSize, commParaInfo.commPlane, dstRanks));
+        for (u32 targetRankPos : dstRanks) {
+            TransportRequest &tmpTransport = subCommTransport.transportRequests[targetRankPos];
+            tmpTransport.isValid = true;
+            tmpTransport.localUserRank  = userRank_;
+            tmpTransport.remoteUserRank = subCommPlaneVector_[ringIndex][targetRankPos];
+            tmpTransport.inputMemType = inputMemType;
+            tmpTransport.outputMemType = outputMemType;
+            HCCL_INFO("[CommFactory][CalcDBTCommInfo] param_.tag[%s] ringIndex[%u], localRank[%u], \
+                remoteRank[%u], inputMemType[%d], outputMemType[%d]", tag.c_str(), ringIndex, userRank_,
+                tmpTransport.remoteUserRank, inputMemType, outputMemType);
+        }
+        subCommTransport.enableUseOneDoorbell = true;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CalcDBTTransportReq::CalcDstRanks(const u32 rank, const u32 rankSize, const CommPlane commPlane,
+    std::set<u32> &dstRanks)
+{
+    DBTreeNode trees[DBT_TREE_NUM];
+    GetDoubleBinaryTree(rank, rankSize, trees[0], trees[1]);
+    for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+        if ((commPlane == COMM_LEVEL1 && treeIdx != 0) || (commPlane == COMM_LEVEL1_DBT_TREE && treeIdx != 1)) {
+            continue;
+        }
+        const DBTreeNode &node = trees[treeIdx];
+        if (node.parent != DBT_INVALID_RANK) {
+            dstRanks.insert(node.parent);
+        }
+        dstRanks.insert(node.children.begin(), node.children.end());
+    }
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
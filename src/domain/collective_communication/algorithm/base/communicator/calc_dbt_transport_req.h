@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CALC_DBT_TRANSPORT_REQ_H
+#define CALC_DBT_TRANSPORT_REQ_H
+
+#include "calc_transport_req_base.h"
+
+namespace hccl {
+// 双二叉树只需与树上的父节点和子节点建链: COMM_LEVEL1只建第一棵树, COMM_LEVEL1_DBT_TREE只建第二棵树,
+// 两棵树的link相互独立以便并行执行; 其他平面建两棵树的并集, 每个rank最多6条
+class CalcDBTTransportReq : public CalcTransportReqBase {
+public:
+    explicit CalcDBTTransportReq(std::vector<std::vector<u32>> &subCommPlaneVector,
+        std::vector<bool> &isBridgeVector, u32 userRank);
+
+    ~CalcDBTTransportReq() override;
+
+    HcclResult CalcTransportRequest(const std::string &tag, TransportMemType inputMemType,
+        TransportMemType outputMemType, const CommParaInfo &commParaInfo,
+        std::vector<SingleSubCommTransport> &commTransport, u32 subUserRankRoot = INVALID_VALUE_RANKID) override;
+
+    static HcclResult CalcDstRanks(const u32 rank, const u32 rankSize, const CommPlane commPlane,
+        std::set<u32> &dstRanks);
+};
+}  // namespace hccl
+#endif /* CALC_DBT_TRANSPORT_REQ_H */
@@ -28,6 +28,7 @@ enum CommPlane {
     COMM_COMBINE_ORDER, // 打平通信域，按rank排序
     COMM_LEVEL0_ANYPATH_SDMA,  // anypath特性使用
     COMM_LEVEL1_ANYPATH_SDMA, // anypath特性使用
+    COMM_LEVEL1_DBT_TREE, // 双二叉树第二棵树独立建链使用, 与COMM_LEVEL1同构
     COMM_LEVEL_RESERVED,
 };
 
@@ -51,6 +52,8 @@ enum class CommType {
     COMM_TAG_P2P,
     COMM_TAG_PARTIAL_MESH_COMBINED,
     COMM_TAG_HCCS_PLUS_SIO,
+    COMM_TAG_DOUBLE_BINARY_TREE,
+    COMM_TAG_CHAIN_KNOMIAL,
     COMM_TAG_MAX,
     COMM_TAG_384
 };
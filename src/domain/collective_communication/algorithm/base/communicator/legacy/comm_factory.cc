@@ -14,7 +14,6 @@
 #include "p2p_mgmt_pub.h"
 #include "adapter_pub.h"
 #include "device_capacity.h"
-#include "search_path.h"
 #include "calc_p2p_transport_req.h"
 #include "mmpa_api.h"
 namespace hccl {
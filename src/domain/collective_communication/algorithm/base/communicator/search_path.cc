@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "search_path.h"
+#include <algorithm>
+#include <mutex>
+#include "log.h"
+
+namespace hccl {
+namespace {
+// 链路相对带宽档位: 无链路信息的nic对取最低档, PXI经PCIe转发, HCCS/HCCS_SW/SIO为片间直连
+constexpr u32 SIO_LINK_DEFAULT_BW = 1;
+constexpr u32 LINK_BW_PXI = 2;
+constexpr u32 LINK_BW_DIRECT = 4;
+// 记忆化状态以(已访问集合 << 6 | 当前节点)编码, nic数超过该值时不做记忆化
+constexpr u32 MEMO_MAX_NIC_NUM = 58;
+constexpr u32 MEMO_NODE_BITS = 6;
+// 搜索预算按扩展次数而非墙钟时间计算, 保证各rank在相同输入下得到相同结果
+constexpr u64 SEARCH_STEP_BUDGET = 2000000;
+// 进程级环缓存的最大条目数, 超出后按插入顺序淘汰
+constexpr u32 RING_CACHE_MAX_NUM = 64;
+
+// 适配910_93设备双轨组网，可通过SIO串联
+const std::map<u32, std::vector<u32>> SIO_REACHABLE_RANK = {
+    {0, {1, 2, 4, 6, 8, 10, 12, 14}},
+    {1, {0, 3, 5, 7, 9, 11, 13, 15}},
+    {2, {3, 4, 6, 8, 10, 12, 14, 0}},
+    {3, {2, 5, 7, 9, 11, 13, 15, 1}},
+    {4, {5, 6, 8, 10, 12, 14, 0, 2}},
+    {5, {4, 7, 9, 11, 13, 15, 1, 3}},
+    {6, {7, 8, 10, 12, 14, 0, 2, 4}},
+    {7, {6, 9, 11, 13, 15, 1, 3, 5}},
+    {8, {9, 10, 12, 14, 0, 2, 4, 6}},
+    {9, {8, 11, 13, 15, 1, 3, 5, 7}},
+    {10, {11, 12, 14, 0, 2, 4, 6, 8}},
+    {11, {10, 13, 15, 1, 3, 5, 7, 9}},
+    {12, {13, 14, 0, 2, 4, 6, 8, 10}},
+    {13, {12, 15, 1, 3, 5, 7, 9, 11}},
+    {14, {15, 0, 2, 4, 6, 8, 10, 12}},
+    {15, {14, 1, 3, 5, 7, 9, 11, 13}}};
+
+std::mutex g_ringCacheMutex;
+}
+
+const NicAdjacency &GetSioReachableAdjacency()
+{
+    static const NicAdjacency sioAdjacency = []() {
+        NicAdjacency adjacency;
+        for (const auto &reachable : SIO_REACHABLE_RANK) {
+            auto &neighbors = adjacency[reachable.first];
+            for (u32 peer : reachable.second) {
+                neighbors.emplace_back(peer, SIO_LINK_DEFAULT_BW);
+            }
+        }
+        return adjacency;
+    }();
+    return sioAdjacency;
+}
+
+u32 GetLinkTypeBandwidth(LinkTypeInServer linkType)
+{
+    switch (linkType) {
+        case LinkTypeInServer::HCCS_TYPE:
+        case LinkTypeInServer::HCCS_SW_TYPE:
+        case LinkTypeInServer::SIO_TYPE:
+            return LINK_BW_DIRECT;
+        case LinkTypeInServer::PXI_TYPE:
+            return LINK_BW_PXI;
+        default:
+            return SIO_LINK_DEFAULT_BW;
+    }
+}
+
+NicAdjacency BuildRohAdjacency(const PairLinkInfo &pairLinkInfo)
+{
+    // (本端, 对端) -> 带宽, 同一nic对上报多种链路类型时取最高档
+    std::map<std::pair<u32, u32>, u32> pairBw;
+    for (const auto &typeIter : pairLinkInfo) {
+        u32 bw = GetLinkTypeBandwidth(static_cast<LinkTypeInServer>(typeIter.first));
+        for (const auto &localIter : typeIter.second) {
+            for (s32 peer : localIter.second) {
+                u32 &curBw = pairBw[std::make_pair(static_cast<u32>(localIter.first), static_cast<u32>(peer))];
+                curBw = std::max(curBw, bw);
+            }
+        }
+    }
+
+    NicAdjacency adjacency = GetSioReachableAdjacency();
+    for (auto &node : adjacency) {
+        for (auto &edge : node.second) {
+            auto bwIter = pairBw.find(std::make_pair(node.first, edge.first));
+            if (bwIter != pairBw.end()) {
+                edge.second = bwIter->second;
+            }
+        }
+    }
+    return adjacency;
+}
+
+bool SearchRohRing(const std::vector<u32> &nicList, std::vector<u32> &topoList, const NicAdjacency &adjacency)
+{
+    std::vector<u32> tmpNicList(nicList);
+    std::sort(tmpNicList.begin(), tmpNicList.end());
+    if (tmpNicList.size() < 2) { // 少于2个nic无需搜索, 直接按原顺序成环
+        topoList = tmpNicList;
+        return !topoList.empty();
+    }
+
+    SearchPath searchPath(adjacency);
+    u32 bottleneckBw = 0;
+    std::vector<std::vector<u32>> rings = searchPath.SearchRings(tmpNicList, 1, bottleneckBw);
+    if (rings.empty()) {
+        topoList.clear();
+        return false;
+    }
+    topoList = rings[0];
+    return true;
+}
+
+SearchPath::SearchPath(const NicAdjacency &adjacency) : adjacency_(adjacency)
+{
+    adjacencyHash_ = CalcAdjacencyHash();
+}
+
+u64 SearchPath::CalcAdjacencyHash() const
+{
+    // FNV-1a
+    constexpr u64 fnvOffset = 0xcbf29ce484222325ULL;
+    constexpr u64 fnvPrime = 0x100000001b3ULL;
+    u64 hash = fnvOffset;
+    auto mix = [&hash](u64 value) {
+        hash ^= value;
+        hash *= fnvPrime;
+    };
+    for (const auto &node : adjacency_) {
+        mix(node.first);
+        mix(node.second.size());
+        for (const auto &edge : node.second) {
+            mix(edge.first);
+            mix(edge.second);
+        }
+    }
+    return hash;
+}
+
+std::vector<std::vector<u32>> SearchPath::SearchRings(const std::vector<u32> &nicList, u32 ringNum,
+    u32 &bottleneckBw)
+{
+    bottleneckBw = 0;
+    if (nicList.size() < 2 || ringNum == 0) { // 少于2个nic无需成环
+        return {};
+    }
+
+    static std::map<RingCacheKey, RingCacheValue> ringCache;
+    static std::deque<RingCacheKey> ringCacheOrder;
+    RingCacheKey cacheKey(adjacencyHash_, ringNum, nicList);
+    {
+        std::lock_guard<std::mutex> lock(g_ringCacheMutex);
+        auto cacheIter = ringCache.find(cacheKey);
+        if (cacheIter != ringCache.end()) {
+            bottleneckBw = cacheIter->second.bottleneckBw;
+            return cacheIter->second.rings;
+        }
+    }
+
+    BuildLocalGraph(nicList);
+    u32 nicNum = nicList.size();
+
+    // 从高到低尝试带宽门限, 第一个能找到ringNum个环的门限即为最大瓶颈带宽
+    std::set<u32, std::greater<u32>> bwThresholds;
+    for (const auto &neighbors : localNeighbors_) {
+        for (const auto &edge : neighbors) {
+            bwThresholds.insert(edge.second);
+        }
+    }
+
+    RingCacheValue result{{}, 0};
+    searchSteps_ = 0;
+    budgetExhausted_ = false;
+    for (u32 minBw : bwThresholds) {
+        std::vector<std::vector<u32>> localRings;
+        if (SearchRingsWithThreshold(nicNum, ringNum, minBw, localRings)) {
+            for (const auto &localRing : localRings) {
+                std::vector<u32> ring;
+                ring.reserve(localRing.size());
+                for (u32 localIdx : localRing) {
+                    ring.push_back(nicList[localIdx]);
+                }
+                result.rings.push_back(ring);
+            }
+            result.bottleneckBw = minBw;
+            break;
+        }
+        if (budgetExhausted_) {
+            HCCL_WARNING("[SearchPath][SearchRings]search budget exhausted, nicNum[%u] ringNum[%u] minBw[%u]",
+                nicNum, ringNum, minBw);
+            break;
+        }
+    }
+    HCCL_DEBUG("[SearchPath][SearchRings]nicNum[%u] ringNum[%u] found[%zu] bottleneckBw[%u] steps[%llu]",
+        nicNum, ringNum, result.rings.size(), result.bottleneckBw, searchSteps_);
+
+    bottleneckBw = result.bottleneckBw;
+    // 预算耗尽时的结果不是确定的无解, 不缓存, 避免后续调用直接命中失败结果
+    if (budgetExhausted_ && result.rings.empty()) {
+        return result.rings;
+    }
+    std::lock_guard<std::mutex> lock(g_ringCacheMutex);
+    if (ringCache.emplace(cacheKey, result).second) {
+        ringCacheOrder.push_back(cacheKey);
+        if (ringCacheOrder.size() > RING_CACHE_MAX_NUM) {
+            ringCache.erase(ringCacheOrder.front());
+            ringCacheOrder.pop_front();
+        }
+    }
+    return result.rings;
+}
+
+void SearchPath::BuildLocalGraph(const std::vector<u32> &nicList)
+{
+    std::map<u32, u32> nicToLocal;
+    for (u32 i = 0; i < nicList.size(); i++) {
+        nicToLocal.emplace(nicList[i], i);
+    }
+
+    localNeighbors_.assign(nicList.size(), {});
+    for (u32 i = 0; i < nicList.size(); i++) {
+        auto adjIter = adjacency_.find(nicList[i]);
+        if (adjIter == adjacency_.end()) {
+            continue;
+        }
+        for (const auto &edge : adjIter->second) {
+            auto localIter = nicToLocal.find(edge.first);
+            if (localIter != nicToLocal.end() && localIter->second != i) {
+                localNeighbors_[i].emplace_back(localIter->second, edge.second);
+            }
+        }
+    }
+    usedEdges_.assign(nicList.size(), std::vector<bool>(nicList.size(), false));
+}
+
+bool SearchPath::SearchRingsWithThreshold(u32 nicNum, u32 ringNum, u32 minBw,
+    std::vector<std::vector<u32>> &rings)
+{
+    for (auto &row : usedEdges_) {
+        std::fill(row.begin(), row.end(), false);
+    }
+    ringStates_.assign(ringNum, RingSearchState());
+    rings.clear();
+    return SearchNextRing(nicNum, ringNum, minBw, rings);
+}
+
+void SearchPath::MarkRingEdges(const std::vector<u32> &ring, bool used)
+{
+    for (u32 i = 0; i < ring.size(); i++) {
+        u32 from = ring[i];
+        u32 to = ring[(i + 1) % ring.size()];
+        usedEdges_[from][to] = used;
+        usedEdges_[to][from] = used;
+    }
+}
+
+// 搜索第rings.size()个环, 已被前面环使用的链路不参与搜索
+bool SearchPath::SearchNextRing(u32 nicNum, u32 ringNum, u32 minBw, std::vector<std::vector<u32>> &rings)
+{
+    RingSearchState &state = ringStates_[rings.size()];
+    state.arrived.assign(nicNum, false);
+    state.path.clear();
+    state.failedStates.clear();
+    // 非最后一个环能否成功还取决于后续环, 失败结果与已用链路相关, 不能按(已访问集合, 当前节点)记忆化
+    state.useMemo = (nicNum <= MEMO_MAX_NIC_NUM) && (rings.size() + 1 == ringNum);
+    return Dfs(nicNum, ringNum, minBw, 0, 0, 0, rings);
+}
+
+// 当前环已闭合: 最后一个环直接成功; 否则占用其链路继续搜索后续环, 后续环失败则释放链路回溯当前环的其他走法
+bool SearchPath::CloseRing(u32 nicNum, u32 ringNum, u32 minBw, std::vector<std::vector<u32>> &rings)
+{
+    rings.push_back(ringStates_[rings.size()].path);
+    if (rings.size() == ringNum) {
+        return true;
+    }
+    MarkRingEdges(rings.back(), true);
+    if (SearchNextRing(nicNum, ringNum, minBw, rings)) {
+        return true;
+    }
+    MarkRingEdges(rings.back(), false);
+    rings.pop_back();
+    return false;
+}
+
+bool SearchPath::Dfs(u32 nicNum, u32 ringNum, u32 minBw, u32 depth, u32 node, u64 visitedMask,
+    std::vector<std::vector<u32>> &rings)
+{
+    if (++searchSteps_ > SEARCH_STEP_BUDGET) {
+        budgetExhausted_ = true;
+        return false;
+    }
+
+    RingSearchState &state = ringStates_[rings.size()];
+    // the last nic, it must reachable to path[0]
+    if (depth == nicNum - 1) {
+        for (const auto &edge : localNeighbors_[node]) {
+            if (edge.first == state.path[0] && edge.second >= minBw && !usedEdges_[node][edge.first]) {
+                state.path.push_back(node);
+                if (CloseRing(nicNum, ringNum, minBw, rings)) {
+                    return true;
+                }
+                state.path.pop_back();
+                break;
+            }
+        }
+        return false;
+    }
+
+    u64 curMask = state.useMemo ? (visitedMask | (1ULL << node)) : 0;
+    u64 stateKey = (curMask << MEMO_NODE_BITS) | node;
+    if (state.useMemo && state.failedStates.count(stateKey) != 0) {
+        return false;
+    }
+
+    state.arrived[node] = true;
+    state.path.push_back(node);
+
+    for (const auto &edge : localNeighbors_[node]) {
+        if (state.arrived[edge.first] || edge.second < minBw || usedEdges_[node][edge.first]) {
+            continue;
+        }
+        if (Dfs(nicNum, ringNum, minBw, depth + 1, edge.first, curMask, rings)) {
+            return true;
+        }
+        if (budgetExhausted_) {
+            break;
+        }
+    }
+
+    state.arrived[node] = false;
+    state.path.pop_back();
+    if (state.useMemo && !budgetExhausted_) {
+        state.failedStates.insert(stateKey);
+    }
+    return false;
+}
+}  // namespace hccl
@@ -8,79 +8,82 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#ifndef SEARCH_PATH_H
+#define SEARCH_PATH_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "base.h"
+#include "hccl_common.h"
+
+namespace hccl {
+// nic -> 有序的可达对端列表(对端nic, 链路带宽), 邻接顺序即搜索时的尝试顺序
+using NicAdjacency = std::map<u32, std::vector<std::pair<u32, u32>>>;
+
+// server内device间的链路类型: linkType -> 本端device -> 对端device列表, 与HcclTopoAttr::pairLinkInfo一致
+using PairLinkInfo = std::unordered_map<u32, std::unordered_map<int, std::vector<int>>>;
+
+// 910_93设备双轨组网(可通过SIO串联)的可达关系, 链路带宽均为默认值
+const NicAdjacency &GetSioReachableAdjacency();
+
+// 链路类型对应的相对带宽
+u32 GetLinkTypeBandwidth(LinkTypeInServer linkType);
+
+// 在910_93可达关系上按server内实际链路类型赋带宽; pairLinkInfo为空时与GetSioReachableAdjacency一致
+NicAdjacency BuildRohAdjacency(const PairLinkInfo &pairLinkInfo);
+
+// 适配ROH平面网段隔离, 在可达关系上搜索经过nicList中全部nic且瓶颈带宽最大的环, 失败返回false
+bool SearchRohRing(const std::vector<u32> &nicList, std::vector<u32> &topoList,
+    const NicAdjacency &adjacency = GetSioReachableAdjacency());
+
 class SearchPath {
 public:
-    std::vector<u32> Search(const std::vector<u32> &nicList)
-    {
-        if (nicList.size() == 0 || nicList.size() == 1) {
-            return nicList;
-        }
-
-        result_.clear();
-        std::vector<bool> arrived(nicList.size(), 0);
-        nicSet_.clear();
-        for (auto i : nicList) {
-            nicSet_.insert(i);
-        }
-
-        if (dfs(nicList, arrived, 0, nicList[0])) {
-            return result_;
-        } else {
-            return {};
-        }
-    }
+    // 使用拓扑提取得到的任意邻接图及链路带宽
+    explicit SearchPath(const NicAdjacency &adjacency);
+
+    // 搜索ringNum个互不共用链路的环, 并尽量最大化环上的瓶颈带宽; 失败返回空
+    std::vector<std::vector<u32>> SearchRings(const std::vector<u32> &nicList, u32 ringNum, u32 &bottleneckBw);
 
 private:
-    bool dfs(const std::vector<u32> &nicList, std::vector<bool> &arrived, u32 idx, u32 nowNicIdx)
-    {
-        // the last nic, it must reachable to result_[0]
-        if (idx == nicList.size() - 1) {
-            for (auto i : reachableRank_[nowNicIdx]) {
-                if (i == result_[0]) {
-                    result_.push_back(nowNicIdx);
-                    return true;
-                }
-            }
-
-            return false;
-        }
-
-        arrived[nowNicIdx] = true;
-        result_.push_back(nowNicIdx);
-
-        for (auto i : reachableRank_[nowNicIdx]) {
-            if (nicSet_.count(i) == 0 || arrived[i]) {
-                continue;
-            }
-
-            if (dfs(nicList, arrived, idx + 1, i)) {
-                return true;
-            }
-        }
-
-        arrived[nowNicIdx] = false;
-        result_.pop_back();
-        return false;
-    }
-
-    std::vector<u32> result_;
-    std::set<u32> nicSet_;
-    // 适配910_93设备双轨组网，可通过SIO串联
-    std::map<int, std::vector<u32>> reachableRank_ = {
-    {0, {1, 2, 4, 6, 8, 10, 12, 14}},
-    {1, {0, 3, 5, 7, 9, 11, 13, 15}},
-    {2, {3, 4, 6, 8, 10, 12, 14, 0}},
-    {3, {2, 5, 7, 9, 11, 13, 15, 1}},
-    {4, {5, 6, 8, 10, 12, 14, 0, 2}},
-    {5, {4, 7, 9, 11, 13, 15, 1, 3}},
-    {6, {7, 8, 10, 12, 14, 0, 2, 4}},
-    {7, {6, 9, 11, 13, 15, 1, 3, 5}},
-    {8, {9, 10, 12, 14, 0, 2, 4, 6}},
-    {9, {8, 11, 13, 15, 1, 3, 5, 7}},
-    {10, {11, 12, 14, 0, 2, 4, 6, 8}},
-    {11, {10, 13, 15, 1, 3, 5, 7, 9}},
-    {12, {13, 14, 0, 2, 4, 6, 8, 10}},
-    {13, {12, 15, 1, 3, 5, 7, 9, 11}},
-    {14, {15, 0, 2, 4, 6, 8, 10, 12}},
-    {15, {14, 1, 3, 5, 7, 9, 11, 13}}};
-};
\ No newline at end of file
+    using RingCacheKey = std::tuple<u64, u32, std::vector<u32>>;
+    struct RingCacheValue {
+        std::vector<std::vector<u32>> rings;
+        u32 bottleneckBw;
+    };
+
+    // 单个环的搜索状态, 每个环一份, 回溯前面的环时后面环的状态不受影响
+    struct RingSearchState {
+        std::vector<bool> arrived;
+        std::vector<u32> path;
+        std::unordered_set<u64> failedStates;  // 记忆化: (已访问集合, 当前节点)无法完成成环
+        bool useMemo = false;
+    };
+
+    void BuildLocalGraph(const std::vector<u32> &nicList);
+    bool SearchRingsWithThreshold(u32 nicNum, u32 ringNum, u32 minBw, std::vector<std::vector<u32>> &rings);
+    bool SearchNextRing(u32 nicNum, u32 ringNum, u32 minBw, std::vector<std::vector<u32>> &rings);
+    bool CloseRing(u32 nicNum, u32 ringNum, u32 minBw, std::vector<std::vector<u32>> &rings);
+    bool Dfs(u32 nicNum, u32 ringNum, u32 minBw, u32 depth, u32 node, u64 visitedMask,
+        std::vector<std::vector<u32>> &rings);
+    void MarkRingEdges(const std::vector<u32> &ring, bool used);
+    u64 CalcAdjacencyHash() const;
+
+    NicAdjacency adjacency_;
+    u64 adjacencyHash_ = 0;
+
+    // 单次搜索的工作数据, 下标为nic在nicList中的位置
+    std::vector<std::vector<std::pair<u32, u32>>> localNeighbors_;
+    std::vector<std::vector<bool>> usedEdges_;
+    std::vector<RingSearchState> ringStates_;
+    u64 searchSteps_ = 0;
+    bool budgetExhausted_ = false;
+};
+}  // namespace hccl
+
+#endif /* SEARCH_PATH_H */
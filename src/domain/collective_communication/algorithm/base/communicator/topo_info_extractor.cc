@@ -32,6 +32,7 @@ TopoInfoExtractor::TopoInfoExtractor(HcclAlgoAttr &algoAttr, HcclTopoAttr &topoA
       multiSuperPodDiffServerNumMode_(topoAttr.multiSuperPodDiffServerNumMode),
       isDiffDeviceType_(topoAttr.isDiffDeviceType),
       gcdDeviceNumPerAggregation_(topoAttr.gcdDeviceNumPerAggregation),
+      rohAdjacency_(BuildRohAdjacency(topoAttr.pairLinkInfo)),
       CommPlaneSubGroupVector_(COMM_LEVEL_RESERVED),
       CommPlaneVector_(COMM_LEVEL_RESERVED)
 { };
@@ -550,7 +551,8 @@ HcclResult TopoInfoExtractor::SetTopoInfoForLevel0()
         CHK_RET(SetMultiLevel0(ringNum)); // 8P_RING场景下，外层拓扑中有四个环; 910_93场景中适配双环
         // SDMA&RDMA并发特性
         if (GetExternalInputEnableRdmaSdmaConcurrent()) {
-            std::vector<std::vector<u32> > multiOrder = GetRingsOrderForAnyPath(ranksSize, topoType_, mockNicList);
+            std::vector<std::vector<u32> > multiOrder = GetRingsOrderForAnyPath(ranksSize, topoType_, mockNicList,
+                rohAdjacency_);
             SetMultiLevel0AnyPath(multiOrder);
         }
     }
@@ -678,6 +680,10 @@ HcclResult TopoInfoExtractor::SetTopoInfoForLevel1(bool prepareAHC)
             calcGroupDone = true;
         }
 
+        if (!prepareAHC) { // 双二叉树的第二棵树使用独立的link, 平面划分与level1一致
+            CommPlaneVector_[COMM_LEVEL1_DBT_TREE].push_back(tmpBridgeVector);
+        }
+
         if (GetExternalInputEnableRdmaSdmaConcurrent() && !prepareAHC) { // anypath的level1层
             CommPlaneVector_[COMM_LEVEL1_ANYPATH_SDMA].push_back(tmpBridgeVector);
             CommPlaneVector_[COMM_LEVEL1_ANYPATH_RDMA].push_back(tmpBridgeVector);
@@ -1270,14 +1276,7 @@ bool CompareWithUserRankAscend(const RankInfo &left, const RankInfo &right)
 // 适配ROH平面网段隔离，奇数rank互通，偶数rank互通，奇偶不通
 bool CheckSdmaWithRohTopo(const std::vector<u32> &nicList, std::vector<u32> &topoList)
 {
-    std::vector<u32> tmpNicList(nicList);
-    std::sort(tmpNicList.begin(), tmpNicList.end());
-    SearchPath searchPath;
-    topoList = searchPath.Search(tmpNicList);
-    if (topoList.empty()) {
-        return false;
-    }
-    return true;
+    return SearchRohRing(nicList, topoList);
 }
 
 std::vector<std::vector<u32>> GetRingsOrderByTopoType(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList)
@@ -1328,14 +1327,15 @@ std::vector<std::vector<u32>> GetRingsOrderByTopoType(u32 ranksSize, TopoType to
     return multiRingOrder;
 }
 
-std::vector<std::vector<u32>> GetRingsOrderForAnyPath(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList)
+std::vector<std::vector<u32>> GetRingsOrderForAnyPath(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList,
+    const NicAdjacency &rohAdjacency)
 {
     std::vector<std::vector<u32>> multiRingOrder;
     if (topoType == TopoType::TOPO_TYPE_NP_DOUBLE_RING) { // 2 ring 场景
         std::vector<u32> tmpLevel00;   // 环0
         std::vector<u32> tmpLevel01;  // 环1
         std::vector<u32> rohLevel0;
-        if (CheckSdmaWithRohTopo(nicList, rohLevel0)) {
+        if (SearchRohRing(nicList, rohLevel0, rohAdjacency)) {
             tmpLevel00 = rohLevel0;          // 环0, 8卡 { 0, 1, 3, 2, 4, 5, 7, 6 };
             tmpLevel01.reserve(ranksSize);  // 环1, 8卡 { 0, 6, 7, 5, 4, 2, 3, 1 };
             tmpLevel01.push_back(rohLevel0[0]);
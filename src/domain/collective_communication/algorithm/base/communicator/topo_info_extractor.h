@@ -22,6 +22,7 @@
 #include "hccl_impl_pub.h"
 #include "comm_ahc_base_pub.h"
 #include "alg_template_base_pub.h"
+#include "search_path.h"
 namespace hccl {
 
 class TopoInfoExtractor {
@@ -119,6 +120,7 @@ private:
 
     bool isDiffDeviceType_;
     u32 gcdDeviceNumPerAggregation_;
+    NicAdjacency rohAdjacency_ = GetSioReachableAdjacency(); // ROH成环使用的可达关系, 带server内实际链路带宽
 
     // 保存所有 level 的通信分组关系， CommPlaneSubGroupVector_[CommPlane] : 第 CommPlane 级通信域内分组信息
     std::vector<std::vector<std::vector<std::vector<u32>>>> CommPlaneSubGroupVector_;
@@ -134,7 +136,8 @@ bool Ascending(const RankInfo &first, const RankInfo &second);
 bool CompareWithUserRankAscend(const RankInfo &left, const RankInfo &right);
 bool CheckSdmaWithRohTopo(const std::vector<u32> &nicList, std::vector<u32> &topoList);
 std::vector<std::vector<u32>> GetRingsOrderByTopoType(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList);
-std::vector<std::vector<u32>> GetRingsOrderForAnyPath(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList);
+std::vector<std::vector<u32>> GetRingsOrderForAnyPath(u32 ranksSize, TopoType topoType, std::vector<u32> &nicList,
+    const NicAdjacency &rohAdjacency = GetSioReachableAdjacency());
 }
 
 #endif
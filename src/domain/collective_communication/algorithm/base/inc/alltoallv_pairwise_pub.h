@@ -14,6 +14,13 @@
 #include "alg_template_base_pub.h"
 
 namespace hccl {
+// 同时在途的pairwise步数上限
+constexpr u32 PAIRWISE_MAX_WINDOW = 4;
+// BCopy模式下每个在途步独占的scratch分片下限
+constexpr u64 PAIRWISE_MIN_SLOT_SIZE = 1024 * 1024;
+// 单步平均数据量超过该值时, 跨机RDMA链路已被单步打满, 窗口收敛为2
+constexpr u64 PAIRWISE_NIC_BOUND_STEP_SIZE = 4 * 1024 * 1024;
+constexpr u32 PAIRWISE_NIC_BOUND_WINDOW = 2;
 
 class AlltoAllVPairWise : public AlgTemplateBase{
 public:
@@ -33,6 +40,10 @@ public:
         bool isAlltoAllZCopyMode, const Stream &stream, HcclWorkflowMode workMode, 
         std::map<u32, std::vector<u64>> &rankSendDisplsMap, 
         std::map<u32, std::vector<u64>> &rankRecvDisplsMap) override;
+    /* 单算子模式下在Prepare之后调用, window个步骤分组并发在主流与window-1条从流上 */
+    HcclResult PrepareWindow(u32 window, std::vector<Stream> &subStreams,
+        const std::vector<std::shared_ptr<LocalNotify>> &signalMainToSub,
+        const std::vector<std::shared_ptr<LocalNotify>> &signalSubToMain);
     HcclResult RunAsync(const u32 rank, const u32 rankSize, const std::vector<LINK> &links) override;
     HcclResult GetNslbAdjInfo(const u32 rank, const u32 rankSize,
                               const std::vector<LINK> &links, AdjInfo& nslbAdjInfo) override;
@@ -43,13 +54,19 @@ private:
     HcclResult RunBCopyAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links);
     // 图模式使用该函数
     HcclResult RunZCopyAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links);
+    // 多步并发, 步骤i与rankSize-i共用同一对链路, 成组放在同一条流上
+    HcclResult RunWindowedAlltoAll(const u32 rank, const u32 rankSize, const std::vector<LINK> &links);
+    HcclResult RunBCopyStep(const u32 rank, const u32 rankSize, u32 step, u32 slot, Stream &stream,
+        const std::vector<LINK> &links);
+    HcclResult RunZCopyStep(const u32 rank, const u32 rankSize, u32 step, Stream &stream,
+        const std::vector<LINK> &links);
     HcclResult CalcSendRecvCounts(u32 times, u32 curTime, u64 totalBytes, u64 &curBytes) const;
 
     // 单算子模式使用该SendRecv
-    HcclResult SendRecv(u64 curSendBytes, u64 curRecvBytes, u8* sendAddr, u8* recvAddr,
-        std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport);
+    HcclResult SendRecv(u64 curSendBytes, u64 curRecvBytes, u8* sendAddr, u8* recvAddr, u64 slotOffset,
+        Stream &stream, std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport);
     // 图模式使用该SendRecv
-    HcclResult SendRecv(TxMemoryInfo txMemoryInfo, RxMemoryInfo rxMemoryInfo,
+    HcclResult SendRecv(TxMemoryInfo txMemoryInfo, RxMemoryInfo rxMemoryInfo, Stream &stream,
         std::shared_ptr<Transport> prevTransport, std::shared_ptr<Transport> nextTransport);
 
     AlltoAllVBufferInfo sendBuffer_;
@@ -66,6 +83,12 @@ private:
     const std::map<u32, std::vector<u64>> *rankRecvDisplsMapPtr_{nullptr};
     HcclWorkflowMode workMode_;
     bool isAlltoAllZCopyMode_;
+
+    u32 window_{1};
+    u64 slotSize_{0}; // BCopy模式下每个在途步使用的scratch分片大小, window_为1时等于scratchMemSize_
+    std::vector<Stream> subStreams_;
+    std::vector<std::shared_ptr<LocalNotify>> signalMainToSub_;
+    std::vector<std::shared_ptr<LocalNotify>> signalSubToMain_;
 };
 }  // namespace hccl
 
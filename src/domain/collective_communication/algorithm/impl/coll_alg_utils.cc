@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include "coll_alg_utils.h"
 #include "workflow_pub.h"
@@ -95,6 +96,44 @@ bool IsSupportDirectFullmeshForAlltoallv(const OpParam& param, DevType deviceTyp
     return baseInfo && isOpbase && isHCCS && isSatisfyBuffer;
 }
 
+// 单算子host展开的alltoallv/alltoallvc支持按需建链, aicpu展开与图捕获场景的链路需在下发前全部就绪
+bool IsAlltoAllLazyLinkOp(const OpParam& param)
+{
+    bool isOpbase = (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    bool isAlltoAllV = (param.opType == HcclCMDType::HCCL_CMD_ALLTOALLV ||
+        param.opType == HcclCMDType::HCCL_CMD_ALLTOALLVC);
+    return isOpbase && isAlltoAllV && !param.aicpuUnfoldMode && !param.isCapture;
+}
+
+/*
+ * 与对端有任一方向的数据即需要链路。rank i发往j的数据量与j从i接收的数据量一致,
+ * 因此两端仅凭各自的收发count即可得到相同的结论, 无需额外协商
+ */
+HcclResult GetAlltoAllActivePeers(const OpParam& param, u32 userRank, u32 userRankSize,
+    std::vector<bool> &activePeers)
+{
+    activePeers.assign(userRankSize, false);
+    if (param.opType == HcclCMDType::HCCL_CMD_ALLTOALLV) {
+        CHK_PTR_NULL(param.All2AllDataDes.sendCounts);
+        CHK_PTR_NULL(param.All2AllDataDes.recvCounts);
+        const u64 *sendCounts = static_cast<const u64 *>(param.All2AllDataDes.sendCounts);
+        const u64 *recvCounts = static_cast<const u64 *>(param.All2AllDataDes.recvCounts);
+        for (u32 peer = 0; peer < userRankSize; peer++) {
+            activePeers[peer] = (sendCounts[peer] != 0) || (recvCounts[peer] != 0);
+        }
+    } else if (param.opType == HcclCMDType::HCCL_CMD_ALLTOALLVC) {
+        CHK_PTR_NULL(param.All2AllDataDes.sendCountMatrix);
+        const u64 *countMatrix = static_cast<const u64 *>(param.All2AllDataDes.sendCountMatrix);
+        for (u32 peer = 0; peer < userRankSize; peer++) {
+            activePeers[peer] = (countMatrix[static_cast<u64>(userRank) * userRankSize + peer] != 0) ||
+                (countMatrix[static_cast<u64>(peer) * userRankSize + userRank] != 0);
+        }
+    } else {
+        activePeers.assign(userRankSize, param.All2AllDataDes.sendCount != 0);
+    }
+    return HCCL_SUCCESS;
+}
+
 bool SatisfyIntraSuperPod(DevType deviceType, u32 rankSize, bool useSuperPodMode, u32 superPodNum)
 {
     bool rankSizeSupport = (rankSize <= MAX_ALLTOALL_MESH_ALGO_RANK_INTRA_MESH);
@@ -470,4 +509,51 @@ u32 CalGCD(u32 a, u32 b)
     HCCL_DEBUG("[CalGCD]a[%u] b[%u], gcd[%u]", a, b, gcd);
     return gcd;
 }
+
+HcclResult CalcBalancedCurCountsAndCurDispls(const u64 maxTotalCount, std::vector<u64> &countsLeft,
+    std::vector<u64> &displs, std::vector<u64> &curCounts, std::vector<u64> &curDispls, bool &finished)
+{
+    CHK_PRT_RET(maxTotalCount == 0,
+        HCCL_ERROR("[CalcBalancedCurCountsAndCurDispls]maxTotalCount is zero"), HCCL_E_PARA);
+    CHK_PRT_RET(countsLeft.size() != displs.size(),
+        HCCL_ERROR("[CalcBalancedCurCountsAndCurDispls]counts size[%zu] is not equal to displs size[%zu]",
+            countsLeft.size(), displs.size()), HCCL_E_PARA);
+    finished = true;
+
+    curCounts.assign(countsLeft.size(), 0);
+    curDispls.assign(displs.begin(), displs.end());
+
+    // 剩余量小的rank整块搬运, 其余rank平分剩余额度
+    std::vector<u64> sortedLeft(countsLeft);
+    std::sort(sortedLeft.begin(), sortedLeft.end());
+    u64 budget = maxTotalCount;
+    u64 cap = sortedLeft.empty() ? 0 : sortedLeft.back();
+    for (u64 i = 0; i < sortedLeft.size(); i++) {
+        u64 restRankNum = sortedLeft.size() - i;
+        if (sortedLeft[i] > budget / restRankNum) {
+            cap = budget / restRankNum;
+            break;
+        }
+        budget -= sortedLeft[i];
+    }
+    // 平分后的余数逐个补给未搬完的rank, 各rank按相同规则计算, 结果一致; 数据全部搬完即结束, 不再执行空的一轮
+    u64 extraCount = 0;
+    for (u32 i = 0; i < countsLeft.size(); ++i) {
+        curCounts[i] = std::min(countsLeft[i], cap);
+        extraCount += curCounts[i];
+    }
+    extraCount = (extraCount < maxTotalCount) ? maxTotalCount - extraCount : 0;
+    for (u32 i = 0; i < countsLeft.size(); ++i) {
+        if (extraCount > 0 && countsLeft[i] > curCounts[i]) {
+            curCounts[i]++;
+            extraCount--;
+        }
+        countsLeft[i] -= curCounts[i];
+        displs[i] += curCounts[i];
+        if (countsLeft[i] != 0) {
+            finished = false;
+        }
+    }
+    return HCCL_SUCCESS;
+}
 }
\ No newline at end of file
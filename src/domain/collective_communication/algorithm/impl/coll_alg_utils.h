@@ -36,6 +36,9 @@ bool IsAlltoAllvcSatisfyBufferSize(const OpParam& param, u32 userRankSize, u64 c
 bool IsSupportDirectFullmeshForAlltoallv(const OpParam& param, DevType deviceType, bool useSuperPodMode, u32 serverNum,
     bool isSingleMeshAggregation, u32 userRankSize, u64 cclbufferSize);
 bool FullmeshPairwiseSatisfyHighPerfAlltoallMeshCondition(DevType deviceType, u32 rankSize, bool useSuperPodMode);
+bool IsAlltoAllLazyLinkOp(const OpParam& param);
+HcclResult GetAlltoAllActivePeers(const OpParam& param, u32 userRank, u32 userRankSize,
+    std::vector<bool> &activePeers);
 bool SatisfyIntraSuperPod(DevType deviceType, u32 rankSize, bool useSuperPodMode, u32 superPodNum = 1);
 bool HcclOpInplaceDefaultCase(const OpParam &param, u8 &isInplaceStatus);
 bool IsInputOutputOverlap(const OpParam &param, u64 inputDataSize, u64 outputDataSize, u8 &isInplaceStatus);
@@ -60,5 +63,8 @@ u64 CalculatePiplineSliceNum(HcclCMDType opType, u64 dataSize, AlgType algType,
     u32 deviceNumPerAggregation, u32 moduleNum);
 u32 CalGCD(std::vector<u32> &nums); // 计算n个数的最大公约数
 u32 CalGCD(u32 a, u32 b); // 计算2个数的最大公约数
+// V类算子单轮loop切分: 各rank本轮数据在中转内存中紧密排布, 总量不超过maxTotalCount, 各rank尽量均分
+HcclResult CalcBalancedCurCountsAndCurDispls(const u64 maxTotalCount, std::vector<u64> &countsLeft,
+    std::vector<u64> &displs, std::vector<u64> &curCounts, std::vector<u64> &curDispls, bool &finished);
 }   // namespace hccl
 #endif
\ No newline at end of file
@@ -193,8 +193,9 @@ HcclResult CollAllGatherVExecutor::RunLoop(OpParam &param, AlgResourceResponse &
         if (!DMAReduceFlag_) {
             u64 offSetCount = 0;
             // 如果使用CCL buffer，需要将CCL buffer out中的结果拷贝到user buffer out
-            for (u32 i = 0; i < topoAttr_.userRankSize; i++) {
+            for (u32 idx = 0; idx < topoAttr_.userRankSize; idx++) {
                 // 拷贝中转output上每个slice的数据到output内存，目的端中每个slice的size固定为output的size
+                const u32 i = cclRankOrder_.empty() ? idx : cclRankOrder_[idx];
                 DeviceMem dstMem = DeviceMem::create(curOutputPtr + curDispls[i] * unitSize, curCounts[i] * unitSize);
                 DeviceMem srcMem = DeviceMem::create(commOutputPtr + offSetCount * unitSize, curCounts[i] * unitSize);
                 offSetCount += curCounts[i];
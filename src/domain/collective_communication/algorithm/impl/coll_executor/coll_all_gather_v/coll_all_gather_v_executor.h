@@ -33,6 +33,7 @@ protected:
     HcclResult CalcTotalCount(std::vector<u64> curCounts, u64 &totalCount);
 
     bool DMAReduceFlag_{false}; // 是否DMA消减的标志
+    std::vector<u32> cclRankOrder_; // CCL buffer out中各rank数据的排布顺序, 为空时按userRank顺序排布
 };
 
 } // namespace hccl
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_all_gather_v_hierarchical_executor.h"
+#include "alg_template_register.h"
+#include "coll_alg_utils.h"
+
+namespace hccl {
+CollAllGatherVHierarchicalExecutor::CollAllGatherVHierarchicalExecutor(const HcclDispatcher dispatcher,
+    std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollAllGatherVExecutor(dispatcher, topoMatcher)
+{
+    DMAReduceFlag_ = false;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcStreamNum(u32& streamNum)
+{
+    u32 totalStreamNum = topoAttr_.deviceNumPerAggregation > 1U ? topoAttr_.deviceNumPerAggregation - 1U : 1U;
+    streamNum = totalStreamNum - 1U;
+    HCCL_INFO("[CollAllGatherVHierarchicalExecutor][CalcStreamNum] tag[%s] streamNum[%u]",
+        tag_.c_str(), streamNum);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport)
+{
+    TransportMemType inputType = TransportMemType::RESERVED;
+    TransportMemType outputType = TransportMemType::RESERVED;
+    CHK_RET(CalcTransportMemType(inputType, outputType));
+    CHK_RET(CalcLevel0CommInfo(inputType, outputType, opTransport));
+    CHK_RET(CalcLevel1CommInfo(inputType, outputType, opTransport));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcTransportMemType(TransportMemType &inputType,
+    TransportMemType &outputType)
+{
+    inputType = TransportMemType::CCL_INPUT;
+    outputType = TransportMemType::CCL_OUTPUT;
+    HCCL_INFO("[CollAllGatherVHierarchicalExecutor][CalcTransportMemType] tag[%s] inputType[%d], outputType[%d]",
+        tag_.c_str(), inputType, outputType);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcLevel0CommInfo(TransportMemType inputType,
+    TransportMemType outputType, std::vector<LevelNSubCommTransport>& opTransport)
+{
+    // 节点内mesh, 仅支持单算子模式, 各rank与server内全部rank建链
+    CommParaInfo commParaLevel0(COMM_LEVEL0, CommType::COMM_TAG_MESH);
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaLevel0, opTransport[COMM_LEVEL0], inputType, outputType));
+    return HCCL_SUCCESS;
+}
+
+u64 CollAllGatherVHierarchicalExecutor::CalcLoopMaxCount(const u64 cclBuffSize, const u32 unitSize)
+{
+    // 本轮所有rank的数据在ccl out中紧密排布, 总量不超过中转内存大小
+    u64 maxCountPerLoop = cclBuffSize / HCCL_MIN_SLICE_ALIGN * HCCL_MIN_SLICE_ALIGN / unitSize;
+    HCCL_INFO("[CollAllGatherVHierarchicalExecutor][CalcLoopMaxCount]maxCountPerLoop[%llu]", maxCountPerLoop);
+    return maxCountPerLoop;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcCurCountsAndCurDispls(const u64 maxTotalCount,
+    std::vector<u64> &countsLeft, std::vector<u64> &displs, std::vector<u64> &curCounts, std::vector<u64> &curDispls,
+    bool &finished)
+{
+    // 本轮所有rank的数据在ccl out中紧密排布, 总量不超过maxTotalCount
+    return CalcBalancedCurCountsAndCurDispls(maxTotalCount, countsLeft, displs, curCounts, curDispls, finished);
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::RunLoop(OpParam &param, AlgResourceResponse &algRes)
+{
+    // ccl out中按server依次排布各rank的数据, 使server的数据块连续, 同server的userRank可不连续
+    CHK_RET(topoMatcher_->GetServerToRank(serverToRank_));
+    cclRankOrder_.clear();
+    for (const std::vector<u32> &userRanks : serverToRank_) {
+        cclRankOrder_.insert(cclRankOrder_.end(), userRanks.begin(), userRanks.end());
+    }
+    CHK_PRT_RET(cclRankOrder_.size() != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollAllGatherVHierarchicalExecutor][RunLoop]rank num[%zu] in servers is not equal to "
+            "userRankSize[%u]", cclRankOrder_.size(), topoAttr_.userRankSize), HCCL_E_INTERNAL);
+    return CollAllGatherVExecutor::RunLoop(param, algRes);
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::CalcSlices(const OpParam &param, u32 level0RankSize,
+    u32 level1RankSize, std::vector<Slice> &rankSlices, std::vector<Slice> &serverSlices)
+{
+    CHK_PRT_RET(serverToRank_.size() != level1RankSize || cclRankOrder_.size() != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollAllGatherVHierarchicalExecutor][CalcSlices]server num[%zu] is not equal to "
+            "level1RankSize[%u]", serverToRank_.size(), level1RankSize), HCCL_E_INTERNAL);
+    const u32 unitSize = SIZE_TABLE[param.VDataDes.dataType];
+    const auto *counts = static_cast<const u64 *>(param.VDataDes.counts);
+
+    // 一个server的数据块由其内各rank的slice按userRank升序拼接而成, 与RunLoop中的排布一致
+    rankSlices.assign(topoAttr_.userRankSize, Slice());
+    serverSlices.assign(level1RankSize, Slice());
+    u64 offset = 0;
+    for (u32 server = 0; server < level1RankSize; server++) {
+        const std::vector<u32> &userRanks = serverToRank_[server];
+        CHK_PRT_RET(userRanks.size() != level0RankSize,
+            HCCL_ERROR("[CollAllGatherVHierarchicalExecutor][CalcSlices]server[%u] rank num[%zu] is not equal to "
+            "level0RankSize[%u]", server, userRanks.size(), level0RankSize), HCCL_E_INTERNAL);
+        serverSlices[server].offset = offset;
+        for (u32 rank : userRanks) {
+            rankSlices[rank].offset = offset;
+            rankSlices[rank].size = counts[rank] * unitSize;
+            offset += rankSlices[rank].size;
+        }
+        serverSlices[server].size = offset - serverSlices[server].offset;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::RunLevel1(const OpParam &param, ExecMem &execMem,
+    const std::vector<Slice> &serverSlices, const SubCommInfo &level1CommInfo)
+{
+    std::unique_ptr<AlgTemplateBase> level1TempAlg;
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_RING) {
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_ALL_GATHER_RING, dispatcher_);
+        HCCL_INFO("allgatherv hierarchical: using ring algo inter-server.");
+    } else {
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_ALL_GATHER_NHR, dispatcher_);
+        HCCL_INFO("allgatherv hierarchical: using nhr algo inter-server.");
+    }
+    CHK_SMART_PTR_NULL(level1TempAlg);
+
+    //  此处虽然带入inputMem作为scratch mem, 但inputMem 不能被使用
+    CHK_RET(level1TempAlg->Prepare(execMem.outputMem, execMem.outputMem, execMem.inputMem, execMem.count,
+        param.VDataDes.dataType, param.stream, HcclReduceOp::HCCL_REDUCE_RESERVED, INVALID_VALUE_RANKID,
+        serverSlices, 0));
+
+    u32 rankSize = level1CommInfo.localRankSize;
+    CHK_RET(level1TempAlg->RegisterProfiler((rankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + level1CommInfo.localRank,
+        PROF_STAGE_2, HCCL_EXEC_STEP_NOT_SET, param.stream));
+
+    CHK_RET(RunTemplate(level1TempAlg, level1CommInfo));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAllGatherVHierarchicalExecutor::KernelRun(const OpParam &param, ExecMem &execMem)
+{
+    HCCL_CONFIG_INFO(HCCL_ALG, "[CollAllGatherVHierarchicalExecutor][KernelRun] userRank[%u] starts.",
+        topoAttr_.userRank);
+    HcclDataType dataType = param.VDataDes.dataType;
+
+    CHK_RET(CheckCommSize(COMM_LEVEL0, COMM_INDEX_0 + 1));
+    SubCommInfo level0CommInfo = GetSubCommInfo(COMM_LEVEL0, COMM_INDEX_0);
+    u32 commIndex = level0CommInfo.localRank;
+    CHK_RET(CheckCommSize(COMM_LEVEL1, commIndex + 1));
+    SubCommInfo level1CommInfo = GetSubCommInfo(COMM_LEVEL1, commIndex);
+
+    u32 level0RankSize = level0CommInfo.localRankSize;
+    u32 level1RankSize = level1CommInfo.localRankSize;
+    u32 serverIndex = level1CommInfo.localRank;
+    CHK_PRT_RET(level0RankSize * level1RankSize != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollAllGatherVHierarchicalExecutor][KernelRun]level0RankSize[%u] * level1RankSize[%u] "
+        "is not equal to userRankSize[%u]", level0RankSize, level1RankSize, topoAttr_.userRankSize),
+        HCCL_E_INTERNAL);
+
+    std::vector<Slice> rankSlices;
+    std::vector<Slice> serverSlices;
+    CHK_RET(CalcSlices(param, level0RankSize, level1RankSize, rankSlices, serverSlices));
+    const u64 totalSize = serverSlices.back().offset + serverSlices.back().size;
+    // level1平面按server序号排列, level0平面按server内userRank升序排列
+    CHK_PRT_RET(serverToRank_[serverIndex][level0CommInfo.localRank] != topoAttr_.userRank,
+        HCCL_ERROR("[CollAllGatherVHierarchicalExecutor][KernelRun]userRank[%u] is not rank[%u] of server[%u]",
+            topoAttr_.userRank, level0CommInfo.localRank, serverIndex), HCCL_E_INTERNAL);
+
+    //  第一步，将数据从input内存拷贝到output内存的对应位置
+    const Slice &localSlice = rankSlices[topoAttr_.userRank];
+    if (localSlice.size > 0) {
+        DeviceMem dstMem = execMem.outputMem.range(localSlice.offset, localSlice.size);
+        CHK_SMART_PTR_NULL(dstMem);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, execMem.inputMem, const_cast<Stream&>(param.stream)));
+    }
+
+    // 第二步，各个AI Server 内 multi stream mesh all gather
+    const Slice &serverSlice = serverSlices[serverIndex];
+    if (level0RankSize > 1 && serverSlice.size > 0) {
+        CHK_RET(ActiveSlaveStreams(param.stream));
+
+        // slice偏移相对于本server数据块, 数据块在ccl out中的偏移作为baseOffset
+        std::vector<Slice> dataSegsSlice(level0RankSize);
+        for (u32 localRank = 0; localRank < level0RankSize; localRank++) {
+            const Slice &rankSlice = rankSlices[serverToRank_[serverIndex][localRank]];
+            dataSegsSlice[localRank].offset = rankSlice.offset - serverSlice.offset;
+            dataSegsSlice[localRank].size = rankSlice.size;
+        }
+        DeviceMem currentOutputMem = execMem.outputMem.range(serverSlice.offset, serverSlice.size);
+        CHK_SMART_PTR_NULL(currentOutputMem);
+
+        std::unique_ptr<AlgTemplateBase> level0TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_ALL_GATHER_MESH_ATOMIC, dispatcher_);
+        CHK_SMART_PTR_NULL(level0TempAlg);
+        CHK_RET(level0TempAlg->Prepare(algResResp_->slaveStreams, algResResp_->notifiesMain,
+            algResResp_->notifiesAux, topoAttr_.userRank, nullptr, commIndex, level0RankSize));
+        CHK_RET(level0TempAlg->Prepare(currentOutputMem, currentOutputMem, execMem.inputMem, execMem.count,
+            dataType, param.stream, HCCL_REDUCE_RESERVED, LEVEL0_BRIDGE_RANK_ID, dataSegsSlice, serverSlice.offset));
+        CHK_RET(level0TempAlg->RegisterProfiler((level0RankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + commIndex,
+            PROF_STAGE_1, HCCL_EXEC_STEP_NOT_SET, param.stream));
+        CHK_RET(RunTemplate(level0TempAlg, level0CommInfo));
+        HCCL_INFO("allgatherv hierarchical level0 run success");
+    }
+
+    //  第三步， AI server 间 all gather
+    if (level1RankSize > 1 && totalSize > 0) {
+        CHK_RET(RunLevel1(param, execMem, serverSlices, level1CommInfo));
+        HCCL_INFO("allgatherv hierarchical level1 run success");
+    }
+    return HCCL_SUCCESS;
+}
+
+REGISTER_EXEC("AllGatherVHierarchicalExecutor", AllGatherVHierarchical, CollAllGatherVHierarchicalExecutor);
+} // namespace hccl
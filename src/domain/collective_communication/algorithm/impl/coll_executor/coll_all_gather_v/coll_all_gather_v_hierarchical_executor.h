@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef COLL_ALLGATHERV_HIERARCHICAL_EXECUTOR_H
+#define COLL_ALLGATHERV_HIERARCHICAL_EXECUTOR_H
+#include "coll_all_gather_v_executor.h"
+
+// 对应 CollAllGatherMeshExecutor, 节点内mesh + 节点间ring/NHR, 支持多机场景
+namespace hccl {
+class CollAllGatherVHierarchicalExecutor : public CollAllGatherVExecutor {
+public:
+    explicit CollAllGatherVHierarchicalExecutor(const HcclDispatcher dispatcher,
+        std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~CollAllGatherVHierarchicalExecutor() = default;
+
+private:
+    /* *************** 资源计算 *************** */
+    HcclResult CalcStreamNum(u32& streamNum) override;
+    HcclResult CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport) override;
+    HcclResult CalcTransportMemType(TransportMemType &inputType, TransportMemType &outputType);
+    HcclResult CalcLevel0CommInfo(TransportMemType inputType, TransportMemType outputType,
+        std::vector<LevelNSubCommTransport>& opTransport) override;
+
+    /* *************** 算法编排 *************** */
+    HcclResult CalcCurCountsAndCurDispls(const u64 maxTotalCount, std::vector<u64> &countsLeft,
+        std::vector<u64> &displs, std::vector<u64> &curCounts, std::vector<u64> &curDispls, bool &finished) override;
+    u64 CalcLoopMaxCount(const u64 cclBuffSize, const u32 unitSize) override;
+    HcclResult RunLoop(OpParam &param, AlgResourceResponse &algRes) override;
+    HcclResult KernelRun(const OpParam &param, ExecMem &execMem) override;
+    HcclResult CalcSlices(const OpParam &param, u32 level0RankSize, u32 level1RankSize,
+        std::vector<Slice> &rankSlices, std::vector<Slice> &serverSlices);
+    HcclResult RunLevel1(const OpParam &param, ExecMem &execMem, const std::vector<Slice> &serverSlices,
+        const SubCommInfo &level1CommInfo);
+
+    std::vector<std::vector<u32>> serverToRank_; // 按server划分的userRank, server内升序
+};
+
+} // namespace hccl
+
+#endif
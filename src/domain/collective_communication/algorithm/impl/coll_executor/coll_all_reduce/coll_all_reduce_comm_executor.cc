@@ -58,6 +58,8 @@ HcclResult CollAllReduceCommExecutor::CalcCombinedCommInfo(TransportMemType inpu
         commParaInfo.commType = CommType::COMM_TAG_NONUNIFORM_HIERARCHICAL_RING_V1;
     } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB) {
         commParaInfo.commType = CommType::COMM_TAG_NONUNIFORM_BRUCK;
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        commParaInfo.commType = CommType::COMM_TAG_DOUBLE_BINARY_TREE;
     } else {
         commParaInfo.commType = CommType::COMM_TAG_RING_INNER;
     }
@@ -113,6 +115,11 @@ HcclResult CollAllReduceCommExecutor::KernelRun(const OpParam &param, ExecMem &e
         HCCL_INFO("allreduce comm: using nonuniform-bruck algo inter-server.");
         CHK_SMART_PTR_NULL(tempAlg);
         CHK_RET(tempAlg->Prepare(reduceAttr));
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_DBT, dispatcher_);
+        HCCL_INFO("allreduce comm: using double-binary-tree algo inter-server.");
+        CHK_SMART_PTR_NULL(tempAlg);
+        CHK_RET(tempAlg->Prepare(reduceAttr));
     } else {
         tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_RING, dispatcher_);
         HCCL_INFO("allreduce comm: using ring algo inter-server.");
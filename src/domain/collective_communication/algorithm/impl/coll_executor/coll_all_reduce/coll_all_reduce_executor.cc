@@ -431,4 +431,20 @@ HcclResult CollAllReduceExecutor::PrepareAivBuffers(u32 rankSize, u32 rankId, u3
     return HCCL_SUCCESS;
 }
 
+HcclResult CollAllReduceExecutor::PrepareDBTTemplate(std::unique_ptr<AlgTemplateBase> &tempAlg, u64 reduceAttr,
+    u32 commIndex)
+{
+    CHK_SMART_PTR_NULL(tempAlg);
+    CHK_RET(CheckCommSize(COMM_LEVEL1_DBT_TREE, commIndex + 1));
+    if (algResResp_->slaveStreams.size() < DBT_TREE_NUM || algResResp_->notifiesMain.size() < DBT_TREE_NUM ||
+        algResResp_->notifiesAux.size() < DBT_TREE_NUM) {
+        HCCL_INFO("[CollAllReduceExecutor][PrepareDBTTemplate]tag[%s] slave stream num[%zu] is not enough, "
+            "run two trees on main stream", tag_.c_str(), algResResp_->slaveStreams.size());
+    }
+    SubCommInfo treeCommInfo = GetSubCommInfo(COMM_LEVEL1_DBT_TREE, commIndex);
+    CHK_RET(tempAlg->Prepare(reduceAttr, algResResp_->slaveStreams, algResResp_->notifiesMain,
+        algResResp_->notifiesAux, treeCommInfo.links));
+    return HCCL_SUCCESS;
+}
+
 } // namespace hccl
\ No newline at end of file
@@ -38,6 +38,8 @@ protected:
     HcclResult PrepareAivBuffers(u32 rankSize, u32 rankId, u32 rankOffset,
         DeviceMem &inputMem, DeviceMem &outputMem, std::vector<LINK> &links, void **dataBuffers, void **flagBuffers,
         UserMemType dataMemType, UserMemType flagMemType, u32 dataMemOffset, u32 flagMemOffset);
+    // 双二叉树: 从流足够时两棵树并行, 第二棵树使用COMM_LEVEL1_DBT_TREE平面的link
+    HcclResult PrepareDBTTemplate(std::unique_ptr<AlgTemplateBase> &tempAlg, u64 reduceAttr, u32 commIndex);
 
     bool CCLMemSlice_{true};    // 每次Loop是否需要对CCLMem进行切片
     bool DMAReduceFlag_{false}; // 是否DMA消减
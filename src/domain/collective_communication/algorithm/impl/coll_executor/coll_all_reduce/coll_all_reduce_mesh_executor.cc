@@ -34,6 +34,9 @@ HcclResult CollAllReduceMeshExecutor::CalcStreamNum(u32& streamNum)
 {
     u32 totalStreamNum = topoAttr_.deviceNumPerAggregation > 1U ? topoAttr_.deviceNumPerAggregation - 1U : 1U;
     streamNum = totalStreamNum - 1U;
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        streamNum = std::max(streamNum, DBT_TREE_NUM); // 两棵树各占一条从流
+    }
     HCCL_INFO("[CollAllReduceMeshExecutor][CalcStreamNum] tag[%s] streamNum[%u]",
         tag_.c_str(), streamNum);
     return HCCL_SUCCESS;
@@ -165,6 +168,11 @@ HcclResult CollAllReduceMeshExecutor::KernelRun(const OpParam &param, ExecMem &e
         HCCL_INFO("allreduce mesh: using nb algo inter-server.");
         CHK_SMART_PTR_NULL(level1TempAlg);
         CHK_RET(level1TempAlg->Prepare(reduceAttr));
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_ALL_REDUCE_DBT, dispatcher_);
+        HCCL_INFO("allreduce mesh: using double-binary-tree algo inter-server.");
+        CHK_RET(PrepareDBTTemplate(level1TempAlg, reduceAttr, commIndex));
     } else {
         level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
             TemplateType::TEMPLATE_ALL_REDUCE_RECURSIVE_HALVING_DOUBLING, dispatcher_);
@@ -260,6 +268,10 @@ HcclResult CollAllReduceMeshExecutor::SelectTempAlg(std::unique_ptr<AlgTemplateB
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
                 TemplateType::TEMPLATE_ALL_REDUCE_NB, dispatcher_);
             HCCL_INFO("allreduce mesh: using nb algo inter-server.");
+        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+                TemplateType::TEMPLATE_ALL_REDUCE_DBT, dispatcher_);
+            HCCL_INFO("allreduce mesh: using double-binary-tree algo inter-server.");
         } else {
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
                 TemplateType::TEMPLATE_ALL_REDUCE_RECURSIVE_HALVING_DOUBLING, dispatcher_);
@@ -39,6 +39,9 @@ HcclResult CollAllReduceRingExecutor::CalcStreamNum(u32& streamNum)
         }
     }
     streamNum = totalStreamNum - 1;
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        streamNum = std::max(streamNum, DBT_TREE_NUM); // 两棵树各占一条从流
+    }
     HCCL_INFO("[CollAllReduceRingExecutor][CalcStreamNum] tag[%s] streamNum[%u]",
         tag_.c_str(), streamNum);
     return HCCL_SUCCESS;
@@ -186,6 +189,11 @@ HcclResult CollAllReduceRingExecutor::KernelRun(const OpParam &param, ExecMem &e
             HCCL_INFO("allreduce ring: using nonuniform-bruck algo inter-server.");
             CHK_SMART_PTR_NULL(level1TempAlg);
             CHK_RET(level1TempAlg->Prepare(reduceAttr));
+        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_DBT,
+                dispatcher_);
+            HCCL_INFO("allreduce ring: using double-binary-tree algo inter-server.");
+            CHK_RET(PrepareDBTTemplate(level1TempAlg, reduceAttr, commIndex));
         } else {
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_RECURSIVE_HALVING_DOUBLING, dispatcher_);
             HCCL_INFO("allreduce ring: using Recursive halving-doubling algo inter-server.");
@@ -265,6 +273,10 @@ HcclResult CollAllReduceRingExecutor::SelectTempAlg(std::unique_ptr<AlgTemplateB
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_NB, 
                 dispatcher_);
             HCCL_INFO("allreduce ring: using nonuniform-bruck algo inter-server.");
+        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_DBT,
+                dispatcher_);
+            HCCL_INFO("allreduce ring: using double-binary-tree algo inter-server.");
         } else {
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_RECURSIVE_HALVING_DOUBLING, dispatcher_);
             HCCL_INFO("allreduce ring: using Recursive halving-doubling algo inter-server.");
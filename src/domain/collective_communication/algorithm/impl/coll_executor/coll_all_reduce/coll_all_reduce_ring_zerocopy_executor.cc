@@ -9,6 +9,7 @@
  */
 
 #include "coll_all_reduce_ring_zerocopy_executor.h"
+#include "asymmetric_hierarchical_concatenate_alg_template_base_pub.h"
 #include "alg_template_register.h"
 
 namespace hccl {
@@ -258,6 +259,14 @@ HcclResult CollAllReduceRingZerocopyExecutor::KernelRunInterServerAllReduceSingl
         }
         CHK_SMART_PTR_NULL(level1TempAlg);
         CHK_RET(level1TempAlg->Prepare(level1DataCount, globalSubGroups, ahcAlgOption));
+        if (workflowMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE && !algResResp_->slaveStreams.empty() &&
+            !algResResp_->notifiesMain.empty() && !algResResp_->notifiesAux.empty()) {
+            // level0阶段结束后从流空闲, 用于AHC组间阶段与相邻分块的组内阶段流水
+            AllReduceAHCBase *ahcTempAlg = dynamic_cast<AllReduceAHCBase *>(level1TempAlg.get());
+            CHK_PTR_NULL(ahcTempAlg);
+            CHK_RET(ahcTempAlg->PreparePipeline(algResResp_->slaveStreams[0], algResResp_->notifiesMain[0],
+                algResResp_->notifiesAux[0]));
+        }
     } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB) {
         level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_NB, 
             dispatcher_);
@@ -11,6 +11,7 @@
 
 #include "coll_all_to_all_v_direct_fullmesh_executor.h"
 #include "stream_utils.h"
+#include "coll_alg_utils.h"
 
 namespace hccl {
 
@@ -18,6 +19,20 @@ CollRunAlltoAllDirectFullmesh::CollRunAlltoAllDirectFullmesh(const HcclDispatche
                                                    std::unique_ptr<TopoMatcher> &topoMatcher)
     : CollAlltoAllExecutor(dispatcher, topoMatcher)
 {
+    desc_.isLazyLink = true;
+}
+
+void CollRunAlltoAllDirectFullmesh::ParseParam(const OpParam& param)
+{
+    CollAlltoAllExecutor::ParseParam(param);
+    lazyLinkPeers_.clear();
+    if (topoMatcher_->GetExternalInputAlltoallvLazyLink() == 0 || !IsAlltoAllLazyLinkOp(param)) {
+        return;
+    }
+    if (GetAlltoAllActivePeers(param, topoAttr_.userRank, topoAttr_.userRankSize, lazyLinkPeers_) != HCCL_SUCCESS) {
+        HCCL_WARNING("[CollRunAlltoAllDirectFullmesh][ParseParam]get active peers failed, fall back to full mesh");
+        lazyLinkPeers_.clear();
+    }
 }
 
 HcclResult CollRunAlltoAllDirectFullmesh::Orchestrate(OpParam& param, AlgResourceResponse& algRes)
@@ -163,6 +178,11 @@ HcclResult CollRunAlltoAllDirectFullmesh::CalcLevel0CommInfo(TransportMemType in
     for (u32 subCommIndex = 0; subCommIndex < commTransportLevel0.size(); subCommIndex++) {
         for (auto &transportRequest : commTransportLevel0[subCommIndex].transportRequests) {
             transportRequest.isUsedRdma = topoAttr_.isUsedRdmaMap.at(transportRequest.remoteUserRank);
+            // 按需建链: 只与本次有数据交互的对端建链, 其余对端在首次有数据时增量建链
+            if (!lazyLinkPeers_.empty() && transportRequest.remoteUserRank < lazyLinkPeers_.size() &&
+                !lazyLinkPeers_[transportRequest.remoteUserRank]) {
+                transportRequest.isValid = false;
+            }
         }
     }
     return HCCL_SUCCESS;
@@ -189,6 +209,18 @@ HcclResult CollRunAlltoAllDirectFullmesh::CalcCommInfo(std::vector<LevelNSubComm
     return HCCL_SUCCESS;
 }
 
+HcclResult CollRunAlltoAllDirectFullmesh::CalcIncreLinkRequest(const OpParam& param,
+    AlgResourceRequest& resourceRequest)
+{
+    ParseParam(param);
+    std::vector<LevelNSubCommTransport> opTransport {
+        std::vector<LevelNSubCommTransport>(static_cast<u32>(COMM_LEVEL_RESERVED))
+    };
+    CHK_RET(CalcCommInfo(opTransport));
+    CHK_RET(BuildResourceRequest(0, 0, 0, false, opTransport, resourceRequest));
+    return HCCL_SUCCESS;
+}
+
 HcclResult CollRunAlltoAllDirectFullmesh::GetLocalSendRecvInfoforAlltoallV(const OpParam &param)
 {
     for (u32 j = 0; j < topoAttr_.userRankSize; j++) {
@@ -19,8 +19,10 @@ public:
 
     HcclResult Orchestrate(OpParam& param, AlgResourceResponse& algRes) override;
     HcclResult GetAdjInfo(AlgResourceResponse& algRes, AdjInfo& adjInfo) override;
+    HcclResult CalcIncreLinkRequest(const OpParam& param, AlgResourceRequest& resourceRequest) override;
 
 private:
+    void ParseParam(const OpParam& param) override;
     HcclOpMetaInfo GetOpMeta(HcclCMDType opType, const u64 size) override;
     HcclResult CalcStreamNum(u32& streamNum) override;
     HcclResult CalcLevel0CommInfo(TransportMemType inputType, TransportMemType outputType,
@@ -38,6 +40,7 @@ private:
     HcclResult GetLocalSDMAGroupInfo(const u32 userRank, u32& devNumInlocalPod, u32& rankIdxInPod);
 
     bool isA2AlltoallvMutliModule_ = false;
+    std::vector<bool> lazyLinkPeers_; // 按需建链时本次算子有数据交互的对端, 为空表示全连接建链
 };
 
 } // namespace hccl
@@ -10,6 +10,7 @@
 
 
 #include "coll_all_to_all_v_fullmesh_executor.h"
+#include "alltoallv_pairwise_pub.h"
 
 namespace hccl {
 
@@ -24,6 +25,10 @@ HcclResult CollRunAlltoAllVFullMesh::CalcStreamNum(u32& streamNum)
     if (SatisfyIntraSuperPod(topoAttr_.deviceType, topoAttr_.userRankSize, topoAttr_.useSuperPodMode,
                              topoAttr_.superPodNum)) {
         streamNum = topoAttr_.userRankSize - 1;
+    } else if (workflowMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE &&
+        topoAttr_.userRankSize / 2 > 1) {
+        // pairwise窗口并发的从流, 步骤成对分组, 组数为userRankSize / 2
+        streamNum = std::min(PAIRWISE_MAX_WINDOW, topoAttr_.userRankSize / 2) - 1;
     } else {
         streamNum = 0;
     }
@@ -32,6 +37,57 @@ HcclResult CollRunAlltoAllVFullMesh::CalcStreamNum(u32& streamNum)
     return HCCL_SUCCESS;
 }
 
+/*
+ * 窗口在各rank上必须一致(决定流分配与scratch分片偏移), 只使用全局一致的信息:
+ * 从流数、scratch大小以及allgather得到的全量收发长度
+ */
+u32 CollRunAlltoAllVFullMesh::CalcPairwiseWindow(u64 scratchMemSize) const
+{
+    u32 groupNum = topoAttr_.userRankSize / 2;
+    u32 window = std::min(PAIRWISE_MAX_WINDOW, static_cast<u32>(algResResp_->slaveStreams.size()) + 1);
+    window = std::min(window, groupNum);
+    window = std::min(window, static_cast<u32>(algResResp_->notifiesMain.size()) + 1);
+    window = std::min(window, static_cast<u32>(algResResp_->notifiesAux.size()) + 1);
+    if (!isAlltoAllZCopyMode_) {
+        window = static_cast<u32>(std::min(static_cast<u64>(window), scratchMemSize / PAIRWISE_MIN_SLOT_SIZE));
+    }
+
+    u64 totalBytes = 0;
+    u64 stepNum = 0;
+    for (u32 rank = 0; rank < allMeshAggregationSendRecvInfo_.size(); rank++) {
+        const std::vector<u64> &sendLength = allMeshAggregationSendRecvInfo_[rank].sendLength;
+        for (u32 peer = 0; peer < sendLength.size(); peer++) {
+            if (peer != rank && sendLength[peer] != 0) {
+                totalBytes += sendLength[peer];
+                stepNum++;
+            }
+        }
+    }
+    u64 avgStepBytes = (stepNum == 0) ? 0 : totalBytes / stepNum;
+    // 跨机时各步都经过网卡, 大步单独即可打满带宽, 更多在途步只会加剧拥塞
+    if (topoAttr_.serverNum > 1 && avgStepBytes >= PAIRWISE_NIC_BOUND_STEP_SIZE) {
+        window = std::min(window, PAIRWISE_NIC_BOUND_WINDOW);
+    }
+    HCCL_INFO("[CollRunAlltoAllVFullMesh][CalcPairwiseWindow]window[%u] avgStepBytes[%llu] serverNum[%u]",
+        window, avgStepBytes, topoAttr_.serverNum);
+    return std::max(window, 1U);
+}
+
+HcclResult CollRunAlltoAllVFullMesh::PreparePairwiseWindow(std::unique_ptr<AlgTemplateBase> &pairWisePtr,
+    u64 scratchMemSize)
+{
+    u32 window = CalcPairwiseWindow(scratchMemSize);
+    if (window <= 1) {
+        return HCCL_SUCCESS;
+    }
+    AlltoAllVPairWise *pairWise = dynamic_cast<AlltoAllVPairWise *>(pairWisePtr.get());
+    CHK_PTR_NULL(pairWise);
+    CHK_RET(pairWise->PrepareWindow(window, algResResp_->slaveStreams, algResResp_->notifiesMain,
+        algResResp_->notifiesAux));
+    CHK_RET(AddSubStreamToProfiling());
+    return HCCL_SUCCESS;
+}
+
 // level0-level1 打平fullmesh
 HcclResult CollRunAlltoAllVFullMesh::CalcLevel0CommInfo(TransportMemType inputType, TransportMemType outputType,
     std::vector<LevelNSubCommTransport>& opTransport)
@@ -164,6 +220,7 @@ HcclResult CollRunAlltoAllVFullMesh::KernelRun(const OpParam &param, ExecMem &ex
         !isAlltoAllZCopyMode_) { // 单算子 && Buffer Copy模式
         CHK_RET(pairWisePtr->Prepare(sendInfo, recvInfo, execMem.inputMem, execMem.outputMem, isAlltoAllZCopyMode_,
             const_cast<Stream&>(param.stream), workflowMode_, rankSendDisplsMap, rankRecvDisplsMap));
+        CHK_RET(PreparePairwiseWindow(pairWisePtr, execMem.inputMem.size()));
         CHK_RET(RunAlltoAllTemplate(pairWisePtr, level0CommInfo));
     } else if (workflowMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE &&
         isAlltoAllZCopyMode_) {
@@ -173,6 +230,7 @@ HcclResult CollRunAlltoAllVFullMesh::KernelRun(const OpParam &param, ExecMem &ex
         CHK_RET(pairWisePtr->Prepare(sendInfo, recvInfo, execMem.inputMem, execMem.outputMem,
             isAlltoAllZCopyMode_, const_cast<Stream&>(param.stream),
             workflowMode_, rankSendDisplsMap, rankRecvDisplsMap));
+        CHK_RET(PreparePairwiseWindow(pairWisePtr, execMem.inputMem.size()));
         CHK_RET(RunAlltoAllTemplate(pairWisePtr, level0CommInfo)); // inputMem_ -> outputMem_
 
         DeviceMem srcMem = execMem.outputMem.range(0, algResResp_->paramOutputMem.size());
@@ -28,6 +28,8 @@ private:
         std::vector<LevelNSubCommTransport>& opTransport);
     HcclResult CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport) override;
     HcclResult KernelRun(const OpParam &param, ExecMem &execMem) override;
+    u32 CalcPairwiseWindow(u64 scratchMemSize) const;
+    HcclResult PreparePairwiseWindow(std::unique_ptr<AlgTemplateBase> &pairWisePtr, u64 scratchMemSize);
 };
 
 } // namespace hccl
@@ -62,6 +62,7 @@ HcclResult CollBroadcastMeshExecutor::KernelRun(const OpParam &param, ExecMem &e
     u32 perDataSize = SIZE_TABLE[param.DataDes.dataType];
 
     bool isUsedRegister = false;
+    PipelinePlan pipelinePlan;
     std::unique_ptr<AlgTemplateBase> level0TempAlg1;
     std::unique_ptr<AlgTemplateBase> level1TempAlg;
     std::unique_ptr<AlgTemplateBase> level0TempAlg2;
@@ -113,6 +114,14 @@ HcclResult CollBroadcastMeshExecutor::KernelRun(const OpParam &param, ExecMem &e
                 TemplateType::TEMPLATE_BROADCAST_NB, dispatcher_);
         }
         HCCL_INFO("broadcast mesh: using nonuniform-bruck algo inter-server.");
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+        isUsedRegister = true;
+        CHK_RET(CalcPipelinePlan(slice[level0CommInfo.localRank].size, level1CommInfo.localRankSize,
+            topoAttr_.userRankSize, topoAttr_.deviceNumPerAggregation, LINK_STATIC_LATENCY_US, pipelinePlan));
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(pipelinePlan.useKnomialTree ?
+            TemplateType::TEMPLATE_BROADCAST_KNOMIAL : TemplateType::TEMPLATE_BROADCAST_CHAIN, dispatcher_);
+        HCCL_INFO("broadcast mesh: using pipelined %s algo inter-server, segmentNum[%u].",
+            pipelinePlan.useKnomialTree ? "k-nomial tree" : "chain", pipelinePlan.segmentNum);
     } else {
         level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
             TemplateType::TEMPLATE_BROADCAST_RECURSIVE_HD, dispatcher_);
@@ -176,6 +185,7 @@ HcclResult CollBroadcastMeshExecutor::KernelRun(const OpParam &param, ExecMem &e
         prepareData.reductionOp = HCCL_REDUCE_RESERVED;
         prepareData.root = subRoot;
         prepareData.baseOffset = slice[level0CommInfo.localRank].offset;
+        prepareData.segmentNum = pipelinePlan.segmentNum;
         CHK_RET(level1TempAlg->Prepare(prepareData));
     } else {
         CHK_RET(level1TempAlg->Prepare(execMem.inputMem, execMem.outputMem, execMem.outputMem, hdCount,
@@ -239,6 +249,10 @@ HcclResult CollBroadcastMeshExecutor::SelectTempAlg(std::unique_ptr<AlgTemplateB
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
                 TemplateType::TEMPLATE_BROADCAST_NB, dispatcher_);
             HCCL_INFO("broadcast mesh: using nonuniform-bruck algo inter-server.");
+        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+                TemplateType::TEMPLATE_BROADCAST_CHAIN, dispatcher_);
+            HCCL_INFO("broadcast mesh: using pipelined chain algo inter-server.");
         } else {
             level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
                 TemplateType::TEMPLATE_BROADCAST_RECURSIVE_HD, dispatcher_);
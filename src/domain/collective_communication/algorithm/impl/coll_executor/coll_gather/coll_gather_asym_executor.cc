@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_gather_asym_executor.h"
+#include <algorithm>
+
+namespace hccl {
+CollGatherAsymExecutor::CollGatherAsymExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollGatherExecutor(dispatcher, topoMatcher)
+{
+}
+
+HcclResult CollGatherAsymExecutor::CalcServerLeaders(u32 root)
+{
+    CHK_RET(topoMatcher_->GetServerToRank(serverToRank_));
+    u32 serverNum = serverToRank_.size();
+    localServerIdx_ = INVALID_VALUE_RANKID;
+    rootServerIdx_ = INVALID_VALUE_RANKID;
+    u32 rootIdxInServer = INVALID_VALUE_RANKID;
+    for (u32 serverIdx = 0; serverIdx < serverNum; serverIdx++) {
+        const std::vector<u32> &userRanks = serverToRank_[serverIdx];
+        CHK_PRT_RET(userRanks.empty() || userRanks.back() - userRanks.front() + 1 != userRanks.size(),
+            HCCL_ERROR("[CollGatherAsymExecutor][CalcServerLeaders]userRanks in server[%u] are not contiguous",
+                serverIdx), HCCL_E_NOT_SUPPORT);
+        if (root >= userRanks.front() && root <= userRanks.back()) {
+            rootServerIdx_ = serverIdx;
+            rootIdxInServer = root - userRanks.front();
+        }
+        if (topoAttr_.userRank >= userRanks.front() && topoAttr_.userRank <= userRanks.back()) {
+            localServerIdx_ = serverIdx;
+        }
+    }
+    CHK_PRT_RET(rootServerIdx_ == INVALID_VALUE_RANKID || localServerIdx_ == INVALID_VALUE_RANKID,
+        HCCL_ERROR("[CollGatherAsymExecutor][CalcServerLeaders]root[%u] or userRank[%u] is not found in servers",
+            root, topoAttr_.userRank), HCCL_E_INTERNAL);
+
+    // 代表rank尽量与root同server内序号, 使server间的流量落在与root同平面的网卡上
+    leaders_.resize(serverNum);
+    for (u32 serverIdx = 0; serverIdx < serverNum; serverIdx++) {
+        const std::vector<u32> &userRanks = serverToRank_[serverIdx];
+        u32 idxInServer = std::min<u32>(rootIdxInServer, userRanks.size() - 1);
+        leaders_[serverIdx] = (serverIdx == rootServerIdx_) ? root : userRanks[idxInServer];
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport)
+{
+    TransportMemType inputType = TransportMemType::RESERVED;
+    TransportMemType outputType = TransportMemType::RESERVED;
+    CHK_RET(CalcServerLeaders(root_));
+    CHK_RET(CalcTransportMemType(inputType, outputType));
+    CHK_RET(CalcLevel0CommInfo(inputType, outputType, opTransport));
+    CHK_RET(CalcLeaderCommInfo(inputType, outputType, opTransport));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::CalcLevel0CommInfo(TransportMemType inputType,
+    TransportMemType outputType,
+    std::vector<LevelNSubCommTransport>& opTransport)
+{
+    CommParaInfo commParaLevel0(COMM_LEVEL0, CommType::COMM_TAG_MESH);
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaLevel0, opTransport[COMM_LEVEL0], inputType, outputType));
+    HCCL_INFO("[CollGatherAsymExecutor][CalcLevel0CommInfo]tag[%s] Calc meshComm finish", tag_.c_str());
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::CalcLeaderCommInfo(TransportMemType inputType,
+    TransportMemType outputType,
+    std::vector<LevelNSubCommTransport>& opTransport)
+{
+    // server间没有按代表rank划分的平面, 在全量平面上只保留代表rank之间需要的链路
+    CommParaInfo commParaInfo(COMM_COMBINE_ORDER, CommType::COMM_TAG_MESH);
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaInfo, opTransport[COMM_COMBINE_ORDER], inputType, outputType));
+
+    u32 leaderNum = leaders_.size();
+    bool isLeader = leaders_[localServerIdx_] == topoAttr_.userRank;
+    for (auto &subCommTransport : opTransport[COMM_COMBINE_ORDER]) {
+        for (auto &transportRequest : subCommTransport.transportRequests) {
+            if (!transportRequest.isValid) {
+                continue;
+            }
+            transportRequest.isValid = isLeader && IsLeaderPeer(transportRequest.remoteUserRank);
+        }
+    }
+    HCCL_INFO("[CollGatherAsymExecutor][CalcLeaderCommInfo]tag[%s] leaderNum[%u] isLeader[%d]",
+        tag_.c_str(), leaderNum, isLeader);
+    return HCCL_SUCCESS;
+}
+
+bool CollGatherAsymExecutor::IsLeaderPeer(u32 remoteUserRank) const
+{
+    u32 leaderNum = leaders_.size();
+    if (leaderNum <= 1) {
+        return false;
+    }
+    // STAR: root与其余代表rank互连; RING: 与环上相邻的代表rank互连
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_STAR) {
+        u32 root = leaders_[rootServerIdx_];
+        bool isRemoteLeader = std::find(leaders_.begin(), leaders_.end(), remoteUserRank) != leaders_.end();
+        return (topoAttr_.userRank == root) ? isRemoteLeader : (remoteUserRank == root);
+    }
+    return remoteUserRank == leaders_[(localServerIdx_ + leaderNum - 1) % leaderNum] ||
+        remoteUserRank == leaders_[(localServerIdx_ + 1) % leaderNum];
+}
+
+HcclResult CollGatherAsymExecutor::CalcStreamNum(u32& streamNum)
+{
+    // server代表rank需要(本server卡数-2)条从流收数, 按最大的server申请, 另加一条拷出从流
+    CHK_RET(CalcServerLeaders(root_));
+    u32 maxServerSize = 0;
+    for (const auto &userRanks : serverToRank_) {
+        maxServerSize = std::max<u32>(maxServerSize, userRanks.size());
+    }
+    CHK_RET(CollGatherExecutor::CalcStreamNum(streamNum));
+    streamNum += (maxServerSize > 2U) ? (maxServerSize - 2U) : 0U;
+    HCCL_INFO("[CollGatherAsymExecutor][CalcStreamNum] tag[%s] streamNum[%u]", tag_.c_str(), streamNum);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::KernelRunLeaderRing(const OpParam &param, ExecMem &execMem)
+{
+    Stream& stream = const_cast<Stream&>(param.stream);
+    u64 curSize = execMem.count * SIZE_TABLE[param.DataDes.dataType];
+    u32 leaderNum = leaders_.size();
+    // 以代表rank构造环, 环上序号为server序号, 只需要左右相邻代表rank的链路
+    SubCommInfo leaderCommInfo;
+    leaderCommInfo.localRank = localServerIdx_;
+    leaderCommInfo.localRankSize = leaderNum;
+    leaderCommInfo.links.assign(leaderNum, nullptr);
+    for (u32 serverIdx : { (localServerIdx_ + leaderNum - 1) % leaderNum, (localServerIdx_ + 1) % leaderNum }) {
+        CHK_RET(GetLeaderLink(leaders_[serverIdx], leaderCommInfo.links[serverIdx]));
+    }
+
+    // 第i个代表rank的数据块为server i内全部rank的数据, 大小随server卡数变化
+    std::vector<Slice> dataSlice(leaderNum);
+    for (u32 serverIdx = 0; serverIdx < leaderNum; serverIdx++) {
+        dataSlice[serverIdx].offset = bufferOffset_ + curSize * serverToRank_[serverIdx].front();
+        dataSlice[serverIdx].size = curSize * serverToRank_[serverIdx].size();
+    }
+
+    std::unique_ptr<AlgTemplateBase> tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+        TemplateType::TEMPLATE_GATHER_RING, dispatcher_);
+    CHK_SMART_PTR_NULL(tempAlg);
+    CHK_RET(tempAlg->Prepare(execMem.inputMem, execMem.inputMem, execMem.inputMem,
+        execMem.count * topoAttr_.userRankSize, param.DataDes.dataType, stream, HCCL_REDUCE_RESERVED,
+        rootServerIdx_, dataSlice));
+    CHK_RET(tempAlg->RegisterProfiler((leaderNum << PROF_RANKSIZE_OFFSET_OF_PLANEID) + localServerIdx_,
+        PROF_STAGE_1, HCCL_EXEC_STEP_NOT_SET, stream));
+    CHK_RET(RunTemplate(tempAlg, leaderCommInfo));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::GetLeaderLink(u32 userRank, LINK &link)
+{
+    SubCommInfo combinedCommInfo = GetSubCommInfo(COMM_COMBINE_ORDER, COMM_INDEX_0);
+    u32 combinedRank = 0;
+    CHK_RET(GetRankByUserRank(COMM_COMBINE_ORDER, COMM_INDEX_0, userRank, combinedRank));
+    CHK_PRT_RET(combinedRank >= combinedCommInfo.links.size(),
+        HCCL_ERROR("[CollGatherAsymExecutor][GetLeaderLink]rank[%u] of userRank[%u] is out of range[%zu]",
+            combinedRank, userRank, combinedCommInfo.links.size()), HCCL_E_INTERNAL);
+    link = combinedCommInfo.links[combinedRank];
+    CHK_SMART_PTR_NULL(link);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::KernelRunLeaderStar(const OpParam &param, ExecMem &execMem)
+{
+    Stream& stream = const_cast<Stream&>(param.stream);
+    u64 curSize = execMem.count * SIZE_TABLE[param.DataDes.dataType];
+    u32 root = leaders_[rootServerIdx_];
+    if (topoAttr_.userRank != root) {
+        // 本server的数据块直接写到root CCL buffer的同一偏移
+        LINK link;
+        CHK_RET(GetLeaderLink(root, link));
+        u64 offset = bufferOffset_ + curSize * serverToRank_[localServerIdx_].front();
+        u64 size = curSize * serverToRank_[localServerIdx_].size();
+        DeviceMem src = execMem.inputMem.range(offset, size);
+        CHK_RET(link->RxAck(stream));
+        CHK_RET(link->TxAsync(UserMemType::OUTPUT_MEM, offset, src.ptr(), size, stream));
+        CHK_RET(link->TxWaitDone(stream));
+        return HCCL_SUCCESS;
+    }
+
+    // root先通知全部代表rank可写, 各server的数据并发到达后再逐个确认
+    std::vector<LINK> leaderLinks(leaders_.size());
+    for (u32 serverIdx = 0; serverIdx < leaders_.size(); serverIdx++) {
+        if (serverIdx == rootServerIdx_) {
+            continue;
+        }
+        CHK_RET(GetLeaderLink(leaders_[serverIdx], leaderLinks[serverIdx]));
+        CHK_RET(leaderLinks[serverIdx]->TxAck(stream));
+    }
+    for (u32 serverIdx = 0; serverIdx < leaders_.size(); serverIdx++) {
+        if (serverIdx == rootServerIdx_) {
+            continue;
+        }
+        u64 offset = bufferOffset_ + curSize * serverToRank_[serverIdx].front();
+        u64 size = curSize * serverToRank_[serverIdx].size();
+        DeviceMem dst = execMem.inputMem.range(offset, size);
+        CHK_RET(leaderLinks[serverIdx]->RxAsync(UserMemType::OUTPUT_MEM, offset, dst.ptr(), size, stream));
+        CHK_RET(leaderLinks[serverIdx]->RxWaitDone(stream));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherAsymExecutor::KernelRun(const OpParam &param, ExecMem &execMem)
+{
+    HCCL_CONFIG_INFO(HCCL_ALG, "[CollGatherAsymExecutor] gather starts.");
+    Stream& stream = const_cast<Stream&>(param.stream);
+    u64 curSize = execMem.count * SIZE_TABLE[param.DataDes.dataType];
+    CHK_RET(CalcServerLeaders(param.root));
+    u32 leader = leaders_[localServerIdx_];
+
+    /* ***********第一步: 节点内gather到server代表rank*****************************/
+    SubCommInfo level0CommInfo = GetSubCommInfo(COMM_LEVEL0, COMM_INDEX_0);
+    u32 level0LocalRankSize = level0CommInfo.localRankSize;
+    if (level0LocalRankSize > 1) {
+        u32 leaderRankLevel0 = 0;
+        CHK_RET(GetRankByUserRank(COMM_LEVEL0, COMM_INDEX_0, leader, leaderRankLevel0));
+        CHK_PRT_RET(leaderRankLevel0 >= level0LocalRankSize,
+            HCCL_ERROR("[CollGatherAsymExecutor][KernelRun]leader[%u] rank[%u] is invalid in level0",
+                leader, leaderRankLevel0), HCCL_E_INTERNAL);
+
+        // level0成员的数据在CCL buffer中位于其userRank对应的偏移
+        std::vector<Slice> dataSegsSlice(level0LocalRankSize);
+        for (u32 userRank : serverToRank_[localServerIdx_]) {
+            u32 level0Rank = 0;
+            CHK_RET(GetRankByUserRank(COMM_LEVEL0, COMM_INDEX_0, userRank, level0Rank));
+            CHK_PRT_RET(level0Rank >= level0LocalRankSize,
+                HCCL_ERROR("[CollGatherAsymExecutor][KernelRun]userRank[%u] rank[%u] is invalid in level0",
+                    userRank, level0Rank), HCCL_E_INTERNAL);
+            dataSegsSlice[level0Rank].offset = bufferOffset_ + curSize * userRank;
+            dataSegsSlice[level0Rank].size = curSize;
+        }
+
+        std::unique_ptr<AlgTemplateBase> level0TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_GATHER_MESH, dispatcher_);
+        CHK_SMART_PTR_NULL(level0TempAlg);
+        CHK_RET(level0TempAlg->Prepare(algResResp_->slaveStreams,
+            algResResp_->notifiesMain, algResResp_->notifiesAux, topoAttr_.userRank));
+        CHK_RET(level0TempAlg->Prepare(execMem.inputMem, execMem.inputMem, execMem.inputMem,
+            execMem.count * level0LocalRankSize, param.DataDes.dataType, stream, HCCL_REDUCE_RESERVED,
+            leaderRankLevel0, dataSegsSlice));
+        CHK_RET(level0TempAlg->RegisterProfiler(
+            (level0LocalRankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + level0CommInfo.localRank,
+            PROF_STAGE_0, HCCL_EXEC_STEP_NOT_SET, stream));
+        HcclResult ret = RunTemplate(level0TempAlg, level0CommInfo);
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[CollGatherAsymExecutor][KernelRun]gather(mesh) RunTemplate failed,return[%d]", ret), ret);
+    }
+
+    /* ***********第二步: 节点间server代表rank gather到root****************************/
+    if (leader == topoAttr_.userRank && leaders_.size() > 1) {
+        if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_STAR) {
+            CHK_RET(KernelRunLeaderStar(param, execMem));
+        } else {
+            CHK_RET(KernelRunLeaderRing(param, execMem));
+        }
+    }
+    return HCCL_SUCCESS;
+}
+
+REGISTER_EXEC("GatherAsymExecutor", GatherAsym, CollGatherAsymExecutor);
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef COLL_GATHER_ASYM_EXECUTOR_H
+#define COLL_GATHER_ASYM_EXECUTOR_H
+
+#include "coll_gather_executor.h"
+#include "coll_alg_exec_registry.h"
+
+namespace hccl {
+
+/*
+ * 支持server内卡数不一致的分层gather: server内mesh汇聚到server代表rank, 代表rank在server间汇聚到root。
+ * root所在server的代表rank为root, 其余server取与root同server内序号的rank, 该序号不存在时取server内最后一个rank。
+ * server间algoLevel1为STAR时各代表rank直接发给root, 否则代表rank成环逐跳汇聚到root。
+ * 要求同server的userRank连续, 各server的数据块在CCL buffer中按userRank连续排布, 大小随server卡数变化。
+ */
+class CollGatherAsymExecutor : public CollGatherExecutor {
+public:
+    explicit CollGatherAsymExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~CollGatherAsymExecutor() = default;
+protected:
+    /* *************** 资源计算 *************** */
+    HcclResult CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport) override;
+    HcclResult CalcLevel0CommInfo(TransportMemType inputType,
+        TransportMemType outputType,
+        std::vector<LevelNSubCommTransport>& opTransport) override;
+    HcclResult CalcLeaderCommInfo(TransportMemType inputType,
+        TransportMemType outputType,
+        std::vector<LevelNSubCommTransport>& opTransport);
+    HcclResult CalcStreamNum(u32& streamNum) override;
+
+    /* *************** 算法编排 *************** */
+    HcclResult KernelRun(const OpParam &param, ExecMem &execMem) override;
+private:
+    HcclResult CalcServerLeaders(u32 root);
+    HcclResult KernelRunLeaderRing(const OpParam &param, ExecMem &execMem);
+    HcclResult KernelRunLeaderStar(const OpParam &param, ExecMem &execMem);
+    bool IsLeaderPeer(u32 remoteUserRank) const;
+    HcclResult GetLeaderLink(u32 userRank, LINK &link);
+
+    std::vector<std::vector<u32>> serverToRank_; // 按server划分的userRank, server内升序
+    std::vector<u32> leaders_;                   // 各server的代表rank
+    u32 localServerIdx_{0};
+    u32 rootServerIdx_{0};
+};
+
+} // namespace hccl
+
+#endif
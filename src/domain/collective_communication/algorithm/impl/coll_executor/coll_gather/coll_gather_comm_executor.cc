@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_gather_comm_executor.h"
+
+namespace hccl {
+CollGatherCommExecutor::CollGatherCommExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollGatherExecutor(dispatcher, topoMatcher)
+{
+}
+
+CommPlane CollGatherCommExecutor::GetCombinedCommPlane() const
+{
+    return (topoAttr_.deviceType == DevType::DEV_TYPE_910_93) ? COMM_COMBINE_ORDER : COMM_COMBINE;
+}
+
+HcclResult CollGatherCommExecutor::KernelRun(const OpParam &param, ExecMem &execMem)
+{
+    HCCL_CONFIG_INFO(HCCL_ALG, "[CollGatherCommExecutor] gather starts.");
+    Stream& stream = const_cast<Stream&>(param.stream);
+    // 统一走server间, 每个rank在CCL buffer中持有自己的一份数据
+    CHK_RET(KernelRunGatherRing(execMem.inputMem, execMem.count, param.DataDes.dataType, GetCombinedCommPlane(),
+        COMM_INDEX_0, param.root, 1, stream));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherCommExecutor::CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport)
+{
+    TransportMemType inputType = TransportMemType::RESERVED;
+    TransportMemType outputType = TransportMemType::RESERVED;
+    CHK_RET(CalcTransportMemType(inputType, outputType));
+    CHK_RET(CalcCombinedCommInfo(inputType, outputType, opTransport));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherCommExecutor::CalcCombinedCommInfo(TransportMemType inputType,
+    TransportMemType outputType,
+    std::vector<LevelNSubCommTransport>& opTransport)
+{
+    CommPlane commPlane = GetCombinedCommPlane();
+    CommParaInfo commParaInfo(commPlane, CommType::COMM_TAG_RING_INNER);
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaInfo, opTransport[commPlane], inputType, outputType));
+    return HCCL_SUCCESS;
+}
+
+REGISTER_EXEC("GatherCommExecutor", GatherComm, CollGatherCommExecutor);
+
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef COLL_GATHER_COMM_EXECUTOR_H
+#define COLL_GATHER_COMM_EXECUTOR_H
+
+#include "coll_gather_executor.h"
+#include "coll_alg_exec_registry.h"
+
+namespace hccl {
+
+// 所有rank成一个环gather到root, 用于非mesh拓扑或无法按server分层的场景
+class CollGatherCommExecutor : public CollGatherExecutor {
+public:
+    explicit CollGatherCommExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~CollGatherCommExecutor() = default;
+protected:
+    /* *************** 资源计算 *************** */
+    HcclResult CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport) override;
+    HcclResult CalcCombinedCommInfo(TransportMemType inputType,
+        TransportMemType outputType,
+        std::vector<LevelNSubCommTransport>& opTransport);
+
+    /* *************** 算法编排 *************** */
+    HcclResult KernelRun(const OpParam &param, ExecMem &execMem) override;
+private:
+    CommPlane GetCombinedCommPlane() const;
+};
+
+} // namespace hccl
+
+#endif
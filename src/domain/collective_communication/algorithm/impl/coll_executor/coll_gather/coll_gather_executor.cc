@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_gather_executor.h"
+#include "executor_impl.h"
+#include "device_capacity.h"
+#include "coll_alg_operator.h"
+
+namespace hccl {
+CollGatherExecutor::CollGatherExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollCommExecutor(dispatcher, topoMatcher)
+{
+}
+
+HcclResult CollGatherExecutor::CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport)
+{
+    TransportMemType inputType = TransportMemType::RESERVED;
+    TransportMemType outputType = TransportMemType::RESERVED;
+    CHK_RET(CalcTransportMemType(inputType, outputType));
+    CHK_RET(CalcLevel0CommInfo(inputType, outputType, opTransport));
+    CHK_RET(CalcLevel1CommInfo(inputType, outputType, opTransport));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::CalcTransportMemType(TransportMemType &inputType, TransportMemType &outputType)
+{
+    // 各rank的数据都在CCL input中按userRank排布, 对端直接写入同一偏移
+    if (workflowMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        inputType = TransportMemType::CCL_INPUT;
+        outputType = TransportMemType::CCL_INPUT;
+    } else {
+        inputType = TransportMemType::PARAM_INPUT;
+        outputType = TransportMemType::PARAM_INPUT;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::CalcStreamNum(u32& streamNum)
+{
+    // 单算子模式下root使用一条从流把上一轮数据拷出到user out
+    streamNum = (workflowMode_ == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) ? 1U : 0U;
+    HCCL_INFO("[CollGatherExecutor][CalcStreamNum] tag[%s] streamNum[%u]", tag_.c_str(), streamNum);
+    return HCCL_SUCCESS;
+}
+
+bool CollGatherExecutor::IsHugeData(u64 curSize)
+{
+    bool hugeData = curSize * topoAttr_.userRankSize / HCCL_INTERNODE_MAX_DATA_RATE > RDMA_SEND_MAX_SIZE ||
+        curSize > SDMA_SEND_MAX_SIZE;
+    return hugeData;
+}
+
+HcclResult CollGatherExecutor::CalcCountPerLoop(u64 totalCount, u32 unitSize, u64 cclSize, u64 &countPerLoop,
+    bool &doubleBuffer)
+{
+    u32 rankSize = topoAttr_.userRankSize;
+    u64 maxCountPerLoop = cclSize / rankSize / HCCL_MIN_SLICE_ALIGN * HCCL_MIN_SLICE_ALIGN / unitSize;
+    doubleBuffer = false;
+    // 单轮放不下时把CCL buffer分成两个分区交替使用, 各rank的buffer大小一致, 切分结果也一致
+    if (totalCount > maxCountPerLoop) {
+        u64 halfCountPerLoop = cclSize / GATHER_CCL_BUFFER_NUM / rankSize / HCCL_MIN_SLICE_ALIGN *
+            HCCL_MIN_SLICE_ALIGN / unitSize;
+        if (halfCountPerLoop > 0) {
+            maxCountPerLoop = halfCountPerLoop;
+            doubleBuffer = true;
+        }
+    }
+    CHK_PRT_RET(maxCountPerLoop == 0, HCCL_ERROR("[CollGatherExecutor][CalcCountPerLoop]cclSize[%llu] is too small "
+        "for rankSize[%u]", cclSize, rankSize), HCCL_E_PARA);
+    countPerLoop = maxCountPerLoop;
+    HCCL_DEBUG("[CollGatherExecutor][CalcCountPerLoop]tag[%s], totalCount[%llu], countPerLoop[%llu], "
+        "doubleBuffer[%d]", tag_.c_str(), totalCount, countPerLoop, doubleBuffer);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::CopyOutOnRoot(const OpParam &param, ExecMem &execMem, u64 loopOffset,
+    Stream &stream)
+{
+    u32 unitSize = SIZE_TABLE[param.DataDes.dataType];
+    u64 totalSize = param.DataDes.count * unitSize;
+    u64 curSize = execMem.count * unitSize;
+    u8 *outputPtr = static_cast<u8 *>(execMem.outputPtr);
+
+    DeviceMem srcMem;
+    DeviceMem dstMem;
+    if (curSize == totalSize) {
+        // 只有一轮时user out与CCL buffer排布相同, 一次拷出
+        srcMem = execMem.inputMem.range(bufferOffset_, totalSize * topoAttr_.userRankSize);
+        dstMem = DeviceMem::create(outputPtr, totalSize * topoAttr_.userRankSize);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, stream));
+        return HCCL_SUCCESS;
+    }
+    for (u32 i = 0; i < topoAttr_.userRankSize; i++) {
+        // root自身的数据已直接拷到user out
+        if (i == topoAttr_.userRank) {
+            continue;
+        }
+        srcMem = execMem.inputMem.range(bufferOffset_ + curSize * i, curSize);
+        dstMem = DeviceMem::create(outputPtr + totalSize * i + loopOffset, curSize);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, stream));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::RunLoop(OpParam &param, AlgResourceResponse &algRes)
+{
+    auto dataType = param.DataDes.dataType;
+    u32 unitSize = SIZE_TABLE[dataType];
+    RankId root = param.root;
+    Stream &stream = param.stream;
+    bool isRoot = topoAttr_.userRank == root;
+
+    u64 totalCount = param.DataDes.count;
+    u64 totalSize = totalCount * unitSize;
+    u8 *curUserInputPtr = static_cast<u8 *>(param.inputPtr);
+    u8 *userOutputPtr = static_cast<u8 *>(param.outputPtr);
+    CHK_PTR_NULL(curUserInputPtr);
+    if (isRoot) {
+        CHK_PTR_NULL(userOutputPtr);
+    }
+
+    DeviceMem &cclMem = algRes.cclInputMem;
+    u64 countPerLoop = 0;
+    bool doubleBuffer = false;
+    CHK_RET(CalcCountPerLoop(totalCount, unitSize, cclMem.size(), countPerLoop, doubleBuffer));
+    u64 bufferSize = doubleBuffer ? (cclMem.size() / GATHER_CCL_BUFFER_NUM) : cclMem.size();
+
+    // 双buffer时root在从流上拷出本轮数据, 与下一轮在另一分区的收数并行
+    bool asyncCopyOut = isRoot && doubleBuffer;
+    u32 copyStreamIndex = 0;
+    if (asyncCopyOut) {
+        CHK_PRT_RET(algRes.slaveStreams.empty() || algRes.notifiesMain.size() < algRes.slaveStreams.size() ||
+            algRes.notifiesAux.size() < algRes.slaveStreams.size(),
+            HCCL_ERROR("[CollGatherExecutor][RunLoop]no stream for copy out, streamNum[%zu]",
+                algRes.slaveStreams.size()), HCCL_E_INTERNAL);
+        copyStreamIndex = algRes.slaveStreams.size() - 1;
+    }
+    HCCL_DEBUG("[CollGatherExecutor][RunLoop]tag[%s], userRankSize[%u], root[%u], countPerLoop[%llu], "
+        "totalCount[%llu], bufferSize[%llu]", tag_.c_str(), topoAttr_.userRankSize, root, countPerLoop,
+        totalCount, bufferSize);
+
+    u32 loop = 0;
+    for (u64 countLeft = totalCount, curCount = 0, loopOffset = 0; countLeft > 0;
+        countLeft -= curCount, loopOffset += curCount * unitSize, loop++) {
+        curCount = (countLeft > countPerLoop) ? countPerLoop : countLeft;
+        u64 curSize = curCount * unitSize;
+        bool isLastLoop = curCount == countLeft;
+        bufferOffset_ = doubleBuffer ? (bufferSize * (loop % GATHER_CCL_BUFFER_NUM)) : 0;
+
+        auto meta = HcclOpMetaInfo::GetOneForGather(root, IsHugeData(curSize));
+        CHK_RET(InitTask(dispatcher_, stream, meta.isEnableCache, meta.GetCacheKey()));
+
+        // 本rank数据拷入CCL buffer中userRank对应的位置; 多轮时root直接拷到user out
+        DeviceMem srcMem = DeviceMem::create(curUserInputPtr + loopOffset, curSize);
+        DeviceMem dstMem = cclMem.range(bufferOffset_ + curSize * topoAttr_.userRank, curSize);
+        if (isRoot && curSize != totalSize) {
+            dstMem = DeviceMem::create(userOutputPtr + totalSize * topoAttr_.userRank + loopOffset, curSize);
+        }
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, stream));
+
+        ExecMem execMem;
+        execMem.count = curCount;
+        execMem.inputMem = cclMem;
+        execMem.outputMem = cclMem;
+        execMem.scratchMem = algRes.scratchMem;
+        execMem.inputPtr = curUserInputPtr + loopOffset;
+        execMem.outputPtr = userOutputPtr;
+
+        HcclResult ret = KernelRun(param, execMem);
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[CollGatherExecutor][RunLoop]errNo[0x%016llx] OP_BASE hcclComm gather error, tag[%s], "
+                "loop[%u], curSize[%llu], bufferOffset[%llu], data_type[%d], root[%u]",
+                HCCL_ERROR_CODE(ret), tag_.c_str(), loop, curSize, bufferOffset_, dataType, root), ret);
+
+        if (asyncCopyOut) {
+            Stream &copyStream = algRes.slaveStreams[copyStreamIndex];
+            if (loop > 0) {
+                // 上一轮拷出完成后, 其分区才能在下一轮复用
+                CHK_RET(LocalNotify::Wait(stream, dispatcher_, algRes.notifiesMain[copyStreamIndex],
+                    INVALID_VALUE_STAGE));
+            }
+            CHK_RET(LocalNotify::Post(stream, dispatcher_, algRes.notifiesAux[copyStreamIndex],
+                INVALID_VALUE_STAGE));
+            CHK_RET(LocalNotify::Wait(copyStream, dispatcher_, algRes.notifiesAux[copyStreamIndex],
+                INVALID_VALUE_STAGE));
+            CHK_RET(CopyOutOnRoot(param, execMem, loopOffset, copyStream));
+            CHK_RET(LocalNotify::Post(copyStream, dispatcher_, algRes.notifiesMain[copyStreamIndex],
+                INVALID_VALUE_STAGE));
+            if (isLastLoop) {
+                CHK_RET(LocalNotify::Wait(stream, dispatcher_, algRes.notifiesMain[copyStreamIndex],
+                    INVALID_VALUE_STAGE));
+            }
+        } else if (isRoot) {
+            CHK_RET(CopyOutOnRoot(param, execMem, loopOffset, stream));
+        }
+        CHK_RET(LaunchTaskExtend(dispatcher_, stream, algRes.slaveStreams));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::KernelRunGatherRing(DeviceMem &cclMem, u64 count, HcclDataType dataType,
+    CommPlane commLevel, u32 commIndex, u32 root, u32 slotNum, Stream &stream)
+{
+    CHK_RET(CheckCommSize(commLevel, commIndex + 1));
+    SubCommInfo subCommInfo = GetSubCommInfo(commLevel, commIndex);
+    u32 subCommSize = subCommInfo.localRankSize;
+    if (subCommSize <= 1) {
+        return HCCL_SUCCESS;
+    }
+
+    u32 rootRank = 0;
+    CHK_RET(GetRankByUserRank(commLevel, commIndex, root, rootRank));
+    CHK_PRT_RET(rootRank == INVALID_VALUE_RANKID,
+        HCCL_ERROR("[CollGatherExecutor][KernelRunGatherRing]root[%u] is not in commLevel[%d] commIndex[%u]",
+            root, commLevel, commIndex), HCCL_E_INTERNAL);
+
+    // 第i个成员的数据块为其持有的slotNum个rank的数据, 在CCL buffer中连续
+    u64 blockSize = count * SIZE_TABLE[dataType] * slotNum;
+    std::vector<Slice> dataSlice(subCommSize);
+    for (u32 i = 0; i < subCommSize; i++) {
+        dataSlice[i].offset = bufferOffset_ + blockSize * i;
+        dataSlice[i].size = blockSize;
+    }
+
+    std::unique_ptr<AlgTemplateBase> tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+        TemplateType::TEMPLATE_GATHER_RING, dispatcher_);
+    CHK_SMART_PTR_NULL(tempAlg);
+    CHK_RET(tempAlg->Prepare(cclMem, cclMem, cclMem, count * slotNum * subCommSize, dataType, stream,
+        HCCL_REDUCE_RESERVED, rootRank, dataSlice));
+    CHK_RET(tempAlg->RegisterProfiler((subCommSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + subCommInfo.localRank,
+        PROF_STAGE_1, HCCL_EXEC_STEP_NOT_SET, stream));
+    CHK_RET(RunTemplate(tempAlg, subCommInfo));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherExecutor::Orchestrate(OpParam& param, AlgResourceResponse& algRes)
+{
+    HcclUs startut = TIME_NOW();
+    tag_ = param.tag;
+    algResResp_ = &algRes;
+    CHK_PRT_RET(workflowMode_ != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE,
+        HCCL_ERROR("[CollGatherExecutor][Orchestrate]gather executor only supports op base mode"),
+        HCCL_E_NOT_SUPPORT);
+    HCCL_PROFILER_ADD_TAG(param.tag, algoAttr_.identifier, workflowMode_);
+    HCCL_PROFILER_ADD_STREAM_BY_STREAMID(param.stream.id(), param.tag, 0, algType_);
+    HCCL_PROFILER_ADD_OPDATA_OP(param.tag, param.DataDes.count, param.inputPtr, param.outputPtr,
+        param.DataDes.dataType, param.root, algoAttr_.identifier, param.reduceType);
+    HCCL_PROFILER_ADD_GROUPRANK(algoAttr_.identifier, topoAttr_.userRankSize, topoAttr_.userRank);
+    CHK_RET(AddSubStreamToProfiling());
+
+    HcclResult ret = HCCL_SUCCESS;
+    if (topoAttr_.userRankSize == 1) {
+        ExecMem execMem;
+        execMem.count = param.DataDes.count;
+        execMem.inputPtr = param.inputPtr;
+        execMem.outputPtr = param.outputPtr;
+        ret = KernelRun(param, execMem);
+    } else {
+        ret = RunLoop(param, algRes);
+    }
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[CollGatherExecutor][Orchestrate]errNo[0x%016llx]gather excutor kernel run failed",
+            HCCL_ERROR_CODE(ret)), ret);
+
+    if (!is310P3Common_) {
+        HCCL_PROFILER_DEL_STREAM_BY_STREAMID(param.stream.id());
+        HCCL_PROFILER_DEL_TAG(param.tag);
+        HCCL_PROFILER_DEL_OPDATA(param.tag);
+        HCCL_PROFILER_DEL_GROUPRANK(algoAttr_.identifier);
+    }
+    HCCL_INFO("tag[%s] Gather executor orchestrate success, take time [%lld]us.",
+        param.tag.c_str(), DURATION_US(TIME_NOW() - startut));
+    return HCCL_SUCCESS;
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef COLL_GATHER_EXECUTOR_H
+#define COLL_GATHER_EXECUTOR_H
+
+#include "coll_comm_executor.h"
+#include "coll_alg_exec_registry.h"
+
+namespace hccl {
+constexpr u32 GATHER_CCL_BUFFER_NUM = 2; // 双buffer: 下一轮收数与root上一轮拷出并行
+
+// 所有 Gather Executor 的基类
+class CollGatherExecutor : public CollCommExecutor {
+public:
+    explicit CollGatherExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~CollGatherExecutor() = default;
+
+    HcclResult Orchestrate(OpParam& param, AlgResourceResponse& algRes) override;
+protected:
+    /* *************** 资源计算 *************** */
+    HcclResult CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport) override;
+    virtual HcclResult CalcTransportMemType(TransportMemType &inputType, TransportMemType &outputType);
+    HcclResult CalcStreamNum(u32& streamNum) override;
+
+    /* *************** 算法编排 *************** */
+    // 在commLevel上以ring汇聚到root, 每个成员在CCL buffer中持有slotNum个连续的rank数据
+    HcclResult KernelRunGatherRing(DeviceMem &cclMem, u64 count, HcclDataType dataType, CommPlane commLevel,
+        u32 commIndex, u32 root, u32 slotNum, Stream &stream);
+    // 用于需要Loop的Executor
+    virtual HcclResult RunLoop(OpParam &param, AlgResourceResponse &algRes);
+    HcclResult CalcCountPerLoop(u64 totalCount, u32 unitSize, u64 cclSize, u64 &countPerLoop, bool &doubleBuffer);
+    HcclResult CopyOutOnRoot(const OpParam &param, ExecMem &execMem, u64 loopOffset, Stream &stream);
+
+    virtual bool IsHugeData(u64 curSize);
+
+    u64 bufferOffset_{0}; // 当前轮次使用的CCL buffer分区的起始偏移, 各rank一致
+private:
+};
+
+} // namespace hccl
+
+#endif
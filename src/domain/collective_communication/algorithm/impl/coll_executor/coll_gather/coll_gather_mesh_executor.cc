@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_gather_mesh_executor.h"
+
+namespace hccl {
+CollGatherMeshExecutor::CollGatherMeshExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollGatherExecutor(dispatcher, topoMatcher)
+{
+}
+
+HcclResult CollGatherMeshExecutor::CalcLevel0CommInfo(TransportMemType inputType,
+    TransportMemType outputType,
+    std::vector<LevelNSubCommTransport>& opTransport)
+{
+    HCCL_INFO("[CollGatherMeshExecutor][CalcLevel0CommInfo]tag[%s] start", tag_.c_str());
+    CommParaInfo commParaLevel0(COMM_LEVEL0, CommType::COMM_TAG_MESH);
+
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaLevel0, opTransport[COMM_LEVEL0], inputType, outputType));
+    HCCL_INFO("[CollGatherMeshExecutor][CalcLevel0CommInfo]tag[%s] Calc meshComm finish", tag_.c_str());
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherMeshExecutor::CalcStreamNum(u32& streamNum)
+{
+    // GatherMesh的root需要(server内rank数-2)条从流收数, 另加一条拷出从流
+    u32 meshStreamNum = topoAttr_.deviceNumPerAggregation > 2U ? topoAttr_.deviceNumPerAggregation - 2U : 0U;
+    CHK_RET(CollGatherExecutor::CalcStreamNum(streamNum));
+    streamNum += meshStreamNum;
+    HCCL_INFO("[CollGatherMeshExecutor][CalcStreamNum] tag[%s] streamNum[%u]", tag_.c_str(), streamNum);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollGatherMeshExecutor::KernelRun(const OpParam &param, ExecMem &execMem)
+{
+    HCCL_CONFIG_INFO(HCCL_ALG, "[CollGatherMeshExecutor] gather starts.");
+    Stream& stream = const_cast<Stream&>(param.stream);
+    u64 curSize = execMem.count * SIZE_TABLE[param.DataDes.dataType];
+
+    SubCommInfo level0CommInfo = GetSubCommInfo(COMM_LEVEL0, COMM_INDEX_0);
+    u32 level0LocalRank = level0CommInfo.localRank;
+    u32 level0LocalRankSize = level0CommInfo.localRankSize;
+    CHK_PRT_RET(level0LocalRankSize == 0,
+        HCCL_ERROR("[CollGatherMeshExecutor][KernelRun]tag[%s],comm level0 is empty", tag_.c_str()),
+        HCCL_E_INTERNAL);
+
+    u32 commIndex = level0LocalRank;
+    CHK_RET(CheckCommSize(COMM_LEVEL1, commIndex + 1));
+    SubCommInfo level1CommInfo = GetSubCommInfo(COMM_LEVEL1, commIndex);
+
+    // server代表rank为与root同一level1平面的rank, root所在server的代表rank即root
+    u32 subRoot = INVALID_VALUE_RANKID;
+    CHK_RET(topoMatcher_->GetSubRootForScatter(param.root, subRoot));
+    CHK_PRT_RET(subRoot == INVALID_VALUE_RANKID,
+        HCCL_ERROR("[CollGatherMeshExecutor][KernelRun]get subRoot failed, userRank[%u], root[%u]",
+            topoAttr_.userRank, param.root), HCCL_E_INTERNAL);
+
+    /* ***********第一步: 节点内gather到server代表rank*****************************/
+    if (level0LocalRankSize > 1) {
+        u32 rootRankLevel0 = 0;
+        CHK_RET(GetRankByUserRank(COMM_LEVEL0, COMM_INDEX_0, subRoot, rootRankLevel0));
+        CHK_PRT_RET(rootRankLevel0 == INVALID_VALUE_RANKID,
+            HCCL_ERROR("[CollGatherMeshExecutor][KernelRun]rootRankLevel0 is invalid, userRank[%u], subRoot[%u]",
+                topoAttr_.userRank, subRoot), HCCL_E_INTERNAL);
+
+        // 本server的数据在CCL buffer中按userRank连续排布
+        u64 serverOffset = bufferOffset_ + curSize * level0LocalRankSize * level1CommInfo.localRank;
+        std::vector<Slice> dataSegsSlice(level0LocalRankSize);
+        for (u32 i = 0; i < level0LocalRankSize; i++) {
+            dataSegsSlice[i].offset = serverOffset + curSize * i;
+            dataSegsSlice[i].size = curSize;
+        }
+
+        std::unique_ptr<AlgTemplateBase> level0TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_GATHER_MESH, dispatcher_);
+        CHK_SMART_PTR_NULL(level0TempAlg);
+        CHK_RET(level0TempAlg->Prepare(algResResp_->slaveStreams,
+            algResResp_->notifiesMain, algResResp_->notifiesAux, topoAttr_.userRank));
+        CHK_RET(level0TempAlg->Prepare(execMem.inputMem, execMem.inputMem, execMem.inputMem,
+            execMem.count * level0LocalRankSize, param.DataDes.dataType, stream, HCCL_REDUCE_RESERVED,
+            rootRankLevel0, dataSegsSlice));
+        CHK_RET(level0TempAlg->RegisterProfiler(
+            (level0LocalRankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + level0LocalRank,
+            PROF_STAGE_0, HCCL_EXEC_STEP_NOT_SET, stream));
+        HcclResult ret = RunTemplate(level0TempAlg, level0CommInfo);
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[CollGatherMeshExecutor][KernelRun]gather(mesh) RunTemplate failed,return[%d]", ret), ret);
+    }
+
+    /* ***********第二步: 节点间server代表rank成环gather到root****************************/
+    if (subRoot == topoAttr_.userRank) {
+        CHK_RET(KernelRunGatherRing(execMem.inputMem, execMem.count, param.DataDes.dataType, COMM_LEVEL1,
+            commIndex, param.root, level0LocalRankSize, stream));
+    }
+    return HCCL_SUCCESS;
+}
+
+REGISTER_EXEC("GatherMeshExecutor", GatherMesh, CollGatherMeshExecutor);
+
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef COLL_GATHER_MESH_EXECUTOR_H
+#define COLL_GATHER_MESH_EXECUTOR_H
+
+#include "coll_gather_executor.h"
+#include "coll_alg_exec_registry.h"
+
+namespace hccl {
+
+// server内mesh汇聚到server代表rank, server间ring汇聚到root
+class CollGatherMeshExecutor : public CollGatherExecutor {
+public:
+    explicit CollGatherMeshExecutor(const HcclDispatcher dispatcher,
+                                std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~CollGatherMeshExecutor() = default;
+protected:
+    /* *************** 资源计算 *************** */
+    HcclResult CalcLevel0CommInfo(TransportMemType inputType,
+        TransportMemType outputType,
+        std::vector<LevelNSubCommTransport>& opTransport) override;
+
+    HcclResult CalcStreamNum(u32& streamNum) override;
+
+    /* *************** 算法编排 *************** */
+    HcclResult KernelRun(const OpParam &param, ExecMem &execMem) override;
+};
+
+} // namespace hccl
+
+#endif
@@ -137,6 +137,12 @@ HcclResult CollNativeExecutorBase::CalcLevel1CommInfo(TransportMemType inputType
     } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB) {
         commParaLevel1.commType = CommType::COMM_TAG_NONUNIFORM_BRUCK;
         HCCL_INFO("[CollNativeExecutorBase][CalcLevel1CommInfo]tag[%s] Calc NBCommInfo", tag_.c_str());
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        commParaLevel1.commType = CommType::COMM_TAG_DOUBLE_BINARY_TREE;
+        HCCL_INFO("[CollNativeExecutorBase][CalcLevel1CommInfo]tag[%s] Calc DBTCommInfo", tag_.c_str());
+    } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+        commParaLevel1.commType = CommType::COMM_TAG_CHAIN_KNOMIAL;
+        HCCL_INFO("[CollNativeExecutorBase][CalcLevel1CommInfo]tag[%s] Calc ChainCommInfo", tag_.c_str());
     } else {
         commParaLevel1.commType = CommType::COMM_TAG_HALVING_DOUBLING;
         HCCL_INFO("[CollNativeExecutorBase][CalcLevel1CommInfo]tag[%s] Calc HDCommInfo", tag_.c_str());
@@ -144,6 +150,14 @@ HcclResult CollNativeExecutorBase::CalcLevel1CommInfo(TransportMemType inputType
     commParaLevel1.forceRdma = false;
     CHK_RET(CalcCommPlaneInfo(tag_, commParaLevel1, opTransport[commParaLevel1.commPlane], inputType, outputType));
     HCCL_INFO("[CollNativeExecutorBase][COMM_LEVEL1]tag[%s] Calc CommInfo Finish", tag_.c_str());
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
+        // 第二棵树单独建链, 两棵树的收发信号互不干扰, 可在不同的从流上并行执行
+        CommParaInfo commParaDBTTree(COMM_LEVEL1_DBT_TREE, CommType::COMM_TAG_DOUBLE_BINARY_TREE);
+        commParaDBTTree.forceRdma = false;
+        CHK_RET(CalcCommPlaneInfo(tag_, commParaDBTTree, opTransport[COMM_LEVEL1_DBT_TREE], inputType,
+            outputType));
+        HCCL_INFO("[CollNativeExecutorBase][COMM_LEVEL1_DBT_TREE]tag[%s] Calc CommInfo Finish", tag_.c_str());
+    }
     if (topoMatcher_->GetExternalInputEnableRdmaSdmaConcurrent()) {
         CommParaInfo commParaLevel1Sdma(COMM_LEVEL1_ANYPATH_SDMA, CommType::COMM_TAG_RING_INNER);
         commParaLevel1Sdma.forceRdma = false;
@@ -138,20 +138,44 @@ HcclResult CollReduceMeshExecutor::KernelRun(const OpParam &param, ExecMem &exec
         CHK_RET(GetRankByUserRank(COMM_LEVEL1, commIndex, subUserrankRoot, planeRoot));
 
         std::unique_ptr<AlgTemplateBase> level1TempAlg;
-        if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_RING) {
-            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_REDUCE_RING, 
-                dispatcher_);
-        } else {
-            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_REDUCE_RECURSIVE_HALVING_DOUBLING, 
-                dispatcher_);
-        }
-        CHK_SMART_PTR_NULL(level1TempAlg);
-        CHK_RET(level1TempAlg->Prepare(reduceAttr));
         // 节点间的hd 使用环0来记录
         u64 hdCount = dataSegsSlice[commIndex].size / perDataSize;
-
-        CHK_RET(level1TempAlg->Prepare(reduceInput, reduceOutput, reduceOutput, hdCount, param.DataDes.dataType,
-            param.stream, param.reduceType, planeRoot, std::vector<Slice>(0), dataSegsSlice[commIndex].offset));
+        if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+            PipelinePlan pipelinePlan;
+            CHK_RET(CalcPipelinePlan(dataSegsSlice[commIndex].size, rankSize, topoAttr_.userRankSize,
+                topoAttr_.deviceNumPerAggregation, LINK_STATIC_LATENCY_US, pipelinePlan));
+            level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(pipelinePlan.useKnomialTree ?
+                TemplateType::TEMPLATE_REDUCE_KNOMIAL : TemplateType::TEMPLATE_REDUCE_CHAIN, dispatcher_);
+            CHK_SMART_PTR_NULL(level1TempAlg);
+            HCCL_INFO("reduce mesh: using pipelined %s algo inter-server, segmentNum[%u].",
+                pipelinePlan.useKnomialTree ? "k-nomial tree" : "chain", pipelinePlan.segmentNum);
+
+            PrepareData prepareData;
+            prepareData.inputMem = reduceInput;
+            prepareData.outputMem = reduceOutput;
+            prepareData.scratchMem = reduceOutput;
+            prepareData.count = hdCount;
+            prepareData.dataType = param.DataDes.dataType;
+            prepareData.stream = param.stream;
+            prepareData.reductionOp = param.reduceType;
+            prepareData.root = planeRoot;
+            prepareData.baseOffset = dataSegsSlice[commIndex].offset;
+            prepareData.reduceAttr = reduceAttr;
+            prepareData.segmentNum = pipelinePlan.segmentNum;
+            CHK_RET(level1TempAlg->Prepare(prepareData));
+        } else {
+            if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_RING) {
+                level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_REDUCE_RING, 
+                    dispatcher_);
+            } else {
+                level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_REDUCE_RECURSIVE_HALVING_DOUBLING, 
+                    dispatcher_);
+            }
+            CHK_SMART_PTR_NULL(level1TempAlg);
+            CHK_RET(level1TempAlg->Prepare(reduceAttr));
+            CHK_RET(level1TempAlg->Prepare(reduceInput, reduceOutput, reduceOutput, hdCount, param.DataDes.dataType,
+                param.stream, param.reduceType, planeRoot, std::vector<Slice>(0), dataSegsSlice[commIndex].offset));
+        }
 
         CHK_RET(level1TempAlg->RegisterProfiler((
             level1CommInfo.localRankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + level1CommInfo.localRank,
@@ -137,8 +137,9 @@ HcclResult CollReduceScatterVExecutor::RunLoop(OpParam &param, AlgResourceRespon
         if (!DMAReduceFlag_) {
             // 如果使用in CCL buffer，需要将user buffer in中的结果拷贝到CCL buffer in
             auto cclOffset = 0ULL;
-            for (u32 i = 0; i < topoAttr_.userRankSize; i++) {
+            for (u32 idx = 0; idx < topoAttr_.userRankSize; idx++) {
                 // 拷贝input上每个slice的数据到中转内存，源端每个slice的size固定为output的size
+                const u32 i = cclRankOrder_.empty() ? idx : cclRankOrder_[idx];
                 const auto offset = curDispls[i] * unitSize;
                 const auto size = curCounts[i] * unitSize;
                 DeviceMem dstMem = algRes.cclInputMem.range(cclOffset, size);
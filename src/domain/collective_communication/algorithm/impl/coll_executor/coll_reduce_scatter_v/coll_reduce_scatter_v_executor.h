@@ -37,6 +37,7 @@ protected:
     bool DMAReduceFlag_{false};  // 是否DMA消减
     bool scratchMemFlag_{false}; // 是否需要申请scratch memory，不需要申请则传入outputmem为scratchmem
     u64 totalSize_{0};           // 总数据量
+    std::vector<u32> cclRankOrder_; // CCL buffer in中各rank数据的排布顺序, 为空时按userRank顺序排布
 
 private:
     HcclResult RunLoopInner(OpParam &param, const ReduceType &reduceType, ExecMem &execMem);
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "coll_reduce_scatter_v_hierarchical_executor.h"
+#include "alg_template_register.h"
+#include "coll_alg_utils.h"
+
+namespace hccl {
+
+CollReduceScatterVHierarchicalExecutor::CollReduceScatterVHierarchicalExecutor(
+    const HcclDispatcher dispatcher,
+    std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollReduceScatterVExecutor(dispatcher, topoMatcher)
+{
+    DMAReduceFlag_ = false;
+    CCLMemSlice_ = true;
+}
+
+void CollReduceScatterVHierarchicalExecutor::ParseParam(const OpParam& param)
+{
+    tag_ = param.tag;
+
+    // inline reduce场景下节点间/节点内均不使用scratch, 以ccl out作为scratch
+    if (isSupportSDMAReduce_ && IsSupportRDMAReduce(param.VDataDes.dataType, param.reduceType)) {
+        scratchMemFlag_ = false;
+    } else {
+        scratchMemFlag_ = true;
+    }
+    aicpuUnfoldMode_ = param.aicpuUnfoldMode;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcScratchMemSize(u64& scratchMemSize)
+{
+    // 仅支持单算子模式, 单次loop的数据量不超过ccl in
+    scratchMemSize = scratchMemFlag_ ? inCCLbufferSize_ : 0U;
+    HCCL_INFO("[CollReduceScatterVHierarchicalExecutor][CalcScratchMemSize] tag[%s] scratchMemSize[%llu]",
+        tag_.c_str(), scratchMemSize);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcStreamNum(u32& streamNum)
+{
+    u32 totalStreamNum = topoAttr_.deviceNumPerAggregation > 1U ? topoAttr_.deviceNumPerAggregation - 1U : 1U;
+    streamNum = totalStreamNum - 1U;
+    HCCL_INFO("[CollReduceScatterVHierarchicalExecutor][CalcStreamNum] tag[%s] streamNum[%u]",
+        tag_.c_str(), streamNum);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcCommInfo(std::vector<LevelNSubCommTransport>& opTransport)
+{
+    TransportMemType inputType = TransportMemType::RESERVED;
+    TransportMemType outputType = TransportMemType::RESERVED;
+    CHK_RET(CalcTransportMemType(inputType, outputType));
+    CHK_RET(CalcLevel0CommInfo(inputType, outputType, opTransport));
+    CHK_RET(CalcLevel1CommInfo(inputType, outputType, opTransport));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcTransportMemType(TransportMemType &inputType,
+    TransportMemType &outputType)
+{
+    inputType = TransportMemType::CCL_INPUT;
+    outputType = scratchMemFlag_ ? TransportMemType::SCRATCH : TransportMemType::CCL_OUTPUT;
+    HCCL_INFO("[CollReduceScatterVHierarchicalExecutor][CalcTransportMemType] tag[%s] inputType[%d],"
+        " outputType[%d]", tag_.c_str(), inputType, outputType);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcLevel0CommInfo(TransportMemType inputType,
+    TransportMemType outputType, std::vector<LevelNSubCommTransport>& opTransport)
+{
+    // 节点内mesh, 仅支持单算子模式, 各rank与server内全部rank建链
+    CommParaInfo commParaLevel0(COMM_LEVEL0, CommType::COMM_TAG_MESH);
+    CHK_RET(CalcCommPlaneInfo(tag_, commParaLevel0, opTransport[COMM_LEVEL0], inputType, outputType));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcCurCountsAndCurDispls(const u64 maxTotalCount,
+    std::vector<u64> &countsLeft, std::vector<u64> &displs, std::vector<u64> &curCounts, std::vector<u64> &curDispls,
+    bool &finished)
+{
+    // 本轮所有rank的数据在ccl in中紧密排布, 总量不超过maxTotalCount
+    return CalcBalancedCurCountsAndCurDispls(maxTotalCount, countsLeft, displs, curCounts, curDispls, finished);
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::RunLoop(OpParam &param, AlgResourceResponse &algRes)
+{
+    // ccl in中按server依次排布各rank的数据, 使server的数据块连续, 同server的userRank可不连续
+    CHK_RET(topoMatcher_->GetServerToRank(serverToRank_));
+    cclRankOrder_.clear();
+    for (const std::vector<u32> &userRanks : serverToRank_) {
+        cclRankOrder_.insert(cclRankOrder_.end(), userRanks.begin(), userRanks.end());
+    }
+    CHK_PRT_RET(cclRankOrder_.size() != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollReduceScatterVHierarchicalExecutor][RunLoop]rank num[%zu] in servers is not equal to "
+            "userRankSize[%u]", cclRankOrder_.size(), topoAttr_.userRankSize), HCCL_E_INTERNAL);
+    return CollReduceScatterVExecutor::RunLoop(param, algRes);
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::CalcSlices(const OpParam &param, u32 level0RankSize,
+    u32 level1RankSize, std::vector<Slice> &rankSlices, std::vector<Slice> &serverSlices)
+{
+    CHK_PRT_RET(serverToRank_.size() != level1RankSize || cclRankOrder_.size() != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollReduceScatterVHierarchicalExecutor][CalcSlices]server num[%zu] is not equal to "
+            "level1RankSize[%u]", serverToRank_.size(), level1RankSize), HCCL_E_INTERNAL);
+    const u32 unitSize = SIZE_TABLE[param.VDataDes.dataType];
+    const auto *counts = static_cast<const u64 *>(param.VDataDes.counts);
+
+    // 一个server的数据块由其内各rank的slice按userRank升序拼接而成, 与RunLoop中的排布一致
+    rankSlices.assign(topoAttr_.userRankSize, Slice());
+    serverSlices.assign(level1RankSize, Slice());
+    u64 offset = 0;
+    for (u32 server = 0; server < level1RankSize; server++) {
+        const std::vector<u32> &userRanks = serverToRank_[server];
+        CHK_PRT_RET(userRanks.size() != level0RankSize,
+            HCCL_ERROR("[CollReduceScatterVHierarchicalExecutor][CalcSlices]server[%u] rank num[%zu] is not equal to "
+            "level0RankSize[%u]", server, userRanks.size(), level0RankSize), HCCL_E_INTERNAL);
+        serverSlices[server].offset = offset;
+        for (u32 rank : userRanks) {
+            rankSlices[rank].offset = offset;
+            rankSlices[rank].size = counts[rank] * unitSize;
+            offset += rankSlices[rank].size;
+        }
+        serverSlices[server].size = offset - serverSlices[server].offset;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::RunLevel1(const OpParam &param, ExecMem &execMem,
+    const std::vector<Slice> &serverSlices, const SubCommInfo &level1CommInfo)
+{
+    HcclDataType dataType = param.VDataDes.dataType;
+    u64 reduceAttr = GetReduceAttr(execMem.inputMem, execMem.scratchMem, dataType, param.reduceType);
+    std::unique_ptr<AlgTemplateBase> level1TempAlg;
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_RING) {
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_REDUCESCATTER_RING, dispatcher_);
+        CHK_SMART_PTR_NULL(level1TempAlg);
+        CHK_RET(level1TempAlg->Prepare(reduceAttr));
+        HCCL_INFO("reducescatterv hierarchical: using ring algo inter-server.");
+    } else {
+        level1TempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(
+            TemplateType::TEMPLATE_REDUCESCATTER_NHR, dispatcher_);
+        CHK_SMART_PTR_NULL(level1TempAlg);
+        CHK_RET(level1TempAlg->Prepare(reduceAttr, false));
+        HCCL_INFO("reducescatterv hierarchical: using nhr algo inter-server.");
+    }
+
+    // 各server数据块大小不等, 由slices描述, slices非空时count不参与切分
+    CHK_RET(level1TempAlg->Prepare(execMem.inputMem, execMem.inputMem, execMem.scratchMem, execMem.count,
+        dataType, param.stream, param.reduceType, LEVEL0_BRIDGE_RANK_ID, serverSlices));
+
+    u32 level1RankSize = level1CommInfo.localRankSize;
+    CHK_RET(level1TempAlg->RegisterProfiler(
+        (level1RankSize << PROF_RANKSIZE_OFFSET_OF_PLANEID) + level1CommInfo.localRank,
+        PROF_STAGE_0, HCCL_EXEC_STEP_NOT_SET, param.stream));
+
+    CHK_RET(RunTemplate(level1TempAlg, level1CommInfo));
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollReduceScatterVHierarchicalExecutor::KernelRun(const OpParam &param, ExecMem &execMem)
+{
+    HCCL_CONFIG_INFO(HCCL_ALG, "[CollReduceScatterVHierarchicalExecutor][KernelRun] userRank[%u] starts.",
+        topoAttr_.userRank);
+    HcclDataType dataType = param.VDataDes.dataType;
+
+    CHK_RET(CheckCommSize(COMM_LEVEL0, COMM_INDEX_0 + 1));
+    SubCommInfo level0CommInfo = GetSubCommInfo(COMM_LEVEL0, COMM_INDEX_0);
+    u32 commIndex = level0CommInfo.localRank; // 找到rank所在的节点间平面
+    CHK_RET(CheckCommSize(COMM_LEVEL1, commIndex + 1));
+    SubCommInfo level1CommInfo = GetSubCommInfo(COMM_LEVEL1, commIndex);
+
+    u32 level0RankSize = level0CommInfo.localRankSize;
+    u32 level1RankSize = level1CommInfo.localRankSize;
+    u32 serverIndex = level1CommInfo.localRank;
+    CHK_PRT_RET(level0RankSize * level1RankSize != topoAttr_.userRankSize,
+        HCCL_ERROR("[CollReduceScatterVHierarchicalExecutor][KernelRun]level0RankSize[%u] * level1RankSize[%u] "
+        "is not equal to userRankSize[%u]", level0RankSize, level1RankSize, topoAttr_.userRankSize),
+        HCCL_E_INTERNAL);
+
+    std::vector<Slice> rankSlices;
+    std::vector<Slice> serverSlices;
+    CHK_RET(CalcSlices(param, level0RankSize, level1RankSize, rankSlices, serverSlices));
+    const u64 totalSize = serverSlices.back().offset + serverSlices.back().size;
+    // level1平面按server序号排列, level0平面按server内userRank升序排列
+    CHK_PRT_RET(serverToRank_[serverIndex][level0CommInfo.localRank] != topoAttr_.userRank,
+        HCCL_ERROR("[CollReduceScatterVHierarchicalExecutor][KernelRun]userRank[%u] is not rank[%u] of server[%u]",
+            topoAttr_.userRank, level0CommInfo.localRank, serverIndex), HCCL_E_INTERNAL);
+
+    /* ******************第一步: 节点间reducescatter *******************************/
+    if (level1RankSize > 1 && totalSize > 0) {
+        CHK_RET(RunLevel1(param, execMem, serverSlices, level1CommInfo));
+    }
+
+    /* *******************第二步: 节点内reducescatter ******************************************/
+    const Slice &serverSlice = serverSlices[serverIndex];
+    if (level0RankSize > 1 && serverSlice.size > 0) {
+        CHK_RET(ActiveSlaveStreams(param.stream));
+
+        // slice偏移相对于本server数据块, 数据块在ccl in中的偏移作为baseOffset
+        std::vector<Slice> dataSegsSlice(level0RankSize);
+        for (u32 localRank = 0; localRank < level0RankSize; localRank++) {
+            const Slice &rankSlice = rankSlices[serverToRank_[serverIndex][localRank]];
+            dataSegsSlice[localRank].offset = rankSlice.offset - serverSlice.offset;
+            dataSegsSlice[localRank].size = rankSlice.size;
+        }
+
+        DeviceMem reduceScatterMeshInput = execMem.inputMem.range(serverSlice.offset, serverSlice.size);
+        CHK_SMART_PTR_NULL(reduceScatterMeshInput);
+        DeviceMem reduceScatterMeshOutput = execMem.scratchMem.range(serverSlice.offset, serverSlice.size);
+        CHK_SMART_PTR_NULL(reduceScatterMeshOutput);
+
+        u64 reduceAttr = GetReduceAttr(reduceScatterMeshInput, reduceScatterMeshOutput, dataType, param.reduceType);
+        if (topoMatcher_->GetExternalInputHcclDeterministic() == DETERMINISTIC_DISABLE &&
+            (reduceAttr & INLINE_REDUCE_BITMASK)) {
+            CHK_RET(MultiStreamReduceScatterMeshAtomic(param.tag, reduceScatterMeshInput, reduceScatterMeshOutput,
+                execMem.count, dataType, param.reduceType, dataSegsSlice, const_cast<Stream&>(param.stream),
+                COMM_LEVEL0, serverSlice.offset, nullptr));
+        } else {
+            std::vector<std::vector<Slice> > multiStreamSlice; // 每个stream使用的数据基于用户buffer的偏移
+            // mesh算法stream数量为rank数减1
+            CHK_RET(AlgTemplateBase::PrepareSliceMeshStreams(dataSegsSlice, level0RankSize - 1, multiStreamSlice));
+            CHK_RET(MultiStreamReduceScatterMesh(param.tag, reduceScatterMeshInput, reduceScatterMeshOutput,
+                execMem.count, dataType, param.reduceType, multiStreamSlice,
+                const_cast<Stream&>(param.stream), COMM_LEVEL0, serverSlice.offset));
+        }
+    }
+
+    // 本rank的结果位于ccl in中自身slice处, 拷贝到ccl out起始位置, 由RunLoop拷回user out
+    const Slice &localSlice = rankSlices[topoAttr_.userRank];
+    if (localSlice.size > 0) {
+        DeviceMem srcMem = execMem.inputMem.range(localSlice.offset, localSlice.size);
+        CHK_SMART_PTR_NULL(srcMem);
+        DeviceMem dstMem = execMem.outputMem.range(0, localSlice.size);
+        CHK_SMART_PTR_NULL(dstMem);
+        CHK_RET(HcclD2DMemcpyAsync(dispatcher_, dstMem, srcMem, const_cast<Stream&>(param.stream)));
+    }
+
+    return HCCL_SUCCESS;
+}
+
+REGISTER_EXEC("ReduceScatterVHierarchicalExecutor",
+    ReduceScatterVHierarchical, CollReduceScatterVHierarchicalExecutor);
+}
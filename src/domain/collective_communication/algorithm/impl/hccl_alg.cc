@@ -10,7 +10,7 @@
 
 #include "hccl_alg.h"
 #include "hccl_impl.h"
-#include "gather_operator.h"
+#include "gather_operator_for_hetero.h"
 #include "send_receive_operator.h"
 #include "alltoall_operator.h"
 #include "all_reduce_operator.h"
@@ -19,6 +19,7 @@
 #include "topo_matcher.h"
 #include "topo_info_extractor.h"
 #include "alg_configurator.h"
+#include "env_config.h"
 
 namespace hccl {
 constexpr u32 TINY_MEMORY_SIZE = 32; // sendBuff或recvBuff为空时, 使用的DeviceMem大小
@@ -296,6 +297,7 @@ HcclResult HcclAlg::InitExternalEnable(HcclExternalEnable& externalEnable)
     externalEnable.dumpDebug = GetExternalInputHcclDumpDebug();
     externalEnable.aivMode = GetExternalInputHcclAivMode();
     externalEnable.aicpuUnfold = GetExternalInputHcclAicpuUnfold();
+    externalEnable.alltoallvLazyLink = EnvConfig::GetExternalInputAlltoallvLazyLink();
 #endif
     return HCCL_SUCCESS;
 }
@@ -319,6 +321,7 @@ HcclResult HcclAlg::InitTopoInfo(HcclTopoInfo& topoInfo, HcclTopoAttr &topoAttr)
     topoInfo.isDiffDeviceType = topoAttr.isDiffDeviceType;
     topoInfo.gcdDeviceNumPerAggregation = topoAttr.gcdDeviceNumPerAggregation;
     topoInfo.pairLinkCounter = topoAttr.pairLinkCounter;
+    topoInfo.pairLinkInfo = topoAttr.pairLinkInfo;
     topoInfo.isDiffDeviceModule = topoAttr.isDiffDeviceModule;
     topoInfo.realUserRank = topoAttr.realUserRank;
     topoInfo.moduleNum = topoAttr.moduleNum;
@@ -420,7 +423,7 @@ HcclResult HcclAlg::Gather(const std::string &tag, void *inputPtr, void *outputP
     HcclDataType dataType, Stream stream)
 {
 #ifndef CCL_KERNEL_AICPU
-    GatherOperator operation(algConfigurator_.get(), cclBufferManager_, dispatcher_, topoMatcher_);
+    GatherOperatorForHetero operation(algConfigurator_.get(), cclBufferManager_, dispatcher_, topoMatcher_);
     operation.SetLegacyHcclImpl(pimpl_);
     return operation.Gather(tag, inputPtr, outputPtr, rootRank, inputCount, dataType, stream);
 #else
@@ -8,22 +8,22 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
-#include "gather_operator.h"
+#include "gather_operator_for_hetero.h"
 #include "executor_impl.h"
 
 namespace hccl {
-GatherOperator::GatherOperator(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
+GatherOperatorForHetero::GatherOperatorForHetero(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
     HcclDispatcher dispatcher, std::unique_ptr<TopoMatcher> &topoMatcher)
     : CollAlgOperator(algConfigurator, cclBufferManager, dispatcher, topoMatcher, HcclCMDType::HCCL_CMD_GATHER)
 {
 }
 
-GatherOperator::~GatherOperator()
+GatherOperatorForHetero::~GatherOperatorForHetero()
 {
 }
 
-HcclResult GatherOperator::Gather(const std::string &tag, void *inputPtr, void *outputPtr, u32 rootRank, u64 inputCount,
-    HcclDataType dataType, Stream stream)
+HcclResult GatherOperatorForHetero::Gather(const std::string &tag, void *inputPtr, void *outputPtr, u32 rootRank,
+    u64 inputCount, HcclDataType dataType, Stream stream)
 {
     /* ------------集合通信资源准备------------ */
     DeviceMem inputMem = DeviceMem::create(inputPtr, inputCount * SIZE_TABLE[dataType]);
@@ -51,15 +51,15 @@ HcclResult GatherOperator::Gather(const std::string &tag, void *inputPtr, void *
     HcclResult ret = GatherStarExecutor(tag, inputMem, outputMem, inputCount, dataType,
         HcclReduceOp::HCCL_REDUCE_RESERVED, rootRank, stream);
     CHK_PRT_RET(ret != HCCL_SUCCESS,
-        HCCL_ERROR("[GatherOperator][Gather]errNo[0x%016llx] tag[%s],gather run failed",
+        HCCL_ERROR("[GatherOperatorForHetero][Gather]errNo[0x%016llx] tag[%s],gather run failed",
             HCCL_ERROR_CODE(ret), tag.c_str()), ret);
 
     HCCL_INFO("tag[%s],gather run success", tag.c_str());
     return HCCL_SUCCESS;
 }
 
-HcclResult GatherOperator::GatherStarExecutor(const std::string &tag, DeviceMem &inputMem, DeviceMem &outputMem,
-    u64 count, HcclDataType dataType, HcclReduceOp op, u32 root, Stream &stream)
+HcclResult GatherOperatorForHetero::GatherStarExecutor(const std::string &tag, DeviceMem &inputMem,
+    DeviceMem &outputMem, u64 count, HcclDataType dataType, HcclReduceOp op, u32 root, Stream &stream)
 {
     std::unique_ptr<AlgTemplateBase> gstarTemplate =
         AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_GATHER_STAR, dispatcher_);
@@ -8,17 +8,17 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
-#ifndef GATHER_OPERATOR_H
-#define GATHER_OPERATOR_H
+#ifndef GATHER_OPERATOR_FOR_HETERO_H
+#define GATHER_OPERATOR_FOR_HETERO_H
 
 #include "coll_alg_operator.h"
 
 namespace hccl {
-class GatherOperator : public CollAlgOperator {
+class GatherOperatorForHetero : public CollAlgOperator {
 public:
-    GatherOperator(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
+    GatherOperatorForHetero(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
         HcclDispatcher dispatcher, std::unique_ptr<TopoMatcher> &topoMatcher);
-    ~GatherOperator();
+    ~GatherOperatorForHetero();
     HcclResult Gather(const std::string &tag, void *inputPtr, void *outputPtr, u32 rootRank, u64 inputCount,
         HcclDataType dataType, Stream stream);
 private:
@@ -28,4 +28,4 @@ private:
 };
 }
 
-#endif /* __GATHER_OPERATOR_H__ */
\ No newline at end of file
+#endif /* __GATHER_OPERATOR_FOR_HETERO_H__ */
\ No newline at end of file
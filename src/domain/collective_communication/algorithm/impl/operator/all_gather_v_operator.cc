@@ -119,8 +119,20 @@ HcclResult AllGatherVOperator::SelectAlgfor910B(const OpParam& param, std::strin
     } 
 
     if (!isSingleMeshAggregation_) {
-        HCCL_ERROR("[AllGatherVOperator][SelectAlgfor910B] AllGatherV only support one module");
-        return HCCL_E_NOT_SUPPORT;
+        // 多机场景: 节点内mesh + 节点间ring/NHR, 当前仅支持单算子模式且各server卡数一致
+        CHK_PRT_RET(GetWorkflowMode() != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE || multiModuleDiffDeviceNumMode_,
+            HCCL_ERROR("[AllGatherVOperator][SelectAlgfor910B] AllGatherV multi module only support op base mode "
+            "with the same device num per module, multiModuleDiffDeviceNumMode_[%u].",
+            multiModuleDiffDeviceNumMode_), HCCL_E_NOT_SUPPORT);
+        if (algType_.algoLevel1 != AlgTypeLevel1::ALG_LEVEL1_RING &&
+            algType_.algoLevel1 != AlgTypeLevel1::ALG_LEVEL1_NHR) {
+            algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_NHR;
+            HCCL_WARNING("[AllGatherVOperator][SelectAlgfor910B] only support ring and NHR in AlgoLevel1 yet, "
+                "default is algType=NHR.");
+        }
+        algName = "AllGatherVHierarchicalExecutor";
+        HCCL_INFO("[SelectAlgforA2] all_gather_v SelectAlgforA2 is algName [%s]", algName.c_str());
+        return HCCL_SUCCESS;
     }
     
     bool isAivMode = topoMatcher_->GetAivModeConfig() && isSingleMeshAggregation_ &&
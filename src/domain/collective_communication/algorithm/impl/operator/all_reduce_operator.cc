@@ -138,6 +138,14 @@ HcclResult AllReduceOperator::SelectAlg(const std::string& tag, const OpParam& p
     CHK_PRT_RET(ret != HCCL_SUCCESS,
         HCCL_ERROR("[AllReduceSelector][SelectAlg]tag[%s], all_reduce failed, return[%d]", tag.c_str(), ret), ret);
 
+    // DBT仅在mesh/ring/comm三类executor中有level1实现, 其余executor回退到NHR
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT && algName != "AllReduceMeshExecutor" &&
+        algName != "AllReduceRingExecutor" && algName != "AllReduceComm") {
+        algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_NHR;
+        HCCL_WARNING("[AllReduceSelector][SelectAlg]algName[%s] does not support DBT in AlgoLevel1, "\
+            "default is algType=NHR.", algName.c_str());
+    }
+
     if (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
         if (Is310P3Common(isHaveCpuRank_, deviceType_)) {
             newTag = tag + algName;
@@ -577,7 +585,8 @@ HcclResult AllReduceOperator::SelectAlgfor91093(const OpParam& param, std::strin
             if (!(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_RING || algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB)) {
                 algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_RING;
             }
-        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_HD) {
+        } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_HD ||
+            algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_DBT) {
             algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_NHR;
             HCCL_WARNING("[AllReduceOperator][SelectAlgfor91093] only support ring, NB and NHR in AlgoLevel1 yet, "\
                 "default is algType=NHR.");
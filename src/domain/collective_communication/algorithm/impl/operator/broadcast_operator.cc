@@ -23,7 +23,8 @@ BroadCastOperator::BroadCastOperator(AlgConfigurator* algConfigurator, CCLBuffer
     // 由于bcast暂不支持server间ring，需继续使用HD或NHR
     if (!(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NHR) &&
         !(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NHR_V1) &&
-        !(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB)) {
+        !(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_NB) &&
+        !(algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN)) {
         algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_HD;
         HCCL_WARNING("[BroadCastOperator][BroadCastOperator] do not support ring in AlgoLevel1 yet, reset algType=HD.");
     }
@@ -55,6 +56,13 @@ HcclResult BroadCastOperator::SelectAlg(const std::string& tag, const OpParam& p
     CHK_PRT_RET(ret != HCCL_SUCCESS,
         HCCL_ERROR("[BroadCastSelector][SelectAlg]tag[%s], broadcast failed, return[%d]", tag.c_str(), ret), ret);
 
+    // CHAIN仅在mesh executor中有level1实现, 其余executor回退到HD
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN && algName != "BroadCastMeshExecutor") {
+        algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_HD;
+        HCCL_WARNING("[BroadCastOperator][SelectAlg] algName[%s] do not support CHAIN in AlgoLevel1, reset algType=HD.",
+            algName.c_str());
+    }
+
     if (GetWorkflowMode() != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
         newTag = tag;
     } else if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_HD) {
@@ -74,6 +82,10 @@ HcclResult BroadCastOperator::SelectAlg(const std::string& tag, const OpParam& p
         CHK_PRT_RET(level1Iter == HCCL_ALGO_LEVEL1_NAME_MAP.end(), HCCL_ERROR("level1: algType1[%u] is invalid.",
             algType1), HCCL_E_INTERNAL);
         newTag = tag + level1Iter->second + algName;
+        if (algType1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+            // CHAIN只与当前root下的父子节点建链, 不同root所在server的建链关系不同
+            newTag = newTag + "_root" + std::to_string(param.root / deviceNumPerAggregation_);
+        }
     }
     newTag += (param.aicpuUnfoldMode ? "_device" : "_host");
     HCCL_INFO("[SelectAlg] broadcast newTag is [%s]", newTag.c_str());
@@ -146,6 +158,8 @@ HcclResult BroadCastOperator::SelectAlgfor910B(const OpParam& param, std::string
 
     if (isMeshTopo) {
         algName = "BroadCastMeshExecutor";
+        u64 dataSize = param.DataDes.count * SIZE_TABLE[param.DataDes.dataType]; // 单位：字节
+        CHK_RET(SelectPipelineAlgTypeLevel1(HcclCMDType::HCCL_CMD_BROADCAST, dataSize));
     } else if (topoType_ == TopoType::TOPO_TYPE_4P_RING) {
         algName = "BroadCast4pRingExecutor";
     } else if (isRingTopo) {
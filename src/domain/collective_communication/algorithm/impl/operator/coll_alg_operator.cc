@@ -29,7 +29,7 @@ constexpr double NHR_FACTOR_TWO = 2.0;
 constexpr double NHR_FACTOR_THREE = 3.0;
 constexpr double NHR_FACTOR_FOUR = 4.0;
 constexpr double NHR_SUB_TWO = 2.0;
-constexpr float LATENCY = 60; // 静态时延 60 us;
+constexpr double DBT_FACTOR_TWO = 2.0;
 constexpr u64 PIPELINE_MIN_SIZE = 32 * 1024; // 当数据量大于等于32KB时，reduce_scatter和all_gather使能pipeline模式
 constexpr u64 PIPELINE_ALLREDUCE_MIN_SIZE = 1024 * 1024; // 当数据量大于等于1MB时，allreduce使能pipeline模式
 constexpr u64 PIPELINE_MIN_SIZE_NO_LITE = 2 * 1024 * 1024; // 如不支持RDMALite，当数据量大于等于2MB时，使能pipeline模式
@@ -260,6 +260,12 @@ HcclResult CollAlgOperator::AppendTag(const AlgTypeLevel1 &algTypeLevel1, std::s
         case AlgTypeLevel1::ALG_LEVEL1_PIPELINE:
             tag = "ALG_LEVEL1_PIPELINE";
             break;
+        case AlgTypeLevel1::ALG_LEVEL1_DBT:
+            tag = "ALG_LEVEL1_DBT";
+            break;
+        case AlgTypeLevel1::ALG_LEVEL1_CHAIN:
+            tag = "ALG_LEVEL1_CHAIN";
+            break;
         default:
             HCCL_WARNING("[CollAlgOperator][AppendTag] The algTypeLevel1 %d is not supported.", algTypeLevel1);
             break;
@@ -378,7 +384,7 @@ HcclResult CollAlgOperator::GetDefaultAlgoLevel1V2(HcclCMDType hcclCMDType, u64
         }
     }
     u64 dataSizePerLoop = curSize > cclBufferSize ? cclBufferSize : curSize;
-    float delay = LATENCY; // 静态时延 60 us;
+    float delay = LINK_STATIC_LATENCY_US; // 静态时延 60 us;
     float bandWidth;
     CHK_RET(GetBandWidthPerNPU(1, userRankSize_, deviceNumPerAggregation_, bandWidth)); // 单位：GB/s
     bandWidth = bandWidth * GB2B; // 单位：B/s
@@ -528,6 +534,17 @@ HcclResult CollAlgOperator::SelectAlgoTypeForAllReduce(float delay, u64 curSize,
 
     // compare cost among NHR, HD and Ring
     algType = (hdCost < interMinCost) ? AlgTypeLevel1::ALG_LEVEL1_HD : algType;
+    interMinCost = min(hdCost, interMinCost);
+
+    // theoretical time cost of double binary tree: each tree pipelines k chunks of half the data over
+    // (k + 2 * depth) steps and every step waits for two children, so one chunk is size / (2 * k) and the
+    // cost is (k + 2 * depth) * 2 * (delay + size / (2 * k) / bandwidth). Only chosen when strictly cheaper.
+    double perRankSize = static_cast<double>(curSize) / deviceNumPerAggregation_;
+    u32 dbtChunkNum = GetChunkNumOfDBT(static_cast<u64>(perRankSize / DBT_FACTOR_TWO));
+    u32 dbtDepth = GetDepthOfDBT(moduleNum_);
+    double dbtCost = (dbtChunkNum + DBT_FACTOR_TWO * dbtDepth) * DBT_FACTOR_TWO *
+                     (delay + perRankSize / (DBT_FACTOR_TWO * dbtChunkNum) / bandWidth * SECOND2MICROSECOND);
+    algType = (dbtCost < interMinCost) ? AlgTypeLevel1::ALG_LEVEL1_DBT : algType;
     return HCCL_SUCCESS;
 }
 
@@ -556,6 +573,12 @@ HcclResult CollAlgOperator::SelectAlgoTypeForBroadcast(float delay, u64 curSize,
                  SECOND2MICROSECOND;
     }
     algType = (hdCost < ringCost) ? AlgTypeLevel1::ALG_LEVEL1_HD : AlgTypeLevel1::ALG_LEVEL1_RING;
+
+    // theoretical time cost of pipelined chain/k-nomial tree, only chosen when strictly cheaper
+    PipelinePlan pipelinePlan;
+    CHK_RET(CalcPipelinePlan(curSize / deviceNumPerAggregation_, moduleNum_, userRankSize_,
+        deviceNumPerAggregation_, delay, pipelinePlan));
+    algType = (pipelinePlan.costUs < min(hdCost, ringCost)) ? AlgTypeLevel1::ALG_LEVEL1_CHAIN : algType;
     return HCCL_SUCCESS;
 }
 
@@ -584,6 +607,35 @@ HcclResult CollAlgOperator::SelectAlgoTypeForReduce(float delay, u64 curSize, fl
                  SECOND2MICROSECOND;
     }
     algType = (hdCost < ringCost) ? AlgTypeLevel1::ALG_LEVEL1_HD : AlgTypeLevel1::ALG_LEVEL1_RING;
+
+    // theoretical time cost of pipelined chain/k-nomial tree, only chosen when strictly cheaper
+    PipelinePlan pipelinePlan;
+    CHK_RET(CalcPipelinePlan(curSize / deviceNumPerAggregation_, moduleNum_, userRankSize_,
+        deviceNumPerAggregation_, delay, pipelinePlan));
+    algType = (pipelinePlan.costUs < min(hdCost, ringCost)) ? AlgTypeLevel1::ALG_LEVEL1_CHAIN : algType;
+    return HCCL_SUCCESS;
+}
+
+HcclResult CollAlgOperator::SelectPipelineAlgTypeLevel1(HcclCMDType hcclCMDType, u64 dataSize)
+{
+    // 仅op base模式下未指定level1算法的多server场景参与选择, 图模式下transport平面在编译期已确定
+    if (!isAlgoLevel1Default_ || isSingleMeshAggregation_ ||
+        workflowMode_ != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        return HCCL_SUCCESS;
+    }
+    u64 cclBufferSize = cclBufferManager_.GetInCCLbufferSize();
+    u64 dataSizePerLoop = dataSize > cclBufferSize ? cclBufferSize : dataSize;
+    float bandWidth;
+    CHK_RET(GetBandWidthPerNPU(1, userRankSize_, deviceNumPerAggregation_, bandWidth)); // 单位：GB/s
+    bandWidth = bandWidth * GB2B; // 单位：B/s
+    AlgTypeLevel1 algTypeLevel1;
+    CHK_RET(SelectAlgoForComm(hcclCMDType, LINK_STATIC_LATENCY_US, dataSizePerLoop, bandWidth, algTypeLevel1));
+    // HD/Ring维持原有配置, 只在流水链/k叉树理论耗时更低时切换
+    if (algTypeLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+        algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_CHAIN;
+        HCCL_INFO("[SelectPipelineAlgTypeLevel1] cmdType[%d] dataSize[%llu], %u module in level1, using CHAIN algo",
+            hcclCMDType, dataSize, moduleNum_);
+    }
     return HCCL_SUCCESS;
 }
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "gather_operator.h"
+#include "device_capacity.h"
+#include "executor_impl.h"
+#include "hccl_alg.h"
+#include "coll_alg_utils.h"
+
+namespace hccl {
+
+GatherOperator::GatherOperator(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
+    HcclDispatcher dispatcher, std::unique_ptr<TopoMatcher> &topoMatcher)
+    : CollAlgOperator(algConfigurator, cclBufferManager, dispatcher, topoMatcher, HcclCMDType::HCCL_CMD_GATHER)
+{
+    // gather的server间只有ring模板，其他算法需要重定向到ring
+    if (algType_.algoLevel1 != AlgTypeLevel1::ALG_LEVEL1_RING) {
+        algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_RING;
+        HCCL_INFO("[GatherOperator][GatherOperator] algType[%s] is not supported, reset algType=ring",
+            AlgTypeToStr(algType_).c_str());
+    }
+}
+
+GatherOperator::~GatherOperator()
+{
+}
+
+HcclResult GatherOperator::SelectAlg(const std::string& tag, const OpParam& param, std::string& algName,
+    std::string& newTag)
+{
+    if (userRankSize_ == 1 && GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        algName = "GatherSingleExecutor";
+        return HCCL_SUCCESS;
+    }
+    newTag = param.tag;
+    algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_RING;
+
+    bool isMeshTopo = topoType_ == TopoType::TOPO_TYPE_NP_MESH || topoType_ == TopoType::TOPO_TYPE_4P_MESH ||
+        topoType_ == TopoType::TOPO_TYPE_2P_MESH || topoType_ == TopoType::TOPO_TYPE_1P_MESH;
+    u64 totalSize = param.DataDes.count * SIZE_TABLE[param.DataDes.dataType] * userRankSize_;
+    bool isSmallData = totalSize <= GATHER_STAR_MAX_SIZE;
+
+    /*
+     * server内mesh时先汇聚到server代表rank, 再由代表rank在server间汇聚到root:
+     * 1. 卡数不一致或数据量小时按server划分, 代表rank优先取与root同server内序号的rank, 小数据server间走STAR
+     * 2. 卡数一致且数据量大时按level1平面成环, 代表rank为与root同平面的rank
+     * 多超节点或同server的userRank不连续时无法按server切分, 卡数不一致时只能走全局单环
+     */
+    bool canSplitByServer = serverNum_ > 1 && superPodNum_ <= 1 && IsServerRankContiguous();
+    if (!isMeshTopo || multiSuperPodDiffServerNumMode_) {
+        algName = "GatherCommExecutor";
+    } else if (canSplitByServer && (multiModuleDiffDeviceNumMode_ || isSmallData)) {
+        algName = "GatherAsymExecutor";
+        if (isSmallData) {
+            algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_STAR;
+        }
+    } else if (multiModuleDiffDeviceNumMode_) {
+        algName = "GatherCommExecutor";
+    } else {
+        algName = "GatherMeshExecutor";
+    }
+    if (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        newTag = newTag + algName;
+        if (algName == "GatherAsymExecutor") {
+            // 代表rank与server间的建链关系随root与server间算法变化
+            newTag = newTag + "_root" + std::to_string(param.root) + (isSmallData ? "_star" : "_ring");
+        }
+    }
+    newTag += (param.aicpuUnfoldMode ? "_device" : "_host");
+    HCCL_INFO("[SelectAlg] Gather root[%u] newTag is [%s] algName is [%s]", param.root, newTag.c_str(),
+        algName.c_str());
+
+    if (UNLIKELY(EnvConfig::GetExternalInputDebugConfig() & HCCL_ALG)) {
+        HCCL_CONFIG_INFO(HCCL_ALG,
+            "[GatherOperator][SelectAlg]userRank_[%u], algName[%s] actual level1 algo[%d], level2 algo[%d]",
+            userRank_, algName.c_str(), algType_.algoLevel1, algType_.algoLevel2);
+    }
+    return HCCL_SUCCESS;
+}
+
+bool GatherOperator::IsServerRankContiguous()
+{
+    std::vector<std::vector<u32>> serverToRank;
+    if (topoMatcher_->GetServerToRank(serverToRank) != HCCL_SUCCESS) {
+        return false;
+    }
+    u32 rankNum = 0;
+    for (const auto &userRanks : serverToRank) {
+        if (userRanks.empty() || userRanks.back() - userRanks.front() + 1 != userRanks.size()) {
+            return false;
+        }
+        rankNum += userRanks.size();
+    }
+    return rankNum == userRankSize_;
+}
+
+REGISTER_OP(HcclCMDType::HCCL_CMD_GATHER, Gather, GatherOperator);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GATHER_OPERATOR_H
+#define GATHER_OPERATOR_H
+
+#include "coll_alg_operator.h"
+#include "coll_alg_op_registry.h"
+
+namespace hccl {
+// root收到的总数据量不超过该值时server间走STAR, 省去代表rank成环的逐跳时延; 更大时root网卡入向拥塞, 走ring
+constexpr u64 GATHER_STAR_MAX_SIZE = 1024 * 1024;
+
+class GatherOperator : public CollAlgOperator {
+public:
+    GatherOperator(AlgConfigurator* algConfigurator, CCLBufferManager &cclBufferManager,
+        HcclDispatcher dispatcher, std::unique_ptr<TopoMatcher> &topoMatcher);
+    ~GatherOperator();
+    HcclResult SelectAlg(const std::string& tag, const OpParam& param, std::string& algName,
+        std::string& newTag);
+private:
+    bool IsServerRankContiguous();
+};
+}
+
+#endif /** __GATHER_OPERATOR_H__ */
@@ -63,11 +63,22 @@ HcclResult ReduceOperator::SelectAlg(const std::string &tag, const OpParam &para
     CHK_PRT_RET(ret != HCCL_SUCCESS,
         HCCL_ERROR("[ReduceSelector][SelectAlg]tag[%s], reduce failed, return[%d]", tag.c_str(), ret), ret);
 
+    // CHAIN仅在mesh executor中有level1实现, 其余executor回退到HD
+    if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN && algName != "ReduceMeshExecutor") {
+        algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_HD;
+        HCCL_WARNING("[ReduceOperator][SelectAlg] algName[%s] do not support CHAIN in AlgoLevel1, reset algType=HD.",
+            algName.c_str());
+    }
+
     if (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
         auto level1Iter = HCCL_ALGO_LEVEL1_NAME_MAP.find(algType_.algoLevel1);
         CHK_PRT_RET(level1Iter == HCCL_ALGO_LEVEL1_NAME_MAP.end(), HCCL_ERROR("level1: algType1[%u] is invalid.",
             algType_.algoLevel1), HCCL_E_INTERNAL);
         newTag = newTag + level1Iter->second + algName;
+        if (algType_.algoLevel1 == AlgTypeLevel1::ALG_LEVEL1_CHAIN) {
+            // CHAIN只与当前root下的父子节点建链, 不同root所在server的建链关系不同
+            newTag = newTag + "_root" + std::to_string(param.root / deviceNumPerAggregation_);
+        }
     }
     newTag += (param.aicpuUnfoldMode ? "_device" : "_host");
     HCCL_INFO("[SelectAlg] reduce newTag is [%s].", newTag.c_str());
@@ -106,6 +117,8 @@ HcclResult ReduceOperator::SelectAlgfor910B(const OpParam& param, std::string& a
 
     if (isMeshTopo) {
         algName = "ReduceMeshExecutor";
+        u64 dataSize = param.DataDes.count * SIZE_TABLE[param.DataDes.dataType]; // 单位：字节
+        CHK_RET(SelectPipelineAlgTypeLevel1(HcclCMDType::HCCL_CMD_REDUCE, dataSize));
     } else if (isRingTopo) {
         algName = "ReduceRingPlusHd";
     } else {
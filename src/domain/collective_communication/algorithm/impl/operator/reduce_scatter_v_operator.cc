@@ -73,9 +73,21 @@ HcclResult ReduceScatterVOperator::SelectAlg(const std::string& tag, const OpPar
 
 HcclResult ReduceScatterVOperator::SelectAlgfor910B(const OpParam& param, std::string& algName)
 {
-    if(!isSingleMeshAggregation_) {
-        HCCL_ERROR("[ReduceScatterVOperator][SelectAlgforA2] ReduceScatterV only support one module.");
-        return HCCL_E_NOT_SUPPORT;
+    if (!isSingleMeshAggregation_) {
+        // 多机场景: 节点间ring/NHR + 节点内mesh, 当前仅支持单算子模式且各server卡数一致
+        CHK_PRT_RET(GetWorkflowMode() != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE || multiModuleDiffDeviceNumMode_,
+            HCCL_ERROR("[ReduceScatterVOperator][SelectAlgforA2] ReduceScatterV multi module only support op base "
+            "mode with the same device num per module, multiModuleDiffDeviceNumMode_[%u].",
+            multiModuleDiffDeviceNumMode_), HCCL_E_NOT_SUPPORT);
+        if (algType_.algoLevel1 != AlgTypeLevel1::ALG_LEVEL1_RING &&
+            algType_.algoLevel1 != AlgTypeLevel1::ALG_LEVEL1_NHR) {
+            algType_.algoLevel1 = AlgTypeLevel1::ALG_LEVEL1_NHR;
+            HCCL_WARNING("[ReduceScatterVOperator][SelectAlgforA2] only support ring and NHR in AlgoLevel1 yet, "
+                "default is algType=NHR.");
+        }
+        algName = "ReduceScatterVHierarchicalExecutor";
+        HCCL_INFO("[SelectAlgforA2] reduce_scatter_v SelectAlgforA2 is algName [%s]", algName.c_str());
+        return HCCL_SUCCESS;
     }
 
     const auto *countsPtr = static_cast<const u64*>(param.VDataDes.counts);
@@ -104,8 +116,12 @@ HcclResult ReduceScatterVOperator::SelectAlgfor910B(const OpParam& param, std::s
     } else if (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OPS_KERNEL_INFO_LIB &&
         IsSupportSDMAReduce(param.inputPtr, param.outputPtr, param.VDataDes.dataType, param.reduceType)) {
         algName = "ReduceScatterVMeshExecutor";
+    } else if (GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        // 不支持inline reduce时使用TBE reduce, 单机场景下节点间通信跳过
+        algName = "ReduceScatterVHierarchicalExecutor";
     } else {
-        HCCL_ERROR("[ReduceScatterVOperator][SelectAlgforA2] ReduceScatterV only support inlinereduce.");
+        HCCL_ERROR("[ReduceScatterVOperator][SelectAlgforA2] ReduceScatterV only support inlinereduce "
+            "in graph mode.");
         return HCCL_E_NOT_SUPPORT;
     }
     HCCL_INFO("[SelectAlgforA2] reduce_scatter_v SelectAlgforA2 is algName [%s]", algName.c_str());
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "alltoall_lazy_link_tracker.h"
+#include <algorithm>
+#include <utility>
+#include "log.h"
+
+namespace hccl {
+AlltoAllLazyLinkTracker::AlltoAllLazyLinkTracker(u32 userRank, u32 rankSize, u32 idleLimit, u32 linkBudget)
+    : userRank_(userRank), rankSize_(rankSize), idleLimit_(idleLimit), linkBudget_(linkBudget),
+      trackAllRanks_(linkBudget > 0), links_(rankSize)
+{
+}
+
+HcclResult AlltoAllLazyLinkTracker::Update(const std::vector<bool> &activePeers, const u64 *countMatrix,
+    std::vector<bool> &releasePeers)
+{
+    CHK_PRT_RET(userRank_ >= rankSize_ || activePeers.size() != rankSize_,
+        HCCL_ERROR("[AlltoAllLazyLinkTracker][Update]userRank[%u] activePeers size[%zu] mismatch rankSize[%u]",
+        userRank_, activePeers.size(), rankSize_), HCCL_E_PARA);
+    if (trackAllRanks_ && countMatrix == nullptr) {
+        HCCL_WARNING("[AlltoAllLazyLinkTracker][Update]links of other ranks are unknown without a count matrix, "
+            "link budget[%u] is no longer applied on this tag", linkBudget_);
+        trackAllRanks_ = false;
+        for (u32 rank = 0; rank < rankSize_; rank++) {
+            if (rank != userRank_) {
+                links_[rank].clear();
+            }
+        }
+    }
+
+    std::vector<bool> hadLink(rankSize_, false);
+    for (const auto &link : links_[userRank_]) {
+        hadLink[link.first] = true;
+    }
+
+    callSeq_++;
+    MarkActive(activePeers, countMatrix);
+    ReleaseIdleLinks();
+    if (trackAllRanks_) {
+        ApplyLinkBudget();
+    }
+
+    releasePeers.assign(rankSize_, false);
+    for (u32 peer = 0; peer < rankSize_; peer++) {
+        releasePeers[peer] = hadLink[peer] && !HasLink(peer);
+    }
+    return HCCL_SUCCESS;
+}
+
+bool AlltoAllLazyLinkTracker::HasLink(u32 peer) const
+{
+    return links_[userRank_].find(peer) != links_[userRank_].end();
+}
+
+u32 AlltoAllLazyLinkTracker::GetLinkNum() const
+{
+    return links_[userRank_].size();
+}
+
+u64 AlltoAllLazyLinkTracker::GetCallSeq() const
+{
+    return callSeq_;
+}
+
+void AlltoAllLazyLinkTracker::MarkActive(const std::vector<bool> &activePeers, const u64 *countMatrix)
+{
+    if (!trackAllRanks_) {
+        for (u32 peer = 0; peer < rankSize_; peer++) {
+            if (activePeers[peer] && peer != userRank_) {
+                links_[userRank_][peer] = callSeq_;
+            }
+        }
+        return;
+    }
+    for (u32 rank = 0; rank < rankSize_; rank++) {
+        for (u32 peer = rank + 1; peer < rankSize_; peer++) {
+            if (countMatrix[static_cast<u64>(rank) * rankSize_ + peer] != 0 ||
+                countMatrix[static_cast<u64>(peer) * rankSize_ + rank] != 0) {
+                links_[rank][peer] = callSeq_;
+                links_[peer][rank] = callSeq_;
+            }
+        }
+    }
+}
+
+void AlltoAllLazyLinkTracker::ReleaseIdleLinks()
+{
+    if (idleLimit_ == 0) {
+        return;
+    }
+    std::vector<std::pair<u32, u32>> idleLinks;
+    for (u32 rank = 0; rank < rankSize_; rank++) {
+        if (!trackAllRanks_ && rank != userRank_) {
+            continue;
+        }
+        for (const auto &link : links_[rank]) {
+            // 全局模型中每条链路只需在序号小的一端统计一次
+            bool duplicated = trackAllRanks_ && link.first < rank;
+            if (!duplicated && callSeq_ - link.second >= idleLimit_) {
+                idleLinks.emplace_back(rank, link.first);
+            }
+        }
+    }
+    for (const auto &link : idleLinks) {
+        Unlink(link.first, link.second);
+    }
+}
+
+void AlltoAllLazyLinkTracker::ApplyLinkBudget()
+{
+    for (u32 rank = 0; rank < rankSize_; rank++) {
+        if (links_[rank].size() <= linkBudget_) {
+            continue;
+        }
+        // 本次算子使用的链路不回收, 其余按最近使用时间从旧到新回收, 时间相同时按对端序号
+        std::vector<std::pair<u64, u32>> candidates;
+        for (const auto &link : links_[rank]) {
+            if (link.second != callSeq_) {
+                candidates.emplace_back(link.second, link.first);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        u32 evictNum = std::min<u32>(links_[rank].size() - linkBudget_, candidates.size());
+        for (u32 i = 0; i < evictNum; i++) {
+            Unlink(rank, candidates[i].second);
+        }
+    }
+}
+
+void AlltoAllLazyLinkTracker::Unlink(u32 rank, u32 peer)
+{
+    links_[rank].erase(peer);
+    if (trackAllRanks_) {
+        links_[peer].erase(rank);
+    }
+}
+}  // namespace hccl
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ALLTOALL_LAZY_LINK_TRACKER_H
+#define ALLTOALL_LAZY_LINK_TRACKER_H
+
+#include <unordered_map>
+#include <vector>
+#include "base.h"
+
+namespace hccl {
+/*
+ * alltoallv按需建链的链路使用记录, 每个tag一份。链路的建立与回收必须在两端同时发生, 否则一端会等待对端已拆除的链路,
+ * 因此回收只依据两端都能得到相同结论的信息:
+ * 1. 每对rank在每次算子中是否有数据交互在两端一致, 连续idleLimit次未使用的链路两端同时回收;
+ * 2. 链路数上限linkBudget需要知道对端保有哪些链路, 仅在alltoallvc下生效: 各rank依据全局收发矩阵维护所有rank的
+ *    链路模型, 按rank序号依次对超出上限的rank回收最久未使用的链路, 各rank计算出的回收结果相同。
+ *    同一tag上出现alltoallv后其他rank的链路无从得知, 之后仅按idleLimit回收
+ */
+class AlltoAllLazyLinkTracker {
+public:
+    AlltoAllLazyLinkTracker(u32 userRank, u32 rankSize, u32 idleLimit, u32 linkBudget);
+
+    /*
+     * 记录一次算子的数据交互, 返回本rank需回收的链路。activePeers为本rank本次有数据交互的对端,
+     * countMatrix为alltoallvc的rankSize*rankSize收发矩阵, alltoallv传nullptr
+     */
+    HcclResult Update(const std::vector<bool> &activePeers, const u64 *countMatrix, std::vector<bool> &releasePeers);
+
+    bool HasLink(u32 peer) const;
+    u32 GetLinkNum() const;
+    u64 GetCallSeq() const;
+
+private:
+    void MarkActive(const std::vector<bool> &activePeers, const u64 *countMatrix);
+    void ReleaseIdleLinks();
+    void ApplyLinkBudget();
+    void Unlink(u32 rank, u32 peer);
+
+    u32 userRank_;
+    u32 rankSize_;
+    u32 idleLimit_;   // 链路连续空闲的算子次数上限, 0表示不按空闲回收
+    u32 linkBudget_;  // 单rank保有的链路数上限, 0表示不限制
+    u64 callSeq_{0};  // 该tag上已执行的算子次数
+    bool trackAllRanks_;  // 是否维护所有rank的链路模型
+    std::vector<std::unordered_map<u32, u64>> links_;  // rank : (对端 : 最近一次有数据交互的callSeq)
+};
+}  // namespace hccl
+#endif /* ALLTOALL_LAZY_LINK_TRACKER_H */
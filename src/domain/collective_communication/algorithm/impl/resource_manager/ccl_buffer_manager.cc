@@ -13,6 +13,7 @@
 #include "externalinput_pub.h"
 #include "workflow_pub.h"
 #include "adapter_rts_common.h"
+#include "env_config.h"
 
 namespace hccl {
 CCLBufferManager::CCLBufferManager()
@@ -48,20 +49,50 @@ HcclResult CCLBufferManager::CreateCCLbuffer(u64 size, DeviceMem &buffer)
     return HCCL_SUCCESS;
 }
 
+HcclResult CCLBufferManager::LeaseCCLbuffer(CCLBufferPoolSlot slot, u64 size, DeviceMem &buffer)
+{
+    CHK_PRT_RET(!size, HCCL_INFO("[CCLBufferManager][LeaseCCLbuffer]buffer size is zero. not need to lease memory"),
+        HCCL_SUCCESS);
+    s32 deviceLogicId = cclBufferPoolDevice_;
+    if (deviceLogicId < 0) {
+        CHK_RET(hrtGetDevice(&deviceLogicId));
+    }
+    CCLBufferPool *pool = nullptr;
+    CHK_RET(CCLBufferPool::GetInstance(deviceLogicId, pool));
+    CHK_RET(pool->Lease(slot, size, buffer));
+    cclBufferPoolDevice_ = deviceLogicId;
+    HCCL_RUN_INFO("[HCCL_TRACE][LeaseCCLbuffer]Lease ccl buffer success. device[%d], buffer ptr[%p], size[%llu]",
+        cclBufferPoolDevice_, buffer.ptr(), buffer.size());
+    return HCCL_SUCCESS;
+}
+
+HcclResult CCLBufferManager::ReturnCCLbuffer(CCLBufferPoolSlot slot, DeviceMem &buffer)
+{
+    CCLBufferPool *pool = nullptr;
+    CHK_RET(CCLBufferPool::GetInstance(cclBufferPoolDevice_, pool));
+    CHK_RET(pool->Return(slot, buffer));
+    buffer = DeviceMem();
+    return HCCL_SUCCESS;
+}
+
 HcclResult CCLBufferManager::CreateCommCCLbuffer()
 {
+    // 开启共享时in/out CCL buffer从device级的池中租借, 否则各通信域独立申请
+    bool shareBuffer = EnvConfig::GetExternalInputCCLBufferShare() != 0;
     if (inCCLbuffer_.ptr() == nullptr) {
         if (inCCLbufferSize_ == 0) {
             inCCLbufferSize_ = GetExternalInputCCLBuffSize();
         }
-        CHK_RET(CreateCCLbuffer(inCCLbufferSize_, inCCLbuffer_));
+        CHK_RET(shareBuffer ? LeaseCCLbuffer(CCLBufferPoolSlot::IN_CCL_BUFFER, inCCLbufferSize_, inCCLbuffer_) :
+            CreateCCLbuffer(inCCLbufferSize_, inCCLbuffer_));
     }
 
     if (outCCLbuffer_.ptr() == nullptr) {
         if (outCCLbufferSize_ == 0) {
             outCCLbufferSize_ = GetExternalInputCCLBuffSize();
         }
-        CHK_RET(CreateCCLbuffer(outCCLbufferSize_, outCCLbuffer_));
+        CHK_RET(shareBuffer ? LeaseCCLbuffer(CCLBufferPoolSlot::OUT_CCL_BUFFER, outCCLbufferSize_, outCCLbuffer_) :
+            CreateCCLbuffer(outCCLbufferSize_, outCCLbuffer_));
     }
     return HCCL_SUCCESS;
 }
@@ -81,6 +112,10 @@ HcclResult CCLBufferManager::CreateCommExpBuffer()
 
 HcclResult CCLBufferManager::CleanCCLbuffer()
 {
+    // 共享的CCL buffer同时被其他通信域使用, 整块清理会破坏其数据和flag区
+    CHK_PRT_RET(cclBufferPoolDevice_ >= 0,
+        HCCL_ERROR("[CCLBufferManager][CleanCCLbuffer]ccl buffer is leased from pool, clean is not supported, "
+            "please unset HCCL_CCL_BUFFER_SHARE"), HCCL_E_NOT_SUPPORT);
     if (inCCLbuffer_.ptr() != nullptr) {
         CHK_RET(hrtMemSet(inCCLbuffer_.ptr(), inCCLbuffer_.size(), inCCLbuffer_.size()));
         HCCL_INFO("[CleanCCLbuffer] clean input buffer, ptr[%p], size[%llu]", inCCLbuffer_.ptr(), inCCLbuffer_.size());
@@ -129,12 +164,20 @@ HcclResult CCLBufferManager::ReleaseCommCCLbuffer()
     if (inCCLbuffer_.ptr() != nullptr ){
         HCCL_RUN_INFO("[HCCL_TRACE][ReleaseCCLbuffer]Release inCCLbuffer. buffer ptr[%p], size[%llu]",
         inCCLbuffer_.ptr(), inCCLbuffer_.size());
-        inCCLbuffer_.free();
+        if (cclBufferPoolDevice_ >= 0) {
+            CHK_RET(ReturnCCLbuffer(CCLBufferPoolSlot::IN_CCL_BUFFER, inCCLbuffer_));
+        } else {
+            inCCLbuffer_.free();
+        }
     }
     if (outCCLbuffer_.ptr() != nullptr) {
         HCCL_RUN_INFO("[HCCL_TRACE][ReleaseCCLbuffer]Release outCCLbuffer. buffer ptr[%p], size[%llu]",
         outCCLbuffer_.ptr(), outCCLbuffer_.size());
-        outCCLbuffer_.free();
+        if (cclBufferPoolDevice_ >= 0) {
+            CHK_RET(ReturnCCLbuffer(CCLBufferPoolSlot::OUT_CCL_BUFFER, outCCLbuffer_));
+        } else {
+            outCCLbuffer_.free();
+        }
     }
     if (inCCLbuffer_.ptr() == nullptr && outCCLbuffer_.ptr() == nullptr) {
         HCCL_RUN_INFO("[HCCL_TRACE][ReleaseCCLbuffer]Release ccl buffer success.");
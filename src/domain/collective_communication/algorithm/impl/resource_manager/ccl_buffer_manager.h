@@ -12,6 +12,7 @@
 #define CCL_BUFFER_MANAGER_H
 
 #include "mem_device_pub.h"
+#include "ccl_buffer_pool.h"
 
 namespace hccl {
 
@@ -54,6 +55,8 @@ public:
     HcclResult CleanCCLbuffer();
 private:
     HcclResult CreateCCLbuffer(u64 size, DeviceMem &buffer);
+    HcclResult LeaseCCLbuffer(CCLBufferPoolSlot slot, u64 size, DeviceMem &buffer);
+    HcclResult ReturnCCLbuffer(CCLBufferPoolSlot slot, DeviceMem &buffer);
     void* GetCCLbufferAddr(const DeviceMem &buffer);
 
     DeviceMem inCCLbuffer_;
@@ -66,6 +69,7 @@ private:
     DeviceMem outAlltoAllvParaBuffer_;
     DeviceMem inAIVbuffer_ = DeviceMem();
     DeviceMem outAIVbuffer_ = DeviceMem();
+    s32 cclBufferPoolDevice_ = -1; // 从CCLBufferPool租借in/out CCL buffer时所在的device, 未租借为-1
 };
 } // namespace hccl
 
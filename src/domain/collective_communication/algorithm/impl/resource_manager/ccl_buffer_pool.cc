@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "ccl_buffer_pool.h"
+#include <algorithm>
+#include "log.h"
+#include "hccl_common.h"
+
+namespace hccl {
+HcclResult CCLBufferPool::GetInstance(s32 deviceLogicId, CCLBufferPool *&pool)
+{
+    static CCLBufferPool cclBufferPool[MAX_MODULE_DEVICE_NUM];
+    CHK_PRT_RET(deviceLogicId < 0 || static_cast<u32>(deviceLogicId) >= MAX_MODULE_DEVICE_NUM,
+        HCCL_ERROR("[CCLBufferPool][GetInstance]deviceLogicId[%d] is invalid, max[%u]", deviceLogicId,
+            MAX_MODULE_DEVICE_NUM), HCCL_E_PARA);
+    pool = &cclBufferPool[deviceLogicId];
+    return HCCL_SUCCESS;
+}
+
+CCLBufferPool::CCLBufferPool(CCLBufferPoolAllocFunc allocFunc) : allocFunc_(allocFunc)
+{
+    if (allocFunc_ == nullptr) {
+        allocFunc_ = [](u64 size) { return DeviceMem::alloc(size); };
+    }
+}
+
+CCLBufferPool::~CCLBufferPool()
+{
+    for (auto &slotBlocks : blocks_) {
+        for (auto &block : slotBlocks) {
+            block.mem.free();
+        }
+        slotBlocks.clear();
+    }
+}
+
+HcclResult CCLBufferPool::Lease(CCLBufferPoolSlot slot, u64 size, DeviceMem &mem)
+{
+    CHK_PRT_RET(size == 0 || slot >= CCLBufferPoolSlot::SLOT_NUM,
+        HCCL_ERROR("[CCLBufferPool][Lease]invalid slot[%u] or size[%llu]", static_cast<u32>(slot), size),
+        HCCL_E_PARA);
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    std::list<PoolBlock> &slotBlocks = blocks_[static_cast<u32>(slot)];
+
+    // 当前块不够大时申请新块, 旧块留给已持有的通信域, 其引用计数归零时释放
+    if (slotBlocks.empty() || slotBlocks.back().mem.size() < size) {
+        PoolBlock block;
+        block.mem = allocFunc_(size);
+        CHK_PRT_RET(!block.mem, HCCL_ERROR("[CCLBufferPool][Lease]alloc device mem failed, slot[%u] size[%llu]",
+            static_cast<u32>(slot), size), HCCL_E_MEMORY);
+        stat_.reservedSize += block.mem.size();
+        stat_.peakReservedSize = std::max(stat_.peakReservedSize, stat_.reservedSize);
+        stat_.allocCount++;
+        slotBlocks.push_back(std::move(block));
+        HCCL_RUN_INFO("[HCCL_TRACE][CCLBufferPool][Lease]alloc pooled buffer, slot[%u], ptr[%p], size[%llu]",
+            static_cast<u32>(slot), slotBlocks.back().mem.ptr(), size);
+    }
+
+    PoolBlock &current = slotBlocks.back();
+    current.refCount++;
+    stat_.leaseCount++;
+    stat_.leaseNum++;
+    mem = DeviceMem::create(current.mem.ptr(), size);
+    HCCL_INFO("[CCLBufferPool][Lease]slot[%u], ptr[%p], size[%llu], refCount[%u]", static_cast<u32>(slot),
+        mem.ptr(), size, current.refCount);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CCLBufferPool::Return(CCLBufferPoolSlot slot, const DeviceMem &mem)
+{
+    CHK_PRT_RET(slot >= CCLBufferPoolSlot::SLOT_NUM,
+        HCCL_ERROR("[CCLBufferPool][Return]invalid slot[%u]", static_cast<u32>(slot)), HCCL_E_PARA);
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    std::list<PoolBlock> &slotBlocks = blocks_[static_cast<u32>(slot)];
+    auto it = std::find_if(slotBlocks.begin(), slotBlocks.end(),
+        [&mem](const PoolBlock &block) { return block.mem.ptr() == mem.ptr(); });
+    CHK_PRT_RET(it == slotBlocks.end() || it->refCount == 0,
+        HCCL_ERROR("[CCLBufferPool][Return]ptr[%p] is not leased from slot[%u]", mem.ptr(),
+            static_cast<u32>(slot)), HCCL_E_PARA);
+
+    it->refCount--;
+    stat_.leaseNum--;
+    if (it->refCount == 0) {
+        HCCL_RUN_INFO("[HCCL_TRACE][CCLBufferPool][Return]release pooled buffer, slot[%u], ptr[%p], size[%llu]",
+            static_cast<u32>(slot), it->mem.ptr(), it->mem.size());
+        stat_.reservedSize -= it->mem.size();
+        it->mem.free();
+        slotBlocks.erase(it);
+    }
+    return HCCL_SUCCESS;
+}
+
+CCLBufferPoolStat CCLBufferPool::GetStat()
+{
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    return stat_;
+}
+}  // namespace hccl
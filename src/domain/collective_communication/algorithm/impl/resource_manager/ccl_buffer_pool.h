@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CCL_BUFFER_POOL_H
+#define CCL_BUFFER_POOL_H
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include "base.h"
+#include "mem_device_pub.h"
+
+namespace hccl {
+using CCLBufferPoolAllocFunc = std::function<DeviceMem(u64 size)>;
+
+enum class CCLBufferPoolSlot {
+    IN_CCL_BUFFER = 0,
+    OUT_CCL_BUFFER = 1,
+    SLOT_NUM
+};
+
+struct CCLBufferPoolStat {
+    u64 reservedSize{0};      /* 已向device申请的内存大小 */
+    u64 peakReservedSize{0};  /* reservedSize的峰值 */
+    u64 allocCount{0};        /* 向device申请的次数 */
+    u64 leaseCount{0};        /* 累计租借次数 */
+    u32 leaseNum{0};          /* 当前未归还的租约数 */
+};
+
+/*
+ * 进程级、按device区分的CCL buffer池, 供算子在同一条流上串行下发的多个通信域共享in/out CCL buffer:
+ * 1. 租借时若当前块不小于请求大小, 直接增加引用计数; 否则按请求大小申请新块作为当前块,
+ *    旧块由已持有的通信域继续使用, 引用计数归零后释放;
+ * 2. 池只复用device内存, 各通信域仍按各自的链路与对端交换内存信息。
+ */
+class CCLBufferPool {
+public:
+    static HcclResult GetInstance(s32 deviceLogicId, CCLBufferPool *&pool);
+
+    explicit CCLBufferPool(CCLBufferPoolAllocFunc allocFunc = nullptr);
+    ~CCLBufferPool();
+
+    /* 租借不小于size的buffer, mem为不持有所有权的视图, 大小为请求的size */
+    HcclResult Lease(CCLBufferPoolSlot slot, u64 size, DeviceMem &mem);
+
+    /* 归还Lease得到的buffer */
+    HcclResult Return(CCLBufferPoolSlot slot, const DeviceMem &mem);
+
+    CCLBufferPoolStat GetStat();
+
+private:
+    struct PoolBlock {
+        DeviceMem mem;
+        u32 refCount{0};
+    };
+
+    CCLBufferPoolAllocFunc allocFunc_;
+    std::mutex poolMutex_;
+    std::list<PoolBlock> blocks_[static_cast<u32>(CCLBufferPoolSlot::SLOT_NUM)]; /* 末尾为当前块 */
+    CCLBufferPoolStat stat_;
+};
+}  // namespace hccl
+#endif /* CCL_BUFFER_POOL_H */
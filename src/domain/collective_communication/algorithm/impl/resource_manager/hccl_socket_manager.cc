@@ -31,6 +31,9 @@ HcclSocketManager::~HcclSocketManager()
 std::map<PortInfo, std::shared_ptr<HcclSocket>> HcclSocketManager::serverSocketMap_;
 std::map<PortInfo, Referenced> HcclSocketManager::serverSocketRefMap_;
 std::mutex HcclSocketManager::serverMapMutex_;
+std::mutex HcclSocketManager::socketPoolMutex_;
+std::map<SocketPoolKey, SocketPoolEntry> HcclSocketManager::socketPoolMap_;
+std::map<const HcclSocket *, SocketPoolKey> HcclSocketManager::pooledSocketKeyMap_;
 
 HcclResult HcclSocketManager::ServerInit(const HcclNetDevCtx netDevCtx, u32 port)
 {
@@ -93,7 +96,7 @@ HcclResult HcclSocketManager::ServerDeInit(const HcclNetDevCtx netDevCtx, u32 po
 // 填加向本端创建链接的客户端"RANK+IP"白名单
 HcclResult HcclSocketManager::AddWhiteList(const std::string &commTag,
     bool isInterLink, NicType socketType,
-    const HcclIpAddress &localIp, const std::map<u32, HcclRankLinkInfo> &whiteListMap)
+    const HcclIpAddress &localIp, const std::map<u32, HcclRankLinkInfo> &whiteListMap, bool usePool)
 {
     if (whiteListMap.size() == 0) {
         HCCL_ERROR("[Add][WhiteList]client infos map or local Ip is empty.");
@@ -107,7 +110,7 @@ HcclResult HcclSocketManager::AddWhiteList(const std::string &commTag,
             for (auto iter = whiteListMap.begin(); iter != whiteListMap.end(); iter++) {
                 auto dstRankLinkInfo = iter->second;
                 ret = ConstructWhiteList(commTag, isInterLink, socketType, dstRankLinkInfo,
-                    wlistInfosVec);
+                    wlistInfosVec, usePool);
                 CHK_PRT_RET(ret != HCCL_SUCCESS,
                     HCCL_ERROR("[Add][WhiteList]Construct white lists is failed. ret[%d]", ret), ret);
             }
@@ -125,13 +128,15 @@ HcclResult HcclSocketManager::AddWhiteList(const std::string &commTag,
 
 HcclResult HcclSocketManager::ConstructWhiteList(const std::string &commTag,
     bool isInterLink, NicType socketType,
-    const HcclRankLinkInfo &dstRankLinkInfo, std::vector<SocketWlistInfo> &wlistInfosVec)
+    const HcclRankLinkInfo &dstRankLinkInfo, std::vector<SocketWlistInfo> &wlistInfosVec, bool usePool)
 {
         SocketWlistInfo wlistInfo;
         u32 userRank = dstRankLinkInfo.userRank;
         for (u32 i = 0; i < dstRankLinkInfo.socketsPerLink; i++) {
-            // 使用Client Rank作为确定标识,保证Client和Server的Tag一致
-            std::string tag = MakeUniqueConnTag(commTag, isInterLink, userRank, i);
+            // 使用Client Rank作为确定标识,保证Client和Server的Tag一致; 池化连接与通信域无关, 使用Client的IP和物理ID
+            std::string tag = usePool ?
+                MakePooledConnTag(isInterLink, dstRankLinkInfo.ip, dstRankLinkInfo.devicePhyId, i) :
+                MakeUniqueConnTag(commTag, isInterLink, userRank, i);
             wlistInfo.connLimit = GetConnLimit(socketType);
             s32 sRet = memcpy_s(&wlistInfo.tag[0], sizeof(wlistInfo.tag), tag.c_str(), tag.size() + 1);
             if (sRet != EOK) {
@@ -214,6 +219,7 @@ HcclResult HcclSocketManager::CreateSockets(const std::string &commTag,
     auto remoteIp = remoteLinkInfo.ip;
     u32 remotePort = remoteLinkInfo.port;
     u32 socketsPerLink = remoteLinkInfo.socketsPerLink;
+    bool poolMode = isSupportReuse && !socketShareKey_.empty();
 
     // 支持复用，则先找下是否与相同的远端IP创建过链接
     if (isSupportReuse) {
@@ -229,8 +235,26 @@ HcclResult HcclSocketManager::CreateSockets(const std::string &commTag,
         }
     }
 
+    // 本tag下没有可复用的连接时, 再从连接池中取共享key相同的其他通信域建立(或正在建立)的同一组连接;
+    // 池中已有该组连接但不能复用时(本通信域已以其他tag使用或连接异常), 按通信域tag新建且不入池, 两端判断一致
+    bool usePool = poolMode && socketsPerLink == remoteLinkInfo.socketsPerLink;
+    SocketPoolKey poolKey(socketShareKey_, localIp, remoteIp, remotePort, socketType, localRole, socketsPerLink);
+    if (usePool && AcquirePooledSockets(commTag, poolKey, ipSockets, usePool)) {
+        SaveSockets(commTag, remoteRank, remoteIp, ipSockets);
+        return HCCL_SUCCESS;
+    }
+
+    // 共享模式下白名单按对端逐个添加: 复用池中连接时对端不会再发起建链, 无需添加
+    if (poolMode && localRole == HcclSocketRole::SOCKET_ROLE_SERVER) {
+        std::map<u32, HcclRankLinkInfo> remoteMap;
+        remoteMap.insert(std::make_pair(remoteRank, remoteLinkInfo));
+        ret = AddWhiteList(commTag, isInterLink, socketType, localIp, remoteMap, usePool);
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[Create][Sockets]Add white list failed. ret[%d]", ret), ret);
+    }
+
     ret = ConstructSockets(commTag, isInterLink, netDevCtx, socketsPerLink, socketType, remoteRank,
-        remoteIp, remotePort, localIp, localRole, ipSockets);
+        remoteIp, remotePort, localIp, localRole, ipSockets, remoteLinkInfo.devicePhyId, usePool);
     CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[Create][Sockets]construct socket is failed. ret[%d]", ret), ret);
 
     // 若作为客户端，需要发起Connect请求
@@ -245,6 +269,9 @@ HcclResult HcclSocketManager::CreateSockets(const std::string &commTag,
     }
 
     SaveSockets(commTag, remoteRank, remoteIp, ipSockets);
+    if (usePool) {
+        SavePooledSockets(commTag, poolKey, ipSockets);
+    }
 
     HCCL_INFO("[Create][Sockets]Create Sockets is success.");
     return HCCL_SUCCESS;
@@ -259,7 +286,7 @@ void HcclSocketManager::DestroySockets()
     for (auto it = commSocketsMap_.begin(); it != commSocketsMap_.end(); it++) {
         auto rankSocketmap = it->second;
         for (auto iter = rankSocketmap.begin(); iter != rankSocketmap.end(); iter++) {
-            DestroySockets(iter->second);
+            DestroySockets(it->first, iter->second);
         }
         // 删除链接时，自动删除 WhiteList
         DelWhiteList(it->first);
@@ -276,7 +303,7 @@ void HcclSocketManager::DestroySockets(const std::string &commTag)
     if (it != commSocketsMap_.end()) {
         auto rankSocketmap = it->second;
         for (auto iter = rankSocketmap.begin(); iter != rankSocketmap.end(); iter++) {
-            DestroySockets(iter->second);
+            DestroySockets(commTag, iter->second);
         }
         commSocketsMap_.erase(it);
     }
@@ -295,7 +322,7 @@ void HcclSocketManager::DestroySockets(const std::string &commTag, u32 rank)
         auto rankSocketmap = it->second;
         auto iter = rankSocketmap.find(rank);
         if (iter != rankSocketmap.end()) {
-            DestroySockets(iter->second);
+            DestroySockets(commTag, iter->second);
             rankSocketmap.erase(iter);
         }
     }
@@ -303,11 +330,13 @@ void HcclSocketManager::DestroySockets(const std::string &commTag, u32 rank)
 }
 
 // private
-void HcclSocketManager::DestroySockets(std::vector<std::shared_ptr<HcclSocket> > rankSockets)
+void HcclSocketManager::DestroySockets(const std::string &commTag,
+    std::vector<std::shared_ptr<HcclSocket> > rankSockets)
 {
     for (u32 j = 0; j < rankSockets.size(); j++) {
         auto temp = rankSockets[j];
-        if (temp != nullptr) {
+        // 连接池中的连接仍被其他通信域引用时不关闭
+        if (temp != nullptr && !ReleasePooledSocket(commTag, temp)) {
             temp->Close();
         }
     }
@@ -355,8 +384,9 @@ HcclResult HcclSocketManager::CreateSockets(const std::string &commTag,
             info.userRank, info.devicePhyId, info.ip.GetReadableAddress(), info.port);
     }
 
-    // 作为服务端时，先填加白名单
-    if (dstClientMap.size() > 0) {
+    // 作为服务端时，先填加白名单; 共享模式下在逐个对端建链时按是否复用池中连接添加
+    bool poolMode = isSupportReuse && !socketShareKey_.empty();
+    if (dstClientMap.size() > 0 && !poolMode) {
         ret = AddWhiteList(commTag, isInterLink, socketType, localIp, dstClientMap);
         CHK_PRT_RET(ret != HCCL_SUCCESS,
             HCCL_ERROR("[Create][Sockets]Add white list failed. ret[%d]", ret), ret);
@@ -461,13 +491,14 @@ HcclResult HcclSocketManager::CreateSingleLinkSocket(const std::string &commTag,
     std::map<u32, HcclRankLinkInfo> remoteMap;
     remoteMap.insert(std::make_pair(remoteRankInfo.userRank, remoteRankInfo));
  
-    // 作为服务端时，先填加白名单
-    if (role == HcclSocketRole::SOCKET_ROLE_SERVER) {
+    // 作为服务端时，先填加白名单; 共享模式下在建链时按是否复用池中连接添加
+    bool poolMode = isSupportReuse && !socketShareKey_.empty();
+    if (role == HcclSocketRole::SOCKET_ROLE_SERVER && !poolMode) {
         ret = AddWhiteList(commTag, isInterLink, socketType, localIp, remoteMap);
         CHK_PRT_RET(ret != HCCL_SUCCESS,
             HCCL_ERROR("[Create][Sockets]Add white list failed. ret[%d]", ret), ret);
     }
- 
+
     std::map<u32, u32> remoteRankToUserRank; // 子平面rank 映射 通信域 rank
     std::map <u32, std::vector<std::shared_ptr<HcclSocket> > > socketsMap;
     ret = CreateSockets(commTag, isInterLink, netDevCtx, socketType, role,
@@ -641,6 +672,20 @@ std::string HcclSocketManager::MakeUniqueConnTag(const std::string &commTag, boo
     return socketTag;
 }
 
+// 生成池化连接的 SocketTag, 只依赖共享key和Client的IP/物理ID, 由哪个通信域首先建链两端都一致
+std::string HcclSocketManager::MakePooledConnTag(bool isInterLink, const HcclIpAddress &clientIp,
+    u32 clientDevicePhyId, u32 indexForLink)
+{
+    // 共享key可能较长, 使用FNV-1a摘要以免超出白名单tag长度; 各rank计算方式一致
+    u64 keyHash = 14695981039346656037ULL;
+    for (unsigned char c : socketShareKey_) {
+        keyHash = (keyHash ^ c) * 1099511628211ULL;
+    }
+    std::string tmpStr = isInterLink ? "_Inter_" : "_Intra_";
+    return "SocketPool_" + std::to_string(keyHash) + tmpStr + clientIp.GetReadableIP() + "_" +
+        std::to_string(clientDevicePhyId) + "_" + std::to_string(indexForLink);
+}
+
 // 保存白名单，后继保存到Listen的Socket对象中
 void HcclSocketManager::SaveWhiteListInfo(const std::string &commTag, std::shared_ptr<HcclSocket> &socket,
     const std::vector<SocketWlistInfo> wlistInfos)
@@ -674,12 +719,16 @@ HcclResult HcclSocketManager::ConstructSockets(const std::string &commTag, bool
     NicType socketType, u32 remoteUserRank,
     const HcclIpAddress &remoteIp, u32 remotePort,
     const HcclIpAddress &localIp, HcclSocketRole localRole,
-    std::vector<std::shared_ptr<HcclSocket> > &socketList)
+    std::vector<std::shared_ptr<HcclSocket> > &socketList, u32 remoteDevicePhyId, bool usePool)
 {
     // 使用Client Rank作为确定标识,保证Client和Server的Tag一致
-    u32 clientRank = localRole == HcclSocketRole::SOCKET_ROLE_CLIENT ? userRank_ : remoteUserRank;
+    bool isClient = localRole == HcclSocketRole::SOCKET_ROLE_CLIENT;
+    u32 clientRank = isClient ? userRank_ : remoteUserRank;
     for (u32 i = 0; i < socketsPerLink; i++) {
-        std::string socketTag = MakeUniqueConnTag(commTag, isInterLink, clientRank, i);
+        std::string socketTag = usePool ?
+            MakePooledConnTag(isInterLink, isClient ? localIp : remoteIp, isClient ? devicePhyId_ : remoteDevicePhyId,
+                i) :
+            MakeUniqueConnTag(commTag, isInterLink, clientRank, i);
         std::shared_ptr<HcclSocket> tempSocket;
         EXECEPTION_CATCH((tempSocket = std::make_shared<HcclSocket>(socketTag,
             netDevCtx, remoteIp, remotePort, localRole)), return HCCL_E_PTR);
@@ -759,48 +808,86 @@ void HcclSocketManager::GetSocketsByRankIP(const HcclIpAddress &remoteIp, u32 so
     }
 }
 
-// private
-// 同步接口，更新连接状态，并返回连接成功的连接数量
+// 同步接口，等待单个连接建立完成
 HcclResult HcclSocketManager::WaitLinkEstablish(std::shared_ptr<HcclSocket> socket, std::function<bool()> needStop)
 {
     CHK_SMART_PTR_NULL(socket);
+    return WaitSocketsEstablish(std::vector<std::shared_ptr<HcclSocket>>{socket}, needStop);
+}
+
+// 同步接口，等待一批连接建立完成, 整批连接共用一个超时时间
+// 每轮遍历所有未完成的连接; 一轮没有新连接建立时退避等待, 等待时间从SOCKET_WAIT_MIN_INTERVAL_US倍增至
+// SOCKET_WAIT_MAX_INTERVAL_US, 有连接建立后重新从最小值开始; 等待可被SetStopFlag立即唤醒
+HcclResult HcclSocketManager::WaitSocketsEstablish(const std::vector<std::shared_ptr<HcclSocket>> &sockets,
+    std::function<bool()> needStop)
+{
+    std::vector<std::shared_ptr<HcclSocket>> pendingSockets;
+    pendingSockets.reserve(sockets.size());
+    for (auto &socket : sockets) {
+        CHK_SMART_PTR_NULL(socket);
+        pendingSockets.push_back(socket);
+    }
+
     u32 count = 0;
+    u32 intervalUs = SOCKET_WAIT_MIN_INTERVAL_US;
     auto startTime = std::chrono::steady_clock::now();
     auto timeout = std::chrono::seconds(GetExternalInputHcclLinkTimeOut());
-    HCCL_DEBUG("[Wait][LinkEstablish]waiting for sockets link up...");
-    while (true) {
-        CHK_PRT_RET(needStop(), HCCL_ERROR("Terminating operation due to external request"), HCCL_E_INTERNAL);
+    HCCL_DEBUG("[Wait][LinkEstablish]waiting for %zu sockets link up...", pendingSockets.size());
+    while (!pendingSockets.empty()) {
+        CHK_PRT_RET(needStop() || GetStopFlag(), HCCL_ERROR("Terminating operation due to external request"),
+            HCCL_E_INTERNAL);
 
         if ((std::chrono::steady_clock::now() - startTime) >= timeout) {
-            HCCL_ERROR("[Wait][LinkEstablish]wait socket establish timeout, role[%u] rank[%u] timeout[%lld]",
-                static_cast<u32>(socket->GetLocalRole()), userRank_, timeout);
-            socket->SetStatus(HcclSocketStatus::SOCKET_TIMEOUT);
+            for (auto &socket : pendingSockets) {
+                HCCL_ERROR("[Wait][LinkEstablish]wait socket establish timeout, role[%u] rank[%u] timeout[%lld s] "
+                    "localIp[%s] remoteIp[%s]", static_cast<u32>(socket->GetLocalRole()), userRank_,
+                    static_cast<long long>(timeout.count()), socket->GetLocalIp().GetReadableIP(),
+                    socket->GetRemoteIp().GetReadableIP());
+                socket->SetStatus(HcclSocketStatus::SOCKET_TIMEOUT);
+            }
             RPT_INPUT_ERR(true, "EI0006", std::vector<std::string>({"reason"}), \
                 std::vector<std::string>({GET_SOCKET_TIMEOUT_REASON}));
             return HCCL_E_TIMEOUT;
         }
-        HcclSocketStatus status = socket->GetStatus();
-        if (status == HcclSocketStatus::SOCKET_OK) {
-            HCCL_DEBUG("[Wait][LinkEstablish]socket is establish. localIp[%s], remoteIp[%s]",
-                socket->GetLocalIp().GetReadableIP(), socket->GetRemoteIp().GetReadableIP());
-            return HCCL_SUCCESS;
-        } else if (status == HcclSocketStatus::SOCKET_CONNECTING) {
-            SaluSleep(ONE_MILLISECOND_OF_USLEEP);
-            // 日志过滤, 50 次才打印一次
-            if (count % 50 == 0) {
-                HCCL_DEBUG("[Wait][LinkEstablish]socket is connectting ");
+
+        size_t pendingNum = pendingSockets.size();
+        for (auto iter = pendingSockets.begin(); iter != pendingSockets.end();) {
+            std::shared_ptr<HcclSocket> &socket = *iter;
+            HcclSocketStatus status = socket->GetStatus();
+            if (status == HcclSocketStatus::SOCKET_OK) {
+                HCCL_DEBUG("[Wait][LinkEstablish]socket is establish. localIp[%s], remoteIp[%s]",
+                    socket->GetLocalIp().GetReadableIP(), socket->GetRemoteIp().GetReadableIP());
+                iter = pendingSockets.erase(iter);
+            } else if (status == HcclSocketStatus::SOCKET_CONNECTING) {
+                iter++;
+            } else if (status == HcclSocketStatus::SOCKET_TIMEOUT) {
+                return HCCL_E_TIMEOUT;
+            } else {
+                socket->SetStatus(HcclSocketStatus::SOCKET_ERROR);
+                return HCCL_E_TCP_CONNECT;
             }
-            count++;
-            
+        }
+
+        if (pendingSockets.empty()) {
+            break;
+        }
+        if (pendingSockets.size() < pendingNum) {
+            intervalUs = SOCKET_WAIT_MIN_INTERVAL_US;
             continue;
-        } else if (status == HcclSocketStatus::SOCKET_TIMEOUT) {
-            return HCCL_E_TIMEOUT;
-        } else {
-            socket->SetStatus(HcclSocketStatus::SOCKET_ERROR);
-            return HCCL_E_TCP_CONNECT;
         }
+        {
+            std::unique_lock<std::mutex> lock(stopMutex_);
+            stopCond_.wait_for(lock, std::chrono::microseconds(intervalUs),
+                [this]() -> bool { return this->GetStopFlag(); });
+        }
+        intervalUs = std::min(intervalUs * 2, SOCKET_WAIT_MAX_INTERVAL_US);
+        // 日志过滤, 50 次才打印一次
+        if (count % 50 == 0) {
+            HCCL_DEBUG("[Wait][LinkEstablish]%zu sockets are connectting ", pendingSockets.size());
+        }
+        count++;
     }
-    return HCCL_E_TCP_CONNECT;
+    return HCCL_SUCCESS;
 }
 
 HcclResult HcclSocketManager::WaitLinksEstablishCompleted(HcclSocketRole localRole,
@@ -825,20 +912,23 @@ HcclResult HcclSocketManager::WaitLinksEstablishCompleted(HcclSocketRole localRo
 HcclResult HcclSocketManager::WaitLinksEstablishCompleted(HcclSocketRole localRole,
     std::map <u32, std::vector<std::shared_ptr<HcclSocket> > > &rankSocketsMap)
 {
+    std::vector<std::shared_ptr<HcclSocket> > sockets;
     for (auto iter = rankSocketsMap.begin(); iter != rankSocketsMap.end(); iter++) {
-        auto rankSockets = iter->second;
-        for (u32 i = 0; i < rankSockets.size(); i++) {
-            HcclResult ret = WaitLinkEstablish(rankSockets[i], [this]() -> bool {return this->GetStopFlag(); });
-            CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[Wait][LinksEstablishCompleted] is failed. ret[%d].",
-                ret), ret);
-        }
+        sockets.insert(sockets.end(), iter->second.begin(), iter->second.end());
     }
+    HcclResult ret = WaitSocketsEstablish(sockets);
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[Wait][LinksEstablishCompleted] is failed. ret[%d].",
+        ret), ret);
     return HCCL_SUCCESS;
 }
 
 HcclResult HcclSocketManager::SetStopFlag(bool value)
 {
-    stopFlag_.store(value);
+    {
+        std::unique_lock<std::mutex> lock(stopMutex_);
+        stopFlag_.store(value);
+    }
+    stopCond_.notify_all();
 
     std::unique_lock<std::mutex> lock(socketsMapMutex_);
     for (auto& socketsMap : commSocketsMap_) {  // map
@@ -857,4 +947,102 @@ bool HcclSocketManager::GetStopFlag()
     return stopFlag_.load();
 }
 
+HcclResult HcclSocketManager::SetSocketShareKey(const std::string &shareKey)
+{
+    std::unique_lock<std::mutex> lock(socketsMapMutex_);
+    CHK_PRT_RET(!commSocketsMap_.empty() && shareKey != socketShareKey_,
+        HCCL_ERROR("[HcclSocketManager][SetSocketShareKey]sockets already created, share key can not be changed."),
+        HCCL_E_PARA);
+    socketShareKey_ = shareKey;
+    HCCL_INFO("[HcclSocketManager][SetSocketShareKey]localRank[%u] share key[%s]", userRank_, shareKey.c_str());
+    return HCCL_SUCCESS;
+}
+
+const std::string &HcclSocketManager::GetSocketShareKey() const
+{
+    return socketShareKey_;
+}
+
+u32 HcclSocketManager::GetPooledSocketNum()
+{
+    std::unique_lock<std::mutex> lock(socketPoolMutex_);
+    return pooledSocketKeyMap_.size();
+}
+
+// private
+// 从连接池中获取共享key相同的其他通信域建立的同一组连接; 本通信域已以其他tag使用该组连接时不复用, 避免同一通信域内多路复用
+// isNewKey返回池中是否还没有该组连接, 为true时新建的连接可以入池
+bool HcclSocketManager::AcquirePooledSockets(const std::string &commTag, const SocketPoolKey &key,
+    std::vector<std::shared_ptr<HcclSocket>> &ipSockets, bool &isNewKey)
+{
+    std::unique_lock<std::mutex> lock(socketPoolMutex_);
+    auto it = socketPoolMap_.find(key);
+    isNewKey = it == socketPoolMap_.end();
+    if (isNewKey || it->second.users.find(this) != it->second.users.end()) {
+        return false;
+    }
+    for (auto &socket : it->second.sockets) {
+        HcclSocketStatus status = socket->GetStatus();
+        if (status != HcclSocketStatus::SOCKET_OK && status != HcclSocketStatus::SOCKET_CONNECTING) {
+            return false;
+        }
+    }
+    it->second.users[this].insert(commTag);
+    ipSockets.insert(ipSockets.end(), it->second.sockets.begin(), it->second.sockets.end());
+    HCCL_INFO("[Acquire][PooledSockets]commTag[%s] reuse %zu pooled sockets, remoteIp[%s] localRank[%u] "
+        "users[%zu].", commTag.c_str(), it->second.sockets.size(), key.remoteIp.GetReadableIP(), userRank_,
+        it->second.users.size());
+    return true;
+}
+
+// private
+// 将新建的一组连接放入连接池, 同一key已有连接时不覆盖
+void HcclSocketManager::SavePooledSockets(const std::string &commTag, const SocketPoolKey &key,
+    const std::vector<std::shared_ptr<HcclSocket>> &ipSockets)
+{
+    std::unique_lock<std::mutex> lock(socketPoolMutex_);
+    if (socketPoolMap_.find(key) != socketPoolMap_.end()) {
+        return;
+    }
+    SocketPoolEntry &entry = socketPoolMap_[key];
+    entry.sockets = ipSockets;
+    entry.users[this].insert(commTag);
+    for (auto &socket : ipSockets) {
+        pooledSocketKeyMap_.insert(std::make_pair(socket.get(), key));
+    }
+}
+
+// private
+// 释放本通信域commTag对连接池中连接的引用, 返回true表示该连接仍被其他通信域使用, 不能关闭
+bool HcclSocketManager::ReleasePooledSocket(const std::string &commTag, const std::shared_ptr<HcclSocket> &socket)
+{
+    std::unique_lock<std::mutex> lock(socketPoolMutex_);
+    auto keyIter = pooledSocketKeyMap_.find(socket.get());
+    if (keyIter == pooledSocketKeyMap_.end()) {
+        return false;
+    }
+    auto it = socketPoolMap_.find(keyIter->second);
+    if (it == socketPoolMap_.end()) {
+        pooledSocketKeyMap_.erase(keyIter);
+        return false;
+    }
+    auto &users = it->second.users;
+    auto userIter = users.find(this);
+    if (userIter != users.end()) {
+        userIter->second.erase(commTag);
+        if (userIter->second.empty()) {
+            users.erase(userIter);
+        }
+    }
+    if (!users.empty()) {
+        return true;
+    }
+    // 最后一个引用释放, 整组连接出池, 由调用者逐个关闭
+    for (auto &pooledSocket : it->second.sockets) {
+        pooledSocketKeyMap_.erase(pooledSocket.get());
+    }
+    socketPoolMap_.erase(it);
+    return false;
+}
+
 }  // namespace hccl
@@ -12,11 +12,14 @@
 #define HCCL_SOCKET_MANAGER_H
 
 #include <map>
+#include <tuple>
 #include <vector>
 #include <string>
 #include <memory>
+#include <set>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <hccl/hccl_types.h>
 #include "hccl_common.h"
@@ -25,6 +28,10 @@
 #include "common.h"
 
 namespace hccl {
+// 等待建链时无进展的退避等待区间(us)
+constexpr u32 SOCKET_WAIT_MIN_INTERVAL_US = 10;
+constexpr u32 SOCKET_WAIT_MAX_INTERVAL_US = 1000;
+
 class PortInfo {
 public:
     PortInfo(const HcclIpAddress &ip, u32 listenPort)
@@ -72,6 +79,53 @@ public:
     HcclIpAddress ip;
     u32 listenPort;
 };
+// 连接池的key: 共享key相同的通信域间, 同一对本端/远端网卡、同一端口、同一链路类型和角色的一组连接可共享
+class SocketPoolKey {
+public:
+    SocketPoolKey(const std::string &shareKey, const HcclIpAddress &localIp, const HcclIpAddress &remoteIp,
+        u32 remotePort, NicType socketType, HcclSocketRole localRole, u32 socketsPerLink)
+        : shareKey(shareKey), localIp(localIp), remoteIp(remoteIp), remotePort(remotePort),
+          socketType(socketType), localRole(localRole), socketsPerLink(socketsPerLink)
+    {}
+    ~SocketPoolKey()
+    {}
+
+    bool operator<(const SocketPoolKey &key) const
+    {
+        if (shareKey != key.shareKey) {
+            return shareKey < key.shareKey;
+        }
+        if (localIp < key.localIp) {
+            return true;
+        }
+        if (key.localIp < localIp) {
+            return false;
+        }
+        if (remoteIp < key.remoteIp) {
+            return true;
+        }
+        if (key.remoteIp < remoteIp) {
+            return false;
+        }
+        return std::tie(remotePort, socketType, localRole, socketsPerLink) <
+            std::tie(key.remotePort, key.socketType, key.localRole, key.socketsPerLink);
+    }
+
+    std::string shareKey;
+    HcclIpAddress localIp;
+    HcclIpAddress remoteIp;
+    u32 remotePort;
+    NicType socketType;
+    HcclSocketRole localRole;
+    u32 socketsPerLink;
+};
+
+using SocketPoolEntry = struct SocketPoolEntryDef {
+    std::vector<std::shared_ptr<HcclSocket>> sockets;
+    // 引用该组连接的socketManager(通信域)及其commTag, 全部释放后才关闭连接
+    std::map<const void *, std::set<std::string>> users;
+};
+
 using NicHandleInfo = struct NicHandleInfoDef {
     HcclIpAddress ip;
     SocketHandle nicSocketHandle;
@@ -125,9 +179,17 @@ public:
     HcclResult SetStopFlag(bool value);
     bool GetStopFlag();
     HcclResult WaitLinkEstablish(std::shared_ptr<HcclSocket> socket, std::function<bool()> needStop = []() { return false; });
+    HcclResult WaitSocketsEstablish(const std::vector<std::shared_ptr<HcclSocket>> &sockets,
+        std::function<bool()> needStop = []() { return false; });
+
+    // 设置连接共享key, 为空时不共享; 通信域内所有rank需使用相同的key(如父通信域的标识), 否则两端复用情况不一致
+    HcclResult SetSocketShareKey(const std::string &shareKey);
+    const std::string &GetSocketShareKey() const;
+    // 连接池中仍被引用的连接数量
+    static u32 GetPooledSocketNum();
 private:
     HcclResult AddWhiteList(const std::string &commTag, bool isInterLink, NicType socketType,
-        const HcclIpAddress &localIp, const std::map<u32, HcclRankLinkInfo> &whiteListMap);
+        const HcclIpAddress &localIp, const std::map<u32, HcclRankLinkInfo> &whiteListMap, bool usePool = false);
     HcclResult DelWhiteList(const std::string &commTag);
     HcclResult CreateSockets(const std::string &commTag, bool isInterLink, const HcclNetDevCtx netDevCtx,
         NicType socketType, HcclSocketRole localRole, const HcclIpAddress &localIp,
@@ -138,7 +200,7 @@ private:
         const std::map<u32, HcclRankLinkInfo> &remoteInfos,
         std::map<u32, std::vector<std::shared_ptr<HcclSocket> > > &socketsMap,
         std::map<u32, u32> &dstRankToUserRank, bool isSupportReuse);
-    void DestroySockets(std::vector<std::shared_ptr<HcclSocket> > rankSockets);
+    void DestroySockets(const std::string &commTag, std::vector<std::shared_ptr<HcclSocket> > rankSockets);
     void TransformSocketStatus(HcclSocketStatus status, std::string &stringStatus) const;
     void PrintSocketsInfo(const std::string &localRole,
         u32 rank, std::vector<std::shared_ptr<HcclSocket> > ipSockets) const;
@@ -150,19 +212,27 @@ private:
         std::map<u32, u32> &dstRankToUserRank) const;
     u32 GetConnLimit(NicType socketType);
     std::string MakeUniqueConnTag(const std::string &commTag, bool isInterLink, u32 rank, u32 indexForLink);
+    std::string MakePooledConnTag(bool isInterLink, const HcclIpAddress &clientIp, u32 clientDevicePhyId,
+        u32 indexForLink);
     HcclResult ConstructWhiteList(const std::string &commTag,
         bool isInterLink, NicType socketType,
-        const HcclRankLinkInfo &dstRankLinkInfo, std::vector<SocketWlistInfo> &wlistInfosVec);
+        const HcclRankLinkInfo &dstRankLinkInfo, std::vector<SocketWlistInfo> &wlistInfosVec, bool usePool = false);
     void SaveWhiteListInfo(const std::string &commTag, std::shared_ptr<HcclSocket> &socket,
         const std::vector<SocketWlistInfo> wlistInfos);
     HcclResult ConstructSockets(const std::string &commTag, bool isInterLink, const HcclNetDevCtx netDevCtx,
         u32 socketsPerLink, NicType socketType, u32 dstRank, const HcclIpAddress &remoteIp, u32 remotePort,
-        const HcclIpAddress &localIp, HcclSocketRole localRole, std::vector<std::shared_ptr<HcclSocket>> &socketList);
+        const HcclIpAddress &localIp, HcclSocketRole localRole, std::vector<std::shared_ptr<HcclSocket>> &socketList,
+        u32 remoteDevicePhyId = 0, bool usePool = false);
     void SaveSockets(const std::string &commTag, u32 remoteRank, const HcclIpAddress &remoteIp,
         std::vector<std::shared_ptr<HcclSocket> > &ipSockets);
 
     HcclResult WaitLinksEstablishCompleted(HcclSocketRole localRole,
         std::map<u32, std::vector<std::shared_ptr<HcclSocket> > > &rankSocketsMap);
+    bool AcquirePooledSockets(const std::string &commTag, const SocketPoolKey &key,
+        std::vector<std::shared_ptr<HcclSocket>> &ipSockets, bool &isNewKey);
+    void SavePooledSockets(const std::string &commTag, const SocketPoolKey &key,
+        const std::vector<std::shared_ptr<HcclSocket>> &ipSockets);
+    bool ReleasePooledSocket(const std::string &commTag, const std::shared_ptr<HcclSocket> &socket);
 
     NICDeployment nicDeployment_;
     s32 deviceLogicId_;
@@ -180,7 +250,14 @@ private:
     static std::map<PortInfo, std::shared_ptr<HcclSocket>> serverSocketMap_;
     static std::map<PortInfo, Referenced> serverSocketRefMap_;
 
+    std::string socketShareKey_;
+    static std::mutex socketPoolMutex_;
+    static std::map<SocketPoolKey, SocketPoolEntry> socketPoolMap_;
+    static std::map<const HcclSocket *, SocketPoolKey> pooledSocketKeyMap_;
+
     std::atomic<bool> stopFlag_{false};
+    std::mutex stopMutex_;
+    std::condition_variable stopCond_;
 };
 
 using IntraExchanger = struct IntraExchangerDef {
@@ -9,13 +9,14 @@
  */
 
 #include "op_base_stream_manager.h"
+#include "slave_resource_pool.h"
 
 namespace hccl {
-OpBaseStreamManager::OpBaseStreamManager() : master_()
+OpBaseStreamManager::OpBaseStreamManager(s32 deviceLogicId) : deviceLogicId_(deviceLogicId), master_()
 {
     slaves_.reserve(MAX_SUBSTREAM_NUM);
     slaveDevices_.reserve(MAX_SUBSTREAM_NUM);
-    HCCL_DEBUG("[OpBaseStreamManager]reserve slaves[%u]", MAX_SUBSTREAM_NUM);
+    HCCL_DEBUG("[OpBaseStreamManager]reserve slaves[%u], deviceLogicId[%d]", MAX_SUBSTREAM_NUM, deviceLogicId_);
 }
 
 OpBaseStreamManager::~OpBaseStreamManager() = default;
@@ -23,6 +24,7 @@ OpBaseStreamManager::~OpBaseStreamManager() = default;
 HcclResult OpBaseStreamManager::RegisterMaster(Stream stream)
 {
     std::unique_lock<std::mutex> lock(masterMutex_);
+    CHK_RET(BindSharedGroup(stream.ptr()));
     master_ = stream;
     HCCL_DEBUG("[OpBaseStreamManager][RegisterMaster]register master stream[%p] success.", master_.ptr());
     lock.unlock();
@@ -35,11 +37,13 @@ HcclResult OpBaseStreamManager::RegisterMaster(rtStream_t rtStream)
     if (rtStream == master_.ptr()) {
         return HCCL_SUCCESS;
     }
-    master_ = Stream(rtStream);
-    if (!master_.ptr()) {
+    Stream stream(rtStream);
+    if (!stream.ptr()) {
         HCCL_ERROR("[OpBaseStreamManager][RegisterMaster]register master stream by rtStream[%p] failed.", rtStream);
         return HCCL_E_INTERNAL;
     }
+    CHK_RET(BindSharedGroup(stream.ptr()));
+    master_ = stream;
     HCCL_DEBUG("[OpBaseStreamManager][RegisterMaster]register master stream by rtStream[%p] success.", rtStream);
     lock.unlock();
     return HCCL_SUCCESS;
@@ -53,11 +57,33 @@ HcclResult OpBaseStreamManager::AllocMaster(const StreamType streamType)
         HCCL_ERROR("[OpBaseStreamManager][AllocMaster]alloc master stream of type[%d] failed.", streamType);
         return HCCL_E_INTERNAL;
     }
+    CHK_RET(BindSharedGroup(stream.ptr()));
     master_ = stream;
     HCCL_INFO("[OpBaseStreamManager][AllocMaster]alloc master stream[%p] success.", master_.ptr());
     lock.unlock();
     return HCCL_SUCCESS;
 }
+
+HcclResult OpBaseStreamManager::BindSharedGroup(rtStream_t master)
+{
+    if (deviceLogicId_ < 0) {
+        return HCCL_SUCCESS;
+    }
+    // 调用方已持有masterMutex_, master未变化时沿用已绑定的资源组, 不再访问device级的池
+    if (sharedGroup_ != nullptr) {
+        // 按tag缓存的算子资源引用了已绑定资源组的从流和notify, 换到其他master上执行会与该组的其他通信域重叠
+        CHK_PRT_RET(sharedMaster_ != master, HCCL_ERROR("[OpBaseStreamManager][BindSharedGroup]slave resource is "
+            "shared on master[%p], switching to master[%p] is not supported, please unset HCCL_STREAM_NOTIFY_SHARE",
+            sharedMaster_, master), HCCL_E_NOT_SUPPORT);
+        return HCCL_SUCCESS;
+    }
+    SlaveResourcePool *pool = nullptr;
+    CHK_RET(SlaveResourcePool::GetInstance(deviceLogicId_, pool));
+    CHK_RET(pool->Acquire(master, sharedGroup_));
+    sharedMaster_ = master;
+    return HCCL_SUCCESS;
+}
+
 std::vector<Stream> OpBaseStreamManager::AllocSlaves(const StreamType streamType, u32 num)
 {
     HCCL_INFO("[OpBaseStreamManager][AllocSlaves]requesting for [%u] slave streams.", num);
@@ -66,44 +92,61 @@ std::vector<Stream> OpBaseStreamManager::AllocSlaves(const StreamType streamType
         HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]master not found, alloc slave stream failed.");
         return std::vector<Stream>();
     }
-    std::vector<Stream> *slavesPtr;
-    slavesPtr = (streamType == StreamType::STREAM_TYPE_ONLINE) ? &slaves_ : &slaveDevices_;
-    if (slavesPtr->capacity() < num) {
+    Stream master = master_;
+    // device stream由aicpu按通信域使用, 不参与共享
+    std::shared_ptr<SlaveResourceGroup> group =
+        (streamType == StreamType::STREAM_TYPE_ONLINE) ? sharedGroup_ : nullptr;
+    masterLock.unlock();
+
+    std::unique_lock<std::mutex> slaveLock((group != nullptr) ? group->groupMutex : slavesMutex_);
+    std::vector<Stream> &slaves = (group != nullptr) ? group->slaves :
+        ((streamType == StreamType::STREAM_TYPE_ONLINE) ? slaves_ : slaveDevices_);
+    if (slaves.capacity() < num) {
         HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]request number[%u] exceed max substream num[%u], alloc failed.",
-            num, slavesPtr->capacity());
+            num, slaves.capacity());
         return std::vector<Stream>();
     }
-    std::unique_lock<std::mutex> slaveLock(slavesMutex_);
-    if (slavesPtr->size() < num) {
-        HCCL_INFO("[OpBaseStreamManager][AllocSlaves]expanding slave streams, original size[%u], target size[%u].",
-            slavesPtr->size(),
-            num);
-        for (u32 i = slavesPtr->size(); i < num; i++) {
-            slavesPtr->emplace_back(Stream(streamType));
-            if (!(*slavesPtr)[i].ptr()) {
-                // 创建足够数量的slave stream失败，直接返回空vector
-                HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]alloc slave stream[%u] failed.", i);
-                return std::vector<Stream>();
-            }
-            if (streamType != StreamType::STREAM_TYPE_DEVICE) {
-                HcclResult ret = SetSlaveMode((*slavesPtr)[i]);
-                if (ret != HCCL_SUCCESS) {
-                    HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]set mode to slave stream[%u] failed.", i);
-                    return std::vector<Stream>();
-                }
+    if (ExpandSlaves(streamType, master, slaves, num) != HCCL_SUCCESS) {
+        return std::vector<Stream>();
+    }
+    HCCL_INFO("[OpBaseStreamManager][AllocSlaves]find enough slave streams, return size[%u], shared[%d].", num,
+        group != nullptr);
+    return std::vector<Stream>(slaves.begin(), slaves.begin() + num);
+}
+
+HcclResult OpBaseStreamManager::ExpandSlaves(const StreamType streamType, Stream &master, std::vector<Stream> &slaves,
+    u32 num)
+{
+    if (slaves.size() >= num) {
+        return HCCL_SUCCESS;
+    }
+    HCCL_INFO("[OpBaseStreamManager][AllocSlaves]expanding slave streams, original size[%u], target size[%u].",
+        slaves.size(), num);
+    for (u32 i = slaves.size(); i < num; i++) {
+        Stream slave(streamType);
+        if (!slave.ptr()) {
+            // 创建足够数量的slave stream失败, 已创建的保留给后续申请
+            HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]alloc slave stream[%u] failed.", i);
+            return HCCL_E_INTERNAL;
+        }
+        if (streamType != StreamType::STREAM_TYPE_DEVICE) {
+            HcclResult ret = SetSlaveMode(master, slave);
+            if (ret != HCCL_SUCCESS) {
+                HCCL_ERROR("[OpBaseStreamManager][AllocSlaves]set mode to slave stream[%u] failed.", i);
+                return ret;
             }
         }
+        slaves.emplace_back(std::move(slave));
     }
-    HCCL_INFO("[OpBaseStreamManager][AllocSlaves]find enough slave streams, return size[%u].", num);
-    return std::vector<Stream>(slavesPtr->begin(), slavesPtr->begin() + num);
+    return HCCL_SUCCESS;
 }
 
-HcclResult OpBaseStreamManager::SetSlaveMode(Stream &slave)
+HcclResult OpBaseStreamManager::SetSlaveMode(Stream &master, Stream &slave)
 {
-    if (master_) {
+    if (master) {
         uint64_t streamMode = 0;
         HcclResult ret = HCCL_SUCCESS;
-        ret = master_.GetMode(&streamMode);
+        ret = master.GetMode(&streamMode);
         if (ret != HCCL_SUCCESS) {
             HCCL_ERROR("[OpBaseStreamManager][SetSlaveMode]errNo[0x%016llx], get master stream mode failed.",
                 HCCL_ERROR_CODE(ret));
@@ -137,4 +180,27 @@ HcclResult OpBaseStreamManager::ClearSlaves()
     return HCCL_SUCCESS;
 }
 
+bool OpBaseStreamManager::IsSlaveShared()
+{
+    std::unique_lock<std::mutex> lock(masterMutex_);
+    return sharedGroup_ != nullptr;
+}
+
+HcclResult OpBaseStreamManager::AllocSlaveNotifies(const std::string &tag, u32 notifyNum,
+    std::vector<std::shared_ptr<LocalNotify>> &notifies)
+{
+    std::unique_lock<std::mutex> masterLock(masterMutex_);
+    std::shared_ptr<SlaveResourceGroup> group = sharedGroup_;
+    rtStream_t master = sharedMaster_;
+    masterLock.unlock();
+    CHK_PRT_RET(group == nullptr, HCCL_ERROR("[OpBaseStreamManager][AllocSlaveNotifies]slave resource is not "
+        "shared, tag[%s]", tag.c_str()), HCCL_E_INTERNAL);
+
+    std::unique_lock<std::mutex> groupLock(group->groupMutex);
+    CHK_RET(group->notifyManager.Alloc(tag, notifyNum, notifies, NotifyLoadType::HOST_NOTIFY));
+    HCCL_DEBUG("[OpBaseStreamManager][AllocSlaveNotifies]alloc [%u] shared notifies of master[%p].", notifyNum,
+        master);
+    return HCCL_SUCCESS;
+}
+
 }  // namespace hccl
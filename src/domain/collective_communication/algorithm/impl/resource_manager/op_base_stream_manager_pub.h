@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #include "base.h"
 #include "stream_pub.h"
@@ -22,9 +23,14 @@
 namespace hccl {
 constexpr u32 MAX_SUBSTREAM_NUM = 40U; // 最多支持申请的substream数量
 
+class LocalNotify;
+struct SlaveResourceGroup;
+
 class OpBaseStreamManager {
 public:
-    OpBaseStreamManager();
+    // deviceLogicId有效时, online slave stream和host notify从该device的SlaveResourcePool按master stream共享,
+    // 共享后通信域只能使用绑定时的master stream
+    explicit OpBaseStreamManager(s32 deviceLogicId = -1);
     ~OpBaseStreamManager();
 
     // 将指定 stream 注册为 master stream
@@ -45,6 +51,13 @@ public:
     // 清空所有 slave stream
     HcclResult ClearSlaves();
 
+    // 是否与master stream相同的通信域共用slave stream和host notify
+    bool IsSlaveShared();
+
+    // 从当前master stream的共享资源组分配host notify
+    HcclResult AllocSlaveNotifies(const std::string &tag, u32 notifyNum,
+        std::vector<std::shared_ptr<LocalNotify>> &notifies);
+
     // delete copy and move constructors and assign operators
     OpBaseStreamManager(OpBaseStreamManager const&) = delete;                 // Copy construct
     OpBaseStreamManager(OpBaseStreamManager&&) = delete;                      // Move construct
@@ -52,8 +65,13 @@ public:
     OpBaseStreamManager& operator=(OpBaseStreamManager &&) = delete;          // Move assign
 
 private:
-    HcclResult SetSlaveMode(Stream &slave);
+    HcclResult SetSlaveMode(Stream &master, Stream &slave);
+    HcclResult ExpandSlaves(const StreamType streamType, Stream &master, std::vector<Stream> &slaves, u32 num);
+    HcclResult BindSharedGroup(rtStream_t master);
 
+    s32 deviceLogicId_;
+    std::shared_ptr<SlaveResourceGroup> sharedGroup_;  // 绑定的共享资源组, 随通信域销毁释放, 不共享时为空
+    rtStream_t sharedMaster_ = nullptr;                // sharedGroup_对应的master stream
     Stream master_;
     std::vector<Stream> slaves_;
     std::vector<Stream> slaveDevices_;
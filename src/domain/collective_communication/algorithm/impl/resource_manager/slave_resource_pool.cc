@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "slave_resource_pool.h"
+#include "log.h"
+#include "hccl_common.h"
+#include "op_base_stream_manager_pub.h"
+
+namespace hccl {
+HcclResult SlaveResourcePool::GetInstance(s32 deviceLogicId, SlaveResourcePool *&pool)
+{
+    static SlaveResourcePool slaveResourcePool[MAX_MODULE_DEVICE_NUM];
+    CHK_PRT_RET(deviceLogicId < 0 || static_cast<u32>(deviceLogicId) >= MAX_MODULE_DEVICE_NUM,
+        HCCL_ERROR("[SlaveResourcePool][GetInstance]deviceLogicId[%d] is invalid, max[%u]", deviceLogicId,
+            MAX_MODULE_DEVICE_NUM), HCCL_E_PARA);
+    pool = &slaveResourcePool[deviceLogicId];
+    return HCCL_SUCCESS;
+}
+
+HcclResult SlaveResourcePool::Acquire(rtStream_t master, std::shared_ptr<SlaveResourceGroup> &group)
+{
+    CHK_PTR_NULL(master);
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    stat_.acquireCount++;
+    auto iter = groups_.find(master);
+    if (iter != groups_.end()) {
+        group = iter->second.lock();
+        if (group != nullptr) {
+            stat_.shareCount++;
+            HCCL_INFO("[SlaveResourcePool][Acquire]share slave resource of master[%p], owner num[%ld]",
+                master, group.use_count() - 1);
+            return HCCL_SUCCESS;
+        }
+    }
+
+    // 清理已无通信域持有的资源组
+    for (auto it = groups_.begin(); it != groups_.end();) {
+        it = it->second.expired() ? groups_.erase(it) : std::next(it);
+    }
+
+    EXECEPTION_CATCH((group = std::make_shared<SlaveResourceGroup>()), return HCCL_E_PTR);
+    group->slaves.reserve(MAX_SUBSTREAM_NUM);
+    CHK_RET(group->notifyManager.Init());
+    groups_[master] = group;
+    HCCL_INFO("[SlaveResourcePool][Acquire]create slave resource of master[%p], group num[%zu]",
+        master, groups_.size());
+    return HCCL_SUCCESS;
+}
+
+SlaveResourcePoolStat SlaveResourcePool::GetStat()
+{
+    std::unique_lock<std::mutex> lock(poolMutex_);
+    SlaveResourcePoolStat stat = stat_;
+    for (auto &entry : groups_) {
+        std::shared_ptr<SlaveResourceGroup> group = entry.second.lock();
+        if (group == nullptr) {
+            continue;
+        }
+        std::unique_lock<std::mutex> groupLock(group->groupMutex);
+        stat.groupNum++;
+        stat.slaveStreamNum += group->slaves.size();
+    }
+    return stat;
+}
+}  // namespace hccl
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SLAVE_RESOURCE_POOL_H
+#define SLAVE_RESOURCE_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "base.h"
+#include "stream_pub.h"
+#include "queue_notify_manager.h"
+
+namespace hccl {
+// 主流相同的通信域共用的从流和host notify
+struct SlaveResourceGroup {
+    std::mutex groupMutex;
+    std::vector<Stream> slaves;
+    QueueNotifyManager notifyManager;
+};
+
+struct SlaveResourcePoolStat {
+    u32 groupNum{0};        /* 存活的资源组数, 即被共享的主流数 */
+    u32 slaveStreamNum{0};  /* 各资源组已创建的从流总数 */
+    u64 acquireCount{0};    /* 累计获取资源组的次数 */
+    u64 shareCount{0};      /* 命中已有资源组的次数 */
+};
+
+/*
+ * 进程级、按device区分的从流/notify池, 以主流为键管理资源组:
+ * 同一主流上的算子在device上按下发顺序执行, 不会重叠, 因此主流相同的通信域可以共用从流和notify,
+ * 多通信域场景下流和notify的占用不再随通信域数量增长。资源组由绑定的通信域共同持有, 最后一个通信域释放时销毁;
+ * 通信域按tag缓存的算子资源引用了资源组, 因此通信域绑定后不能切换master
+ */
+class SlaveResourcePool {
+public:
+    static HcclResult GetInstance(s32 deviceLogicId, SlaveResourcePool *&pool);
+
+    /* 获取master对应的资源组, 不存在时创建 */
+    HcclResult Acquire(rtStream_t master, std::shared_ptr<SlaveResourceGroup> &group);
+
+    SlaveResourcePoolStat GetStat();
+
+private:
+    std::mutex poolMutex_;
+    std::unordered_map<rtStream_t, std::weak_ptr<SlaveResourceGroup>> groups_;
+    SlaveResourcePoolStat stat_;
+};
+}  // namespace hccl
+#endif /* SLAVE_RESOURCE_POOL_H */
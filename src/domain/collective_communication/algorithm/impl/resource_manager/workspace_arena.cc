@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <algorithm>
+#include "log.h"
+#include "workspace_arena.h"
+
+namespace hccl {
+constexpr u64 WORKSPACE_ARENA_MIN_CLASS_SIZE = 32 * 1024;          // 最小size class为32KB, 满足4KB页对齐
+constexpr u64 WORKSPACE_ARENA_MAX_CLASS_SIZE = 16 * 1024 * 1024;   // 超过16MB的请求单独申请
+constexpr u64 WORKSPACE_ARENA_CHUNK_SIZE = 64 * 1024 * 1024;       // 共享chunk大小
+
+WorkSpaceArena::WorkSpaceArena(WorkSpaceArenaAllocFunc allocFunc) : allocFunc_(allocFunc)
+{
+    if (allocFunc_ == nullptr) {
+        allocFunc_ = [](u64 size) { return DeviceMem::alloc(size); };
+    }
+}
+
+WorkSpaceArena::~WorkSpaceArena()
+{
+    Reset();
+}
+
+u64 WorkSpaceArena::GetClassSize(u64 size)
+{
+    u64 classSize = WORKSPACE_ARENA_MIN_CLASS_SIZE;
+    while (classSize < size) {
+        classSize <<= 1;
+    }
+    return classSize;
+}
+
+HcclResult WorkSpaceArena::AllocChunk(u64 size, DeviceMem &chunk)
+{
+    chunk = allocFunc_(size);
+    CHK_PRT_RET(!chunk, HCCL_ERROR("[WorkSpaceArena][AllocChunk]alloc device mem failed, size[%llu]", size),
+        HCCL_E_MEMORY);
+    stat_.reservedSize += chunk.size();
+    stat_.peakReservedSize = std::max(stat_.peakReservedSize, stat_.reservedSize);
+    stat_.chunkAllocCount++;
+    return HCCL_SUCCESS;
+}
+
+HcclResult WorkSpaceArena::Borrow(u64 size, DeviceMem &mem)
+{
+    CHK_PRT_RET(size == 0, HCCL_ERROR("[WorkSpaceArena][Borrow]size is zero"), HCCL_E_PARA);
+    std::unique_lock<std::mutex> lock(arenaMutex_);
+
+    if (size > WORKSPACE_ARENA_MAX_CLASS_SIZE) {
+        DeviceMem dedicated;
+        CHK_RET(AllocChunk(size, dedicated));
+        mem = DeviceMem::create(dedicated.ptr(), size);
+        dedicatedMems_.emplace(reinterpret_cast<u64>(dedicated.ptr()), std::move(dedicated));
+        stat_.usedSize += size;
+    } else {
+        u64 classSize = GetClassSize(size);
+        u64 addr = 0;
+        auto &freeList = freeLists_[classSize];
+        if (!freeList.empty()) {
+            addr = *freeList.begin();
+            freeList.erase(freeList.begin());
+        } else {
+            if (chunks_.empty() || chunkOffset_ + classSize > chunks_.back().size()) {
+                DeviceMem chunk;
+                CHK_RET(AllocChunk(WORKSPACE_ARENA_CHUNK_SIZE, chunk));
+                chunks_.push_back(std::move(chunk));
+                chunkOffset_ = 0;
+            }
+            addr = reinterpret_cast<u64>(chunks_.back().ptr()) + chunkOffset_;
+            chunkOffset_ += classSize;
+        }
+        borrowedClass_.emplace(addr, classSize);
+        mem = DeviceMem::create(reinterpret_cast<void *>(addr), size);
+        stat_.usedSize += classSize;
+    }
+    stat_.peakUsedSize = std::max(stat_.peakUsedSize, stat_.usedSize);
+    stat_.borrowCount++;
+
+    HCCL_DEBUG("[WorkSpaceArena][Borrow]borrow success, ptr[%p] size[%llu] usedSize[%llu] peakUsedSize[%llu]",
+        mem.ptr(), size, stat_.usedSize, stat_.peakUsedSize);
+    return HCCL_SUCCESS;
+}
+
+HcclResult WorkSpaceArena::Return(const DeviceMem &mem)
+{
+    u64 addr = reinterpret_cast<u64>(mem.ptr());
+    std::unique_lock<std::mutex> lock(arenaMutex_);
+
+    auto dedicatedIter = dedicatedMems_.find(addr);
+    if (dedicatedIter != dedicatedMems_.end()) {
+        stat_.usedSize -= mem.size();
+        stat_.reservedSize -= dedicatedIter->second.size();
+        dedicatedMems_.erase(dedicatedIter);
+        return HCCL_SUCCESS;
+    }
+
+    auto borrowedIter = borrowedClass_.find(addr);
+    CHK_PRT_RET(borrowedIter == borrowedClass_.end(),
+        HCCL_ERROR("[WorkSpaceArena][Return]ptr[%p] is not borrowed from arena", mem.ptr()), HCCL_E_PARA);
+    stat_.usedSize -= borrowedIter->second;
+    freeLists_[borrowedIter->second].insert(addr);
+    borrowedClass_.erase(borrowedIter);
+    return HCCL_SUCCESS;
+}
+
+void WorkSpaceArena::Reset()
+{
+    std::unique_lock<std::mutex> lock(arenaMutex_);
+    if (stat_.chunkAllocCount != 0) {
+        HCCL_INFO("[WorkSpaceArena][Reset]peakUsedSize[%llu] peakReservedSize[%llu] borrowCount[%llu] "
+            "chunkAllocCount[%llu]", stat_.peakUsedSize, stat_.peakReservedSize, stat_.borrowCount,
+            stat_.chunkAllocCount);
+    }
+    if (!borrowedClass_.empty() || !dedicatedMems_.empty()) {
+        HCCL_WARNING("[WorkSpaceArena][Reset]release arena with [%zu] borrowed ranges and [%zu] dedicated mems",
+            borrowedClass_.size(), dedicatedMems_.size());
+    }
+    freeLists_.clear();
+    borrowedClass_.clear();
+    dedicatedMems_.clear();
+    chunks_.clear();
+    chunkOffset_ = 0;
+    stat_.reservedSize = 0;
+    stat_.usedSize = 0;
+}
+
+WorkSpaceArenaStat WorkSpaceArena::GetStat()
+{
+    std::unique_lock<std::mutex> lock(arenaMutex_);
+    return stat_;
+}
+}  // namespace hccl
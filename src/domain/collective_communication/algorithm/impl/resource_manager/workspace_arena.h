@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef WORKSPACE_ARENA_H
+#define WORKSPACE_ARENA_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+#include "base.h"
+#include "mem_device_pub.h"
+
+namespace hccl {
+using WorkSpaceArenaAllocFunc = std::function<DeviceMem(u64 size)>;
+
+struct WorkSpaceArenaStat {
+    u64 reservedSize{0};    /* 已向device申请的内存大小 */
+    u64 usedSize{0};        /* 当前被tag借用的内存大小(按size class取整) */
+    u64 peakUsedSize{0};    /* usedSize的峰值 */
+    u64 peakReservedSize{0}; /* reservedSize的峰值 */
+    u64 borrowCount{0};
+    u64 chunkAllocCount{0};
+};
+
+/*
+ * 各tag共享的workspace内存池:
+ * 1. 不超过 WORKSPACE_ARENA_MAX_CLASS_SIZE 的请求按2的幂次size class取整, 从共享chunk中顺序切分,
+ *    归还后挂到对应size class的空闲链表, 供后续tag复用;
+ * 2. 超过上限的请求单独申请, 归还时立即释放。
+ * 空闲链表按地址有序, 每次取最低地址, 因此相同的借用/归还序列在各rank上得到相同的偏移。
+ */
+class WorkSpaceArena {
+public:
+    explicit WorkSpaceArena(WorkSpaceArenaAllocFunc allocFunc = nullptr);
+    ~WorkSpaceArena();
+
+    /* 借用一段内存, mem为不持有所有权的视图, 大小为请求的size */
+    HcclResult Borrow(u64 size, DeviceMem &mem);
+
+    /* 归还Borrow得到的内存 */
+    HcclResult Return(const DeviceMem &mem);
+
+    /* 释放全部chunk, 调用前需保证已无tag在使用 */
+    void Reset();
+
+    WorkSpaceArenaStat GetStat();
+
+private:
+    static u64 GetClassSize(u64 size);
+    HcclResult AllocChunk(u64 size, DeviceMem &chunk);
+
+    WorkSpaceArenaAllocFunc allocFunc_;
+    std::mutex arenaMutex_;
+    std::vector<DeviceMem> chunks_;                     /* 共享chunk, 按申请顺序排列 */
+    u64 chunkOffset_{0};                                 /* 最后一个chunk中已切分的偏移 */
+    std::map<u64, std::set<u64>> freeLists_;             /* size class -> 空闲地址(有序) */
+    std::map<u64, u64> borrowedClass_;                   /* 借出地址 -> size class */
+    std::map<u64, DeviceMem> dedicatedMems_;             /* 超大请求单独申请的内存 */
+    WorkSpaceArenaStat stat_;
+};
+}  // namespace hccl
+#endif /* WORKSPACE_ARENA_H */
@@ -11,11 +11,79 @@
 #include "workspace_mem.h"
 
 namespace hccl {
+namespace {
+std::atomic<u64> g_workSpaceMemInstanceId{0};
 
-WorkSpaceMem::WorkSpaceMem() = default;
+struct WorkSpaceMemHandleCache {
+    u64 instanceId = 0;
+    std::string tag;
+    WorkSpaceMemHandle handle = INVALID_WORKSPACE_MEM_HANDLE;
+};
+thread_local WorkSpaceMemHandleCache g_handleCache;
+}
+
+WorkSpaceMem::WorkSpaceMem() : instanceId_(g_workSpaceMemInstanceId.fetch_add(1, std::memory_order_relaxed) + 1)
+{
+}
 
 WorkSpaceMem::~WorkSpaceMem()= default;
 
+WorkSpaceMemSlot *WorkSpaceMem::GetSlot(WorkSpaceMemHandle handle)
+{
+    if (handle == INVALID_WORKSPACE_MEM_HANDLE) {
+        return nullptr;
+    }
+    u32 index = static_cast<u32>(handle & 0xFFFFFFFFULL);
+    u32 generation = static_cast<u32>(handle >> 32);
+    if (index >= SLOT_SEGMENT_SIZE * SLOT_SEGMENT_NUM) {
+        return nullptr;
+    }
+    WorkSpaceMemSlot *segment = slotSegments_[index / SLOT_SEGMENT_SIZE].load(std::memory_order_acquire);
+    if (segment == nullptr) {
+        return nullptr;
+    }
+    WorkSpaceMemSlot *slot = &segment[index % SLOT_SEGMENT_SIZE];
+    return (slot->generation.load(std::memory_order_acquire) == generation) ? slot : nullptr;
+}
+
+/* 调用者需持有memResMutex_ */
+WorkSpaceMemHandle WorkSpaceMem::InternTag(const std::string &tag)
+{
+    auto handleIter = tagHandles_.find(tag);
+    if (handleIter != tagHandles_.end()) {
+        return handleIter->second;
+    }
+
+    u32 index = 0;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        if (slotNum_ >= SLOT_SEGMENT_SIZE * SLOT_SEGMENT_NUM) {
+            HCCL_ERROR("[WorkSpaceMem][InternTag]tag num exceeds limit[%u], tag[%s]",
+                SLOT_SEGMENT_SIZE * SLOT_SEGMENT_NUM, tag.c_str());
+            return INVALID_WORKSPACE_MEM_HANDLE;
+        }
+        index = slotNum_;
+        if (index % SLOT_SEGMENT_SIZE == 0) {
+            std::unique_ptr<WorkSpaceMemSlot[]> segment(new (std::nothrow) WorkSpaceMemSlot[SLOT_SEGMENT_SIZE]);
+            if (segment == nullptr) {
+                HCCL_ERROR("[WorkSpaceMem][InternTag]alloc slot segment failed, tag[%s]", tag.c_str());
+                return INVALID_WORKSPACE_MEM_HANDLE;
+            }
+            slotSegments_[index / SLOT_SEGMENT_SIZE].store(segment.get(), std::memory_order_release);
+            slotSegmentHolder_.push_back(std::move(segment));
+        }
+        slotNum_++;
+    }
+
+    WorkSpaceMemSlot *segment = slotSegments_[index / SLOT_SEGMENT_SIZE].load(std::memory_order_relaxed);
+    u32 generation = segment[index % SLOT_SEGMENT_SIZE].generation.load(std::memory_order_relaxed);
+    WorkSpaceMemHandle handle = (static_cast<u64>(generation) << 32) | index;
+    tagHandles_.emplace(tag, handle);
+    return handle;
+}
+
 /* 适配GE，设备内存由上层分配，HCCL主要用于管理该设备内存 */
 HcclResult WorkSpaceMem::SetMemResource(const std::string &tag, void *ptr, u64 maxSize)
 {
@@ -24,11 +92,13 @@ HcclResult WorkSpaceMem::SetMemResource(const std::string &tag, void *ptr, u64 m
         return HCCL_E_PTR;
     } else {
         std::unique_lock<std::mutex> lock(memResMutex_);
-        WorkSpaceMem_t memResource{};
-        memResource.curPtr = ptr;
-        memResource.maxSize = maxSize;
-        memResMap_.erase(tag);
-        memResMap_.insert(std::make_pair(tag, memResource));
+        WorkSpaceMemSlot *slot = GetSlot(InternTag(tag));
+        CHK_PTR_NULL(slot);
+        // 先将maxSize清零阻止并发分配, 再发布新的内存资源
+        slot->maxSize.store(0, std::memory_order_release);
+        slot->totalSize.store(0, std::memory_order_relaxed);
+        slot->basePtr.store(reinterpret_cast<u64>(ptr), std::memory_order_relaxed);
+        slot->maxSize.store(maxSize, std::memory_order_release);
         lock.unlock();
         HCCL_INFO("[Set][MemResource]set mem resource success, tag[%s] ptr[%llu] max size[%llu]",
             tag.c_str(), std::hash<void *>{}(ptr), maxSize);
@@ -36,37 +106,63 @@ HcclResult WorkSpaceMem::SetMemResource(const std::string &tag, void *ptr, u64 m
     return HCCL_SUCCESS;
 }
 
-void* WorkSpaceMem::AllocMem(const std::string &tag, u64 size)
+WorkSpaceMemHandle WorkSpaceMem::GetHandle(const std::string &tag)
 {
-    /* 此处可能会与并发，加锁 */
+    handleLookupCount_.fetch_add(1, std::memory_order_relaxed);
     std::unique_lock<std::mutex> lock(memResMutex_);
+    auto handleIter = tagHandles_.find(tag);
+    return (handleIter == tagHandles_.end()) ? INVALID_WORKSPACE_MEM_HANDLE : handleIter->second;
+}
 
-    auto interIter = memResMap_.find(tag);
-    if (interIter == memResMap_.end()) {
-        HCCL_ERROR("[Alloc][Mem] Can't find tag, tag[%s], size[%llu]", tag.c_str(), size);
-        return nullptr;
+WorkSpaceMemHandle WorkSpaceMem::GetCachedHandle(const std::string &tag)
+{
+    // 槽位代数在销毁时递增, 缓存的句柄只要仍能取到槽位即仍属于该tag
+    if (g_handleCache.instanceId == instanceId_ && g_handleCache.tag == tag &&
+        GetSlot(g_handleCache.handle) != nullptr) {
+        return g_handleCache.handle;
     }
-    if (interIter->second.curPtr == nullptr) {
-        HCCL_ERROR("[Alloc][Mem] Current resource(curPtr) is null, tag[%s], size[%llu]", tag.c_str(), size);
-        return nullptr;
+    WorkSpaceMemHandle handle = GetHandle(tag);
+    if (handle != INVALID_WORKSPACE_MEM_HANDLE) {
+        g_handleCache.instanceId = instanceId_;
+        g_handleCache.tag = tag;
+        g_handleCache.handle = handle;
     }
+    return handle;
+}
 
-    // 判断size 是否超出最大值
-    if (interIter->second.maxSize < (interIter->second.totalSize + size)) {
-        HCCL_ERROR("[Alloc][Mem] Current resource size is not enough, tag[%s], size[%llu], "\
-            "maxSize[%llu], totalSize[%llu]", tag.c_str(), size,
-            interIter->second.maxSize, interIter->second.totalSize);
+u64 WorkSpaceMem::GetHandleLookupCount() const
+{
+    return handleLookupCount_.load(std::memory_order_relaxed);
+}
+
+void* WorkSpaceMem::AllocMem(WorkSpaceMemHandle handle, u64 size, const std::string &tag)
+{
+    WorkSpaceMemSlot *slot = GetSlot(handle);
+    if (slot == nullptr) {
+        HCCL_ERROR("[Alloc][Mem] Can't find tag, tag[%s], handle[0x%llx], size[%llu]", tag.c_str(), handle, size);
+        return nullptr;
+    }
+    u64 maxSize = slot->maxSize.load(std::memory_order_acquire);
+    u64 basePtr = slot->basePtr.load(std::memory_order_relaxed);
+    if (basePtr == 0) {
+        HCCL_ERROR("[Alloc][Mem] Current resource(curPtr) is null, tag[%s], size[%llu]", tag.c_str(), size);
         return nullptr;
     }
 
-    void* tempPtr = interIter->second.curPtr;
-    interIter->second.curPtr = reinterpret_cast<void *>(static_cast<char *>(interIter->second.curPtr) + size);
-    interIter->second.totalSize += size;
+    /* 此处可能会与并发, 通过CAS推进已分配大小 */
+    u64 totalSize = slot->totalSize.load(std::memory_order_relaxed);
+    do {
+        // 判断size 是否超出最大值
+        if (maxSize < (totalSize + size)) {
+            HCCL_ERROR("[Alloc][Mem] Current resource size is not enough, tag[%s], size[%llu], "\
+                "maxSize[%llu], totalSize[%llu]", tag.c_str(), size, maxSize, totalSize);
+            return nullptr;
+        }
+    } while (!slot->totalSize.compare_exchange_weak(totalSize, totalSize + size, std::memory_order_relaxed));
 
     HCCL_INFO("[Alloc][Mem]Alloc mem success, tag[%s] size[%llu], totalSize[%llu], maxSize[%llu]",
-        tag.c_str(), size, interIter->second.totalSize, interIter->second.maxSize);
-    lock.unlock();
-    return tempPtr;
+        tag.c_str(), size, totalSize + size, maxSize);
+    return reinterpret_cast<void *>(basePtr + totalSize);
 }
 
 HcclResult WorkSpaceMem::DestroyMemResource(const std::string &tag)
@@ -75,9 +171,18 @@ HcclResult WorkSpaceMem::DestroyMemResource(const std::string &tag)
 
     std::unique_lock<std::mutex> lock(memResMutex_);
 
-    auto interIter = memResMap_.find(tag);
-    if (interIter != memResMap_.end()) {
-        memResMap_.erase(tag);
+    auto handleIter = tagHandles_.find(tag);
+    if (handleIter != tagHandles_.end()) {
+        WorkSpaceMemSlot *slot = GetSlot(handleIter->second);
+        if (slot != nullptr) {
+            // 代数递增使旧句柄失效, 槽位回收复用
+            slot->maxSize.store(0, std::memory_order_release);
+            slot->basePtr.store(0, std::memory_order_relaxed);
+            slot->totalSize.store(0, std::memory_order_relaxed);
+            slot->generation.fetch_add(1, std::memory_order_release);
+            freeSlots_.push_back(static_cast<u32>(handleIter->second & 0xFFFFFFFFULL));
+        }
+        tagHandles_.erase(handleIter);
     }
     lock.unlock();
 
@@ -88,14 +193,35 @@ void WorkSpaceMem::DestroyMemResource()
 {
     HCCL_INFO("[Destroy][MemResource]Destroy workspace all mem");
     std::unique_lock<std::mutex> lock(memResMutex_);
-    memResMap_.clear();
+    for (auto &handleIter : tagHandles_) {
+        WorkSpaceMemSlot *slot = GetSlot(handleIter.second);
+        if (slot != nullptr) {
+            slot->maxSize.store(0, std::memory_order_release);
+            slot->basePtr.store(0, std::memory_order_relaxed);
+            slot->totalSize.store(0, std::memory_order_relaxed);
+            slot->generation.fetch_add(1, std::memory_order_release);
+            freeSlots_.push_back(static_cast<u32>(handleIter.second & 0xFFFFFFFFULL));
+        }
+    }
+    tagHandles_.clear();
     lock.unlock();
 }
 
 bool WorkSpaceMem::IsExist(const std::string &tag)
 {
     std::unique_lock<std::mutex> lock(memResMutex_);
-    auto interIter = memResMap_.find(tag);
-    return interIter != memResMap_.end();
+    auto handleIter = tagHandles_.find(tag);
+    return handleIter != tagHandles_.end();
+}
+
+u64 WorkSpaceMem::GetMaxSize(const std::string &tag)
+{
+    std::unique_lock<std::mutex> lock(memResMutex_);
+    auto handleIter = tagHandles_.find(tag);
+    if (handleIter == tagHandles_.end()) {
+        return 0;
+    }
+    WorkSpaceMemSlot *slot = GetSlot(handleIter->second);
+    return (slot == nullptr) ? 0 : slot->maxSize.load(std::memory_order_acquire);
 }
 }  // namespace hccl
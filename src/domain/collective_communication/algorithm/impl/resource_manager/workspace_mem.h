@@ -14,14 +14,23 @@
 #include <string>
 #include <cstdio>
 #include <mutex>
-#include <map>
+#include <atomic>
+#include <array>
+#include <memory>
+#include <vector>
+#include <unordered_map>
 #include "base.h"
 
 namespace hccl {
-using WorkSpaceMem_t = struct tagWorkSpaceMem {
-    void* curPtr{nullptr};
-    u64 maxSize{0};    /* 最大的内存大小 */
-    u64 totalSize{0};  /* 当前已累积的内存大小 */
+/* tag驻留后得到的句柄: 低32位为槽位下标, 高32位为槽位代数, 槽位被复用后旧句柄自动失效 */
+using WorkSpaceMemHandle = u64;
+constexpr WorkSpaceMemHandle INVALID_WORKSPACE_MEM_HANDLE = 0xFFFFFFFFFFFFFFFFULL;
+
+struct WorkSpaceMemSlot {
+    std::atomic<u64> basePtr{0};
+    std::atomic<u64> maxSize{0};    /* 最大的内存大小 */
+    std::atomic<u64> totalSize{0};  /* 当前已累积的内存大小 */
+    std::atomic<u32> generation{0};
 };
 
 class WorkSpaceMem {
@@ -33,8 +42,17 @@ public:
     /* 设置全局资源 */
     HcclResult SetMemResource(const std::string &tag, void *ptr, u64 maxSize);
 
-    /* 内存分配 */
-    void* AllocMem(const std::string &tag, u64 size);
+    /* 获取tag对应的句柄, 未设置资源时返回INVALID_WORKSPACE_MEM_HANDLE */
+    WorkSpaceMemHandle GetHandle(const std::string &tag);
+
+    /* 获取tag对应的句柄, 先查线程本地缓存; 缓存的句柄已失效(tag被销毁后重设)时回退到GetHandle并刷新缓存 */
+    WorkSpaceMemHandle GetCachedHandle(const std::string &tag);
+
+    /* GetHandle加锁查找的累计次数 */
+    u64 GetHandleLookupCount() const;
+
+    /* 基于句柄的内存分配, 不持锁; tag仅用于日志 */
+    void* AllocMem(WorkSpaceMemHandle handle, u64 size, const std::string &tag);
     
     /* 基于tag销毁资源  */
     HcclResult DestroyMemResource(const std::string &tag);
@@ -44,9 +62,24 @@ public:
     
     bool IsExist(const std::string &tag);
 
-    std::map<std::string, WorkSpaceMem_t>  memResMap_;
+    u64 GetMaxSize(const std::string &tag);
+
 private:
+    static constexpr u32 SLOT_SEGMENT_SIZE = 1024;
+    static constexpr u32 SLOT_SEGMENT_NUM = 1024;
+
+    WorkSpaceMemSlot *GetSlot(WorkSpaceMemHandle handle);
+    WorkSpaceMemHandle InternTag(const std::string &tag);
+
+    /* 槽位分段存放, 已发布的分段地址不再变化, 读路径无需加锁 */
+    std::array<std::atomic<WorkSpaceMemSlot *>, SLOT_SEGMENT_NUM> slotSegments_{};
+    std::vector<std::unique_ptr<WorkSpaceMemSlot[]>> slotSegmentHolder_;
+    u32 slotNum_ = 0;
+    std::vector<u32> freeSlots_;
+    std::unordered_map<std::string, WorkSpaceMemHandle> tagHandles_;
     std::mutex memResMutex_;
+    const u64 instanceId_;  /* 区分不同实例的线程本地缓存, 实例地址可能被复用, 不能以this作为键 */
+    std::atomic<u64> handleLookupCount_{0};
 };
 }  // namespace hccl
 #endif /* * WORKSPACE_MEM_H */
@@ -26,6 +26,9 @@ WorkspaceResourceImpl::WorkspaceResourceImpl(u32 devicePhyId, s32 deviceLogicId,
 
 WorkspaceResourceImpl::~WorkspaceResourceImpl()
 {
+    for (auto &devMemIter : opBaseDeviceMemMap_) {
+        (void)workSpaceArena_.Return(devMemIter.second);
+    }
     opBaseDeviceMemMap_.clear();
     remoteOpStreamMap_.clear();
 }
@@ -160,7 +163,9 @@ HcclResult WorkspaceResourceImpl::DestroyStream(const std::string &tag)
 // 基于tag 分配 DeviceMem 资源
 DeviceMem WorkspaceResourceImpl::AllocDeviceMem(const std::string &tag, u64 size)
 {
-    return DeviceMem::create(workSpaceMem_.AllocMem(tag, size), size);
+    // 同一tag的连续分配复用缓存的句柄, 仅首次或tag重设后加锁查找, 分配本身通过句柄无锁推进
+    WorkSpaceMemHandle handle = workSpaceMem_.GetCachedHandle(tag);
+    return DeviceMem::create(workSpaceMem_.AllocMem(handle, size, tag), size);
 }
 
 // 基于tag 销毁 DeviceMem 资源
@@ -186,10 +191,25 @@ HcclResult WorkspaceResourceImpl::GetDevMemSize(const std::string &tag)
     }
 }
 
+/* 调用者需持有memResMutex_ */
+void WorkspaceResourceImpl::ReturnDevMemLocked(const std::string &tag)
+{
+    auto devMemIter = opBaseDeviceMemMap_.find(tag);
+    if (devMemIter == opBaseDeviceMemMap_.end()) {
+        return;
+    }
+    HcclResult ret = workSpaceArena_.Return(devMemIter->second);
+    if (ret != HCCL_SUCCESS) {
+        HCCL_ERROR("[WorkspaceResourceImpl][ReturnDevMemLocked]return workspace mem failed, tag[%s] ret[%d]",
+            tag.c_str(), ret);
+    }
+    opBaseDeviceMemMap_.erase(devMemIter);
+}
+
 HcclResult WorkspaceResourceImpl::InsertDevMem(const std::string &tag, DeviceMem &deviceMem)
 {
     std::unique_lock<std::mutex> lock(memResMutex_);
-    opBaseDeviceMemMap_.erase(tag);
+    ReturnDevMemLocked(tag);
     opBaseDeviceMemMap_.insert(std::pair<std::string, DeviceMem>(tag, std::move(deviceMem)));
     lock.unlock();
     return HCCL_SUCCESS;
@@ -198,7 +218,7 @@ HcclResult WorkspaceResourceImpl::InsertDevMem(const std::string &tag, DeviceMem
 HcclResult WorkspaceResourceImpl::DestroyRemoteOpBasedMem(const std::string &tag)
 {
     std::unique_lock<std::mutex> lock(memResMutex_);
-    opBaseDeviceMemMap_.erase(tag);
+    ReturnDevMemLocked(tag);
     remoteOpStreamMap_.erase(tag);
     lock.unlock();
 
@@ -248,15 +268,21 @@ HcclResult WorkspaceResourceImpl::CreateOpBasedResources(const HcclCMDType &opTy
     u64 memSize = 0;
     CHK_RET(GetOpBasedMemSize(opType, memSize, opInfo));
 
-    // 创建 device memory
-    DeviceMem deviceMem = DeviceMem::alloc(memSize);
-    CHK_PRT_RET(!deviceMem, HCCL_ERROR("[WorkspaceResourceImpl][CreateOpBasedResources]In create workspace mem,"
-        " malloc failed."), HCCL_E_MEMORY);
+    // 从各tag共享的workspace内存池中借用 device memory
+    DeviceMem deviceMem;
+    HcclResult ret = workSpaceArena_.Borrow(memSize, deviceMem);
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[WorkspaceResourceImpl][CreateOpBasedResources]In create workspace "
+        "mem, borrow from arena failed. ret[%d]", ret), HCCL_E_MEMORY);
     std::vector<rtStream_t> stream;
     u64 maxSize = deviceMem.size();
-    CHK_RET(SetWorkspaceResource(tag, deviceMem.ptr(), maxSize, stream));
+    ret = SetWorkspaceResource(tag, deviceMem.ptr(), maxSize, stream);
+    if (ret != HCCL_SUCCESS) {
+        (void)workSpaceArena_.Return(deviceMem);
+        return ret;
+    }
     HCCL_INFO("[WorkspaceResourceImpl][CreateOpBasedResources]create workspace memory success. "
-        "tag[%s] workspace addr[%p] workspace size[%llu].", tag.c_str(), deviceMem.ptr(), deviceMem.size());
+        "tag[%s] workspace addr[%p] workspace size[%llu] arena peak used size[%llu].", tag.c_str(), deviceMem.ptr(),
+        deviceMem.size(), workSpaceArena_.GetStat().peakUsedSize);
     CHK_RET(InsertDevMem(tag, deviceMem));
     return HCCL_SUCCESS;
 }
@@ -274,12 +300,17 @@ HcclResult WorkspaceResourceImpl::InsertRemoteOpStream(const std::string &tag, s
 HcclResult WorkspaceResourceImpl::CreateAndInsertDevMem(const std::string &tag, u64 memSize,
     std::vector<rtStream_t> &streamPtr)
 {
-    // 创建device memory
-    DeviceMem deviceMem = DeviceMem::alloc(memSize);
-    CHK_PRT_RET(!deviceMem, HCCL_ERROR("[WorkspaceResourceImpl][CreateAndInsertDevMem]"
-        "In create workspace mem malloc failed."), HCCL_E_MEMORY);
+    // 从各tag共享的workspace内存池中借用 device memory
+    DeviceMem deviceMem;
+    HcclResult ret = workSpaceArena_.Borrow(memSize, deviceMem);
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[WorkspaceResourceImpl][CreateAndInsertDevMem]"
+        "In create workspace mem borrow from arena failed. ret[%d]", ret), HCCL_E_MEMORY);
 
-    CHK_RET(SetWorkspaceResource(tag, deviceMem.ptr(), memSize, streamPtr));
+    ret = SetWorkspaceResource(tag, deviceMem.ptr(), memSize, streamPtr);
+    if (ret != HCCL_SUCCESS) {
+        (void)workSpaceArena_.Return(deviceMem);
+        return ret;
+    }
         HCCL_INFO("[WorkspaceResourceImpl][CreateAndInsertDevMem]create workspace memory success. "
             "tag[%s] workspace addr[%p] workspace size[%llu]", tag.c_str(), deviceMem.ptr(), deviceMem.size());
 
@@ -336,8 +367,7 @@ HcclResult WorkspaceResourceImpl::CreateRemoteOpBasedResources(u64 memSize, cons
 HcclResult WorkspaceResourceImpl::CreateOrUpdateRemoteOpBasedResources(u64 memSize, const std::string &tag)
 {
     if (IsExistResourceWorkSpaceMem(tag)) {
-        auto interMemIter = workSpaceMem_.memResMap_.find(tag);
-        if (interMemIter->second.maxSize >= memSize) {
+        if (workSpaceMem_.GetMaxSize(tag) >= memSize) {
             HCCL_INFO("[WorkspaceResourceImpl][CreateOrUpdateRemoteOpBasedResources]tag[%s] is exit, "
                 "and memSize meets the requirements, don't create workspace Memory", tag.c_str());
             return HCCL_SUCCESS;
@@ -19,6 +19,7 @@
 #include "stream_pub.h"
 #include "mem_device_pub.h"
 #include "workspace_mem.h"
+#include "workspace_arena.h"
 #include "ccl_buffer_manager.h"
 #include "offload_stream_manager_pub.h"
 
@@ -74,10 +75,12 @@ private:
     HcclResult InsertDevMem(const std::string &tag, DeviceMem &deviceMem);
     HcclResult InsertRemoteOpStream(const std::string &tag, std::vector<Stream> &stream);
     HcclResult GetOpBasedMemSize(const HcclCMDType &opType, u64 &size, const HcomCollOpInfo &opInfo);
+    void ReturnDevMemLocked(const std::string &tag);
 
     OffloadStreamManager offloadStreamManager_;
     std::map<std::string, std::vector<Stream>> remoteOpStreamMap_;  // 当前实际没什么用
-    std::map<std::string, DeviceMem> opBaseDeviceMemMap_;
+    std::map<std::string, DeviceMem> opBaseDeviceMemMap_;  // 从workSpaceArena_借用的内存, 不持有所有权
+    WorkSpaceArena workSpaceArena_;
     u32 devicePhyId_;
     s32 deviceLogicId_;
     u64 bufferQuota_ = 0;  // 可分配的buffer大小
@@ -8,12 +8,19 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <sched.h>
+#include <atomic>
 #include "parallel_task_loader.h"
 #include "profiling_manager_pub.h"
+#include "env_config.h"
 
 namespace hccl {
+// 进程内已创建的ParallelTaskLoader计数, 用于为不同通信域错开绑核位置
+static std::atomic<u32> g_parallelTaskLoaderCount(0);
+
 ParallelTaskLoader::ParallelTaskLoader(const s32 deviceLogicId, const HcclDispatcher dispatcher)
-    : deviceLogicId_(deviceLogicId), dispatcher_(dispatcher), taskLoaderNum_(0)
+    : deviceLogicId_(deviceLogicId), dispatcher_(dispatcher),
+      instanceIndex_(g_parallelTaskLoaderCount.fetch_add(1, std::memory_order_relaxed)), taskLoaderNum_(0)
 {}
 
 ParallelTaskLoader::~ParallelTaskLoader()
@@ -36,11 +43,12 @@ HcclResult ParallelTaskLoader::Prepare(std::vector<Stream *> streamsPtr, SubComm
     }
 
     streamTaskLoader_.resize(streamsPtr_.size());
+    GenerateCpuAffinityHints(streamsPtr_.size());
     // 当前现有的taskLoader无法满足业务多流的使用，需要扩展多流资源
     for (u32 streamIndex = taskLoaderNum_; streamIndex < streamsPtr_.size(); streamIndex++) {
         streamTaskLoader_[streamIndex].reset(new (std::nothrow) TaskLoader(deviceLogicId_, dispatcher_));
         CHK_SMART_PTR_NULL(streamTaskLoader_[streamIndex]);
-        HcclResult ret = streamTaskLoader_[streamIndex]->Init();
+        HcclResult ret = streamTaskLoader_[streamIndex]->Init(cpuAffinityHints_[streamIndex]);
         CHK_PRT_RET(ret != HCCL_SUCCESS,
             HCCL_ERROR("[ParallelTaskLoader][Init]streamIndex[%u] TaskLoader failed, return[%d]", streamIndex, ret),
             ret);
@@ -51,6 +59,46 @@ HcclResult ParallelTaskLoader::Prepare(std::vector<Stream *> streamsPtr, SubComm
     return HCCL_SUCCESS;
 }
 
+void ParallelTaskLoader::GenerateCpuAffinityHints(u32 loaderNum)
+{
+    cpuAffinityHints_.assign(loaderNum, TaskLoader::INVALID_CPU_AFFINITY);
+
+    // 绑核默认关闭, 仅在HCCL_TASK_LOADER_CPU_BIND=1时开启
+    if (EnvConfig::GetExternalInputTaskLoaderCpuBind() == 0) {
+        return;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0) {
+        HCCL_INFO("[ParallelTaskLoader]get cpu affinity failed, skip binding taskLoader threads");
+        return;
+    }
+    std::vector<s32> allowedCpus;
+    for (s32 cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            allowedCpus.push_back(cpu);
+        }
+    }
+
+    // 可用核数不足以让每个taskLoader独占一个核(并为下发主线程保留一个核)时, 不绑核, 交由OS调度
+    if (allowedCpus.size() <= loaderNum) {
+        HCCL_INFO("[ParallelTaskLoader]allowed cpu num[%zu] is not enough for taskLoader num[%u], skip binding",
+            allowedCpus.size(), loaderNum);
+        return;
+    }
+    // 从可用核的末尾开始分配, 首个可用核留给下发主线程; 起始位置按实例创建序号错开,
+    // 避免多个通信域的taskLoader线程绑到同一组核上
+    u32 candidateNum = allowedCpus.size() - 1;
+    u32 offset = (instanceIndex_ * loaderNum) % candidateNum;
+    for (u32 index = 0; index < loaderNum; index++) {
+        u32 pos = (offset + index) % candidateNum;
+        cpuAffinityHints_[index] = allowedCpus[allowedCpus.size() - 1 - pos];
+    }
+    HCCL_INFO("[ParallelTaskLoader]instance[%u] bind %u taskLoader threads from cpu offset[%u]",
+        instanceIndex_, loaderNum, offset);
+}
+
 HcclResult ParallelTaskLoader::StartTaskLoad()
 {
     tidInfo_.resize(streamsPtr_.size());
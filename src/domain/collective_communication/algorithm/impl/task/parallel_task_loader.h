@@ -31,13 +31,17 @@ public:
 
 protected:
 private:
+    void GenerateCpuAffinityHints(u32 loaderNum);
+
     s32 deviceLogicId_;                        // 当前设备的device id
     const HcclDispatcher dispatcher_;  // dispatcher引用
     SubCommInfo commInfo_;
+    u32 instanceIndex_;  // 本实例在进程内的创建序号, 用于错开不同通信域的绑核位置
 
     std::vector<Stream *> streamsPtr_;
     std::vector<std::shared_ptr<TaskLoader>> streamTaskLoader_;
     std::vector<uint32_t> tidInfo_;
+    std::vector<s32> cpuAffinityHints_;  // taskLoader线程的绑核提示, 与streamTaskLoader_一一对应
     u32 taskLoaderNum_;  // taskLoader的个数和stream的个数一一对应
 };
 }  // namespace hccl
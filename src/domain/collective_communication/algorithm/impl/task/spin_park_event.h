@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SPIN_PARK_EVENT_H
+#define SPIN_PARK_EVENT_H
+
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <hccl/base.h>
+
+namespace hccl {
+/*
+ * 单生产者/单消费者的一次性事件: Notify与Wait一一配对。
+ * Wait先自旋一段时间, 未等到再通过futex挂起; 自旋次数根据最近的命中情况自适应调整,
+ * 忙时线程无需系统调用即可被唤醒, 空闲时线程保持挂起不占用CPU。
+ * 单核环境下自旋只会占用通知方的时间片, 直接挂起。
+ */
+class SpinParkEvent {
+public:
+    SpinParkEvent() : spinLimit_(IsSpinUseful() ? SPIN_LIMIT_DEFAULT : 0) {}
+    ~SpinParkEvent() = default;
+
+    void Notify()
+    {
+        state_.store(EVENT_SIGNALED, std::memory_order_seq_cst);
+        if (parked_.load(std::memory_order_seq_cst)) {
+            FutexWake();
+        }
+    }
+
+    void Wait()
+    {
+        u32 spinLimit = spinLimit_;
+        for (u32 i = 0; i < spinLimit; i++) {
+            if (TryConsume()) {
+                // 自旋命中, 说明通知间隔较短, 放宽下次的自旋上限
+                spinLimit_ = (spinLimit_ >= SPIN_LIMIT_MAX / 2) ? SPIN_LIMIT_MAX : (spinLimit_ * 2);
+                return;
+            }
+            CpuRelax();
+        }
+
+        parked_.store(true, std::memory_order_seq_cst);
+        while (!TryConsume()) {
+            FutexWait();
+        }
+        parked_.store(false, std::memory_order_relaxed);
+        // 需要挂起才等到, 说明当前较空闲, 收紧下次的自旋上限
+        if (spinLimit_ != 0) {
+            spinLimit_ = (spinLimit_ <= SPIN_LIMIT_MIN * 2) ? SPIN_LIMIT_MIN : (spinLimit_ / 2);
+        }
+    }
+
+private:
+    static constexpr u32 EVENT_IDLE = 0;
+    static constexpr u32 EVENT_SIGNALED = 1;
+    static constexpr u32 SPIN_LIMIT_MIN = 64;
+    static constexpr u32 SPIN_LIMIT_MAX = 16384;
+    static constexpr u32 SPIN_LIMIT_DEFAULT = 1024;
+
+    static bool IsSpinUseful()
+    {
+        static const bool spinUseful = std::thread::hardware_concurrency() > 1;
+        return spinUseful;
+    }
+
+    bool TryConsume()
+    {
+        u32 expected = EVENT_SIGNALED;
+        return state_.compare_exchange_strong(expected, EVENT_IDLE, std::memory_order_seq_cst);
+    }
+
+    void FutexWait()
+    {
+        // state_仍为EVENT_IDLE时才会挂起, 避免与Notify之间丢失唤醒
+        (void)syscall(SYS_futex, reinterpret_cast<u32 *>(&state_), FUTEX_WAIT_PRIVATE, EVENT_IDLE, nullptr,
+            nullptr, 0);
+    }
+
+    void FutexWake()
+    {
+        (void)syscall(SYS_futex, reinterpret_cast<u32 *>(&state_), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+            nullptr, 0);
+    }
+
+    static inline void CpuRelax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield" ::: "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    static_assert(sizeof(std::atomic<u32>) == sizeof(u32), "futex word must be 32 bits");
+
+    std::atomic<u32> state_{EVENT_IDLE};
+    std::atomic<bool> parked_{false};
+    u32 spinLimit_; // 仅由等待方线程访问, 为0时不自旋
+};
+}  // namespace hccl
+
+#endif /* SPIN_PARK_EVENT_H */
@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <pthread.h>
+#include <sched.h>
 #include "log.h"
 #include "comm_base_pub.h"
 #include "transport_pub.h"
@@ -35,9 +37,10 @@ void TaskLoader::Prepare(Stream *stream, SubCommInfo level0CommInfo)
     executeResult_ = HCCL_SUCCESS;
 }
 
-HcclResult TaskLoader::Init()
+HcclResult TaskLoader::Init(s32 cpuAffinityHint)
 {
-    HCCL_INFO("[TaskLoader] Init");
+    HCCL_INFO("[TaskLoader] Init cpuAffinityHint[%d]", cpuAffinityHint);
+    cpuAffinityHint_ = cpuAffinityHint;
     ringThread_.reset(new (std::nothrow) std::thread(&TaskLoader::ThreadExecuteFn, this));
     CHK_SMART_PTR_NULL(ringThread_);
     return HCCL_SUCCESS;
@@ -65,38 +68,26 @@ HcclResult TaskLoader::Finalize()
 
 void TaskLoader::NotifyStart()
 {
-    std::unique_lock<std::mutex> lock(startMtx_);
-    startReady = true; // 设置标志位为 true.
-    startCv_.notify_one();
-    workflowMode_ = GetWorkflowMode();  // 每次唤醒前更新下
+    workflowMode_ = GetWorkflowMode();  // 每次唤醒前更新下, 由startEvent_保证对taskLoader线程可见
+    startEvent_.Notify();
     HCCL_INFO("[TaskLoader] NotifyStart");
 }
 
 void TaskLoader::WaitStart()
 {
-    std::unique_lock<std::mutex> lock(startMtx_);
-    while (!startReady) {     // 假设标志位不为 true, 则等待...
-        startCv_.wait(lock); // 当前线程被堵塞, 当标志位变为 true 之后,
-    }
-    startReady = false;
+    startEvent_.Wait();
 
     SetWorkflowMode(workflowMode_); // 更新workflowMode
 }
 
 void TaskLoader::NotifyDone()
 {
-    std::unique_lock<std::mutex> lock(doneMtx_);
-    doneReady = true;
-    doneCv_.notify_one();
+    doneEvent_.Notify();
 }
 
 void TaskLoader::WaitDone()
 {
-    std::unique_lock<std::mutex> lock(doneMtx_);
-    while (!doneReady) {
-        doneCv_.wait(lock);
-    }
-    doneReady = false;
+    doneEvent_.Wait();
 }
 
 HcclResult TaskLoader::ExecuteTransPortTaskInfo(TaskLogicInfo &info)
@@ -209,6 +200,7 @@ HcclResult TaskLoader::ThreadExecuteFn()
 
     threadId_ = SalGetTid();
     HCCL_INFO("[TaskLoader][ThreadExecuteFn]deviceLogicId_[%d], threadId_[%u]", deviceLogicId_, threadId_);
+    BindCpuAffinity();
     CHK_RET(hrtSetDevice(deviceLogicId_));
 
     while (true) {
@@ -229,6 +221,24 @@ HcclResult TaskLoader::ThreadExecuteFn()
     return HCCL_SUCCESS;
 }
 
+void TaskLoader::BindCpuAffinity()
+{
+    if (cpuAffinityHint_ == INVALID_CPU_AFFINITY || cpuAffinityHint_ >= CPU_SETSIZE) {
+        return;
+    }
+    // 亲和性仅作为提示, 设置失败不影响下发流程
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuAffinityHint_, &cpuSet);
+    s32 ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+    if (ret != 0) {
+        HCCL_WARNING("[TaskLoader][BindCpuAffinity]bind threadId_[%u] to cpu[%d] failed, ret[%d]",
+            threadId_, cpuAffinityHint_, ret);
+        return;
+    }
+    HCCL_INFO("[TaskLoader][BindCpuAffinity]threadId_[%u] bind to cpu[%d]", threadId_, cpuAffinityHint_);
+}
+
 uint32_t TaskLoader::GetTid()
 {
     if (threadId_ == 0) {
@@ -12,12 +12,12 @@
 #define HCCL_TASK_LOADER_H
 
 #include <thread>
-#include <condition_variable>
 #include <hccl/base.h>
 #include "stream_pub.h"
 #include "dispatcher.h"
 #include "workflow_pub.h"
 #include "coll_alg_param.h"
+#include "spin_park_event.h"
 
 namespace hccl {
 class TaskLoader {
@@ -27,7 +27,7 @@ public:
 
     void Prepare(Stream *stream, SubCommInfo level0CommInfo);
 
-    HcclResult Init();
+    HcclResult Init(s32 cpuAffinityHint = INVALID_CPU_AFFINITY);
     HcclResult Finalize();
     HcclResult GetExecuteResult();
     void NotifyStart();
@@ -37,9 +37,12 @@ public:
     uint32_t GetTid();
     HcclResult ClearTagCommInfo();
 
+    static constexpr s32 INVALID_CPU_AFFINITY = -1;
+
 protected:
 private:
     HcclResult ThreadExecuteFn();
+    void BindCpuAffinity();
     HcclResult ExecuteService();
     HcclResult ExecuteTaskLogicPara(TaskLogicInfo &info);
     HcclResult ExecuteDispatcherTaskInfo(TaskLogicInfo &info);
@@ -52,13 +55,10 @@ private:
     const HcclDispatcher dispatcher_;  // dispatcher引用
     Stream *stream_;                           // 执行线程对应的stream
     SubCommInfo commInfo_;
-    std::mutex startMtx_;
-    std::mutex doneMtx_;
-    std::condition_variable startCv_;
-    std::condition_variable doneCv_;
-    bool startReady = false;
-    bool doneReady = false;
+    SpinParkEvent startEvent_;                 // 主线程 -> taskLoader线程的启动通知
+    SpinParkEvent doneEvent_;                  // taskLoader线程 -> 主线程的完成通知
     bool threadExit = false;
+    s32 cpuAffinityHint_ = INVALID_CPU_AFFINITY;
     HcclWorkflowMode workflowMode_{HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE};
     HcclResult executeResult_ = HCCL_SUCCESS;
 };
@@ -28,7 +28,7 @@ TopoMatcher::TopoMatcher(const std::vector<std::vector<std::vector<u32>>> CommPl
                          std::vector<std::vector<std::vector<u32>>> &serverAndsuperPodToRank)
     : CommPlaneVector_(CommPlaneRanks), isBridgeVector_(isBridgeVector),
       topoInfo_(topoInfo), algoInfo_(algoInfo), externalEnable_(externalEnable), userRank_(topoInfo.userRank),
-      serverAndsuperPodToRank_(serverAndsuperPodToRank)
+      serverAndsuperPodToRank_(serverAndsuperPodToRank), rohAdjacency_(BuildRohAdjacency(topoInfo.pairLinkInfo))
 {
     SetRankMap();
 }
@@ -105,6 +105,16 @@ HcclResult TopoMatcher::CalcCommPlaneInfo(const std::string &tag, const CommPara
                 isBridgeVector_, userRank_));
             break;
         }
+        case CommType::COMM_TAG_DOUBLE_BINARY_TREE: {
+            calcTransportReq.reset(new (std::nothrow) CalcDBTTransportReq(CommPlaneVector_[commParaInfo.commPlane],
+                isBridgeVector_, userRank_));
+            break;
+        }
+        case CommType::COMM_TAG_CHAIN_KNOMIAL: {
+            calcTransportReq.reset(new (std::nothrow) CalcChainTransportReq(CommPlaneVector_[commParaInfo.commPlane],
+                isBridgeVector_, userRank_));
+            break;
+        }
         case CommType::COMM_TAG_MESH: {
             calcTransportReq.reset(new (std::nothrow) CalcMeshTransportReq(CommPlaneVector_[commParaInfo.commPlane],
                 isBridgeVector_, userRank_));
@@ -294,6 +304,11 @@ u32 TopoMatcher::GetExternalInputInterHccsDisable()
     return externalEnable_.interHccsDisable;
 }
 
+u32 TopoMatcher::GetExternalInputAlltoallvLazyLink()
+{
+    return externalEnable_.alltoallvLazyLink;
+}
+
 bool CheckRankNeighbors(const std::vector<u32> &nicList)
 {
     // 组成ROH环路必须偶数个,且2节点不能组成双环？
@@ -318,14 +333,7 @@ bool CheckRankNeighbors(const std::vector<u32> &nicList)
 // 适配ROH平面网段隔离，奇数rank互通，偶数rank互通，奇偶不通
 bool TopoMatcher::CheckSdmaWithRohTopo(const std::vector<u32> &nicList, std::vector<u32> &topoList)
 {
-    std::vector<u32> tmpNicList(nicList);
-    std::sort(tmpNicList.begin(), tmpNicList.end());
-    SearchPath searchPath;
-    topoList = searchPath.Search(tmpNicList);
-    if (topoList.empty()) {
-        return false;
-    }
-    return true;
+    return SearchRohRing(nicList, topoList, rohAdjacency_);
 }
 
 const u32 TopoMatcher::GetSubCollectiveRank(const std::vector<u32> &vecPara) const
@@ -513,6 +521,18 @@ HcclResult TopoMatcher::GetLocalServerRankSize(const u32 userRank, u32& devNumIn
     return HCCL_SUCCESS;
 }
 
+HcclResult TopoMatcher::GetServerToRank(std::vector<std::vector<u32>> &serverToRank)
+{
+    // 按serverIdx划分的userRank, server内升序排列
+    CHK_PRT_RET(serverAndsuperPodToRank_.empty(),
+        HCCL_ERROR("[GET][GetServerToRank]server to rank info is empty."), HCCL_E_INTERNAL);
+    serverToRank = serverAndsuperPodToRank_[0];
+    for (auto &userRankInServer : serverToRank) {
+        std::sort(userRankInServer.begin(), userRankInServer.end());
+    }
+    return HCCL_SUCCESS;
+}
+
 HcclResult TopoMatcher::SetDeterministicConfig(const u8 deterministic)
 {
     if (deterministic > DETERMINISTIC_STRICT) {
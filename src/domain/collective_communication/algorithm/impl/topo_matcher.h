@@ -19,6 +19,7 @@
 #include "comm_factory_pub.h"
 #include "hccl_common.h"
 #include "calc_impl.h"
+#include "search_path.h"
 
 namespace hccl {
 constexpr u32 COMM_LEVEL1_INDEX = COMM_LEVEL1;
@@ -58,6 +59,7 @@ struct HcclTopoInfo {
     bool useSuperPodMode;
     std::unordered_map<u32, bool> isUsedRdmaMap;
     std::unordered_map<u32, u32> pairLinkCounter; // server内所有device间的链路类型计数
+    PairLinkInfo pairLinkInfo; // server内所有device间的链路类型
 
     std::vector<std::vector<std::vector<std::vector<u32>>>> CommPlaneSubGroupVector; // 保存所有 level 的通信分组信息
     std::map<AHCConcOpType, TemplateType> ahcAlgOption;
@@ -95,6 +97,7 @@ using HcclExternalEnable = struct HcclExternalEnableDef {
     u32 interHccsDisable;
     bool aivMode;
     bool aicpuUnfold;
+    u32 alltoallvLazyLink;
 
     HcclExternalEnableDef()
         : enableRdmaSdmaConcurrent(0),
@@ -104,7 +107,8 @@ using HcclExternalEnable = struct HcclExternalEnableDef {
         dumpDebug(0),
         interHccsDisable(0),
         aivMode(false),
-        aicpuUnfold(false)
+        aicpuUnfold(false),
+        alltoallvLazyLink(0)
     {}
 };
 
@@ -130,6 +134,7 @@ public:
     u32 GetExternalInputIntraRoceSwitch();
     u32 GetExternalInputHcclDumpDebug();
     u32 GetExternalInputInterHccsDisable();
+    u32 GetExternalInputAlltoallvLazyLink();
     bool CheckSdmaWithRohTopo(const std::vector<u32> &nicList, std::vector<u32> &topoList);
     HcclResult GetSubRootForScatter(const u32 root, u32& subRoot);
     u32 GetSubRootUserRank(const u32 userRank, const u32 rootUserRank);
@@ -137,6 +142,7 @@ public:
     u32 GetSubRootWithSuperPod(const u32 userRank, const u32 rootUserRank);
     HcclResult GetLocalSuperPodRankSize(const u32 userRank, u32& devNumInlocalPod, u32& rankIdxInPod);
     HcclResult GetLocalServerRankSize(const u32 userRank, u32& devNumInlocalServer, u32& rankIdxInServer);
+    HcclResult GetServerToRank(std::vector<std::vector<u32>> &serverToRank);
     HcclResult SetDeterministicConfig(const u8 deterministic);
     HcclResult SetAivModeConfig(const bool aivMode);
     HcclResult SetAicpuUnfoldConfig(const bool aicpuUnfold);
@@ -179,6 +185,7 @@ private:
     // serverAndsuperPodToRank_[0]: 通信域在当前superPod内, 按照serverIdx划分的所有rank信息
     // serverAndsuperPodToRank_[1]: 通信域所有rank的信息, 按照superPodId -> RankInfo 的结构划分
     std::vector<std::vector<std::vector<u32>>> serverAndsuperPodToRank_;
+    NicAdjacency rohAdjacency_; // ROH成环使用的可达关系, 带server内实际链路带宽
 
     u32 userRankIdx_ = 0;
 };
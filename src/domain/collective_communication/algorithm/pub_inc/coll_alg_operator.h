@@ -78,6 +78,7 @@ protected:
     bool Is2U2PInfer();
     bool IsMultiMeshInlineReduce(void *inputPtr, void *outputPtr, HcclDataType dataType, HcclReduceOp op);
     bool Is910BSingleMesh();
+    HcclResult SelectPipelineAlgTypeLevel1(HcclCMDType hcclCMDType, u64 dataSize);
     bool NeedCreateSingleMeshPlane(const bool isInlineReduce);
     virtual HcclResult SetExecutorAttr(const OpParam& param);
     HcclResult SelectAlgforAHC(u64 dataSize, AHCOpType ahcOpType);
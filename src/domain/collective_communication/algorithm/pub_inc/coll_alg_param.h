@@ -201,6 +201,7 @@ struct AlgDesc {
     bool isZeroCopy = false;
     bool isAivMode = false;
     s32 aivTagNum = 1;
+    bool isLazyLink = false; // 支持alltoallv按需建链: 仅与本次有数据交互的对端建链
 };
 
 struct ResourceLimit {
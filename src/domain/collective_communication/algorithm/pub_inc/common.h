@@ -54,6 +54,8 @@ enum class AlgTypeLevel1 {
     ALG_LEVEL1_NB,              // 拓扑组合1层，NB
     ALG_LEVEL1_AHC,             // 拓扑组合1层，AHC
     ALG_LEVEL1_AHC_BROKE,       // 拓扑组合1层，AHC_BROKE
+    ALG_LEVEL1_DBT,             // 拓扑组合1层，DBT
+    ALG_LEVEL1_CHAIN,           // 拓扑组合1层，流水链/k叉树, 仅broadcast和reduce使用
     ALG_LEVEL1_RESERVED
 };
  
@@ -207,6 +209,8 @@ const std::map<AlgTypeLevel1, std::string> HCCL_ALGO_LEVEL1_NAME_MAP = {
     {AlgTypeLevel1::ALG_LEVEL1_AHC, "AHC"},
     {AlgTypeLevel1::ALG_LEVEL1_AHC_BROKE, "AHC_BROKE"},
     {AlgTypeLevel1::ALG_LEVEL1_NB, "NB"},
+    {AlgTypeLevel1::ALG_LEVEL1_DBT, "DBT"},
+    {AlgTypeLevel1::ALG_LEVEL1_CHAIN, "CHAIN"},
     {AlgTypeLevel1::ALG_LEVEL1_RESERVED, "null"},
 };
 
@@ -245,6 +249,8 @@ const std::map<AlgTypeLevel1, std::string> HCCL_ALGO_LEVEL1_MAP = {
     {AlgTypeLevel1::ALG_LEVEL1_AHC, "AHC"},
     {AlgTypeLevel1::ALG_LEVEL1_AHC_BROKE, "AHC_BROKE"},
     {AlgTypeLevel1::ALG_LEVEL1_NB, "NB"},
+    {AlgTypeLevel1::ALG_LEVEL1_DBT, "DBT"},
+    {AlgTypeLevel1::ALG_LEVEL1_CHAIN, "CHAIN"},
     {AlgTypeLevel1::ALG_LEVEL1_STAR, "STAR"},
     {AlgTypeLevel1::ALG_LEVEL1_RESERVED, "NA"},
 };
@@ -148,6 +148,16 @@ using HcclOpMetaInfo = struct HcclOpMetaInfoDef {
         return meta;
     }
 
+    static HcclOpMetaInfoDef GetOneForGather(uint32_t rootRank, bool hugeData = false)
+    {
+        HcclOpMetaInfoDef meta;
+        meta.opType = HcclCMDType::HCCL_CMD_GATHER;
+        meta.rootRank = rootRank;
+        meta.hugeData = hugeData;
+        meta.isEnableCache = CheckEnableCache(meta);
+        return meta;
+    }
+
     static HcclOpMetaInfoDef GetOneForReduceScatter(
         u32 algolevel1Type = 0, HcclDataType dataType = HCCL_DATA_TYPE_RESERVED,
         ReduceType reduceType = ReduceType::INLINE_REDUCE, bool hugeData = false,
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef PROF_RECORD_BUFFER_H
+#define PROF_RECORD_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+#include "base.h"
+#include "log.h"
+
+namespace hccl {
+constexpr u64 PROF_RECORD_BUFFER_BYTES = 4 * 1024 * 1024; // 每个缓存保留记录的内存上限, 容量按记录大小折算
+constexpr u64 PROF_RECORD_RING_BYTES = 64 * 1024;         // 每个写入线程独占的环形队列大小
+constexpr u64 PROF_RECORD_CHUNK_BYTES = 64 * 1024;        // 保留区按块申请, 每块的大小
+constexpr u32 PROF_RECORD_MAX_PRODUCER_NUM = 64;          // 独占环形队列的写入线程数上限, 其余线程加锁写入保留区
+constexpr u64 PROF_RECORD_DROP_LOG_INTERVAL = 65536;      // 首次丢弃及此后每丢弃该数量的记录打印一次告警
+constexpr u32 PROF_RECORD_DRAIN_INTERVAL_MS = 50;         // 后台线程无通知时的搬运周期
+
+class ProfRecordBufferBase {
+public:
+    virtual ~ProfRecordBufferBase() = default;
+    // 将各写入线程环形队列中的记录搬入保留区
+    virtual void Collect() = 0;
+};
+
+/*
+ * 进程级后台搬运线程: 各缓存构造时注册, 首个环形队列创建时启动线程;
+ * 写入线程每写满半个环形队列通知一次, 否则按周期搬运
+ */
+class ProfRecordDrainer {
+public:
+    static ProfRecordDrainer &GetInstance();
+    void Register(ProfRecordBufferBase *buffer);
+    void Unregister(ProfRecordBufferBase *buffer);
+    void Start();
+    void Notify();
+
+private:
+    ProfRecordDrainer() = default;
+    ~ProfRecordDrainer();
+    ProfRecordDrainer(ProfRecordDrainer const&) = delete;
+    ProfRecordDrainer& operator=(ProfRecordDrainer const&) = delete;
+    void DrainLoop();
+
+    std::mutex mutex_;  // 保护buffers_, 搬运期间持有, 注销时等待本轮搬运结束
+    std::condition_variable cv_;
+    std::set<ProfRecordBufferBase *> buffers_;
+    std::atomic<bool> notified_{false};
+    bool stop_{false};
+    std::mutex threadMutex_;
+    std::unique_ptr<std::thread> thread_;
+};
+
+// 当前线程的写入者编号, 线程退出后回收; 编号用尽时返回PROF_RECORD_MAX_PRODUCER_NUM
+u32 GetProfRecordProducerIdx();
+
+/*
+ * 图下沉/acl graph场景缓存待补报的profiling记录, 多个上报线程并发写入, 订阅时补报:
+ * 1. 每个写入线程独占一个单生产者单消费者的环形队列, 写入只做一次拷贝和一次release写, 不加锁;
+ *    环形队列满时写入线程自行搬运, 不丢记录;
+ * 2. 后台线程及Replay/Drain/Clear在controlMutex_保护下将环形队列中的记录搬入保留区; 保留区容量
+ *    按记录大小折算, 满时覆盖最早的记录, 未被消费即被覆盖的记录计入丢弃数;
+ * 3. Replay原地遍历保留的记录不消费, 供多次订阅补报; Drain原地遍历并消费记录; Clear丢弃全部记录;
+ * 4. 环形队列在线程首次写入时申请, 保留区按块在使用时申请, 未使用的缓存不占内存。
+ */
+template <typename T>
+class ProfRecordBuffer : public ProfRecordBufferBase {
+public:
+    static u32 DefaultCapacity()
+    {
+        return static_cast<u32>(std::max<u64>(1, PROF_RECORD_BUFFER_BYTES / sizeof(T)));
+    }
+
+    explicit ProfRecordBuffer(u32 capacity = DefaultCapacity())
+        : capacity_(std::max<u32>(capacity, 1)), ringSize_(CalcRingSize(capacity_)),
+          chunkSize_(static_cast<u32>(std::max<u64>(1, PROF_RECORD_CHUNK_BYTES / sizeof(T))))
+    {
+        for (auto &ring : rings_) {
+            ring.store(nullptr, std::memory_order_relaxed);
+        }
+        ProfRecordDrainer::GetInstance().Register(this);
+    }
+
+    ~ProfRecordBuffer() override
+    {
+        ProfRecordDrainer::GetInstance().Unregister(this);
+        for (auto &ring : rings_) {
+            delete ring.load(std::memory_order_acquire);
+        }
+    }
+
+    ProfRecordBuffer(ProfRecordBuffer const&) = delete;
+    ProfRecordBuffer& operator=(ProfRecordBuffer const&) = delete;
+
+    // 写入一条记录, 内存申请失败时返回false并计入丢弃数
+    bool Push(const T &record)
+    {
+        u32 producerIdx = GetProfRecordProducerIdx();
+        ProducerRing *ring = (producerIdx < PROF_RECORD_MAX_PRODUCER_NUM) ?
+            rings_[producerIdx].load(std::memory_order_acquire) : nullptr;
+        if (ring == nullptr) {
+            ring = CreateRing(producerIdx);
+            if (ring == nullptr) {
+                std::unique_lock<std::mutex> lock(controlMutex_);
+                return StoreLocked(record);
+            }
+        }
+        u64 tail = ring->producerTail;
+        if (tail - ring->cachedHead >= ringSize_) {
+            WaitRingSpace(*ring, tail);
+        }
+        ring->records[tail & (ringSize_ - 1)] = record;
+        ring->producerTail = tail + 1;
+        ring->tail.store(tail + 1, std::memory_order_release);
+        if (((tail + 1) & (ringSize_ / 2 - 1)) == 0) {
+            ProfRecordDrainer::GetInstance().Notify();
+        }
+        return true;
+    }
+
+    void Collect() override
+    {
+        std::unique_lock<std::mutex> lock(controlMutex_);
+        CollectLocked();
+    }
+
+    // 原地遍历保留的记录, 不消费; func返回失败时停止
+    template <typename F>
+    HcclResult Replay(F &&func)
+    {
+        std::unique_lock<std::mutex> lock(controlMutex_);
+        CollectLocked();
+        for (u64 seq = GetFirstSeq(); seq < storeTail_; seq++) {
+            CHK_RET(func(*GetStoreSlot(seq)));
+        }
+        return HCCL_SUCCESS;
+    }
+
+    // 原地遍历并消费记录, func返回失败时该记录已消费, 其余记录保留
+    template <typename F>
+    HcclResult Drain(F &&func)
+    {
+        std::unique_lock<std::mutex> lock(controlMutex_);
+        CollectLocked();
+        HcclResult ret = HCCL_SUCCESS;
+        for (u64 seq = GetFirstSeq(); seq < storeTail_ && ret == HCCL_SUCCESS; seq++) {
+            storeHead_ = seq + 1;
+            ret = func(*GetStoreSlot(seq));
+        }
+        return ret;
+    }
+
+    void Clear()
+    {
+        std::unique_lock<std::mutex> lock(controlMutex_);
+        CollectLocked();
+        storeHead_ = storeTail_;
+    }
+
+    u32 Size()
+    {
+        std::unique_lock<std::mutex> lock(controlMutex_);
+        CollectLocked();
+        return static_cast<u32>(storeTail_ - GetFirstSeq());
+    }
+
+    // 已写入环形队列、尚未搬入保留区的记录数
+    u64 GetPendingNum() const
+    {
+        u64 pendingNum = 0;
+        for (const auto &ringPtr : rings_) {
+            const ProducerRing *ring = ringPtr.load(std::memory_order_acquire);
+            if (ring != nullptr) {
+                pendingNum += ring->tail.load(std::memory_order_acquire) - ring->head.load(std::memory_order_acquire);
+            }
+        }
+        return pendingNum;
+    }
+
+    u64 GetDropCount() const
+    {
+        return dropCount_.load(std::memory_order_relaxed);
+    }
+
+    // 已申请的环形队列与保留区内存
+    u64 GetReservedBytes() const
+    {
+        return reservedBytes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct ProducerRing {
+        std::unique_ptr<T[]> records;
+        std::atomic<u64> tail{0};  // 写入线程发布
+        u64 producerTail{0};       // 写入线程本地的tail, 与tail相同, 免去原子读
+        u64 cachedHead{0};         // 写入线程缓存的head, 环形队列看似已满时才重新读取
+        char pad[64];              // head与tail分属不同cache line, 避免写入方与搬运方互相失效
+        std::atomic<u64> head{0};  // 持有controlMutex_的搬运方更新
+    };
+
+    // 不超过容量和PROF_RECORD_RING_BYTES的最大2的幂, 至少为2
+    static u32 CalcRingSize(u32 capacity)
+    {
+        u64 limit = std::min<u64>(capacity, std::max<u64>(2, PROF_RECORD_RING_BYTES / sizeof(T)));
+        u32 ringSize = 2;
+        while (static_cast<u64>(ringSize) * 2 <= limit) {
+            ringSize *= 2;
+        }
+        return ringSize;
+    }
+
+    // 环形队列看似已满: 先重新读取head, 仍满时由写入线程自行搬运
+    void WaitRingSpace(ProducerRing &ring, u64 tail)
+    {
+        ring.cachedHead = ring.head.load(std::memory_order_acquire);
+        if (tail - ring.cachedHead >= ringSize_) {
+            Collect();
+            ring.cachedHead = ring.head.load(std::memory_order_acquire);
+        }
+    }
+
+    ProducerRing *CreateRing(u32 producerIdx)
+    {
+        if (producerIdx >= PROF_RECORD_MAX_PRODUCER_NUM) {
+            return nullptr;
+        }
+        std::unique_ptr<ProducerRing> ring(new (std::nothrow) ProducerRing());
+        if (ring == nullptr) {
+            return nullptr;
+        }
+        ring->records.reset(new (std::nothrow) T[ringSize_]);
+        if (ring->records == nullptr) {
+            return nullptr;
+        }
+        // 编号同一时刻只属于一个线程, 直接发布
+        rings_[producerIdx].store(ring.get(), std::memory_order_release);
+        reservedBytes_.fetch_add(static_cast<u64>(ringSize_) * sizeof(T), std::memory_order_relaxed);
+        ProfRecordDrainer::GetInstance().Start();
+        return ring.release();
+    }
+
+    // 调用方持有controlMutex_, 唯一的消费方; 按连续区间整段拷贝
+    void CollectLocked()
+    {
+        for (auto &ringPtr : rings_) {
+            ProducerRing *ring = ringPtr.load(std::memory_order_acquire);
+            if (ring == nullptr) {
+                continue;
+            }
+            u64 head = ring->head.load(std::memory_order_relaxed);
+            u64 tail = ring->tail.load(std::memory_order_acquire);
+            while (head < tail) {
+                u32 pos = static_cast<u32>(head & (ringSize_ - 1));
+                u64 num = std::min<u64>(tail - head, ringSize_ - pos);
+                StoreRangeLocked(&ring->records[pos], num);
+                head += num;
+            }
+            ring->head.store(tail, std::memory_order_release);
+        }
+    }
+
+    // 调用方持有controlMutex_
+    bool StoreLocked(const T &record)
+    {
+        return StoreRangeLocked(&record, 1) == 1;
+    }
+
+    // 调用方持有controlMutex_, 返回写入的记录数, 保留区块申请失败时其余记录计入丢弃数
+    u64 StoreRangeLocked(const T *records, u64 num)
+    {
+        u64 stored = 0;
+        while (stored < num) {
+            T *slot = GetStoreSlot(storeTail_);
+            if (slot == nullptr) {
+                AddDropCount(num - stored);
+                break;
+            }
+            u32 pos = static_cast<u32>(storeTail_ % capacity_);
+            u64 copyNum = std::min<u64>(num - stored, std::min(capacity_ - pos, chunkSize_ - pos % chunkSize_));
+            // 序号不小于storeHead_ + capacity_的写入覆盖了未被消费的记录
+            u64 overwriteStart = std::max(storeTail_, storeHead_ + capacity_);
+            if (storeTail_ + copyNum > overwriteStart) {
+                AddDropCount(storeTail_ + copyNum - overwriteStart);
+            }
+            std::copy(records + stored, records + stored + copyNum, slot);
+            storeTail_ += copyNum;
+            stored += copyNum;
+        }
+        return stored;
+    }
+
+    // 调用方持有controlMutex_, 所在块未申请时申请
+    T *GetStoreSlot(u64 seq)
+    {
+        u32 pos = static_cast<u32>(seq % capacity_);
+        u32 chunkIdx = pos / chunkSize_;
+        if (chunkIdx >= chunks_.size()) {
+            chunks_.resize((capacity_ + chunkSize_ - 1) / chunkSize_);
+        }
+        if (chunks_[chunkIdx] == nullptr) {
+            u32 chunkRecordNum = std::min(chunkSize_, capacity_ - chunkIdx * chunkSize_);
+            chunks_[chunkIdx].reset(new (std::nothrow) T[chunkRecordNum]);
+            if (chunks_[chunkIdx] == nullptr) {
+                return nullptr;
+            }
+            reservedBytes_.fetch_add(static_cast<u64>(chunkRecordNum) * sizeof(T), std::memory_order_relaxed);
+        }
+        return &chunks_[chunkIdx][pos % chunkSize_];
+    }
+
+    // 调用方持有controlMutex_, 返回保留的最早记录的序号
+    u64 GetFirstSeq() const
+    {
+        return (storeTail_ - storeHead_ > capacity_) ? storeTail_ - capacity_ : storeHead_;
+    }
+
+    void AddDropCount(u64 num = 1)
+    {
+        u64 dropCount = dropCount_.fetch_add(num, std::memory_order_relaxed) + num;
+        // 首次丢弃及跨过每个告警间隔时打印
+        if (dropCount == num || dropCount / PROF_RECORD_DROP_LOG_INTERVAL != (dropCount - num) /
+            PROF_RECORD_DROP_LOG_INTERVAL) {
+            HCCL_WARNING("[ProfRecordBuffer][Push]buffer is full or unavailable, capacity[%u], dropped[%llu]",
+                capacity_, dropCount);
+        }
+    }
+
+    const u32 capacity_;
+    const u32 ringSize_;
+    const u32 chunkSize_;
+    std::atomic<ProducerRing *> rings_[PROF_RECORD_MAX_PRODUCER_NUM];
+    std::mutex controlMutex_;
+    std::vector<std::unique_ptr<T[]>> chunks_;  // 保留区, 以下成员仅在controlMutex_保护下访问
+    u64 storeTail_{0};                          // 保留区下一条记录的序号
+    u64 storeHead_{0};                          // 保留区最早未消费记录的序号
+    std::atomic<u64> dropCount_{0};
+    std::atomic<u64> reservedBytes_{0};
+};
+}  // namespace hccl
+#endif /* PROF_RECORD_BUFFER_H */
@@ -20,6 +20,7 @@
 #include "profiling_manager_pub.h"
 #include "prof_data_config.h"
 #include "dispatcher.h"
+#include "prof_record_buffer.h"
 
 #include <string>
 #include <cstdio>
@@ -253,14 +254,10 @@ private:
     HcclResult isAddtionInfoSubscribe_ = HCCL_E_NOT_SUPPORT;
     HcclResult isHostHcclOpSubscribe_ = HCCL_E_NOT_SUPPORT;
     HcclResult isFftsLaunchSubscribe_ = HCCL_E_NOT_SUPPORT;
-    static std::queue<MsprofApi> storageTaskApi_;
-    static std::array<std::queue<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> storageAdditionInfo_;
-    static std::array<std::mutex, MAX_MODULE_DEVICE_NUM> reportAddInfoMutex_;
-    static std::array<std::queue<MsprofCompactInfo>, MAX_MODULE_DEVICE_NUM> storageCompactInfo_;
-    static std::array<std::mutex, MAX_MODULE_DEVICE_NUM> reportCompactInfoMutex_;
-    static std::mutex reportDataQueueMutex_;
-    static std::array<std::queue<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> storageAdditionInfoFftsCapture_;
-    static std::array<std::mutex, MAX_MODULE_DEVICE_NUM> reportAddInfoFftsCaptureMutex_;
+    static ProfRecordBuffer<MsprofApi> storageTaskApi_;
+    static std::array<ProfRecordBuffer<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> storageAdditionInfo_;
+    static std::array<ProfRecordBuffer<MsprofCompactInfo>, MAX_MODULE_DEVICE_NUM> storageCompactInfo_;
+    static std::array<ProfRecordBuffer<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> storageAdditionInfoFftsCapture_;
     std::atomic<bool> isFftsDispatcher_{false};
     static std::unordered_map<s32, bool> captureStatusThreadIDMap_;
     static std::mutex captureStatusMapMutex_;
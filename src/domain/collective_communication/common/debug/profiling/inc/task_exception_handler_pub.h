@@ -142,6 +142,7 @@ private:
     HcclResult InsertOpData(std::string &tag) const;
     static void PrintTaskContextInfo(const std::shared_ptr<std::vector<CtxInfo>> &taskList, u32 contextId);
     static void PrintTaskContextInfo(const std::shared_ptr<std::deque<TaskInfo>> &taskQue);
+    static void PrintTaskTraceAnalysis(u32 deviceId, const TaskInfo &exceptionTaskInfo);
     static void PrintTaskAivBuffer(const std::shared_ptr<std::deque<TaskInfo>> &taskQue);
     static void PrintTaskAivInfo(const std::shared_ptr<std::deque<TaskInfo>> &taskQue);
     static void ParseTaskSyncFlag(s32 *flagMem, u32 flagMemSize, u32 rankSize, u32 rank, u32 index);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef TASK_TRACE_ANALYZER_PUB_H
+#define TASK_TRACE_ANALYZER_PUB_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "hccl/base.h"
+#include "hccl_common.h"
+#include "dispatcher_task_types.h"
+
+namespace hccl {
+enum class TraceDurationMode {
+    TRACE_DURATION_MODELLED = 0,    // 按TaskProfiling的带宽/固定开销模型估算task耗时
+    TRACE_DURATION_MEASURED         // 使用实测的开始/结束时间戳
+};
+
+// 一个算子内记录的单个task
+struct TraceTask {
+    u32 streamID = 0;
+    u32 taskID = 0;
+    TaskType taskType = TaskType::TASK_SDMA;
+    u64 size = 0;                           // DMA/Reduce的数据量, 单位: 字节
+    u64 notifyID = INVALID_U64;             // Notify Record/Wait的notify, 其余task无效
+    u32 remoteRank = INVALID_VALUE_RANKID;  // 对端rank, 本地task为INVALID_VALUE_RANKID
+    LinkType linkType = LinkType::LINK_ONCHIP;
+    u64 beginNs = 0;                        // 实测模式下的开始/结束时间戳
+    u64 endNs = 0;
+};
+
+// notify wait阻塞从流的串行段
+struct TraceSerializedSegment {
+    u32 waitStreamID;
+    u32 recordStreamID;                     // 对应record不在记录中(如跨rank notify)时为INVALID_UINT
+    u64 notifyID;
+    double startUs;
+    double blockedUs;
+};
+
+struct TaskTraceReport {
+    double makespanUs = 0;                  // 算子端到端耗时
+    double criticalPathBusyUs = 0;          // 关键路径上非wait task的耗时之和
+    double totalBusyUs = 0;                 // 所有流上非wait task的耗时之和
+    double overlapRatio = 0;                // totalBusyUs / makespanUs, 大于1表示多流并行
+    std::vector<u32> criticalPath;          // 关键路径上的task下标, 按执行顺序
+    std::map<u32, double> streamBusyUs;
+    std::map<u32, double> streamIdleUs;
+    std::map<u32, double> streamCriticalUs; // 各流在关键路径上的耗时
+    u32 bottleneckRemoteRank = INVALID_VALUE_RANKID;
+    LinkType bottleneckLinkType = LinkType::LINK_ONCHIP;
+    double bottleneckUs = 0;                // 关键路径上耗时最多的链路的累计耗时
+    std::vector<TraceSerializedSegment> serializedSegments; // 按阻塞时长降序
+
+    std::string ToString() const;
+};
+
+/*
+ * 基于记录的task流离线/在线分析算子性能: 流内按下发顺序串行, 同一notify的第k次wait依赖其第k次record,
+ * 以模型或实测耗时推出关键路径、各流空闲时间以及wait造成的串行段
+ */
+class TaskTraceAnalyzer {
+public:
+    explicit TaskTraceAnalyzer(TraceDurationMode mode = TraceDurationMode::TRACE_DURATION_MODELLED);
+    ~TaskTraceAnalyzer();
+
+    HcclResult AddTask(const TraceTask &task);
+    HcclResult Analyze(TaskTraceReport &report) const;
+    void Clear();
+    size_t GetTaskNum() const;
+
+private:
+    HcclResult BuildNotifyEdges(std::vector<u32> &recordOfWait) const;
+    HcclResult TopoSort(const std::vector<u32> &streamPrev, const std::vector<u32> &recordOfWait,
+        std::vector<u32> &order) const;
+    void CollectCriticalPath(const std::vector<u32> &streamPrev, const std::vector<u32> &recordOfWait,
+        const std::vector<double> &endUs, u32 lastTask, TaskTraceReport &report) const;
+    bool IsBusyTask(const TraceTask &task) const;
+    double GetTaskDurationUs(const TraceTask &task) const;
+
+    TraceDurationMode mode_;
+    std::vector<TraceTask> tasks_;
+};
+}  // namespace hccl
+
+#endif /* TASK_TRACE_ANALYZER_PUB_H */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "prof_record_buffer.h"
+#include <chrono>
+#include "sal_pub.h"
+
+namespace hccl {
+namespace {
+// 写入者编号的占用位图, 平凡析构, 进程退出阶段的线程仍可安全归还编号
+std::atomic<u64> g_producerIdxBitmap{0};
+
+struct ProfRecordProducer {
+    ProfRecordProducer()
+    {
+        u64 bitmap = g_producerIdxBitmap.load(std::memory_order_relaxed);
+        while (bitmap != ~0ULL) {
+            u32 freeIdx = 0;
+            while ((bitmap >> freeIdx) & 1ULL) {
+                freeIdx++;
+            }
+            if (g_producerIdxBitmap.compare_exchange_weak(bitmap, bitmap | (1ULL << freeIdx),
+                std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                idx = freeIdx;
+                return;
+            }
+        }
+    }
+
+    ~ProfRecordProducer()
+    {
+        // 编号连同其环形队列交给之后的线程, release保证本线程的写入对其可见
+        if (idx < PROF_RECORD_MAX_PRODUCER_NUM) {
+            g_producerIdxBitmap.fetch_and(~(1ULL << idx), std::memory_order_release);
+        }
+    }
+
+    u32 idx = PROF_RECORD_MAX_PRODUCER_NUM;
+};
+}
+
+static_assert(PROF_RECORD_MAX_PRODUCER_NUM == 64, "producer index bitmap holds 64 producers");
+
+u32 GetProfRecordProducerIdx()
+{
+    thread_local ProfRecordProducer producer;
+    return producer.idx;
+}
+
+ProfRecordDrainer &ProfRecordDrainer::GetInstance()
+{
+    static ProfRecordDrainer drainer;
+    return drainer;
+}
+
+ProfRecordDrainer::~ProfRecordDrainer()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    std::unique_lock<std::mutex> threadLock(threadMutex_);
+    if (thread_ != nullptr && thread_->joinable()) {
+        thread_->join();
+    }
+}
+
+void ProfRecordDrainer::Register(ProfRecordBufferBase *buffer)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffers_.insert(buffer);
+}
+
+void ProfRecordDrainer::Unregister(ProfRecordBufferBase *buffer)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffers_.erase(buffer);
+}
+
+void ProfRecordDrainer::Start()
+{
+    std::unique_lock<std::mutex> lock(threadMutex_);
+    if (thread_ != nullptr) {
+        return;
+    }
+    thread_.reset(new (std::nothrow) std::thread(&ProfRecordDrainer::DrainLoop, this));
+    if (thread_ == nullptr) {
+        // 没有后台线程时由写入线程在环形队列满时及补报时搬运
+        HCCL_WARNING("[ProfRecordDrainer][Start]create drain thread failed.");
+    }
+}
+
+void ProfRecordDrainer::Notify()
+{
+    if (!notified_.exchange(true, std::memory_order_acq_rel)) {
+        cv_.notify_one();
+    }
+}
+
+void ProfRecordDrainer::DrainLoop()
+{
+    SetThreadName("Hccl_ProfDrain");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        if (!notified_.load(std::memory_order_acquire)) {
+            (void)cv_.wait_for(lock, std::chrono::milliseconds(PROF_RECORD_DRAIN_INTERVAL_MS));
+        }
+        notified_.store(false, std::memory_order_release);
+        for (ProfRecordBufferBase *buffer : buffers_) {
+            buffer->Collect();
+        }
+    }
+}
+}  // namespace hccl
@@ -20,14 +20,11 @@
 #include "sal_pub.h"
 
 namespace hccl {
-std::queue<MsprofApi> ProfilingManager::storageTaskApi_;
-std::array<std::queue<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> ProfilingManager::storageAdditionInfo_;
-std::array<std::mutex, MAX_MODULE_DEVICE_NUM> ProfilingManager::reportAddInfoMutex_;
-std::array<std::queue<MsprofCompactInfo>, MAX_MODULE_DEVICE_NUM> ProfilingManager::storageCompactInfo_;
-std::array<std::mutex, MAX_MODULE_DEVICE_NUM> ProfilingManager::reportCompactInfoMutex_;
-std::array<std::queue<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> ProfilingManager::storageAdditionInfoFftsCapture_;
-std::array<std::mutex, MAX_MODULE_DEVICE_NUM> ProfilingManager::reportAddInfoFftsCaptureMutex_;
-std::mutex ProfilingManager::reportDataQueueMutex_;
+ProfRecordBuffer<MsprofApi> ProfilingManager::storageTaskApi_;
+std::array<ProfRecordBuffer<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM> ProfilingManager::storageAdditionInfo_;
+std::array<ProfRecordBuffer<MsprofCompactInfo>, MAX_MODULE_DEVICE_NUM> ProfilingManager::storageCompactInfo_;
+std::array<ProfRecordBuffer<MsprofAdditionalInfo>, MAX_MODULE_DEVICE_NUM>
+    ProfilingManager::storageAdditionInfoFftsCapture_;
 std::unordered_map<s32, bool> ProfilingManager::captureStatusThreadIDMap_;
 std::mutex ProfilingManager::captureStatusMapMutex_;
 
@@ -126,8 +123,7 @@ HcclResult ProfilingManager::CallMsprofReportHostNodeApi(
     auto mode = GetWorkflowMode();
     if ((mode == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OPS_KERNEL_INFO_LIB) || GetThreadCaptureStatus()) {
         HCCL_INFO("CallMsprofReportTaskApi, storageTaskApi");
-        std::unique_lock<std::mutex> lock(reportDataQueueMutex_);
-        storageTaskApi_.push(reporterData);
+        (void)storageTaskApi_.Push(reporterData);
         if (isHostApiSubscribe_ != HCCL_SUCCESS) {
             return HCCL_SUCCESS;
         }
@@ -209,8 +205,7 @@ HcclResult ProfilingManager::ReportTaskApi(
     if ((mode == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OPS_KERNEL_INFO_LIB) || GetThreadCaptureStatus()) {
         // 缓存对应数据
         HCCL_INFO("CallMsprofReportTaskApi, storageTaskApi");
-        std::unique_lock<std::mutex> lock(reportDataQueueMutex_);
-        storageTaskApi_.push(reporterData);
+        (void)storageTaskApi_.Push(reporterData);
         if (isTaskApiSubscribe_ != HCCL_SUCCESS) {
             return HCCL_SUCCESS;
         }
@@ -268,8 +263,7 @@ HcclResult ProfilingManager::CallMsprofReportHostNodeBasicInfo(
         CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
             HCCL_ERROR("[ReportHostNodeBasicInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
             static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-        std::unique_lock<std::mutex> lock(reportCompactInfoMutex_[deviceLogicId]);
-        storageCompactInfo_[deviceLogicId].push(reporterData);
+        (void)storageCompactInfo_[deviceLogicId].Push(reporterData);
         if (isAddtionInfoSubscribe_ != HCCL_SUCCESS) {
             return HCCL_SUCCESS;
         }
@@ -340,8 +334,7 @@ HcclResult ProfilingManager::CallMsprofReportHostHcclOpInfo(
         CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
             HCCL_ERROR("[ReportAdditionInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
             static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-        std::unique_lock<std::mutex> lock(reportCompactInfoMutex_[deviceLogicId]);
-        storageCompactInfo_[deviceLogicId].push(reporterData);
+        (void)storageCompactInfo_[deviceLogicId].Push(reporterData);
         if (isHostApiSubscribe_ != HCCL_SUCCESS) {
             return HCCL_SUCCESS;
         }
@@ -380,8 +373,7 @@ HcclResult ProfilingManager::CallMsprofReportMc2CommInfo(uint64_t timeStamp, con
         CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
             HCCL_ERROR("[ReportAdditionInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
             static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-        std::unique_lock<std::mutex> lock(reportAddInfoMutex_[deviceLogicId]);
-        storageAdditionInfo_[deviceLogicId].push(reporterData);
+        (void)storageAdditionInfo_[deviceLogicId].Push(reporterData);
         return HCCL_SUCCESS;
     }
     HCCL_INFO("CallMsprofReportMc2CommInfo, Mc2CommInfoType[%u]", MSPROF_REPORT_NODE_MC2_COMMINFO_TYPE);
@@ -457,36 +449,28 @@ HcclResult ProfilingManager::CallMsprofReportContextIdInfo(u32 ctxIdMax) const
 
 HcclResult ProfilingManager::ClearStoragedProfilingInfo()
 {
-    std::unique_lock<std::mutex> lock(reportDataQueueMutex_);
-    HCCL_INFO("[ClearStoragedProfilingInfo] taskApiQueueSize is [%u]", storageTaskApi_.size());
-
-    std::queue<MsprofApi> emptyApi;
-    std::swap(storageTaskApi_, emptyApi);
+    HCCL_INFO("[ClearStoragedProfilingInfo] taskApiQueueSize is [%u], dropped [%llu]", storageTaskApi_.Size(),
+        storageTaskApi_.GetDropCount());
+    storageTaskApi_.Clear();
 
     s32 deviceLogicId = -1;
     CHK_RET(hrtGetDevice(&deviceLogicId));
-    HCCL_INFO("[ClearStoragedAdditionInfo] The size of the storageAdditionInfo_[%d] is [%u]",
-        deviceLogicId, storageAdditionInfo_[deviceLogicId].size());
     u32 maxDeviceNum;
     CHK_RET(GetMaxDevNum(maxDeviceNum));
     CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
         HCCL_ERROR("[ReportStoragedAdditionInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
             static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-    std::unique_lock<std::mutex> lockAddInfo(reportAddInfoMutex_[deviceLogicId]);
-    std::queue<MsprofAdditionalInfo> emptyAddition;
-    std::swap(storageAdditionInfo_[deviceLogicId], emptyAddition);
+    HCCL_INFO("[ClearStoragedAdditionInfo] The size of the storageAdditionInfo_[%d] is [%u]",
+        deviceLogicId, storageAdditionInfo_[deviceLogicId].Size());
+    storageAdditionInfo_[deviceLogicId].Clear();
 
     HCCL_INFO("[ClearStoragedCompactInfo] The size of the storageCompactInfo_[%d] is [%u]",
-        deviceLogicId, storageCompactInfo_[deviceLogicId].size());
-    std::unique_lock<std::mutex> lockCompactInfo(reportCompactInfoMutex_[deviceLogicId]);
-    std::queue<MsprofCompactInfo> emptyCompactInfo;
-    std::swap(storageCompactInfo_[deviceLogicId], emptyCompactInfo);
+        deviceLogicId, storageCompactInfo_[deviceLogicId].Size());
+    storageCompactInfo_[deviceLogicId].Clear();
 
     HCCL_INFO("[ClearStorageAdditionInfoFftsCapture_] The size of the storageAdditionInfoFftsCapture_[%d] is [%u]",
-        deviceLogicId, storageAdditionInfoFftsCapture_[deviceLogicId].size());
-    std::unique_lock<std::mutex> lockAddInfoCapture(reportAddInfoFftsCaptureMutex_[deviceLogicId]);
-    std::queue<MsprofAdditionalInfo> emptyAdditionCapture;
-    std::swap(storageAdditionInfoFftsCapture_[deviceLogicId], emptyAdditionCapture);
+        deviceLogicId, storageAdditionInfoFftsCapture_[deviceLogicId].Size());
+    storageAdditionInfoFftsCapture_[deviceLogicId].Clear();
     return HCCL_SUCCESS;
 }
 
@@ -524,8 +508,7 @@ HcclResult ProfilingManager::ReportAdditionInfo(
         CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
             HCCL_ERROR("[ReportAdditionInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
             static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-        std::unique_lock<std::mutex> lock(reportAddInfoMutex_[deviceLogicId]);
-        storageAdditionInfo_[deviceLogicId].push(reporterData);
+        (void)storageAdditionInfo_[deviceLogicId].Push(reporterData);
         if (isFftsDispatcher_ || isAddtionInfoSubscribe_ != HCCL_SUCCESS) {
             return HCCL_SUCCESS;
         }
@@ -665,48 +648,28 @@ Prof_Status ProfilingManager::GetHashKey(MsprofHashData &data) const
 
 HcclResult ProfilingManager::ReportStoragedTaskApi()
 {
-    std::unique_lock<std::mutex> lock(reportDataQueueMutex_);
-    HCCL_INFO("[ReportStoragedTaskApi] taskApiQueueSize is [%u]", storageTaskApi_.size());
-    if (!storageTaskApi_.empty()) {
-        std::queue<MsprofApi> tempTaskApi = storageTaskApi_;
-        lock.unlock();
-        while (!tempTaskApi.empty()) {
-            MsprofApi reportData = tempTaskApi.front();
-            tempTaskApi.pop();
-            CHK_RET(hrtMsprofReportApi(0, &reportData));
-        }
-    }
+    HCCL_INFO("[ReportStoragedTaskApi] taskApiQueueSize is [%u], dropped [%llu]", storageTaskApi_.Size(),
+        storageTaskApi_.GetDropCount());
+    // 缓存的记录需支持多次订阅补报, 原地遍历不消费
+    CHK_RET(storageTaskApi_.Replay([](MsprofApi &reportData) {
+        return hrtMsprofReportApi(0, &reportData);
+    }));
     return HCCL_SUCCESS;
 }
 
 HcclResult ProfilingManager::ReportStoragedAdditionInfo()
 {
+    auto reportFunc = [](MsprofAdditionalInfo &reportData) {
+        return hrtMsprofReportAdditionalInfo(0, &reportData, sizeof(MsprofAdditionalInfo));
+    };
     for (u32 i = 0; i < MAX_MODULE_DEVICE_NUM; i++) {
-        std::unique_lock<std::mutex> lock(reportAddInfoMutex_[i]);
-        HCCL_INFO("[ReportStoragedAdditionInfo] The size of the storageAdditionInfo_[%u] is [%u]",
-            i, storageAdditionInfo_[i].size());
-        if (!storageAdditionInfo_[i].empty()) {
-            std::queue<MsprofAdditionalInfo> tempTaskAdditionalInfo = storageAdditionInfo_[i];
-            lock.unlock();
-            while (!tempTaskAdditionalInfo.empty()) {
-                MsprofAdditionalInfo reportData = tempTaskAdditionalInfo.front();
-                tempTaskAdditionalInfo.pop();
-                CHK_RET(hrtMsprofReportAdditionalInfo(0, &reportData, sizeof(MsprofAdditionalInfo)));
-            }
-        }
+        HCCL_INFO("[ReportStoragedAdditionInfo] The size of the storageAdditionInfo_[%u] is [%u], dropped [%llu]",
+            i, storageAdditionInfo_[i].Size(), storageAdditionInfo_[i].GetDropCount());
+        CHK_RET(storageAdditionInfo_[i].Replay(reportFunc));
         // acl graph ffts+场景下， 一次下发多次执行， 执行时上报保存的task信息
-        std::unique_lock<std::mutex> lockCapture(reportAddInfoFftsCaptureMutex_[i]);
         HCCL_INFO("[ReportStoragedAdditionInfo] The size of the storageAdditionInfoFftsCapture_[%u] is [%u]",
-            i, storageAdditionInfoFftsCapture_[i].size());
-        if (!storageAdditionInfoFftsCapture_[i].empty()) {
-            std::queue<MsprofAdditionalInfo> tempTaskAdditionalInfo = storageAdditionInfoFftsCapture_[i];
-            lockCapture.unlock();
-            while (!tempTaskAdditionalInfo.empty()) {
-                MsprofAdditionalInfo reportData = tempTaskAdditionalInfo.front();
-                tempTaskAdditionalInfo.pop();
-                CHK_RET(hrtMsprofReportAdditionalInfo(0, &reportData, sizeof(MsprofAdditionalInfo)));
-            }
-        }
+            i, storageAdditionInfoFftsCapture_[i].Size());
+        CHK_RET(storageAdditionInfoFftsCapture_[i].Replay(reportFunc));
     }
     return HCCL_SUCCESS;
 }
@@ -714,18 +677,11 @@ HcclResult ProfilingManager::ReportStoragedAdditionInfo()
 HcclResult ProfilingManager::ReportStoragedCompactInfo()
 {
     for (u32 i = 0; i < MAX_MODULE_DEVICE_NUM; i++) {
-        std::unique_lock<std::mutex> lock(reportCompactInfoMutex_[i]);
-        HCCL_INFO("[ReportStoragedCompactInfo] The size of the storageCompactInfo_[%u] is [%u]",
-            i, storageCompactInfo_[i].size());
-        if (!storageCompactInfo_[i].empty()) {
-            std::queue<MsprofCompactInfo> tempCompactInfo = storageCompactInfo_[i];
-            lock.unlock();
-            while (!tempCompactInfo.empty()) {
-                MsprofCompactInfo reportData = tempCompactInfo.front();
-                tempCompactInfo.pop();
-                CHK_RET(hrtMsprofReportCompactInfo(0, &reportData, sizeof(MsprofCompactInfo)));
-            }
-        }
+        HCCL_INFO("[ReportStoragedCompactInfo] The size of the storageCompactInfo_[%u] is [%u], dropped [%llu]",
+            i, storageCompactInfo_[i].Size(), storageCompactInfo_[i].GetDropCount());
+        CHK_RET(storageCompactInfo_[i].Replay([](MsprofCompactInfo &reportData) {
+            return hrtMsprofReportCompactInfo(0, &reportData, sizeof(MsprofCompactInfo));
+        }));
     }
     return HCCL_SUCCESS;
 }
@@ -744,22 +700,19 @@ HcclResult ProfilingManager::ReportStoragedFftsInfo()
     CHK_PRT_RET(static_cast<u32>(deviceLogicId) >= maxDeviceNum,
         HCCL_ERROR("[ReportStoragedAdditionInfo]deviceLogicId_[%u] is bigger than maxDeviceNum[%u]",
         static_cast<u32>(deviceLogicId), maxDeviceNum), HCCL_E_INTERNAL);
-    std::unique_lock<std::mutex> lock(reportAddInfoMutex_[deviceLogicId]);
     HCCL_INFO("[ReportStoragedFftsInfo] The size of the storageAdditionInfo_[%d] is [%u] ", deviceLogicId,
-        storageAdditionInfo_[deviceLogicId].size());
+        storageAdditionInfo_[deviceLogicId].Size());
 
-    while (!storageAdditionInfo_[deviceLogicId].empty()) {
-        MsprofAdditionalInfo reportData = storageAdditionInfo_[deviceLogicId].front();
-        storageAdditionInfo_[deviceLogicId].pop();
+    bool isCapture = GetThreadCaptureStatus();
+    ProfRecordBuffer<MsprofAdditionalInfo> &captureInfo = storageAdditionInfoFftsCapture_[deviceLogicId];
+    CHK_RET(storageAdditionInfo_[deviceLogicId].Drain([ts, isCapture, &captureInfo](MsprofAdditionalInfo &reportData) {
         reportData.timeStamp = ts;
-        if (GetThreadCaptureStatus()) {
+        if (isCapture) {
             // acl graph ffts+ 场景下， 下发的task信息进行保存以便后续多次使用
-            std::unique_lock<std::mutex> lockCapture(reportAddInfoFftsCaptureMutex_[deviceLogicId]);
-            storageAdditionInfoFftsCapture_[deviceLogicId].push(reportData);
-            lockCapture.unlock();
+            (void)captureInfo.Push(reportData);
         }
-        CHK_RET(hrtMsprofReportAdditionalInfo(0, &reportData, sizeof(MsprofAdditionalInfo)));
-    }
+        return hrtMsprofReportAdditionalInfo(0, &reportData, sizeof(MsprofAdditionalInfo));
+    }));
     return HCCL_SUCCESS;
 }
 
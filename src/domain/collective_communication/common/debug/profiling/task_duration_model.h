@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef TASK_DURATION_MODEL_H
+#define TASK_DURATION_MODEL_H
+
+#include "hccl/base.h"
+#include "dispatcher_task_types.h"
+
+namespace hccl {
+/* * 统一按照PCIe的带宽来计算, SDMA的固定开销按照0.6us(<512KB), 1.5us(>512KB)计算
+    PCIe DMA实测带宽为19.3GB */
+constexpr u32 DURATION_PRECISION = 3;
+constexpr u32 DURATION_INIT_VALUE = 0;
+
+constexpr u32 DURATION_SDMA_FIXED_THRESHOLD = 1024 * 512;       // （魔鬼数字解释）512 * 1024  512K
+constexpr double DURATION_SDMA_FIXED_THRESHOLD_BELOW = 0.6;     // 小数据量的时候SDMA的固定开销为0.6us
+constexpr double DURATION_SDMA_FIXED_THRESHOLD_ABOVE = 1.5;     // 大数据量的时候SDMA的固定开销为0.6us
+constexpr double DURATION_SDMA_BANDWIDTH_MB = 19.3 * 1000;      // （魔鬼数字解释）19.3 * 1000
+
+/* * RDMA的固定开销按照7us计算(实测7us)
+            RDMA实测大包单流带宽为 12.5 GB(刨去协议头, 取12GB) */
+constexpr double DURATION_RDMA_FIXED = 7;
+constexpr double DURATION_RDMA_BANDWIDTH_MB = 12 * 1000;         // (魔鬼数字解释) 12 * 1000=12k
+
+/* * 统一按照10GB计算, CCE reduce的固定开销按照0.6us计算
+    (理论值0.5 + dim * 8) */
+constexpr double DURATION_CCE_FIXED = 0.6;
+constexpr double DURATION_CCE_BANDWIDTH_MB = 10 * 1000;         // (魔鬼数字解释) 10 * 1000=10k
+
+/* * 统一按1us算(片间1us, 片内0.5us), Notify Wait按0.02us估计 */
+constexpr double DURATION_NOTIFY_RECORD = 1;
+constexpr double DURATION_NOTIFY_WAIT = 0.02;
+
+// task耗时估算模型, size为DMA/Reduce的数据量(字节), 单位: us; profiling上报与task流分析共用
+inline double EstimateTaskDuration(TaskType taskType, u64 size)
+{
+    double fixedUs = DURATION_INIT_VALUE;
+    switch (taskType) {
+        case TaskType::TASK_SDMA:
+        case TaskType::TASK_REDUCE_INLINE:
+            fixedUs = (size > DURATION_SDMA_FIXED_THRESHOLD) ? DURATION_SDMA_FIXED_THRESHOLD_ABOVE
+                                                             : DURATION_SDMA_FIXED_THRESHOLD_BELOW;
+            return (size / DURATION_SDMA_BANDWIDTH_MB) + fixedUs;
+        case TaskType::TASK_RDMA:
+            return (size / DURATION_RDMA_BANDWIDTH_MB) + DURATION_RDMA_FIXED;
+        case TaskType::TASK_REDUCE_TBE:
+            return (size / DURATION_CCE_BANDWIDTH_MB) + DURATION_CCE_FIXED;
+        case TaskType::TASK_NOTIFY_RECORD:
+            return DURATION_NOTIFY_RECORD;
+        case TaskType::TASK_NOTIFY_WAIT:
+            return DURATION_NOTIFY_WAIT;
+        default:
+            return DURATION_INIT_VALUE;
+    }
+}
+}  // namespace hccl
+
+#endif /* TASK_DURATION_MODEL_H */
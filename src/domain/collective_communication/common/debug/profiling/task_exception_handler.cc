@@ -16,6 +16,7 @@
 #include "adapter_rts_common.h"
 #include "externalinput_pub.h"
 #include "task_exception_handler.h"
+#include "task_trace_analyzer_pub.h"
 #include "sal_pub.h"
 #include "../../../algorithm/pub_inc/common.h"
 #include "runtime/rt_error_codes.h"
@@ -1013,6 +1014,63 @@ void TaskExceptionHandler::PrintTaskContextInfo(const std::shared_ptr<std::deque
     return;
 }
 
+static TraceTask ConvertToTraceTask(const TaskInfo &taskInfo)
+{
+    TraceTask task;
+    task.streamID = taskInfo.streamID;
+    task.taskID = taskInfo.taskID;
+    task.taskType = taskInfo.taskType;
+    switch (taskInfo.taskType) {
+        case TaskType::TASK_SDMA:
+        case TaskType::TASK_RDMA:
+            task.size = taskInfo.taskPara.DMA.size;
+            task.remoteRank = taskInfo.taskPara.DMA.remoteUserRank;
+            task.linkType = taskInfo.taskPara.DMA.linkType;
+            break;
+        case TaskType::TASK_REDUCE_INLINE:
+        case TaskType::TASK_REDUCE_TBE:
+            task.size = taskInfo.taskPara.Reduce.size;
+            task.remoteRank = taskInfo.taskPara.Reduce.remoteUserRank;
+            task.linkType = taskInfo.taskPara.Reduce.linkType;
+            break;
+        case TaskType::TASK_NOTIFY_RECORD:
+        case TaskType::TASK_NOTIFY_WAIT:
+            task.notifyID = taskInfo.taskPara.Notify.notifyID;
+            task.remoteRank = taskInfo.taskPara.Notify.remoteUserRank;
+            break;
+        default:
+            break;
+    }
+    return task;
+}
+
+// 出错task为NotifyWait时, 汇总本device各流上同一算子(tag与index相同)已下发的task, 按模型耗时分析流间依赖,
+// 打印关键路径与阻塞最久的wait, 用于判断是本rank内的流串行还是等待对端
+void TaskExceptionHandler::PrintTaskTraceAnalysis(u32 deviceId, const TaskInfo &exceptionTaskInfo)
+{
+    TaskTraceAnalyzer analyzer;
+    for (const auto &streamTasks : taskMap[deviceId]) {
+        if (streamTasks.second == nullptr) {
+            continue;
+        }
+        for (const TaskInfo &taskInfo : *streamTasks.second) {
+            if (taskInfo.isAlgInfo || taskInfo.index != exceptionTaskInfo.index ||
+                taskInfo.tag != exceptionTaskInfo.tag) {
+                continue;
+            }
+            if (analyzer.AddTask(ConvertToTraceTask(taskInfo)) != HCCL_SUCCESS) {
+                return;
+            }
+        }
+    }
+    TaskTraceReport report;
+    if (analyzer.GetTaskNum() == 0 || analyzer.Analyze(report) != HCCL_SUCCESS) {
+        return;
+    }
+    HCCL_ERROR("[TaskExceptionHandler][%s]tag[%s] index[%u] task trace of [%zu] tasks: %s", __func__,
+        exceptionTaskInfo.tag.c_str(), exceptionTaskInfo.index, analyzer.GetTaskNum(), report.ToString().c_str());
+}
+
 void TaskExceptionHandler::ParseTaskSyncFlag(s32 *flagMem, u32 flagMemSize, u32 rankSize, u32 rank, u32 index)
 {    
     u32 chips1v1 = rankSize * BLOCK_DIM_PER_RANK * NOTIFY_NUM * INTERVAL_1V1;
@@ -1141,6 +1199,7 @@ bool TaskExceptionHandler::DealExceptionTask(rtExceptionInfo *exceptionInfo)
         PrintTaskAivBuffer(queIt);
         PrintTaskAivInfo(queIt);
     }else if(exceptionTaskInfo.taskType == TaskType::TASK_NOTIFY_WAIT) { 
+        PrintTaskTraceAnalysis(exceptionInfo->deviceid, exceptionTaskInfo);
         queIt->pop_back();
         // 只在出错task为NotifyWait时打印前序task序列
         PrintTaskContextInfo(queIt);
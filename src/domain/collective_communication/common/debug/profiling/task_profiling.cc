@@ -36,52 +36,20 @@ u64 TaskProfiling::TimestampNanosecond() const
 
 double TaskProfiling::GetTaskTime(TaskType taskType, const TaskData &taskData) const
 {
-    double estimatedUs = DURATION_INIT_VALUE;
-    double fixedUs = DURATION_INIT_VALUE;
-
+    u64 size = 0;
     switch (taskType) {
         case TaskType::TASK_SDMA:
-            /* * 统一按照PCIe的带宽来计算, SDMA的固定开销按照0.6us(<512KB), 1.5us(>512KB)计算
-                PCIe DMA实测带宽为19.3GB */
-            fixedUs = (taskData.DMA.size > DURATION_SDMA_FIXED_THRESHOLD) ? DURATION_SDMA_FIXED_THRESHOLD_ABOVE
-                                                                          : DURATION_SDMA_FIXED_THRESHOLD_BELOW;
-            estimatedUs = (taskData.DMA.size / DURATION_SDMA_BANDWIDTH_MB) + fixedUs;
-            break;
-
-        case TaskType::TASK_REDUCE_INLINE:
-            /* * 统一按照PCIe的带宽来计算, SDMA的固定开销按照0.6us(<512KB), 1.5us(>512KB)计算
-                PCIe DMA实测带宽为19.3GB */
-            fixedUs = (taskData.DMA.size > DURATION_SDMA_FIXED_THRESHOLD) ? DURATION_SDMA_FIXED_THRESHOLD_ABOVE
-                                                                          : DURATION_SDMA_FIXED_THRESHOLD_BELOW;
-            estimatedUs = (taskData.Reduce.size / DURATION_SDMA_BANDWIDTH_MB) + fixedUs;
-            break;
-
         case TaskType::TASK_RDMA:
-            /* * RDMA的固定开销按照7us计算(实测7us)
-                RDMA实测大包单流带宽为 12.5 GB(刨去协议头, 取12GB) */
-            estimatedUs = (taskData.DMA.size / DURATION_RDMA_BANDWIDTH_MB) + DURATION_RDMA_FIXED;
+            size = taskData.DMA.size;
             break;
-
+        case TaskType::TASK_REDUCE_INLINE:
         case TaskType::TASK_REDUCE_TBE:
-            // 统一按照10GB计算, CCE reduce的固定开销按照0.6us计算(理论值0.5 + dim * 8)
-            estimatedUs = (taskData.Reduce.size / DURATION_CCE_BANDWIDTH_MB) + DURATION_CCE_FIXED;
+            size = taskData.Reduce.size;
             break;
-
-        case TaskType::TASK_NOTIFY_RECORD:
-            // 统一按1us算(片间1us, 片内0.5us)
-            estimatedUs = DURATION_NOTIFY_RECORD;
-            break;
-
-        case TaskType::TASK_NOTIFY_WAIT:
-            // Notify Wait按0.02us估计
-            estimatedUs = DURATION_NOTIFY_WAIT;
-            break;
-        
         default:
             break;
     }
-
-    return estimatedUs;
+    return EstimateTaskDuration(taskType, size);
 }
 
 ProfTaskType TaskProfiling::GetProfTaskType(TaskType taskType) const
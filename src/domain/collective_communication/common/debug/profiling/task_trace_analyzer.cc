@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "task_trace_analyzer_pub.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include "log.h"
+#include "task_duration_model.h"
+
+namespace hccl {
+constexpr double TRACE_SERIALIZED_MIN_US = 0.1;    // 阻塞时长低于0.1us的wait不计为串行段
+constexpr u32 TRACE_REPORT_SEGMENT_NUM = 3;        // 报告中打印的串行段数量
+constexpr double TRACE_NS_PER_US = 1000.0;
+
+TaskTraceAnalyzer::TaskTraceAnalyzer(TraceDurationMode mode) : mode_(mode)
+{
+}
+
+TaskTraceAnalyzer::~TaskTraceAnalyzer()
+{
+}
+
+HcclResult TaskTraceAnalyzer::AddTask(const TraceTask &task)
+{
+    CHK_PRT_RET(mode_ == TraceDurationMode::TRACE_DURATION_MEASURED && task.endNs < task.beginNs,
+        HCCL_ERROR("[TaskTraceAnalyzer][AddTask]stream[%u] task[%u] end[%llu] is earlier than begin[%llu]",
+        task.streamID, task.taskID, task.endNs, task.beginNs), HCCL_E_PARA);
+    tasks_.push_back(task);
+    return HCCL_SUCCESS;
+}
+
+void TaskTraceAnalyzer::Clear()
+{
+    tasks_.clear();
+}
+
+size_t TaskTraceAnalyzer::GetTaskNum() const
+{
+    return tasks_.size();
+}
+
+bool TaskTraceAnalyzer::IsBusyTask(const TraceTask &task) const
+{
+    return task.taskType != TaskType::TASK_NOTIFY_WAIT;
+}
+
+double TaskTraceAnalyzer::GetTaskDurationUs(const TraceTask &task) const
+{
+    if (mode_ == TraceDurationMode::TRACE_DURATION_MODELLED) {
+        return EstimateTaskDuration(task.taskType, task.size);
+    }
+    return static_cast<double>(task.endNs - task.beginNs) / TRACE_NS_PER_US;
+}
+
+// 同一notify的record与wait各自按下发顺序编号, 第k次wait依赖第k次record; 没有对应record的wait视为
+// 等待跨rank或记录外的notify. 编号只依赖各流内的下发顺序, 与不同流task的加入先后无关
+HcclResult TaskTraceAnalyzer::BuildNotifyEdges(std::vector<u32> &recordOfWait) const
+{
+    recordOfWait.assign(tasks_.size(), INVALID_UINT);
+    std::unordered_map<u64, std::vector<u32>> notifyRecords;
+    for (u32 i = 0; i < tasks_.size(); i++) {
+        if (tasks_[i].taskType == TaskType::TASK_NOTIFY_RECORD && tasks_[i].notifyID != INVALID_U64) {
+            notifyRecords[tasks_[i].notifyID].push_back(i);
+        }
+    }
+    std::unordered_map<u64, u32> notifyWaitSeq;
+    for (u32 i = 0; i < tasks_.size(); i++) {
+        if (tasks_[i].taskType != TaskType::TASK_NOTIFY_WAIT || tasks_[i].notifyID == INVALID_U64) {
+            continue;
+        }
+        u32 waitSeq = notifyWaitSeq[tasks_[i].notifyID]++;
+        auto recordIter = notifyRecords.find(tasks_[i].notifyID);
+        if (recordIter == notifyRecords.end() || waitSeq >= recordIter->second.size()) {
+            continue;
+        }
+        u32 record = recordIter->second[waitSeq];
+        // 同流的record已由流内顺序保证, 不再加边
+        if (tasks_[record].streamID != tasks_[i].streamID) {
+            recordOfWait[i] = record;
+        }
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult TaskTraceAnalyzer::TopoSort(const std::vector<u32> &streamPrev, const std::vector<u32> &recordOfWait,
+    std::vector<u32> &order) const
+{
+    u32 taskNum = tasks_.size();
+    std::vector<u32> inDegree(taskNum, 0);
+    std::vector<std::vector<u32>> successors(taskNum);
+    for (u32 i = 0; i < taskNum; i++) {
+        for (u32 pred : { streamPrev[i], recordOfWait[i] }) {
+            if (pred != INVALID_UINT) {
+                successors[pred].push_back(i);
+                inDegree[i]++;
+            }
+        }
+    }
+
+    order.clear();
+    order.reserve(taskNum);
+    for (u32 i = 0; i < taskNum; i++) {
+        if (inDegree[i] == 0) {
+            order.push_back(i);
+        }
+    }
+    for (u32 pos = 0; pos < order.size(); pos++) {
+        for (u32 next : successors[order[pos]]) {
+            if (--inDegree[next] == 0) {
+                order.push_back(next);
+            }
+        }
+    }
+    CHK_PRT_RET(order.size() != taskNum, HCCL_ERROR("[TaskTraceAnalyzer][TopoSort]notify edges form a cycle, " \
+        "sorted[%zu] of task num[%u]", order.size(), taskNum), HCCL_E_PARA);
+    return HCCL_SUCCESS;
+}
+
+// 从最晚结束的task回溯, 每步选择结束最晚的前驱, 即推迟该task开始的依赖
+void TaskTraceAnalyzer::CollectCriticalPath(const std::vector<u32> &streamPrev,
+    const std::vector<u32> &recordOfWait, const std::vector<double> &endUs, u32 lastTask,
+    TaskTraceReport &report) const
+{
+    std::map<std::pair<u32, u32>, double> linkCriticalUs;
+    u32 cur = lastTask;
+    while (cur != INVALID_UINT) {
+        report.criticalPath.push_back(cur);
+        const TraceTask &task = tasks_[cur];
+        if (IsBusyTask(task)) {
+            double durUs = GetTaskDurationUs(task);
+            report.criticalPathBusyUs += durUs;
+            report.streamCriticalUs[task.streamID] += durUs;
+            if (task.taskType != TaskType::TASK_NOTIFY_RECORD) {
+                linkCriticalUs[{ task.remoteRank, static_cast<u32>(task.linkType) }] += durUs;
+            }
+        }
+        u32 streamPred = streamPrev[cur];
+        u32 notifyPred = recordOfWait[cur];
+        if (streamPred == INVALID_UINT) {
+            cur = notifyPred;
+        } else if (notifyPred == INVALID_UINT) {
+            cur = streamPred;
+        } else {
+            cur = (endUs[notifyPred] > endUs[streamPred]) ? notifyPred : streamPred;
+        }
+    }
+    std::reverse(report.criticalPath.begin(), report.criticalPath.end());
+
+    for (const auto &link : linkCriticalUs) {
+        if (link.second > report.bottleneckUs) {
+            report.bottleneckUs = link.second;
+            report.bottleneckRemoteRank = link.first.first;
+            report.bottleneckLinkType = static_cast<LinkType>(link.first.second);
+        }
+    }
+}
+
+HcclResult TaskTraceAnalyzer::Analyze(TaskTraceReport &report) const
+{
+    report = TaskTraceReport();
+    CHK_PRT_RET(tasks_.empty(), HCCL_WARNING("[TaskTraceAnalyzer][Analyze]no task recorded"), HCCL_SUCCESS);
+
+    u32 taskNum = tasks_.size();
+    // 流内依赖: 同一stream上的task按下发顺序串行
+    std::vector<u32> streamPrev(taskNum, INVALID_UINT);
+    std::map<u32, u32> streamLast;
+    for (u32 i = 0; i < taskNum; i++) {
+        auto iter = streamLast.find(tasks_[i].streamID);
+        if (iter != streamLast.end()) {
+            streamPrev[i] = iter->second;
+        }
+        streamLast[tasks_[i].streamID] = i;
+    }
+    std::vector<u32> recordOfWait;
+    CHK_RET(BuildNotifyEdges(recordOfWait));
+    std::vector<u32> order;
+    CHK_RET(TopoSort(streamPrev, recordOfWait, order));
+
+    std::vector<double> startUs(taskNum, 0);
+    std::vector<double> endUs(taskNum, 0);
+    if (mode_ == TraceDurationMode::TRACE_DURATION_MODELLED) {
+        for (u32 i : order) {
+            double readyUs = 0;
+            for (u32 pred : { streamPrev[i], recordOfWait[i] }) {
+                if (pred != INVALID_UINT) {
+                    readyUs = std::max(readyUs, endUs[pred]);
+                }
+            }
+            startUs[i] = readyUs;
+            endUs[i] = readyUs + GetTaskDurationUs(tasks_[i]);
+        }
+    } else {
+        u64 opBeginNs = tasks_[0].beginNs;
+        for (const TraceTask &task : tasks_) {
+            opBeginNs = std::min(opBeginNs, task.beginNs);
+        }
+        for (u32 i = 0; i < taskNum; i++) {
+            startUs[i] = static_cast<double>(tasks_[i].beginNs - opBeginNs) / TRACE_NS_PER_US;
+            endUs[i] = static_cast<double>(tasks_[i].endNs - opBeginNs) / TRACE_NS_PER_US;
+        }
+    }
+
+    u32 lastTask = 0;
+    for (u32 i = 0; i < taskNum; i++) {
+        const TraceTask &task = tasks_[i];
+        if (endUs[i] > endUs[lastTask]) {
+            lastTask = i;
+        }
+        report.streamBusyUs[task.streamID] += IsBusyTask(task) ? (endUs[i] - startUs[i]) : 0;
+        if (task.taskType == TaskType::TASK_NOTIFY_WAIT) {
+            // wait的阻塞时长: 本流已就绪到wait完成之间扣除wait自身开销的部分
+            double streamReadyUs = (streamPrev[i] == INVALID_UINT) ? 0 : endUs[streamPrev[i]];
+            double blockedUs = endUs[i] - streamReadyUs - EstimateTaskDuration(task.taskType, task.size);
+            if (blockedUs >= TRACE_SERIALIZED_MIN_US) {
+                u32 recordStream = (recordOfWait[i] == INVALID_UINT) ? INVALID_UINT :
+                    tasks_[recordOfWait[i]].streamID;
+                report.serializedSegments.push_back({ task.streamID, recordStream, task.notifyID,
+                    streamReadyUs, blockedUs });
+            }
+        }
+    }
+    std::sort(report.serializedSegments.begin(), report.serializedSegments.end(),
+        [](const TraceSerializedSegment &a, const TraceSerializedSegment &b) { return a.blockedUs > b.blockedUs; });
+
+    report.makespanUs = endUs[lastTask];
+    for (const auto &stream : report.streamBusyUs) {
+        report.totalBusyUs += stream.second;
+        report.streamIdleUs[stream.first] = std::max(report.makespanUs - stream.second, 0.0);
+    }
+    report.overlapRatio = (report.makespanUs > 0) ? (report.totalBusyUs / report.makespanUs) : 0;
+
+    CollectCriticalPath(streamPrev, recordOfWait, endUs, lastTask, report);
+    return HCCL_SUCCESS;
+}
+
+std::string TaskTraceReport::ToString() const
+{
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(DURATION_PRECISION);
+    oss << "makespan[" << makespanUs << "]us, criticalBusy[" << criticalPathBusyUs << "]us, overlap[" <<
+        overlapRatio << "], criticalTasks[" << criticalPath.size() << "]";
+    if (bottleneckUs > 0) {
+        oss << ", bottleneck[remoteRank " << bottleneckRemoteRank << ", linkType " <<
+            static_cast<u32>(bottleneckLinkType) << ", " << bottleneckUs << "us]";
+    }
+    oss << ", streams{";
+    for (const auto &stream : streamBusyUs) {
+        auto idleIter = streamIdleUs.find(stream.first);
+        auto criticalIter = streamCriticalUs.find(stream.first);
+        oss << stream.first << ":busy " << stream.second << "/idle " <<
+            ((idleIter == streamIdleUs.end()) ? 0 : idleIter->second) << "/critical " <<
+            ((criticalIter == streamCriticalUs.end()) ? 0 : criticalIter->second) << ";";
+    }
+    oss << "}, serialized{";
+    for (u32 i = 0; i < serializedSegments.size() && i < TRACE_REPORT_SEGMENT_NUM; i++) {
+        const TraceSerializedSegment &segment = serializedSegments[i];
+        oss << "stream " << segment.waitStreamID << "<-";
+        if (segment.recordStreamID == INVALID_UINT) {
+            oss << "remote";
+        } else {
+            oss << "stream " << segment.recordStreamID;
+        }
+        oss << " notify " << segment.notifyID << " at " << segment.startUs << "us blocked " <<
+            segment.blockedUs << "us;";
+    }
+    oss << "}";
+    return oss.str();
+}
+}  // namespace hccl
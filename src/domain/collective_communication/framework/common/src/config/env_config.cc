@@ -10,6 +10,7 @@
 
 #include "env_config.h"
 #include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -33,6 +34,15 @@ const std::string CLUSTER_HEART_CONFIG = "cluster_heart:";
 const std::string STUCK_DETECTION_CONFIG = "stuck_detection:";
 const std::string CONNECTION_FAULT_DETCTION_TIME = "connection_fault_detction_time:";
 constexpr static const s32 HCCL_MAX_LINK_TIME_OUT_S  = (120 * 60); // HCCL 最大探测超时时间设置为120*60s
+
+/*
+ * 仓内新增的环境变量在mmpa中没有MM_ENV索引, 按名称读取; 与MM_SYS_GET_ENV一致, 未设置时返回nullptr
+ */
+static char *GetEnvByName(const char *envName)
+{
+    return std::getenv(envName);
+}
+
 HcclResult InitEnvConfig()
 {
     std::lock_guard<std::mutex> lock(g_envConfigMutex);
@@ -74,6 +84,31 @@ const u64& EnvConfig::GetExternalInputDebugConfig()
     return g_envConfig.debugConfig;
 }
 
+const u32& EnvConfig::GetExternalInputAlltoallvLazyLink()
+{
+    return g_envConfig.alltoallvLazyLink;
+}
+
+const u32& EnvConfig::GetExternalInputAlltoallvLinkBudget()
+{
+    return g_envConfig.alltoallvLinkBudget;
+}
+
+const u32& EnvConfig::GetExternalInputCCLBufferShare()
+{
+    return g_envConfig.cclBufferShare;
+}
+
+const u32& EnvConfig::GetExternalInputStreamNotifyShare()
+{
+    return g_envConfig.streamNotifyShare;
+}
+
+const u32& EnvConfig::GetExternalInputTaskLoaderCpuBind()
+{
+    return g_envConfig.taskLoaderCpuBind;
+}
+
 void EnvConfig::SetExternalInputDebugConfig(u64 value)
 {
     g_envConfig.debugConfig = value;
@@ -139,6 +174,41 @@ HcclResult InitEnvParam()
     CHK_PRT_RET(ret != HCCL_SUCCESS,
         HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
         "HCCL_DEBUG_CONFIG failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
+
+    ret = g_envConfig.ParseAlltoallvLazyLink();
+    RPT_ENV_ERR(ret != HCCL_SUCCESS, "EI0001", std::vector<std::string>({"env", "tips"}),
+        std::vector<std::string>({"HCCL_ALLTOALLV_LAZY_LINK", "Value range[0, 65535]"}));
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
+        "HCCL_ALLTOALLV_LAZY_LINK failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
+
+    ret = g_envConfig.ParseAlltoallvLinkBudget();
+    RPT_ENV_ERR(ret != HCCL_SUCCESS, "EI0001", std::vector<std::string>({"env", "tips"}),
+        std::vector<std::string>({"HCCL_ALLTOALLV_LINK_BUDGET", "Value range[0, 65535]"}));
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
+        "HCCL_ALLTOALLV_LINK_BUDGET failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
+
+    ret = g_envConfig.ParseCCLBufferShare();
+    RPT_ENV_ERR(ret != HCCL_SUCCESS, "EI0001", std::vector<std::string>({"env", "tips"}),
+        std::vector<std::string>({"HCCL_CCL_BUFFER_SHARE", "Value range[0, 1]"}));
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
+        "HCCL_CCL_BUFFER_SHARE failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
+
+    ret = g_envConfig.ParseStreamNotifyShare();
+    RPT_ENV_ERR(ret != HCCL_SUCCESS, "EI0001", std::vector<std::string>({"env", "tips"}),
+        std::vector<std::string>({"HCCL_STREAM_NOTIFY_SHARE", "Value range[0, 1]"}));
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
+        "HCCL_STREAM_NOTIFY_SHARE failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
+
+    ret = g_envConfig.ParseTaskLoaderCpuBind();
+    RPT_ENV_ERR(ret != HCCL_SUCCESS, "EI0001", std::vector<std::string>({"env", "tips"}),
+        std::vector<std::string>({"HCCL_TASK_LOADER_CPU_BIND", "Value range[0, 1]"}));
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[InitEnvParam]errNo[0x%016llx] In init environtment param, parse "
+        "HCCL_TASK_LOADER_CPU_BIND failed. errorno[%d]", HCCL_ERROR_CODE(ret), ret), ret);
     return HCCL_SUCCESS;
 }
 
@@ -417,6 +487,96 @@ HcclResult EnvConfig::ParseRDMAServerLevel()
     return ParseEnvConfig(param, envValue, g_envConfig.rdmaServerLevel);
 }
 
+/*
+ * HCCL_ALLTOALLV_LAZY_LINK: 0表示alltoallv全连接建链; N(>0)表示首次有数据交互时才与对端建链,
+ * 连续N次alltoallv未使用的链路被回收
+ */
+HcclResult EnvConfig::ParseAlltoallvLazyLink()
+{
+    EnvConfigParam param = {
+        "HCCL_ALLTOALLV_LAZY_LINK",
+        HCCL_ALLTOALLV_LAZY_LINK_DEFAULT,
+        HCCL_ALLTOALLV_LAZY_LINK_MIN,
+        HCCL_ALLTOALLV_LAZY_LINK_MAX,
+        0
+    };
+    char* envValueStr = GetEnvByName("HCCL_ALLTOALLV_LAZY_LINK");
+    std::string envValue = (envValueStr != nullptr) ? envValueStr : "EmptyString";
+    return ParseEnvConfig(param, envValue, g_envConfig.alltoallvLazyLink);
+}
+
+/*
+ * HCCL_ALLTOALLV_LINK_BUDGET: 按需建链时单rank保有的链路数上限, 0表示不限制。
+ * 超出时按最近使用时间回收本次未使用的链路, 仅对alltoallvc生效
+ */
+HcclResult EnvConfig::ParseAlltoallvLinkBudget()
+{
+    EnvConfigParam param = {
+        "HCCL_ALLTOALLV_LINK_BUDGET",
+        HCCL_ALLTOALLV_LINK_BUDGET_DEFAULT,
+        HCCL_ALLTOALLV_LINK_BUDGET_MIN,
+        HCCL_ALLTOALLV_LINK_BUDGET_MAX,
+        0
+    };
+    char* envValueStr = GetEnvByName("HCCL_ALLTOALLV_LINK_BUDGET");
+    std::string envValue = (envValueStr != nullptr) ? envValueStr : "EmptyString";
+    return ParseEnvConfig(param, envValue, g_envConfig.alltoallvLinkBudget);
+}
+
+/*
+ * HCCL_CCL_BUFFER_SHARE: 1表示同一device上的通信域从进程级池中租借CCL buffer,
+ * 仅当这些通信域的算子在同一条流上串行下发时可开启
+ */
+HcclResult EnvConfig::ParseCCLBufferShare()
+{
+    EnvConfigParam param = {
+        "HCCL_CCL_BUFFER_SHARE",
+        HCCL_CCL_BUFFER_SHARE_DEFAULT,
+        HCCL_CCL_BUFFER_SHARE_MIN,
+        HCCL_CCL_BUFFER_SHARE_MAX,
+        0
+    };
+    char* envValueStr = GetEnvByName("HCCL_CCL_BUFFER_SHARE");
+    std::string envValue = (envValueStr != nullptr) ? envValueStr : "EmptyString";
+    return ParseEnvConfig(param, envValue, g_envConfig.cclBufferShare);
+}
+
+/*
+ * HCCL_STREAM_NOTIFY_SHARE: 1表示单算子模式下主流相同的通信域共用device级池中的从流和notify,
+ * 同一主流上的算子在device上按下发顺序执行, 不会重叠
+ */
+HcclResult EnvConfig::ParseStreamNotifyShare()
+{
+    EnvConfigParam param = {
+        "HCCL_STREAM_NOTIFY_SHARE",
+        HCCL_STREAM_NOTIFY_SHARE_DEFAULT,
+        HCCL_STREAM_NOTIFY_SHARE_MIN,
+        HCCL_STREAM_NOTIFY_SHARE_MAX,
+        0
+    };
+    char* envValueStr = GetEnvByName("HCCL_STREAM_NOTIFY_SHARE");
+    std::string envValue = (envValueStr != nullptr) ? envValueStr : "EmptyString";
+    return ParseEnvConfig(param, envValue, g_envConfig.streamNotifyShare);
+}
+
+/*
+ * HCCL_TASK_LOADER_CPU_BIND: 1表示可用核充足时将多流下发的taskLoader线程绑定到独立的核上,
+ * 默认0表示不绑核, 交由OS调度
+ */
+HcclResult EnvConfig::ParseTaskLoaderCpuBind()
+{
+    EnvConfigParam param = {
+        "HCCL_TASK_LOADER_CPU_BIND",
+        HCCL_TASK_LOADER_CPU_BIND_DEFAULT,
+        HCCL_TASK_LOADER_CPU_BIND_MIN,
+        HCCL_TASK_LOADER_CPU_BIND_MAX,
+        0
+    };
+    char* envValueStr = GetEnvByName("HCCL_TASK_LOADER_CPU_BIND");
+    std::string envValue = (envValueStr != nullptr) ? envValueStr : "EmptyString";
+    return ParseEnvConfig(param, envValue, g_envConfig.taskLoaderCpuBind);
+}
+
 HcclResult EnvConfig::ParseDebugConfig()
 {
     char* env = nullptr; // 环境变量值
@@ -69,6 +69,11 @@ struct EnvConfig {
     bool enableClusterHeartBeat;
     bool opCounterEnable;
     s32 dfsConnectionFaultDetctionTime;
+    u32 alltoallvLazyLink;
+    u32 alltoallvLinkBudget;
+    u32 cclBufferShare;
+    u32 streamNotifyShare;
+    u32 taskLoaderCpuBind;
 
     EnvConfig()
     : hostSocketPortSwitch(false),
@@ -80,7 +85,12 @@ struct EnvConfig {
     debugConfig(0),
     enableClusterHeartBeat(true),
     opCounterEnable(true),
-    dfsConnectionFaultDetctionTime(HCCL_MIN_CONNECT_FAULT_DETCTION_TIME)
+    dfsConnectionFaultDetctionTime(HCCL_MIN_CONNECT_FAULT_DETCTION_TIME),
+    alltoallvLazyLink(HCCL_ALLTOALLV_LAZY_LINK_DEFAULT),
+    alltoallvLinkBudget(HCCL_ALLTOALLV_LINK_BUDGET_DEFAULT),
+    cclBufferShare(HCCL_CCL_BUFFER_SHARE_DEFAULT),
+    streamNotifyShare(HCCL_STREAM_NOTIFY_SHARE_DEFAULT),
+    taskLoaderCpuBind(HCCL_TASK_LOADER_CPU_BIND_DEFAULT)
     {
     }
 
@@ -94,16 +104,51 @@ struct EnvConfig {
     static const u32 HCCL_RDMA_SL_DEFAULT = 4;      // 默认的server level为4
     static const u32 HCCL_RDMA_SL_MIN = 0;
     static const u32 HCCL_RDMA_SL_MAX = 7;
+
+    static const u32 HCCL_ALLTOALLV_LAZY_LINK_DEFAULT = 0;  // 默认关闭alltoallv按需建链, 全连接建链
+    static const u32 HCCL_ALLTOALLV_LAZY_LINK_MIN = 0;
+    static const u32 HCCL_ALLTOALLV_LAZY_LINK_MAX = 65535;  // 链路连续空闲的算子次数上限
+
+    static const u32 HCCL_ALLTOALLV_LINK_BUDGET_DEFAULT = 0;  // 默认不限制按需建链时单rank保有的链路数
+    static const u32 HCCL_ALLTOALLV_LINK_BUDGET_MIN = 0;
+    static const u32 HCCL_ALLTOALLV_LINK_BUDGET_MAX = 65535;
+
+    static const u32 HCCL_CCL_BUFFER_SHARE_DEFAULT = 0;     // 默认各通信域独占CCL buffer
+    static const u32 HCCL_CCL_BUFFER_SHARE_MIN = 0;
+    static const u32 HCCL_CCL_BUFFER_SHARE_MAX = 1;
+
+    static const u32 HCCL_STREAM_NOTIFY_SHARE_DEFAULT = 0;  // 默认各通信域独占从流和notify
+    static const u32 HCCL_STREAM_NOTIFY_SHARE_MIN = 0;
+    static const u32 HCCL_STREAM_NOTIFY_SHARE_MAX = 1;
+
+    static const u32 HCCL_TASK_LOADER_CPU_BIND_DEFAULT = 0;  // 默认不为taskLoader线程绑核
+    static const u32 HCCL_TASK_LOADER_CPU_BIND_MIN = 0;
+    static const u32 HCCL_TASK_LOADER_CPU_BIND_MAX = 1;
     // 解析RDMATrafficClass
     HcclResult ParseRDMATrafficClass();
     // 解析RDMAServerLevel
     HcclResult ParseRDMAServerLevel();
     // 解析HCCL_DEBUG_CONFIG
     HcclResult ParseDebugConfig();
+    // 解析HCCL_ALLTOALLV_LAZY_LINK
+    HcclResult ParseAlltoallvLazyLink();
+    // 解析HCCL_ALLTOALLV_LINK_BUDGET
+    HcclResult ParseAlltoallvLinkBudget();
+    // 解析HCCL_CCL_BUFFER_SHARE
+    HcclResult ParseCCLBufferShare();
+    // 解析HCCL_STREAM_NOTIFY_SHARE
+    HcclResult ParseStreamNotifyShare();
+    // 解析HCCL_TASK_LOADER_CPU_BIND
+    HcclResult ParseTaskLoaderCpuBind();
 
     static const u32& GetExternalInputRdmaTrafficClass();
     static const u32& GetExternalInputRdmaServerLevel();
     static const u64& GetExternalInputDebugConfig();
+    static const u32& GetExternalInputAlltoallvLazyLink();
+    static const u32& GetExternalInputAlltoallvLinkBudget();
+    static const u32& GetExternalInputCCLBufferShare();
+    static const u32& GetExternalInputStreamNotifyShare();
+    static const u32& GetExternalInputTaskLoaderCpuBind();
     static void SetExternalInputDebugConfig(u64 value);
 
     bool CheckEnvLen(const char *envStr, u32 envMaxLen);
@@ -31,15 +31,19 @@ HcclResult TopoinfoRanktablePartition::GenerateSubRankTable(const uint32_t rankN
     hccl::RankTable_t &subRankTable)
 {
     subRankTable.nicDeploy = globalRankTable_.nicDeploy;
-    std::unordered_map<uint32_t, size_t> rankInfoMap;
-    for (size_t i = 0; i < globalRankTable_.rankList.size(); i++) {
-        auto rankId = globalRankTable_.rankList[i].rankId;
-        rankInfoMap[rankId] = i;
+    if (rankIndexMap_.empty()) {
+        rankIndexMap_.reserve(globalRankTable_.rankList.size());
+        for (size_t i = 0; i < globalRankTable_.rankList.size(); i++) {
+            auto rankId = globalRankTable_.rankList[i].rankId;
+            rankIndexMap_[rankId] = i;
+        }
     }
+    const std::unordered_map<u32, size_t> &rankInfoMap = rankIndexMap_;
     std::unordered_map<std::string, u32> serverIdMap;
     std::unordered_map<std::string, u32> superPodIdMap;
     std::unordered_set<uint32_t> rankIdSet;
     subRankTable.deviceNum = 0;
+    subRankTable.rankList.reserve(rankNum);
     for (size_t i = 0; i < rankNum; i++) {
         CHK_PTR_NULL(rankIds + i);
         uint32_t rankId = rankIds[i];
@@ -96,6 +100,9 @@ HcclResult TopoinfoRanktablePartition::GenerateSubParams(const hccl::RankTable_t
     subParams.serverId = subRankTable.rankList[subCommRankId].serverId;
     subParams.deviceType = globalParams_.deviceType;
     subParams.commPortConfig.devPortSwitchOn = globalParams_.commPortConfig.devPortSwitchOn;
+    // 子通信域继承父通信域的共享key, 父子及兄弟通信域之间复用同一组socket连接; 父通信域的标识各rank一致
+    subParams.socketShareKey = globalParams_.socketShareKey.empty() ?
+        globalParams_.identifier : globalParams_.socketShareKey;
     return HCCL_SUCCESS;
 }
 
@@ -108,6 +115,39 @@ HcclResult TopoinfoRanktablePartition::GetRankTableStr(const hccl::RankTable_t &
     return HCCL_SUCCESS;
 }
 
+HcclResult TopoinfoRanktablePartition::GetRankTableDigest(const hccl::RankTable_t &subRankTable,
+    std::string &digest) const
+{
+    digest.clear();
+    digest.append(std::to_string(subRankTable.serverNum)).append("|")
+        .append(std::to_string(subRankTable.superPodNum)).append("|")
+        .append(std::to_string(subRankTable.rankNum)).append("|")
+        .append(std::to_string(subRankTable.deviceNum)).append("|")
+        .append((globalParams_.deviceType == DevType::DEV_TYPE_910_93) ? "1.2" : "1.0").append("\n");
+    for (const auto &rankInfo : subRankTable.rankList) {
+        digest.append(rankInfo.hostIp.GetReadableIP()).append("|")
+            .append(std::to_string(rankInfo.deviceInfo.devicePhyId)).append("|")
+            .append(std::to_string(rankInfo.deviceInfo.port)).append("|")
+            .append(std::to_string(rankInfo.deviceInfo.vnicPort)).append("|")
+            .append(std::to_string(rankInfo.deviceInfo.backupPort)).append("|")
+            .append(std::to_string(rankInfo.rankId)).append("|")
+            .append(rankInfo.serverId).append("|")
+            .append(rankInfo.superPodId).append("|")
+            .append(std::to_string(rankInfo.superDeviceId)).append("|");
+        if (subRankTable.nicDeploy == NICDeployment::NIC_DEPLOYMENT_DEVICE &&
+            rankInfo.deviceInfo.deviceIp.size() != 0 && !rankInfo.deviceInfo.deviceIp[0].IsInvalid()) {
+            digest.append(rankInfo.deviceInfo.deviceIp[0].GetReadableIP());
+        }
+        digest.append("|");
+        if (subRankTable.nicDeploy == NICDeployment::NIC_DEPLOYMENT_DEVICE &&
+            rankInfo.deviceInfo.backupDeviceIp.size() != 0 && !rankInfo.deviceInfo.backupDeviceIp[0].IsInvalid()) {
+            digest.append(rankInfo.deviceInfo.backupDeviceIp[0].GetReadableIP());
+        }
+        digest.append("\n");
+    }
+    return HCCL_SUCCESS;
+}
+
 HcclResult TopoinfoRanktablePartition::TransformRankInfo(const RankTable_t &clusterInfo,
     nlohmann::json &perRankJson, u32 rankIndex)
 {
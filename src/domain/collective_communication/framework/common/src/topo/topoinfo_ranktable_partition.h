@@ -11,6 +11,7 @@
 #ifndef TOPOINFO_RANKTABLE_PARTITION_H
 #define TOPOINFO_RANKTABLE_PARTITION_H
 
+#include <unordered_map>
 #include <hccl/base.h>
 #include <nlohmann/json.hpp>
 #include "topoinfo_struct.h"
@@ -27,9 +28,12 @@ public:
     HcclResult GenerateSubParams(const hccl::RankTable_t &subRankTable, const uint32_t subCommRankId,
         hccl::HcclCommParams &subParams);
     HcclResult GetRankTableStr(const hccl::RankTable_t &subRankTable, std::string &rankTableStr);
+    // 生成rank table的紧凑摘要, 覆盖GetRankTableStr中的全部字段, 用于计算ranktableCrc, 避免json序列化
+    HcclResult GetRankTableDigest(const hccl::RankTable_t &subRankTable, std::string &digest) const;
 private:
     hccl::HcclCommParams &globalParams_;
     hccl::RankTable_t &globalRankTable_;
+    std::unordered_map<u32, size_t> rankIndexMap_;    // global rankId -> rankList下标, 多次切分时只建立一次
 
     HcclResult TransformRankInfo(const RankTable_t &clusterInfo, nlohmann::json &perRankJson, u32 rankIndex);
     HcclResult TransformServerList(const RankTable_t &clusterInfo, nlohmann::json &serverListJson);
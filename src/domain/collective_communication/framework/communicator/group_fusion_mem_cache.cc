@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "group_fusion_mem_cache.h"
+#include <algorithm>
+#include <iterator>
+#include "log.h"
+
+namespace hccl {
+GroupFusionMemCache::GroupFusionMemCache(u64 capacity, const SyncStreamFunc &syncStream)
+    : capacity_(capacity), syncStream_(syncStream)
+{
+}
+
+HcclResult GroupFusionMemCache::Release(std::list<CacheEntry>::iterator iter)
+{
+    CHK_RET(syncStream_(iter->stream));
+    cachedSize_ -= iter->mem.size();
+    HCCL_INFO("[GroupFusionMemCache][Release]stream[%p] release fusion mem size[%llu], cached size[%llu]",
+        iter->stream, iter->mem.size(), cachedSize_);
+    entries_.erase(iter);
+    return HCCL_SUCCESS;
+}
+
+HcclResult GroupFusionMemCache::Get(u64 size, rtStream_t stream, DeviceMem &mem)
+{
+    CHK_PRT_RET(size == 0 || size > capacity_, HCCL_ERROR("[GroupFusionMemCache][Get]size[%llu] is invalid, "
+        "capacity[%llu]", size, capacity_), HCCL_E_PARA);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = std::find_if(entries_.begin(), entries_.end(),
+        [stream](const CacheEntry &entry) { return entry.stream == stream; });
+    if (iter != entries_.end()) {
+        if (iter->mem.size() >= size) {
+            entries_.splice(entries_.begin(), entries_, iter);
+            mem = iter->mem.range(0, size);
+            return HCCL_SUCCESS;
+        }
+        CHK_RET(Release(iter));
+    }
+    while (cachedSize_ + size > capacity_) {
+        CHK_RET(Release(std::prev(entries_.end())));
+    }
+
+    DeviceMem newMem = DeviceMem::alloc(size);
+    CHK_PRT_RET(!newMem, HCCL_ERROR("[GroupFusionMemCache][Get]alloc size[%llu] failed", size), HCCL_E_PTR);
+    entries_.push_front({stream, newMem});
+    cachedSize_ += size;
+    HCCL_INFO("[GroupFusionMemCache][Get]stream[%p] fusion mem ptr[%p] size[%llu], cached size[%llu] "
+        "stream num[%zu]", stream, newMem.ptr(), size, cachedSize_, entries_.size());
+    mem = newMem.range(0, size);
+    return HCCL_SUCCESS;
+}
+
+u64 GroupFusionMemCache::GetCachedSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cachedSize_;
+}
+
+u32 GroupFusionMemCache::GetStreamNum()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+}  // namespace hccl
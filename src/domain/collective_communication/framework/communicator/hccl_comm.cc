@@ -31,7 +31,9 @@ RankTable_t g_hcclDefaultRankTable;
 hcclComm::hcclComm(u64 inCCLbufferSize, u64 outCCLbufferSize, std::string identifier)
     : barrierSendBuf(nullptr), barrierRecvBuf(nullptr),
       inCCLbufferSize_(inCCLbufferSize), outCCLbufferSize_(outCCLbufferSize),
-      deviceType_(DevType::DEV_TYPE_COUNT), isFirstBarrier_(true), identifier_(identifier), isHeterogComm_(false),
+      deviceType_(DevType::DEV_TYPE_COUNT),
+      groupFusionMemCache_(GROUP_FUSION_MEM_CAPACITY, [](rtStream_t stream) { return hcclStreamSynchronize(stream); }),
+      isFirstBarrier_(true), identifier_(identifier), isHeterogComm_(false),
       isResetDevice_(false), isSpecialType_(false), communicator_(nullptr)
 {
     indirectInCCLbuffer_ = DeviceMem();
@@ -417,6 +419,31 @@ HcclResult hcclComm::AllReduceOutPlace(const std::string &tag, void *inputPtr, v
 }
 #endif
 
+HcclResult hcclComm::CreatePersistentOp(const std::function<HcclResult()> &issueOp, u64 &opId)
+{
+    return communicator_->CreatePersistentOp(issueOp, opId);
+}
+
+HcclResult hcclComm::StartPersistentOp(u64 opId)
+{
+    HcclResult ret = communicator_->StartPersistentOp(opId);
+    if (ret != HCCL_SUCCESS) {
+        PrintSubmittedOpCnt(std::to_string(opId), ret);
+        return ret;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult hcclComm::DestroyPersistentOp(u64 opId)
+{
+    return communicator_->DestroyPersistentOp(opId);
+}
+
+HcclResult hcclComm::GetGroupFusionMem(u64 size, rtStream_t stream, DeviceMem &mem)
+{
+    return groupFusionMemCache_.Get(size, stream, mem);
+}
+
 HcclResult hcclComm::AlltoAllV(const void *sendBuf, const void *sendCounts, const void *sdispls, HcclDataType sendType,
                                const void *recvBuf, const void *recvCounts, const void *rdispls, HcclDataType recvType,
                                rtStream_t stream, const std::string &tag)
@@ -36,6 +36,7 @@
 #include "alg_profiling.h"
 #include "preempt_port_manager.h"
 #include "mmpa_api.h"
+#include "op_tiling_header.h"
 #ifndef HCCD
 #include "stream_utils.h"
 #endif
@@ -147,6 +148,9 @@ HcclCommunicator::~HcclCommunicator()
 
     UnRegisterToHeartBeat();
 
+    // 发送本通信域遗留的表2记录并回收NSLB-DP后台发送线程, 避免线程留到进程静态析构阶段
+    hcclNslbDp::GetInstance().StopOpAndAdjTableSender();
+
     if (implAlg_ != nullptr) {
         implAlg_ = nullptr;
     }
@@ -162,6 +166,7 @@ HcclCommunicator::~HcclCommunicator()
     }
 #endif
     resMap_.clear();
+    alltoAllLazyLinkTrackers_.clear();
     deviceResOrigMem_.clear();
     hostResMap_.clear();
     tagCommInfo_.clear();
@@ -553,6 +558,7 @@ HcclResult HcclCommunicator::InitCommParams(HcclCommParams &params)
     ranktableCrc_ = params.ranktableCrc;
     commConnections_ = params.commConnections;
     commPortConfig_ = params.commPortConfig;
+    socketShareKey_ = params.socketShareKey.empty() ? params.identifier : params.socketShareKey;
 
     HCCL_DEBUG(
         " userRank_: %u realUserRank_: %u userRankSize_: %u deviceLogicId_: %u deviceType_: %u commWorkMode_: %u.",
@@ -822,7 +828,10 @@ HcclResult HcclCommunicator::InitDispatcher()
 
 HcclResult HcclCommunicator::InitStreamManager()
 {
-    opStreamManager_.reset(static_cast<OpBaseStreamManager *>(new (std::nothrow) OpBaseStreamManager));
+    // 开启共享时, 主流相同的通信域从device级的池中共用从流和host notify
+    s32 shareDeviceLogicId = EnvConfig::GetExternalInputStreamNotifyShare() != 0 ? deviceLogicId_ : -1;
+    opStreamManager_.reset(new (std::nothrow) OpBaseStreamManager(shareDeviceLogicId));
+    CHK_SMART_PTR_NULL(opStreamManager_);
     CHK_RET(StreamActiveManager::GetInstance(deviceLogicId_).Init());
     return HCCL_SUCCESS;
 }
@@ -831,6 +840,7 @@ HcclResult HcclCommunicator::InitSocketManager()
 {
     socketManager_.reset(new (std::nothrow) HcclSocketManager(nicDeployment_, deviceLogicId_, devicePhyId_, userRank_));
     CHK_PTR_NULL(socketManager_);
+    CHK_RET(socketManager_->SetSocketShareKey(socketShareKey_));
     return HCCL_SUCCESS;
 }
 
@@ -1049,6 +1059,7 @@ HcclResult HcclCommunicator::ClearResMap(const std::string &tag, bool &findTag)
         DestroyAlgResource(resIter->second);
         CHK_RET(StreamActiveManager::GetInstance(deviceLogicId_).StreamsUnactive(resIter->second.slaveStreams));
         resMap_.erase(resIter);
+        alltoAllLazyLinkTrackers_.erase(tag);
         HCCL_INFO("[%s] clear resMap[%s]", __func__, tag.c_str());
     }
 #endif
@@ -1298,6 +1309,7 @@ HcclResult HcclCommunicator::GetCommParams(HcclCommParams &params)
     params.ranktableCrc = ranktableCrc_;
     params.commConnections = commConnections_;
     params.commPortConfig.devPortSwitchOn = commPortConfig_.devPortSwitchOn;
+    params.socketShareKey = socketShareKey_;
     return HCCL_SUCCESS;
 #else
     return HCCL_E_NOT_SUPPORT;
@@ -4575,7 +4587,27 @@ HcclResult HcclCommunicator::Gather(const std::string &tag, void *inputPtr, void
     }
     std::vector<u32> &ranksPorts = groupNicRanksPort_.empty() ? nicRanksPort_ : groupNicRanksPort_;
     implAlg_->SetHDCModeInfo(rankDevicePhyIdNicInfoMap_, ranksPorts, isSetHDCModeInfo_, isUseRankPort_);
-    CHK_RET(implAlg_->Gather(tag, inputPtr, outputPtr, rootRank, inputCount, dataType, streamObj));
+    // 异构场景和图模式仍走star算法
+    if (isHaveCpuRank_ || GetWorkflowMode() != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE) {
+        CHK_RET(implAlg_->Gather(tag, inputPtr, outputPtr, rootRank, inputCount, dataType, streamObj));
+    } else {
+        u32 perDataSize = SIZE_TABLE[dataType];
+        u64 inputSize = inputCount * perDataSize;
+
+        OpParam opParam;
+        opParam.tag = tag;
+        opParam.inputPtr = inputPtr;
+        opParam.inputSize = inputSize;
+        opParam.outputPtr = outputPtr;
+        opParam.outputSize = inputSize * userRankSize_;
+        opParam.DataDes.count = inputCount;
+        opParam.DataDes.dataType = dataType;
+        opParam.stream = streamObj;
+        opParam.root = rootRank;
+        opParam.opBaseAtraceInfo = opBaseAtraceInfo_.get();
+        opParam.opType = HcclCMDType::HCCL_CMD_GATHER;
+        CHK_RET(ExecOp(HcclCMDType::HCCL_CMD_GATHER, opParam));
+    }
 #endif
     return HCCL_SUCCESS;
 }
@@ -4714,7 +4746,7 @@ HcclResult HcclCommunicator::NslbDp_CollectOperTable(HcclCMDType opType, OpParam
     if (opParam.root == INVALID_VALUE_RANKID) {
         rootRank = 0;
     }
-    std::string nslb_identifier = identifier_;
+    const std::string &nslb_identifier = identifier_;
 
     HCCL_INFO("NSLBDP-SWK NslbDp_CollectOperTable nslb_identifier[%s] .", nslb_identifier.c_str());
     u32 rankSize = userRankSize_;
@@ -4782,6 +4814,10 @@ HcclResult HcclCommunicator::NslbDp_CollectSendAdjTable(HcclCMDType opType, OpPa
 HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
 {
 #ifndef CCL_KERNEL_AICPU
+    if (UNLIKELY(persistentOpRecorder_ != nullptr)) {
+        // 创建持久化算子: 只解析算法与资源, 不下发任务
+        return RecordPersistentOp(opType, opParam);
+    }
     bool isInGraphCaptureZeroCopy = false;
 #ifndef HCCD
     zeroCopyAclGraph_.SetRetryEnable(retryEnable_);
@@ -4794,9 +4830,24 @@ HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
 
     std::unique_ptr<CollAlgOperator> algOperator = implAlg_->GetAlgOperator(opType);
     CHK_SMART_PTR_NULL(algOperator);
-    // 算法选择
     std::string algName;
     std::string newTag;
+    AlgDesc algDesc;
+    CHK_RET(ResolveOp(opType, opParam, isInGraphCaptureZeroCopy, algOperator, algName, algDesc, newTag));
+    CHK_RET(LaunchOp(opType, opParam, algOperator, algName, algDesc, newTag));
+
+    if (isInGraphCaptureZeroCopy) {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    }
+#endif
+    return HCCL_SUCCESS;
+}
+
+// 算法选择与资源创建, 结果只依赖算子参数, 可被持久化算子复用
+HcclResult HcclCommunicator::ResolveOp(HcclCMDType opType, OpParam &opParam, bool isInGraphCaptureZeroCopy,
+    std::unique_ptr<CollAlgOperator> &algOperator, std::string &algName, AlgDesc &algDesc, std::string &newTag)
+{
+#ifndef CCL_KERNEL_AICPU
     if (opParam.aicpuUnfoldMode) {
         // 用于inplace支持重执行判断
         CHK_RET(algOperator->SetRetryEnable(retryEnable_));
@@ -4806,8 +4857,8 @@ HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
         CHK_RET(algOperator->SetAivClearEnable(aivClearEnable_));
     }
 
+    // 算法选择
     ResourceLimit limit;
-    AlgDesc algDesc;
     opParam.supportZeroCopy = IsSupportZeroCopy(opParam);
     CHK_RET(algOperator->SelectAlg(opParam.tag, opParam, limit, algName, algDesc, newTag));
     CHK_RET(PrepareZeroCopy(algName, algDesc, opParam));
@@ -4818,9 +4869,6 @@ HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
         CHK_RET(CreateCommCCLbuffer());
     }
     CHK_RET(CreateCommExpBuffer());
-    if (hcclNslbDp::GetInstance().GetGlobalCommTaskId() != 0) {
-        NslbDp_CollectOperTable(opType, opParam, algOperator->GetAlgType(), algName);
-    }
     // 资源创建
     InsertNewTagToTagMap(newTag, opParam.tag);
     if (resMap_.find(newTag) == resMap_.end()) {
@@ -4867,7 +4915,19 @@ HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
         CHK_RET(algOperator->CalcResRequest(algName, opParam, resRequest));
         CHK_RET(IncreAllocLink(newTag, opParam, resRequest, resMap_[newTag]));
     }
+#endif
+    return HCCL_SUCCESS;
+}
+
+// 算法执行: 每次下发都需要刷新的NSLB表项、计数与任务编排
+HcclResult HcclCommunicator::LaunchOp(HcclCMDType opType, OpParam &opParam,
+    std::unique_ptr<CollAlgOperator> &algOperator, const std::string &algName, const AlgDesc &algDesc,
+    const std::string &newTag)
+{
+#ifndef CCL_KERNEL_AICPU
+    // NSLB按下发次数上报, 持久化算子的每次Start同样需要上报
     if (hcclNslbDp::GetInstance().GetGlobalCommTaskId() != 0) {
+        NslbDp_CollectOperTable(opType, opParam, algOperator->GetAlgType(), algName);
         AdjInfo nslbAdjInfo = {};
         CHK_RET(algOperator->GetAdjInfo(algName, opParam, resMap_[newTag], nslbAdjInfo));
         HCCL_RUN_INFO("[NSLBDP-SWK]-nslbAdjInfosize[%u]-algName[%s]-rankSize[%u]-commDesc[%s]..",
@@ -4921,11 +4981,109 @@ HcclResult HcclCommunicator::ExecOp(HcclCMDType opType, OpParam &opParam)
         CHK_RET(algOperator->SetAivClearEnable(false));
         aivClearEnable_ = false;
     }
-  
-    if (isInGraphCaptureZeroCopy) {
-        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+#endif
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclCommunicator::CreatePersistentOp(const std::function<HcclResult()> &issueOp, u64 &opId)
+{
+#ifndef CCL_KERNEL_AICPU
+    // 这些场景的下发接口不经过ExecOp, 会在创建时直接下发任务
+    CHK_PRT_RET(isHaveCpuRank_ || Is310P3Common(isHaveCpuRank_, deviceType_),
+        HCCL_ERROR("[HcclCommunicator][CreatePersistentOp]persistent op is not supported in current scenario"),
+        HCCL_E_NOT_SUPPORT);
+    std::unique_ptr<PersistentOpPlan> plan = std::make_unique<PersistentOpPlan>();
+    CHK_SMART_PTR_NULL(plan);
+    // 复用各算子的参数构造流程, 在ExecOp入口截获参数并完成算法选择与资源创建
+    persistentOpRecorder_ = plan.get();
+    HcclResult ret = issueOp();
+    persistentOpRecorder_ = nullptr;
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[HcclCommunicator][CreatePersistentOp]errNo[0x%016llx] "
+        "resolve persistent op failed", HCCL_ERROR_CODE(ret)), ret);
+    CHK_PRT_RET(plan->algOperator == nullptr, HCCL_ERROR("[HcclCommunicator][CreatePersistentOp]op is not "
+        "supported to be persistent in current scenario"), HCCL_E_NOT_SUPPORT);
+
+    opId = ++persistentOpIdSeed_;
+    HCCL_INFO("[HcclCommunicator][CreatePersistentOp]opId[%llu] opType[%d] algName[%s] tag[%s]", opId,
+        plan->opType, plan->algName.c_str(), plan->newTag.c_str());
+    persistentOps_.emplace(opId, std::move(plan));
+#endif
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclCommunicator::RecordPersistentOp(HcclCMDType opType, const OpParam &opParam)
+{
+#ifndef CCL_KERNEL_AICPU
+    CHK_PRT_RET(opParam.isCapture, HCCL_ERROR("[HcclCommunicator][RecordPersistentOp]capture stream is not "
+        "supported, use graph replay instead"), HCCL_E_NOT_SUPPORT);
+    CHK_PRT_RET(GetWorkflowMode() != HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE,
+        HCCL_ERROR("[HcclCommunicator][RecordPersistentOp]only op base mode is supported"), HCCL_E_NOT_SUPPORT);
+    persistentOpRecorder_->opType = opType;
+    persistentOpRecorder_->origParam = opParam;
+    CHK_RET(ResolvePersistentOp(*persistentOpRecorder_));
+#endif
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclCommunicator::ResolvePersistentOp(PersistentOpPlan &plan)
+{
+#ifndef CCL_KERNEL_AICPU
+    std::unique_ptr<CollAlgOperator> algOperator = implAlg_->GetAlgOperator(plan.opType);
+    CHK_SMART_PTR_NULL(algOperator);
+    OpParam opParam = plan.origParam;
+    std::string algName;
+    std::string newTag;
+    AlgDesc algDesc;
+    CHK_RET(ResolveOp(plan.opType, opParam, false, algOperator, algName, algDesc, newTag));
+
+    // 解析成功后再替换, 失败时下次下发会重新解析
+    plan.opParam = opParam;
+    plan.algOperator = std::move(algOperator);
+    plan.algName = algName;
+    plan.algDesc = algDesc;
+    plan.newTag = newTag;
+#endif
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclCommunicator::StartPersistentOp(u64 opId)
+{
+#ifndef CCL_KERNEL_AICPU
+    CHK_RET(CheckSuspendingStatus());
+    auto iter = persistentOps_.find(opId);
+    CHK_PRT_RET(iter == persistentOps_.end(),
+        HCCL_ERROR("[HcclCommunicator][StartPersistentOp]opId[%llu] not found", opId), HCCL_E_NOT_FOUND);
+    PersistentOpPlan &plan = *(iter->second);
+    CHK_PRT_RET(StreamIsCapture(plan.opParam.stream.ptr()), HCCL_ERROR("[HcclCommunicator][StartPersistentOp]"
+        "opId[%llu] stream is in capture status", opId), HCCL_E_NOT_SUPPORT);
+
+    // 仅重新校验创建后可能变化的状态: 资源被ClearOpResource释放, 或零拷贝内存被去激活
+    if (resMap_.find(plan.newTag) == resMap_.end() ||
+        (plan.opParam.isZeroCopy && !IsSupportZeroCopy(plan.opParam))) {
+        HCCL_RUN_INFO("[HcclCommunicator][StartPersistentOp]opId[%llu] tag[%s] resource changed, resolve again",
+            opId, plan.newTag.c_str());
+        CHK_RET(ResolvePersistentOp(plan));
     }
 
+    SyncMode preSyncMode = SyncMode::DEFAULT_TIMEWAITSYNCMODE;
+    GetAndSetSyncMode(preSyncMode, plan.opParam.syncMode);
+    HcclResult ret = LaunchOp(plan.opType, plan.opParam, plan.algOperator, plan.algName, plan.algDesc,
+        plan.newTag);
+    RestorePreSyncMode(preSyncMode, plan.opParam.syncMode);
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[HcclCommunicator][StartPersistentOp]errNo[0x%016llx] "
+        "opId[%llu] launch failed", HCCL_ERROR_CODE(ret), opId), ret);
+#endif
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclCommunicator::DestroyPersistentOp(u64 opId)
+{
+#ifndef CCL_KERNEL_AICPU
+    auto iter = persistentOps_.find(opId);
+    CHK_PRT_RET(iter == persistentOps_.end(),
+        HCCL_ERROR("[HcclCommunicator][DestroyPersistentOp]opId[%llu] not found", opId), HCCL_E_NOT_FOUND);
+    // 资源仍归属tag, 与普通算子一样随通信域或ClearOpResource释放
+    persistentOps_.erase(iter);
 #endif
     return HCCL_SUCCESS;
 }
@@ -5011,6 +5169,7 @@ HcclResult HcclCommunicator::ExecOpAlltoAll(HcclCMDType opType, OpParam &opParam
             // 心跳线程拉起
             CHK_RET(PrepareHeartBeatInit(opType, opParam));
         }
+        alltoAllLazyLinkTrackers_.erase(newTag);
         AlgResourceRequest resRequest;
         CHK_RET(algOperator->CalcResRequest(algName, opParam, resRequest));
         resRequest.isInGraphCaptureZeroCopy = isInGraphCaptureZeroCopy;
@@ -5048,6 +5207,7 @@ HcclResult HcclCommunicator::ExecOpAlltoAll(HcclCMDType opType, OpParam &opParam
             CHK_RET(algOperator->CalcResRequest(algName, opParam, resRequest));
             // alltoall算子重分配内存前需清除scratchMMem，防止内存泄漏
             CHK_RET(FreeScratchMemOnOpBaseMode(resMap_[newTag].scratchMem, opParam, opType));
+            alltoAllLazyLinkTrackers_.erase(newTag);
             CHK_RET(AllocAlgResource(newTag, opType, opParam, resRequest, resMap_[newTag]));
             if (!isHaveCpuRank_) {
                 if (isUseRankPort_) {
@@ -5064,6 +5224,7 @@ HcclResult HcclCommunicator::ExecOpAlltoAll(HcclCMDType opType, OpParam &opParam
             CHK_RET(CalcTinySendRecvMem(opParam, resMap_[newTag], tinySendRecvMem));
         }
     }
+    CHK_RET(UpdateAlltoAllLazyLinks(newTag, algName, algDesc, opParam, algOperator));
     /* NSLB 填充 表  */
     AlgType nslbAlgType = algOperator->GetAlgType();
     AlgTypeLevel1 algValue = nslbAlgType.algoLevel1;
@@ -6492,7 +6653,12 @@ HcclResult HcclCommunicator::AllocAlgNotifys(const std::string &tag, const Notif
 {
 #ifndef CCL_KERNEL_AICPU
     std::vector<std::shared_ptr<LocalNotify>> notifys(notifyNum, nullptr);
-    CHK_RET(queueNotifyManagerRefac_->Alloc(tag, notifyNum, notifys, notifyLoadType));
+    if (notifyLoadType == NotifyLoadType::HOST_NOTIFY &&
+        GetWorkflowMode() == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE && opStreamManager_->IsSlaveShared()) {
+        CHK_RET(opStreamManager_->AllocSlaveNotifies(tag, notifyNum, notifys));
+    } else {
+        CHK_RET(queueNotifyManagerRefac_->Alloc(tag, notifyNum, notifys, notifyLoadType));
+    }
 
     u32 signalNum = notifyNum >> 1;
     notifiesMain.resize(signalNum);
@@ -6780,6 +6946,102 @@ HcclResult HcclCommunicator::IncreAllocLink(const std::string &newTag, const OpP
     return HCCL_SUCCESS;
 }
 
+/*
+ * alltoallv按需建链: 为本次有数据交互但尚未建链的对端增量建链, 并回收AlltoAllLazyLinkTracker判定为
+ * 空闲或超出链路数上限的链路。回收判定在两端一致, 两端在同一次算子中建链或回收同一条链路
+ */
+HcclResult HcclCommunicator::UpdateAlltoAllLazyLinks(const std::string &newTag, const std::string &algName,
+    const AlgDesc &algDesc, const OpParam &opParam, std::unique_ptr<CollAlgOperator> &algOperator)
+{
+#ifndef CCL_KERNEL_AICPU
+    u32 idleLimit = EnvConfig::GetExternalInputAlltoallvLazyLink();
+    if (idleLimit == 0 || !algDesc.isLazyLink || !IsAlltoAllLazyLinkOp(opParam)) {
+        return HCCL_SUCCESS;
+    }
+    std::vector<bool> activePeers;
+    CHK_RET(GetAlltoAllActivePeers(opParam, userRank_, userRankSize_, activePeers));
+
+    auto trackerIter = alltoAllLazyLinkTrackers_.find(newTag);
+    if (trackerIter == alltoAllLazyLinkTrackers_.end()) {
+        trackerIter = alltoAllLazyLinkTrackers_.emplace(newTag, AlltoAllLazyLinkTracker(userRank_, userRankSize_,
+            idleLimit, EnvConfig::GetExternalInputAlltoallvLinkBudget())).first;
+    }
+    AlltoAllLazyLinkTracker &tracker = trackerIter->second;
+    const u64 *countMatrix = (opParam.opType == HcclCMDType::HCCL_CMD_ALLTOALLVC) ?
+        static_cast<const u64 *>(opParam.All2AllDataDes.sendCountMatrix) : nullptr;
+    std::vector<bool> releasePeers;
+    CHK_RET(tracker.Update(activePeers, countMatrix, releasePeers));
+
+    AlgResourceResponse &algRes = resMap_[newTag];
+    bool needIncreLink = false;
+    bool needRelease = false;
+    for (auto &levelTransport : algRes.opTransportResponse) {
+        for (auto &subCommTransport : levelTransport) {
+            u32 linkNum = std::min(subCommTransport.transportRequests.size(), subCommTransport.links.size());
+            for (u32 i = 0; i < linkNum; i++) {
+                u32 remoteRank = subCommTransport.transportRequests[i].remoteUserRank;
+                if (remoteRank >= userRankSize_ || remoteRank == userRank_) {
+                    continue;
+                }
+                bool hasLink = (subCommTransport.links[i] != nullptr);
+                needIncreLink = needIncreLink || (activePeers[remoteRank] && !hasLink);
+                needRelease = needRelease || (releasePeers[remoteRank] && hasLink);
+            }
+        }
+    }
+
+    if (needRelease) {
+        // 之前下发的算子可能仍在使用待回收的链路
+        CHK_RET(hcclStreamSynchronize(opParam.stream.ptr()));
+        u32 releaseNum = ReleaseAlltoAllLazyLinks(algRes.opTransportResponse, releasePeers);
+        (void)ReleaseAlltoAllLazyLinks(algRes.opTransportResponseBackUp, releasePeers);
+        HCCL_INFO("[UpdateAlltoAllLazyLinks]tag[%s] callSeq[%llu] release [%u] links, [%u] links remain",
+            newTag.c_str(), tracker.GetCallSeq(), releaseNum, tracker.GetLinkNum());
+    }
+    if (needIncreLink) {
+        AlgResourceRequest resRequest;
+        CHK_RET(algOperator->CalcIncreLinkRequest(algName, opParam, resRequest));
+        CHK_RET(IncreAllocLink(newTag, opParam, resRequest, algRes));
+        HCCL_INFO("[UpdateAlltoAllLazyLinks]tag[%s] callSeq[%llu] establish links to new peers",
+            newTag.c_str(), tracker.GetCallSeq());
+    }
+#endif
+    return HCCL_SUCCESS;
+}
+
+u32 HcclCommunicator::ReleaseAlltoAllLazyLinks(OpCommTransport &opTransportResponse,
+    const std::vector<bool> &releasePeers)
+{
+    std::vector<LINK> releaseLinks;
+    for (auto &levelTransport : opTransportResponse) {
+        for (auto &subCommTransport : levelTransport) {
+            u32 linkNum = std::min(subCommTransport.transportRequests.size(), subCommTransport.links.size());
+            for (u32 i = 0; i < linkNum; i++) {
+                TransportRequest &transportRequest = subCommTransport.transportRequests[i];
+                if (transportRequest.remoteUserRank >= releasePeers.size() ||
+                    !releasePeers[transportRequest.remoteUserRank] || subCommTransport.links[i] == nullptr) {
+                    continue;
+                }
+                releaseLinks.push_back(subCommTransport.links[i]);
+                subCommTransport.links[i] = nullptr;
+                transportRequest.isValid = false;
+                if (i < subCommTransport.status.size()) {
+                    subCommTransport.status[i] = TransportStatus::INIT;
+                }
+            }
+        }
+    }
+    std::unique_lock<std::mutex> commLock(linkResMapMutex_);
+    for (auto &link : releaseLinks) {
+        linkResMap_.erase(link.get());
+    }
+    commLock.unlock();
+    for (auto &link : releaseLinks) {
+        link->DeInit();
+    }
+    return releaseLinks.size();
+}
+
 HcclResult HcclCommunicator::InitRecvMsgAndRequestBuffer()
 {
 #ifndef CCL_KERNEL_AICPU
@@ -7534,16 +7796,51 @@ HcclResult HcclCommunicator::AicpuInitOpTilingDataBuf(const OpParam &opParam, co
         opDataDesPtr->dataType = static_cast<u8>(opParam.DataDes.dataType);
     }
     HCCL_INFO("[HcclCommunicator][AicpuInitOpTilingDataBuf]algType[%lu]", opTilingData->algType);
-    CHK_SAFETY_FUNC_RET(memcpy_s(opTilingData->algName, sizeof(opTilingData->algName), opTilingInfo.algName.c_str(),
-        opTilingInfo.algName.length() + 1));
-    CHK_SAFETY_FUNC_RET(memcpy_s(opTilingData->newTag, sizeof(opTilingData->newTag),
-        opTilingInfo.newTag.c_str(), opTilingInfo.newTag.length() + 1));
-    CHK_SAFETY_FUNC_RET(memcpy_s(opTilingData->tag, sizeof(opTilingData->tag), opParam.tag.c_str(),
-        opParam.tag.length() + 1));
+    CHK_RET(EncodeOpTilingHeader({opTilingData->algName, sizeof(opTilingData->algName)},
+        {opTilingData->newTag, sizeof(opTilingData->newTag)}, {opTilingData->tag, sizeof(opTilingData->tag)},
+        opTilingInfo.algName, opTilingInfo.newTag, opParam.tag));
 #endif
     return HCCL_SUCCESS;
 }
 
+// 重执行场景同一算子多次下发, 仅同步标记不同, 复用上一次填充的tiling data
+HcclResult HcclCommunicator::AicpuUpdateOpTilingDataSyncFlags()
+{
+#ifndef CCL_KERNEL_AICPU
+    struct OpTilingData *opTilingData = static_cast<struct OpTilingData *>(opTilingDataBuf_.ptr());
+    CHK_PTR_NULL(opTilingData);
+    opTilingData->isInplacePreSync = static_cast<u8>(isInplacePreSync_);
+    opTilingData->isPostSync = static_cast<u8>(isPostSync_);
+    ProfilerBase::GetSubmittedOpCnt(opTilingData->index);
+#endif
+    return HCCL_SUCCESS;
+}
+
+const std::string &HcclCommunicator::GetAicpuKernelProfName(HcclCMDType opType)
+{
+    auto iter = aicpuKernelProfNames_.find(opType);
+    if (iter != aicpuKernelProfNames_.end()) {
+        return iter->second;
+    }
+    std::string profName = GetCMDTypeEnumStr(opType);
+    if (profName == "Invalid HcclCMDType" || profName == "invalid") {
+        profName = "HcclOpAicpuKernel";
+    } else {
+        profName += "AicpuKernel";
+    }
+    return aicpuKernelProfNames_.emplace(opType, profName).first->second;
+}
+
+// 全局回调表按streamId只保留首次注册的回调, 每条流注册一次即可
+void HcclCommunicator::RegisterAicpuTaskExceptionCallBack(s32 streamId)
+{
+    if (!aicpuExceptionCbStreamIds_.insert(streamId).second) {
+        return;
+    }
+    auto getAicpuTaskExceptionCallBack = [this]() {return this->GetAicpuTaskException();};
+    RegisterGetAicpuTaskExceptionCallBack(streamId, deviceLogicId_, getAicpuTaskExceptionCallBack);
+}
+
 HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchIn(const OpParam &opParam,const DeviceMem &deviceContext,
     const std::string &kernelName, const AicpuOpTiling opTilingInfo, u64 opTilingDataSize)
 {
@@ -7554,27 +7851,22 @@ HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchIn(const OpParam &opParam,c
     CHK_RET(LocalNotify::Post(mainStream, dispatcher_, localAiCpuOpNotify_[0], INVALID_VALUE_STAGE));
 
     // 使能重执行时，在主流下kernel，避免提前展开占核
-    rtStream_t kfcOpStream = (opTilingInfo.isUsedMainStream || retryEnable_) ? opParam.stream.ptr() : opStream_.ptr();
+    const Stream *kfcStream = (opTilingInfo.isUsedMainStream || retryEnable_) ? &opParam.stream : &opStream_;
     HcclWorkflowMode mode = GetWorkflowMode();
     // 如果是图模式，则尝试从附属从流中获取一下stream，如果能拿到则使用，否则用原有的
     if (mode == HcclWorkflowMode::HCCL_WORKFLOW_MODE_OPS_KERNEL_INFO_LIB &&
         !attachedStreams_.empty() && attachedStreams_[0].ptr() != nullptr) {
-        kfcOpStream = attachedStreams_[0].ptr();
-        HCCL_INFO("[HcclCommunicator][AicpuKfcTilingDataLaunchExt] Use attached stream [%p]", kfcOpStream);
+        kfcStream = &attachedStreams_[0];
+        HCCL_INFO("[HcclCommunicator][AicpuKfcTilingDataLaunchExt] Use attached stream [%p]", kfcStream->ptr());
     }
+    rtStream_t kfcOpStream = kfcStream->ptr();
     uint64_t beginTime = hrtMsprofSysCycleTime();
-    std::string profName = GetCMDTypeEnumStr(opParam.opType);
-    if (profName == "Invalid HcclCMDType" || profName == "invalid") {
-        profName = "HcclOpAicpuKernel";
-    } else {
-        profName += "AicpuKernel";
-    }
-    s32 streamId = 0;
-    CHK_RET(hrtGetStreamId(kfcOpStream, streamId));
-    auto getAicpuTaskExceptionCallBack = [this]() {return this->GetAicpuTaskException();};
-    RegisterGetAicpuTaskExceptionCallBack(streamId, deviceLogicId_, getAicpuTaskExceptionCallBack);
+    const std::string &profName = GetAicpuKernelProfName(opParam.opType);
+    // Stream对象已记录streamId, 无需再向runtime查询
+    s32 streamId = kfcStream->id();
+    RegisterAicpuTaskExceptionCallBack(streamId);
     if (streamId != opParam.stream.id()) {
-        RegisterGetAicpuTaskExceptionCallBack(opParam.stream.id(), deviceLogicId_, getAicpuTaskExceptionCallBack);
+        RegisterAicpuTaskExceptionCallBack(opParam.stream.id());
     }
     HCCL_INFO("profName:%s streamId[%d] opParam streamId[%d]", profName.c_str(), streamId, opParam.stream.id());
 #ifndef HCCD
@@ -7635,6 +7927,7 @@ HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchExt(const OpParam &opParam,
     if (opType == HcclCMDType::HCCL_CMD_ALLREDUCE &&
         retryEnable_ && (inPlaceSupportRetryStatus_ == InplaceSupportRetryStatus::USER_LARGER_THAN_CCL)) {
         u32 itemNum = 2;
+        u64 dynamicDataSize = CalcOpTilingDynamicDataSize(opParam, opType, GetRankSize(), opTilingInfo.algName);
         for (u32 i = 0; i < itemNum; i++) {
             if (i == 0) {
                 isInplacePreSync_ = true;
@@ -7643,8 +7936,11 @@ HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchExt(const OpParam &opParam,
             }
             HCCL_DEBUG("[AicpuKfcTilingDataLaunchExt][PreSync]The op with isInplacePreSync_[%d].",
                 isInplacePreSync_);
-            u64 dynamicDataSize = CalcOpTilingDynamicDataSize(opParam, opType, GetRankSize(), opTilingInfo.algName);
-            CHK_RET(AicpuInitOpTilingDataBuf(opParam, opType, kernelName, opTilingInfo, dynamicDataSize));
+            if (i == 0) {
+                CHK_RET(AicpuInitOpTilingDataBuf(opParam, opType, kernelName, opTilingInfo, dynamicDataSize));
+            } else {
+                CHK_RET(AicpuUpdateOpTilingDataSyncFlags());
+            }
             CHK_RET(AicpuKfcTilingDataLaunchIn(opParam, deviceContext, kernelName, opTilingInfo,
                 sizeof(struct OpTilingData) + dynamicDataSize));
             isInplacePreSync_ = false;
@@ -7659,15 +7955,17 @@ HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchExt(const OpParam &opParam,
                 sizeof(struct OpTilingData) + dynamicDataSize));
             isPostSync_ = false;
     } else if (retryEnable_ && opType == HcclCMDType::HCCL_CMD_REDUCE_SCATTER) {
+        u64 dynamicDataSize = CalcOpTilingDynamicDataSize(opParam, opType, GetRankSize(), opTilingInfo.algName);
+        bool tilingReady = false;
         if (inPlaceSupportRetryStatus_ == InplaceSupportRetryStatus::USER_LARGER_THAN_CCL) {
             isInplacePreSync_ = true;
             HCCL_DEBUG("[AicpuKfcTilingDataLaunchExt][PreSync]The op with isInplacePreSync_[%d].",
                 isInplacePreSync_);
-            u64 dynamicDataSize = CalcOpTilingDynamicDataSize(opParam, opType, GetRankSize(), opTilingInfo.algName);
             CHK_RET(AicpuInitOpTilingDataBuf(opParam, opType, kernelName, opTilingInfo, dynamicDataSize));
             CHK_RET(AicpuKfcTilingDataLaunchIn(opParam, deviceContext, kernelName, opTilingInfo,
                 sizeof(struct OpTilingData) + dynamicDataSize));
             isInplacePreSync_ = false;
+            tilingReady = true;
         }
         isInplacePreSync_ = false;
         if (needPostSync) {
@@ -7676,8 +7974,11 @@ HcclResult HcclCommunicator::AicpuKfcTilingDataLaunchExt(const OpParam &opParam,
         HCCL_DEBUG("[AicpuKfcTilingDataLaunchExt][PreSync]The op with "
             "isInplacePreSync_[%d], isPostSync_[%d].",
             isInplacePreSync_, isPostSync_);
-        u64 dynamicDataSize = CalcOpTilingDynamicDataSize(opParam, opType, GetRankSize(), opTilingInfo.algName);
-        CHK_RET(AicpuInitOpTilingDataBuf(opParam, opType, kernelName, opTilingInfo, dynamicDataSize));
+        if (tilingReady) {
+            CHK_RET(AicpuUpdateOpTilingDataSyncFlags());
+        } else {
+            CHK_RET(AicpuInitOpTilingDataBuf(opParam, opType, kernelName, opTilingInfo, dynamicDataSize));
+        }
         CHK_RET(AicpuKfcTilingDataLaunchIn(opParam, deviceContext, kernelName, opTilingInfo,
             sizeof(struct OpTilingData) + dynamicDataSize));
         isPostSync_ = false;
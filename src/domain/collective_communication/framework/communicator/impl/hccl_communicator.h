@@ -12,6 +12,7 @@
 #define HCCL_COMMUNICATOR_H
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <hccl/hccl_types.h>
 #include "hccl_communicator_attrs.h"
@@ -25,6 +26,7 @@
 #include "topoinfo_parse.h"
 #include "hccl_alg.h"
 #include "ccl_buffer_manager.h"
+#include "alltoall_lazy_link_tracker.h"
 #include "hccl_trace_info.h"
 #include "hccl_callback_task.h"
 #include "aicpu_operator_pub.h"
@@ -141,6 +143,11 @@ public:
         SyncMode syncMode = SyncMode::DEFAULT_TIMEWAITSYNCMODE);
     #endif
 
+    // 持久化算子: 创建时完成参数校验、算法选择与资源创建, 之后每次Start只下发任务
+    HcclResult CreatePersistentOp(const std::function<HcclResult()> &issueOp, u64 &opId);
+    HcclResult StartPersistentOp(u64 opId);
+    HcclResult DestroyPersistentOp(u64 opId);
+
     virtual HcclResult AlltoAllV(const void *sendBuf, const void *sendCounts, const void *sdispls,
         HcclDataType sendType, const void *recvBuf, const void *recvCounts, const void *rdispls, HcclDataType recvType,
         rtStream_t stream, const std::string &tag);
@@ -447,6 +454,9 @@ private:
         const std::string &kernelName, const AicpuOpTiling opTilingInfo, u64 dynamicDataSize);
     HcclResult AicpuKfcTilingDataLaunchIn(const OpParam &opParam, const DeviceMem &deviceContext, 
         const std::string &kernelName, const AicpuOpTiling opTilingInfo, u64 opTilingDataSize);
+    HcclResult AicpuUpdateOpTilingDataSyncFlags();
+    const std::string &GetAicpuKernelProfName(HcclCMDType opType);
+    void RegisterAicpuTaskExceptionCallBack(s32 streamId);
     HcclResult AllReduceAicpuUnfold(const std::string &tag, void *inputPtr, void *outputPtr, u64 count,
         HcclDataType dataType, HcclReduceOp op, HcclRtStream stream);
     HcclResult CreateMutiStreamResFor310P(const std::string &tag, level1StreamInfo_t &streamInfo);
@@ -605,6 +615,10 @@ private:
     HcclResult NslbDp_CollectSendAdjTable(HcclCMDType opType, OpParam &opParam,
                                           AlgType nslbAlgType, AdjInfo &nslbAdjInfo);
     HcclResult ExecOp(HcclCMDType opType, OpParam &opParam);
+    HcclResult ResolveOp(HcclCMDType opType, OpParam &opParam, bool isInGraphCaptureZeroCopy,
+        std::unique_ptr<CollAlgOperator> &algOperator, std::string &algName, AlgDesc &algDesc, std::string &newTag);
+    HcclResult LaunchOp(HcclCMDType opType, OpParam &opParam, std::unique_ptr<CollAlgOperator> &algOperator,
+        const std::string &algName, const AlgDesc &algDesc, const std::string &newTag);
     // alltoall专用
     HcclResult ExecOpAlltoAll(HcclCMDType opType, OpParam &opParam);
     HcclResult FreeScratchMemOnOpBaseMode(DeviceMem &scratchMem, const OpParam &opParam,
@@ -618,6 +632,12 @@ private:
         AlgResourceRequest &resRequest, AlgResourceResponse &algResResponse);
     HcclResult IncreAllocLink(const std::string &newTag, const OpParam &opParam,
         AlgResourceRequest &resRequest, AlgResourceResponse &algResResponse);
+    HcclResult UpdateAlltoAllLazyLinks(const std::string &newTag, const std::string &algName,
+        const AlgDesc &algDesc, const OpParam &opParam, std::unique_ptr<CollAlgOperator> &algOperator);
+    u32 ReleaseAlltoAllLazyLinks(OpCommTransport &opTransportResponse, const std::vector<bool> &releasePeers);
+    struct PersistentOpPlan;
+    HcclResult RecordPersistentOp(HcclCMDType opType, const OpParam &opParam);
+    HcclResult ResolvePersistentOp(PersistentOpPlan &plan);
     DeviceMem GetWorkspaceScracthMem(const std::string &tag, u64 allocMemSize);
     std::vector<Stream> GetWorkspaceSubStreams(const std::string &tag, u32 num);
     // HcclImplBase中Comm资源是否存在
@@ -782,6 +802,19 @@ private:
     std::unique_ptr<ZeroCopyMemoryAgent> zeroCopyMemoryAgent_ = { nullptr };
 #endif
     std::unordered_map<std::string, AlgResourceResponse> resMap_; // tag : AlgResourceResponse
+    std::unordered_map<std::string, AlltoAllLazyLinkTracker> alltoAllLazyLinkTrackers_; // tag : 按需建链的链路使用记录
+    struct PersistentOpPlan {
+        HcclCMDType opType = HcclCMDType::HCCL_CMD_INVALID;
+        OpParam origParam;                              // 创建时的入参, 资源失效时据此重新解析
+        OpParam opParam;                                // 算法选择后的入参
+        std::unique_ptr<CollAlgOperator> algOperator;
+        std::string algName;
+        AlgDesc algDesc;
+        std::string newTag;
+    };
+    std::unordered_map<u64, std::unique_ptr<PersistentOpPlan>> persistentOps_; // opId : 已解析的算子
+    PersistentOpPlan *persistentOpRecorder_ = nullptr;  // 非空时ExecOp只解析不下发
+    u64 persistentOpIdSeed_ = 0;
     std::unordered_set<std::string> hostResMap_;
     std::unordered_set<std::string> hbSendRecvTags_;
     std::vector<DeviceMem> deviceResOrigMem_;
@@ -827,9 +860,12 @@ private:
     std::shared_ptr<HDCommunicate> kfcStatusTransferD2H_;
     HcclCommConnections commConnections_;
     HcclSocketPortConfig commPortConfig_;
+    std::string socketShareKey_;  // 建链共享key, 根通信域为自身标识, 子通信域继承父通信域
     std::shared_ptr<PetersonLock> hostDeviceLock_;
     bool isNsRecovery_{false};
     HostMem opTilingDataBuf_;
+    std::map<HcclCMDType, std::string> aicpuKernelProfNames_;
+    std::unordered_set<s32> aicpuExceptionCbStreamIds_;
     HostMem apiTilingDataMem_;
     // 单机场景下多卡间能互相访问的共享buffer，除了自己rank是申请的，其余均是Ipc打开的
     DeviceMem zeroCopyLocalBuffer_;
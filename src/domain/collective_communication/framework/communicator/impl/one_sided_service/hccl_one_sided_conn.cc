@@ -9,6 +9,7 @@
  */
 
 #include "hccl_one_sided_conn.h"
+#include "one_sided_batch_planner.h"
 #include "sal_pub.h"
 
 namespace hccl {
@@ -113,38 +114,29 @@ void HcclOneSidedConn::DisableMemAccess(const HcclMemDesc &remoteMemDesc)
 
 void HcclOneSidedConn::BatchWrite(const HcclOneSideOpDesc* oneSideDescs, u32 descNum, const rtStream_t& stream)
 {
-    for (u32 i = 0; i < descNum; i++) {
-        if (oneSideDescs[i].count == 0) {
-            HCCL_WARNING("[HcclOneSidedConn][BatchWrite] Desc item[%u] count is 0.", i);
-        }
-        u32 unitSize;
-        EXCEPTION_THROW_IF_ERR(SalGetDataTypeSize(oneSideDescs[i].dataType, unitSize),
-            "[HcclOneSidedConn][BatchWrite] Get dataType size failed!");
-        u64 byteSize = oneSideDescs[i].count * unitSize;
-        TransportMem::RmaOpMem remoteMem = {oneSideDescs[i].remoteAddr, byteSize};
-        TransportMem::RmaOpMem localMem = {oneSideDescs[i].localAddr, byteSize};
-        EXCEPTION_THROW_IF_ERR(transportMemPtr_->Write(remoteMem, localMem, stream),
-            "[HcclOneSidedConn][BatchWrite] transportMem WriteAsync failed.");
-    }
-    EXCEPTION_THROW_IF_ERR(transportMemPtr_->AddOpFence(stream), "[HcclOneSidedConn][BatchWrite] AddOpFence failed.");
+    std::vector<OneSidedTransfer> transfers;
+    EXCEPTION_THROW_IF_ERR(OneSidedBatchPlanner::Plan(oneSideDescs, descNum, OneSidedBatchOp::BATCH_WRITE,
+        GetMaxTransferSize(), transfers), "[HcclOneSidedConn][BatchWrite] Plan batch descs failed!");
+    OneSidedBatchStat stat;
+    EXCEPTION_THROW_IF_ERR(OneSidedBatchPlanner::Issue(*transportMemPtr_, transfers, OneSidedBatchOp::BATCH_WRITE,
+        stream, stat), "[HcclOneSidedConn][BatchWrite] Issue batch transfers failed.");
+    HCCL_DEBUG("[HcclOneSidedConn][BatchWrite] descNum[%u] wrNum[%u] bytes[%llu]", descNum, stat.wrNum, stat.bytes);
 }
 
 void HcclOneSidedConn::BatchRead(const HcclOneSideOpDesc* oneSideDescs, u32 descNum, const rtStream_t& stream)
 {
-    for (u32 i = 0; i < descNum; i++) {
-        if (oneSideDescs[i].count == 0) {
-            HCCL_WARNING("[HcclOneSidedConn][BatchRead] Desc item[%u] count is 0.", i);
-        }
-        u32 unitSize;
-        EXCEPTION_THROW_IF_ERR(SalGetDataTypeSize(oneSideDescs[i].dataType, unitSize),
-            "[HcclOneSidedConn][BatchRead] Get dataType size failed!");
-        u64 byteSize = oneSideDescs[i].count * unitSize;
-        TransportMem::RmaOpMem remoteMem = {oneSideDescs[i].remoteAddr, byteSize};
-        TransportMem::RmaOpMem localMem = {oneSideDescs[i].localAddr, byteSize};
-        EXCEPTION_THROW_IF_ERR(transportMemPtr_->Read(localMem, remoteMem, stream),
-            "[HcclOneSidedConn][BatchRead] transportMem ReadAsync failed.");
-    }
-    EXCEPTION_THROW_IF_ERR(transportMemPtr_->AddOpFence(stream), "[HcclOneSidedConn][BatchRead] AddOpFence failed.");
+    std::vector<OneSidedTransfer> transfers;
+    EXCEPTION_THROW_IF_ERR(OneSidedBatchPlanner::Plan(oneSideDescs, descNum, OneSidedBatchOp::BATCH_READ,
+        GetMaxTransferSize(), transfers), "[HcclOneSidedConn][BatchRead] Plan batch descs failed!");
+    OneSidedBatchStat stat;
+    EXCEPTION_THROW_IF_ERR(OneSidedBatchPlanner::Issue(*transportMemPtr_, transfers, OneSidedBatchOp::BATCH_READ,
+        stream, stat), "[HcclOneSidedConn][BatchRead] Issue batch transfers failed.");
+    HCCL_DEBUG("[HcclOneSidedConn][BatchRead] descNum[%u] wrNum[%u] bytes[%llu]", descNum, stat.wrNum, stat.bytes);
+}
+
+u64 HcclOneSidedConn::GetMaxTransferSize() const
+{
+    return useRdma_ ? ONE_SIDED_RDMA_MAX_TRANSFER_SIZE : ONE_SIDED_SDMA_MAX_TRANSFER_SIZE;
 }
 
 }
\ No newline at end of file
@@ -52,6 +52,8 @@ public:
     void BatchRead(const HcclOneSideOpDesc* oneSideDescs, u32 descNum, const rtStream_t& stream);
 
 private:
+    u64 GetMaxTransferSize() const;
+
     HcclNetDevCtx netDevCtx_{};
 
     const HcclRankLinkInfo &localRankInfo_;
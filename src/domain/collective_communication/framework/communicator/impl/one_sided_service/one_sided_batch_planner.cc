@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "one_sided_batch_planner.h"
+#include <algorithm>
+#include "log.h"
+#include "sal_pub.h"
+
+namespace hccl {
+HcclResult OneSidedBatchPlanner::BuildTransfers(const HcclOneSideOpDesc *descs, u32 descNum,
+    std::vector<OneSidedTransfer> &transfers)
+{
+    transfers.clear();
+    transfers.reserve(descNum);
+    for (u32 i = 0; i < descNum; i++) {
+        if (descs[i].count == 0) {
+            HCCL_WARNING("[OneSidedBatchPlanner][BuildTransfers] Desc item[%u] count is 0.", i);
+            continue;
+        }
+        u32 unitSize = 0;
+        CHK_RET(SalGetDataTypeSize(descs[i].dataType, unitSize));
+        transfers.push_back({reinterpret_cast<u64>(descs[i].localAddr), reinterpret_cast<u64>(descs[i].remoteAddr),
+            descs[i].count * unitSize});
+    }
+    return HCCL_SUCCESS;
+}
+
+bool OneSidedBatchPlanner::HasDestOverlap(const std::vector<OneSidedTransfer> &sortedTransfers, OneSidedBatchOp op)
+{
+    if (op == OneSidedBatchOp::BATCH_WRITE) {
+        // 已按远端地址排序, 检查相邻项即可
+        for (size_t i = 1; i < sortedTransfers.size(); i++) {
+            if (sortedTransfers[i - 1].remoteAddr + sortedTransfers[i - 1].size > sortedTransfers[i].remoteAddr) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<OneSidedTransfer> localSorted(sortedTransfers);
+    std::sort(localSorted.begin(), localSorted.end(),
+        [](const OneSidedTransfer &a, const OneSidedTransfer &b) { return a.localAddr < b.localAddr; });
+    for (size_t i = 1; i < localSorted.size(); i++) {
+        if (localSorted[i - 1].localAddr + localSorted[i - 1].size > localSorted[i].localAddr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void OneSidedBatchPlanner::MergeAndSplit(const std::vector<OneSidedTransfer> &orderedTransfers, u64 maxTransferSize,
+    std::vector<OneSidedTransfer> &transfers)
+{
+    std::vector<OneSidedTransfer> merged;
+    merged.reserve(orderedTransfers.size());
+    for (const OneSidedTransfer &cur : orderedTransfers) {
+        if (!merged.empty()) {
+            OneSidedTransfer &last = merged.back();
+            bool contiguous = (last.localAddr + last.size == cur.localAddr) &&
+                (last.remoteAddr + last.size == cur.remoteAddr);
+            if (contiguous && last.size + cur.size <= maxTransferSize) {
+                last.size += cur.size;
+                continue;
+            }
+        }
+        merged.push_back(cur);
+    }
+
+    transfers.clear();
+    transfers.reserve(merged.size());
+    for (const OneSidedTransfer &item : merged) {
+        for (u64 offset = 0; offset < item.size; offset += maxTransferSize) {
+            u64 size = std::min(maxTransferSize, item.size - offset);
+            transfers.push_back({item.localAddr + offset, item.remoteAddr + offset, size});
+        }
+    }
+}
+
+HcclResult OneSidedBatchPlanner::Plan(const HcclOneSideOpDesc *descs, u32 descNum, OneSidedBatchOp op,
+    u64 maxTransferSize, std::vector<OneSidedTransfer> &transfers)
+{
+    CHK_PRT_RET(descNum != 0 && descs == nullptr,
+        HCCL_ERROR("[OneSidedBatchPlanner][Plan] descs is null, descNum[%u]", descNum), HCCL_E_PTR);
+    CHK_PRT_RET(maxTransferSize == 0, HCCL_ERROR("[OneSidedBatchPlanner][Plan] maxTransferSize is 0"), HCCL_E_PARA);
+
+    std::vector<OneSidedTransfer> ordered;
+    CHK_RET(BuildTransfers(descs, descNum, ordered));
+
+    std::vector<OneSidedTransfer> sorted(ordered);
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const OneSidedTransfer &a, const OneSidedTransfer &b) { return a.remoteAddr < b.remoteAddr; });
+    bool keepCallerOrder = HasDestOverlap(sorted, op);
+
+    MergeAndSplit(keepCallerOrder ? ordered : sorted, maxTransferSize, transfers);
+    HCCL_DEBUG("[OneSidedBatchPlanner][Plan] descNum[%u] transferNum[%zu] keepCallerOrder[%d]",
+        descNum, transfers.size(), keepCallerOrder);
+    return HCCL_SUCCESS;
+}
+}
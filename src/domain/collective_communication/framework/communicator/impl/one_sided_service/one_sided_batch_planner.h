@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025-2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ONE_SIDED_BATCH_PLANNER_H
+#define ONE_SIDED_BATCH_PLANNER_H
+
+#include <vector>
+#include <hccl/hccl_types.h>
+#include <hccl/base.h>
+#include "hccl_one_sided_services.h"
+#include "log.h"
+
+namespace hccl {
+constexpr u64 ONE_SIDED_RDMA_MAX_TRANSFER_SIZE = 0x80000000ULL;  // RDMA单个WR最大传输2GB
+constexpr u64 ONE_SIDED_SDMA_MAX_TRANSFER_SIZE = 0xFFFFF000ULL;  // SDMA单个任务长度为u32, 取4GB-4KB保持页对齐
+
+struct OneSidedTransfer {
+    u64 localAddr;
+    u64 remoteAddr;
+    u64 size;
+};
+
+enum class OneSidedBatchOp {
+    BATCH_WRITE = 0,
+    BATCH_READ
+};
+
+/*
+ * BatchPut/BatchGet的下发规划:
+ * 1. 按远端地址排序, 本端与远端地址都连续的描述符合并为一次传输(不超过maxTransferSize);
+ * 2. 超过maxTransferSize的传输按maxTransferSize切分;
+ * 3. 若目的端(写为远端, 读为本端)地址存在重叠, 排序会改变覆盖顺序, 此时保持调用者顺序, 仅合并相邻连续项。
+ */
+struct OneSidedBatchStat {
+    u32 wrNum{0};       /* 已下发的WR个数 */
+    u64 bytes{0};       /* 已下发的字节数 */
+    bool fenced{false}; /* 全部WR下发后是否已追加fence */
+};
+
+class OneSidedBatchPlanner {
+public:
+    static HcclResult Plan(const HcclOneSideOpDesc *descs, u32 descNum, OneSidedBatchOp op, u64 maxTransferSize,
+        std::vector<OneSidedTransfer> &transfers);
+
+    /*
+     * 按规划顺序逐个下发WR, 全部成功后追加一次fence; 任一WR失败即停止, 不追加fence。
+     * T需提供与TransportMem一致的RmaOpMem/Write/Read/AddOpFence
+     */
+    template <typename T>
+    static HcclResult Issue(T &transportMem, const std::vector<OneSidedTransfer> &transfers, OneSidedBatchOp op,
+        const rtStream_t &stream, OneSidedBatchStat &stat)
+    {
+        stat = OneSidedBatchStat();
+        for (const OneSidedTransfer &transfer : transfers) {
+            typename T::RmaOpMem remoteMem = {reinterpret_cast<void *>(transfer.remoteAddr), transfer.size};
+            typename T::RmaOpMem localMem = {reinterpret_cast<void *>(transfer.localAddr), transfer.size};
+            HcclResult ret = (op == OneSidedBatchOp::BATCH_WRITE) ? transportMem.Write(remoteMem, localMem, stream) :
+                transportMem.Read(localMem, remoteMem, stream);
+            CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[OneSidedBatchPlanner][Issue] issue wr[%u] failed, "
+                "op[%d] size[%llu] ret[%d]", stat.wrNum, static_cast<s32>(op), transfer.size, ret), ret);
+            stat.wrNum++;
+            stat.bytes += transfer.size;
+        }
+        CHK_RET(transportMem.AddOpFence(stream));
+        stat.fenced = true;
+        return HCCL_SUCCESS;
+    }
+
+private:
+    static HcclResult BuildTransfers(const HcclOneSideOpDesc *descs, u32 descNum,
+        std::vector<OneSidedTransfer> &transfers);
+    static bool HasDestOverlap(const std::vector<OneSidedTransfer> &sortedTransfers, OneSidedBatchOp op);
+    static void MergeAndSplit(const std::vector<OneSidedTransfer> &orderedTransfers, u64 maxTransferSize,
+        std::vector<OneSidedTransfer> &transfers);
+};
+}
+#endif
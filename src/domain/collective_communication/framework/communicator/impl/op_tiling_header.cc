@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_tiling_header.h"
+#include "securec.h"
+#include "log.h"
+
+namespace hccl {
+HcclResult EncodeOpTilingHeader(const OpTilingHeaderField &algNameField, const OpTilingHeaderField &newTagField,
+    const OpTilingHeaderField &tagField, const std::string &algName, const std::string &newTag,
+    const std::string &tag)
+{
+    CHK_PTR_NULL(algNameField.buf);
+    CHK_PTR_NULL(newTagField.buf);
+    CHK_PTR_NULL(tagField.buf);
+    CHK_SAFETY_FUNC_RET(memcpy_s(algNameField.buf, algNameField.size, algName.c_str(), algName.length() + 1));
+    CHK_SAFETY_FUNC_RET(memcpy_s(newTagField.buf, newTagField.size, newTag.c_str(), newTag.length() + 1));
+    CHK_SAFETY_FUNC_RET(memcpy_s(tagField.buf, tagField.size, tag.c_str(), tag.length() + 1));
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
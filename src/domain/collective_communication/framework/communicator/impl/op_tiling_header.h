@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_TILING_HEADER_H
+#define OP_TILING_HEADER_H
+
+#include <string>
+#include "hccl/base.h"
+
+namespace hccl {
+// OpTilingData中的定长字符串字段
+struct OpTilingHeaderField {
+    char *buf = nullptr;
+    u64 size = 0;
+};
+
+// 将algName、newTag、tag连同结束符写入OpTilingData对应字段, AICPU侧按C字符串解析
+HcclResult EncodeOpTilingHeader(const OpTilingHeaderField &algNameField, const OpTilingHeaderField &newTagField,
+    const OpTilingHeaderField &tagField, const std::string &algName, const std::string &newTag,
+    const std::string &tag);
+}  // namespace hccl
+
+#endif /* OP_TILING_HEADER_H */
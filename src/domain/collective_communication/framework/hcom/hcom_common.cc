@@ -382,8 +382,14 @@ HcclResult HcomCreateGroupImpl(const std::string &group, const std::vector<u32>
         group, groupParamsTem.groupRank, hcomInfo.params.rank, groupParamsTem.groupRanks, groupParamsTem.pSubComm));
     CHK_SMART_PTR_NULL(groupParamsTem.pSubComm);
 
+    std::shared_ptr<const HcomGroupRankDesc> groupRankDesc;
+    CHK_RET(HcomBuildGroupRankDesc(groupParamsTem.groupRank, groupParamsTem.serverNum, groupParamsTem.groupRanks,
+        hcomInfo.rankTable.rankList.size(), groupRankDesc));
+
     groupParaLock.lock();
-    hcomInfo.hcomGroupMap.insert(std::make_pair(group, groupParamsTem));
+    if (hcomInfo.hcomGroupMap.insert(std::make_pair(group, groupParamsTem)).second) {
+        HcomPublishGroupRankDesc(hcomInfo.groupRankSnapshot, group, groupRankDesc);
+    }
     groupParaLock.unlock();
 
     HCCL_RUN_INFO("hcom create group[%s] success, take time [%lld]us",
@@ -529,6 +535,7 @@ HcclResult HcomDestroyGroupImpl(const std::string &group)
     (iter->second).groupRanks.clear();  // 清除该服务器内相关group的对应信息
 
     hcomInfo.hcomGroupMap.erase(group);
+    HcomPublishGroupRankDesc(hcomInfo.groupRankSnapshot, group, nullptr);
     groupParaLock.unlock();
 
     HCCL_RUN_INFO("hcom destroy group[%s] success.", group.c_str());
@@ -720,25 +727,29 @@ HcclResult HcomGetWorldRankFromGroupRank(const char *group, u32 groupRank, u32 *
     }
     HcomInfo &hcomInfo = HcomGetCtxHomInfo();
 
-    HcclResult ret = HcomCheckGroupName(group);
-    RPT_INPUT_ERR(ret != HCCL_SUCCESS,
-        "EI0003", std::vector<std::string>({ "ccl_op", "parameter", "value", "tips" }),
-        std::vector<std::string>({
-            "HcomGetWorldRankFromGroupRank",
-            "group",
-            { group, strnlen(group, GROUP_NAME_MAX_LEN + 1) },
-            "please check group name"
-        }));
-    CHK_PRT_RET(ret != HCCL_SUCCESS,
-        HCCL_ERROR("[Get][WorldRank]errNo[0x%016llx] group name is invalid", HCOM_ERROR_CODE(ret)), ret);
+    // 已注册的group名字在创建时已校验, 命中线程缓存的group句柄时跳过重复校验
+    bool isInterned = (HcomLookupGroupRankDesc(hcomInfo.groupRankSnapshot, group, true) != nullptr);
+    if (!isInterned) {
+        HcclResult ret = HcomCheckGroupName(group);
+        RPT_INPUT_ERR(ret != HCCL_SUCCESS,
+            "EI0003", std::vector<std::string>({ "ccl_op", "parameter", "value", "tips" }),
+            std::vector<std::string>({
+                "HcomGetWorldRankFromGroupRank",
+                "group",
+                { group, strnlen(group, GROUP_NAME_MAX_LEN + 1) },
+                "please check group name"
+            }));
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[Get][WorldRank]errNo[0x%016llx] group name is invalid", HCOM_ERROR_CODE(ret)), ret);
+    }
     if (groupRank >= hcomInfo.params.totalRanks) {
         HCCL_ERROR("[Get][WorldRank]errNo[0x%016llx] groupRank[%u] is out of range[0-%u]",
             HCOM_ERROR_CODE(HCCL_E_PARA), groupRank, hcomInfo.params.totalRanks);
         return HCCL_E_PARA;
     }
-    std::string strGroup = (group == nullptr) ? HCCL_WORLD_GROUP : group;
-    CHK_RET(GetGroupRankInfo(strGroup.c_str(), RankInfoType::WORLD_RANK_ID_BY_GROUP, groupRank, worldRank));
-    HCCL_INFO("hcom get world rank success, group[%s], groupRank[%u], worldRank[%p]", strGroup.c_str(), groupRank,
+    const char *groupName = (group == nullptr) ? HCCL_WORLD_GROUP : group;
+    CHK_RET(GetGroupRankInfo(groupName, RankInfoType::WORLD_RANK_ID_BY_GROUP, groupRank, worldRank));
+    HCCL_INFO("hcom get world rank success, group[%s], groupRank[%u], worldRank[%p]", groupName, groupRank,
         worldRank);
     return HCCL_SUCCESS;
 }
@@ -755,25 +766,29 @@ HcclResult HcomGetGroupRankFromWorldRank(u32 worldRank, const char *group, u32 *
     }
     HcomInfo &hcomInfo = HcomGetCtxHomInfo();
 
-    HcclResult ret = HcomCheckGroupName(group);
-    RPT_INPUT_ERR(ret != HCCL_SUCCESS,
-        "EI0003", std::vector<std::string>({ "ccl_op", "parameter", "value", "tips" }),
-        std::vector<std::string>({
-            "HcomGetGroupRankFromWorldRank",
-            "group",
-            { group, strnlen(group, GROUP_NAME_MAX_LEN + 1) },
-            "please check group name"
-        }));
-    CHK_PRT_RET(ret != HCCL_SUCCESS,
-        HCCL_ERROR("[Get][GroupRank]errNo[0x%016llx] group name is invalid", HCOM_ERROR_CODE(ret)), ret);
-    std::string strGroup = (group == nullptr) ? HCCL_WORLD_GROUP : group;
+    // 已注册的group名字在创建时已校验, 命中线程缓存的group句柄时跳过重复校验
+    bool isInterned = (HcomLookupGroupRankDesc(hcomInfo.groupRankSnapshot, group, true) != nullptr);
+    if (!isInterned) {
+        HcclResult ret = HcomCheckGroupName(group);
+        RPT_INPUT_ERR(ret != HCCL_SUCCESS,
+            "EI0003", std::vector<std::string>({ "ccl_op", "parameter", "value", "tips" }),
+            std::vector<std::string>({
+                "HcomGetGroupRankFromWorldRank",
+                "group",
+                { group, strnlen(group, GROUP_NAME_MAX_LEN + 1) },
+                "please check group name"
+            }));
+        CHK_PRT_RET(ret != HCCL_SUCCESS,
+            HCCL_ERROR("[Get][GroupRank]errNo[0x%016llx] group name is invalid", HCOM_ERROR_CODE(ret)), ret);
+    }
+    const char *groupName = (group == nullptr) ? HCCL_WORLD_GROUP : group;
     if (worldRank >= hcomInfo.params.totalRanks) {
         HCCL_ERROR("[Get][GroupRank]errNo[0x%016llx] world[%u] rank is invalid", HCOM_ERROR_CODE(HCCL_E_PARA),
             worldRank);
         return HCCL_E_PARA;
     }
-    CHK_RET(GetGroupRankInfo(strGroup.c_str(), RankInfoType::GROUP_RANK_ID_BY_WORLD, worldRank, groupRank));
-    HCCL_INFO("hcom get group rank success, group[%s], worldRank[%u], groupRank[%p]", strGroup.c_str(), worldRank,
+    CHK_RET(GetGroupRankInfo(groupName, RankInfoType::GROUP_RANK_ID_BY_WORLD, worldRank, groupRank));
+    HCCL_INFO("hcom get group rank success, group[%s], worldRank[%u], groupRank[%p]", groupName, worldRank,
         groupRank);
     return HCCL_SUCCESS;
 }
@@ -820,54 +835,49 @@ HcclResult GetWorldGroupRankInfo(RankInfoType rankType, u32 inPara, u32 *outPara
 HcclResult GetGroupRankInfo(const char *group, RankInfoType rankType, u32 inPara, u32 *outPara)
 {
     CHK_PTR_NULL(outPara);
-    // std::string strGroup = (group == nullptr) ? HCCL_WORLD_GROUP : group;
     if ((group == nullptr) || (strcmp(group, HCCL_WORLD_GROUP) == 0)) {
         CHK_RET(GetWorldGroupRankInfo(rankType, inPara, outPara));
         return HCCL_SUCCESS;
     }
     HcomInfo &hcomInfo = HcomGetCtxHomInfo();
 
-    std::unique_lock<std::mutex> groupParaLock(hcomInfo.groupParamsLock);
-    auto iter = hcomInfo.hcomGroupMap.find(group);
-    if (iter == hcomInfo.hcomGroupMap.end()) {
+    std::shared_ptr<const HcomGroupRankDesc> desc = HcomLookupGroupRankDesc(hcomInfo.groupRankSnapshot, group);
+    if (desc == nullptr) {
         HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] group[%s] is not exist", HCOM_ERROR_CODE(HCCL_E_NOT_FOUND),
             group);
         return HCCL_E_NOT_FOUND;  // 不存在该服务器内相关dev的对应信息
     }
     // group ranks判空
-    CHK_PRT_RET((iter->second).groupRanks.empty(), HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] group[%s]"
+    CHK_PRT_RET(desc->groupToWorld.empty(), HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] group[%s]"
         "ranks is empty", HCOM_ERROR_CODE(HCCL_E_INTERNAL), group), HCCL_E_INTERNAL);
 
     switch (rankType) {
         case RankInfoType::RANK_SIZE_IN_GROUP:
-            *outPara = (iter->second).totalRanks;
+            *outPara = desc->totalRanks;
             return HCCL_SUCCESS;
 
         case RankInfoType::RANK_ID_IN_GROUP:
-            *outPara = (iter->second).groupRank;
+            *outPara = desc->groupRank;
             return HCCL_SUCCESS;
 
         case RankInfoType::WORLD_RANK_ID_BY_GROUP:
-            if (inPara >= (iter->second).totalRanks) {
+            if (inPara >= desc->totalRanks) {
                 HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] group[%s] groupRank[%u] is invalid",
                     HCOM_ERROR_CODE(HCCL_E_PARA), group, inPara);
                 return HCCL_E_PARA;
             }
-            *outPara = (iter->second).groupRanks[inPara];
+            *outPara = desc->groupToWorld[inPara];
             return HCCL_SUCCESS;
 
         case RankInfoType::GROUP_RANK_ID_BY_WORLD:
-            for (u32 rank = 0; rank < (iter->second).totalRanks; rank++) {
-                if (inPara == (iter->second).groupRanks[rank]) {
-                    *outPara = rank;
-                    return HCCL_SUCCESS;
-                }
+            if (HcomGetGroupRankByWorldRank(*desc, inPara, *outPara) == HCCL_SUCCESS) {
+                return HCCL_SUCCESS;
             }
             HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] invalid rankInfo type[%d]",
                 HCOM_ERROR_CODE(HCCL_E_PARA), rankType);
             return HCCL_E_PARA;
         case RankInfoType::SERVER_NUM_IN_GROUP:
-            *outPara = (iter->second).serverNum;
+            *outPara = desc->serverNum;
             return HCCL_SUCCESS;
         default:
             HCCL_ERROR("[Get][GroupRankInfo]errNo[0x%016llx] invalid rankInfo type[%d]",
@@ -933,6 +943,7 @@ HcclResult HcomDestroyOneDevice(HcomInfo &hcomInfo)
     hcomInfo.params.commConnections.agentConnection = nullptr;
     hcomInfo.params.commConnections.serverConnections.clear();
     hcomInfo.hcomGroupMap.clear();
+    HcomClearGroupRankSnapshot(hcomInfo.groupRankSnapshot);
     std::unique_lock<std::mutex> backloggedGroupLock(hcomInfo.backloggedGroupLock);
     hcomInfo.backloggedGroup.clear();
     backloggedGroupLock.unlock();
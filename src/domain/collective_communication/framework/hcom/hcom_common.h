@@ -13,6 +13,7 @@
 
 #include "hccl_comm_pub.h"
 #include "../common/src/topo/topoinfo_detect.h"
+#include "hcom_group_rank_desc.h"
 namespace hccl {
     class HcclCommBase;
 }
@@ -52,6 +53,8 @@ using HcomInfo = struct HcomInfoTag {
     hccl::HcclCommParams params;
     std::unordered_map<std::string, HcclGroupParams> hcomGroupMap;  // 每个group的信息(kname为服务器的server_id,按照服务器区分)
     std::mutex groupParamsLock;
+    // hcomGroupMap的只读快照, 在groupParamsLock下整体替换发布, 读侧通过std::atomic_load无锁获取
+    std::shared_ptr<const HcomGroupRankSnapshot> groupRankSnapshot;
     hccl::RankTable_t rankTable;
     s32 devId;
     bool cloudFlag;  // cloudFlag为0即实验室场景,cloudFlag为1则为云场景
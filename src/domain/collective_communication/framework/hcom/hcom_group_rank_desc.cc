@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "hcom_group_rank_desc.h"
+#include <atomic>
+#include <cstring>
+#include "log.h"
+
+namespace {
+constexpr u32 GROUP_RANK_SPARSE_RATIO = 8; // world规模超过group规模8倍时改用稀疏映射, 避免稠密数组占用过大
+
+// 线程级group句柄缓存: 同一线程反复查询同一group时跳过名字校验和哈希查找
+struct HcomGroupHandleCache {
+    std::shared_ptr<const HcomGroupRankSnapshot> snapshot;
+    std::string group;
+    std::shared_ptr<const HcomGroupRankDesc> desc;
+};
+thread_local HcomGroupHandleCache g_groupHandleCache;
+}
+
+HcclResult HcomBuildGroupRankDesc(u32 groupRank, u32 serverNum, const std::vector<u32> &groupRanks,
+    u32 worldRankSize, std::shared_ptr<const HcomGroupRankDesc> &desc)
+{
+    std::shared_ptr<HcomGroupRankDesc> newDesc(new (std::nothrow) HcomGroupRankDesc());
+    CHK_SMART_PTR_NULL(newDesc);
+    newDesc->groupRank = groupRank;
+    newDesc->serverNum = serverNum;
+    newDesc->totalRanks = groupRanks.size();
+    newDesc->groupToWorld = groupRanks;
+    bool useSparse = (static_cast<u64>(groupRanks.size()) * GROUP_RANK_SPARSE_RATIO < worldRankSize);
+    if (useSparse) {
+        newDesc->sparseWorldToGroup.reserve(groupRanks.size());
+    } else {
+        newDesc->worldToGroup.assign(worldRankSize, INVALID_VALUE_RANKID);
+    }
+    for (u32 rank = 0; rank < groupRanks.size(); rank++) {
+        u32 worldRank = groupRanks[rank];
+        CHK_PRT_RET(worldRank >= worldRankSize, HCCL_ERROR("[Build][GroupRankDesc]errNo[0x%016llx] worldRank[%u] " \
+            "is out of range[0-%u)", HCOM_ERROR_CODE(HCCL_E_PARA), worldRank, worldRankSize), HCCL_E_PARA);
+        if (useSparse) {
+            newDesc->sparseWorldToGroup.emplace(worldRank, rank);
+        } else {
+            newDesc->worldToGroup[worldRank] = rank;
+        }
+    }
+    desc = newDesc;
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcomGetGroupRankByWorldRank(const HcomGroupRankDesc &desc, u32 worldRank, u32 &groupRank)
+{
+    u32 rank = INVALID_VALUE_RANKID;
+    if (!desc.worldToGroup.empty()) {
+        rank = (worldRank < desc.worldToGroup.size()) ? desc.worldToGroup[worldRank] : INVALID_VALUE_RANKID;
+    } else {
+        auto iter = desc.sparseWorldToGroup.find(worldRank);
+        rank = (iter != desc.sparseWorldToGroup.end()) ? iter->second : INVALID_VALUE_RANKID;
+    }
+    if (rank == INVALID_VALUE_RANKID) {
+        return HCCL_E_PARA;
+    }
+    groupRank = rank;
+    return HCCL_SUCCESS;
+}
+
+void HcomPublishGroupRankDesc(std::shared_ptr<const HcomGroupRankSnapshot> &snapshot, const std::string &group,
+    const std::shared_ptr<const HcomGroupRankDesc> &desc)
+{
+    std::shared_ptr<const HcomGroupRankSnapshot> oldSnapshot = std::atomic_load(&snapshot);
+    std::shared_ptr<HcomGroupRankSnapshot> newSnapshot = (oldSnapshot == nullptr) ?
+        std::make_shared<HcomGroupRankSnapshot>() : std::make_shared<HcomGroupRankSnapshot>(*oldSnapshot);
+    if (desc == nullptr) {
+        newSnapshot->erase(group);
+    } else {
+        (*newSnapshot)[group] = desc;
+    }
+    std::atomic_store(&snapshot, std::shared_ptr<const HcomGroupRankSnapshot>(newSnapshot));
+}
+
+void HcomClearGroupRankSnapshot(std::shared_ptr<const HcomGroupRankSnapshot> &snapshot)
+{
+    std::atomic_store(&snapshot, std::shared_ptr<const HcomGroupRankSnapshot>());
+}
+
+// 命中线程缓存时只做一次原子读和一次字符串比较
+std::shared_ptr<const HcomGroupRankDesc> HcomLookupGroupRankDesc(
+    const std::shared_ptr<const HcomGroupRankSnapshot> &snapshot, const char *group, bool cacheOnly)
+{
+    std::shared_ptr<const HcomGroupRankSnapshot> curSnapshot = std::atomic_load(&snapshot);
+    if (curSnapshot == nullptr || group == nullptr) {
+        return nullptr;
+    }
+    HcomGroupHandleCache &cache = g_groupHandleCache;
+    // 比较长度以缓存名字为界, 避免对未校验的入参越界读
+    if (cache.snapshot == curSnapshot && strncmp(cache.group.c_str(), group, cache.group.size() + 1) == 0) {
+        return cache.desc;
+    }
+    if (cacheOnly) {
+        return nullptr;
+    }
+    auto iter = curSnapshot->find(group);
+    if (iter == curSnapshot->end()) {
+        return nullptr;
+    }
+    cache.snapshot = curSnapshot;
+    cache.group = group;
+    cache.desc = iter->second;
+    return iter->second;
+}
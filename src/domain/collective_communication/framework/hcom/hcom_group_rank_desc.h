@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCOM_GROUP_RANK_DESC_H
+#define HCOM_GROUP_RANK_DESC_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "hccl/base.h"
+
+/* * group创建后rank映射不再变化, 单独抽出只读描述供高频查询无锁访问 */
+using HcomGroupRankDesc = struct TagHcomGroupRankDescInfo {
+    u32 groupRank;
+    u32 serverNum;
+    u32 totalRanks;
+    std::vector<u32> groupToWorld;                 // 下标为groupRank, 值为worldRank
+    std::vector<u32> worldToGroup;                 // 稠密映射, 下标为worldRank, 不在group内为INVALID_VALUE_RANKID
+    std::unordered_map<u32, u32> sparseWorldToGroup; // group远小于world时使用的稀疏映射
+};
+using HcomGroupRankSnapshot = std::unordered_map<std::string, std::shared_ptr<const HcomGroupRankDesc>>;
+
+HcclResult HcomBuildGroupRankDesc(u32 groupRank, u32 serverNum, const std::vector<u32> &groupRanks,
+    u32 worldRankSize, std::shared_ptr<const HcomGroupRankDesc> &desc);
+// worldRank不在group内时返回HCCL_E_PARA
+HcclResult HcomGetGroupRankByWorldRank(const HcomGroupRankDesc &desc, u32 worldRank, u32 &groupRank);
+
+// 需在写锁保护下调用: 复制当前快照后增删一个group再整体发布, desc为空表示删除
+void HcomPublishGroupRankDesc(std::shared_ptr<const HcomGroupRankSnapshot> &snapshot, const std::string &group,
+    const std::shared_ptr<const HcomGroupRankDesc> &desc);
+void HcomClearGroupRankSnapshot(std::shared_ptr<const HcomGroupRankSnapshot> &snapshot);
+// 无锁查询group的rank映射描述; cacheOnly为true时只查线程缓存, 用于判断group名字是否已注册
+std::shared_ptr<const HcomGroupRankDesc> HcomLookupGroupRankDesc(
+    const std::shared_ptr<const HcomGroupRankSnapshot> &snapshot, const char *group, bool cacheOnly = false);
+
+#endif /* HCOM_GROUP_RANK_DESC_H */
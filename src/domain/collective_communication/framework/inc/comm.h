@@ -93,6 +93,7 @@ using HcclCommParams = struct TagHCCLCollectiveParams {
     u32 ranktableCrc;
     HcclCommConnections commConnections;
     HcclSocketPortConfig commPortConfig;
+    std::string socketShareKey;  // 建链共享key, 共享key相同的通信域间可复用同一组socket连接
     TagHCCLCollectiveParams()
         : id{0}, rank(INVALID_VALUE_RANKID), userRank(INVALID_VALUE_RANKID), totalRanks(0xFFFFFFFF),
           logicDevId(-1), deviceType(DevType::DEV_TYPE_COUNT), profilingMode(HcomProfilingMode::PROFILING_CLOSE),
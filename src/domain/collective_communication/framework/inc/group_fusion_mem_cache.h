@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GROUP_FUSION_MEM_CACHE_H
+#define GROUP_FUSION_MEM_CACHE_H
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include "base.h"
+#include "hccl_common.h"
+#include "mem_device_pub.h"
+
+namespace hccl {
+// 单个通信域缓存的融合内存总量上限, 不小于单次融合的数据量上限
+constexpr u64 GROUP_FUSION_MEM_CAPACITY = 64 * 1024 * 1024;
+
+/*
+ * HcclGroupEnd融合小算子使用的device内存, 按流缓存, 同一条流上的复用天然保序。
+ * 所有流缓存的内存总量不超过capacity, 超出时先同步最久未使用的流再释放其内存
+ */
+class GroupFusionMemCache {
+public:
+    using SyncStreamFunc = std::function<HcclResult(rtStream_t)>;
+
+    GroupFusionMemCache(u64 capacity, const SyncStreamFunc &syncStream);
+    ~GroupFusionMemCache() = default;
+
+    HcclResult Get(u64 size, rtStream_t stream, DeviceMem &mem);
+    u64 GetCachedSize();
+    u32 GetStreamNum();
+
+private:
+    struct CacheEntry {
+        rtStream_t stream;
+        DeviceMem mem;
+    };
+
+    // 同步stream后释放其缓存, 旧内存可能仍被该流上已下发的任务使用
+    HcclResult Release(std::list<CacheEntry>::iterator iter);
+
+    u64 capacity_;
+    SyncStreamFunc syncStream_;
+    std::mutex mutex_;
+    std::list<CacheEntry> entries_;     // 按最近使用排序, 队首最新
+    u64 cachedSize_ = 0;
+};
+}  // namespace hccl
+
+#endif /* GROUP_FUSION_MEM_CACHE_H */
@@ -12,12 +12,14 @@
 #define HCCL_COMM_PUB_H
 
 #include <vector>
+#include <functional>
 #include <memory>
 #include <map>
 #include <mutex>
 #include "base.h"
 #include "hccl_common.h"
 #include "mem_device_pub.h"
+#include "group_fusion_mem_cache.h"
 #include "topoinfo_struct.h"
 #include "comm.h"
 #include "topoinfo_struct.h"
@@ -108,6 +110,24 @@ public:
     HcclResult AllReduceOutPlace(const std::string &tag, void *inputPtr, void *outputPtr, u64 count,
         HcclDataType dataType, HcclReduceOp op, rtStream_t stream,
         SyncMode syncMode = SyncMode::DEFAULT_TIMEWAITSYNCMODE);
+    /* *********************************************************************
+     功能描述  : 持久化算子, issueOp为对应的单算子下发接口, 创建时只做解析不下发任务
+     输入参数  : const std::function<HcclResult()> &issueOp
+                 u64 opId
+     输出参数  : u64 &opId
+     返 回 值  : HcclResult
+    ********************************************************************* */
+    HcclResult CreatePersistentOp(const std::function<HcclResult()> &issueOp, u64 &opId);
+    HcclResult StartPersistentOp(u64 opId);
+    HcclResult DestroyPersistentOp(u64 opId);
+    /* *********************************************************************
+     功能描述  : 获取HcclGroupEnd融合小算子使用的device内存, 按流缓存, 缓存总量受GROUP_FUSION_MEM_CAPACITY限制
+     输入参数  : u64 size
+                 rtStream_t stream
+     输出参数  : DeviceMem &mem
+     返 回 值  : HcclResult
+    ********************************************************************* */
+    HcclResult GetGroupFusionMem(u64 size, rtStream_t stream, DeviceMem &mem);
     /* *********************************************************************
      功能描述  : broadcast功能实现
      输入参数  :const char *tag
@@ -351,6 +371,7 @@ private:
     DevType deviceType_;
     DeviceMem barrierInMemory_;
     DeviceMem barrierOutMemory_;
+    GroupFusionMemCache groupFusionMemCache_;
     bool isFirstBarrier_;
     const std::string identifier_;
     bool isHeterogComm_;
@@ -43,10 +43,41 @@ hcclNslbDp &hcclNslbDp::GetInstance()
 
 hcclNslbDp::hcclNslbDp()
 {
+    operTableSender_.reset(new (std::nothrow) NslbDpTableSender(
+        [this](const std::vector<uint8_t> &tlvData) { SendOpAndAdjTlv(tlvData); }));
 }
 
 hcclNslbDp::~hcclNslbDp()
 {
+    // 单例在静态析构阶段释放, 此时不再join线程; 正常流程已在通信域销毁时回收线程
+    if (operTableSender_ != nullptr && operTableSender_->IsRunning()) {
+        HCCL_WARNING("[hcclNslbDp][~hcclNslbDp]oper table sender is not stopped, drop pending tables.");
+        operTableSender_->Abandon();
+        (void)operTableSender_.release();
+    }
+}
+
+// 按rankId对rankList做计数排序, 输出下标顺序与按rankId从小到大逐个匹配的结果一致, rankId越界的条目丢弃
+static void SortRankListByRankId(const RankTable_t &rankTable, std::vector<size_t> &rankOrder)
+{
+    size_t rankListSize = rankTable.rankList.size();
+    std::vector<size_t> bucketStart(rankListSize + 1, 0);
+    for (size_t rankIndex = 0; rankIndex < rankListSize; rankIndex++) {
+        u32 rankId = rankTable.rankList[rankIndex].rankId;
+        if (rankId < rankListSize) {
+            bucketStart[rankId + 1]++;
+        }
+    }
+    for (size_t rankId = 0; rankId < rankListSize; rankId++) {
+        bucketStart[rankId + 1] += bucketStart[rankId];
+    }
+    rankOrder.assign(bucketStart[rankListSize], 0);
+    for (size_t rankIndex = 0; rankIndex < rankListSize; rankIndex++) {
+        u32 rankId = rankTable.rankList[rankIndex].rankId;
+        if (rankId < rankListSize) {
+            rankOrder[bucketStart[rankId]++] = rankIndex;
+        }
+    }
 }
 
 
@@ -299,6 +330,7 @@ void hcclNslbDp::SetGlobalCommRankTable_RootInfo(const RankTable_t &rankTable, c
         }
     }
     hcclNslbDpCommConfig_.push_back(globalCommInfo);
+    hcclNslbDpCommDescSet_.insert(globalCommInfo.commDesc);
     HCCL_INFO("HCCL nslbdp Entry SetGlobalCommRankTable_RootInfo end size = [%zu]", hcclNslbDpCommConfig_.size());
 }
 
@@ -440,6 +472,7 @@ HcclResult hcclNslbDp::SetCommInfo_NoRankTable(const hccl::RankTable_t rankTable
         globalCommInfo.rankInfo.push_back(dpRankInfo);
     }
     hcclNslbDpCommConfig_.push_back(globalCommInfo);
+    hcclNslbDpCommDescSet_.insert(globalCommInfo.commDesc);
 
     return HCCL_SUCCESS;
 }
@@ -477,33 +510,33 @@ HcclResult hcclNslbDp::SetCommInfo_RankTableExit(RankTable_t rankTable)
     u32 size = rankTable.rankList.size();
     HCCL_INFO("HCCL SetCommInfo_RankTableExit size:[%u] success.", size);
 
-    for(size_t ranksize = 0; ranksize < rankTable.rankList.size(); ranksize++) {
-        for(size_t rankIndex = 0; rankIndex < rankTable.rankList.size(); rankIndex++) {
-            u16 podId = 0;
-            if (rankTable.rankList[rankIndex].superPodIdx != INVALID_UINT) {
-                podId = rankTable.rankList[rankIndex].superPodIdx; 
-            }
-            //按照rankid 排序
-            if (ranksize == rankTable.rankList[rankIndex].rankId) {
-                NslbDpRankInfo dpRankInfo;
-                 HcclIpAddress tmpIp = rankTable.rankList[rankIndex].deviceInfo.deviceIp[0];
-                std::string deviceIp = tmpIp.GetReadableAddress();
-                dpRankInfo.deviceIp = ipToUint32(deviceIp);
-                HCCL_INFO("HCCL SetCommInfo_RankTableExit deviceIp:[%s] success.", deviceIp.c_str());
-                std::string serverIp = rankTable.rankList[rankIndex].serverId;
-                dpRankInfo.serverIp = ipToUint32(serverIp);
-                HCCL_INFO("HCCL SetCommInfo_RankTableExit serverIp:[%s] success.", serverIp.c_str());
-                dpRankInfo.podId = podId;
-                dpRankInfo.rev = 0;
-                globalCommInfo.rankInfo.push_back(dpRankInfo);
-            }
+    //按照rankid 排序
+    std::vector<size_t> rankOrder;
+    SortRankListByRankId(rankTable, rankOrder);
+    globalCommInfo.rankInfo.reserve(rankOrder.size());
+    for (size_t rankIndex : rankOrder) {
+        u16 podId = 0;
+        if (rankTable.rankList[rankIndex].superPodIdx != INVALID_UINT) {
+            podId = rankTable.rankList[rankIndex].superPodIdx;
         }
+        NslbDpRankInfo dpRankInfo;
+        HcclIpAddress tmpIp = rankTable.rankList[rankIndex].deviceInfo.deviceIp[0];
+        std::string deviceIp = tmpIp.GetReadableAddress();
+        dpRankInfo.deviceIp = ipToUint32(deviceIp);
+        HCCL_INFO("HCCL SetCommInfo_RankTableExit deviceIp:[%s] success.", deviceIp.c_str());
+        std::string serverIp = rankTable.rankList[rankIndex].serverId;
+        dpRankInfo.serverIp = ipToUint32(serverIp);
+        HCCL_INFO("HCCL SetCommInfo_RankTableExit serverIp:[%s] success.", serverIp.c_str());
+        dpRankInfo.podId = podId;
+        dpRankInfo.rev = 0;
+        globalCommInfo.rankInfo.push_back(dpRankInfo);
     }
     NSLBMD5::calculateRankInfoMd5(globalCommInfo.rankInfo, globalCommInfo.commMd5Sum);
     std::string nslbdpmd5 = NSLBMD5::md5ToString(globalCommInfo.commMd5Sum);
     HCCL_INFO("HCCL NSLBDP-MD5 nslbdpmd5:[%s] success.", nslbdpmd5.c_str());
 
     hcclNslbDpCommConfig_.push_back(globalCommInfo);
+    hcclNslbDpCommDescSet_.insert(globalCommInfo.commDesc);
     HCCL_INFO("hcclNslbDp entry SetCommInfo_RankTableExit end");
 
     return HCCL_SUCCESS;
@@ -535,20 +568,19 @@ HcclResult hcclNslbDp::SetGlobalRank_RankTableExit(const hccl::RankTable_t  rank
     hcclNslbDpGlobalRankVal_.commInitTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
     hcclNslbDpGlobalRankVal_.rankTotalNum = nRanks;
 
-    for (size_t ranksize = 0; ranksize < rankTable.rankList.size(); ranksize++) {
-        for (size_t rankIndex = 0; rankIndex < rankTable.rankList.size(); rankIndex++) {
-            if(ranksize == rankTable.rankList[rankIndex].rankId) {
-                TableFourRankInfo dpGloRankInfo;
-                HcclIpAddress tmpIp = rankTable.rankList[rankIndex].deviceInfo.deviceIp[0];
-                std::string deviceIp = tmpIp.GetReadableAddress();
-                dpGloRankInfo.deviceIp = ipToUint32(deviceIp);
+    std::vector<size_t> rankOrder;
+    SortRankListByRankId(rankTable, rankOrder);
+    hcclNslbDpGlobalRankVal_.rankInfo.reserve(hcclNslbDpGlobalRankVal_.rankInfo.size() + rankOrder.size());
+    for (size_t rankIndex : rankOrder) {
+        TableFourRankInfo dpGloRankInfo;
+        HcclIpAddress tmpIp = rankTable.rankList[rankIndex].deviceInfo.deviceIp[0];
+        std::string deviceIp = tmpIp.GetReadableAddress();
+        dpGloRankInfo.deviceIp = ipToUint32(deviceIp);
 
-                std::string serverIp = rankTable.rankList[rankIndex].serverId;
-                dpGloRankInfo.serverIp = ipToUint32(serverIp);
+        std::string serverIp = rankTable.rankList[rankIndex].serverId;
+        dpGloRankInfo.serverIp = ipToUint32(serverIp);
 
-                hcclNslbDpGlobalRankVal_.rankInfo.push_back(dpGloRankInfo);
-            }
-        }
+        hcclNslbDpGlobalRankVal_.rankInfo.push_back(dpGloRankInfo);
     }
     NSLBMD5::calculateTableFourRankInfoMd5(hcclNslbDpGlobalRankVal_.rankInfo, hcclNslbDpGlobalRankVal_.commMd5Sum);
     std::string nslbdpmd5 = NSLBMD5::md5ToString(hcclNslbDpGlobalRankVal_.commMd5Sum);
@@ -939,15 +971,9 @@ bool hcclNslbDp::CheckSupportOptype(HcclCMDType opType)
 
 bool hcclNslbDp::CheckCommDescExit(NslbDpOperatorInfo &OperatorInfo)
 {
-    HCCL_INFO("CheckCommDescExit hcclNslbDpCommConfig_ size:[%zu].", hcclNslbDpCommConfig_.size());
-    for (const auto& info : hcclNslbDpCommConfig_) {
-        HCCL_INFO("NSLBDP-OPER CheckCommDescExit info.commDesc[%s] .", info.commDesc);
-        HCCL_INFO("NSLBDP-OPER CheckCommDescExit OperatorInfo.commDesc[%s] .", OperatorInfo.commDesc);
-        if (strcmp(OperatorInfo.commDesc, info.commDesc) == 0) {
-            return true;
-        }
-    }
-    return false;
+    HCCL_INFO("CheckCommDescExit hcclNslbDpCommConfig_ size:[%zu], OperatorInfo.commDesc[%s].",
+        hcclNslbDpCommConfig_.size(), OperatorInfo.commDesc);
+    return hcclNslbDpCommDescSet_.find(OperatorInfo.commDesc) != hcclNslbDpCommDescSet_.end();
 }
 
 void hcclNslbDp::fullcommDescInitTime(std::string identifier, NslbDpOperatorInfo &OperatorInfo)
@@ -992,11 +1018,45 @@ bool hcclNslbDp::CheckSameOperatorVal(size_t operSize, NslbDpOperatorInfo &Opera
     return false;
 }
 
+// 表2记录的key: commDesc按COMM_DESC_MAX_LENGTH截断后参与哈希, 与CheckSameOperatorVal的比较口径一致
+u64 hcclNslbDp::CalcOperatorKey(const std::string &identifier, u8 oper, u8 algType, u32 rootRank) const
+{
+    constexpr u64 fnvOffsetBasis = 14695981039346656037ULL;
+    constexpr u64 fnvPrime = 1099511628211ULL;
+    u64 key = fnvOffsetBasis;
+    size_t descLen = std::min(identifier.size(), static_cast<size_t>(COMM_DESC_MAX_LENGTH - 1));
+    for (size_t i = 0; i < descLen; i++) {
+        key = (key ^ static_cast<u8>(identifier[i])) * fnvPrime;
+    }
+    key = (key ^ oper) * fnvPrime;
+    key = (key ^ algType) * fnvPrime;
+    key = (key ^ rootRank) * fnvPrime;
+    return key;
+}
+
+bool hcclNslbDp::FindOperatorVal(u64 operKey, u64 taskId, const std::string &identifier, u8 oper, u8 algType,
+                                 u32 rootRank, size_t &operIndex) const
+{
+    auto iter = hcclNslbDpOperatorIndex_.find(operKey);
+    if (iter == hcclNslbDpOperatorIndex_.end()) {
+        return false;
+    }
+    for (size_t index : iter->second) {
+        const NslbDpOperatorInfo &operVal = hcclNslbDpOperatorVal_[index];
+        if (operVal.taskId == taskId && operVal.rootRank == rootRank && operVal.oper == oper &&
+            operVal.algorithm == algType &&
+            strncmp(operVal.commDesc, identifier.c_str(), COMM_DESC_MAX_LENGTH - 1) == 0) {
+            operIndex = index;
+            return true;
+        }
+    }
+    return false;
+}
+
 // 写算法算子表--表2
 HcclResult hcclNslbDp::GenerateOpAndAdjTable(HcclCMDType opType, u32 rootRank, u32 srcLocalRankId, u8 algType,
-                                             std::string identifier, u64 count, u32 rankSize)
+                                             const std::string &identifier, u64 count, u32 rankSize)
 {
-    HCCL_INFO("NSLB-HCCL count=[%llu], hcclNslbDpOperatorVal_ size:[%zu].", count, hcclNslbDpOperatorVal_.size());
     u64 taskId = GetGlobalCommTaskId();
     if (taskId == 0) {
         return HCCL_SUCCESS;
@@ -1009,9 +1069,29 @@ HcclResult hcclNslbDp::GenerateOpAndAdjTable(HcclCMDType opType, u32 rootRank, u
     u64 trafficNum = count;
     if (CheckSupportOptype(opType) == false) {
         trafficNum = 0;
-        HCCL_INFO("NSLB-HCCL CheckSupportOptype false trafficNum == 0.");
     }
 
+    // 获取operator、algorithm
+    u8 oper = GetNslbOpType(opType);
+    u64 trafficCount = GetNslbDpFirstFourBit(oper, algType);
+    trafficCount = (trafficCount << NSLBDP_TRAFFICCONUT) + trafficNum;
+
+    // 已记录的算子: 哈希命中后仅在流量变大时更新, 其余情况直接返回
+    u64 operKey = CalcOperatorKey(identifier, oper, algType, rootRank);
+    size_t operIndex = 0;
+    if (FindOperatorVal(operKey, taskId, identifier, oper, algType, rootRank, operIndex)) {
+        NslbDpOperatorInfo &operVal = hcclNslbDpOperatorVal_[operIndex];
+        if (operVal.trafficCnt < trafficCount && srcLocalRankId == 0) {
+            operVal.trafficCnt = trafficCount;
+            operVal.sedFlag = 0;
+            EnqueueRankTableOpAndAdj(operIndex, operVal);
+            HCCL_RUN_INFO("NSLBDP-ADJ commDesc[%s] try to update trafficCnt[%llu] success.", operVal.commDesc,
+                trafficCount);
+        }
+        return HCCL_SUCCESS;
+    }
+    HCCL_INFO("NSLB-HCCL count=[%llu], hcclNslbDpOperatorVal_ size:[%zu].", count, hcclNslbDpOperatorVal_.size());
+
     NslbDpOperatorInfo OperatorInfo = {};
     // 获取task id 
     OperatorInfo.taskId = taskId;
@@ -1029,38 +1109,43 @@ HcclResult hcclNslbDp::GenerateOpAndAdjTable(HcclCMDType opType, u32 rootRank, u
         return HCCL_SUCCESS;
     }
 
-    // 获取operator、algorithm
-    OperatorInfo.oper = GetNslbOpType(opType);
+    OperatorInfo.oper = oper;
     OperatorInfo.algorithm = algType;
-    u64 trafficCount = GetNslbDpFirstFourBit(OperatorInfo.oper, OperatorInfo.algorithm);
-    trafficCount = (trafficCount << NSLBDP_TRAFFICCONUT) + trafficNum;
-
-    for (size_t operSize = 0; operSize < hcclNslbDpOperatorVal_.size(); operSize++) {
-        if (CheckSameOperatorVal(operSize, OperatorInfo, rootRank) == true) {
-            if (hcclNslbDpOperatorVal_[operSize].trafficCnt < trafficCount && srcLocalRankId == 0) {
-                hcclNslbDpOperatorVal_[operSize].trafficCnt = trafficCount;
-                hcclNslbDpOperatorVal_[operSize].sedFlag = 0;
-                SendRankTableOpAndAdj(hcclNslbDpOperatorVal_[operSize]);
-                HCCL_RUN_INFO("NSLBDP-ADJ commDesc[%s] try to update trafficCnt[%llu] success.", OperatorInfo.commDesc, trafficCount);
-            }
-            return HCCL_SUCCESS;
-        }
-    }
-
     OperatorInfo.trafficCnt = trafficCount; // 判断变大
     OperatorInfo.rootRank = rootRank;
     HCCL_INFO("NSLBDP-OPER add operInfo:***[%llu]***[%llu]***[%u]***[%u]***[%u] success.",
                    taskId, OperatorInfo.commInitTime, rootRank, OperatorInfo.oper, OperatorInfo.algorithm);
 
     GetNslbDpl4SPortId(rankSize, algType, &OperatorInfo.l4SPortId);
+    operIndex = hcclNslbDpOperatorVal_.size();
+    hcclNslbDpOperatorVal_.push_back(OperatorInfo);
+    hcclNslbDpOperatorIndex_[operKey].push_back(operIndex);
     if (srcLocalRankId == 0) {
-        SendRankTableOpAndAdj(OperatorInfo);
+        EnqueueRankTableOpAndAdj(operIndex, OperatorInfo);
     }
-    hcclNslbDpOperatorVal_.push_back(OperatorInfo);
 
     return HCCL_SUCCESS;
 }
 
+// 表2入队, 由后台线程在合并窗口后统一发送, 避免在算子下发路径上同步等待TLV应答
+HcclResult hcclNslbDp::EnqueueRankTableOpAndAdj(size_t operIndex, NslbDpOperatorInfo &tab_f)
+{
+    if (getHccpInitFlag() == false) {
+        return HCCL_SUCCESS;
+    }
+    if (operTableSender_ == nullptr) {
+        return SendRankTableOpAndAdj(tab_f);
+    }
+    return operTableSender_->Enqueue(operIndex, serializeTLV_TableOpAndAdj(tab_f));
+}
+
+void hcclNslbDp::StopOpAndAdjTableSender()
+{
+    if (operTableSender_ != nullptr) {
+        operTableSender_->Stop();
+    }
+}
+
 /*根将表1 序列化处理*/
 std::vector<uint8_t> hcclNslbDp::serializeTLV_TableFir(NslbDpCommConfigInfo cominfo) 
 {
@@ -1331,7 +1416,12 @@ HcclResult hcclNslbDp::SendRankTableOpAndAdj(NslbDpOperatorInfo &tab_f)
     }
     HCCL_INFO("HCCL ndlbdp entry SendRankTableOpAndAdj.");
     std::vector<uint8_t> tlvData = serializeTLV_TableOpAndAdj(tab_f);
+    SendOpAndAdjTlv(tlvData);
+    return HCCL_SUCCESS;
+}
 
+void hcclNslbDp::SendOpAndAdjTlv(const std::vector<uint8_t> &tlvData)
+{
     u32 datlen = tlvData.size();
     HCCL_INFO("HCCL SendRankTableOpAndAdj tlvData.len:[%u] success.", datlen);
 	
@@ -1343,8 +1433,6 @@ HcclResult hcclNslbDp::SendRankTableOpAndAdj(NslbDpOperatorInfo &tab_f)
     s32 ret = H2DTlvRequest(nslbdp_handle_, reinterpret_cast<tlv_msg*>(&sendMsg), reinterpret_cast<tlv_msg*>(&recvMsg));
 
 	HCCL_INFO("!!!!!!!!!!hccl send Table 2 to hccp. ret(%d)!!!!!!!!!!\n", ret);
-
-    return HCCL_SUCCESS;
 }
 
 
@@ -15,6 +15,8 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "base.h"
 #include "hccl_common.h"
@@ -24,6 +26,7 @@
 #include "comm.h"
 #include "coll_alg_param.h"
 #include "hccl_nslbdp_pub.h"
+#include "hccl_nslbdp_sender.h"
 
 namespace hccl {
 
@@ -170,8 +173,8 @@ public:
     HcclResult SetCommInfo_NoRankTable(const RankTable_t rankTable, std::string identifier);
     HcclResult SetCommInfo_RankTableExit(RankTable_t  rankTable);
     HcclResult SetGlobalRank_RankTableExit(const RankTable_t  rankTable);
-    HcclResult GenerateOpAndAdjTable(HcclCMDType opType, u32 rootRank, u32 srcLocalRankId, 
-                                     u8 algType, std::string identifier, u64 count, u32 rankSize);
+    HcclResult GenerateOpAndAdjTable(HcclCMDType opType, u32 rootRank, u32 srcLocalRankId,
+                                     u8 algType, const std::string &identifier, u64 count, u32 rankSize);
     HcclResult GetAlgAdjacencyTable(HcclCMDType opType, u32 srcLocalRankId, u32 rootRank, u8 algType, std::string identifier, AdjInfo nslbAdjInfo);
     HcclResult GetNslbDpl4SPortId(u32 rankSize, u8 algType, u16 *l4SPortId);
     HcclResult SendCommRankTable(uint32_t rank, NslbDpCommConfigVal globalCommInfo);
@@ -179,6 +182,9 @@ public:
     bool CheckSupportOptype(HcclCMDType opType);
     bool CheckCommDescExit(NslbDpOperatorInfo &OperatorInfo);
     bool CheckSameOperatorVal(size_t operSize, NslbDpOperatorInfo &OperatorInfo, u32 rootRank);
+    u64 CalcOperatorKey(const std::string &identifier, u8 oper, u8 algType, u32 rootRank) const;
+    bool FindOperatorVal(u64 operKey, u64 taskId, const std::string &identifier, u8 oper, u8 algType,
+                         u32 rootRank, size_t &operIndex) const;
     void SetGlobalCommRankTable_RootInfo(const RankTable_t &rankTable, const HcclBasicRankInfo &localRankInfo,
                                          const std::string& identifier, u32 nRanks, u32 rank);
     void GetGlobalRankTable(const RankTable_t *rankTable, u32 nRanks, HcclUs startut);
@@ -194,6 +200,10 @@ public:
     u32 ipToUint32(const std::string& ipAddress);
     HcclResult SendOpAndAdjTable();
     HcclResult SendRankTableOpAndAdj(NslbDpOperatorInfo &tab_f);
+    void SendOpAndAdjTlv(const std::vector<uint8_t> &tlvData);
+    HcclResult EnqueueRankTableOpAndAdj(size_t operIndex, NslbDpOperatorInfo &tab_f);
+    // 通信域销毁时调用, 发送剩余表2记录并回收后台发送线程
+    void StopOpAndAdjTableSender();
     std::vector<uint8_t> serializeTLV_TableOpAndAdj(NslbDpOperatorInfo &cominfo);
     HcclResult SendAlgorithmInfoTable();
     HcclResult SendRankTableAlgorithmInfo(NslbDpAlgorithmTlv &tab_f);
@@ -218,8 +228,12 @@ public:
     NslbDpGlobalCommInfo hcclNslbDpGlobalCommInfo_;
     // 分表1-基础数据. 承载通信与信息
     std::vector<NslbDpCommConfigVal> hcclNslbDpCommConfig_;
+    // 表1中已登记的通信域标识, 用于O(1)判断通信域是否存在
+    std::unordered_set<std::string> hcclNslbDpCommDescSet_;
     // 分表2-基础数据，承载执行的算子算法信息
     std::vector<NslbDpOperatorInfo> hcclNslbDpOperatorVal_;
+    // 表2记录索引: key为(通信域, 算子, 算法, rootRank)的哈希, value为hcclNslbDpOperatorVal_下标, 哈希冲突时挂多个
+    std::unordered_map<u64, std::vector<size_t>> hcclNslbDpOperatorIndex_;
     // 分表3-基础数据，承载执行的算子算法的邻接信息
     std::vector<NslbDpAlgorithmInfo> hcclNslbDpAlgorithmInfo_;
     // 分表4-基础数据，在非ranktble场景下创建通信与场景承载全局通信域信息
@@ -231,6 +245,9 @@ public:
 private:
     hcclNslbDp();
     ~hcclNslbDp();
+
+    // 表2由后台线程批量发送, 同一记录在发送前多次更新只发送最新值
+    std::unique_ptr<NslbDpTableSender> operTableSender_;
 };
 
 }  // namespace hccl
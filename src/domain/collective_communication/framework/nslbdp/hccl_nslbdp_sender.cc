@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "hccl_nslbdp_sender.h"
+#include "log.h"
+#include "sal_pub.h"
+
+namespace hccl {
+
+NslbDpTableSender::NslbDpTableSender(NslbDpTlvSink sink, u32 windowMs, u32 idleExitMs)
+    : sink_(std::move(sink)), windowMs_(windowMs), idleExitMs_(idleExitMs)
+{
+}
+
+NslbDpTableSender::~NslbDpTableSender()
+{
+    Stop();
+}
+
+HcclResult NslbDpTableSender::Enqueue(size_t recordIndex, std::vector<uint8_t> tlvData)
+{
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    pendingTables_[recordIndex] = std::move(tlvData);
+    // Stop进行中时只入队, 由Stop在旧线程退出后补发
+    if (sendThread_ == nullptr && !stopping_) {
+        sendThread_.reset(new (std::nothrow) std::thread(&NslbDpTableSender::SendThread, this));
+        if (sendThread_ == nullptr) {
+            // 线程拉起失败时退化为同步发送
+            std::map<size_t, std::vector<uint8_t>> sendTables;
+            sendTables.swap(pendingTables_);
+            lock.unlock();
+            HCCL_WARNING("[NslbDpTableSender][Enqueue]create send thread failed, send synchronously.");
+            SendTables(sendTables);
+            return HCCL_SUCCESS;
+        }
+    }
+    lock.unlock();
+    queueCond_.notify_one();
+    return HCCL_SUCCESS;
+}
+
+void NslbDpTableSender::SendThread()
+{
+    //给当前线程添加名字
+    SetThreadName("Hccl_NslbDpSend");
+
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    while (true) {
+        if (!queueCond_.wait_for(lock, std::chrono::milliseconds(idleExitMs_),
+            [this] { return stopping_ || !pendingTables_.empty(); })) {
+            // 空闲超时: 线程自行分离退出, 解锁后不再访问成员
+            sendThread_->detach();
+            sendThread_ = nullptr;
+            return;
+        }
+        if (!stopping_) {
+            // 等待合并窗口, 窗口内同一记录的多次更新只保留最新值
+            queueCond_.wait_for(lock, std::chrono::milliseconds(windowMs_), [this] { return stopping_; });
+        }
+        std::map<size_t, std::vector<uint8_t>> sendTables;
+        sendTables.swap(pendingTables_);
+        bool stopping = stopping_;
+        lock.unlock();
+        SendTables(sendTables);
+        if (stopping) {
+            return;
+        }
+        lock.lock();
+    }
+}
+
+void NslbDpTableSender::SendTables(std::map<size_t, std::vector<uint8_t>> &sendTables)
+{
+    for (auto &table : sendTables) {
+        sink_(table.second);
+    }
+    if (!sendTables.empty()) {
+        HCCL_INFO("[NslbDpTableSender][SendTables]send [%zu] oper tables.", sendTables.size());
+    }
+}
+
+void NslbDpTableSender::Stop()
+{
+    std::lock_guard<std::mutex> stopLock(stopMutex_);
+    std::unique_ptr<std::thread> sendThread;
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    stopping_ = true;
+    sendThread.swap(sendThread_);
+    lock.unlock();
+    queueCond_.notify_all();
+    if (sendThread != nullptr && sendThread->joinable()) {
+        sendThread->join();
+    }
+
+    // 旧线程退出后入队的记录在此补发, 补发期间仍保持stopping_, 避免新线程先于补发送出同一记录的新值
+    lock.lock();
+    while (!pendingTables_.empty()) {
+        std::map<size_t, std::vector<uint8_t>> sendTables;
+        sendTables.swap(pendingTables_);
+        lock.unlock();
+        SendTables(sendTables);
+        lock.lock();
+    }
+    stopping_ = false;
+}
+
+void NslbDpTableSender::Abandon()
+{
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    stopping_ = true;
+    pendingTables_.clear();
+    if (sendThread_ != nullptr && sendThread_->joinable()) {
+        sendThread_->detach();
+    }
+    sendThread_ = nullptr;
+    lock.unlock();
+    queueCond_.notify_all();
+}
+
+bool NslbDpTableSender::IsRunning()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    return sendThread_ != nullptr;
+}
+
+}  // namespace hccl
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_NSLBDP_SENDER_H
+#define HCCL_NSLBDP_SENDER_H
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "base.h"
+
+namespace hccl {
+
+constexpr u32 NSLBDP_SEND_BATCH_WINDOW_MS = 10; // 表2后台发送的合并窗口
+constexpr u32 NSLBDP_SEND_IDLE_EXIT_MS = 1000; // 发送线程空闲超过该时间后退出, 有新记录时再拉起
+
+using NslbDpTlvSink = std::function<void(const std::vector<uint8_t> &tlvData)>;
+
+/* * 表2 TLV后台合并发送: 同一记录在合并窗口内多次更新只发送最新值, 线程按需拉起、空闲退出,
+ *   由通信域销毁路径调用Stop发送剩余记录并回收线程, 之后再入队会重新拉起 */
+class NslbDpTableSender {
+public:
+    explicit NslbDpTableSender(NslbDpTlvSink sink, u32 windowMs = NSLBDP_SEND_BATCH_WINDOW_MS,
+        u32 idleExitMs = NSLBDP_SEND_IDLE_EXIT_MS);
+    ~NslbDpTableSender();
+
+    HcclResult Enqueue(size_t recordIndex, std::vector<uint8_t> tlvData);
+    // 发送全部未发送的记录并等待线程退出
+    void Stop();
+    // 进程退出时未经Stop的兜底: 丢弃未发送记录并分离线程, 调用后对象不可再释放
+    void Abandon();
+    bool IsRunning();
+
+private:
+    void SendThread();
+    void SendTables(std::map<size_t, std::vector<uint8_t>> &sendTables);
+
+    NslbDpTlvSink sink_;
+    u32 windowMs_;
+    u32 idleExitMs_;
+    std::mutex stopMutex_; // 串行化Stop, 保证同一时刻只有一个线程在退出
+    std::mutex queueMutex_;
+    std::condition_variable queueCond_;
+    std::map<size_t, std::vector<uint8_t>> pendingTables_;
+    std::unique_ptr<std::thread> sendThread_;
+    bool stopping_ = false;
+};
+
+}  // namespace hccl
+
+#endif  // HCCL_NSLBDP_SENDER_H
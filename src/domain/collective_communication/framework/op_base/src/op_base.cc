@@ -10,8 +10,11 @@
 
 #include "op_base.h"
 #include <algorithm>
+#include <functional>
 #include <future>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <hccl/hccl_types.h>
 
@@ -39,6 +42,9 @@
 #include "external/runtime/rt_error_codes.h"
 #include "mmpa_api.h"
 #include "../nslbdp/hccl_nslbdp.h"
+#include "op_base_group.h"
+#include "op_base_persistent.h"
+#include "op_base_split_plan.h"
 
 #define DOUBLE_SIZE 2
 
@@ -640,23 +646,25 @@ HcclResult HcclCommInitClusterInfoConfig(const char *clusterInfo, uint32_t rank,
     return HCCL_SUCCESS;
 }
 
-HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t rankNum, uint32_t *rankIds,
-    uint32_t subCommRankId, CommConfig &commConfig, HcclComm *subComm)
+// 批量切分时多个线程并发初始化子通信域, 进程级单例(版本校验、NSLB)的记录与上报需串行
+std::mutex g_subCommInitMutex;
+
+// 基于已生成的子rank table初始化子通信域, ranktableCrc由调用者基于rank table摘要算好, 不再经json字符串中转
+HcclResult HcclInitSubCommByRankTable(hccl::RankTable_t &subRankTable, hccl::HcclCommParams &subParams,
+    u32 rankTableCrc, CommConfig &commConfig, HcclComm *subComm)
 {
     HcclResult ret = HCCL_SUCCESS;
-    HcclCommParams globalParams{};
-    RankTable_t globalRankTable{};
-    CHK_RET(globalComm->GetCommParams(globalParams));
-    CHK_RET(globalComm->GetCommRankTable(globalRankTable));
-
     HcclOpInfoCtx& opBaseHcom = GetHcclOpInfoCtx();
 
     const std::string commIdentifier = commConfig.GetConfigCommName();
-    auto iter = opBaseHcom.opGroup2CommMap.find(commIdentifier);
-    CHK_PRT_RET(iter != opBaseHcom.opGroup2CommMap.end(),
-        HCCL_ERROR("[%s]errNo[0x%016llx]The comm name[%s] already exists in Group2Comm map.",
-            __func__, HCCL_ERROR_CODE(HCCL_E_PARA), commIdentifier.c_str()),
-        HCCL_E_PARA);
+    {
+        std::unique_lock<std::mutex> lock(opBaseHcom.opGroupMapMutex);
+        auto iter = opBaseHcom.opGroup2CommMap.find(commIdentifier);
+        CHK_PRT_RET(iter != opBaseHcom.opGroup2CommMap.end(),
+            HCCL_ERROR("[%s]errNo[0x%016llx]The comm name[%s] already exists in Group2Comm map.",
+                __func__, HCCL_ERROR_CODE(HCCL_E_PARA), commIdentifier.c_str()),
+            HCCL_E_PARA);
+    }
 
     std::shared_ptr<hccl::hcclComm> pComm;
     pComm.reset(new (std::nothrow) hccl::hcclComm(
@@ -664,20 +672,13 @@ HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t ran
     CHK_PTR_NULL(pComm);
 
     bool errorFlag = false;
-    hccl::HcclCommParams subParams{};
-    hccl::RankTable_t subRankTable{};
+    u32 subCommRankId = subParams.rank;
     do {
-        RankConsistentcyChecker::GetInstance().SetCheckCannVersionSwitch(true); // 打开CANN软件版本校验开关
-
-        std::unique_ptr<TopoinfoRanktablePartition> pTopoPartition;
-        pTopoPartition.reset(new (std::nothrow) hccl::TopoinfoRanktablePartition(globalParams, globalRankTable));
-        CHK_RET(pTopoPartition->GenerateSubRankTable(rankNum, rankIds, subRankTable));
-        CHK_RET(pTopoPartition->GenerateSubParams(subRankTable, subCommRankId, subParams));
-
-        std::string rankTableM = "";
-        CHK_RET(pTopoPartition->GetRankTableStr(subRankTable, rankTableM));
-
-        ret = InitOtherInfo(subParams, rankTableM.c_str());
+        {
+            std::unique_lock<std::mutex> initLock(g_subCommInitMutex);
+            RankConsistentcyChecker::GetInstance().SetCheckCannVersionSwitch(true); // 打开CANN软件版本校验开关
+            ret = InitOtherInfoByCrc(subParams, rankTableCrc);
+        }
         CHK_PRT_BREAK(ret != HCCL_SUCCESS, HCCL_ERROR("[%s]errNo[0x%016llx] init other Info.",
             __func__, HCCL_ERROR_CODE(ret)), errorFlag = true);
         ret = pComm->init(subParams, subRankTable);
@@ -696,8 +697,11 @@ HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t ran
         CHK_PRT_BREAK(ret != HCCL_SUCCESS, HCCL_ERROR("[%s]errNo[0x%016llx] set TC and SL error",
             __func__, HCCL_ERROR_CODE(ret)), errorFlag = true);
         HCCL_RUN_INFO("[NSLBDP]GetConfigJobID = %llu,GetConfigWorldRankID = %u.", commConfig.GetConfigJobID(), commConfig.GetConfigWorldRankID());
-        hcclNslbDp::GetInstance().SetGlobalCommTaskId(commConfig.GetConfigJobID());
-        hcclNslbDp::GetInstance().SetGlobalCommNodeId(commConfig.GetConfigWorldRankID());
+        {
+            std::unique_lock<std::mutex> initLock(g_subCommInitMutex);
+            hcclNslbDp::GetInstance().SetGlobalCommTaskId(commConfig.GetConfigJobID());
+            hcclNslbDp::GetInstance().SetGlobalCommNodeId(commConfig.GetConfigWorldRankID());
+        }
     
         /* 设置AIV模式 */
         ret = pComm->SetAivModeConfig(commConfig.GetConfigAivMode());
@@ -730,18 +734,21 @@ HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t ran
     if (errorFlag) {
         HCCL_ERROR("[%s]Create sub communication failed, return[0x%016llx], " \
             "rankNum[%u], subCommRankId[%u], sub commm identifier[%s], server[%s], logicDevId[%d]",
-            __func__, HCCL_ERROR_CODE(ret), rankNum, subCommRankId, commIdentifier.c_str(),
+            __func__, HCCL_ERROR_CODE(ret), subRankTable.rankNum, subCommRankId, commIdentifier.c_str(),
             GetLocalServerId(subParams.serverId).c_str(), subParams.logicDevId);
         (void)HcclCommDestroy(pComm.get());
         return ret;
     }
     std::string identifier = pComm->GetIdentifier();
 
-    /* NSLB 填充 表1 */
-    CHK_RET(hcclNslbDp::GetInstance().SetCommInfo_NoRankTable(subRankTable, identifier));
+    {
+        std::unique_lock<std::mutex> initLock(g_subCommInitMutex);
+        /* NSLB 填充 表1 */
+        CHK_RET(hcclNslbDp::GetInstance().SetCommInfo_NoRankTable(subRankTable, identifier));
 
-    /* NSLB 发送 */
-    hcclNslbDp::GetInstance().SendTableFir(subCommRankId);
+        /* NSLB 发送 */
+        hcclNslbDp::GetInstance().SendTableFir(subCommRankId);
+    }
 
     HCCL_RUN_INFO("%s success, sub commm identifier[%s], rankNum[%u], rank[%u], server[%s], device[%d].",
         __func__, commIdentifier.c_str(), subRankTable.rankNum, subCommRankId,
@@ -749,6 +756,36 @@ HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t ran
     return HCCL_SUCCESS;
 }
 
+HcclResult HcclCreateSubCommByPartition(hccl::TopoinfoRanktablePartition &topoPartition, uint32_t rankNum,
+    uint32_t *rankIds, uint32_t subCommRankId, CommConfig &commConfig, HcclComm *subComm)
+{
+    hccl::HcclCommParams subParams{};
+    hccl::RankTable_t subRankTable{};
+    u32 rankTableCrc = 0;
+    CHK_RET(topoPartition.GenerateSubRankTable(rankNum, rankIds, subRankTable));
+    CHK_RET(topoPartition.GenerateSubParams(subRankTable, subCommRankId, subParams));
+    std::string rankTableDigest;
+    CHK_RET(topoPartition.GetRankTableDigest(subRankTable, rankTableDigest));
+    CHK_RET(RankConsistentcyChecker::GetInstance().CalcStringCrc(rankTableDigest.c_str(), rankTableCrc));
+
+    return HcclInitSubCommByRankTable(subRankTable, subParams, rankTableCrc, commConfig, subComm);
+}
+
+HcclResult HcclCreateSubCommConfigInner(hccl::hcclComm *globalComm, uint32_t rankNum, uint32_t *rankIds,
+    uint32_t subCommRankId, CommConfig &commConfig, HcclComm *subComm)
+{
+    HcclCommParams globalParams{};
+    RankTable_t globalRankTable{};
+    CHK_RET(globalComm->GetCommParams(globalParams));
+    CHK_RET(globalComm->GetCommRankTable(globalRankTable));
+
+    std::unique_ptr<TopoinfoRanktablePartition> pTopoPartition;
+    pTopoPartition.reset(new (std::nothrow) hccl::TopoinfoRanktablePartition(globalParams, globalRankTable));
+    CHK_SMART_PTR_NULL(pTopoPartition);
+
+    return HcclCreateSubCommByPartition(*pTopoPartition, rankNum, rankIds, subCommRankId, commConfig, subComm);
+}
+
 HcclResult SubCommIsOneSidedComm(HcclComm *comm)
 {
     if (IsOneSidedComm(*comm)) {
@@ -823,6 +860,137 @@ HcclResult HcclCreateSubCommConfig(HcclComm *comm, uint32_t rankNum, uint32_t *r
     return HCCL_SUCCESS;
 }
 
+HcclResult HcclCommSplitBatchConfig(HcclComm *comm, uint32_t splitNum, const uint32_t *colors,
+    const uint32_t *keys, const uint64_t *splitIds, HcclCommConfig *config, HcclComm *subComms)
+{
+    HcclUs startut = TIME_NOW();
+    s32 deviceLogicId = 0;
+    CHK_RET(hrtGetDeviceRefresh(&deviceLogicId));
+    HCCL_RUN_INFO("Entry-%s: splitNum[%u], deviceLogicId[%d]", __func__, splitNum, deviceLogicId);
+    CHK_PRT_RET((splitNum == 0), HCCL_ERROR("[%s]errNo[0x%016llx] Split num cannot be zero.",
+        __func__, HCCL_ERROR_CODE(HCCL_E_PARA)), HCCL_E_PARA);
+    CHK_PTR_NULL(colors);
+    CHK_PTR_NULL(splitIds);
+    CHK_PTR_NULL(subComms);
+    RPT_INPUT_ERR(config == nullptr, "EI0003", std::vector<std::string>({"ccl_op", "parameter", "value", "tips"}),\
+        std::vector<std::string>({"HcclCommSplitBatchConfig", "config", "nullptr", "please check comm"}));
+    CHK_SMART_PTR_NULL(config);
+    CHK_SMART_PTR_NULL(comm);
+    CHK_RET(SubCommIsOneSidedComm(comm));
+
+    HcclResult ret = InitExternalInput();
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[%s]errNo[0x%016llx] init external input error", __func__, HCCL_ERROR_CODE(ret)), HCCL_E_PARA);
+    ret = InitEnvConfig();
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[%s]errNo[0x%016llx] init environment config error.", __func__, HCCL_ERROR_CODE(ret)), HCCL_E_PARA);
+
+    // 子通信域名称由全局通信域名称、splitId与color生成, 不接受用户指定, 否则同一批次的子通信域会重名
+    CommConfig userConfig("");
+    ret = userConfig.Load(config);
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[%s]errNo[0x%016llx] load comm config failed.", __func__, HCCL_ERROR_CODE(ret)), HCCL_E_PARA);
+    CHK_PRT_RET(!userConfig.GetConfigCommName().empty(), HCCL_ERROR("[%s]errNo[0x%016llx] commName[%s] in config " \
+        "should be empty, sub comm names are generated by splitId and color.", __func__,
+        HCCL_ERROR_CODE(HCCL_E_PARA), userConfig.GetConfigCommName().c_str()), HCCL_E_PARA);
+    std::set<u64> splitIdSet;
+    for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+        CHK_PRT_RET(!splitIdSet.insert(splitIds[splitIdx]).second, HCCL_ERROR("[%s]errNo[0x%016llx] splitId[%llu] " \
+            "of split[%u] is duplicated.", __func__, HCCL_ERROR_CODE(HCCL_E_PARA), splitIds[splitIdx], splitIdx),
+            HCCL_E_PARA);
+    }
+
+    hccl::hcclComm *globalComm = static_cast<hccl::hcclComm*>(*comm);
+    CHK_PTR_NULL(globalComm);
+
+    // 全局通信域参数与rank table只获取一次, 所有切分共享同一个partition及其rank索引
+    HcclCommParams globalParams{};
+    RankTable_t globalRankTable{};
+    CHK_RET(globalComm->GetCommParams(globalParams));
+    CHK_RET(globalComm->GetCommRankTable(globalRankTable));
+    std::unique_ptr<TopoinfoRanktablePartition> pTopoPartition;
+    pTopoPartition.reset(new (std::nothrow) hccl::TopoinfoRanktablePartition(globalParams, globalRankTable));
+    CHK_SMART_PTR_NULL(pTopoPartition);
+
+    // colors/keys按全局rankId取值, 由BuildSplitBatchPlan校验rank table中的rankId与之一一对应
+    std::vector<u32> globalRankIds;
+    globalRankIds.reserve(globalRankTable.rankList.size());
+    for (const RankInfo_t &rankInfo : globalRankTable.rankList) {
+        globalRankIds.push_back(rankInfo.rankId);
+    }
+    std::vector<SplitBatchPlan> plans;
+    CHK_RET(BuildSplitBatchPlan(globalRankIds, globalParams.rank, splitNum, colors, keys, plans));
+
+    for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+        subComms[splitIdx] = nullptr;
+    }
+
+    // 子rank table与参数在本线程内生成(partition的rank索引只建立一次), 耗时的通信域初始化再并发执行
+    struct SubCommInitTask {
+        RankTable_t subRankTable;
+        HcclCommParams subParams;
+        u32 rankTableCrc = 0;
+        std::unique_ptr<CommConfig> commConfig;
+    };
+    std::vector<SubCommInitTask> tasks(plans.size());
+    for (u32 i = 0; i < plans.size(); i++) {
+        const SplitBatchPlan &plan = plans[i];
+        SubCommInitTask &task = tasks[i];
+        CHK_RET(pTopoPartition->GenerateSubRankTable(plan.rankIds.size(), plan.rankIds.data(), task.subRankTable));
+        CHK_RET(pTopoPartition->GenerateSubParams(task.subRankTable, plan.subCommRankId, task.subParams));
+        std::string rankTableDigest;
+        CHK_RET(pTopoPartition->GetRankTableDigest(task.subRankTable, rankTableDigest));
+        CHK_RET(RankConsistentcyChecker::GetInstance().CalcStringCrc(rankTableDigest.c_str(), task.rankTableCrc));
+
+        std::string identifier = globalComm->GetIdentifier() + "_sub_" + to_string(splitIds[plan.splitIdx]) + "_" +
+            to_string(plan.color);
+        task.commConfig.reset(new (std::nothrow) CommConfig(identifier));
+        CHK_SMART_PTR_NULL(task.commConfig);
+        ret = task.commConfig->Load(config);
+        CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[%s]errNo[0x%016llx] load comm config failed, split[%u].",
+            __func__, HCCL_ERROR_CODE(ret), plan.splitIdx), HCCL_E_PARA);
+    }
+
+    // 各子通信域相互独立, 工作线程需先绑定当前device
+    ret = RunSplitBatchTasks(tasks.size(), SPLIT_BATCH_MAX_THREAD_NUM, [&](u32 i) -> HcclResult {
+        CHK_PRT_RET(hrtSetDevice(deviceLogicId) != HCCL_SUCCESS,
+            HCCL_ERROR("[HcclCommSplitBatchConfig] set fail deviceLogicId[%d]", deviceLogicId), HCCL_E_INTERNAL);
+        const SplitBatchPlan &plan = plans[i];
+        SubCommInitTask &task = tasks[i];
+        HcclResult initRet = HcclInitSubCommByRankTable(task.subRankTable, task.subParams, task.rankTableCrc,
+            *task.commConfig, &subComms[plan.splitIdx]);
+        if (initRet != HCCL_SUCCESS) {
+            HCCL_ERROR("[HcclCommSplitBatchConfig]errNo[0x%016llx] create sub comm failed, split[%u], color[%u].",
+                HCCL_ERROR_CODE(initRet), plan.splitIdx, plan.color);
+            subComms[plan.splitIdx] = nullptr;
+        }
+        CHK_PRT_RET(hrtResetDevice(deviceLogicId) != HCCL_SUCCESS,
+            HCCL_ERROR("[HcclCommSplitBatchConfig] reset fail deviceLogicId[%d]", deviceLogicId), HCCL_E_INTERNAL);
+        return initRet;
+    });
+
+    if (ret != HCCL_SUCCESS) {
+        // 本批次已创建的子通信域一并销毁, 出参恢复为空
+        for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+            if (subComms[splitIdx] != nullptr) {
+                (void)HcclCommDestroy(subComms[splitIdx]);
+                subComms[splitIdx] = nullptr;
+            }
+        }
+        return ret;
+    }
+
+    // 记录groupName和UDI的映射
+    for (const SubCommInitTask &task : tasks) {
+        HCCL_PROFILER_ADD_GROUP_UDI(task.commConfig->GetConfigCommName(), task.commConfig->GetConfigUdi());
+    }
+
+    /* 关键状态记录 */
+    HCCL_RUN_INFO("[HCCL_TRACE]%s success, take time [%lld]us, splitNum[%u], joined[%zu], deviceLogicId[%d]",
+        __func__, DURATION_US(TIME_NOW() - startut), splitNum, plans.size(), deviceLogicId);
+    return HCCL_SUCCESS;
+}
+
 HcclResult HcclGetRootInfo(HcclRootInfo *rootInfo)
 {
     HcclUs startut = TIME_NOW();
@@ -1441,6 +1609,11 @@ void HcclResetIfProfile()
 HcclResult HcclAllReduce(void *sendBuf, void *recvBuf, uint64_t count, HcclDataType dataType,
                          HcclReduceOp op, HcclComm comm, aclrtStream stream)
 {
+    if (UNLIKELY(hccl::IsGroupRecording())) {
+        // HcclGroupStart/HcclGroupEnd之间只记录, 在HcclGroupEnd时统一下发
+        return hccl::RecordGroupOp({HcclCMDType::HCCL_CMD_ALLREDUCE, sendBuf, recvBuf, count, dataType,
+            op, 0, comm, stream});
+    }
     HcclUs startut = TIME_NOW();
 
     bool isCapture;
@@ -1537,6 +1710,7 @@ HcclResult HcclAllReduce(void *sendBuf, void *recvBuf, uint64_t count, HcclDataT
 
 HcclResult HcclBarrier(HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclBarrier"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -1630,6 +1804,11 @@ HcclResult HcclBarrier(HcclComm comm, aclrtStream stream)
 HcclResult HcclBroadcast(void *buf, uint64_t count, HcclDataType dataType, uint32_t root, HcclComm comm,
                          aclrtStream stream)
 {
+    if (UNLIKELY(hccl::IsGroupRecording())) {
+        // HcclGroupStart/HcclGroupEnd之间只记录, 在HcclGroupEnd时统一下发
+        return hccl::RecordGroupOp({HcclCMDType::HCCL_CMD_BROADCAST, buf, buf, count, dataType,
+            HCCL_REDUCE_RESERVED, root, comm, stream});
+    }
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -1733,6 +1912,11 @@ HcclResult HcclBroadcast(void *buf, uint64_t count, HcclDataType dataType, uint3
 HcclResult HcclReduceScatter(void *sendBuf, void *recvBuf, uint64_t recvCount, HcclDataType dataType,
                              HcclReduceOp op, HcclComm comm, aclrtStream stream)
 {
+    if (UNLIKELY(hccl::IsGroupRecording())) {
+        // HcclGroupStart/HcclGroupEnd之间只记录, 在HcclGroupEnd时统一下发
+        return hccl::RecordGroupOp({HcclCMDType::HCCL_CMD_REDUCE_SCATTER, sendBuf, recvBuf, recvCount, dataType,
+            op, 0, comm, stream});
+    }
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -1825,6 +2009,7 @@ HcclResult HcclReduceScatter(void *sendBuf, void *recvBuf, uint64_t recvCount, H
 HcclResult HcclReduceScatterV(void *sendBuf, const void *sendCounts, const void *sendDispls,
     void *recvBuf, uint64_t recvCount, HcclDataType dataType, HcclReduceOp op, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclReduceScatterV"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -1971,6 +2156,7 @@ HcclResult CheckScatterInputPara(HcclComm comm, void *recvBuf)
 HcclResult HcclScatter(void *sendBuf, void *recvBuf, uint64_t recvCount, HcclDataType dataType, uint32_t root,
     HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclScatter"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2076,6 +2262,11 @@ HcclResult HcclScatter(void *sendBuf, void *recvBuf, uint64_t recvCount, HcclDat
 HcclResult HcclAllGather(void *sendBuf, void *recvBuf, uint64_t sendCount, HcclDataType dataType,
                          HcclComm comm, aclrtStream stream)
 {
+    if (UNLIKELY(hccl::IsGroupRecording())) {
+        // HcclGroupStart/HcclGroupEnd之间只记录, 在HcclGroupEnd时统一下发
+        return hccl::RecordGroupOp({HcclCMDType::HCCL_CMD_ALLGATHER, sendBuf, recvBuf, sendCount, dataType,
+            HCCL_REDUCE_RESERVED, 0, comm, stream});
+    }
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2157,6 +2348,7 @@ HcclResult HcclAllGather(void *sendBuf, void *recvBuf, uint64_t sendCount, HcclD
 HcclResult HcclAllGatherV(void *sendBuf, uint64_t sendCount, void *recvBuf,
     const void *recvCounts, const void *recvDispls, HcclDataType dataType, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclAllGatherV"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2280,6 +2472,7 @@ HcclResult HcclAllGatherV(void *sendBuf, uint64_t sendCount, void *recvBuf,
 HcclResult HcclSend(void* sendBuf, uint64_t count, HcclDataType dataType, uint32_t destRank,
                     HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclSend"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2374,6 +2567,7 @@ HcclResult HcclSend(void* sendBuf, uint64_t count, HcclDataType dataType, uint32
 HcclResult HcclRecv(void* recvBuf, uint64_t count, HcclDataType dataType, uint32_t srcRank,
                     HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclRecv"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2533,6 +2727,8 @@ HcclResult HcclCommDestroy(HcclComm comm)
     }
     hcclComm->DeinitZeroCopyMemoryAgent();
     HCCL_RUN_INFO("[HcclCommDestroy] comm state is %s", HcclCommStateToString(state));
+    // 未释放的持久化算子句柄不再指向该通信域
+    (void)PersistentOpRegistry::GetInstance().InvalidateComm(hcclComm);
 
     CHK_RET(hcclComm->SetStopFlag(true));
     CHK_RET(SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE));
@@ -2605,6 +2801,22 @@ HcclResult HcclGenerateCommId(hccl::HcclCommParams &params)
     return HCCL_SUCCESS;
 }
 
+HcclResult InitOtherInfoByCrc(hccl::HcclCommParams &params, u32 rankTableCrc)
+{
+    // 记录版本信息
+    std::string curVersion = GetExternalInputCannVersion();
+    CHK_RET(RankConsistentcyChecker::GetInstance().RecordVerInfo(curVersion));
+
+    params.ranktableCrc = rankTableCrc;
+
+    // 生成通信域标识符
+    HcclResult ret = HcclGenerateCommId(params);
+    CHK_PRT_RET(ret != HCCL_SUCCESS,
+        HCCL_ERROR("[Init][OtherInfo]errNo[0x%016llx] generate CommId error, params: dest[%p]",
+            HCCL_ERROR_CODE(HCCL_E_INTERNAL), params.id.internal), HCCL_E_INTERNAL);
+    return HCCL_SUCCESS;
+}
+
 HcclResult InitOtherInfo(hccl::HcclCommParams &params, const char *rankTable)
 {
     // 记录版本信息
@@ -2753,6 +2965,7 @@ HcclResult HcclGetRankId(HcclComm comm, uint32_t *rank)
 HcclResult HcclAlltoAll(const void *sendBuf, uint64_t sendCount, HcclDataType sendType, const void *recvBuf,
     uint64_t recvCount, HcclDataType recvType, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclAlltoAll"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2866,6 +3079,7 @@ HcclResult HcclAlltoAllV(const void *sendBuf, const void *sendCounts, const void
                          const void *recvBuf, const void *recvCounts, const void *rdispls, HcclDataType recvType,
                          HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclAlltoAllV"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -2992,6 +3206,7 @@ HcclResult HcclAlltoAllVC(const void *sendBuf, const void *sendCountMatrix,
     HcclDataType sendType, const void *recvBuf, HcclDataType recvType,
     HcclComm comm, rtStream_t stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclAlltoAllVC"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -3107,6 +3322,7 @@ HcclResult HcclAlltoAllVC(const void *sendBuf, const void *sendCountMatrix,
 HcclResult HcclReduce(void *sendBuf, void *recvBuf, uint64_t count, HcclDataType dataType, HcclReduceOp op,
                       uint32_t root, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclReduce"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -3287,6 +3503,7 @@ HcclResult ReduceLoop(const std::string &tag, void *inputPtr, void *outputPtr, c
  */
 HcclResult HcclGatherAlltoAllV(HcomGatherAllToAllVParams params, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclGatherAlltoAllV"));
     HcclUs startut = TIME_NOW();
     CHK_PTR_NULL(comm);
     CHK_PTR_NULL(params.addrInfoCountPerRank);
@@ -3833,6 +4050,7 @@ HcclResult HcclGetAicpuOpStreamAndNotify(HcclComm comm, rtStream_t* opstream, u8
 
 HcclResult HcclBatchSendRecv(HcclSendRecvItem* sendRecvInfo, uint32_t itemNum, HcclComm comm, aclrtStream stream)
 {
+    CHK_RET(hccl::CheckNotInGroup("HcclBatchSendRecv"));
     HcclUs startut = TIME_NOW();
     bool isCapture;
     rtStreamCaptureStatus captureStatus = rtStreamCaptureStatus::RT_STREAM_CAPTURE_STATUS_NONE;
@@ -3937,6 +4155,33 @@ HcclResult HcclDeviceRefresh(void)
     return HCCL_SUCCESS;
 }
 
+static HcclResult CreatePersistentOpHandle(hccl::hcclComm *hcclComm, HcclCMDType cmdType, u64 count,
+    HcclDataType dataType, const std::string &tag, const std::function<HcclResult()> &issueOp,
+    HcclPersistentOp *persistentOp)
+{
+    std::unique_ptr<hccl::PersistentOpHandle> opInfo(new (std::nothrow) hccl::PersistentOpHandle());
+    CHK_SMART_PTR_NULL(opInfo);
+    opInfo->comm = hcclComm;
+    opInfo->cmdType = cmdType;
+    opInfo->count = count;
+    opInfo->dataType = dataType;
+    opInfo->tag = tag;
+    if (count != 0) {
+        CHK_RET_AND_PRINT_IDE(SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE), tag.c_str());
+        CHK_RET_AND_PRINT_IDE(SetDefaultQosConfig(hcclComm), tag.c_str());
+        CHK_RET_AND_PRINT_IDE(hcclComm->CreatePersistentOp(issueOp, opInfo->opId), tag.c_str());
+    }
+    u64 opId = opInfo->opId;
+    HcclResult ret = hccl::PersistentOpRegistry::GetInstance().Register(std::move(opInfo), *persistentOp);
+    if (ret != HCCL_SUCCESS && opId != 0) {
+        (void)hcclComm->DestroyPersistentOp(opId);
+    }
+    CHK_RET_AND_PRINT_IDE(ret, tag.c_str());
+    HCCL_RUN_INFO("[CreatePersistentOp]tag[%s] cmdType[%d] count[%llu] dataType[%s] opId[%llu] create success",
+        tag.c_str(), cmdType, count, GetDataTypeEnumStr(dataType).c_str(), opId);
+    return HCCL_SUCCESS;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -4080,6 +4325,143 @@ HcclResult HcclCommWorkingDevNicSet(HcclComm comm, uint32_t *ranks, bool *useBac
     return HCCL_SUCCESS;
 }
 
+
+HcclResult HcclAllReduceInit(void *sendBuf, void *recvBuf, uint64_t count, HcclDataType dataType,
+    HcclReduceOp op, HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp)
+{
+    CHK_PTR_NULL(comm);
+    CHK_PTR_NULL(sendBuf);
+    CHK_PTR_NULL(recvBuf);
+    CHK_PTR_NULL(persistentOp);
+    DevType devType;
+    CHK_RET(hrtGetDeviceType(devType));
+
+    hccl::hcclComm *hcclComm = static_cast<hccl::hcclComm *>(comm);
+    const std::lock_guard<std::mutex> lock(hcclComm->operatorlock_);
+    StateGuard<hccl::hcclComm, HcclCommState> guard(hcclComm, HcclCommState::INUSE);
+    const std::string tag = "AllReduce_" + hcclComm->GetIdentifier();
+    CHK_RET_AND_PRINT_IDE(HcomCheckOpParam(tag.c_str(), count, dataType, stream), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(HcomCheckReductionOp(op), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(HcomCheckReduceDataType(dataType, op, devType), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(SetOverFlowAddr(hcclComm), tag.c_str());
+
+    CHK_RET(CreatePersistentOpHandle(hcclComm, HcclCMDType::HCCL_CMD_ALLREDUCE, count, dataType, tag,
+        [&]() { return hcclComm->AllReduceOutPlace(tag, sendBuf, recvBuf, count, dataType, op, stream); },
+        persistentOp));
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclAllGatherInit(void *sendBuf, void *recvBuf, uint64_t sendCount, HcclDataType dataType,
+    HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp)
+{
+    CHK_PTR_NULL(comm);
+    CHK_PTR_NULL(sendBuf);
+    CHK_PTR_NULL(recvBuf);
+    CHK_PTR_NULL(persistentOp);
+
+    hccl::hcclComm *hcclComm = static_cast<hccl::hcclComm *>(comm);
+    const std::lock_guard<std::mutex> lock(hcclComm->operatorlock_);
+    StateGuard<hccl::hcclComm, HcclCommState> guard(hcclComm, HcclCommState::INUSE);
+    const std::string tag = "AllGather_" + hcclComm->GetIdentifier();
+    CHK_RET_AND_PRINT_IDE(HcomCheckOpParam(tag.c_str(), sendCount, dataType, stream), tag.c_str());
+
+    CHK_RET(CreatePersistentOpHandle(hcclComm, HcclCMDType::HCCL_CMD_ALLGATHER, sendCount, dataType, tag,
+        [&]() { return hcclComm->AllGatherOutPlace(tag, sendBuf, recvBuf, sendCount, dataType, stream); },
+        persistentOp));
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclReduceScatterInit(void *sendBuf, void *recvBuf, uint64_t recvCount, HcclDataType dataType,
+    HcclReduceOp op, HcclComm comm, aclrtStream stream, HcclPersistentOp *persistentOp)
+{
+    CHK_PTR_NULL(comm);
+    CHK_PTR_NULL(sendBuf);
+    CHK_PTR_NULL(recvBuf);
+    CHK_PTR_NULL(persistentOp);
+    DevType devType;
+    CHK_RET(hrtGetDeviceType(devType));
+
+    hccl::hcclComm *hcclComm = static_cast<hccl::hcclComm *>(comm);
+    const std::lock_guard<std::mutex> lock(hcclComm->operatorlock_);
+    StateGuard<hccl::hcclComm, HcclCommState> guard(hcclComm, HcclCommState::INUSE);
+    const std::string tag = "ReduceScatter_" + hcclComm->GetIdentifier();
+    CHK_RET_AND_PRINT_IDE(HcomCheckOpParam(tag.c_str(), recvCount, dataType, stream), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(HcomCheckReductionOp(op), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(HcomCheckReduceDataType(dataType, op, devType), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(SetOverFlowAddr(hcclComm), tag.c_str());
+
+    CHK_RET(CreatePersistentOpHandle(hcclComm, HcclCMDType::HCCL_CMD_REDUCE_SCATTER, recvCount, dataType, tag,
+        [&]() { return hcclComm->ReduceScatterOutPlace(tag, sendBuf, recvBuf, recvCount, dataType, op, stream); },
+        persistentOp));
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclBroadcastInit(void *buf, uint64_t count, HcclDataType dataType, uint32_t root, HcclComm comm,
+    aclrtStream stream, HcclPersistentOp *persistentOp)
+{
+    CHK_PTR_NULL(comm);
+    CHK_PTR_NULL(buf);
+    CHK_PTR_NULL(persistentOp);
+
+    hccl::hcclComm *hcclComm = static_cast<hccl::hcclComm *>(comm);
+    const std::lock_guard<std::mutex> lock(hcclComm->operatorlock_);
+    StateGuard<hccl::hcclComm, HcclCommState> guard(hcclComm, HcclCommState::INUSE);
+    const std::string tag = "Broadcast_" + hcclComm->GetIdentifier();
+    CHK_RET_AND_PRINT_IDE(HcomCheckOpParam(tag.c_str(), count, dataType, stream), tag.c_str());
+    u32 rankSize = INVALID_VALUE_RANKSIZE;
+    CHK_RET_AND_PRINT_IDE(hcclComm->GetRankSize(rankSize), tag.c_str());
+    CHK_RET_AND_PRINT_IDE(HcomCheckUserRank(rankSize, root), tag.c_str());
+    if (count != 0) {
+        HcomCollOpInfo opInfo = {"", buf, buf, count, dataType, root, HCCL_REDUCE_RESERVED};
+        CHK_RET_AND_PRINT_IDE(hcclComm->CreateOpBasedResources(HcclCMDType::HCCL_CMD_BROADCAST, tag, opInfo),
+            tag.c_str());
+    }
+
+    CHK_RET(CreatePersistentOpHandle(hcclComm, HcclCMDType::HCCL_CMD_BROADCAST, count, dataType, tag,
+        [&]() { return hcclComm->BroadcastOutPlace(tag, buf, count, dataType, root, stream); },
+        persistentOp));
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclPersistentOpStart(HcclPersistentOp persistentOp)
+{
+    CHK_RET(hccl::CheckNotInGroup("HcclPersistentOpStart"));
+    CHK_PTR_NULL(persistentOp);
+    hccl::PersistentOpHandle opInfo;
+    CHK_RET(hccl::PersistentOpRegistry::GetInstance().Get(persistentOp, opInfo));
+    if (opInfo.opId == 0) {
+        return HCCL_SUCCESS;
+    }
+    CHK_PRT_RET(opInfo.comm == nullptr, HCCL_ERROR("[HcclPersistentOpStart]tag[%s] opId[%llu] the communicator "
+        "is destroyed, free the persistent op", opInfo.tag.c_str(), opInfo.opId), HCCL_E_NOT_FOUND);
+    // 参数校验与算法选择已在创建时完成, 这里只保留每次下发都需要的处理
+    HcclSetIfProfile();
+    uint64_t beginTime = hrtMsprofSysCycleTime();
+    hccl::hcclComm *hcclComm = opInfo.comm;
+    const std::lock_guard<std::mutex> lock(hcclComm->operatorlock_);
+    StateGuard<hccl::hcclComm, HcclCommState> guard(hcclComm, HcclCommState::INUSE);
+    CHK_RET_AND_PRINT_IDE(SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE), opInfo.tag.c_str());
+    CHK_RET_AND_PRINT_IDE(hcclComm->StartPersistentOp(opInfo.opId), opInfo.tag.c_str());
+    CHK_RET(CallMsprofReportHostApi(hcclComm, opInfo.cmdType, beginTime, opInfo.count, opInfo.dataType,
+        opInfo.tag));
+    HcclResetIfProfile();
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclPersistentOpFree(HcclPersistentOp persistentOp)
+{
+    CHK_PTR_NULL(persistentOp);
+    hccl::PersistentOpHandle opInfo;
+    CHK_RET(hccl::PersistentOpRegistry::GetInstance().Unregister(persistentOp, opInfo));
+    // 通信域已销毁时计划随通信域释放, 只需释放句柄
+    if (opInfo.opId != 0 && opInfo.comm != nullptr) {
+        const std::lock_guard<std::mutex> lock(opInfo.comm->operatorlock_);
+        CHK_RET(opInfo.comm->DestroyPersistentOp(opInfo.opId));
+    }
+    HCCL_RUN_INFO("[HcclPersistentOpFree]tag[%s] opId[%llu] free success", opInfo.tag.c_str(), opInfo.opId);
+    return HCCL_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
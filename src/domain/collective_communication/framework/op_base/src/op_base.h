@@ -45,6 +45,7 @@ HcclOpInfoCtx &GetHcclExistDeviceOpInfoCtx(void);
 HcclOpInfoCtx &GetHcclOpInfoCtx(void);
 
 HcclResult InitOtherInfo(hccl::HcclCommParams &params, const char *rankTable);
+HcclResult InitOtherInfoByCrc(hccl::HcclCommParams &params, u32 rankTableCrc);
 
 HcclResult CallMsprofReportHostApi(hccl::hcclComm* hcclComm, HcclCMDType cmdType, uint64_t beginTime, u64 count,
     HcclDataType dataType, std::string tag);
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_base_group.h"
+#include <vector>
+#include "op_base.h"
+#include "hccl/base.h"
+#include "param_check_pub.h"
+#include "adapter_rts_common.h"
+#include "sal_pub.h"
+
+using namespace std;
+
+namespace hccl {
+// group可嵌套, 只有最外层HcclGroupEnd才下发
+thread_local u32 g_groupDepth = 0;
+thread_local std::vector<GroupOpRecord> g_groupOps;
+
+bool IsGroupRecording()
+{
+    return g_groupDepth > 0;
+}
+
+HcclResult RecordGroupOp(const GroupOpRecord &record)
+{
+    CHK_PTR_NULL(record.comm);
+    CHK_PTR_NULL(record.stream);
+    CHK_RET(HcomCheckDataType(record.dataType));
+    if (record.count == 0) {
+        HCCL_WARNING("[RecordGroupOp]cmdType[%d] count is 0, skip", record.cmdType);
+        return HCCL_SUCCESS;
+    }
+    if (record.cmdType != HcclCMDType::HCCL_CMD_BROADCAST) {
+        CHK_PTR_NULL(record.sendBuf);
+    }
+    CHK_PTR_NULL(record.recvBuf);
+    g_groupOps.push_back(record);
+    return HCCL_SUCCESS;
+}
+
+HcclResult CheckNotInGroup(const char *opName)
+{
+    CHK_PRT_RET(IsGroupRecording(), HCCL_ERROR("[CheckNotInGroup]%s is not supported between HcclGroupStart and "
+        "HcclGroupEnd, only AllReduce, Broadcast, AllGather and ReduceScatter can be grouped", opName),
+        HCCL_E_NOT_SUPPORT);
+    return HCCL_SUCCESS;
+}
+
+static HcclResult IssueGroupOp(const GroupOpRecord &record)
+{
+    switch (record.cmdType) {
+        case HcclCMDType::HCCL_CMD_ALLREDUCE:
+            return HcclAllReduce(record.sendBuf, record.recvBuf, record.count, record.dataType, record.op,
+                record.comm, record.stream);
+        case HcclCMDType::HCCL_CMD_BROADCAST:
+            return HcclBroadcast(record.recvBuf, record.count, record.dataType, record.root, record.comm,
+                record.stream);
+        case HcclCMDType::HCCL_CMD_ALLGATHER:
+            return HcclAllGather(record.sendBuf, record.recvBuf, record.count, record.dataType, record.comm,
+                record.stream);
+        case HcclCMDType::HCCL_CMD_REDUCE_SCATTER:
+            return HcclReduceScatter(record.sendBuf, record.recvBuf, record.count, record.dataType, record.op,
+                record.comm, record.stream);
+        default:
+            HCCL_ERROR("[IssueGroupOp]cmdType[%d] is not supported in group", record.cmdType);
+            return HCCL_E_NOT_SUPPORT;
+    }
+}
+
+// 拷入融合buffer, 下发一次集合通信, 再拷回各算子的输出
+static HcclResult IssueFusedGroupOps(const std::vector<GroupOpRecord> &ops, const GroupLaunch &launch)
+{
+    const GroupOpRecord &first = ops[launch.opIndexes[0]];
+    hccl::hcclComm *hcclComm = static_cast<hccl::hcclComm *>(first.comm);
+    DeviceMem fusionMem;
+    HcclResult ret = hcclComm->GetGroupFusionMem(launch.size, first.stream, fusionMem);
+    if (ret != HCCL_SUCCESS) {
+        // 融合内存不可用时退化为逐个下发, 结果不变
+        HCCL_WARNING("[IssueFusedGroupOps]get fusion mem size[%llu] failed, ret[%d], launch [%zu] ops one by one",
+            launch.size, ret, launch.opIndexes.size());
+        for (u32 index : launch.opIndexes) {
+            CHK_RET(IssueGroupOp(ops[index]));
+        }
+        return HCCL_SUCCESS;
+    }
+
+    bool needPack = true;
+    bool needUnpack = true;
+    if (first.cmdType == HcclCMDType::HCCL_CMD_BROADCAST) {
+        // broadcast只有root需要拷入, 只有非root需要拷出
+        u32 userRank = INVALID_VALUE_RANKID;
+        CHK_RET(hcclComm->GetUserRank(userRank));
+        needPack = (userRank == first.root);
+        needUnpack = !needPack;
+    }
+    u8 *fusionPtr = static_cast<u8 *>(fusionMem.ptr());
+    if (needPack) {
+        u64 offset = 0;
+        for (u32 index : launch.opIndexes) {
+            const GroupOpRecord &record = ops[index];
+            u64 size = GetGroupOpSize(record);
+            void *src = (record.cmdType == HcclCMDType::HCCL_CMD_BROADCAST) ? record.recvBuf : record.sendBuf;
+            CHK_RET(hrtMemAsyncCopy(fusionPtr + offset, launch.size - offset, src, size,
+                HcclRtMemcpyKind::HCCL_RT_MEMCPY_KIND_DEVICE_TO_DEVICE, first.stream));
+            offset += size;
+        }
+    }
+
+    u64 totalCount = launch.size / SIZE_TABLE[first.dataType];
+    if (first.cmdType == HcclCMDType::HCCL_CMD_ALLREDUCE) {
+        CHK_RET(HcclAllReduce(fusionPtr, fusionPtr, totalCount, first.dataType, first.op, first.comm,
+            first.stream));
+    } else {
+        CHK_RET(HcclBroadcast(fusionPtr, totalCount, first.dataType, first.root, first.comm, first.stream));
+    }
+
+    if (needUnpack) {
+        u64 offset = 0;
+        for (u32 index : launch.opIndexes) {
+            const GroupOpRecord &record = ops[index];
+            u64 size = GetGroupOpSize(record);
+            CHK_RET(hrtMemAsyncCopy(record.recvBuf, size, fusionPtr + offset, size,
+                HcclRtMemcpyKind::HCCL_RT_MEMCPY_KIND_DEVICE_TO_DEVICE, first.stream));
+            offset += size;
+        }
+    }
+    HCCL_INFO("[IssueFusedGroupOps]cmdType[%d] fuse [%zu] ops into one, totalSize[%llu]", first.cmdType,
+        launch.opIndexes.size(), launch.size);
+    return HCCL_SUCCESS;
+}
+
+static HcclResult LaunchGroupOps(const std::vector<GroupOpRecord> &ops, u32 &launchNum)
+{
+    std::vector<GroupLaunch> plan;
+    CHK_RET(BuildGroupLaunchPlan(ops, plan));
+    for (const GroupLaunch &launch : plan) {
+        if (launch.opIndexes.size() == 1) {
+            CHK_RET(IssueGroupOp(ops[launch.opIndexes[0]]));
+        } else {
+            CHK_RET(IssueFusedGroupOps(ops, launch));
+        }
+    }
+    launchNum = plan.size();
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+HcclResult HcclGroupStart()
+{
+    hccl::g_groupDepth++;
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclGroupEnd()
+{
+    CHK_PRT_RET(hccl::g_groupDepth == 0,
+        HCCL_ERROR("[HcclGroupEnd]HcclGroupEnd is called without HcclGroupStart"), HCCL_E_PARA);
+    hccl::g_groupDepth--;
+    if (hccl::g_groupDepth > 0) {
+        return HCCL_SUCCESS;
+    }
+
+    HcclUs startut = TIME_NOW();
+    std::vector<hccl::GroupOpRecord> ops;
+    ops.swap(hccl::g_groupOps);
+    u32 launchNum = 0;
+    HcclResult ret = hccl::LaunchGroupOps(ops, launchNum);
+    CHK_PRT_RET(ret != HCCL_SUCCESS, HCCL_ERROR("[HcclGroupEnd]errNo[0x%016llx] launch group ops failed, "
+        "op num[%zu]", HCCL_ERROR_CODE(ret), ops.size()), ret);
+    HcclUs endut = TIME_NOW();
+    HCCL_INFO("HcclGroupEnd:success, op num[%zu], launch num[%u], take time[%lld]us", ops.size(), launchNum,
+        DURATION_US(endut - startut).count());
+    return HCCL_SUCCESS;
+}
+#ifdef __cplusplus
+}
+#endif // __cplusplus
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_BASE_GROUP_H
+#define OP_BASE_GROUP_H
+
+#include <hccl/hccl.h>
+#include <hccl/hccl_types.h>
+#include "hccl_common.h"
+#include "op_base_group_plan.h"
+
+namespace hccl {
+bool IsGroupRecording();
+HcclResult RecordGroupOp(const GroupOpRecord &record);
+// group内只记录部分算子, 其余算子若直接下发会越过同组已记录的算子, 因此在group内拒绝
+HcclResult CheckNotInGroup(const char *opName);
+}  // namespace hccl
+
+#endif /* OP_BASE_GROUP_H */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_base_group_plan.h"
+#include "log.h"
+
+namespace hccl {
+u64 GetGroupOpSize(const GroupOpRecord &record)
+{
+    return record.count * SIZE_TABLE[record.dataType];
+}
+
+static bool IsFusibleGroupOp(const GroupOpRecord &record)
+{
+    // allreduce/broadcast的输入输出与数据在buffer中的位置无关, 可直接拼接
+    if (record.cmdType != HcclCMDType::HCCL_CMD_ALLREDUCE && record.cmdType != HcclCMDType::HCCL_CMD_BROADCAST) {
+        return false;
+    }
+    return GetGroupOpSize(record) <= GROUP_FUSION_MAX_OP_SIZE;
+}
+
+static bool IsSameFusionKey(const GroupOpRecord &lhs, const GroupOpRecord &rhs)
+{
+    return lhs.comm == rhs.comm && lhs.stream == rhs.stream && lhs.cmdType == rhs.cmdType &&
+        lhs.dataType == rhs.dataType && lhs.op == rhs.op && lhs.root == rhs.root;
+}
+
+HcclResult BuildGroupLaunchPlan(const std::vector<GroupOpRecord> &ops, std::vector<GroupLaunch> &plan)
+{
+    plan.clear();
+    std::vector<bool> planned(ops.size(), false);
+    for (u32 i = 0; i < ops.size(); i++) {
+        if (planned[i]) {
+            continue;
+        }
+        CHK_PRT_RET(ops[i].dataType >= HCCL_DATA_TYPE_RESERVED, HCCL_ERROR("[BuildGroupLaunchPlan]op[%u] "
+            "dataType[%d] is invalid", i, ops[i].dataType), HCCL_E_PARA);
+        if (!IsFusibleGroupOp(ops[i])) {
+            plan.push_back({{i}, GetGroupOpSize(ops[i])});
+            planned[i] = true;
+            continue;
+        }
+        GroupLaunch launch;
+        for (u32 j = i; j < ops.size(); j++) {
+            if (planned[j] || !IsFusibleGroupOp(ops[j]) || !IsSameFusionKey(ops[i], ops[j])) {
+                continue;
+            }
+            u64 size = GetGroupOpSize(ops[j]);
+            if (launch.size + size > GROUP_FUSION_MAX_SIZE) {
+                plan.push_back(launch);
+                launch = GroupLaunch();
+            }
+            launch.opIndexes.push_back(j);
+            launch.size += size;
+            planned[j] = true;
+        }
+        plan.push_back(launch);
+    }
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_BASE_GROUP_PLAN_H
+#define OP_BASE_GROUP_PLAN_H
+
+#include <vector>
+#include <hccl/hccl_types.h>
+#include "base.h"
+#include "hccl_common.h"
+
+namespace hccl {
+// 单个算子融合的数据量上限, 大算子融合的拷贝开销超过节省的下发开销
+constexpr u64 GROUP_FUSION_MAX_OP_SIZE = 1024 * 1024;
+// 单次融合算子的数据量上限
+constexpr u64 GROUP_FUSION_MAX_SIZE = 64 * 1024 * 1024;
+
+// HcclGroupStart/HcclGroupEnd之间记录的算子
+struct GroupOpRecord {
+    HcclCMDType cmdType = HcclCMDType::HCCL_CMD_INVALID;
+    void *sendBuf = nullptr;
+    void *recvBuf = nullptr;
+    u64 count = 0;
+    HcclDataType dataType = HCCL_DATA_TYPE_RESERVED;
+    HcclReduceOp op = HCCL_REDUCE_RESERVED;
+    u32 root = 0;
+    HcclComm comm = nullptr;
+    rtStream_t stream = nullptr;
+};
+
+// HcclGroupEnd的一次下发, opIndexes多于一个时融合为一个集合通信
+struct GroupLaunch {
+    std::vector<u32> opIndexes;
+    u64 size = 0;       // 融合时为拼接后的总字节数
+};
+
+u64 GetGroupOpSize(const GroupOpRecord &record);
+
+/*
+ * 可融合的算子按(comm, stream, 算子类型, 数据类型, reduce类型, root)归并, 在该组首个算子的位置一次下发;
+ * 其余算子按记录顺序逐个下发。各rank记录的算子序列一致, 归并结果也一致
+ */
+HcclResult BuildGroupLaunchPlan(const std::vector<GroupOpRecord> &ops, std::vector<GroupLaunch> &plan);
+}  // namespace hccl
+
+#endif /* OP_BASE_GROUP_PLAN_H */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_base_persistent.h"
+#include "log.h"
+
+namespace hccl {
+PersistentOpRegistry &PersistentOpRegistry::GetInstance()
+{
+    static PersistentOpRegistry registry;
+    return registry;
+}
+
+HcclResult PersistentOpRegistry::Register(std::unique_ptr<PersistentOpHandle> handle, HcclPersistentOp &persistentOp)
+{
+    CHK_SMART_PTR_NULL(handle);
+    CHK_PTR_NULL(handle->comm);
+    std::lock_guard<std::mutex> lock(mutex_);
+    persistentOp = handle.get();
+    commHandles_[handle->comm].insert(persistentOp);
+    handles_[persistentOp] = std::move(handle);
+    return HCCL_SUCCESS;
+}
+
+HcclResult PersistentOpRegistry::Get(HcclPersistentOp persistentOp, PersistentOpHandle &handle)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = handles_.find(persistentOp);
+    CHK_PRT_RET(iter == handles_.end(),
+        HCCL_ERROR("[PersistentOpRegistry][Get]persistentOp[%p] is not created or already freed", persistentOp),
+        HCCL_E_PARA);
+    handle = *(iter->second);
+    return HCCL_SUCCESS;
+}
+
+HcclResult PersistentOpRegistry::Unregister(HcclPersistentOp persistentOp, PersistentOpHandle &handle)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = handles_.find(persistentOp);
+    CHK_PRT_RET(iter == handles_.end(),
+        HCCL_ERROR("[PersistentOpRegistry][Unregister]persistentOp[%p] is not created or already freed",
+        persistentOp), HCCL_E_PARA);
+    handle = *(iter->second);
+    auto commIter = commHandles_.find(handle.comm);
+    if (commIter != commHandles_.end()) {
+        commIter->second.erase(persistentOp);
+        if (commIter->second.empty()) {
+            commHandles_.erase(commIter);
+        }
+    }
+    handles_.erase(iter);
+    return HCCL_SUCCESS;
+}
+
+u32 PersistentOpRegistry::InvalidateComm(const hcclComm *comm)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto commIter = commHandles_.find(comm);
+    if (commIter == commHandles_.end()) {
+        return 0;
+    }
+    u32 handleNum = commIter->second.size();
+    for (HcclPersistentOp persistentOp : commIter->second) {
+        handles_[persistentOp]->comm = nullptr;
+    }
+    commHandles_.erase(commIter);
+    HCCL_WARNING("[PersistentOpRegistry][InvalidateComm]comm[%p] is destroyed with [%u] persistent ops not freed",
+        comm, handleNum);
+    return handleNum;
+}
+
+u32 PersistentOpRegistry::GetHandleNum(const hcclComm *comm)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto commIter = commHandles_.find(comm);
+    return (commIter == commHandles_.end()) ? 0 : commIter->second.size();
+}
+}  // namespace hccl
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_BASE_PERSISTENT_H
+#define OP_BASE_PERSISTENT_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <hccl/hccl_types.h>
+#include "hccl_common.h"
+
+namespace hccl {
+class hcclComm;
+
+// 持久化算子句柄, count为0时opId为0, Start直接返回
+struct PersistentOpHandle {
+    hcclComm *comm = nullptr;   // 所属通信域, 通信域销毁后置空
+    u64 opId = 0;
+    HcclCMDType cmdType = HcclCMDType::HCCL_CMD_INVALID;
+    u64 count = 0;
+    HcclDataType dataType = HCCL_DATA_TYPE_RESERVED;
+    std::string tag;
+};
+
+/*
+ * 持久化算子句柄登记表, 按通信域记录句柄。通信域销毁时其下句柄全部失效, 之后Start返回错误, Free只释放句柄,
+ * 不再访问已销毁的通信域; 已释放或非法的句柄在解引用前即被拒绝
+ */
+class PersistentOpRegistry {
+public:
+    static PersistentOpRegistry &GetInstance();
+
+    HcclResult Register(std::unique_ptr<PersistentOpHandle> handle, HcclPersistentOp &persistentOp);
+    /* 返回句柄内容的副本, 所属通信域已销毁时comm为空 */
+    HcclResult Get(HcclPersistentOp persistentOp, PersistentOpHandle &handle);
+    HcclResult Unregister(HcclPersistentOp persistentOp, PersistentOpHandle &handle);
+    /* 通信域销毁前调用, 返回失效的句柄数 */
+    u32 InvalidateComm(const hcclComm *comm);
+    u32 GetHandleNum(const hcclComm *comm);
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<HcclPersistentOp, std::unique_ptr<PersistentOpHandle>> handles_;
+    std::unordered_map<const hcclComm *, std::unordered_set<HcclPersistentOp>> commHandles_;
+};
+}  // namespace hccl
+
+#endif /* OP_BASE_PERSISTENT_H */
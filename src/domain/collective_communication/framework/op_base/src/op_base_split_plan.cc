@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_base_split_plan.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "log.h"
+
+namespace hccl {
+HcclResult BuildSplitBatchPlan(const std::vector<u32> &globalRankIds, u32 localRank, u32 splitNum,
+    const u32 *colors, const u32 *keys, std::vector<SplitBatchPlan> &plans)
+{
+    plans.clear();
+    CHK_PTR_NULL(colors);
+    const u32 rankSize = globalRankIds.size();
+    CHK_PRT_RET(localRank >= rankSize, HCCL_ERROR("[BuildSplitBatchPlan]local rank[%u] should be less than " \
+        "rankSize[%u].", localRank, rankSize), HCCL_E_PARA);
+    // colors/keys按rankId取值, rank table中的rankId需与[0, rankSize)一一对应
+    std::vector<bool> rankSeen(rankSize, false);
+    for (u32 pos = 0; pos < rankSize; pos++) {
+        u32 rankId = globalRankIds[pos];
+        CHK_PRT_RET(rankId >= rankSize || rankSeen[rankId], HCCL_ERROR("[BuildSplitBatchPlan]rankId[%u] at " \
+            "position[%u] of rank table is out of range or duplicated, rankSize[%u].", rankId, pos, rankSize),
+            HCCL_E_PARA);
+        rankSeen[rankId] = true;
+    }
+
+    std::vector<std::pair<u32, u32>> members;
+    members.reserve(rankSize);
+    for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+        const u32 *splitColors = colors + static_cast<u64>(splitIdx) * rankSize;
+        const u32 *splitKeys = (keys == nullptr) ? nullptr : keys + static_cast<u64>(splitIdx) * rankSize;
+        const u32 localColor = splitColors[localRank];
+        if (localColor == HCCL_SPLIT_NOCOLOR) {
+            continue;
+        }
+
+        // 同色rank按(key, 全局rankId)排序, 即为子通信域内的rank顺序
+        members.clear();
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            if (splitColors[rank] == localColor) {
+                members.emplace_back((splitKeys == nullptr) ? 0 : splitKeys[rank], rank);
+            }
+        }
+        std::sort(members.begin(), members.end());
+
+        SplitBatchPlan plan;
+        plan.splitIdx = splitIdx;
+        plan.color = localColor;
+        plan.rankIds.resize(members.size());
+        for (u32 i = 0; i < members.size(); i++) {
+            plan.rankIds[i] = members[i].second;
+            if (members[i].second == localRank) {
+                plan.subCommRankId = i;
+            }
+        }
+        plans.push_back(std::move(plan));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult RunSplitBatchTasks(u32 taskNum, u32 threadNum, const std::function<HcclResult(u32)> &task)
+{
+    if (taskNum == 0) {
+        return HCCL_SUCCESS;
+    }
+    CHK_PRT_RET(threadNum == 0, HCCL_ERROR("[RunSplitBatchTasks]thread num should not be zero."), HCCL_E_PARA);
+    threadNum = std::min(threadNum, taskNum);
+
+    // 各线程依次领取任务, 领取顺序与结果无关
+    std::vector<HcclResult> results(taskNum, HCCL_SUCCESS);
+    std::atomic<u32> nextTask{0};
+    auto worker = [&]() {
+        for (u32 idx = nextTask++; idx < taskNum; idx = nextTask++) {
+            results[idx] = task(idx);
+        }
+    };
+    std::vector<std::unique_ptr<std::thread>> threads;
+    for (u32 i = 1; i < threadNum; i++) {
+        std::unique_ptr<std::thread> thread(new (std::nothrow) std::thread(worker));
+        if (!thread) {
+            HCCL_WARNING("[RunSplitBatchTasks]create thread[%u] failed, run with %zu threads.", i,
+                threads.size() + 1);
+            break;
+        }
+        threads.push_back(std::move(thread));
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread->join();
+    }
+
+    for (u32 idx = 0; idx < taskNum; idx++) {
+        CHK_PRT_RET(results[idx] != HCCL_SUCCESS, HCCL_ERROR("[RunSplitBatchTasks]task[%u] failed, ret[%d].",
+            idx, results[idx]), results[idx]);
+    }
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
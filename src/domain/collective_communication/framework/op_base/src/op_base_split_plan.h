@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef OP_BASE_SPLIT_PLAN_H
+#define OP_BASE_SPLIT_PLAN_H
+
+#include <functional>
+#include <vector>
+#include <hccl/hccl_types.h>
+#include "base.h"
+
+namespace hccl {
+// 批量切分时并发初始化子通信域的线程数上限
+constexpr u32 SPLIT_BATCH_MAX_THREAD_NUM = 8;
+
+// 批量切分中本rank加入的一个子通信域
+struct SplitBatchPlan {
+    u32 splitIdx = 0;
+    u32 color = 0;
+    u32 subCommRankId = 0;
+    std::vector<u32> rankIds;   // 按子通信域内rank顺序排列的全局rankId
+};
+
+/*
+ * colors/keys为splitNum x rankSize的数组, 第splitIdx次切分中全局rank r的color为colors[splitIdx * rankSize + r],
+ * keys为空时按全局rankId排序。globalRankIds为全局rank table各位置的rankId, 需为[0, rankSize)的排列且包含localRank,
+ * 否则按rankId下标取到的color与rank table不对应
+ */
+HcclResult BuildSplitBatchPlan(const std::vector<u32> &globalRankIds, u32 localRank, u32 splitNum,
+    const u32 *colors, const u32 *keys, std::vector<SplitBatchPlan> &plans);
+
+// 最多以threadNum个线程并发执行taskNum个任务, 全部结束后返回, 有任务失败时返回下标最小的失败任务的错误码
+HcclResult RunSplitBatchTasks(u32 taskNum, u32 threadNum, const std::function<HcclResult(u32)> &task);
+}  // namespace hccl
+
+#endif /* OP_BASE_SPLIT_PLAN_H */
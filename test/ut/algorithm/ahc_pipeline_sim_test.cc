@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "sim_comm.h"
+#include "alg_template_register.h"
+#include "asymmetric_hierarchical_concatenate_alg_template_base_pub.h"
+
+using namespace hccl;
+
+namespace {
+// 非对齐的数据量, 分块时最后一块承担余量: 8MB按4MB分两块流水, 4MB不足两个分块时不做流水
+constexpr u64 AHC_LARGE_COUNT = 2 * 1024 * 1024 + 37;
+constexpr u64 AHC_SMALL_COUNT = 1024 * 1024 + 37;
+}
+
+/*
+ * AllReduceAHC/AllReduceAHCBroke在SimEngine上多rank执行: 覆盖大小不均的分组, 校验分块流水与串行执行的结果,
+ * 并比较两者的仿真时延。分组即server, 组内为SDMA链路, 组间为RDMA链路
+ */
+class AHCPipelineSimTest : public testing::Test {
+protected:
+    struct AHCRunResult {
+        double totalTimeUs = 0;
+        u64 taskNum = 0;
+    };
+
+    static std::vector<u32> AllRanks(u32 rankSize)
+    {
+        std::vector<u32> ranks(rankSize);
+        std::iota(ranks.begin(), ranks.end(), 0);
+        return ranks;
+    }
+
+    static void RunAllReduceAHC(TemplateType type, const std::vector<std::vector<u32>> &subGroups, u64 count,
+        bool isPipelined, AHCRunResult &result)
+    {
+        std::vector<u32> serverIds;
+        for (u32 groupIdx = 0; groupIdx < subGroups.size(); groupIdx++) {
+            for (u32 rank : subGroups[groupIdx]) {
+                ASSERT_EQ(rank, serverIds.size()) << "ranks must be numbered in group order";
+                serverIds.push_back(groupIdx);
+            }
+        }
+        u32 rankSize = serverIds.size();
+        u64 size = count * sizeof(s32);
+        SimComm comm(rankSize, isPipelined ? 2 : 1);
+        ASSERT_EQ(comm.Init(size, serverIds), HCCL_SUCCESS);
+
+        const std::vector<std::vector<std::vector<u32>>> globalSubGroups = {subGroups};
+        std::map<AHCConcOpType, TemplateType> ahcAlgOption;
+        ASSERT_EQ(CommAHCBaseInfo::InitConcAlgOption(ahcAlgOption), HCCL_SUCCESS);
+
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            s32 *data = static_cast<s32 *>(res.cclIn.ptr());
+            for (u64 i = 0; i < count; i++) {
+                data[i] = static_cast<s32>(rank * 1000 + i);
+            }
+
+            std::unique_ptr<AlgTemplateBase> tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(type,
+                SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlg, nullptr);
+            ASSERT_EQ(tempAlg->Prepare(count, globalSubGroups, ahcAlgOption), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->Prepare(static_cast<u64>(0)), HCCL_SUCCESS);
+            if (isPipelined) {
+                AllReduceAHCBase *ahcTempAlg = dynamic_cast<AllReduceAHCBase *>(tempAlg.get());
+                ASSERT_NE(ahcTempAlg, nullptr);
+                ASSERT_EQ(ahcTempAlg->PreparePipeline(res.slaveStreams[0], res.notifiesMain[0], res.notifiesAux[0]),
+                    HCCL_SUCCESS);
+            }
+            // 与executor一致, scratch复用output
+            DeviceMem input = res.cclIn.range(0, size);
+            DeviceMem output = res.cclOut.range(0, size);
+            ASSERT_EQ(tempAlg->Prepare(input, output, output, count, HCCL_DATA_TYPE_INT32, res.mainStream,
+                HCCL_REDUCE_SUM, INVALID_VALUE_RANKID, std::vector<Slice>(0), 0), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->RunAsync(rank, rankSize, comm.GetLinks(rank, AllRanks(rankSize))), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *out = static_cast<const s32 *>(comm.GetRank(rank).cclOut.ptr());
+            for (u64 i = 0; i < count; i++) {
+                s32 expect = static_cast<s32>(1000 * rankSize * (rankSize - 1) / 2 + rankSize * i);
+                ASSERT_EQ(out[i], expect) << "rank " << rank << " index " << i;
+            }
+        }
+        result.totalTimeUs = report.totalTimeUs;
+        result.taskNum = report.taskNum;
+    }
+
+    // 串行与流水各执行一次, 结果均需正确; 数据量足够大时流水的仿真时延应更短
+    static void CompareSerialAndPipelined(TemplateType type, const std::vector<std::vector<u32>> &subGroups,
+        u64 count, bool expectFaster)
+    {
+        AHCRunResult serial;
+        AHCRunResult pipelined;
+        ASSERT_NO_FATAL_FAILURE(RunAllReduceAHC(type, subGroups, count, false, serial));
+        ASSERT_NO_FATAL_FAILURE(RunAllReduceAHC(type, subGroups, count, true, pipelined));
+        RecordProperty("serial_us", std::to_string(serial.totalTimeUs));
+        RecordProperty("pipelined_us", std::to_string(pipelined.totalTimeUs));
+        RecordProperty("speedup", std::to_string(serial.totalTimeUs / pipelined.totalTimeUs));
+        if (expectFaster) {
+            EXPECT_LT(pipelined.totalTimeUs, serial.totalTimeUs);
+        } else {
+            // 数据量不足一个分块时不做流水, 与串行下发的task完全相同
+            EXPECT_EQ(pipelined.taskNum, serial.taskNum);
+            EXPECT_DOUBLE_EQ(pipelined.totalTimeUs, serial.totalTimeUs);
+        }
+    }
+};
+
+TEST_F(AHCPipelineSimTest, ahc_two_uneven_groups)
+{
+    CompareSerialAndPipelined(TemplateType::TEMPLATE_ALL_REDUCE_AHC, {{0, 1, 2}, {3, 4, 5, 6, 7}},
+        AHC_LARGE_COUNT, true);
+}
+
+TEST_F(AHCPipelineSimTest, ahc_three_uneven_groups)
+{
+    CompareSerialAndPipelined(TemplateType::TEMPLATE_ALL_REDUCE_AHC, {{0, 1}, {2, 3, 4}, {5, 6, 7}},
+        AHC_LARGE_COUNT, true);
+}
+
+TEST_F(AHCPipelineSimTest, ahc_broke_two_uneven_groups)
+{
+    CompareSerialAndPipelined(TemplateType::TEMPLATE_ALL_REDUCE_AHC_BROKE, {{0, 1, 2}, {3, 4, 5, 6, 7}},
+        AHC_LARGE_COUNT, true);
+}
+
+TEST_F(AHCPipelineSimTest, ahc_single_rank_group)
+{
+    // 只有一个rank的分组没有组内阶段, 只参与组间allreduce
+    CompareSerialAndPipelined(TemplateType::TEMPLATE_ALL_REDUCE_AHC, {{0}, {1, 2, 3}},
+        AHC_LARGE_COUNT, true);
+}
+
+TEST_F(AHCPipelineSimTest, ahc_small_count_falls_back_to_serial)
+{
+    CompareSerialAndPipelined(TemplateType::TEMPLATE_ALL_REDUCE_AHC, {{0, 1, 2}, {3, 4, 5, 6, 7}},
+        AHC_SMALL_COUNT, false);
+}
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <vector>
+#include "sim_comm.h"
+#include "alg_template_register.h"
+#include "calc_chain_transport_req.h"
+
+using namespace hccl;
+
+/* AlgTemplate经dispatcher/transport适配层在SimEngine上多rank执行, 校验结果与单机计算一致 */
+class AlgTemplateSimTest : public testing::Test {
+protected:
+    static constexpr u64 CCL_SIZE = 1024 * 1024;
+
+    static std::vector<u32> AllRanks(u32 rankSize)
+    {
+        std::vector<u32> ranks(rankSize);
+        std::iota(ranks.begin(), ranks.end(), 0);
+        return ranks;
+    }
+
+    static void FillInput(SimComm &comm, u64 count)
+    {
+        for (u32 rank = 0; rank < comm.GetRankSize(); rank++) {
+            s32 *data = static_cast<s32 *>(comm.GetRank(rank).cclIn.ptr());
+            for (u64 i = 0; i < count; i++) {
+                data[i] = static_cast<s32>(rank * 1000 + i);
+            }
+        }
+    }
+
+    static void RunAllReduceRing(u32 rankSize, u64 count, const std::vector<u32> &serverIds, u64 reduceAttr)
+    {
+        SimComm comm(rankSize, 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE, serverIds), HCCL_SUCCESS);
+        FillInput(comm, count);
+
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            std::unique_ptr<AlgTemplateBase> tempAlg =
+                AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_RING,
+                SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlg, nullptr);
+            ASSERT_EQ(tempAlg->Prepare(reduceAttr), HCCL_SUCCESS);
+            DeviceMem input = res.cclIn.range(0, count * sizeof(s32));
+            DeviceMem output = res.cclOut.range(0, count * sizeof(s32));
+            ASSERT_EQ(tempAlg->Prepare(input, output, output, count, HCCL_DATA_TYPE_INT32, res.mainStream,
+                HCCL_REDUCE_SUM, INVALID_VALUE_RANKID, std::vector<Slice>(0), 0), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->RunAsync(rank, rankSize, comm.GetLinks(rank, AllRanks(rankSize))), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(comm.GetRank(rank).cclOut.ptr());
+            for (u64 i = 0; i < count; i++) {
+                s32 expect = static_cast<s32>(1000 * rankSize * (rankSize - 1) / 2 + rankSize * i);
+                ASSERT_EQ(result[i], expect) << "rank " << rank << " index " << i;
+            }
+        }
+        EXPECT_GT(report.totalTimeUs, 0);
+    }
+
+    static void CheckAllReduceSum(SimComm &comm, u64 count)
+    {
+        u32 rankSize = comm.GetRankSize();
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(comm.GetRank(rank).cclOut.ptr());
+            for (u64 i = 0; i < count; i++) {
+                s32 expect = static_cast<s32>(1000 * rankSize * (rankSize - 1) / 2 + rankSize * i);
+                ASSERT_EQ(result[i], expect) << "rank " << rank << " index " << i;
+            }
+        }
+    }
+
+    /* isParallel为true时两棵树分别在两条从流上执行, 第二棵树使用auxLinks; 否则两棵树在主流上串行 */
+    static void RunAllReduceDBT(u32 rankSize, u64 count, const std::vector<u32> &serverIds, bool isParallel,
+        double &totalTimeUs)
+    {
+        SimComm comm(rankSize, isParallel ? 3 : 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE, serverIds), HCCL_SUCCESS);
+        FillInput(comm, count);
+
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            std::unique_ptr<AlgTemplateBase> tempAlg =
+                AlgTemplateRegistry::Instance().GetAlgTemplate(TemplateType::TEMPLATE_ALL_REDUCE_DBT,
+                SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlg, nullptr);
+            if (isParallel) {
+                std::vector<LINK> secondTreeLinks = comm.GetLinks(rank, AllRanks(rankSize), true);
+                ASSERT_EQ(tempAlg->Prepare(static_cast<u64>(0), res.slaveStreams, res.notifiesMain, res.notifiesAux,
+                    secondTreeLinks), HCCL_SUCCESS);
+            } else {
+                ASSERT_EQ(tempAlg->Prepare(static_cast<u64>(0)), HCCL_SUCCESS);
+            }
+            DeviceMem input = res.cclIn.range(0, count * sizeof(s32));
+            DeviceMem output = res.cclOut.range(0, count * sizeof(s32));
+            ASSERT_EQ(tempAlg->Prepare(input, output, output, count, HCCL_DATA_TYPE_INT32, res.mainStream,
+                HCCL_REDUCE_SUM, INVALID_VALUE_RANKID, std::vector<Slice>(0), 0), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->RunAsync(rank, rankSize, comm.GetLinks(rank, AllRanks(rankSize))), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        CheckAllReduceSum(comm, count);
+        totalTimeUs = report.totalTimeUs;
+    }
+
+    /* 只保留CalcChainTransportReq为该root计算出的对端链路, 校验模板不会用到未建链的对端 */
+    static std::vector<LINK> GetChainLinks(SimComm &comm, u32 rank, u32 root)
+    {
+        u32 rankSize = comm.GetRankSize();
+        std::set<u32> dstRanks;
+        EXPECT_EQ(CalcChainTransportReq::CalcDstRanks(rank, rankSize, root, dstRanks), HCCL_SUCCESS);
+        std::vector<LINK> links = comm.GetLinks(rank, AllRanks(rankSize));
+        for (u32 peer = 0; peer < rankSize; peer++) {
+            if (dstRanks.count(peer) == 0) {
+                links[peer] = nullptr;
+            }
+        }
+        return links;
+    }
+
+    static void RunBroadcastChain(TemplateType type, u32 rankSize, u32 root, u64 count, u32 segmentNum,
+        const std::vector<u32> &serverIds)
+    {
+        SimComm comm(rankSize, 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE, serverIds), HCCL_SUCCESS);
+        FillInput(comm, count);
+
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            std::unique_ptr<AlgTemplateBase> tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(type,
+                SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlg, nullptr);
+            PrepareData prepareData;
+            prepareData.inputMem = res.cclIn.range(0, count * sizeof(s32));
+            prepareData.outputMem = res.cclOut.range(0, count * sizeof(s32));
+            prepareData.scratchMem = prepareData.outputMem;
+            prepareData.count = count;
+            prepareData.dataType = HCCL_DATA_TYPE_INT32;
+            prepareData.stream = res.mainStream;
+            prepareData.root = root;
+            prepareData.segmentNum = segmentNum;
+            ASSERT_EQ(tempAlg->Prepare(prepareData), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->RunAsync(rank, rankSize, GetChainLinks(comm, rank, root)), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(comm.GetRank(rank).cclOut.ptr());
+            for (u64 i = 0; i < count; i++) {
+                ASSERT_EQ(result[i], static_cast<s32>(root * 1000 + i)) << "rank " << rank << " index " << i;
+            }
+        }
+    }
+
+    static void RunReduceChain(TemplateType type, u32 rankSize, u32 root, u64 count, u32 segmentNum,
+        const std::vector<u32> &serverIds)
+    {
+        SimComm comm(rankSize, 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE, serverIds), HCCL_SUCCESS);
+        FillInput(comm, count);
+
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            std::unique_ptr<AlgTemplateBase> tempAlg = AlgTemplateRegistry::Instance().GetAlgTemplate(type,
+                SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlg, nullptr);
+            PrepareData prepareData;
+            prepareData.inputMem = res.cclIn.range(0, count * sizeof(s32));
+            prepareData.outputMem = res.cclOut.range(0, count * sizeof(s32));
+            prepareData.scratchMem = prepareData.outputMem;
+            prepareData.count = count;
+            prepareData.dataType = HCCL_DATA_TYPE_INT32;
+            prepareData.reductionOp = HCCL_REDUCE_SUM;
+            prepareData.stream = res.mainStream;
+            prepareData.root = root;
+            prepareData.segmentNum = segmentNum;
+            ASSERT_EQ(tempAlg->Prepare(prepareData), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlg->RunAsync(rank, rankSize, GetChainLinks(comm, rank, root)), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        const s32 *result = static_cast<const s32 *>(comm.GetRank(root).cclOut.ptr());
+        for (u64 i = 0; i < count; i++) {
+            s32 expect = static_cast<s32>(1000 * rankSize * (rankSize - 1) / 2 + rankSize * i);
+            ASSERT_EQ(result[i], expect) << "root " << root << " index " << i;
+        }
+    }
+};
+
+TEST_F(AlgTemplateSimTest, all_reduce_ring_sdma_inline_reduce)
+{
+    RunAllReduceRing(4, 4096, {}, INLINE_REDUCE_BITMASK);
+}
+
+TEST_F(AlgTemplateSimTest, all_reduce_ring_rdma_odd_rank_size)
+{
+    RunAllReduceRing(5, 3001, {0, 1, 2, 3, 4}, 0);
+}
+
+TEST_F(AlgTemplateSimTest, dbt_depth_is_ceil_log2_of_rank_size)
+{
+    EXPECT_EQ(GetDepthOfDBT(0), 0U);
+    EXPECT_EQ(GetDepthOfDBT(1), 0U);
+    for (u32 rankSize = 2; rankSize <= 130; rankSize++) {
+        u32 expect = static_cast<u32>(std::ceil(std::log2(rankSize)));
+        EXPECT_EQ(GetDepthOfDBT(rankSize), expect) << "rankSize " << rankSize;
+
+        /* 两棵树上任意rank到根的跳数都不超过depth */
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            DBTreeNode trees[DBT_TREE_NUM];
+            GetDoubleBinaryTree(rank, rankSize, trees[0], trees[1]);
+            for (u32 treeIdx = 0; treeIdx < DBT_TREE_NUM; treeIdx++) {
+                u32 hops = 0;
+                DBTreeNode node = trees[treeIdx];
+                while (node.parent != DBT_INVALID_RANK && hops <= expect) {
+                    DBTreeNode parents[DBT_TREE_NUM];
+                    GetDoubleBinaryTree(node.parent, rankSize, parents[0], parents[1]);
+                    node = parents[treeIdx];
+                    hops++;
+                }
+                EXPECT_LE(hops, expect) << "rankSize " << rankSize << " rank " << rank << " tree " << treeIdx;
+            }
+        }
+    }
+}
+
+TEST_F(AlgTemplateSimTest, all_reduce_dbt_odd_rank_size_parallel_trees)
+{
+    double parallelUs = 0;
+    double serialUs = 0;
+    RunAllReduceDBT(5, 100003, {0, 1, 2, 3, 4}, true, parallelUs);
+    RunAllReduceDBT(5, 100003, {0, 1, 2, 3, 4}, false, serialUs);
+    EXPECT_LT(parallelUs, serialUs);
+}
+
+TEST_F(AlgTemplateSimTest, all_reduce_dbt_even_rank_size_parallel_trees)
+{
+    double parallelUs = 0;
+    double serialUs = 0;
+    RunAllReduceDBT(8, 131072, {0, 1, 2, 3, 4, 5, 6, 7}, true, parallelUs);
+    RunAllReduceDBT(8, 131072, {0, 1, 2, 3, 4, 5, 6, 7}, false, serialUs);
+    EXPECT_LT(parallelUs, serialUs);
+}
+
+TEST_F(AlgTemplateSimTest, all_reduce_dbt_sdma_small_count)
+{
+    double totalUs = 0;
+    RunAllReduceDBT(6, 7, {}, true, totalUs);
+    RunAllReduceDBT(2, 1, {}, true, totalUs);
+}
+
+TEST_F(AlgTemplateSimTest, broadcast_chain_odd_rank_size_non_zero_root)
+{
+    RunBroadcastChain(TemplateType::TEMPLATE_BROADCAST_CHAIN, 5, 3, 40001, 4, {0, 1, 2, 3, 4});
+}
+
+TEST_F(AlgTemplateSimTest, broadcast_knomial_even_rank_size_non_zero_root)
+{
+    RunBroadcastChain(TemplateType::TEMPLATE_BROADCAST_KNOMIAL, 8, 5, 40000, 3, {0, 1, 2, 3, 4, 5, 6, 7});
+    RunBroadcastChain(TemplateType::TEMPLATE_BROADCAST_KNOMIAL, 19, 18, 1001, 2, {});
+}
+
+TEST_F(AlgTemplateSimTest, reduce_chain_and_knomial_non_zero_root)
+{
+    RunReduceChain(TemplateType::TEMPLATE_REDUCE_CHAIN, 6, 4, 30001, 5, {0, 1, 2, 3, 4, 5});
+    RunReduceChain(TemplateType::TEMPLATE_REDUCE_KNOMIAL, 7, 2, 30000, 3, {0, 1, 2, 3, 4, 5, 6});
+}
+
+TEST_F(AlgTemplateSimTest, chain_links_are_parent_and_children_of_known_root)
+{
+    const u32 rankSize = 64;
+    for (u32 root = 0; root < rankSize; root += 7) {
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            std::set<u32> dstRanks;
+            ASSERT_EQ(CalcChainTransportReq::CalcDstRanks(rank, rankSize, root, dstRanks), HCCL_SUCCESS);
+            PipelineTreeNode chain;
+            PipelineTreeNode knomial;
+            GetChainTreeNode(rank, rankSize, root, chain);
+            GetKnomialTreeNode(rank, rankSize, root, KNOMIAL_TREE_RADIX, knomial);
+            std::set<u32> expect(chain.children.begin(), chain.children.end());
+            expect.insert(knomial.children.begin(), knomial.children.end());
+            if (rank != root) {
+                expect.insert(chain.parent);
+                expect.insert(knomial.parent);
+            }
+            EXPECT_EQ(dstRanks, expect) << "root " << root << " rank " << rank;
+        }
+    }
+}
+
+TEST_F(AlgTemplateSimTest, pipeline_plan_follows_caller_delay)
+{
+    PipelinePlan lowDelay;
+    PipelinePlan highDelay;
+    const u64 dataSize = 64 * 1024 * 1024;
+    ASSERT_EQ(CalcPipelinePlan(dataSize, 16, 128, 8, 5.0f, lowDelay), HCCL_SUCCESS);
+    ASSERT_EQ(CalcPipelinePlan(dataSize, 16, 128, 8, LINK_STATIC_LATENCY_US * 4, highDelay), HCCL_SUCCESS);
+    EXPECT_GE(lowDelay.segmentNum, highDelay.segmentNum);
+    EXPECT_LT(lowDelay.costUs, highDelay.costUs);
+    PipelinePlan invalid;
+    EXPECT_EQ(CalcPipelinePlan(dataSize, 16, 128, 8, 0.0f, invalid), HCCL_E_PARA);
+}
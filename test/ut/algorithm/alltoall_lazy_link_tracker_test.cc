@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+#include "coll_alg_utils.h"
+#include "alltoall_lazy_link_tracker.h"
+
+using namespace hccl;
+
+namespace {
+/*
+ * 各rank持有自己的AlltoAllLazyLinkTracker和一组mock transport, 每次算子按跟踪器的结论拆链, 再为有数据交互
+ * 但无链路的对端建链。mock transport只有在两端同一次算子中都发起建链时才能连通, 一端拆除后另一端仍持有即为悬空链路
+ */
+class MockLinkMesh {
+public:
+    MockLinkMesh(u32 rankSize, u32 idleLimit, u32 linkBudget) : rankSize_(rankSize), links_(rankSize)
+    {
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            trackers_.emplace_back(rank, rankSize, idleLimit, linkBudget);
+        }
+    }
+
+    /* countMatrix[i * rankSize + j]为rank i发往rank j的数据量, withMatrix为false时按alltoallv下发 */
+    void Run(const std::vector<u64> &countMatrix, bool withMatrix = true)
+    {
+        std::vector<std::set<u32>> connectRequests(rankSize_);
+        for (u32 rank = 0; rank < rankSize_; rank++) {
+            std::vector<u64> sendCounts(rankSize_);
+            std::vector<u64> recvCounts(rankSize_);
+            for (u32 peer = 0; peer < rankSize_; peer++) {
+                sendCounts[peer] = countMatrix[rank * rankSize_ + peer];
+                recvCounts[peer] = countMatrix[peer * rankSize_ + rank];
+            }
+            OpParam param;
+            param.opType = withMatrix ? HcclCMDType::HCCL_CMD_ALLTOALLVC : HcclCMDType::HCCL_CMD_ALLTOALLV;
+            param.All2AllDataDes.sendCounts = sendCounts.data();
+            param.All2AllDataDes.recvCounts = recvCounts.data();
+            param.All2AllDataDes.sendCountMatrix = const_cast<u64 *>(countMatrix.data());
+            std::vector<bool> activePeers;
+            ASSERT_EQ(GetAlltoAllActivePeers(param, rank, rankSize_, activePeers), HCCL_SUCCESS);
+
+            std::vector<bool> releasePeers;
+            ASSERT_EQ(trackers_[rank].Update(activePeers, withMatrix ? countMatrix.data() : nullptr, releasePeers),
+                HCCL_SUCCESS);
+            for (u32 peer = 0; peer < rankSize_; peer++) {
+                if (releasePeers[peer]) {
+                    ASSERT_EQ(links_[rank].erase(peer), 1U) << "rank " << rank << " release absent link " << peer;
+                }
+                if (activePeers[peer] && peer != rank && links_[rank].count(peer) == 0) {
+                    connectRequests[rank].insert(peer);
+                }
+            }
+        }
+        for (u32 rank = 0; rank < rankSize_; rank++) {
+            for (u32 peer : connectRequests[rank]) {
+                ASSERT_EQ(connectRequests[peer].count(rank), 1U) << "rank " << rank << " waits for peer " << peer;
+                links_[rank].insert(peer);
+            }
+        }
+        for (u32 rank = 0; rank < rankSize_; rank++) {
+            ASSERT_EQ(links_[rank].size(), trackers_[rank].GetLinkNum());
+            for (u32 peer : links_[rank]) {
+                ASSERT_EQ(links_[peer].count(rank), 1U) << "dangling link " << rank << " -> " << peer;
+            }
+        }
+    }
+
+    const std::set<u32> &Links(u32 rank) const
+    {
+        return links_[rank];
+    }
+
+private:
+    u32 rankSize_;
+    std::vector<AlltoAllLazyLinkTracker> trackers_;
+    std::vector<std::set<u32>> links_;
+};
+
+std::vector<u64> PairMatrix(u32 rankSize, const std::vector<std::pair<u32, u32>> &pairs)
+{
+    std::vector<u64> countMatrix(rankSize * rankSize, 0);
+    for (const auto &pair : pairs) {
+        countMatrix[pair.first * rankSize + pair.second] = 1;
+    }
+    return countMatrix;
+}
+}
+
+/* AlltoAllLazyLinkTracker在多rank mock transport上运行, 校验按需建链、空闲回收与链路数上限两端一致 */
+class AlltoAllLazyLinkTrackerTest : public testing::Test {
+};
+
+TEST_F(AlltoAllLazyLinkTrackerTest, links_follow_traffic_and_idle_links_are_released_on_both_sides)
+{
+    MockLinkMesh mesh(4, 2, 0);
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}, {2, 3}})));
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({1}));
+    EXPECT_EQ(mesh.Links(2), std::set<u32>({3}));
+
+    /* 只有单方向发送时两端同样建链 */
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}, {3, 0}})));
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({1, 3}));
+    EXPECT_EQ(mesh.Links(2), std::set<u32>({3}));
+
+    /* 2-3连续两次未使用, 两端同时回收 */
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}})));
+    EXPECT_TRUE(mesh.Links(2).empty());
+    EXPECT_EQ(mesh.Links(3), std::set<u32>({0}));
+
+    /* 回收后再次有数据交互时重新建链 */
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{2, 3}})));
+    EXPECT_EQ(mesh.Links(2), std::set<u32>({3}));
+}
+
+TEST_F(AlltoAllLazyLinkTrackerTest, link_budget_evicts_least_recently_used_links_symmetrically)
+{
+    MockLinkMesh mesh(4, 100, 2);
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}})));
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 2}})));
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 3}})));
+    /* rank0超出上限, 回收最久未使用的0-1, rank1侧同步回收 */
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({2, 3}));
+    EXPECT_TRUE(mesh.Links(1).empty());
+}
+
+TEST_F(AlltoAllLazyLinkTrackerTest, links_in_use_are_kept_over_budget)
+{
+    MockLinkMesh mesh(4, 100, 1);
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}, {0, 2}, {0, 3}})));
+    EXPECT_EQ(mesh.Links(0).size(), 3U);
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{2, 0}})));
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({2}));
+}
+
+TEST_F(AlltoAllLazyLinkTrackerTest, random_traffic_keeps_links_symmetric_within_budget)
+{
+    constexpr u32 rankSize = 8;
+    constexpr u32 linkBudget = 3;
+    MockLinkMesh mesh(rankSize, 5, linkBudget);
+    u32 seed = 12345;
+    for (u32 call = 0; call < 200; call++) {
+        std::vector<u64> countMatrix(rankSize * rankSize, 0);
+        std::vector<u32> activeNum(rankSize, 0);
+        for (u32 i = 0; i < rankSize * rankSize; i++) {
+            seed = seed * 1103515245U + 12345U;
+            if (i / rankSize != i % rankSize && (seed >> 16) % 8 == 0) {
+                countMatrix[i] = (seed >> 8) % 1024 + 1;
+            }
+        }
+        ASSERT_NO_FATAL_FAILURE(mesh.Run(countMatrix));
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            u32 inUse = 0;
+            for (u32 peer = 0; peer < rankSize; peer++) {
+                inUse += (countMatrix[rank * rankSize + peer] != 0 || countMatrix[peer * rankSize + rank] != 0);
+            }
+            EXPECT_LE(mesh.Links(rank).size(), std::max(linkBudget, inUse)) << "call " << call << " rank " << rank;
+        }
+    }
+}
+
+TEST_F(AlltoAllLazyLinkTrackerTest, alltoallv_falls_back_to_idle_release_only)
+{
+    MockLinkMesh mesh(4, 3, 1);
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 1}}), false));
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 2}}), true));
+    /* 出现过alltoallv后各rank不再掌握其他rank的链路, 超出上限也不回收 */
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({1, 2}));
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 2}}), true));
+    ASSERT_NO_FATAL_FAILURE(mesh.Run(PairMatrix(4, {{0, 2}}), true));
+    EXPECT_EQ(mesh.Links(0), std::set<u32>({2}));
+    EXPECT_TRUE(mesh.Links(1).empty());
+}
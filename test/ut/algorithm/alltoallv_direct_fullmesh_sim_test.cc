@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "sim_comm.h"
+#include "alg_template_register.h"
+#include "alltoallv_direct_fullmesh_pub.h"
+#include "template_v1_utils.h"
+#include "workflow_pub.h"
+
+using namespace hccl;
+
+namespace {
+// RDMA每个lane收发各两个槽位, 64KB的CCL out下每块16KB, 大块数据需多次ping-pong
+constexpr u64 FULLMESH_CCL_SIZE = 64 * 1024;
+constexpr u32 FULLMESH_MAX_COUNT = 100000;  // 数据按(源rank, 目的rank, 下标)编码, 下标需小于该值
+
+s32 EncodeValue(u32 srcRank, u32 dstRank, u64 idx)
+{
+    return static_cast<s32>(srcRank * 10000000 + dstRank * FULLMESH_MAX_COUNT + idx);
+}
+}
+
+/*
+ * AlltoAllVDirectFullMesh在SimEngine上多server执行: server内走SDMA, 跨server走RDMA槽位ping-pong。
+ * 覆盖倾斜、含零及全零的count矩阵和非对称server, 校验每个rank收到的数据与count矩阵一致,
+ * 并校验算子结束后没有遗留未被wait消费的notify record
+ */
+class AlltoAllVDirectFullMeshSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    }
+
+    // 每个rank只与下一个server上的同位置rank交换大块数据, 其余(源, 目的)对只有少量数据
+    static std::vector<std::vector<u64>> SkewedMatrix(const std::vector<u32> &serverIds, u32 rankPerServer)
+    {
+        u32 rankSize = serverIds.size();
+        std::vector<std::vector<u64>> matrix(rankSize, std::vector<u64>(rankSize, 16));
+        for (u32 src = 0; src < rankSize; src++) {
+            matrix[src][(src + rankPerServer) % rankSize] = FULLMESH_MAX_COUNT - 1;
+            matrix[src][src] = 1;
+        }
+        return matrix;
+    }
+
+    // zeroRatio比例的(源, 目的)对为空, 并令rank 0不发送、最后一个rank不接收
+    static std::vector<std::vector<u64>> ZeroMatrix(u32 rankSize, u64 maxCount, u32 seed, double zeroRatio)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<u64> countDist(1, maxCount);
+        std::uniform_real_distribution<double> zeroDist(0, 1);
+        std::vector<std::vector<u64>> matrix(rankSize, std::vector<u64>(rankSize, 0));
+        for (u32 src = 0; src < rankSize; src++) {
+            for (u32 dst = 0; dst < rankSize; dst++) {
+                bool isZero = (zeroDist(gen) < zeroRatio) || (src == 0) || (dst == rankSize - 1);
+                matrix[src][dst] = isZero ? 0 : countDist(gen);
+            }
+        }
+        return matrix;
+    }
+
+    static void RunFullMesh(const std::vector<std::vector<u64>> &matrix, const std::vector<u32> &serverIds,
+        bool isSuPodAsym, double &totalTimeUs)
+    {
+        u32 rankSize = matrix.size();
+        u32 maxPodSize = 0;
+        for (u32 serverId : serverIds) {
+            maxPodSize = std::max<u32>(maxPodSize, std::count(serverIds.begin(), serverIds.end(), serverId));
+        }
+        u32 sdmaConcurrentNum = std::min(maxPodSize, ALLTOALLV_DIRECT_FULLMESH_SDMA_CONCURRENT_SIZE);
+        u32 streamNum = 1 + 2 * sdmaConcurrentNum + 1 + ALLTOALLV_DIRECT_FULLMESH_RDMA_CONCURRENT_SIZE;
+        SimComm comm(rankSize, streamNum);
+        ASSERT_EQ(comm.Init(FULLMESH_CCL_SIZE, serverIds), HCCL_SUCCESS);
+
+        std::vector<SendRecvInfo> infos(rankSize);
+        std::vector<DeviceMem> sendMems(rankSize);
+        std::vector<DeviceMem> recvMems(rankSize);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SendRecvInfo &info = infos[rank];
+            u64 sendOffset = 0;
+            u64 recvOffset = 0;
+            for (u32 peer = 0; peer < rankSize; peer++) {
+                info.sendLength.push_back(matrix[rank][peer] * sizeof(s32));
+                info.sendOffset.push_back(sendOffset);
+                sendOffset += info.sendLength.back();
+                info.recvLength.push_back(matrix[peer][rank] * sizeof(s32));
+                info.recvOffset.push_back(recvOffset);
+                recvOffset += info.recvLength.back();
+            }
+            sendMems[rank] = DeviceMem::alloc(std::max(sendOffset, 1ULL));
+            recvMems[rank] = DeviceMem::alloc(std::max(recvOffset, 1ULL));
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, sendMems[rank].ptr(), sendMems[rank].size()),
+                HCCL_SUCCESS);
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, recvMems[rank].ptr(), recvMems[rank].size()),
+                HCCL_SUCCESS);
+            s32 *data = static_cast<s32 *>(sendMems[rank].ptr());
+            for (u32 peer = 0; peer < rankSize; peer++) {
+                for (u64 idx = 0; idx < matrix[rank][peer]; idx++) {
+                    data[info.sendOffset[peer] / sizeof(s32) + idx] = EncodeValue(rank, peer, idx);
+                }
+            }
+            std::fill_n(static_cast<s32 *>(recvMems[rank].ptr()), recvMems[rank].size() / sizeof(s32), -1);
+        }
+
+        std::vector<std::unique_ptr<AlgTemplateBase>> tempAlgs(rankSize);
+        std::vector<std::vector<LINK>> links(rankSize);
+        std::vector<u32> allRanks(rankSize);
+        std::iota(allRanks.begin(), allRanks.end(), 0);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            SimRankResource &res = comm.GetRank(rank);
+            links[rank] = comm.GetLinks(rank, allRanks);
+            // 同server的rank连续编号
+            u32 podStart = std::find(serverIds.begin(), serverIds.end(), serverIds[rank]) - serverIds.begin();
+            PrepareData param;
+            param.stream = res.mainStream;
+            param.userRank = rank;
+            param.userRankSize = rankSize;
+            param.linksPtr = &links[rank];
+            param.localSendRecvInfoPtr = &infos[rank];
+            param.devNumInlocalPod = std::count(serverIds.begin(), serverIds.end(), serverIds[rank]);
+            param.rankIdxInPod = rank - podStart;
+            param.opType = HcclCMDType::HCCL_CMD_ALLTOALLV;
+            param.inputMem = sendMems[rank];
+            param.outputMem = recvMems[rank];
+            param.cclInMem = res.cclIn;
+            param.cclOutMem = res.cclOut;
+            param.workMode = HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE;
+            param.isSuPodAsym = isSuPodAsym;
+            param.subStreamsPtr = &res.slaveStreams;
+            param.signalPtr = &res.notifiesMain;
+            param.signalAuxPtr = &res.notifiesAux;
+            tempAlgs[rank] = AlgTemplateRegistry::Instance().GetAlgTemplate(
+                TemplateType::TEMPLATE_ALL_2_ALL_V_DIRECT_FULL_MESH, SimPlatform::GetInstance().GetDispatcher());
+            ASSERT_NE(tempAlgs[rank], nullptr);
+            ASSERT_EQ(tempAlgs[rank]->Prepare(param), HCCL_SUCCESS);
+            ASSERT_EQ(tempAlgs[rank]->RunAsync(), HCCL_SUCCESS);
+        }
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        // 每个notify在算子结束时都应已被消费, 否则下一次算子会提前越过同步点
+        EXPECT_EQ(comm.GetEngine().GetPendingNotifyNum(), 0U);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(recvMems[rank].ptr());
+            for (u32 peer = 0; peer < rankSize; peer++) {
+                u64 base = infos[rank].recvOffset[peer] / sizeof(s32);
+                for (u64 idx = 0; idx < matrix[peer][rank]; idx++) {
+                    ASSERT_EQ(result[base + idx], EncodeValue(peer, rank, idx)) << "rank " << rank << " from " <<
+                        peer << " index " << idx;
+                }
+            }
+        }
+        totalTimeUs = report.totalTimeUs;
+    }
+};
+
+TEST_F(AlltoAllVDirectFullMeshSimTest, skewed_matrix_multi_server)
+{
+    // 大块数据跨越多个RDMA块, 两个槽位需交替使用多轮
+    const std::vector<u32> serverIds = {0, 0, 0, 0, 1, 1, 1, 1};
+    double totalTimeUs = 0;
+    ASSERT_NO_FATAL_FAILURE(RunFullMesh(SkewedMatrix(serverIds, 4), serverIds, false, totalTimeUs));
+    RecordProperty("skewed_2x4_sim_us", std::to_string(totalTimeUs));
+}
+
+TEST_F(AlltoAllVDirectFullMeshSimTest, skewed_matrix_one_rank_per_server)
+{
+    // 每个server只有一个rank时没有SDMA对端, 只走RDMA
+    const std::vector<u32> serverIds = {0, 1, 2, 3};
+    double totalTimeUs = 0;
+    ASSERT_NO_FATAL_FAILURE(RunFullMesh(SkewedMatrix(serverIds, 1), serverIds, false, totalTimeUs));
+    RecordProperty("skewed_4x1_sim_us", std::to_string(totalTimeUs));
+}
+
+TEST_F(AlltoAllVDirectFullMeshSimTest, zero_counts_multi_server)
+{
+    // 只发不收或只收不发的对端只走单向握手, 两端需一致
+    const std::vector<u32> serverIds = {0, 0, 1, 1, 2, 2};
+    for (double zeroRatio : {0.3, 0.7}) {
+        double totalTimeUs = 0;
+        ASSERT_NO_FATAL_FAILURE(RunFullMesh(ZeroMatrix(6, 20000, 17, zeroRatio), serverIds, false, totalTimeUs));
+    }
+}
+
+TEST_F(AlltoAllVDirectFullMeshSimTest, all_zero_matrix)
+{
+    const std::vector<u32> serverIds = {0, 0, 1, 1};
+    double totalTimeUs = 0;
+    std::vector<std::vector<u64>> matrix(4, std::vector<u64>(4, 0));
+    ASSERT_NO_FATAL_FAILURE(RunFullMesh(matrix, serverIds, false, totalTimeUs));
+}
+
+TEST_F(AlltoAllVDirectFullMeshSimTest, asymmetric_servers_with_zero_counts)
+{
+    // 非对称server按rank号选择RDMA槽位, 各rank的通信顺序不一致
+    const std::vector<u32> serverIds = {0, 0, 0, 1, 1};
+    double totalTimeUs = 0;
+    ASSERT_NO_FATAL_FAILURE(RunFullMesh(ZeroMatrix(5, 20000, 23, 0.4), serverIds, true, totalTimeUs));
+    ASSERT_NO_FATAL_FAILURE(RunFullMesh(SkewedMatrix(serverIds, 3), serverIds, true, totalTimeUs));
+}
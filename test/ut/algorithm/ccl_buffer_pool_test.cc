@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "hccl_common.h"
+#include "ccl_buffer_pool.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u64 CCL_BUFFER_SIZE = 200ULL * 1024 * 1024;
+constexpr u64 MOCK_ADDR_BASE = 0x100000000ULL;
+
+/* mock device分配器: 只分配地址不申请内存, 统计向device申请的次数与大小 */
+class MockDeviceAllocator {
+public:
+    CCLBufferPoolAllocFunc Func()
+    {
+        return [this](u64 size) {
+            allocCount_++;
+            allocSize_ += size;
+            DeviceMem mem = DeviceMem::create(reinterpret_cast<void *>(nextAddr_), size);
+            nextAddr_ += size;
+            return mem;
+        };
+    }
+
+    u64 AllocCount() const
+    {
+        return allocCount_;
+    }
+
+    u64 AllocSize() const
+    {
+        return allocSize_;
+    }
+
+private:
+    u64 nextAddr_{MOCK_ADDR_BASE};
+    u64 allocCount_{0};
+    u64 allocSize_{0};
+};
+
+/* 模拟单个通信域的CreateCommCCLbuffer/ReleaseCommCCLbuffer, 从池中租借in/out CCL buffer */
+struct MockComm {
+    DeviceMem inCCLbuffer;
+    DeviceMem outCCLbuffer;
+};
+
+void LeaseComms(CCLBufferPool &pool, std::vector<MockComm> &comms, u64 size)
+{
+    for (MockComm &comm : comms) {
+        ASSERT_EQ(pool.Lease(CCLBufferPoolSlot::IN_CCL_BUFFER, size, comm.inCCLbuffer), HCCL_SUCCESS);
+        ASSERT_EQ(pool.Lease(CCLBufferPoolSlot::OUT_CCL_BUFFER, size, comm.outCCLbuffer), HCCL_SUCCESS);
+    }
+}
+
+void ReturnComms(CCLBufferPool &pool, std::vector<MockComm> &comms)
+{
+    for (MockComm &comm : comms) {
+        ASSERT_EQ(pool.Return(CCLBufferPoolSlot::IN_CCL_BUFFER, comm.inCCLbuffer), HCCL_SUCCESS);
+        ASSERT_EQ(pool.Return(CCLBufferPoolSlot::OUT_CCL_BUFFER, comm.outCCLbuffer), HCCL_SUCCESS);
+    }
+}
+}
+
+/* CCLBufferPool使用mock分配器, 统计不同通信域数下共享前后的device内存峰值与申请次数 */
+class CCLBufferPoolTest : public testing::Test {
+};
+
+TEST_F(CCLBufferPoolTest, shared_buffer_memory_does_not_grow_with_comm_num)
+{
+    for (u32 commNum : {1U, 8U, 64U}) {
+        MockDeviceAllocator allocator;
+        CCLBufferPool pool(allocator.Func());
+        std::vector<MockComm> comms(commNum);
+        ASSERT_NO_FATAL_FAILURE(LeaseComms(pool, comms, CCL_BUFFER_SIZE));
+
+        CCLBufferPoolStat stat = pool.GetStat();
+        u64 unsharedSize = 2 * CCL_BUFFER_SIZE * commNum;
+        EXPECT_EQ(stat.allocCount, 2U) << "commNum " << commNum;
+        EXPECT_EQ(allocator.AllocCount(), 2U) << "commNum " << commNum;
+        EXPECT_EQ(stat.peakReservedSize, 2 * CCL_BUFFER_SIZE) << "commNum " << commNum;
+        EXPECT_EQ(stat.leaseNum, 2 * commNum);
+        for (const MockComm &comm : comms) {
+            EXPECT_EQ(comm.inCCLbuffer.ptr(), comms[0].inCCLbuffer.ptr());
+            EXPECT_EQ(comm.outCCLbuffer.ptr(), comms[0].outCCLbuffer.ptr());
+            EXPECT_NE(comm.inCCLbuffer.ptr(), comm.outCCLbuffer.ptr());
+        }
+        std::string prefix = "comm" + std::to_string(commNum) + "_";
+        RecordProperty(prefix + "pooled_peak_bytes", std::to_string(stat.peakReservedSize));
+        RecordProperty(prefix + "pooled_alloc_count", std::to_string(stat.allocCount));
+        RecordProperty(prefix + "unshared_peak_bytes", std::to_string(unsharedSize));
+        RecordProperty(prefix + "unshared_alloc_count", std::to_string(2 * commNum));
+
+        ASSERT_NO_FATAL_FAILURE(ReturnComms(pool, comms));
+        stat = pool.GetStat();
+        EXPECT_EQ(stat.reservedSize, 0U);
+        EXPECT_EQ(stat.leaseNum, 0U);
+        EXPECT_EQ(stat.leaseCount, 2U * commNum);
+    }
+}
+
+TEST_F(CCLBufferPoolTest, larger_lease_allocates_new_block_and_old_block_is_freed_after_return)
+{
+    MockDeviceAllocator allocator;
+    CCLBufferPool pool(allocator.Func());
+    std::vector<MockComm> smallComms(4);
+    std::vector<MockComm> largeComms(4);
+    ASSERT_NO_FATAL_FAILURE(LeaseComms(pool, smallComms, CCL_BUFFER_SIZE));
+    ASSERT_NO_FATAL_FAILURE(LeaseComms(pool, largeComms, 2 * CCL_BUFFER_SIZE));
+
+    CCLBufferPoolStat stat = pool.GetStat();
+    EXPECT_EQ(stat.allocCount, 4U);
+    EXPECT_EQ(stat.peakReservedSize, 6 * CCL_BUFFER_SIZE);
+    EXPECT_NE(smallComms[0].inCCLbuffer.ptr(), largeComms[0].inCCLbuffer.ptr());
+    EXPECT_EQ(largeComms[0].inCCLbuffer.size(), 2 * CCL_BUFFER_SIZE);
+
+    // 旧块全部归还后释放, 后续较小的租借复用当前的大块
+    ASSERT_NO_FATAL_FAILURE(ReturnComms(pool, smallComms));
+    EXPECT_EQ(pool.GetStat().reservedSize, 4 * CCL_BUFFER_SIZE);
+    ASSERT_NO_FATAL_FAILURE(LeaseComms(pool, smallComms, CCL_BUFFER_SIZE));
+    EXPECT_EQ(smallComms[0].inCCLbuffer.ptr(), largeComms[0].inCCLbuffer.ptr());
+    EXPECT_EQ(smallComms[0].inCCLbuffer.size(), CCL_BUFFER_SIZE);
+    EXPECT_EQ(pool.GetStat().allocCount, 4U);
+
+    ASSERT_NO_FATAL_FAILURE(ReturnComms(pool, smallComms));
+    ASSERT_NO_FATAL_FAILURE(ReturnComms(pool, largeComms));
+    EXPECT_EQ(pool.GetStat().reservedSize, 0U);
+}
+
+TEST_F(CCLBufferPoolTest, invalid_lease_and_return_are_rejected)
+{
+    MockDeviceAllocator allocator;
+    CCLBufferPool pool(allocator.Func());
+    DeviceMem mem;
+    EXPECT_EQ(pool.Lease(CCLBufferPoolSlot::IN_CCL_BUFFER, 0, mem), HCCL_E_PARA);
+    EXPECT_EQ(pool.Lease(CCLBufferPoolSlot::SLOT_NUM, CCL_BUFFER_SIZE, mem), HCCL_E_PARA);
+
+    ASSERT_EQ(pool.Lease(CCLBufferPoolSlot::IN_CCL_BUFFER, CCL_BUFFER_SIZE, mem), HCCL_SUCCESS);
+    EXPECT_EQ(pool.Return(CCLBufferPoolSlot::OUT_CCL_BUFFER, mem), HCCL_E_PARA);
+    ASSERT_EQ(pool.Return(CCLBufferPoolSlot::IN_CCL_BUFFER, mem), HCCL_SUCCESS);
+    EXPECT_EQ(pool.Return(CCLBufferPoolSlot::IN_CCL_BUFFER, mem), HCCL_E_PARA);
+}
+
+TEST_F(CCLBufferPoolTest, get_instance_rejects_invalid_device)
+{
+    CCLBufferPool *pool = nullptr;
+    EXPECT_EQ(CCLBufferPool::GetInstance(-1, pool), HCCL_E_PARA);
+    EXPECT_EQ(CCLBufferPool::GetInstance(static_cast<s32>(MAX_MODULE_DEVICE_NUM), pool), HCCL_E_PARA);
+    EXPECT_EQ(pool, nullptr);
+    ASSERT_EQ(CCLBufferPool::GetInstance(0, pool), HCCL_SUCCESS);
+    CCLBufferPool *samePool = nullptr;
+    ASSERT_EQ(CCLBufferPool::GetInstance(0, samePool), HCCL_SUCCESS);
+    EXPECT_EQ(pool, samePool);
+}
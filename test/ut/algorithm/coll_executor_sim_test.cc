@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "sim_executor_runner.h"
+#include "workflow_pub.h"
+
+using namespace hccl;
+
+/* CollExecutor经SimExecutorRunner在SimEngine上多rank执行, 覆盖单算子模式下CCL buffer分片循环 */
+class CollExecutorSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    }
+
+    static void RunAllReduce(const std::string &executorName, const AlgType &algType, u32 rankSize,
+        const std::vector<u32> &serverIds, u64 cclSize, u64 count, u32 streamNum = 1)
+    {
+        SimComm comm(rankSize, streamNum);
+        ASSERT_EQ(comm.Init(cclSize, serverIds), HCCL_SUCCESS);
+
+        std::vector<DeviceMem> userIn(rankSize);
+        std::vector<DeviceMem> userOut(rankSize);
+        std::vector<OpParam> params(rankSize);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            userIn[rank] = DeviceMem::alloc(count * sizeof(s32));
+            userOut[rank] = DeviceMem::alloc(count * sizeof(s32));
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userIn[rank].ptr(), userIn[rank].size()),
+                HCCL_SUCCESS);
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userOut[rank].ptr(), userOut[rank].size()),
+                HCCL_SUCCESS);
+            s32 *data = static_cast<s32 *>(userIn[rank].ptr());
+            for (u64 i = 0; i < count; i++) {
+                data[i] = static_cast<s32>(rank * 1000 + i);
+            }
+
+            OpParam &param = params[rank];
+            param.tag = "AllReduce_sim";
+            param.inputPtr = userIn[rank].ptr();
+            param.inputSize = userIn[rank].size();
+            param.outputPtr = userOut[rank].ptr();
+            param.outputSize = userOut[rank].size();
+            param.DataDes.count = count;
+            param.DataDes.dataType = HCCL_DATA_TYPE_INT32;
+            param.reduceType = HCCL_REDUCE_SUM;
+            param.opType = HcclCMDType::HCCL_CMD_ALLREDUCE;
+        }
+
+        SimExecutorRunner runner(comm, serverIds);
+        ASSERT_EQ(runner.Orchestrate(executorName, algType, params), HCCL_SUCCESS);
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(userOut[rank].ptr());
+            for (u64 i = 0; i < count; i++) {
+                s32 expect = static_cast<s32>(1000 * rankSize * (rankSize - 1) / 2 + rankSize * i);
+                ASSERT_EQ(result[i], expect) << "rank " << rank << " index " << i;
+            }
+        }
+        EXPECT_GT(report.totalTimeUs, 0);
+    }
+};
+
+TEST_F(CollExecutorSimTest, all_reduce_ring_executor_single_server)
+{
+    RunAllReduce("AllReduceRingExecutor",
+        AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_RING),
+        4, {}, 64 * 1024, 8192);
+}
+
+TEST_F(CollExecutorSimTest, all_reduce_ring_executor_multi_server_loops_over_ccl_buffer)
+{
+    /* 160KB数据经64KB CCL buffer分三轮搬运, server间走RDMA ring */
+    RunAllReduce("AllReduceRingExecutor",
+        AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_RING),
+        4, {0, 0, 1, 1}, 64 * 1024, 40000);
+}
+
+TEST_F(CollExecutorSimTest, all_reduce_ring_executor_dbt_odd_server_num)
+{
+    /* 3个server走双二叉树, 两棵树各占一条从流并使用独立的link */
+    RunAllReduce("AllReduceRingExecutor",
+        AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_DBT),
+        6, {0, 0, 1, 1, 2, 2}, 256 * 1024, 100000, 3);
+}
+
+TEST_F(CollExecutorSimTest, all_reduce_ring_executor_dbt_even_server_num)
+{
+    RunAllReduce("AllReduceRingExecutor",
+        AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_DBT),
+        4, {0, 1, 2, 3}, 1024 * 1024, 200000, 3);
+}
+
+TEST_F(CollExecutorSimTest, all_reduce_ring_executor_resolve_once_launch_repeatedly)
+{
+    /* 持久化算子的执行方式: 只解析一次executor与资源, 每次下发重新编排task; 各次下发的task序列应完全一致 */
+    constexpr u32 rankSize = 4;
+    constexpr u64 count = 40000;
+    constexpr u32 launchNum = 5;
+    const std::vector<u32> serverIds = {0, 0, 1, 1};
+    const AlgType algType(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_RING);
+    SimComm comm(rankSize, 1);
+    ASSERT_EQ(comm.Init(64 * 1024, serverIds), HCCL_SUCCESS);
+
+    std::vector<DeviceMem> userIn(rankSize);
+    std::vector<DeviceMem> userOut(rankSize);
+    std::vector<OpParam> params(rankSize);
+    for (u32 rank = 0; rank < rankSize; rank++) {
+        userIn[rank] = DeviceMem::alloc(count * sizeof(s32));
+        userOut[rank] = DeviceMem::alloc(count * sizeof(s32));
+        ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userIn[rank].ptr(), userIn[rank].size()),
+            HCCL_SUCCESS);
+        ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userOut[rank].ptr(), userOut[rank].size()),
+            HCCL_SUCCESS);
+        OpParam &param = params[rank];
+        param.tag = "AllReduce_persistent";
+        param.inputPtr = userIn[rank].ptr();
+        param.inputSize = userIn[rank].size();
+        param.outputPtr = userOut[rank].ptr();
+        param.outputSize = userOut[rank].size();
+        param.DataDes.count = count;
+        param.DataDes.dataType = HCCL_DATA_TYPE_INT32;
+        param.reduceType = HCCL_REDUCE_SUM;
+        param.opType = HcclCMDType::HCCL_CMD_ALLREDUCE;
+    }
+
+    SimExecutorRunner runner(comm, serverIds);
+    auto resolveStart = std::chrono::steady_clock::now();
+    ASSERT_EQ(runner.Resolve("AllReduceRingExecutor", algType, params), HCCL_SUCCESS);
+    auto resolveTime = std::chrono::steady_clock::now() - resolveStart;
+
+    std::vector<std::vector<SimTaskRecord>> launchRecords(launchNum);
+    std::chrono::steady_clock::duration launchTime{0};
+    for (u32 launch = 0; launch < launchNum; launch++) {
+        // 两次下发之间只改变buffer内容, 地址不变
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            s32 *data = static_cast<s32 *>(userIn[rank].ptr());
+            for (u64 i = 0; i < count; i++) {
+                data[i] = static_cast<s32>(launch * 7 + rank * 1000 + i);
+            }
+        }
+        comm.GetEngine().SetTaskRecords(&launchRecords[launch]);
+        auto launchStart = std::chrono::steady_clock::now();
+        ASSERT_EQ(runner.Launch(params), HCCL_SUCCESS);
+        launchTime += std::chrono::steady_clock::now() - launchStart;
+        comm.GetEngine().SetTaskRecords(nullptr);
+
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        EXPECT_EQ(report.taskNum, launchRecords[launch].size());
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *result = static_cast<const s32 *>(userOut[rank].ptr());
+            for (u64 i = 0; i < count; i++) {
+                s32 expect = static_cast<s32>(rankSize * launch * 7 + 1000 * rankSize * (rankSize - 1) / 2 +
+                    rankSize * i);
+                ASSERT_EQ(result[i], expect) << "launch " << launch << " rank " << rank << " index " << i;
+            }
+        }
+    }
+
+    ASSERT_FALSE(launchRecords[0].empty());
+    for (u32 launch = 1; launch < launchNum; launch++) {
+        ASSERT_EQ(launchRecords[launch].size(), launchRecords[0].size()) << "launch " << launch;
+        for (u64 idx = 0; idx < launchRecords[0].size(); idx++) {
+            ASSERT_TRUE(launchRecords[launch][idx] == launchRecords[0][idx]) << "launch " << launch <<
+                " task " << idx;
+        }
+    }
+
+    auto toUs = [](std::chrono::steady_clock::duration time) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    };
+    RecordProperty("task_num_per_launch", std::to_string(launchRecords[0].size()));
+    RecordProperty("resolve_us", std::to_string(toUs(resolveTime)));
+    RecordProperty("launch_us_per_start", std::to_string(toUs(launchTime) / launchNum));
+}
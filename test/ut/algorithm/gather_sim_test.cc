@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "sim_executor_runner.h"
+#include "workflow_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 GATHER_SIM_STREAM_NUM = 8;
+}
+
+struct GatherRunResult {
+    double timeUs{0};
+    u64 taskNum{0};
+};
+
+/* Gather executor经SimExecutorRunner多rank执行, 覆盖任意root、server卡数不一致与CCL buffer分片循环 */
+class GatherSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    }
+
+    static void RunGather(const std::string &executorName, const std::vector<u32> &serverIds, u64 cclSize,
+        u64 count, u32 root, GatherRunResult &result, AlgTypeLevel1 level1 = AlgTypeLevel1::ALG_LEVEL1_RING)
+    {
+        u32 rankSize = serverIds.size();
+        SimComm comm(rankSize, GATHER_SIM_STREAM_NUM);
+        ASSERT_EQ(comm.Init(cclSize, serverIds), HCCL_SUCCESS);
+
+        std::vector<DeviceMem> userIn(rankSize);
+        DeviceMem userOut = DeviceMem::alloc(count * sizeof(s32) * rankSize);
+        ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(root, userOut.ptr(), userOut.size()), HCCL_SUCCESS);
+        std::vector<OpParam> params(rankSize);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            userIn[rank] = DeviceMem::alloc(count * sizeof(s32));
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userIn[rank].ptr(), userIn[rank].size()),
+                HCCL_SUCCESS);
+            s32 *data = static_cast<s32 *>(userIn[rank].ptr());
+            for (u64 i = 0; i < count; i++) {
+                data[i] = static_cast<s32>(rank * 100000 + i);
+            }
+
+            OpParam &param = params[rank];
+            param.tag = "Gather_sim";
+            param.inputPtr = userIn[rank].ptr();
+            param.inputSize = userIn[rank].size();
+            param.outputPtr = (rank == root) ? userOut.ptr() : nullptr;
+            param.outputSize = (rank == root) ? userOut.size() : 0;
+            param.DataDes.count = count;
+            param.DataDes.dataType = HCCL_DATA_TYPE_INT32;
+            param.root = root;
+            param.opType = HcclCMDType::HCCL_CMD_GATHER;
+        }
+
+        SimExecutorRunner runner(comm, serverIds);
+        ASSERT_EQ(runner.Orchestrate(executorName, AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_MESH, level1), params),
+            HCCL_SUCCESS);
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        const s32 *output = static_cast<const s32 *>(userOut.ptr());
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            for (u64 i = 0; i < count; i++) {
+                ASSERT_EQ(output[rank * count + i], static_cast<s32>(rank * 100000 + i)) << executorName <<
+                    " root " << root << " rank " << rank << " index " << i;
+            }
+        }
+        result.timeUs = report.totalTimeUs;
+        result.taskNum = report.taskNum;
+    }
+
+    static void RunAllRoots(const std::string &executorName, const std::vector<u32> &serverIds, u64 cclSize,
+        u64 count, AlgTypeLevel1 level1 = AlgTypeLevel1::ALG_LEVEL1_RING)
+    {
+        for (u32 root = 0; root < serverIds.size(); root++) {
+            GatherRunResult result;
+            RunGather(executorName, serverIds, cclSize, count, root, result, level1);
+            if (HasFatalFailure()) {
+                return;
+            }
+            EXPECT_GT(result.timeUs, 0);
+        }
+    }
+};
+
+TEST_F(GatherSimTest, gather_mesh_even_servers_all_roots)
+{
+    /* 2个4卡server, 数据经16KB CCL buffer双buffer多轮搬运 */
+    RunAllRoots("GatherMeshExecutor", {0, 0, 0, 0, 1, 1, 1, 1}, 16 * 1024, 3000);
+}
+
+TEST_F(GatherSimTest, gather_comm_uneven_servers_all_roots)
+{
+    RunAllRoots("GatherCommExecutor", {0, 0, 0, 1, 1, 1, 1, 1}, 16 * 1024, 3000);
+}
+
+TEST_F(GatherSimTest, gather_asym_two_uneven_servers_all_roots)
+{
+    /* 3+5卡, root在小server且序号超出大server卡数时代表rank取server内最后一个rank */
+    RunAllRoots("GatherAsymExecutor", {0, 0, 0, 1, 1, 1, 1, 1}, 16 * 1024, 3000);
+}
+
+TEST_F(GatherSimTest, gather_asym_three_uneven_servers_all_roots)
+{
+    RunAllRoots("GatherAsymExecutor", {0, 0, 1, 1, 1, 2, 2, 2, 2}, 32 * 1024, 5000);
+}
+
+TEST_F(GatherSimTest, gather_asym_single_rank_server_all_roots)
+{
+    RunAllRoots("GatherAsymExecutor", {0, 1, 1, 1, 1}, 16 * 1024, 3000);
+}
+
+TEST_F(GatherSimTest, gather_asym_star_three_uneven_servers_all_roots)
+{
+    RunAllRoots("GatherAsymExecutor", {0, 0, 1, 1, 1, 2, 2, 2, 2}, 32 * 1024, 5000, AlgTypeLevel1::ALG_LEVEL1_STAR);
+}
+
+TEST_F(GatherSimTest, gather_asym_star_even_servers_all_roots)
+{
+    /* 卡数一致的小数据同样按server划分走STAR */
+    RunAllRoots("GatherAsymExecutor", {0, 0, 0, 0, 1, 1, 1, 1}, 16 * 1024, 3000, AlgTypeLevel1::ALG_LEVEL1_STAR);
+}
+
+TEST_F(GatherSimTest, gather_asym_single_loop)
+{
+    /* 数据一轮放得下时root一次拷出整个CCL buffer */
+    GatherRunResult result;
+    RunGather("GatherAsymExecutor", {0, 0, 0, 1, 1, 1, 1, 1}, 1024 * 1024, 1000, 4, result);
+}
+
+TEST_F(GatherSimTest, gather_asym_beats_flat_ring_on_uneven_servers)
+{
+    /* 3+5卡小包: 分层只有一跳RDMA, 全局单环需逐跳转发 */
+    const std::vector<u32> serverIds = {0, 0, 0, 1, 1, 1, 1, 1};
+    constexpr u64 count = 256;
+    GatherRunResult flat;
+    GatherRunResult ring;
+    GatherRunResult star;
+    RunGather("GatherCommExecutor", serverIds, 1024 * 1024, count, 1, flat);
+    RunGather("GatherAsymExecutor", serverIds, 1024 * 1024, count, 1, ring);
+    RunGather("GatherAsymExecutor", serverIds, 1024 * 1024, count, 1, star, AlgTypeLevel1::ALG_LEVEL1_STAR);
+    ASSERT_FALSE(HasFatalFailure());
+    EXPECT_LT(ring.timeUs, flat.timeUs);
+    EXPECT_LT(star.timeUs, flat.timeUs);
+    RecordProperty("flat_ring_us", std::to_string(flat.timeUs));
+    RecordProperty("asym_ring_us", std::to_string(ring.timeUs));
+    RecordProperty("asym_star_us", std::to_string(star.timeUs));
+}
+
+TEST_F(GatherSimTest, gather_asym_star_beats_leader_ring_on_small_message)
+{
+    /* 4个server时代表rank成环需要3跳RDMA, STAR只需一跳 */
+    const std::vector<u32> serverIds = {0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 3};
+    constexpr u64 count = 256;
+    GatherRunResult ring;
+    GatherRunResult star;
+    RunGather("GatherAsymExecutor", serverIds, 1024 * 1024, count, 1, ring);
+    RunGather("GatherAsymExecutor", serverIds, 1024 * 1024, count, 1, star, AlgTypeLevel1::ALG_LEVEL1_STAR);
+    ASSERT_FALSE(HasFatalFailure());
+    EXPECT_LT(star.timeUs, ring.timeUs);
+    RecordProperty("leader_ring_us", std::to_string(ring.timeUs));
+    RecordProperty("leader_star_us", std::to_string(star.timeUs));
+}
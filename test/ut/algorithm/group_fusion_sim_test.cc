@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "sim_executor_runner.h"
+#include "op_base_group_plan.h"
+#include "workflow_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 RANK_SIZE = 4;
+constexpr u32 OP_NUM = 64;
+constexpr u64 CCL_SIZE = 1024 * 1024;
+const AlgType RING_ALG_TYPE(AlgTypeLevel0::ALG_LEVEL0_NP_SINGLE_RING, AlgTypeLevel1::ALG_LEVEL1_RING);
+
+struct GroupSimResult {
+    double modelledUs = 0;
+    s64 hostUs = 0;
+    u32 launchNum = 0;
+};
+}
+
+/*
+ * HcclGroupEnd的融合下发在SimEngine上的端到端验证: 按BuildGroupLaunchPlan的计划拷入融合buffer、
+ * 对融合buffer执行一次AllReduce、再拷回各算子输出, 与逐个下发的结果逐元素比对, 并比较host耗时与仿真时延
+ */
+class GroupFusionSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+        for (u32 i = 0; i < OP_NUM; i++) {
+            GroupOpRecord record;
+            record.cmdType = HcclCMDType::HCCL_CMD_ALLREDUCE;
+            record.count = 256 + i * 37;    // 各算子长度不同, 覆盖拼接时的偏移
+            record.dataType = HCCL_DATA_TYPE_INT32;
+            record.op = HCCL_REDUCE_SUM;
+            ops_.push_back(record);
+        }
+    }
+
+    // 各rank每个算子的输入输出buffer, 并登记到仿真平台
+    HcclResult PrepareBuffers()
+    {
+        userIn_.assign(RANK_SIZE, std::vector<DeviceMem>(OP_NUM));
+        userOut_.assign(RANK_SIZE, std::vector<DeviceMem>(OP_NUM));
+        for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+            for (u32 i = 0; i < OP_NUM; i++) {
+                u64 size = GetGroupOpSize(ops_[i]);
+                userIn_[rank][i] = DeviceMem::alloc(size);
+                userOut_[rank][i] = DeviceMem::alloc(size);
+                CHK_RET(SimPlatform::GetInstance().RegisterMem(rank, userIn_[rank][i].ptr(), size));
+                CHK_RET(SimPlatform::GetInstance().RegisterMem(rank, userOut_[rank][i].ptr(), size));
+                s32 *data = static_cast<s32 *>(userIn_[rank][i].ptr());
+                for (u64 idx = 0; idx < ops_[i].count; idx++) {
+                    data[idx] = static_cast<s32>(rank * 100000 + i * 1000 + idx);
+                }
+            }
+        }
+        return HCCL_SUCCESS;
+    }
+
+    static HcclResult IssueAllReduce(SimComm &comm, const std::vector<void *> &inputs,
+        const std::vector<void *> &outputs, u64 count, const std::string &tag)
+    {
+        std::vector<OpParam> params(RANK_SIZE);
+        for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+            OpParam &param = params[rank];
+            param.tag = tag;
+            param.inputPtr = inputs[rank];
+            param.inputSize = count * sizeof(s32);
+            param.outputPtr = outputs[rank];
+            param.outputSize = count * sizeof(s32);
+            param.DataDes.count = count;
+            param.DataDes.dataType = HCCL_DATA_TYPE_INT32;
+            param.reduceType = HCCL_REDUCE_SUM;
+            param.opType = HcclCMDType::HCCL_CMD_ALLREDUCE;
+        }
+        SimExecutorRunner runner(comm, {});
+        return runner.Orchestrate("AllReduceRingExecutor", RING_ALG_TYPE, params);
+    }
+
+    void RunPerOp(GroupSimResult &result)
+    {
+        SimComm comm(RANK_SIZE, 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE), HCCL_SUCCESS);
+        ASSERT_EQ(PrepareBuffers(), HCCL_SUCCESS);
+        auto startTime = std::chrono::steady_clock::now();
+        for (u32 i = 0; i < OP_NUM; i++) {
+            std::vector<void *> inputs;
+            std::vector<void *> outputs;
+            for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+                inputs.push_back(userIn_[rank][i].ptr());
+                outputs.push_back(userOut_[rank][i].ptr());
+            }
+            ASSERT_EQ(IssueAllReduce(comm, inputs, outputs, ops_[i].count, "AllReduce_op" + std::to_string(i)),
+                HCCL_SUCCESS);
+        }
+        result.hostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        result.launchNum = OP_NUM;
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        result.modelledUs = report.totalTimeUs;
+        CheckOutputs();
+    }
+
+    void RunGrouped(GroupSimResult &result)
+    {
+        SimComm comm(RANK_SIZE, 1);
+        ASSERT_EQ(comm.Init(CCL_SIZE), HCCL_SUCCESS);
+        ASSERT_EQ(PrepareBuffers(), HCCL_SUCCESS);
+        std::vector<DeviceMem> fusionMems(RANK_SIZE);
+        for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+            fusionMems[rank] = DeviceMem::alloc(GROUP_FUSION_MAX_SIZE);
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, fusionMems[rank].ptr(), fusionMems[rank].size()),
+                HCCL_SUCCESS);
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<GroupLaunch> plan;
+        ASSERT_EQ(BuildGroupLaunchPlan(ops_, plan), HCCL_SUCCESS);
+        for (u32 launchIdx = 0; launchIdx < plan.size(); launchIdx++) {
+            const GroupLaunch &launch = plan[launchIdx];
+            std::vector<void *> inputs;
+            std::vector<void *> outputs;
+            // 与IssueFusedGroupOps一致: 在主流上拷入融合buffer, 原地AllReduce, 再拷回
+            for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+                u8 *fusionPtr = static_cast<u8 *>(fusionMems[rank].ptr());
+                u64 offset = 0;
+                for (u32 index : launch.opIndexes) {
+                    u64 size = GetGroupOpSize(ops_[index]);
+                    ASSERT_EQ(comm.GetEngine().Memcpy(rank, 0, rank, fusionPtr + offset, userIn_[rank][index].ptr(),
+                        size), HCCL_SUCCESS);
+                    offset += size;
+                }
+                inputs.push_back(fusionPtr);
+                outputs.push_back(fusionPtr);
+            }
+            ASSERT_EQ(IssueAllReduce(comm, inputs, outputs, launch.size / sizeof(s32),
+                "AllReduce_fused" + std::to_string(launchIdx)), HCCL_SUCCESS);
+            for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+                u8 *fusionPtr = static_cast<u8 *>(fusionMems[rank].ptr());
+                u64 offset = 0;
+                for (u32 index : launch.opIndexes) {
+                    u64 size = GetGroupOpSize(ops_[index]);
+                    ASSERT_EQ(comm.GetEngine().Memcpy(rank, 0, rank, userOut_[rank][index].ptr(), fusionPtr + offset,
+                        size), HCCL_SUCCESS);
+                    offset += size;
+                }
+            }
+        }
+        result.hostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        result.launchNum = plan.size();
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        result.modelledUs = report.totalTimeUs;
+        CheckOutputs();
+    }
+
+    void CheckOutputs() const
+    {
+        for (u32 rank = 0; rank < RANK_SIZE; rank++) {
+            for (u32 i = 0; i < OP_NUM; i++) {
+                const s32 *result = static_cast<const s32 *>(userOut_[rank][i].ptr());
+                for (u64 idx = 0; idx < ops_[i].count; idx++) {
+                    s32 expect = static_cast<s32>(100000 * RANK_SIZE * (RANK_SIZE - 1) / 2 +
+                        RANK_SIZE * (i * 1000 + idx));
+                    ASSERT_EQ(result[idx], expect) << "rank " << rank << " op " << i << " index " << idx;
+                }
+            }
+        }
+    }
+
+    std::vector<GroupOpRecord> ops_;
+    std::vector<std::vector<DeviceMem>> userIn_;
+    std::vector<std::vector<DeviceMem>> userOut_;
+};
+
+TEST_F(GroupFusionSimTest, fused_group_matches_per_op_and_reduces_latency)
+{
+    GroupSimResult perOp;
+    GroupSimResult grouped;
+    ASSERT_NO_FATAL_FAILURE(RunPerOp(perOp));
+    ASSERT_NO_FATAL_FAILURE(RunGrouped(grouped));
+
+    EXPECT_EQ(grouped.launchNum, 1U);
+    EXPECT_LT(grouped.modelledUs, perOp.modelledUs);
+    RecordProperty("op_num", std::to_string(OP_NUM));
+    RecordProperty("per_op_host_us", std::to_string(perOp.hostUs));
+    RecordProperty("grouped_host_us", std::to_string(grouped.hostUs));
+    RecordProperty("per_op_modelled_us", std::to_string(perOp.modelledUs));
+    RecordProperty("grouped_modelled_us", std::to_string(grouped.modelledUs));
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "externalinput_pub.h"
+#include "hccl_socket_manager.h"
+
+using namespace hccl;
+
+namespace {
+constexpr s32 LINK_TIMEOUT_DEFAULT_S = 120;
+constexpr u32 LISTEN_PORT = 60000;
+}
+
+/* HcclSocketManager在本地回环socket桩上建链: socket在Init后经过设定时长才建链完成, 用于校验等待逻辑 */
+class HcclSocketManagerTest : public testing::Test {
+protected:
+    void TearDown() override
+    {
+        HcclSocket::SetEstablishDelay(std::chrono::microseconds(0));
+        SetExternalInputHcclLinkTimeOut(LINK_TIMEOUT_DEFAULT_S);
+    }
+
+    static std::vector<std::shared_ptr<HcclSocket>> MakeSockets(u32 socketNum)
+    {
+        std::vector<std::shared_ptr<HcclSocket>> sockets;
+        for (u32 i = 0; i < socketNum; i++) {
+            auto socket = std::make_shared<HcclSocket>("sock_" + std::to_string(i), nullptr,
+                HcclIpAddress("10.0.0." + std::to_string(i)), LISTEN_PORT, HcclSocketRole::SOCKET_ROLE_CLIENT);
+            EXPECT_EQ(socket->Init(), HCCL_SUCCESS);
+            sockets.push_back(socket);
+        }
+        return sockets;
+    }
+
+    static HcclRankLinkInfo MakeLinkInfo(u32 rank)
+    {
+        HcclRankLinkInfo info{};
+        info.userRank = rank;
+        info.devicePhyId = rank;
+        info.ip = HcclIpAddress("10.0.1." + std::to_string(rank));
+        info.port = LISTEN_PORT;
+        info.socketsPerLink = 1;
+        return info;
+    }
+
+    // 本端rank居中, 编号小的对端作为服务端、编号大的对端作为客户端
+    static void MakePeerMaps(u32 localRank, u32 peerNum, std::map<u32, HcclRankLinkInfo> &dstServerMap,
+        std::map<u32, HcclRankLinkInfo> &dstClientMap)
+    {
+        for (u32 rank = 0; rank <= peerNum; rank++) {
+            if (rank < localRank) {
+                dstServerMap.insert(std::make_pair(rank, MakeLinkInfo(rank)));
+            } else if (rank > localRank) {
+                dstClientMap.insert(std::make_pair(rank, MakeLinkInfo(rank)));
+            }
+        }
+    }
+
+    // 模拟groupNum个通信域(各自一个socketManager)与相同的peerNum个对端建链, 返回建链后的socketManager
+    static std::vector<std::unique_ptr<HcclSocketManager>> CreateGroups(u32 groupNum, u32 peerNum,
+        const std::string &shareKey, std::vector<std::vector<std::shared_ptr<HcclSocket>>> &groupSockets)
+    {
+        const u32 localRank = peerNum / 2;
+        std::map<u32, HcclRankLinkInfo> dstServerMap;
+        std::map<u32, HcclRankLinkInfo> dstClientMap;
+        MakePeerMaps(localRank, peerNum, dstServerMap, dstClientMap);
+        std::vector<std::unique_ptr<HcclSocketManager>> managers;
+        groupSockets.assign(groupNum, {});
+        for (u32 group = 0; group < groupNum; group++) {
+            managers.emplace_back(new HcclSocketManager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, localRank,
+                localRank));
+            EXPECT_EQ(managers.back()->SetSocketShareKey(shareKey), HCCL_SUCCESS);
+            std::map<u32, std::vector<std::shared_ptr<HcclSocket>>> serverSocketsMap;
+            std::map<u32, std::vector<std::shared_ptr<HcclSocket>>> clientSocketsMap;
+            EXPECT_EQ(managers.back()->CreateSockets("group_" + std::to_string(group), false, nullptr,
+                dstServerMap, dstClientMap, serverSocketsMap, clientSocketsMap, true), HCCL_SUCCESS);
+            EXPECT_EQ(serverSocketsMap.size() + clientSocketsMap.size(), peerNum);
+            for (auto *socketsMap : {&serverSocketsMap, &clientSocketsMap}) {
+                for (auto &iter : *socketsMap) {
+                    groupSockets[group].insert(groupSockets[group].end(), iter.second.begin(), iter.second.end());
+                }
+            }
+        }
+        return managers;
+    }
+};
+
+TEST_F(HcclSocketManagerTest, shared_key_reuses_links_across_groups)
+{
+    /* 256个通信域各与4个对端建链, 建链耗时100us: 共享key相同时只有第一个通信域真正建链 */
+    constexpr u32 groupNum = 256;
+    constexpr u32 peerNum = 4;
+    HcclSocket::SetEstablishDelay(std::chrono::microseconds(100));
+    u32 baseSocketNum = HcclSocket::GetOpenSocketNum();
+    HcclSocketManager listenManager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    ASSERT_EQ(listenManager.ServerInit(nullptr, LISTEN_PORT), HCCL_SUCCESS);
+
+    std::vector<std::vector<std::shared_ptr<HcclSocket>>> groupSockets;
+    auto startTime = std::chrono::steady_clock::now();
+    auto managers = CreateGroups(groupNum, peerNum, "", groupSockets);
+    auto unsharedTime = std::chrono::steady_clock::now() - startTime;
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, groupNum * peerNum + 1);
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 0U);
+    managers.clear();
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, 1U);
+
+    startTime = std::chrono::steady_clock::now();
+    managers = CreateGroups(groupNum, peerNum, "parent_comm", groupSockets);
+    auto sharedTime = std::chrono::steady_clock::now() - startTime;
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum + 1);
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), peerNum);
+    for (u32 group = 1; group < groupNum; group++) {
+        EXPECT_EQ(groupSockets[group], groupSockets[0]);
+    }
+    RecordProperty("unshared_setup_us",
+        std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(unsharedTime).count()));
+    RecordProperty("shared_setup_us",
+        std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(sharedTime).count()));
+
+    managers.clear();
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 0U);
+    ASSERT_EQ(listenManager.ServerDeInit(nullptr, LISTEN_PORT), HCCL_SUCCESS);
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum(), baseSocketNum);
+}
+
+TEST_F(HcclSocketManagerTest, pooled_link_closes_after_last_release)
+{
+    constexpr u32 groupNum = 3;
+    constexpr u32 peerNum = 2;
+    u32 baseSocketNum = HcclSocket::GetOpenSocketNum();
+    std::vector<std::vector<std::shared_ptr<HcclSocket>>> groupSockets;
+    auto managers = CreateGroups(groupNum, peerNum, "parent_comm", groupSockets);
+    ASSERT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum);
+
+    // 建链的通信域先销毁, 其余通信域仍持有连接
+    managers[0]->DestroySockets("group_0");
+    managers[0].reset();
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum);
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), peerNum);
+
+    // 仍有引用时, 新通信域可以继续复用
+    auto pooledSockets = groupSockets[1];
+    managers.emplace_back(std::move(CreateGroups(1, peerNum, "parent_comm", groupSockets)[0]));
+    EXPECT_EQ(groupSockets[0], pooledSockets);
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum);
+
+    managers[1].reset();
+    managers[2].reset();
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum);
+    managers[3].reset();
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 0U);
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum(), baseSocketNum);
+}
+
+TEST_F(HcclSocketManagerTest, different_keys_do_not_share)
+{
+    constexpr u32 peerNum = 2;
+    u32 baseSocketNum = HcclSocket::GetOpenSocketNum();
+    std::vector<std::vector<std::shared_ptr<HcclSocket>>> socketsA;
+    std::vector<std::vector<std::shared_ptr<HcclSocket>>> socketsB;
+    auto managersA = CreateGroups(2, peerNum, "comm_a", socketsA);
+    auto managersB = CreateGroups(2, peerNum, "comm_b", socketsB);
+    EXPECT_EQ(socketsA[0], socketsA[1]);
+    EXPECT_EQ(socketsB[0], socketsB[1]);
+    EXPECT_NE(socketsA[0], socketsB[0]);
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, 2 * peerNum);
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 2 * peerNum);
+
+    managersA.clear();
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, peerNum);
+    managersB.clear();
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum(), baseSocketNum);
+}
+
+TEST_F(HcclSocketManagerTest, same_manager_does_not_share_across_tags)
+{
+    /* 同一通信域内不同tag的连接(如单边通信的数据与QP连接)需相互独立 */
+    u32 baseSocketNum = HcclSocket::GetOpenSocketNum();
+    HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    ASSERT_EQ(manager.SetSocketShareKey("parent_comm"), HCCL_SUCCESS);
+    std::vector<std::shared_ptr<HcclSocket>> dataSockets;
+    std::vector<std::shared_ptr<HcclSocket>> qpSockets;
+    ASSERT_EQ(manager.CreateSingleLinkSocket("data", nullptr, MakeLinkInfo(1), dataSockets, true, true),
+        HCCL_SUCCESS);
+    ASSERT_EQ(manager.CreateSingleLinkSocket("qp", nullptr, MakeLinkInfo(1), qpSockets, true, true), HCCL_SUCCESS);
+    ASSERT_EQ(dataSockets.size(), 1U);
+    ASSERT_EQ(qpSockets.size(), 1U);
+    EXPECT_NE(dataSockets[0], qpSockets[0]);
+    EXPECT_NE(dataSockets[0]->GetTag(), qpSockets[0]->GetTag());
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 1U);
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum() - baseSocketNum, 2U);
+
+    // 同一tag重复建链仍走tag内复用
+    std::vector<std::shared_ptr<HcclSocket>> dataSocketsAgain;
+    ASSERT_EQ(manager.CreateSingleLinkSocket("data", nullptr, MakeLinkInfo(1), dataSocketsAgain, true, true),
+        HCCL_SUCCESS);
+    EXPECT_EQ(dataSocketsAgain, dataSockets);
+
+    manager.DestroySockets("data");
+    EXPECT_EQ(HcclSocketManager::GetPooledSocketNum(), 0U);
+    manager.DestroySockets("qp");
+    EXPECT_EQ(HcclSocket::GetOpenSocketNum(), baseSocketNum);
+}
+
+TEST_F(HcclSocketManagerTest, pooled_tag_is_independent_of_rank_and_comm_tag)
+{
+    /* 池化连接可能由任一共享通信域首先建链, 两端的tag不能依赖通信域内rank号和commTag */
+    std::vector<std::string> tags;
+    for (u32 userRank : {0U, 5U}) {
+        HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, userRank);
+        ASSERT_EQ(manager.SetSocketShareKey("parent_comm"), HCCL_SUCCESS);
+        // 同一对端设备在两个通信域中的rank号不同
+        HcclRankLinkInfo remote = MakeLinkInfo(userRank + 1);
+        remote.devicePhyId = 1;
+        remote.ip = HcclIpAddress("10.0.1.1");
+        std::vector<std::shared_ptr<HcclSocket>> sockets;
+        ASSERT_EQ(manager.CreateSingleLinkSocket("group_" + std::to_string(userRank), nullptr, remote, sockets,
+            true, true), HCCL_SUCCESS);
+        ASSERT_EQ(sockets.size(), 1U);
+        EXPECT_EQ(sockets[0]->GetTag().find("group_"), std::string::npos);
+        tags.push_back(sockets[0]->GetTag());
+    }
+    EXPECT_EQ(tags[0], tags[1]);
+
+    // 已建链后不能再修改共享key
+    HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    std::vector<std::shared_ptr<HcclSocket>> sockets;
+    ASSERT_EQ(manager.CreateSingleLinkSocket("group", nullptr, MakeLinkInfo(1), sockets, true, true),
+        HCCL_SUCCESS);
+    EXPECT_EQ(manager.SetSocketShareKey("parent_comm"), HCCL_E_PARA);
+}
+
+TEST_F(HcclSocketManagerTest, stop_flag_wakes_waiting_sockets)
+{
+    /* 建链超时设置为1小时, 只有停止标记能结束等待 */
+    HcclSocket::SetEstablishDelay(std::chrono::microseconds(-1));
+    SetExternalInputHcclLinkTimeOut(3600);
+    HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    auto sockets = MakeSockets(8);
+
+    HcclResult ret = HCCL_SUCCESS;
+    std::thread waiter([&]() { ret = manager.WaitSocketsEstablish(sockets); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(manager.SetStopFlag(true), HCCL_SUCCESS);
+    waiter.join();
+    EXPECT_EQ(ret, HCCL_E_INTERNAL);
+    for (auto &socket : sockets) {
+        EXPECT_EQ(socket->GetStatus(), HcclSocketStatus::SOCKET_CONNECTING);
+    }
+}
+
+TEST_F(HcclSocketManagerTest, batch_shares_one_link_timeout)
+{
+    /* 64条永不建链完成的socket共用1s超时, 逐条等待时需要64s */
+    HcclSocket::SetEstablishDelay(std::chrono::microseconds(-1));
+    SetExternalInputHcclLinkTimeOut(1);
+    HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    auto sockets = MakeSockets(64);
+
+    auto startTime = std::chrono::steady_clock::now();
+    EXPECT_EQ(manager.WaitSocketsEstablish(sockets), HCCL_E_TIMEOUT);
+    RecordProperty("batch_timeout_ms", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count()));
+    // 逐条等待时第一条超时即返回, 其余socket仍处于建链中
+    for (auto &socket : sockets) {
+        EXPECT_EQ(socket->GetStatus(), HcclSocketStatus::SOCKET_TIMEOUT);
+    }
+}
+
+TEST_F(HcclSocketManagerTest, failed_socket_stops_batch_wait)
+{
+    HcclSocket::SetEstablishDelay(std::chrono::microseconds(-1));
+    HcclSocketManager manager(NICDeployment::NIC_DEPLOYMENT_DEVICE, 0, 0, 0);
+    auto sockets = MakeSockets(4);
+    sockets[2]->SetStatus(HcclSocketStatus::SOCKET_INIT);
+    EXPECT_EQ(manager.WaitSocketsEstablish(sockets), HCCL_E_TCP_CONNECT);
+    EXPECT_EQ(sockets[2]->GetStatus(), HcclSocketStatus::SOCKET_ERROR);
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "coll_alg_utils.h"
+#include "sim_executor_runner.h"
+#include "workflow_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 V_SIM_STREAM_NUM = 8;
+constexpr u64 V_SIM_CCL_SIZE = 64 * 1024;
+
+s32 InputValue(u32 rank, u64 idx)
+{
+    return static_cast<s32>((rank + 1) * 1000 + idx % 997);
+}
+
+// 约四分之一的rank数据量为0, 其余在[1, maxCount]内随机
+std::vector<u64> RandomCounts(u32 rankSize, u64 maxCount, u32 seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<u64> countDist(1, maxCount);
+    std::uniform_int_distribution<u32> zeroDist(0, 3);
+    std::vector<u64> counts(rankSize);
+    for (u32 rank = 0; rank < rankSize; rank++) {
+        counts[rank] = (zeroDist(gen) == 0) ? 0 : countDist(gen);
+    }
+    return counts;
+}
+
+std::vector<u64> CalcDispls(const std::vector<u64> &counts)
+{
+    std::vector<u64> displs(counts.size(), 0);
+    for (u32 rank = 1; rank < counts.size(); rank++) {
+        displs[rank] = displs[rank - 1] + counts[rank - 1];
+    }
+    return displs;
+}
+}
+
+struct VRunResult {
+    std::vector<std::vector<s32>> outputs;
+    double timeUs{0};
+};
+
+/*
+ * ReduceScatterV/AllGatherV分层executor经SimExecutorRunner多server执行, 随机counts(含0)下与server内平铺的
+ * mesh executor结果逐元素比对, 覆盖CCL buffer多轮切分、ring/NHR两种server间算法及同server的userRank不连续的拓扑
+ */
+class HierarchicalVSimTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetWorkflowMode(HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE);
+    }
+
+    static void RunReduceScatterV(const std::string &executorName, const std::vector<u32> &serverIds,
+        const std::vector<u64> &counts, AlgTypeLevel1 level1, VRunResult &result)
+    {
+        u32 rankSize = serverIds.size();
+        SimComm comm(rankSize, V_SIM_STREAM_NUM);
+        ASSERT_EQ(comm.Init(V_SIM_CCL_SIZE, serverIds), HCCL_SUCCESS);
+        std::vector<u64> countsBuf(counts);
+        std::vector<u64> displs = CalcDispls(counts);
+        u64 totalCount = displs.back() + counts.back();
+
+        std::vector<DeviceMem> userIn(rankSize);
+        std::vector<DeviceMem> userOut(rankSize);
+        std::vector<OpParam> params(rankSize);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            userIn[rank] = DeviceMem::alloc(std::max<u64>(totalCount, 1) * sizeof(s32));
+            userOut[rank] = DeviceMem::alloc(std::max<u64>(counts[rank], 1) * sizeof(s32));
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userIn[rank].ptr(), userIn[rank].size()),
+                HCCL_SUCCESS);
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userOut[rank].ptr(), userOut[rank].size()),
+                HCCL_SUCCESS);
+            s32 *data = static_cast<s32 *>(userIn[rank].ptr());
+            for (u64 i = 0; i < totalCount; i++) {
+                data[i] = InputValue(rank, i);
+            }
+            std::fill_n(static_cast<s32 *>(userOut[rank].ptr()), userOut[rank].size() / sizeof(s32), -1);
+
+            OpParam &param = params[rank];
+            param.tag = "ReduceScatterV_sim";
+            param.inputPtr = userIn[rank].ptr();
+            param.inputSize = totalCount * sizeof(s32);
+            param.outputPtr = userOut[rank].ptr();
+            param.outputSize = counts[rank] * sizeof(s32);
+            param.VDataDes.counts = countsBuf.data();
+            param.VDataDes.displs = displs.data();
+            param.VDataDes.dataType = HCCL_DATA_TYPE_INT32;
+            param.reduceType = HCCL_REDUCE_SUM;
+            param.opType = HcclCMDType::HCCL_CMD_REDUCE_SCATTER_V;
+        }
+
+        SimExecutorRunner runner(comm, serverIds);
+        ASSERT_EQ(runner.Orchestrate(executorName, AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_MESH, level1), params),
+            HCCL_SUCCESS);
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        EXPECT_EQ(comm.GetEngine().GetPendingNotifyNum(), 0U);
+        result.outputs.assign(rankSize, std::vector<s32>());
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *output = static_cast<const s32 *>(userOut[rank].ptr());
+            result.outputs[rank].assign(output, output + counts[rank]);
+        }
+        result.timeUs = report.totalTimeUs;
+    }
+
+    static void RunAllGatherV(const std::string &executorName, const std::vector<u32> &serverIds,
+        const std::vector<u64> &counts, AlgTypeLevel1 level1, VRunResult &result)
+    {
+        u32 rankSize = serverIds.size();
+        SimComm comm(rankSize, V_SIM_STREAM_NUM);
+        ASSERT_EQ(comm.Init(V_SIM_CCL_SIZE, serverIds), HCCL_SUCCESS);
+        std::vector<u64> countsBuf(counts);
+        std::vector<u64> displs = CalcDispls(counts);
+        u64 totalCount = displs.back() + counts.back();
+
+        std::vector<DeviceMem> userIn(rankSize);
+        std::vector<DeviceMem> userOut(rankSize);
+        std::vector<OpParam> params(rankSize);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            userIn[rank] = DeviceMem::alloc(std::max<u64>(counts[rank], 1) * sizeof(s32));
+            userOut[rank] = DeviceMem::alloc(std::max<u64>(totalCount, 1) * sizeof(s32));
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userIn[rank].ptr(), userIn[rank].size()),
+                HCCL_SUCCESS);
+            ASSERT_EQ(SimPlatform::GetInstance().RegisterMem(rank, userOut[rank].ptr(), userOut[rank].size()),
+                HCCL_SUCCESS);
+            s32 *data = static_cast<s32 *>(userIn[rank].ptr());
+            for (u64 i = 0; i < counts[rank]; i++) {
+                data[i] = InputValue(rank, i);
+            }
+            std::fill_n(static_cast<s32 *>(userOut[rank].ptr()), userOut[rank].size() / sizeof(s32), -1);
+
+            OpParam &param = params[rank];
+            param.tag = "AllGatherV_sim";
+            param.inputPtr = userIn[rank].ptr();
+            param.inputSize = counts[rank] * sizeof(s32);
+            param.outputPtr = userOut[rank].ptr();
+            param.outputSize = totalCount * sizeof(s32);
+            param.VDataDes.counts = countsBuf.data();
+            param.VDataDes.displs = displs.data();
+            param.VDataDes.dataType = HCCL_DATA_TYPE_INT32;
+            param.opType = HcclCMDType::HCCL_CMD_ALLGATHER_V;
+        }
+
+        SimExecutorRunner runner(comm, serverIds);
+        ASSERT_EQ(runner.Orchestrate(executorName, AlgType(AlgTypeLevel0::ALG_LEVEL0_NP_MESH, level1), params),
+            HCCL_SUCCESS);
+        SimReport report;
+        ASSERT_EQ(comm.Run(report), HCCL_SUCCESS);
+        EXPECT_EQ(comm.GetEngine().GetPendingNotifyNum(), 0U);
+        result.outputs.assign(rankSize, std::vector<s32>());
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            const s32 *output = static_cast<const s32 *>(userOut[rank].ptr());
+            result.outputs[rank].assign(output, output + totalCount);
+        }
+        result.timeUs = report.totalTimeUs;
+    }
+
+    // 分层executor在serverIds上的结果需与全部rank同server时mesh executor的结果一致, 且与按定义计算的结果一致
+    static void CompareWithFlat(bool isReduceScatter, const std::vector<u32> &serverIds,
+        const std::vector<u64> &counts, AlgTypeLevel1 level1)
+    {
+        u32 rankSize = serverIds.size();
+        VRunResult flat;
+        VRunResult hier;
+        if (isReduceScatter) {
+            RunReduceScatterV("ReduceScatterVMeshOpbaseExecutor", std::vector<u32>(rankSize, 0), counts,
+                AlgTypeLevel1::ALG_LEVEL1_RING, flat);
+            RunReduceScatterV("ReduceScatterVHierarchicalExecutor", serverIds, counts, level1, hier);
+        } else {
+            RunAllGatherV("AllGatherVMeshOpbaseExecutor", std::vector<u32>(rankSize, 0), counts,
+                AlgTypeLevel1::ALG_LEVEL1_RING, flat);
+            RunAllGatherV("AllGatherVHierarchicalExecutor", serverIds, counts, level1, hier);
+        }
+        if (HasFatalFailure()) {
+            return;
+        }
+        std::vector<u64> displs = CalcDispls(counts);
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            ASSERT_EQ(hier.outputs[rank], flat.outputs[rank]) << "rank " << rank;
+            for (u64 i = 0; i < hier.outputs[rank].size(); i++) {
+                s32 expect = 0;
+                if (isReduceScatter) {
+                    for (u32 peer = 0; peer < rankSize; peer++) {
+                        expect += InputValue(peer, displs[rank] + i);
+                    }
+                } else {
+                    // displs相同的rank中只有最后一个数据量非0
+                    u32 owner = std::upper_bound(displs.begin(), displs.end(), i) - displs.begin() - 1;
+                    expect = InputValue(owner, i - displs[owner]);
+                }
+                ASSERT_EQ(hier.outputs[rank][i], expect) << "rank " << rank << " index " << i;
+            }
+        }
+    }
+
+    static void CompareRandomCounts(bool isReduceScatter, const std::vector<u32> &serverIds, AlgTypeLevel1 level1)
+    {
+        // 小数据量单轮完成, 大数据量需多轮切分CCL buffer
+        for (u32 seed = 1; seed <= 3; seed++) {
+            for (u64 maxCount : {64ULL, 6000ULL}) {
+                SCOPED_TRACE("seed " + std::to_string(seed) + " maxCount " + std::to_string(maxCount));
+                CompareWithFlat(isReduceScatter, serverIds, RandomCounts(serverIds.size(), maxCount, seed), level1);
+                if (HasFatalFailure()) {
+                    return;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(HierarchicalVSimTest, reduce_scatter_v_random_counts_ring)
+{
+    CompareRandomCounts(true, {0, 0, 0, 0, 1, 1, 1, 1}, AlgTypeLevel1::ALG_LEVEL1_RING);
+}
+
+TEST_F(HierarchicalVSimTest, reduce_scatter_v_random_counts_nhr)
+{
+    CompareRandomCounts(true, {0, 0, 1, 1, 2, 2}, AlgTypeLevel1::ALG_LEVEL1_NHR);
+}
+
+TEST_F(HierarchicalVSimTest, reduce_scatter_v_interleaved_server_ranks)
+{
+    // 同server的userRank不连续, ccl buffer按server排布后server数据块仍连续
+    CompareRandomCounts(true, {0, 1, 0, 1, 0, 1}, AlgTypeLevel1::ALG_LEVEL1_RING);
+    CompareRandomCounts(true, {2, 0, 1, 2, 0, 1}, AlgTypeLevel1::ALG_LEVEL1_NHR);
+}
+
+TEST_F(HierarchicalVSimTest, all_gather_v_random_counts_ring)
+{
+    CompareRandomCounts(false, {0, 0, 0, 0, 1, 1, 1, 1}, AlgTypeLevel1::ALG_LEVEL1_RING);
+}
+
+TEST_F(HierarchicalVSimTest, all_gather_v_random_counts_nhr)
+{
+    CompareRandomCounts(false, {0, 0, 1, 1, 2, 2}, AlgTypeLevel1::ALG_LEVEL1_NHR);
+}
+
+TEST_F(HierarchicalVSimTest, all_gather_v_interleaved_server_ranks)
+{
+    CompareRandomCounts(false, {0, 1, 0, 1, 0, 1}, AlgTypeLevel1::ALG_LEVEL1_RING);
+    CompareRandomCounts(false, {2, 0, 1, 2, 0, 1}, AlgTypeLevel1::ALG_LEVEL1_NHR);
+}
+
+TEST_F(HierarchicalVSimTest, all_zero_counts)
+{
+    std::vector<u64> counts(4, 0);
+    CompareWithFlat(true, {0, 0, 1, 1}, counts, AlgTypeLevel1::ALG_LEVEL1_RING);
+    CompareWithFlat(false, {0, 0, 1, 1}, counts, AlgTypeLevel1::ALG_LEVEL1_RING);
+}
+
+TEST(HierarchicalVLoopTest, balanced_counts_cover_all_data_within_budget)
+{
+    // 每轮总量不超过maxTotalCount, 未搬完的rank每轮至少搬运一个元素, 全部轮次拼接后覆盖原始counts
+    for (u32 seed = 1; seed <= 20; seed++) {
+        std::vector<u64> counts = RandomCounts(9, 5000, seed);
+        std::vector<u64> countsLeft(counts);
+        std::vector<u64> displs = CalcDispls(counts);
+        std::vector<u64> origDispls(displs);
+        std::vector<u64> moved(counts.size(), 0);
+        const u64 maxTotalCount = 1000 + seed;
+        bool finished = false;
+        while (!finished) {
+            std::vector<u64> curCounts;
+            std::vector<u64> curDispls;
+            ASSERT_EQ(CalcBalancedCurCountsAndCurDispls(maxTotalCount, countsLeft, displs, curCounts, curDispls,
+                finished), HCCL_SUCCESS);
+            u64 total = 0;
+            for (u32 rank = 0; rank < counts.size(); rank++) {
+                ASSERT_EQ(curDispls[rank], origDispls[rank] + moved[rank]);
+                ASSERT_TRUE(curCounts[rank] > 0 || moved[rank] == counts[rank]) << "seed " << seed;
+                moved[rank] += curCounts[rank];
+                total += curCounts[rank];
+            }
+            ASSERT_LE(total, maxTotalCount);
+        }
+        EXPECT_EQ(moved, counts);
+    }
+    std::vector<u64> countsLeft = {1};
+    std::vector<u64> displs = {0};
+    std::vector<u64> curCounts;
+    std::vector<u64> curDispls;
+    bool finished = false;
+    EXPECT_EQ(CalcBalancedCurCountsAndCurDispls(0, countsLeft, displs, curCounts, curDispls, finished), HCCL_E_PARA);
+}
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "reduce_scatter_nhr_pub.h"
+#include "all_gather_nhr_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 FULL_CHECK_MAX_RANK_SIZE = 130;  // 该规模以内逐个rank全量比较
+constexpr u32 BENCH_RANK_SIZE = 4096;
+constexpr u32 BENCH_LOOP = 20;
+
+/* 以下为引入步骤缓存之前的实现, 作为差分比较的基准, 保持原样不做修改 */
+void LegacyReorder(u32 start, u32 end, u32 len, std::vector<u32> &tree, std::vector<u32> &tmp)
+{
+    const u32 idxTwo = 2;
+
+    for (u32 i = start; i < end; i++) {
+        u32 offset = i - start;
+        if ((offset & 1) == 0) {
+            tmp[start + offset / idxTwo] = tree[i];
+        } else {
+            tmp[start + (offset + len) / idxTwo] = tree[i];
+        }
+    }
+}
+
+void LegacyGetSliceMap(const u32 rankSize, std::vector<u32> &sliceMap)
+{
+    std::vector<u32> tree;
+    for (u32 i = 0; i < rankSize; i++) {
+        tree.push_back(i);
+    }
+
+    std::vector<u32> tmp(rankSize);
+    u32 nSteps = 0;
+    for (u32 tmp = rankSize - 1; tmp != 0; tmp >>= 1, nSteps++) {
+    }
+
+    u32 len = rankSize;
+
+    for (u32 step = 0; step < nSteps; step++) {
+        u32 nSlices = (rankSize - 1 + (1 << step)) / (1 << (step + 1));
+        if (nSlices <= 1) {
+            break;
+        }
+
+        bool endFlag = false;
+
+        for (u32 part = 0; part * len < rankSize; part++) {
+            u32 start = part * len;
+            u32 end = std::min(start + len, rankSize);
+            LegacyReorder(start, end, len, tree, tmp);
+
+            if (((end - start) & 1) == 1) {
+                endFlag = true;
+            }
+        }
+
+        for (u32 i = 0; i < rankSize; i++) {
+            tree[i] = tmp[i];
+        }
+
+        if (endFlag) {
+            break;
+        }
+
+        len >>= 1;
+    }
+
+    sliceMap.resize(rankSize);
+    for (u32 i = 0; i < rankSize; i++) {
+        sliceMap[tree[i]] = i;
+    }
+}
+
+u32 LegacyStepNum(u32 rankSize)
+{
+    u32 nSteps = 0;
+    for (u32 tmp = rankSize - 1; tmp != 0; tmp >>= 1, nSteps++) {
+    }
+    return nSteps;
+}
+
+void LegacyReduceScatterStepInfo(u32 step, u32 rank, u32 rankSize, u32 sliceSize, const std::vector<u32> &sliceMap,
+    InterServerAlgoStep &stepInfo)
+{
+    stepInfo.txSliceIdxs.clear();
+    stepInfo.rxSliceIdxs.clear();
+    stepInfo.step = step;
+    stepInfo.myRank = rank;
+
+    u32 deltaRank = 1 << step;
+    u32 sendTo = (rank + rankSize - deltaRank) % rankSize;
+    u32 recvFrom = (rank + deltaRank) % rankSize;
+
+    u32 nSlices = (rankSize - 1 + (1 << step)) / (1 << (step + 1));
+    u32 deltaSliceIndex = 1 << (step + 1);
+    u32 txSliceIdx = sendTo;
+    u32 rxSliceIdx = rank;
+
+    for (u32 i = 0; i < nSlices; i++) {
+        for (u32 j = 0; j < sliceSize; j++) {
+            stepInfo.txSliceIdxs.push_back(sliceMap[txSliceIdx] * sliceSize + j);
+            stepInfo.rxSliceIdxs.push_back(sliceMap[rxSliceIdx] * sliceSize + j);
+        }
+        txSliceIdx = (txSliceIdx + rankSize - deltaSliceIndex) % rankSize;
+        rxSliceIdx = (rxSliceIdx + rankSize - deltaSliceIndex) % rankSize;
+    }
+
+    stepInfo.nSlices = nSlices * sliceSize;
+    stepInfo.toRank = sendTo;
+    stepInfo.fromRank = recvFrom;
+}
+
+void LegacyAllGatherStepInfo(u32 step, u32 nSteps, u32 rank, u32 rankSize, u32 sliceSize,
+    const std::vector<u32> &sliceMap, InterServerAlgoStep &stepInfo)
+{
+    stepInfo.txSliceIdxs.clear();
+    stepInfo.rxSliceIdxs.clear();
+    stepInfo.step = step;
+    stepInfo.myRank = rank;
+
+    u32 deltaRank = 1 << (nSteps - 1 - step);
+    u32 recvFrom = (rank + rankSize - deltaRank) % rankSize;
+    u32 sendTo = (rank + deltaRank) % rankSize;
+
+    u32 nSlices = (rankSize - 1 + (1 << (nSteps - 1 - step))) / (1 << (nSteps - step));
+    u32 deltaSliceIndex = 1 << (nSteps - step);
+    u32 txSliceIdx = rank;
+    u32 rxSliceIdx = (rank - (1 << (nSteps - 1 - step)) + rankSize) % rankSize;
+
+    stepInfo.nSlices = nSlices * sliceSize;
+    stepInfo.toRank = sendTo;
+    stepInfo.fromRank = recvFrom;
+
+    for (u32 i = 0; i < nSlices; i++) {
+        for (u32 j = 0; j < sliceSize; j++) {
+            stepInfo.txSliceIdxs.push_back(sliceMap[txSliceIdx] * sliceSize + j);
+            stepInfo.rxSliceIdxs.push_back(sliceMap[rxSliceIdx] * sliceSize + j);
+        }
+        txSliceIdx = (txSliceIdx + rankSize - deltaSliceIndex) % rankSize;
+        rxSliceIdx = (rxSliceIdx + rankSize - deltaSliceIndex) % rankSize;
+    }
+}
+
+void LegacyMergeSlices(std::vector<Slice> &slices)
+{
+    if (slices.size() <= 1) {
+        return;
+    }
+
+    std::sort(slices.begin(), slices.end(), [](const Slice &s1, const Slice &s2) {
+        return s1.offset == s2.offset ? s1.size < s2.size : s1.offset < s2.offset;
+    });
+
+    u32 mergedIdx = 0;
+    u64 tmpSliceOffset = slices[0].offset;
+    u64 tmpSliceSize = slices[0].size;
+    for (u32 i = 1; i < slices.size(); i++) {
+        if (tmpSliceOffset + tmpSliceSize == slices[i].offset) {
+            tmpSliceSize += slices[i].size;
+        } else {
+            slices[mergedIdx].size = tmpSliceSize;
+            slices[mergedIdx].offset = tmpSliceOffset;
+            mergedIdx += 1;
+            tmpSliceSize = slices[i].size;
+            tmpSliceOffset = slices[i].offset;
+        }
+    }
+
+    slices[mergedIdx].size = tmpSliceSize;
+    slices[mergedIdx].offset = tmpSliceOffset;
+    mergedIdx += 1;
+    slices.erase(slices.begin() + mergedIdx, slices.end());
+}
+
+void LegacyCollect(const std::vector<u32> &sliceIdxs, const std::vector<Slice> &slices, std::vector<Slice> &collected)
+{
+    collected.clear();
+    for (u32 idx : sliceIdxs) {
+        collected.push_back(slices[idx]);
+    }
+    LegacyMergeSlices(collected);
+}
+
+// 暴露NHR模板的步骤缓存接口, 步骤描述仍由被测模板的GetStepInfo生成
+template <typename T>
+class NHRScheduleProbe : public T {
+public:
+    explicit NHRScheduleProbe(const HcclDispatcher dispatcher) : T(dispatcher)
+    {
+        this->isNeedMerge = true;
+    }
+
+    // 与RunAsync一致: slices_由Prepare设置, 每次下发取tree映射和步骤描述
+    HcclResult Schedule(u32 rank, u32 rankSize, u32 sliceNum, std::shared_ptr<const NHRStepSchedule> &schedule)
+    {
+        if (this->slices_.size() != sliceNum) {
+            this->slices_.assign(sliceNum, Slice());
+        }
+        this->GetRankMapping(rankSize);
+        return this->GetStepSchedule(rank, rankSize, schedule);
+    }
+
+    // slices是否首尾相接在每次下发时只判断一次
+    void Collect(const std::vector<u32> &sliceIdxs, const std::vector<SliceIdxRange> &sliceRanges,
+        const std::vector<Slice> &slices, bool isContiguous, std::vector<Slice> &collected)
+    {
+        this->CollectSlices(sliceIdxs, sliceRanges, slices, isContiguous, collected);
+    }
+
+    void Collect(const std::vector<u32> &sliceIdxs, const std::vector<SliceIdxRange> &sliceRanges,
+        const std::vector<Slice> &slices, std::vector<Slice> &collected)
+    {
+        Collect(sliceIdxs, sliceRanges, slices, T::IsSliceContiguous(slices), collected);
+    }
+
+    static bool IsContiguous(const std::vector<Slice> &slices)
+    {
+        return T::IsSliceContiguous(slices);
+    }
+
+    const std::vector<u32> &SliceMap() const
+    {
+        return this->sliceMap_;
+    }
+};
+
+// 按编号首尾相接的slices, 大小随机且含0
+std::vector<Slice> ContiguousSlices(u32 sliceNum, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<u64> sizeDist(0, 4);
+    std::vector<Slice> slices(sliceNum);
+    u64 offset = 0;
+    for (Slice &slice : slices) {
+        slice.offset = offset;
+        slice.size = sizeDist(gen) * 512;
+        offset += slice.size;
+    }
+    return slices;
+}
+
+// 编号逆序排布且带间隙的slices, 走逐个取出再合并的路径
+std::vector<Slice> ScatteredSlices(u32 sliceNum, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<u64> sizeDist(0, 4);
+    std::uniform_int_distribution<u32> gapDist(0, 1);
+    std::vector<Slice> slices(sliceNum);
+    u64 offset = 0;
+    for (u32 i = sliceNum; i > 0; i--) {
+        Slice &slice = slices[i - 1];
+        offset += gapDist(gen) * 128;
+        slice.offset = offset;
+        slice.size = sizeDist(gen) * 512;
+        offset += slice.size;
+    }
+    return slices;
+}
+
+bool SameSlices(const std::vector<Slice> &lhs, const std::vector<Slice> &rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (u32 i = 0; i < lhs.size(); i++) {
+        if (lhs[i].offset != rhs[i].offset || lhs[i].size != rhs[i].size) {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+/*
+ * NHR步骤缓存的差分测试: 以引入缓存前的tree映射、GetStepInfo与MergeSlices为基准,
+ * 按rankSize逐个比较缓存的步骤描述以及按区间拼接得到的收发slice, 并比较两者每次下发的构造开销
+ */
+class NHRScheduleCacheTest : public testing::Test {
+protected:
+    template <typename T>
+    static void CheckAgainstLegacy(u32 rankSize, u32 rank, u32 sliceSize, bool isAllGather, std::mt19937 &gen)
+    {
+        NHRScheduleProbe<T> probe(nullptr);
+        std::shared_ptr<const NHRStepSchedule> schedule;
+        ASSERT_EQ(probe.Schedule(rank, rankSize, rankSize * sliceSize, schedule), HCCL_SUCCESS);
+        ASSERT_NE(schedule, nullptr);
+
+        std::vector<u32> legacyMap;
+        LegacyGetSliceMap(rankSize, legacyMap);
+        ASSERT_EQ(probe.SliceMap(), legacyMap) << "rankSize " << rankSize;
+
+        u32 nSteps = LegacyStepNum(rankSize);
+        ASSERT_EQ(schedule->size(), nSteps) << "rankSize " << rankSize;
+        std::vector<Slice> contiguous = ContiguousSlices(rankSize * sliceSize, gen);
+        std::vector<Slice> scattered = ScatteredSlices(rankSize * sliceSize, gen);
+        for (u32 step = 0; step < nSteps; step++) {
+            InterServerAlgoStep legacy;
+            if (isAllGather) {
+                LegacyAllGatherStepInfo(step, nSteps, rank, rankSize, sliceSize, legacyMap, legacy);
+            } else {
+                LegacyReduceScatterStepInfo(step, rank, rankSize, sliceSize, legacyMap, legacy);
+            }
+            const InterServerAlgoStep &cached = (*schedule)[step];
+            ASSERT_EQ(cached.toRank, legacy.toRank);
+            ASSERT_EQ(cached.fromRank, legacy.fromRank);
+            ASSERT_EQ(cached.nSlices, legacy.nSlices);
+            ASSERT_EQ(cached.txSliceIdxs, legacy.txSliceIdxs);
+            ASSERT_EQ(cached.rxSliceIdxs, legacy.rxSliceIdxs);
+
+            for (const std::vector<Slice> *slices : {&contiguous, &scattered}) {
+                std::vector<Slice> expected;
+                std::vector<Slice> actual;
+                LegacyCollect(legacy.txSliceIdxs, *slices, expected);
+                probe.Collect(cached.txSliceIdxs, cached.txSliceRanges, *slices, actual);
+                ASSERT_TRUE(SameSlices(actual, expected)) << "tx rankSize " << rankSize << " rank " << rank <<
+                    " step " << step << " sliceSize " << sliceSize;
+                LegacyCollect(legacy.rxSliceIdxs, *slices, expected);
+                probe.Collect(cached.rxSliceIdxs, cached.rxSliceRanges, *slices, actual);
+                ASSERT_TRUE(SameSlices(actual, expected)) << "rx rankSize " << rankSize << " rank " << rank <<
+                    " step " << step << " sliceSize " << sliceSize;
+            }
+        }
+    }
+
+    template <typename T>
+    static void CheckRankSizes(bool isAllGather)
+    {
+        std::mt19937 gen(20251019);
+        for (u32 rankSize = 1; rankSize <= FULL_CHECK_MAX_RANK_SIZE; rankSize++) {
+            for (u32 rank = 0; rank < rankSize; rank++) {
+                u32 sliceSize = 1 + rank % 3;
+                ASSERT_NO_FATAL_FAILURE(CheckAgainstLegacy<T>(rankSize, rank, sliceSize, isAllGather, gen));
+            }
+        }
+        // 大规模只抽样首尾和中间的rank
+        for (u32 rankSize : {255U, 256U, 257U, 1000U, BENCH_RANK_SIZE}) {
+            for (u32 rank : {0U, 1U, rankSize / 2, rankSize - 1}) {
+                ASSERT_NO_FATAL_FAILURE(CheckAgainstLegacy<T>(rankSize, rank, 1, isAllGather, gen));
+            }
+        }
+    }
+};
+
+TEST_F(NHRScheduleCacheTest, reduce_scatter_matches_legacy_schedule)
+{
+    ASSERT_NO_FATAL_FAILURE(CheckRankSizes<ReduceScatterNHR>(false));
+}
+
+TEST_F(NHRScheduleCacheTest, all_gather_matches_legacy_schedule)
+{
+    ASSERT_NO_FATAL_FAILURE(CheckRankSizes<AllGatherNHR>(true));
+}
+
+TEST_F(NHRScheduleCacheTest, schedule_is_shared_across_instances)
+{
+    NHRScheduleProbe<ReduceScatterNHR> first(nullptr);
+    NHRScheduleProbe<ReduceScatterNHR> second(nullptr);
+    NHRScheduleProbe<AllGatherNHR> allGather(nullptr);
+    std::shared_ptr<const NHRStepSchedule> firstSchedule;
+    std::shared_ptr<const NHRStepSchedule> secondSchedule;
+    std::shared_ptr<const NHRStepSchedule> otherSliceNum;
+    std::shared_ptr<const NHRStepSchedule> allGatherSchedule;
+    ASSERT_EQ(first.Schedule(3, 16, 16, firstSchedule), HCCL_SUCCESS);
+    ASSERT_EQ(second.Schedule(3, 16, 16, secondSchedule), HCCL_SUCCESS);
+    ASSERT_EQ(second.Schedule(3, 16, 32, otherSliceNum), HCCL_SUCCESS);
+    ASSERT_EQ(allGather.Schedule(3, 16, 16, allGatherSchedule), HCCL_SUCCESS);
+    // 同一(算法, rankSize, rank, slice数)复用同一份只读描述, 其余维度不同则各自生成
+    EXPECT_EQ(firstSchedule.get(), secondSchedule.get());
+    EXPECT_NE(firstSchedule.get(), otherSliceNum.get());
+    EXPECT_NE(firstSchedule.get(), allGatherSchedule.get());
+}
+
+TEST_F(NHRScheduleCacheTest, slice_construction_benchmark)
+{
+    NHRScheduleProbe<ReduceScatterNHR> probe(nullptr);
+    const u32 rank = BENCH_RANK_SIZE / 2 + 1;
+    std::mt19937 gen(7);
+    std::vector<Slice> slices = ContiguousSlices(BENCH_RANK_SIZE, gen);
+    u32 nSteps = LegacyStepNum(BENCH_RANK_SIZE);
+    std::shared_ptr<const NHRStepSchedule> schedule;
+    ASSERT_EQ(probe.Schedule(rank, BENCH_RANK_SIZE, BENCH_RANK_SIZE, schedule), HCCL_SUCCESS);
+
+    // 旧流程每次下发: 重算tree映射, 逐步GetStepInfo, 输入/输出各取出收发slice后排序合并
+    u64 legacySliceNum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (u32 loop = 0; loop < BENCH_LOOP; loop++) {
+        std::vector<u32> sliceMap;
+        LegacyGetSliceMap(BENCH_RANK_SIZE, sliceMap);
+        for (u32 step = 0; step < nSteps; step++) {
+            InterServerAlgoStep stepInfo;
+            LegacyReduceScatterStepInfo(step, rank, BENCH_RANK_SIZE, 1, sliceMap, stepInfo);
+            std::vector<Slice> collected;
+            for (const std::vector<u32> *idxs : {&stepInfo.txSliceIdxs, &stepInfo.txSliceIdxs,
+                &stepInfo.rxSliceIdxs, &stepInfo.rxSliceIdxs}) {
+                LegacyCollect(*idxs, slices, collected);
+                legacySliceNum += collected.size();
+            }
+        }
+    }
+    auto legacyCost = std::chrono::steady_clock::now() - start;
+
+    // 新流程每次下发: 取缓存的映射与步骤描述, 按区间拼接
+    u64 cachedSliceNum = 0;
+    start = std::chrono::steady_clock::now();
+    for (u32 loop = 0; loop < BENCH_LOOP; loop++) {
+        ASSERT_EQ(probe.Schedule(rank, BENCH_RANK_SIZE, BENCH_RANK_SIZE, schedule), HCCL_SUCCESS);
+        bool isContiguous = NHRScheduleProbe<ReduceScatterNHR>::IsContiguous(slices);
+        for (const InterServerAlgoStep &stepInfo : *schedule) {
+            std::vector<Slice> collected;
+            for (u32 i = 0; i < 2; i++) {
+                probe.Collect(stepInfo.txSliceIdxs, stepInfo.txSliceRanges, slices, isContiguous, collected);
+                cachedSliceNum += collected.size();
+                probe.Collect(stepInfo.rxSliceIdxs, stepInfo.rxSliceRanges, slices, isContiguous, collected);
+                cachedSliceNum += collected.size();
+            }
+        }
+    }
+    auto cachedCost = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(cachedSliceNum, legacySliceNum);
+
+    auto toUs = [](std::chrono::steady_clock::duration cost) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(cost).count() / BENCH_LOOP);
+    };
+    RecordProperty("rank_size", std::to_string(BENCH_RANK_SIZE));
+    RecordProperty("legacy_per_launch_us", toUs(legacyCost));
+    RecordProperty("cached_per_launch_us", toUs(cachedCost));
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "search_path.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 ROH_NIC_NUM = 16;
+constexpr u32 RANDOM_GRAPH_ROUND = 50;
+constexpr u32 RANDOM_GRAPH_NIC_NUM = 7;
+constexpr u32 BENCH_NIC_NUM = 10;
+
+std::vector<u32> MakeNicList(u32 nicNum)
+{
+    std::vector<u32> nicList(nicNum);
+    for (u32 i = 0; i < nicNum; i++) {
+        nicList[i] = i;
+    }
+    return nicList;
+}
+
+// 返回a->b的链路带宽, 不可达返回0
+u32 GetEdgeBw(const NicAdjacency &adjacency, u32 a, u32 b)
+{
+    auto nodeIter = adjacency.find(a);
+    if (nodeIter == adjacency.end()) {
+        return 0;
+    }
+    for (const auto &edge : nodeIter->second) {
+        if (edge.first == b) {
+            return edge.second;
+        }
+    }
+    return 0;
+}
+
+// 校验ring经过nicList中每个nic恰好一次且相邻nic可达, 返回环上的瓶颈带宽
+u32 CheckRing(const NicAdjacency &adjacency, const std::vector<u32> &nicList, const std::vector<u32> &ring)
+{
+    EXPECT_EQ(std::set<u32>(ring.begin(), ring.end()), std::set<u32>(nicList.begin(), nicList.end()));
+    EXPECT_EQ(ring.size(), nicList.size());
+    u32 bottleneck = UINT32_MAX;
+    for (u32 i = 0; i < ring.size(); i++) {
+        u32 bw = GetEdgeBw(adjacency, ring[i], ring[(i + 1) % ring.size()]);
+        EXPECT_NE(bw, 0U) << "edge " << ring[i] << "->" << ring[(i + 1) % ring.size()];
+        bottleneck = std::min(bottleneck, bw);
+    }
+    return bottleneck;
+}
+
+// 双向带宽相同的随机全连接图
+NicAdjacency MakeRandomCompleteGraph(u32 nicNum, std::mt19937 &gen)
+{
+    std::vector<std::vector<u32>> bw(nicNum, std::vector<u32>(nicNum, 0));
+    for (u32 i = 0; i < nicNum; i++) {
+        for (u32 j = i + 1; j < nicNum; j++) {
+            bw[i][j] = bw[j][i] = gen() % 100 + 1;
+        }
+    }
+    NicAdjacency adjacency;
+    for (u32 i = 0; i < nicNum; i++) {
+        for (u32 j = 0; j < nicNum; j++) {
+            if (i != j) {
+                adjacency[i].emplace_back(j, bw[i][j]);
+            }
+        }
+    }
+    return adjacency;
+}
+
+// 枚举以0为起点的全部环, 得到最大瓶颈带宽
+u32 BruteForceBottleneck(const NicAdjacency &adjacency, u32 nicNum)
+{
+    std::vector<u32> order = MakeNicList(nicNum);
+    u32 best = 0;
+    do {
+        u32 bottleneck = UINT32_MAX;
+        for (u32 i = 0; i < nicNum && bottleneck > best; i++) {
+            bottleneck = std::min(bottleneck, GetEdgeBw(adjacency, order[i], order[(i + 1) % nicNum]));
+        }
+        best = std::max(best, bottleneck);
+    } while (std::next_permutation(order.begin() + 1, order.end()));
+    return best;
+}
+
+// 将ring上同奇偶nic间的链路(双向)改为PXI, 模拟server内部分nic对经PCIe转发; SIO串联链路保持不变
+void MarkRingAsPxi(const std::vector<u32> &ring, PairLinkInfo &pairLinkInfo)
+{
+    for (u32 i = 0; i < ring.size(); i++) {
+        u32 a = ring[i];
+        u32 b = ring[(i + 1) % ring.size()];
+        if ((a ^ 1U) == b) {
+            continue;
+        }
+        auto &pxi = pairLinkInfo[static_cast<u32>(LinkTypeInServer::PXI_TYPE)];
+        pxi[a].push_back(b);
+        pxi[b].push_back(a);
+        for (auto &peers : pairLinkInfo[static_cast<u32>(LinkTypeInServer::HCCS_TYPE)]) {
+            if (peers.first == static_cast<s32>(a) || peers.first == static_cast<s32>(b)) {
+                u32 other = (peers.first == static_cast<s32>(a)) ? b : a;
+                peers.second.erase(std::remove(peers.second.begin(), peers.second.end(), other), peers.second.end());
+            }
+        }
+    }
+}
+
+PairLinkInfo MakeAllHccsLinkInfo(u32 nicNum)
+{
+    PairLinkInfo pairLinkInfo;
+    for (u32 i = 0; i < nicNum; i++) {
+        for (u32 j = 0; j < nicNum; j++) {
+            if (i != j) {
+                pairLinkInfo[static_cast<u32>(LinkTypeInServer::HCCS_TYPE)][i].push_back(j);
+            }
+        }
+    }
+    return pairLinkInfo;
+}
+}
+
+/*
+ * ROH成环搜索: 校验默认可达关系上的成环、按实际链路类型避开低带宽链路、
+ * 多个互不共用链路的环, 以及随机不均匀带宽下与枚举结果一致的瓶颈带宽
+ */
+class SearchPathTest : public testing::Test {
+};
+
+TEST_F(SearchPathTest, roh_ring_follows_sio_reachability)
+{
+    for (u32 nicNum : {2U, 4U, 8U, ROH_NIC_NUM}) {
+        std::vector<u32> nicList = MakeNicList(nicNum);
+        std::vector<u32> ring;
+        ASSERT_TRUE(SearchRohRing(nicList, ring)) << "nicNum " << nicNum;
+        CheckRing(GetSioReachableAdjacency(), nicList, ring);
+    }
+    // 奇偶不通且无SIO串联时无法成环
+    std::vector<u32> ring;
+    EXPECT_FALSE(SearchRohRing({0, 3}, ring));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST_F(SearchPathTest, link_info_without_entries_keeps_default_adjacency)
+{
+    NicAdjacency adjacency = BuildRohAdjacency(PairLinkInfo());
+    EXPECT_EQ(adjacency, GetSioReachableAdjacency());
+
+    NicAdjacency hccsAdjacency = BuildRohAdjacency(MakeAllHccsLinkInfo(ROH_NIC_NUM));
+    for (const auto &node : hccsAdjacency) {
+        for (const auto &edge : node.second) {
+            EXPECT_EQ(edge.second, GetLinkTypeBandwidth(LinkTypeInServer::HCCS_TYPE));
+        }
+    }
+    EXPECT_GT(GetLinkTypeBandwidth(LinkTypeInServer::SIO_TYPE), GetLinkTypeBandwidth(LinkTypeInServer::PXI_TYPE));
+    EXPECT_GT(GetLinkTypeBandwidth(LinkTypeInServer::PXI_TYPE),
+        GetLinkTypeBandwidth(LinkTypeInServer::RESERVED_LINK_TYPE));
+}
+
+TEST_F(SearchPathTest, roh_ring_avoids_pxi_links)
+{
+    for (u32 nicNum : {8U, ROH_NIC_NUM}) {
+        std::vector<u32> nicList = MakeNicList(nicNum);
+        std::vector<u32> defaultRing;
+        ASSERT_TRUE(SearchRohRing(nicList, defaultRing));
+
+        // 默认环上的非SIO链路退化为PXI后, 按实际链路带宽搜索应换用其他环
+        PairLinkInfo pairLinkInfo = MakeAllHccsLinkInfo(nicNum);
+        MarkRingAsPxi(defaultRing, pairLinkInfo);
+        NicAdjacency adjacency = BuildRohAdjacency(pairLinkInfo);
+        EXPECT_EQ(CheckRing(adjacency, nicList, defaultRing), GetLinkTypeBandwidth(LinkTypeInServer::PXI_TYPE));
+
+        std::vector<u32> ring;
+        ASSERT_TRUE(SearchRohRing(nicList, ring, adjacency)) << "nicNum " << nicNum;
+        EXPECT_EQ(CheckRing(adjacency, nicList, ring), GetLinkTypeBandwidth(LinkTypeInServer::HCCS_TYPE))
+            << "nicNum " << nicNum;
+        EXPECT_NE(ring, defaultRing);
+    }
+}
+
+TEST_F(SearchPathTest, multiple_rings_do_not_share_links)
+{
+    std::vector<u32> nicList = MakeNicList(8);
+    SearchPath searchPath(GetSioReachableAdjacency());
+    u32 bottleneckBw = 0;
+    // 8卡时每个nic在可达关系中有4条链路, 最多可成2个互不共用链路的环
+    std::vector<std::vector<u32>> rings = searchPath.SearchRings(nicList, 2, bottleneckBw);
+    ASSERT_EQ(rings.size(), 2U);
+    std::set<std::pair<u32, u32>> usedEdges;
+    for (const auto &ring : rings) {
+        CheckRing(GetSioReachableAdjacency(), nicList, ring);
+        for (u32 i = 0; i < ring.size(); i++) {
+            u32 a = ring[i];
+            u32 b = ring[(i + 1) % ring.size()];
+            EXPECT_TRUE(usedEdges.emplace(std::min(a, b), std::max(a, b)).second) << a << "-" << b;
+        }
+    }
+    EXPECT_TRUE(searchPath.SearchRings(nicList, 3, bottleneckBw).empty());
+    EXPECT_EQ(bottleneckBw, 0U);
+}
+
+TEST_F(SearchPathTest, uneven_bandwidth_matches_brute_force_bottleneck)
+{
+    std::mt19937 gen(2025);
+    for (u32 round = 0; round < RANDOM_GRAPH_ROUND; round++) {
+        NicAdjacency adjacency = MakeRandomCompleteGraph(RANDOM_GRAPH_NIC_NUM, gen);
+        std::vector<u32> nicList = MakeNicList(RANDOM_GRAPH_NIC_NUM);
+        SearchPath searchPath(adjacency);
+        u32 bottleneckBw = 0;
+        std::vector<std::vector<u32>> rings = searchPath.SearchRings(nicList, 1, bottleneckBw);
+        ASSERT_EQ(rings.size(), 1U) << "round " << round;
+        EXPECT_EQ(CheckRing(adjacency, nicList, rings[0]), bottleneckBw) << "round " << round;
+        EXPECT_EQ(bottleneckBw, BruteForceBottleneck(adjacency, RANDOM_GRAPH_NIC_NUM)) << "round " << round;
+
+        // 两个环时瓶颈带宽不高于单环
+        u32 twoRingBw = 0;
+        std::vector<std::vector<u32>> twoRings = searchPath.SearchRings(nicList, 2, twoRingBw);
+        ASSERT_EQ(twoRings.size(), 2U) << "round " << round;
+        EXPECT_LE(twoRingBw, bottleneckBw);
+        for (const auto &ring : twoRings) {
+            EXPECT_GE(CheckRing(adjacency, nicList, ring), twoRingBw);
+        }
+    }
+}
+
+TEST_F(SearchPathTest, bandwidth_aware_search_benchmark)
+{
+    std::mt19937 gen(7);
+    NicAdjacency adjacency = MakeRandomCompleteGraph(BENCH_NIC_NUM, gen);
+    std::vector<u32> nicList = MakeNicList(BENCH_NIC_NUM);
+
+    auto start = std::chrono::steady_clock::now();
+    u32 bruteForceBw = BruteForceBottleneck(adjacency, BENCH_NIC_NUM);
+    auto bruteForceCost = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    SearchPath searchPath(adjacency);
+    u32 bottleneckBw = 0;
+    std::vector<std::vector<u32>> rings = searchPath.SearchRings(nicList, 1, bottleneckBw);
+    auto searchCost = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    u32 cachedBw = 0;
+    std::vector<std::vector<u32>> cachedRings = SearchPath(adjacency).SearchRings(nicList, 1, cachedBw);
+    auto cachedCost = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(rings.size(), 1U);
+    EXPECT_EQ(bottleneckBw, bruteForceBw);
+    EXPECT_EQ(cachedRings, rings);
+    EXPECT_EQ(cachedBw, bottleneckBw);
+
+    auto toUs = [](std::chrono::steady_clock::duration cost) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(cost).count());
+    };
+    RecordProperty("nic_num", std::to_string(BENCH_NIC_NUM));
+    RecordProperty("brute_force_us", toUs(bruteForceCost));
+    RecordProperty("search_us", toUs(searchCost));
+    RecordProperty("cached_search_us", toUs(cachedCost));
+    RecordProperty("bottleneck_bw", std::to_string(bottleneckBw));
+}
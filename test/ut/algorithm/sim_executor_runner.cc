@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "sim_executor_runner.h"
+#include <algorithm>
+#include "coll_alg_exec_registry.h"
+
+namespace hccl {
+namespace {
+SimMemType ToSimMemType(TransportMemType memType, SimMemType defaultType)
+{
+    // 仿真中param/scratch内存与CCL buffer共用, 只区分input侧与output侧
+    switch (memType) {
+        case TransportMemType::CCL_INPUT:
+        case TransportMemType::PARAM_INPUT:
+        case TransportMemType::AIV_INPUT:
+            return SimMemType::SIM_MEM_INPUT;
+        case TransportMemType::CCL_OUTPUT:
+        case TransportMemType::PARAM_OUTPUT:
+        case TransportMemType::SCRATCH:
+        case TransportMemType::AIV_OUTPUT:
+            return SimMemType::SIM_MEM_OUTPUT;
+        default:
+            return defaultType;
+    }
+}
+}
+
+SimExecutorRunner::SimExecutorRunner(SimComm &comm, const std::vector<u32> &serverIds, DevType deviceType)
+    : comm_(comm), serverIds_(serverIds), deviceType_(deviceType)
+{
+    if (serverIds_.empty()) {
+        serverIds_.assign(comm_.GetRankSize(), 0);
+    }
+    // server按serverId首次出现的顺序编号, server内userRank升序, 与TopoMatcher::GetServerToRank一致
+    std::vector<u32> serverIdList;
+    for (u32 rank = 0; rank < serverIds_.size(); rank++) {
+        u32 serverIdx = std::find(serverIdList.begin(), serverIdList.end(), serverIds_[rank]) - serverIdList.begin();
+        if (serverIdx == serverIdList.size()) {
+            serverIdList.push_back(serverIds_[rank]);
+            serverToRank_.emplace_back();
+        }
+        serverToRank_[serverIdx].push_back(rank);
+    }
+}
+
+HcclResult SimExecutorRunner::BuildTopoMatcher(u32 rank, std::unique_ptr<TopoMatcher> &topoMatcher) const
+{
+    u32 rankSize = comm_.GetRankSize();
+    CHK_PRT_RET(serverIds_.size() != rankSize, HCCL_ERROR("[SimExecutorRunner]serverIds size[%zu] does not match "
+        "rankSize[%u]", serverIds_.size(), rankSize), HCCL_E_PARA);
+    u32 serverNum = serverToRank_.size();
+    u32 serverIdx = 0;
+    while (std::find(serverToRank_[serverIdx].begin(), serverToRank_[serverIdx].end(), rank) ==
+        serverToRank_[serverIdx].end()) {
+        serverIdx++;
+    }
+    const std::vector<u32> &level0Ranks = serverToRank_[serverIdx];
+    u32 localIdx = std::find(level0Ranks.begin(), level0Ranks.end(), rank) - level0Ranks.begin();
+    u32 maxServerSize = 0;
+    bool isDiffDeviceNum = false;
+    for (const std::vector<u32> &serverRanks : serverToRank_) {
+        maxServerSize = std::max<u32>(maxServerSize, serverRanks.size());
+        isDiffDeviceNum = isDiffDeviceNum || (serverRanks.size() != level0Ranks.size());
+    }
+
+    std::vector<std::vector<std::vector<u32>>> commPlaneRanks(COMM_LEVEL_RESERVED);
+    commPlaneRanks[COMM_LEVEL0].push_back(level0Ranks);
+    for (u32 idx = 0; idx < maxServerSize; idx++) {
+        std::vector<u32> level1Ranks;
+        for (const std::vector<u32> &serverRanks : serverToRank_) {
+            if (idx < serverRanks.size()) {
+                level1Ranks.push_back(serverRanks[idx]);
+            }
+        }
+        commPlaneRanks[COMM_LEVEL1].push_back(level1Ranks);
+        commPlaneRanks[COMM_LEVEL1_DBT_TREE].push_back(level1Ranks);
+    }
+    std::vector<u32> allRanks(rankSize);
+    for (u32 peer = 0; peer < rankSize; peer++) {
+        allRanks[peer] = peer;
+    }
+    commPlaneRanks[COMM_COMBINE].push_back(allRanks);
+    commPlaneRanks[COMM_COMBINE_ORDER].push_back(allRanks);
+    // 与真实拓扑一致, rank只是所在level1平面的bridge rank
+    std::vector<bool> isBridgeVector(maxServerSize, false);
+    isBridgeVector[localIdx] = true;
+
+    HcclTopoInfo topoInfo;
+    topoInfo.userRank = rank;
+    topoInfo.realUserRank = rank;
+    topoInfo.userRankSize = rankSize;
+    topoInfo.devicePhyId = localIdx;
+    topoInfo.deviceLogicId = static_cast<s32>(localIdx);
+    for (u32 idx = 0; idx < level0Ranks.size(); idx++) {
+        topoInfo.nicList.push_back(idx);
+    }
+    topoInfo.isSingleMeshAggregation = true;
+    topoInfo.deviceNumPerAggregation = level0Ranks.size();
+    topoInfo.gcdDeviceNumPerAggregation = level0Ranks.size();
+    topoInfo.superPodNum = 1;
+    topoInfo.deviceType = deviceType_;
+    topoInfo.topoType = TopoType::TOPO_TYPE_COMMON;
+    topoInfo.serverNum = serverNum;
+    topoInfo.meshAggregationRankSize = level0Ranks.size();
+    topoInfo.moduleNum = serverNum;
+    topoInfo.multiModuleDiffDeviceNumMode = isDiffDeviceNum ? 1 : 0;
+    for (u32 peer = 0; peer < rankSize; peer++) {
+        topoInfo.isUsedRdmaMap[peer] = (serverIds_[peer] != serverIds_[rank]);
+    }
+    HcclAlgoInfo algoInfo;
+    algoInfo.identifier = "sim_comm";
+    HcclExternalEnable externalEnable;
+    std::vector<std::vector<std::vector<u32>>> serverAndsuperPodToRank = { serverToRank_, { allRanks } };
+
+    topoMatcher.reset(new (std::nothrow) TopoMatcher(commPlaneRanks, isBridgeVector, topoInfo, algoInfo,
+        externalEnable, serverAndsuperPodToRank));
+    CHK_SMART_PTR_NULL(topoMatcher);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimExecutorRunner::BuildResource(u32 rank, const AlgResourceRequest &request,
+    AlgResourceResponse &resource)
+{
+    SimRankResource &res = comm_.GetRank(rank);
+    CHK_PRT_RET(request.streamNum > res.slaveStreams.size(),
+        HCCL_ERROR("[SimExecutorRunner]rank[%u] executor needs [%u] slave streams, simulator has [%zu]",
+        rank, request.streamNum, res.slaveStreams.size()), HCCL_E_PARA);
+    resource.cclInputMem = res.cclIn;
+    resource.cclOutputMem = res.cclOut;
+    resource.paramInputMem = res.cclIn;
+    resource.paramOutputMem = res.cclOut;
+    resource.scratchMem = res.cclOut;
+    resource.slaveStreams.assign(res.slaveStreams.begin(), res.slaveStreams.begin() + request.streamNum);
+    resource.notifiesMain.assign(res.notifiesMain.begin(), res.notifiesMain.begin() + request.streamNum);
+    resource.notifiesAux.assign(res.notifiesAux.begin(), res.notifiesAux.begin() + request.streamNum);
+
+    /* 建链诉求中的每个有效请求映射到仿真全连接链路, 下标与transportRequests一致, 对端内存按诉求的内存类型映射;
+       COMM_LEVEL1_DBT_TREE与COMM_LEVEL1在真实通信域中是两次独立建链, 这里映射到另一组链路 */
+    resource.opTransportResponse = request.opTransport;
+    for (u32 level = 0; level < resource.opTransportResponse.size(); level++) {
+        const std::vector<LINK> &rankLinks = (level == COMM_LEVEL1_DBT_TREE) ? res.auxLinks : res.links;
+        for (SingleSubCommTransport &subComm : resource.opTransportResponse[level]) {
+            subComm.links.assign(subComm.transportRequests.size(), nullptr);
+            for (u32 idx = 0; idx < subComm.transportRequests.size(); idx++) {
+                const TransportRequest &req = subComm.transportRequests[idx];
+                if (req.isValid) {
+                    CHK_PRT_RET(req.remoteUserRank >= rankLinks.size(),
+                        HCCL_ERROR("[SimExecutorRunner]remote rank[%u] is out of range", req.remoteUserRank),
+                        HCCL_E_PARA);
+                    CHK_RET(SimPlatform::GetInstance().CreateLinkView(rankLinks[req.remoteUserRank],
+                        ToSimMemType(req.inputMemType, SimMemType::SIM_MEM_INPUT),
+                        ToSimMemType(req.outputMemType, SimMemType::SIM_MEM_OUTPUT), subComm.links[idx]));
+                }
+            }
+        }
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimExecutorRunner::Orchestrate(const std::string &executorName, const AlgType &algType,
+    std::vector<OpParam> &params)
+{
+    CHK_RET(Resolve(executorName, algType, params));
+    return Launch(params);
+}
+
+HcclResult SimExecutorRunner::Resolve(const std::string &executorName, const AlgType &algType,
+    std::vector<OpParam> &params)
+{
+    u32 rankSize = comm_.GetRankSize();
+    CHK_PRT_RET(params.size() != rankSize,
+        HCCL_ERROR("[SimExecutorRunner]params size[%zu] is not equal to rankSize[%u]", params.size(), rankSize),
+        HCCL_E_PARA);
+    ranks_.clear();
+    ranks_.resize(rankSize);
+    for (u32 rank = 0; rank < rankSize; rank++) {
+        RankContext &ctx = ranks_[rank];
+        CHK_RET(BuildTopoMatcher(rank, ctx.topoMatcher));
+        ctx.executor = CollAlgExecRegistry::Instance().GetAlgExec(executorName,
+            SimPlatform::GetInstance().GetDispatcher(), ctx.topoMatcher);
+        CHK_PRT_RET(ctx.executor == nullptr,
+            HCCL_ERROR("[SimExecutorRunner]executor[%s] is not registered", executorName.c_str()), HCCL_E_NOT_FOUND);
+        CHK_RET(ctx.executor->SetAlgType(algType));
+        CHK_RET(ctx.executor->SetCCLInBuffer(comm_.GetRank(rank).cclIn.size()));
+        CHK_RET(ctx.executor->SetIsSupportSDMAReduce(true));
+
+        OpParam &param = params[rank];
+        param.stream = comm_.GetRank(rank).mainStream;
+        AlgResourceRequest request;
+        CHK_RET(ctx.executor->CalcResRequest(param, request));
+        CHK_RET(BuildResource(rank, request, ctx.resource));
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimExecutorRunner::Launch(std::vector<OpParam> &params)
+{
+    CHK_PRT_RET(params.size() != ranks_.size(),
+        HCCL_ERROR("[SimExecutorRunner]params size[%zu] is not equal to resolved rank num[%zu]", params.size(),
+        ranks_.size()), HCCL_E_PARA);
+    for (u32 rank = 0; rank < ranks_.size(); rank++) {
+        CHK_SMART_PTR_NULL(ranks_[rank].executor);
+        CHK_RET(ranks_[rank].executor->Orchestrate(params[rank], ranks_[rank].resource));
+    }
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SIM_EXECUTOR_RUNNER_H
+#define SIM_EXECUTOR_RUNNER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "sim_comm.h"
+#include "coll_executor_base.h"
+#include "topo_matcher.h"
+
+namespace hccl {
+/*
+ * 在SimComm上驱动CollExecutor: 按rank构造TopoMatcher, 经CalcResRequest得到资源诉求后用仿真资源填充
+ * AlgResourceResponse, 再调用Orchestrate下发task。serverIds[rank]为rank所在server, 同server的rank可不连续编号,
+ * 各server卡数可以不同。level0为server内全部rank, level1按server内序号跨server分组, COMBINE平面为全部rank。
+ */
+class SimExecutorRunner {
+public:
+    SimExecutorRunner(SimComm &comm, const std::vector<u32> &serverIds,
+        DevType deviceType = DevType::DEV_TYPE_910B);
+
+    /* params[rank]由用例填好数据相关字段, stream由runner填为该rank的主流 */
+    HcclResult Orchestrate(const std::string &executorName, const AlgType &algType, std::vector<OpParam> &params);
+
+    /* Orchestrate拆为两步: Resolve构造executor并准备资源, Launch按已准备的资源下发task, 可重复调用 */
+    HcclResult Resolve(const std::string &executorName, const AlgType &algType, std::vector<OpParam> &params);
+    HcclResult Launch(std::vector<OpParam> &params);
+
+private:
+    struct RankContext {
+        std::unique_ptr<TopoMatcher> topoMatcher;
+        std::unique_ptr<CollExecutorBase> executor;
+        AlgResourceResponse resource;
+    };
+
+    HcclResult BuildTopoMatcher(u32 rank, std::unique_ptr<TopoMatcher> &topoMatcher) const;
+    HcclResult BuildResource(u32 rank, const AlgResourceRequest &request, AlgResourceResponse &resource);
+
+    SimComm &comm_;
+    std::vector<u32> serverIds_;
+    DevType deviceType_;
+    std::vector<std::vector<u32>> serverToRank_;
+    std::vector<RankContext> ranks_;
+};
+}  // namespace hccl
+
+#endif /* SIM_EXECUTOR_RUNNER_H */
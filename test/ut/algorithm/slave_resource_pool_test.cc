@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "hccl_common.h"
+#include "local_notify.h"
+#include "queue_notify_manager.h"
+#include "op_base_stream_manager_pub.h"
+#include "slave_resource_pool.h"
+#include "runtime_quota.h"
+
+using namespace hccl;
+
+namespace {
+constexpr s32 SHARE_DEVICE_ID = 0;
+constexpr s32 NO_SHARE_DEVICE_ID = -1;
+constexpr u32 SLAVE_NUM = 3;
+constexpr u32 NOTIFY_NUM = 8;
+constexpr u32 LARGE_QUOTA = 65536;
+const std::string OP_TAG = "AllReduce_comm";
+
+rtStream_t MockMaster(uintptr_t index)
+{
+    return reinterpret_cast<rtStream_t>(0x10000 + index * 0x100);
+}
+
+/*
+ * 模拟HcclCommunicator的单算子资源申请: 从流由OpBaseStreamManager分配, host notify在共享时从资源组分配,
+ * 否则从通信域自己的QueueNotifyManager分配
+ */
+class MockComm {
+public:
+    explicit MockComm(bool share) : streamManager_(share ? SHARE_DEVICE_ID : NO_SHARE_DEVICE_ID)
+    {
+        (void)notifyManager_.Init();
+    }
+
+    HcclResult AllocOpResource(rtStream_t master, std::vector<Stream> &slaves,
+        std::vector<std::shared_ptr<LocalNotify>> &notifies)
+    {
+        CHK_RET(streamManager_.RegisterMaster(master));
+        slaves = streamManager_.AllocSlaves(StreamType::STREAM_TYPE_ONLINE, SLAVE_NUM);
+        CHK_PRT_RET(slaves.empty(), HCCL_ERROR("[MockComm]alloc slaves failed"), HCCL_E_RUNTIME);
+        if (streamManager_.IsSlaveShared()) {
+            return streamManager_.AllocSlaveNotifies(OP_TAG, NOTIFY_NUM, notifies);
+        }
+        return notifyManager_.Alloc(OP_TAG, NOTIFY_NUM, notifies, NotifyLoadType::HOST_NOTIFY);
+    }
+
+    OpBaseStreamManager &StreamManager()
+    {
+        return streamManager_;
+    }
+
+private:
+    OpBaseStreamManager streamManager_;
+    QueueNotifyManager notifyManager_;
+};
+
+/* commNum个通信域在同一主流上各申请一次算子资源, 返回成功申请的通信域数 */
+u32 AllocForComms(u32 commNum, bool share, std::vector<std::unique_ptr<MockComm>> &comms)
+{
+    for (u32 i = 0; i < commNum; i++) {
+        comms.emplace_back(new MockComm(share));
+        std::vector<Stream> slaves;
+        std::vector<std::shared_ptr<LocalNotify>> notifies;
+        if (comms.back()->AllocOpResource(MockMaster(0), slaves, notifies) != HCCL_SUCCESS) {
+            comms.pop_back();
+            break;
+        }
+    }
+    return comms.size();
+}
+
+/* threadNum个线程各持有一个通信域, 在同一主流上反复申请算子资源, 返回单次申请的平均耗时(ns) */
+double RunContention(u32 threadNum, u32 loopNum, bool share)
+{
+    std::vector<std::unique_ptr<MockComm>> comms;
+    for (u32 i = 0; i < threadNum; i++) {
+        comms.emplace_back(new MockComm(share));
+    }
+    std::vector<HcclResult> results(threadNum, HCCL_SUCCESS);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (u32 i = 0; i < threadNum; i++) {
+        threads.emplace_back([&comms, &results, i, loopNum]() {
+            for (u32 loop = 0; loop < loopNum && results[i] == HCCL_SUCCESS; loop++) {
+                std::vector<Stream> slaves;
+                std::vector<std::shared_ptr<LocalNotify>> notifies;
+                results[i] = comms[i]->AllocOpResource(MockMaster(0), slaves, notifies);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    for (u32 i = 0; i < threadNum; i++) {
+        EXPECT_EQ(results[i], HCCL_SUCCESS) << "thread " << i;
+    }
+    return static_cast<double>(costNs.count()) / (threadNum * loopNum);
+}
+}
+
+/* 多通信域在mock runtime上申请从流和host notify, 统计共享前后的配额占用与并发申请耗时 */
+class SlaveResourcePoolTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetStubRuntimeQuota(LARGE_QUOTA, LARGE_QUOTA);
+    }
+
+    void TearDown() override
+    {
+        SetStubRuntimeQuota(0, 0);
+    }
+};
+
+TEST_F(SlaveResourcePoolTest, shared_streams_and_notifies_do_not_grow_with_comm_num)
+{
+    for (u32 commNum : {1U, 8U, 64U}) {
+        for (bool share : {false, true}) {
+            SetStubRuntimeQuota(LARGE_QUOTA, LARGE_QUOTA);
+            std::vector<std::unique_ptr<MockComm>> comms;
+            ASSERT_EQ(AllocForComms(commNum, share, comms), commNum);
+            StubRuntimeStat stat = GetStubRuntimeStat();
+            u32 expectComm = share ? 1 : commNum;
+            EXPECT_EQ(stat.peakStreamNum, SLAVE_NUM * expectComm) << "commNum " << commNum << " share " << share;
+            EXPECT_EQ(stat.peakNotifyNum, NOTIFY_NUM * expectComm) << "commNum " << commNum << " share " << share;
+            std::string prefix = "comm" + std::to_string(commNum) + (share ? "_shared_" : "_unshared_");
+            RecordProperty(prefix + "streams", std::to_string(stat.peakStreamNum));
+            RecordProperty(prefix + "notifies", std::to_string(stat.peakNotifyNum));
+        }
+        // 通信域全部销毁后从流和notify全部归还
+        StubRuntimeStat stat = GetStubRuntimeStat();
+        EXPECT_EQ(stat.streamNum, 0U);
+        EXPECT_EQ(stat.notifyNum, 0U);
+    }
+}
+
+TEST_F(SlaveResourcePoolTest, shared_comms_fit_in_quota_that_unshared_comms_exhaust)
+{
+    constexpr u32 commNum = 64;
+    constexpr u32 streamQuota = 64;
+    constexpr u32 notifyQuota = 256;
+    SetStubRuntimeQuota(streamQuota, notifyQuota);
+    std::vector<std::unique_ptr<MockComm>> unsharedComms;
+    u32 unsharedNum = AllocForComms(commNum, false, unsharedComms);
+    EXPECT_EQ(unsharedNum, streamQuota / SLAVE_NUM);
+    unsharedComms.clear();
+
+    SetStubRuntimeQuota(streamQuota, notifyQuota);
+    std::vector<std::unique_ptr<MockComm>> sharedComms;
+    u32 sharedNum = AllocForComms(commNum, true, sharedComms);
+    EXPECT_EQ(sharedNum, commNum);
+    RecordProperty("unshared_comms_in_quota", std::to_string(unsharedNum));
+    RecordProperty("shared_comms_in_quota", std::to_string(sharedNum));
+}
+
+TEST_F(SlaveResourcePoolTest, comms_on_same_master_get_same_slaves_and_notifies)
+{
+    MockComm commA(true);
+    MockComm commB(true);
+    MockComm commC(true);
+    std::vector<Stream> slavesA;
+    std::vector<Stream> slavesB;
+    std::vector<Stream> slavesC;
+    std::vector<std::shared_ptr<LocalNotify>> notifiesA;
+    std::vector<std::shared_ptr<LocalNotify>> notifiesB;
+    std::vector<std::shared_ptr<LocalNotify>> notifiesC;
+    ASSERT_EQ(commA.AllocOpResource(MockMaster(0), slavesA, notifiesA), HCCL_SUCCESS);
+    ASSERT_EQ(commB.AllocOpResource(MockMaster(0), slavesB, notifiesB), HCCL_SUCCESS);
+    ASSERT_EQ(commC.AllocOpResource(MockMaster(1), slavesC, notifiesC), HCCL_SUCCESS);
+    for (u32 i = 0; i < SLAVE_NUM; i++) {
+        EXPECT_EQ(slavesA[i].ptr(), slavesB[i].ptr());
+        EXPECT_NE(slavesA[i].ptr(), slavesC[i].ptr());
+    }
+    for (u32 i = 0; i < NOTIFY_NUM; i++) {
+        EXPECT_EQ(notifiesA[i], notifiesB[i]);
+        EXPECT_NE(notifiesA[i], notifiesC[i]);
+    }
+    SlaveResourcePool *pool = nullptr;
+    ASSERT_EQ(SlaveResourcePool::GetInstance(SHARE_DEVICE_ID, pool), HCCL_SUCCESS);
+    SlaveResourcePoolStat poolStat = pool->GetStat();
+    EXPECT_EQ(poolStat.groupNum, 2U);
+    EXPECT_EQ(poolStat.slaveStreamNum, 2 * SLAVE_NUM);
+}
+
+TEST_F(SlaveResourcePoolTest, switching_master_after_sharing_is_rejected)
+{
+    MockComm sharedComm(true);
+    std::vector<Stream> slaves;
+    std::vector<std::shared_ptr<LocalNotify>> notifies;
+    ASSERT_EQ(sharedComm.AllocOpResource(MockMaster(0), slaves, notifies), HCCL_SUCCESS);
+    EXPECT_EQ(sharedComm.StreamManager().RegisterMaster(MockMaster(1)), HCCL_E_NOT_SUPPORT);
+    EXPECT_EQ(sharedComm.StreamManager().GetMaster().ptr(), MockMaster(0));
+    EXPECT_EQ(sharedComm.AllocOpResource(MockMaster(0), slaves, notifies), HCCL_SUCCESS);
+
+    MockComm unsharedComm(false);
+    ASSERT_EQ(unsharedComm.AllocOpResource(MockMaster(0), slaves, notifies), HCCL_SUCCESS);
+    EXPECT_EQ(unsharedComm.AllocOpResource(MockMaster(1), slaves, notifies), HCCL_SUCCESS);
+}
+
+TEST_F(SlaveResourcePoolTest, group_lives_until_last_comm_is_destroyed)
+{
+    std::unique_ptr<MockComm> commA(new MockComm(true));
+    std::unique_ptr<MockComm> commB(new MockComm(true));
+    {
+        std::vector<Stream> slaves;
+        std::vector<std::shared_ptr<LocalNotify>> notifies;
+        ASSERT_EQ(commA->AllocOpResource(MockMaster(0), slaves, notifies), HCCL_SUCCESS);
+        ASSERT_EQ(commB->AllocOpResource(MockMaster(0), slaves, notifies), HCCL_SUCCESS);
+    }
+    commA.reset();
+    EXPECT_EQ(GetStubRuntimeStat().streamNum, SLAVE_NUM);
+    EXPECT_EQ(GetStubRuntimeStat().notifyNum, NOTIFY_NUM);
+
+    commB.reset();
+    EXPECT_EQ(GetStubRuntimeStat().streamNum, 0U);
+    EXPECT_EQ(GetStubRuntimeStat().notifyNum, 0U);
+    SlaveResourcePool *pool = nullptr;
+    ASSERT_EQ(SlaveResourcePool::GetInstance(SHARE_DEVICE_ID, pool), HCCL_SUCCESS);
+    EXPECT_EQ(pool->GetStat().groupNum, 0U);
+}
+
+TEST_F(SlaveResourcePoolTest, concurrent_alloc_on_shared_master)
+{
+    constexpr u32 threadNum = 8;
+    constexpr u32 loopNum = 2000;
+    double unsharedNs = RunContention(threadNum, loopNum, false);
+    SetStubRuntimeQuota(LARGE_QUOTA, LARGE_QUOTA);
+    double sharedNs = RunContention(threadNum, loopNum, true);
+    EXPECT_EQ(GetStubRuntimeStat().peakStreamNum, SLAVE_NUM);
+    EXPECT_EQ(GetStubRuntimeStat().peakNotifyNum, NOTIFY_NUM);
+    RecordProperty("unshared_alloc_ns", std::to_string(unsharedNs));
+    RecordProperty("shared_alloc_ns", std::to_string(sharedNs));
+}
+
+TEST_F(SlaveResourcePoolTest, get_instance_rejects_invalid_device)
+{
+    SlaveResourcePool *pool = nullptr;
+    EXPECT_EQ(SlaveResourcePool::GetInstance(-1, pool), HCCL_E_PARA);
+    EXPECT_EQ(SlaveResourcePool::GetInstance(static_cast<s32>(MAX_MODULE_DEVICE_NUM), pool), HCCL_E_PARA);
+    EXPECT_EQ(pool, nullptr);
+}
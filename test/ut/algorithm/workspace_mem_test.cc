@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "workspace_arena.h"
+#include "workspace_mem.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u64 MOCK_ADDR_BASE = 0x200000000ULL;
+constexpr u64 WORKSPACE_32_KB = 32 * 1024;
+constexpr u64 TRACE_CHUNK_SIZE = 64 * 1024 * 1024;
+constexpr u32 TRACE_OP_NUM = 4096;
+constexpr u32 TRACE_MAX_LIVE_TAG = 32;
+constexpr u32 ALLOC_PER_OP = 8;
+constexpr u32 BENCH_ALLOC_NUM = 200000;
+
+/* mock device分配器: 只分配地址不申请内存, 统计向device申请的次数 */
+class MockWorkspaceAllocator {
+public:
+    WorkSpaceArenaAllocFunc Func()
+    {
+        return [this](u64 size) {
+            allocCount_++;
+            DeviceMem mem = DeviceMem::create(reinterpret_cast<void *>(nextAddr_), size);
+            nextAddr_ += size;
+            return mem;
+        };
+    }
+
+    u64 AllocCount() const
+    {
+        return allocCount_;
+    }
+
+private:
+    u64 nextAddr_{MOCK_ADDR_BASE};
+    u64 allocCount_{0};
+};
+
+/* 单算子模式的workspace借还序列: 每个tag借用32KB加一段CCL相关的大小, 存活tag数有上限, 随机释放 */
+struct WorkspaceTraceEvent {
+    bool borrow;
+    u32 tagId;
+    u64 size;
+};
+
+std::vector<WorkspaceTraceEvent> BuildWorkspaceTrace(u32 seed)
+{
+    std::mt19937 gen(seed);
+    std::vector<u64> opSizes = { 0, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024 - WORKSPACE_32_KB };
+    std::uniform_int_distribution<u32> sizeDist(0, opSizes.size() - 1);
+    std::vector<WorkspaceTraceEvent> trace;
+    std::vector<u32> liveTags;
+    for (u32 op = 0; op < TRACE_OP_NUM; op++) {
+        if (liveTags.size() >= TRACE_MAX_LIVE_TAG || (!liveTags.empty() && gen() % 2 == 0)) {
+            u32 pos = gen() % liveTags.size();
+            trace.push_back({ false, liveTags[pos], 0 });
+            liveTags.erase(liveTags.begin() + pos);
+        }
+        trace.push_back({ true, op, WORKSPACE_32_KB + opSizes[sizeDist(gen)] });
+        liveTags.push_back(op);
+    }
+    for (u32 tagId : liveTags) {
+        trace.push_back({ false, tagId, 0 });
+    }
+    return trace;
+}
+
+/* 按序回放借还序列 */
+void ReplayWorkspaceTrace(WorkSpaceArena &arena, const std::vector<WorkspaceTraceEvent> &trace)
+{
+    std::map<u32, DeviceMem> liveMems;
+    for (const WorkspaceTraceEvent &event : trace) {
+        if (event.borrow) {
+            DeviceMem mem;
+            ASSERT_EQ(arena.Borrow(event.size, mem), HCCL_SUCCESS);
+            ASSERT_EQ(mem.size(), event.size);
+            liveMems.emplace(event.tagId, std::move(mem));
+        } else {
+            auto iter = liveMems.find(event.tagId);
+            ASSERT_NE(iter, liveMems.end());
+            ASSERT_EQ(arena.Return(iter->second), HCCL_SUCCESS);
+            liveMems.erase(iter);
+        }
+    }
+}
+
+/* 模拟算子执行时对同一tag的多次AllocDeviceMem */
+u64 AllocOp(WorkSpaceMem &workSpaceMem, const std::string &tag, bool cached)
+{
+    u64 lastPtr = 0;
+    for (u32 i = 0; i < ALLOC_PER_OP; i++) {
+        WorkSpaceMemHandle handle = cached ? workSpaceMem.GetCachedHandle(tag) : workSpaceMem.GetHandle(tag);
+        lastPtr = reinterpret_cast<u64>(workSpaceMem.AllocMem(handle, 1, tag));
+    }
+    return lastPtr;
+}
+}
+
+/*
+ * workspace内存: WorkSpaceArena按trace回放统计device申请次数与碎片,
+ * WorkSpaceMem校验句柄缓存只在首次或tag重设后加锁查找
+ */
+class WorkspaceMemTest : public testing::Test {
+};
+
+TEST_F(WorkspaceMemTest, trace_replay_reduces_device_alloc_and_bounds_fragmentation)
+{
+    std::vector<WorkspaceTraceEvent> trace = BuildWorkspaceTrace(2025);
+    u64 borrowNum = 0;
+    u64 peakLiveSize = 0;
+    u64 liveSize = 0;
+    std::map<u32, u64> liveSizes;
+    for (const WorkspaceTraceEvent &event : trace) {
+        if (event.borrow) {
+            borrowNum++;
+            liveSizes[event.tagId] = event.size;
+            liveSize += event.size;
+            peakLiveSize = std::max(peakLiveSize, liveSize);
+        } else {
+            liveSize -= liveSizes[event.tagId];
+            liveSizes.erase(event.tagId);
+        }
+    }
+
+    MockWorkspaceAllocator allocator;
+    WorkSpaceArena arena(allocator.Func());
+    ASSERT_NO_FATAL_FAILURE(ReplayWorkspaceTrace(arena, trace));
+    WorkSpaceArenaStat stat = arena.GetStat();
+
+    // 原实现每个tag单独申请一次device内存
+    EXPECT_EQ(stat.borrowCount, borrowNum);
+    EXPECT_EQ(stat.chunkAllocCount, allocator.AllocCount());
+    EXPECT_LT(stat.chunkAllocCount * 100, borrowNum);
+    EXPECT_EQ(stat.usedSize, 0U);
+
+    // size class按2的幂次取整, 各class的空闲链表互不合并: 预留量不超过峰值的2倍加各class上尾部未用满的chunk
+    EXPECT_LE(stat.peakUsedSize, 2 * peakLiveSize);
+    EXPECT_LE(stat.peakReservedSize, 2 * stat.peakUsedSize + TRACE_CHUNK_SIZE);
+
+    // 稳态下重复回放同一trace不再向device申请
+    u64 firstReplayAllocNum = allocator.AllocCount();
+    ASSERT_NO_FATAL_FAILURE(ReplayWorkspaceTrace(arena, trace));
+    EXPECT_EQ(allocator.AllocCount(), firstReplayAllocNum);
+    EXPECT_EQ(arena.GetStat().peakReservedSize, stat.peakReservedSize);
+
+    RecordProperty("trace_borrow_num", std::to_string(borrowNum));
+    RecordProperty("per_tag_device_alloc_num", std::to_string(borrowNum));
+    RecordProperty("arena_device_alloc_num", std::to_string(stat.chunkAllocCount));
+    RecordProperty("peak_live_bytes", std::to_string(peakLiveSize));
+    RecordProperty("arena_peak_used_bytes", std::to_string(stat.peakUsedSize));
+    RecordProperty("arena_peak_reserved_bytes", std::to_string(stat.peakReservedSize));
+}
+
+TEST_F(WorkspaceMemTest, cached_handle_is_looked_up_once_per_tag)
+{
+    std::vector<u8> bufferA(ALLOC_PER_OP * 4);
+    std::vector<u8> bufferB(ALLOC_PER_OP * 4);
+    WorkSpaceMem workSpaceMem;
+    ASSERT_EQ(workSpaceMem.SetMemResource("tagA", bufferA.data(), bufferA.size()), HCCL_SUCCESS);
+    ASSERT_EQ(workSpaceMem.SetMemResource("tagB", bufferB.data(), bufferB.size()), HCCL_SUCCESS);
+
+    u64 lastPtr = AllocOp(workSpaceMem, "tagA", true);
+    EXPECT_EQ(lastPtr, reinterpret_cast<u64>(bufferA.data()) + ALLOC_PER_OP - 1);
+    EXPECT_EQ(workSpaceMem.GetHandleLookupCount(), 1U);
+
+    // 切换tag后重新查找一次
+    lastPtr = AllocOp(workSpaceMem, "tagB", true);
+    EXPECT_EQ(lastPtr, reinterpret_cast<u64>(bufferB.data()) + ALLOC_PER_OP - 1);
+    EXPECT_EQ(workSpaceMem.GetHandleLookupCount(), 2U);
+
+    // 未缓存的路径每次分配都加锁查找
+    AllocOp(workSpaceMem, "tagB", false);
+    EXPECT_EQ(workSpaceMem.GetHandleLookupCount(), 2U + ALLOC_PER_OP);
+}
+
+TEST_F(WorkspaceMemTest, cached_handle_is_refreshed_after_tag_is_reset)
+{
+    std::vector<u8> oldBuffer(ALLOC_PER_OP);
+    std::vector<u8> newBuffer(ALLOC_PER_OP);
+    std::vector<u8> otherBuffer(ALLOC_PER_OP);
+    WorkSpaceMem workSpaceMem;
+    ASSERT_EQ(workSpaceMem.SetMemResource("tag", oldBuffer.data(), oldBuffer.size()), HCCL_SUCCESS);
+    EXPECT_EQ(AllocOp(workSpaceMem, "tag", true), reinterpret_cast<u64>(oldBuffer.data()) + ALLOC_PER_OP - 1);
+
+    // 销毁后槽位被其他tag复用, 缓存的旧句柄不能命中新tag的资源
+    ASSERT_EQ(workSpaceMem.DestroyMemResource("tag"), HCCL_SUCCESS);
+    EXPECT_EQ(workSpaceMem.GetCachedHandle("tag"), INVALID_WORKSPACE_MEM_HANDLE);
+    ASSERT_EQ(workSpaceMem.SetMemResource("other", otherBuffer.data(), otherBuffer.size()), HCCL_SUCCESS);
+    ASSERT_EQ(workSpaceMem.SetMemResource("tag", newBuffer.data(), newBuffer.size()), HCCL_SUCCESS);
+    EXPECT_EQ(AllocOp(workSpaceMem, "tag", true), reinterpret_cast<u64>(newBuffer.data()) + ALLOC_PER_OP - 1);
+    EXPECT_EQ(AllocOp(workSpaceMem, "other", true), reinterpret_cast<u64>(otherBuffer.data()) + ALLOC_PER_OP - 1);
+
+    // 同地址上重建的实例不会命中上一个实例的缓存
+    std::vector<u8> nextBuffer(ALLOC_PER_OP);
+    workSpaceMem.~WorkSpaceMem();
+    new (&workSpaceMem) WorkSpaceMem();
+    EXPECT_EQ(workSpaceMem.GetCachedHandle("other"), INVALID_WORKSPACE_MEM_HANDLE);
+    ASSERT_EQ(workSpaceMem.SetMemResource("other", nextBuffer.data(), nextBuffer.size()), HCCL_SUCCESS);
+    EXPECT_EQ(AllocOp(workSpaceMem, "other", true), reinterpret_cast<u64>(nextBuffer.data()) + ALLOC_PER_OP - 1);
+}
+
+TEST_F(WorkspaceMemTest, cached_handle_alloc_benchmark)
+{
+    std::vector<u8> buffer(1);
+    WorkSpaceMem workSpaceMem;
+    const std::string tag = "AllReduce_hcom_aiv_workspace_group_0123456789";
+    ASSERT_EQ(workSpaceMem.SetMemResource(tag, buffer.data(), BENCH_ALLOC_NUM), HCCL_SUCCESS);
+    for (u32 i = 0; i < 64; i++) {
+        ASSERT_NE(workSpaceMem.GetHandle(tag), INVALID_WORKSPACE_MEM_HANDLE);
+    }
+
+    auto measure = [&workSpaceMem, &tag](bool cached) {
+        u64 validNum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (u32 i = 0; i < BENCH_ALLOC_NUM; i++) {
+            WorkSpaceMemHandle handle = cached ? workSpaceMem.GetCachedHandle(tag) : workSpaceMem.GetHandle(tag);
+            validNum += (handle != INVALID_WORKSPACE_MEM_HANDLE) ? 1 : 0;
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        EXPECT_EQ(validNum, BENCH_ALLOC_NUM);
+        return static_cast<double>(cost.count()) / BENCH_ALLOC_NUM;
+    };
+    u64 baseLookup = workSpaceMem.GetHandleLookupCount();
+    double lockedNs = measure(false);
+    double cachedNs = measure(true);
+    EXPECT_EQ(workSpaceMem.GetHandleLookupCount() - baseLookup, BENCH_ALLOC_NUM + 1U);
+
+    RecordProperty("locked_lookup_ns", std::to_string(lockedNs));
+    RecordProperty("cached_lookup_ns", std::to_string(cachedNs));
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include "prof_record_buffer.h"
+
+using namespace hccl;
+
+namespace {
+struct TestRecord {
+    u32 thread{0};
+    u32 index{0};
+};
+
+std::vector<u32> ReplayIndexes(ProfRecordBuffer<TestRecord> &buffer)
+{
+    std::vector<u32> indexes;
+    EXPECT_EQ(buffer.Replay([&indexes](TestRecord &record) {
+        indexes.push_back(record.index);
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    return indexes;
+}
+
+std::vector<u32> Range(u32 begin, u32 end)
+{
+    std::vector<u32> indexes;
+    for (u32 i = begin; i < end; i++) {
+        indexes.push_back(i);
+    }
+    return indexes;
+}
+
+/* threadNum个线程并发调用push, 每线程pushNum次, 返回单次push的平均耗时(ns) */
+template <typename F>
+double MeasurePush(u32 threadNum, u32 pushNum, F &&push)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < threadNum; t++) {
+        threads.emplace_back([&push, t, pushNum]() {
+            for (u32 i = 0; i < pushNum; i++) {
+                push(TestRecord{t, i});
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return static_cast<double>(costNs.count()) / (threadNum * pushNum);
+}
+}
+
+/* profiling记录缓存: 校验顺序、满时覆盖最早记录、消费语义、后台搬运与多线程写入, 并对比加锁队列的写入耗时 */
+class ProfRecordBufferTest : public testing::Test {
+};
+
+TEST_F(ProfRecordBufferTest, drain_returns_records_in_push_order)
+{
+    ProfRecordBuffer<TestRecord> buffer(8);
+    for (u32 i = 0; i < 5; i++) {
+        EXPECT_TRUE(buffer.Push(TestRecord{0, i}));
+    }
+    std::vector<u32> indexes;
+    EXPECT_EQ(buffer.Drain([&indexes](TestRecord &record) {
+        indexes.push_back(record.index);
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    EXPECT_EQ(indexes, Range(0, 5));
+    EXPECT_EQ(buffer.Size(), 0U);
+    EXPECT_TRUE(ReplayIndexes(buffer).empty());
+}
+
+TEST_F(ProfRecordBufferTest, replay_only_buffer_keeps_latest_records_after_overflow)
+{
+    ProfRecordBuffer<TestRecord> buffer(8);
+    for (u32 i = 0; i < 20; i++) {
+        buffer.Push(TestRecord{0, i});
+    }
+    EXPECT_EQ(ReplayIndexes(buffer), Range(12, 20));
+    EXPECT_EQ(buffer.GetDropCount(), 12U);
+    EXPECT_EQ(buffer.Size(), 8U);
+
+    // 只补报不消费时缓存仍持续接收新记录
+    for (u32 i = 20; i < 25; i++) {
+        EXPECT_TRUE(buffer.Push(TestRecord{0, i}));
+    }
+    EXPECT_EQ(ReplayIndexes(buffer), Range(17, 25));
+    EXPECT_EQ(ReplayIndexes(buffer), Range(17, 25));
+
+    buffer.Clear();
+    EXPECT_EQ(buffer.Size(), 0U);
+    EXPECT_TRUE(ReplayIndexes(buffer).empty());
+    EXPECT_TRUE(buffer.Push(TestRecord{0, 25}));
+    EXPECT_EQ(ReplayIndexes(buffer), Range(25, 26));
+}
+
+TEST_F(ProfRecordBufferTest, consumed_records_are_not_counted_as_dropped)
+{
+    ProfRecordBuffer<TestRecord> buffer(8);
+    for (u32 round = 0; round < 4; round++) {
+        for (u32 i = 0; i < 8; i++) {
+            buffer.Push(TestRecord{0, round * 8 + i});
+        }
+        u32 drained = 0;
+        EXPECT_EQ(buffer.Drain([&drained](TestRecord &) {
+            drained++;
+            return HCCL_SUCCESS;
+        }), HCCL_SUCCESS);
+        EXPECT_EQ(drained, 8U);
+    }
+    EXPECT_EQ(buffer.GetDropCount(), 0U);
+}
+
+TEST_F(ProfRecordBufferTest, drain_keeps_remaining_records_after_failure)
+{
+    ProfRecordBuffer<TestRecord> buffer(8);
+    for (u32 i = 0; i < 6; i++) {
+        buffer.Push(TestRecord{0, i});
+    }
+    EXPECT_EQ(buffer.Drain([](TestRecord &record) {
+        return record.index == 2 ? HCCL_E_INTERNAL : HCCL_SUCCESS;
+    }), HCCL_E_INTERNAL);
+    EXPECT_EQ(ReplayIndexes(buffer), Range(3, 6));
+}
+
+TEST_F(ProfRecordBufferTest, concurrent_push_keeps_every_record_within_capacity)
+{
+    constexpr u32 threadNum = 8;
+    constexpr u32 pushNum = 8192;
+    ProfRecordBuffer<TestRecord> buffer(threadNum * pushNum);
+    (void)MeasurePush(threadNum, pushNum, [&buffer](const TestRecord &record) { (void)buffer.Push(record); });
+
+    std::vector<u32> nextIndex(threadNum, 0);
+    EXPECT_EQ(buffer.Drain([&nextIndex](TestRecord &record) {
+        // 同一线程的记录保持写入顺序
+        EXPECT_EQ(record.index, nextIndex[record.thread]);
+        nextIndex[record.thread] = record.index + 1;
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    for (u32 t = 0; t < threadNum; t++) {
+        EXPECT_EQ(nextIndex[t], pushNum) << "thread " << t;
+    }
+    EXPECT_EQ(buffer.GetDropCount(), 0U);
+}
+
+TEST_F(ProfRecordBufferTest, concurrent_push_and_drain_never_duplicate_records)
+{
+    constexpr u32 threadNum = 4;
+    constexpr u32 pushNum = 20000;
+    ProfRecordBuffer<TestRecord> buffer(1024);
+    std::vector<std::vector<bool>> seen(threadNum, std::vector<bool>(pushNum, false));
+    u64 consumed = 0;
+    bool duplicated = false;
+    auto drainFunc = [&seen, &consumed, &duplicated](TestRecord &record) {
+        duplicated = duplicated || seen[record.thread][record.index];
+        seen[record.thread][record.index] = true;
+        consumed++;
+        return HCCL_SUCCESS;
+    };
+
+    std::atomic<bool> done{false};
+    std::thread consumer([&buffer, &done, &drainFunc]() {
+        while (!done.load()) {
+            (void)buffer.Drain(drainFunc);
+        }
+    });
+    (void)MeasurePush(threadNum, pushNum, [&buffer](const TestRecord &record) { (void)buffer.Push(record); });
+    done.store(true);
+    consumer.join();
+    (void)buffer.Drain(drainFunc);
+
+    EXPECT_FALSE(duplicated);
+    EXPECT_LE(consumed, static_cast<u64>(threadNum) * pushNum);
+    EXPECT_GE(consumed + buffer.GetDropCount(), static_cast<u64>(threadNum) * pushNum);
+    RecordProperty("consumed", std::to_string(consumed));
+    RecordProperty("dropped", std::to_string(buffer.GetDropCount()));
+}
+
+TEST_F(ProfRecordBufferTest, replay_passes_stored_records_in_place)
+{
+    // 补报直接访问保留区中的记录, 两次补报看到的是同一份记录, 不做拷贝
+    ProfRecordBuffer<TestRecord> buffer(64);
+    for (u32 i = 0; i < 10; i++) {
+        buffer.Push(TestRecord{0, i});
+    }
+    std::vector<const TestRecord *> first;
+    EXPECT_EQ(buffer.Replay([&first](TestRecord &record) {
+        first.push_back(&record);
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    std::vector<const TestRecord *> second;
+    EXPECT_EQ(buffer.Replay([&second](TestRecord &record) {
+        second.push_back(&record);
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    EXPECT_EQ(first.size(), 10U);
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(ProfRecordBufferTest, capacity_follows_record_size_and_memory_is_lazy)
+{
+    struct LargeRecord {
+        u8 data[256];
+    };
+    EXPECT_EQ(ProfRecordBuffer<TestRecord>::DefaultCapacity(), PROF_RECORD_BUFFER_BYTES / sizeof(TestRecord));
+    EXPECT_EQ(ProfRecordBuffer<LargeRecord>::DefaultCapacity(), PROF_RECORD_BUFFER_BYTES / sizeof(LargeRecord));
+
+    // 未写入的缓存不占内存, 写入后只申请本线程的环形队列和保留区的一块
+    ProfRecordBuffer<LargeRecord> buffer;
+    EXPECT_EQ(buffer.GetReservedBytes(), 0U);
+    EXPECT_EQ(buffer.Size(), 0U);
+    EXPECT_EQ(buffer.GetReservedBytes(), 0U);
+    buffer.Push(LargeRecord{});
+    EXPECT_EQ(buffer.Size(), 1U);
+    EXPECT_EQ(buffer.GetReservedBytes(), PROF_RECORD_RING_BYTES + PROF_RECORD_CHUNK_BYTES);
+    EXPECT_LT(buffer.GetReservedBytes(), PROF_RECORD_BUFFER_BYTES);
+}
+
+TEST_F(ProfRecordBufferTest, background_drainer_collects_producer_rings)
+{
+    ProfRecordBuffer<TestRecord> buffer(4096);
+    std::thread producer([&buffer]() {
+        for (u32 i = 0; i < 100; i++) {
+            buffer.Push(TestRecord{0, i});
+        }
+    });
+    producer.join();
+    // 不调用Replay/Drain, 后台线程也会把记录搬入保留区
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (buffer.GetPendingNum() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(buffer.GetPendingNum(), 0U);
+    EXPECT_EQ(ReplayIndexes(buffer), Range(0, 100));
+}
+
+TEST_F(ProfRecordBufferTest, full_ring_is_collected_by_producer)
+{
+    // 环形队列容量远小于写入量, 后台线程来不及搬运时由写入线程自行搬运, 不丢记录
+    ProfRecordBuffer<TestRecord> buffer(100000);
+    for (u32 i = 0; i < 100000; i++) {
+        EXPECT_TRUE(buffer.Push(TestRecord{0, i}));
+    }
+    EXPECT_EQ(ReplayIndexes(buffer), Range(0, 100000));
+    EXPECT_EQ(buffer.GetDropCount(), 0U);
+}
+
+TEST_F(ProfRecordBufferTest, producers_beyond_ring_limit_and_recycled_threads_keep_records)
+{
+    // 同时存活的写入线程多于环形队列数时, 多出的线程加锁写入; 线程退出后编号与环形队列被后续线程复用
+    constexpr u32 threadNum = PROF_RECORD_MAX_PRODUCER_NUM + 8;
+    constexpr u32 pushNum = 50;
+    ProfRecordBuffer<TestRecord> buffer(threadNum * pushNum * 4);
+    for (u32 round = 0; round < 2; round++) {
+        std::atomic<u32> started{0};
+        std::vector<std::thread> threads;
+        for (u32 t = 0; t < threadNum; t++) {
+            threads.emplace_back([&buffer, &started, t, round]() {
+                started++;
+                while (started.load() < threadNum) {
+                    std::this_thread::yield();
+                }
+                for (u32 i = 0; i < pushNum; i++) {
+                    EXPECT_TRUE(buffer.Push(TestRecord{round * threadNum + t, i}));
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::vector<u32> nextIndex(threadNum * 2, 0);
+    EXPECT_EQ(buffer.Drain([&nextIndex](TestRecord &record) {
+        EXPECT_EQ(record.index, nextIndex[record.thread]);
+        nextIndex[record.thread] = record.index + 1;
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    for (u32 t = 0; t < threadNum * 2; t++) {
+        EXPECT_EQ(nextIndex[t], pushNum) << "thread " << t;
+    }
+    EXPECT_EQ(buffer.GetDropCount(), 0U);
+}
+
+TEST_F(ProfRecordBufferTest, push_cost_compared_with_locked_queue)
+{
+    constexpr u32 pushNum = 50000;
+    for (u32 threadNum : {1U, 4U, 8U}) {
+        ProfRecordBuffer<TestRecord> buffer;
+        double bufferNs = MeasurePush(threadNum, pushNum,
+            [&buffer](const TestRecord &record) { (void)buffer.Push(record); });
+
+        std::mutex queueMutex;
+        std::queue<TestRecord> queue;
+        double queueNs = MeasurePush(threadNum, pushNum, [&queueMutex, &queue](const TestRecord &record) {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queue.push(record);
+        });
+        EXPECT_EQ(queue.size(), static_cast<size_t>(threadNum) * pushNum);
+        EXPECT_EQ(buffer.Size(), std::min(ProfRecordBuffer<TestRecord>::DefaultCapacity(), threadNum * pushNum));
+        std::string prefix = "thread" + std::to_string(threadNum) + "_";
+        RecordProperty(prefix + "buffer_push_ns", std::to_string(bufferNs));
+        RecordProperty(prefix + "locked_queue_push_ns", std::to_string(queueNs));
+    }
+}
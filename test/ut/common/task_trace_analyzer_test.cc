@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "task_duration_model.h"
+#include "task_trace_analyzer_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 MAIN_STREAM = 0;
+constexpr u32 AUX_STREAM = 1;
+constexpr u64 NOTIFY_MAIN_TO_AUX = 1;
+constexpr u64 NOTIFY_AUX_TO_MAIN = 2;
+constexpr u64 SMALL_SIZE = 1024;
+constexpr u64 LARGE_SIZE = 4 * 1024 * 1024;
+constexpr u32 REMOTE_RANK = 3;
+}
+
+/* task流分析: 按主从流fork/join构造task序列, 校验notify按序号配对、关键路径与串行段 */
+class TaskTraceAnalyzerTest : public testing::Test {
+protected:
+    static TraceTask Dma(u32 streamID, u64 size, u32 remoteRank = INVALID_VALUE_RANKID,
+        LinkType linkType = LinkType::LINK_ONCHIP)
+    {
+        TraceTask task;
+        task.streamID = streamID;
+        task.taskType = TaskType::TASK_SDMA;
+        task.size = size;
+        task.remoteRank = remoteRank;
+        task.linkType = linkType;
+        return task;
+    }
+
+    static TraceTask Notify(u32 streamID, TaskType taskType, u64 notifyID)
+    {
+        TraceTask task;
+        task.streamID = streamID;
+        task.taskType = taskType;
+        task.notifyID = notifyID;
+        return task;
+    }
+
+    // 主流: 小包拷贝 -> 通知从流 -> 等待从流 -> 小包拷贝
+    static std::vector<TraceTask> MainRound()
+    {
+        return { Dma(MAIN_STREAM, SMALL_SIZE),
+            Notify(MAIN_STREAM, TaskType::TASK_NOTIFY_RECORD, NOTIFY_MAIN_TO_AUX),
+            Notify(MAIN_STREAM, TaskType::TASK_NOTIFY_WAIT, NOTIFY_AUX_TO_MAIN),
+            Dma(MAIN_STREAM, SMALL_SIZE) };
+    }
+
+    // 从流: 等待主流 -> 跨片大包拷贝 -> 通知主流
+    static std::vector<TraceTask> AuxRound()
+    {
+        return { Notify(AUX_STREAM, TaskType::TASK_NOTIFY_WAIT, NOTIFY_MAIN_TO_AUX),
+            Dma(AUX_STREAM, LARGE_SIZE, REMOTE_RANK, LinkType::LINK_HCCS),
+            Notify(AUX_STREAM, TaskType::TASK_NOTIFY_RECORD, NOTIFY_AUX_TO_MAIN) };
+    }
+
+    static void AddTasks(TaskTraceAnalyzer &analyzer, const std::vector<TraceTask> &tasks)
+    {
+        for (const TraceTask &task : tasks) {
+            ASSERT_EQ(analyzer.AddTask(task), HCCL_SUCCESS);
+        }
+    }
+
+    static double RoundMakespanUs()
+    {
+        double smallUs = EstimateTaskDuration(TaskType::TASK_SDMA, SMALL_SIZE);
+        double largeUs = EstimateTaskDuration(TaskType::TASK_SDMA, LARGE_SIZE);
+        return 2 * smallUs + largeUs + 2 * DURATION_NOTIFY_RECORD + 2 * DURATION_NOTIFY_WAIT;
+    }
+};
+
+TEST_F(TaskTraceAnalyzerTest, duration_model_matches_profiling_constants)
+{
+    EXPECT_DOUBLE_EQ(EstimateTaskDuration(TaskType::TASK_SDMA, SMALL_SIZE),
+        SMALL_SIZE / DURATION_SDMA_BANDWIDTH_MB + DURATION_SDMA_FIXED_THRESHOLD_BELOW);
+    // inline reduce按自身数据量选择固定开销
+    EXPECT_DOUBLE_EQ(EstimateTaskDuration(TaskType::TASK_REDUCE_INLINE, LARGE_SIZE),
+        LARGE_SIZE / DURATION_SDMA_BANDWIDTH_MB + DURATION_SDMA_FIXED_THRESHOLD_ABOVE);
+    EXPECT_DOUBLE_EQ(EstimateTaskDuration(TaskType::TASK_RDMA, LARGE_SIZE),
+        LARGE_SIZE / DURATION_RDMA_BANDWIDTH_MB + DURATION_RDMA_FIXED);
+    EXPECT_DOUBLE_EQ(EstimateTaskDuration(TaskType::TASK_NOTIFY_WAIT, 0), DURATION_NOTIFY_WAIT);
+    EXPECT_DOUBLE_EQ(EstimateTaskDuration(TaskType::TASK_AIV, LARGE_SIZE), 0);
+}
+
+TEST_F(TaskTraceAnalyzerTest, fork_join_critical_path_runs_through_aux_stream)
+{
+    TaskTraceAnalyzer analyzer;
+    AddTasks(analyzer, MainRound());
+    AddTasks(analyzer, AuxRound());
+    TaskTraceReport report;
+    ASSERT_EQ(analyzer.Analyze(report), HCCL_SUCCESS);
+
+    double largeUs = EstimateTaskDuration(TaskType::TASK_SDMA, LARGE_SIZE);
+    EXPECT_NEAR(report.makespanUs, RoundMakespanUs(), 1e-6);
+    // 主流4个task在前, 从流3个task在后: a, r1, w1, b, r2, w2, d
+    EXPECT_EQ(report.criticalPath, std::vector<u32>({ 0, 1, 4, 5, 6, 2, 3 }));
+    EXPECT_NEAR(report.criticalPathBusyUs, RoundMakespanUs() - 2 * DURATION_NOTIFY_WAIT, 1e-6);
+    EXPECT_EQ(report.bottleneckRemoteRank, REMOTE_RANK);
+    EXPECT_EQ(report.bottleneckLinkType, LinkType::LINK_HCCS);
+    EXPECT_NEAR(report.bottleneckUs, largeUs, 1e-6);
+
+    // 主流等待从流大包拷贝的wait阻塞最久
+    ASSERT_EQ(report.serializedSegments.size(), 2U);
+    EXPECT_EQ(report.serializedSegments[0].waitStreamID, MAIN_STREAM);
+    EXPECT_EQ(report.serializedSegments[0].recordStreamID, AUX_STREAM);
+    EXPECT_EQ(report.serializedSegments[0].notifyID, NOTIFY_AUX_TO_MAIN);
+    EXPECT_NEAR(report.serializedSegments[0].blockedUs, largeUs + DURATION_NOTIFY_RECORD + DURATION_NOTIFY_WAIT,
+        1e-6);
+    EXPECT_GT(report.overlapRatio, 0);
+    EXPECT_FALSE(report.ToString().empty());
+}
+
+TEST_F(TaskTraceAnalyzerTest, repeated_notify_pairs_by_sequence_regardless_of_add_order)
+{
+    /* 同一对notify在多轮fork/join中复用, 第k次wait必须与第k次record配对, 且与各流task的加入先后无关 */
+    constexpr u32 roundNum = 3;
+    std::vector<TraceTask> mainTasks;
+    std::vector<TraceTask> auxTasks;
+    for (u32 round = 0; round < roundNum; round++) {
+        std::vector<TraceTask> mainRound = MainRound();
+        std::vector<TraceTask> auxRound = AuxRound();
+        mainTasks.insert(mainTasks.end(), mainRound.begin(), mainRound.end());
+        auxTasks.insert(auxTasks.end(), auxRound.begin(), auxRound.end());
+    }
+
+    TaskTraceAnalyzer mainFirst;
+    AddTasks(mainFirst, mainTasks);
+    AddTasks(mainFirst, auxTasks);
+    TaskTraceAnalyzer auxFirst;
+    AddTasks(auxFirst, auxTasks);
+    AddTasks(auxFirst, mainTasks);
+    TaskTraceAnalyzer interleaved;
+    for (u32 round = 0; round < roundNum; round++) {
+        AddTasks(interleaved, MainRound());
+        AddTasks(interleaved, AuxRound());
+    }
+
+    for (TaskTraceAnalyzer *analyzer : { &mainFirst, &auxFirst, &interleaved }) {
+        TaskTraceReport report;
+        ASSERT_EQ(analyzer->Analyze(report), HCCL_SUCCESS);
+        EXPECT_NEAR(report.makespanUs, roundNum * RoundMakespanUs(), 1e-6);
+        EXPECT_EQ(report.criticalPath.size(), roundNum * (MainRound().size() + AuxRound().size()));
+        EXPECT_EQ(report.serializedSegments.size(), roundNum * 2);
+    }
+}
+
+TEST_F(TaskTraceAnalyzerTest, measured_wait_without_record_is_reported_as_remote)
+{
+    TaskTraceAnalyzer analyzer(TraceDurationMode::TRACE_DURATION_MEASURED);
+    TraceTask copy = Dma(MAIN_STREAM, SMALL_SIZE);
+    copy.beginNs = 0;
+    copy.endNs = 1000;
+    ASSERT_EQ(analyzer.AddTask(copy), HCCL_SUCCESS);
+    TraceTask wait = Notify(MAIN_STREAM, TaskType::TASK_NOTIFY_WAIT, 9);
+    wait.beginNs = 1000;
+    wait.endNs = 51000;
+    ASSERT_EQ(analyzer.AddTask(wait), HCCL_SUCCESS);
+    copy.beginNs = 51000;
+    copy.endNs = 52000;
+    ASSERT_EQ(analyzer.AddTask(copy), HCCL_SUCCESS);
+
+    TaskTraceReport report;
+    ASSERT_EQ(analyzer.Analyze(report), HCCL_SUCCESS);
+    EXPECT_NEAR(report.makespanUs, 52.0, 1e-6);
+    EXPECT_NEAR(report.streamBusyUs[MAIN_STREAM], 2.0, 1e-6);
+    EXPECT_NEAR(report.streamIdleUs[MAIN_STREAM], 50.0, 1e-6);
+    ASSERT_EQ(report.serializedSegments.size(), 1U);
+    EXPECT_EQ(report.serializedSegments[0].recordStreamID, INVALID_UINT);
+    EXPECT_NEAR(report.serializedSegments[0].blockedUs, 50.0 - DURATION_NOTIFY_WAIT, 1e-6);
+}
+
+TEST_F(TaskTraceAnalyzerTest, invalid_trace_is_rejected)
+{
+    TaskTraceAnalyzer measured(TraceDurationMode::TRACE_DURATION_MEASURED);
+    TraceTask task = Dma(MAIN_STREAM, SMALL_SIZE);
+    task.beginNs = 2000;
+    task.endNs = 1000;
+    EXPECT_EQ(measured.AddTask(task), HCCL_E_PARA);
+
+    // 两条流互相等待对方后续的record, 构成环
+    TaskTraceAnalyzer cyclic;
+    AddTasks(cyclic, { Notify(MAIN_STREAM, TaskType::TASK_NOTIFY_WAIT, NOTIFY_AUX_TO_MAIN),
+        Notify(MAIN_STREAM, TaskType::TASK_NOTIFY_RECORD, NOTIFY_MAIN_TO_AUX),
+        Notify(AUX_STREAM, TaskType::TASK_NOTIFY_WAIT, NOTIFY_MAIN_TO_AUX),
+        Notify(AUX_STREAM, TaskType::TASK_NOTIFY_RECORD, NOTIFY_AUX_TO_MAIN) });
+    TaskTraceReport report;
+    EXPECT_EQ(cyclic.Analyze(report), HCCL_E_PARA);
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "hccl_nslbdp_sender.h"
+
+using namespace hccl;
+
+/* 表2后台发送: 用记录TLV的桩sink替代H2DTlvRequest, 校验窗口内合并、Stop补发与重新拉起 */
+class NslbDpTableSenderTest : public testing::Test {
+protected:
+    // TLV首字节为记录下标, 第二字节为版本号
+    static std::vector<uint8_t> MakeTlv(size_t recordIndex, uint8_t version)
+    {
+        return { static_cast<uint8_t>(recordIndex), version };
+    }
+
+    NslbDpTlvSink Sink()
+    {
+        return [this](const std::vector<uint8_t> &tlvData) {
+            std::lock_guard<std::mutex> lock(sinkMutex_);
+            sentTlvs_.push_back(tlvData);
+        };
+    }
+
+    std::vector<std::vector<uint8_t>> SentTlvs()
+    {
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        return sentTlvs_;
+    }
+
+    bool WaitSentNum(size_t sentNum, std::chrono::milliseconds timeout)
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (SentTlvs().size() >= sentNum) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return SentTlvs().size() >= sentNum;
+    }
+
+    std::mutex sinkMutex_;
+    std::vector<std::vector<uint8_t>> sentTlvs_;
+};
+
+TEST_F(NslbDpTableSenderTest, updates_within_window_send_latest_once)
+{
+    NslbDpTableSender sender(Sink(), 200);
+    for (uint8_t version = 0; version < 10; version++) {
+        ASSERT_EQ(sender.Enqueue(0, MakeTlv(0, version)), HCCL_SUCCESS);
+    }
+    ASSERT_EQ(sender.Enqueue(1, MakeTlv(1, 0)), HCCL_SUCCESS);
+    ASSERT_TRUE(WaitSentNum(2, std::chrono::seconds(5)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::vector<std::vector<uint8_t>> sent = SentTlvs();
+    ASSERT_EQ(sent.size(), 2U);
+    EXPECT_EQ(sent[0], MakeTlv(0, 9));
+    EXPECT_EQ(sent[1], MakeTlv(1, 0));
+}
+
+TEST_F(NslbDpTableSenderTest, stop_flushes_pending_without_waiting_window)
+{
+    NslbDpTableSender sender(Sink(), 60 * 1000);
+    for (size_t recordIndex = 0; recordIndex < 3; recordIndex++) {
+        ASSERT_EQ(sender.Enqueue(recordIndex, MakeTlv(recordIndex, 1)), HCCL_SUCCESS);
+    }
+    EXPECT_TRUE(sender.IsRunning());
+
+    auto start = std::chrono::steady_clock::now();
+    sender.Stop();
+    auto stopTime = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(stopTime, std::chrono::seconds(5));
+    EXPECT_FALSE(sender.IsRunning());
+    EXPECT_EQ(SentTlvs().size(), 3U);
+
+    // 已停止时再次Stop为空操作
+    sender.Stop();
+    EXPECT_EQ(SentTlvs().size(), 3U);
+}
+
+TEST_F(NslbDpTableSenderTest, enqueue_after_stop_restarts_sender)
+{
+    NslbDpTableSender sender(Sink(), 1);
+    ASSERT_EQ(sender.Enqueue(0, MakeTlv(0, 1)), HCCL_SUCCESS);
+    sender.Stop();
+    EXPECT_FALSE(sender.IsRunning());
+
+    ASSERT_EQ(sender.Enqueue(0, MakeTlv(0, 2)), HCCL_SUCCESS);
+    EXPECT_TRUE(sender.IsRunning());
+    ASSERT_TRUE(WaitSentNum(2, std::chrono::seconds(5)));
+    sender.Stop();
+
+    std::vector<std::vector<uint8_t>> sent = SentTlvs();
+    ASSERT_EQ(sent.size(), 2U);
+    EXPECT_EQ(sent[1], MakeTlv(0, 2));
+}
+
+TEST_F(NslbDpTableSenderTest, idle_sender_thread_exits_and_restarts)
+{
+    NslbDpTableSender sender(Sink(), 1, 20);
+    ASSERT_EQ(sender.Enqueue(0, MakeTlv(0, 1)), HCCL_SUCCESS);
+    ASSERT_TRUE(WaitSentNum(1, std::chrono::seconds(5)));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sender.IsRunning() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_FALSE(sender.IsRunning());
+
+    ASSERT_EQ(sender.Enqueue(0, MakeTlv(0, 2)), HCCL_SUCCESS);
+    ASSERT_TRUE(WaitSentNum(2, std::chrono::seconds(5)));
+    sender.Stop();
+    EXPECT_EQ(SentTlvs().back(), MakeTlv(0, 2));
+}
+
+TEST_F(NslbDpTableSenderTest, concurrent_stop_loses_no_record)
+{
+    /* 多个通信域并发下发算子时, 另一通信域销毁触发Stop, 每条记录的最终版本都必须发出 */
+    constexpr size_t producerNum = 4;
+    constexpr size_t recordPerProducer = 50;
+    constexpr uint8_t versionNum = 20;
+    NslbDpTableSender sender(Sink(), 1);
+
+    std::atomic<bool> producing(true);
+    std::thread stopper([&sender, &producing] {
+        while (producing.load()) {
+            sender.Stop();
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producerNum; producer++) {
+        producers.emplace_back([&sender, producer] {
+            for (uint8_t version = 1; version <= versionNum; version++) {
+                for (size_t i = 0; i < recordPerProducer; i++) {
+                    size_t recordIndex = producer * recordPerProducer + i;
+                    EXPECT_EQ(sender.Enqueue(recordIndex, MakeTlv(recordIndex, version)), HCCL_SUCCESS);
+                }
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    producing = false;
+    stopper.join();
+    sender.Stop();
+    EXPECT_FALSE(sender.IsRunning());
+
+    std::map<size_t, uint8_t> lastVersion;
+    for (const auto &tlv : SentTlvs()) {
+        ASSERT_EQ(tlv.size(), 2U);
+        uint8_t &version = lastVersion[tlv[0]];
+        EXPECT_GT(tlv[1], version) << "record " << static_cast<u32>(tlv[0]);
+        version = tlv[1];
+    }
+    ASSERT_EQ(lastVersion.size(), producerNum * recordPerProducer);
+    for (const auto &record : lastVersion) {
+        EXPECT_EQ(record.second, versionNum) << "record " << record.first;
+    }
+}
+
+TEST_F(NslbDpTableSenderTest, abandon_drops_pending_without_join)
+{
+    // Abandon后发送线程已分离, 对象需保持有效, 与单例在静态析构阶段的用法一致
+    NslbDpTableSender *sender = new NslbDpTableSender(Sink(), 60 * 1000);
+    ASSERT_EQ(sender->Enqueue(0, MakeTlv(0, 1)), HCCL_SUCCESS);
+    sender->Abandon();
+    EXPECT_FALSE(sender->IsRunning());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_TRUE(SentTlvs().empty());
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "hcom_group_rank_desc.h"
+
+/* group rank映射的只读描述与快照: 与原有的加锁线性查找逐项比对, 并在多线程并发增删group时校验查询结果 */
+class HcomGroupRankDescTest : public testing::Test {
+protected:
+    // 原实现: 在groupRanks中线性查找worldRank
+    static u32 LinearGroupRank(const std::vector<u32> &groupRanks, u32 worldRank)
+    {
+        for (u32 rank = 0; rank < groupRanks.size(); rank++) {
+            if (groupRanks[rank] == worldRank) {
+                return rank;
+            }
+        }
+        return INVALID_VALUE_RANKID;
+    }
+
+    static std::vector<u32> RandomGroupRanks(std::mt19937 &gen, u32 worldRankSize, u32 groupRankSize)
+    {
+        std::vector<u32> worldRanks(worldRankSize);
+        std::iota(worldRanks.begin(), worldRanks.end(), 0);
+        std::shuffle(worldRanks.begin(), worldRanks.end(), gen);
+        std::vector<u32> groupRanks(worldRanks.begin(), worldRanks.begin() + groupRankSize);
+        std::sort(groupRanks.begin(), groupRanks.end());
+        return groupRanks;
+    }
+};
+
+TEST_F(HcomGroupRankDescTest, random_groups_match_linear_lookup)
+{
+    std::mt19937 gen(20251019);
+    for (u32 round = 0; round < 500; round++) {
+        u32 worldRankSize = std::uniform_int_distribution<u32>(1, 4096)(gen);
+        // 一半用例的group远小于world, 覆盖稀疏映射
+        u32 maxGroupSize = (round % 2 == 0) ? worldRankSize : std::max(1U, worldRankSize / 16);
+        u32 groupRankSize = std::uniform_int_distribution<u32>(1, maxGroupSize)(gen);
+        std::vector<u32> groupRanks = RandomGroupRanks(gen, worldRankSize, groupRankSize);
+
+        std::shared_ptr<const HcomGroupRankDesc> desc;
+        ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, groupRanks, worldRankSize, desc), HCCL_SUCCESS);
+        ASSERT_EQ(desc->totalRanks, groupRankSize);
+        ASSERT_EQ(desc->groupToWorld, groupRanks);
+        for (u32 worldRank = 0; worldRank <= worldRankSize; worldRank++) {
+            u32 expect = LinearGroupRank(groupRanks, worldRank);
+            u32 groupRank = INVALID_VALUE_RANKID;
+            HcclResult ret = HcomGetGroupRankByWorldRank(*desc, worldRank, groupRank);
+            ASSERT_EQ(ret, (expect == INVALID_VALUE_RANKID) ? HCCL_E_PARA : HCCL_SUCCESS)
+                << "round " << round << " worldRank " << worldRank;
+            ASSERT_EQ(groupRank, expect) << "round " << round << " worldRank " << worldRank;
+        }
+    }
+}
+
+TEST_F(HcomGroupRankDescTest, world_rank_out_of_range_is_rejected)
+{
+    std::shared_ptr<const HcomGroupRankDesc> desc;
+    EXPECT_EQ(HcomBuildGroupRankDesc(0, 1, {0, 3, 8}, 8, desc), HCCL_E_PARA);
+}
+
+TEST_F(HcomGroupRankDescTest, concurrent_lookup_while_groups_change)
+{
+    /* 8个读线程反复查询常驻group, 1个写线程不断增删其他group; 同时与"加锁+线性查找"的原实现对比耗时 */
+    constexpr u32 worldRankSize = 1024;
+    constexpr u32 readerNum = 8;
+    constexpr u32 lookupNum = 20000;
+    std::mt19937 gen(1019);
+    std::vector<std::string> groups;
+    std::vector<std::vector<u32>> groupRanksList;
+    std::shared_ptr<const HcomGroupRankSnapshot> snapshot;
+    std::unordered_map<std::string, std::vector<u32>> lockedGroupMap;
+    for (u32 i = 0; i < 16; i++) {
+        groups.push_back("group_" + std::to_string(i));
+        groupRanksList.push_back(RandomGroupRanks(gen, worldRankSize, 256));
+        std::shared_ptr<const HcomGroupRankDesc> desc;
+        ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, groupRanksList[i], worldRankSize, desc), HCCL_SUCCESS);
+        HcomPublishGroupRankDesc(snapshot, groups[i], desc);
+        lockedGroupMap.emplace(groups[i], groupRanksList[i]);
+    }
+
+    std::atomic<bool> writerStop{false};
+    std::mutex writeMutex;
+    std::thread writer([&]() {
+        std::shared_ptr<const HcomGroupRankDesc> desc;
+        (void)HcomBuildGroupRankDesc(0, 1, groupRanksList[0], worldRankSize, desc);
+        for (u32 i = 0; !writerStop.load(); i++) {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            std::string temp = "temp_" + std::to_string(i % 4);
+            HcomPublishGroupRankDesc(snapshot, temp, (i % 8 < 4) ? desc : nullptr);
+        }
+    });
+
+    std::atomic<u32> errorNum{0};
+    auto runReaders = [&](bool useSnapshot) {
+        std::vector<std::thread> readers;
+        auto startTime = std::chrono::steady_clock::now();
+        for (u32 t = 0; t < readerNum; t++) {
+            readers.emplace_back([&, t]() {
+                const std::string &group = groups[t];
+                const std::vector<u32> &groupRanks = groupRanksList[t];
+                for (u32 i = 0; i < lookupNum; i++) {
+                    u32 worldRank = groupRanks[i % groupRanks.size()];
+                    u32 groupRank = INVALID_VALUE_RANKID;
+                    if (useSnapshot) {
+                        auto desc = HcomLookupGroupRankDesc(snapshot, group.c_str());
+                        if (desc == nullptr ||
+                            HcomGetGroupRankByWorldRank(*desc, worldRank, groupRank) != HCCL_SUCCESS) {
+                            errorNum++;
+                            continue;
+                        }
+                    } else {
+                        std::lock_guard<std::mutex> lock(writeMutex);
+                        groupRank = LinearGroupRank(lockedGroupMap.at(group), worldRank);
+                    }
+                    if (groupRank != i % groupRanks.size()) {
+                        errorNum++;
+                    }
+                }
+            });
+        }
+        for (auto &reader : readers) {
+            reader.join();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+    };
+    auto lockedTime = runReaders(false);
+    auto snapshotTime = runReaders(true);
+    writerStop.store(true);
+    writer.join();
+
+    EXPECT_EQ(errorNum.load(), 0U);
+    RecordProperty("locked_linear_us", std::to_string(lockedTime.count()));
+    RecordProperty("snapshot_us", std::to_string(snapshotTime.count()));
+}
+
+TEST_F(HcomGroupRankDescTest, lookup_is_consistent_while_writer_holds_lock)
+{
+    /*
+     * 写线程全程持有写锁并不断增删group, 读线程在此期间完成全部查询: 查询不依赖写锁。
+     * 每次查询得到的要么是完整发布的描述, 要么查不到, 不会读到半更新的映射
+     */
+    constexpr u32 worldRankSize = 64;
+    constexpr u32 readerNum = 4;
+    constexpr u32 lookupNum = 20000;
+    std::shared_ptr<const HcomGroupRankSnapshot> snapshot;
+    std::shared_ptr<const HcomGroupRankDesc> residentDesc;
+    std::shared_ptr<const HcomGroupRankDesc> tempDesc;
+    ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, {1, 3, 5, 7}, worldRankSize, residentDesc), HCCL_SUCCESS);
+    ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, {2, 4, 6}, worldRankSize, tempDesc), HCCL_SUCCESS);
+    HcomPublishGroupRankDesc(snapshot, "resident", residentDesc);
+
+    std::mutex writeMutex;
+    std::atomic<bool> lockHeld{false};
+    std::atomic<u32> readerDoneNum{0};
+    std::atomic<u32> publishNum{0};
+    std::thread writer([&]() {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        lockHeld.store(true);
+        for (u32 i = 0; readerDoneNum.load() < readerNum; i++) {
+            HcomPublishGroupRankDesc(snapshot, "temp", (i % 2 == 0) ? tempDesc : nullptr);
+            publishNum++;
+        }
+    });
+    while (!lockHeld.load()) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<u32> errorNum{0};
+    std::atomic<u32> lockFreeNum{0};
+    std::vector<std::thread> readers;
+    for (u32 t = 0; t < readerNum; t++) {
+        readers.emplace_back([&]() {
+            for (u32 i = 0; i < lookupNum; i++) {
+                auto resident = HcomLookupGroupRankDesc(snapshot, "resident");
+                u32 groupRank = INVALID_VALUE_RANKID;
+                if (resident != residentDesc ||
+                    HcomGetGroupRankByWorldRank(*resident, 5, groupRank) != HCCL_SUCCESS || groupRank != 2) {
+                    errorNum++;
+                }
+                auto temp = HcomLookupGroupRankDesc(snapshot, "temp");
+                if (temp != nullptr && (temp != tempDesc ||
+                    HcomGetGroupRankByWorldRank(*temp, 6, groupRank) != HCCL_SUCCESS || groupRank != 2)) {
+                    errorNum++;
+                }
+                // 查询期间写锁始终被写线程持有
+                if (writeMutex.try_lock()) {
+                    writeMutex.unlock();
+                } else {
+                    lockFreeNum++;
+                }
+            }
+            readerDoneNum++;
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    writer.join();
+
+    EXPECT_EQ(errorNum.load(), 0U);
+    EXPECT_EQ(lockFreeNum.load(), readerNum * lookupNum);
+    EXPECT_GT(publishNum.load(), 0U);
+}
+
+TEST_F(HcomGroupRankDescTest, thread_cache_follows_republished_group)
+{
+    std::shared_ptr<const HcomGroupRankSnapshot> snapshot;
+    std::shared_ptr<const HcomGroupRankDesc> desc0;
+    std::shared_ptr<const HcomGroupRankDesc> desc1;
+    ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, {0, 1}, 4, desc0), HCCL_SUCCESS);
+    ASSERT_EQ(HcomBuildGroupRankDesc(0, 1, {2, 3}, 4, desc1), HCCL_SUCCESS);
+
+    HcomPublishGroupRankDesc(snapshot, "g", desc0);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "g"), desc0);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "g", true), desc0);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "gg", true), nullptr);
+
+    // 删除后重建同名group, 线程缓存不能返回旧描述
+    HcomPublishGroupRankDesc(snapshot, "g", nullptr);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "g"), nullptr);
+    HcomPublishGroupRankDesc(snapshot, "g", desc1);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "g"), desc1);
+
+    HcomClearGroupRankSnapshot(snapshot);
+    EXPECT_EQ(HcomLookupGroupRankDesc(snapshot, "g"), nullptr);
+}
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "one_sided_batch_planner.h"
+#include "sal_pub.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u64 TEST_MAX_TRANSFER_SIZE = 4096;
+constexpr u32 KV_BLOCK_NUM = 4096;
+constexpr u64 KV_BLOCK_SIZE = 256;
+constexpr u32 RANDOM_ROUND_NUM = 200;
+constexpr u64 RANDOM_BUFFER_SIZE = 16 * 1024;
+constexpr u64 RANDOM_MAX_COUNT = 512;
+constexpr u64 RANDOM_MAX_TRANSFER_SIZE = 256;
+
+/* mock TransportMem: 在host内存上执行WR, 记录下发顺序与fence, 可注入第N个WR失败 */
+class MockTransportMem {
+public:
+    struct RmaOpMem {
+        void *addr;
+        u64 size;
+    };
+
+    struct IssuedWr {
+        OneSidedBatchOp op;
+        u64 localAddr;
+        u64 remoteAddr;
+        u64 size;
+    };
+
+    HcclResult Write(const RmaOpMem &remoteMem, const RmaOpMem &localMem, const rtStream_t &stream)
+    {
+        return Execute(OneSidedBatchOp::BATCH_WRITE, localMem, remoteMem, stream);
+    }
+
+    HcclResult Read(const RmaOpMem &localMem, const RmaOpMem &remoteMem, const rtStream_t &stream)
+    {
+        return Execute(OneSidedBatchOp::BATCH_READ, localMem, remoteMem, stream);
+    }
+
+    HcclResult AddOpFence(const rtStream_t &stream)
+    {
+        (void)stream;
+        fenceNum++;
+        fenceAfterWr = wrs.size();
+        return HCCL_SUCCESS;
+    }
+
+    std::vector<IssuedWr> wrs;
+    u32 fenceNum{0};
+    size_t fenceAfterWr{0};
+    u32 failAtWr{UINT32_MAX};
+
+private:
+    HcclResult Execute(OneSidedBatchOp op, const RmaOpMem &localMem, const RmaOpMem &remoteMem,
+        const rtStream_t &stream)
+    {
+        (void)stream;
+        EXPECT_EQ(localMem.size, remoteMem.size);
+        if (wrs.size() == failAtWr) {
+            return HCCL_E_NETWORK;
+        }
+        wrs.push_back({op, reinterpret_cast<u64>(localMem.addr), reinterpret_cast<u64>(remoteMem.addr),
+            localMem.size});
+        if (op == OneSidedBatchOp::BATCH_WRITE) {
+            std::memmove(remoteMem.addr, localMem.addr, localMem.size);
+        } else {
+            std::memmove(localMem.addr, remoteMem.addr, localMem.size);
+        }
+        return HCCL_SUCCESS;
+    }
+};
+
+HcclOneSideOpDesc MakeDesc(std::vector<u8> &local, u64 localOffset, std::vector<u8> &remote, u64 remoteOffset,
+    u64 count, HcclDataType dataType = HCCL_DATA_TYPE_INT8)
+{
+    return {local.data() + localOffset, remote.data() + remoteOffset, count, dataType};
+}
+
+void FillPattern(std::vector<u8> &buffer, u32 seed)
+{
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = static_cast<u8>((i * 131 + seed * 17 + 7) & 0xFF);
+    }
+}
+
+/* 按调用者顺序逐个执行描述符, 作为规划结果的基准 */
+void RunSequential(const std::vector<HcclOneSideOpDesc> &descs, OneSidedBatchOp op)
+{
+    for (const HcclOneSideOpDesc &desc : descs) {
+        u32 unitSize = 0;
+        ASSERT_EQ(SalGetDataTypeSize(desc.dataType, unitSize), HCCL_SUCCESS);
+        if (op == OneSidedBatchOp::BATCH_WRITE) {
+            std::memmove(desc.remoteAddr, desc.localAddr, desc.count * unitSize);
+        } else {
+            std::memmove(desc.localAddr, desc.remoteAddr, desc.count * unitSize);
+        }
+    }
+}
+
+/* 将描述符从buffer a/b 平移到 c/d, 用于在两套相同的初始数据上分别执行基准与规划结果 */
+std::vector<HcclOneSideOpDesc> RebaseDescs(const std::vector<HcclOneSideOpDesc> &descs, std::vector<u8> &fromLocal,
+    std::vector<u8> &fromRemote, std::vector<u8> &toLocal, std::vector<u8> &toRemote)
+{
+    std::vector<HcclOneSideOpDesc> rebased(descs);
+    for (HcclOneSideOpDesc &desc : rebased) {
+        desc.localAddr = toLocal.data() + (static_cast<u8 *>(desc.localAddr) - fromLocal.data());
+        desc.remoteAddr = toRemote.data() + (static_cast<u8 *>(desc.remoteAddr) - fromRemote.data());
+    }
+    return rebased;
+}
+
+HcclResult PlanAndIssue(MockTransportMem &transportMem, const std::vector<HcclOneSideOpDesc> &descs,
+    OneSidedBatchOp op, u64 maxTransferSize, OneSidedBatchStat &stat)
+{
+    std::vector<OneSidedTransfer> transfers;
+    CHK_RET(OneSidedBatchPlanner::Plan(descs.data(), descs.size(), op, maxTransferSize, transfers));
+    return OneSidedBatchPlanner::Issue(transportMem, transfers, op, nullptr, stat);
+}
+}
+
+/*
+ * 单边BatchPut/BatchGet规划与下发: 使用mock TransportMem在host内存上执行WR,
+ * 校验拆分、合并后的顺序语义与逐字节结果, 以及WR/字节/fence的完成统计
+ */
+class OneSidedBatchPlannerTest : public testing::Test {
+};
+
+TEST_F(OneSidedBatchPlannerTest, oversized_desc_is_chunked_to_max_transfer_size)
+{
+    const u64 size = 10 * TEST_MAX_TRANSFER_SIZE + 100;
+    std::vector<u8> local(size);
+    std::vector<u8> remote(size, 0);
+    FillPattern(local, 1);
+    // FP32按4字节计算长度
+    std::vector<HcclOneSideOpDesc> descs = { MakeDesc(local, 0, remote, 0, size / 4, HCCL_DATA_TYPE_FP32) };
+
+    MockTransportMem transportMem;
+    OneSidedBatchStat stat;
+    ASSERT_EQ(PlanAndIssue(transportMem, descs, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_SUCCESS);
+    ASSERT_EQ(transportMem.wrs.size(), 11U);
+    u64 expectOffset = 0;
+    for (const MockTransportMem::IssuedWr &wr : transportMem.wrs) {
+        EXPECT_LE(wr.size, TEST_MAX_TRANSFER_SIZE);
+        EXPECT_EQ(wr.localAddr, reinterpret_cast<u64>(local.data()) + expectOffset);
+        EXPECT_EQ(wr.remoteAddr, reinterpret_cast<u64>(remote.data()) + expectOffset);
+        expectOffset += wr.size;
+    }
+    EXPECT_EQ(expectOffset, size);
+    EXPECT_EQ(transportMem.wrs.back().size, 100U);
+    EXPECT_EQ(remote, local);
+    EXPECT_EQ(stat.wrNum, 11U);
+    EXPECT_EQ(stat.bytes, size);
+    EXPECT_TRUE(stat.fenced);
+}
+
+TEST_F(OneSidedBatchPlannerTest, shuffled_kv_blocks_are_coalesced_in_remote_order)
+{
+    std::vector<u8> local(KV_BLOCK_NUM * KV_BLOCK_SIZE);
+    std::vector<u8> remote(local.size(), 0);
+    FillPattern(local, 2);
+    std::vector<HcclOneSideOpDesc> descs;
+    for (u32 i = 0; i < KV_BLOCK_NUM; i++) {
+        descs.push_back(MakeDesc(local, i * KV_BLOCK_SIZE, remote, i * KV_BLOCK_SIZE, KV_BLOCK_SIZE));
+    }
+    std::shuffle(descs.begin(), descs.end(), std::mt19937(3));
+
+    MockTransportMem transportMem;
+    OneSidedBatchStat stat;
+    ASSERT_EQ(PlanAndIssue(transportMem, descs, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_SUCCESS);
+    const u64 expectWrNum = local.size() / TEST_MAX_TRANSFER_SIZE;
+    EXPECT_EQ(transportMem.wrs.size(), expectWrNum);
+    for (size_t i = 1; i < transportMem.wrs.size(); i++) {
+        EXPECT_EQ(transportMem.wrs[i].remoteAddr, transportMem.wrs[i - 1].remoteAddr + transportMem.wrs[i - 1].size);
+    }
+    EXPECT_EQ(remote, local);
+    EXPECT_EQ(stat.bytes, local.size());
+
+    // 基准: 原实现每个描述符一个WR
+    auto start = std::chrono::steady_clock::now();
+    std::vector<OneSidedTransfer> transfers;
+    ASSERT_EQ(OneSidedBatchPlanner::Plan(descs.data(), descs.size(), OneSidedBatchOp::BATCH_WRITE,
+        ONE_SIDED_RDMA_MAX_TRANSFER_SIZE, transfers), HCCL_SUCCESS);
+    auto planCost = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(transfers.size(), 1U);
+    RecordProperty("desc_num", std::to_string(descs.size()));
+    RecordProperty("unplanned_wr_num", std::to_string(descs.size()));
+    RecordProperty("planned_wr_num_4k_limit", std::to_string(transportMem.wrs.size()));
+    RecordProperty("planned_wr_num_rdma_limit", std::to_string(transfers.size()));
+    RecordProperty("plan_ns_per_desc", std::to_string(static_cast<double>(planCost.count()) / descs.size()));
+}
+
+TEST_F(OneSidedBatchPlannerTest, overlapping_destination_keeps_caller_order)
+{
+    std::vector<u8> local(4 * KV_BLOCK_SIZE);
+    std::vector<u8> remote(2 * KV_BLOCK_SIZE, 0);
+    FillPattern(local, 4);
+    // 两次写同一远端区间, 调用者顺序中后写的生效; 按远端地址排序会交换两者
+    std::vector<HcclOneSideOpDesc> writeDescs = {
+        MakeDesc(local, 0, remote, KV_BLOCK_SIZE, KV_BLOCK_SIZE),
+        MakeDesc(local, KV_BLOCK_SIZE, remote, 0, 2 * KV_BLOCK_SIZE),
+    };
+    MockTransportMem transportMem;
+    OneSidedBatchStat stat;
+    ASSERT_EQ(PlanAndIssue(transportMem, writeDescs, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_SUCCESS);
+    ASSERT_EQ(transportMem.wrs.size(), 2U);
+    EXPECT_EQ(transportMem.wrs[0].remoteAddr, reinterpret_cast<u64>(remote.data()) + KV_BLOCK_SIZE);
+    EXPECT_TRUE(std::equal(remote.begin(), remote.end(), local.begin() + KV_BLOCK_SIZE));
+
+    // 读操作以本端为目的端, 本端区间重叠时同样保持调用者顺序
+    std::vector<u8> readLocal(KV_BLOCK_SIZE, 0);
+    std::vector<HcclOneSideOpDesc> readDescs = {
+        MakeDesc(readLocal, 0, remote, KV_BLOCK_SIZE, KV_BLOCK_SIZE),
+        MakeDesc(readLocal, 0, remote, 0, KV_BLOCK_SIZE),
+    };
+    MockTransportMem readTransportMem;
+    ASSERT_EQ(PlanAndIssue(readTransportMem, readDescs, OneSidedBatchOp::BATCH_READ, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_SUCCESS);
+    ASSERT_EQ(readTransportMem.wrs.size(), 2U);
+    EXPECT_EQ(readTransportMem.wrs[1].remoteAddr, reinterpret_cast<u64>(remote.data()));
+    EXPECT_TRUE(std::equal(readLocal.begin(), readLocal.end(), remote.begin()));
+}
+
+TEST_F(OneSidedBatchPlannerTest, random_batches_match_sequential_execution)
+{
+    std::mt19937 gen(2025);
+    for (u32 round = 0; round < RANDOM_ROUND_NUM; round++) {
+        OneSidedBatchOp op = (round % 2 == 0) ? OneSidedBatchOp::BATCH_WRITE : OneSidedBatchOp::BATCH_READ;
+        std::vector<u8> local(RANDOM_BUFFER_SIZE);
+        std::vector<u8> remote(RANDOM_BUFFER_SIZE);
+        FillPattern(local, round);
+        FillPattern(remote, round + RANDOM_ROUND_NUM);
+        std::vector<u8> expectLocal(local);
+        std::vector<u8> expectRemote(remote);
+
+        // 一半轮次生成相邻块(可合并), 另一半随机区间(可能重叠), 含零长度描述符
+        std::vector<HcclOneSideOpDesc> descs;
+        u32 descNum = gen() % 64 + 1;
+        for (u32 i = 0; i < descNum; i++) {
+            bool adjacent = (round % 4 < 2);
+            u64 count = (gen() % 8 == 0) ? 0 : gen() % RANDOM_MAX_COUNT + 1;
+            u64 localOffset = adjacent ? (i * RANDOM_MAX_COUNT) % (RANDOM_BUFFER_SIZE - RANDOM_MAX_COUNT) :
+                gen() % (RANDOM_BUFFER_SIZE - count);
+            u64 remoteOffset = adjacent ? localOffset : gen() % (RANDOM_BUFFER_SIZE - count);
+            descs.push_back(MakeDesc(local, localOffset, remote, remoteOffset, count));
+        }
+        RunSequential(RebaseDescs(descs, local, remote, expectLocal, expectRemote), op);
+
+        MockTransportMem transportMem;
+        OneSidedBatchStat stat;
+        ASSERT_EQ(PlanAndIssue(transportMem, descs, op, RANDOM_MAX_TRANSFER_SIZE, stat), HCCL_SUCCESS);
+        EXPECT_EQ(local, expectLocal) << "round " << round;
+        EXPECT_EQ(remote, expectRemote) << "round " << round;
+        EXPECT_LE(transportMem.wrs.size(), descNum * (RANDOM_MAX_COUNT / RANDOM_MAX_TRANSFER_SIZE));
+
+        u64 expectBytes = 0;
+        for (const HcclOneSideOpDesc &desc : descs) {
+            expectBytes += desc.count;
+        }
+        EXPECT_EQ(stat.bytes, expectBytes) << "round " << round;
+        EXPECT_EQ(stat.wrNum, transportMem.wrs.size());
+        EXPECT_EQ(transportMem.fenceNum, 1U);
+        EXPECT_EQ(transportMem.fenceAfterWr, transportMem.wrs.size());
+    }
+}
+
+TEST_F(OneSidedBatchPlannerTest, failed_wr_stops_issue_without_fence)
+{
+    std::vector<u8> local(8 * TEST_MAX_TRANSFER_SIZE);
+    std::vector<u8> remote(local.size(), 0);
+    std::vector<HcclOneSideOpDesc> descs = { MakeDesc(local, 0, remote, 0, local.size()) };
+
+    MockTransportMem transportMem;
+    transportMem.failAtWr = 3;
+    OneSidedBatchStat stat;
+    EXPECT_EQ(PlanAndIssue(transportMem, descs, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_E_NETWORK);
+    EXPECT_EQ(transportMem.wrs.size(), 3U);
+    EXPECT_EQ(stat.wrNum, 3U);
+    EXPECT_EQ(stat.bytes, 3 * TEST_MAX_TRANSFER_SIZE);
+    EXPECT_FALSE(stat.fenced);
+    EXPECT_EQ(transportMem.fenceNum, 0U);
+}
+
+TEST_F(OneSidedBatchPlannerTest, empty_and_invalid_batches)
+{
+    MockTransportMem transportMem;
+    OneSidedBatchStat stat;
+    std::vector<HcclOneSideOpDesc> descs;
+    // 全部为空时不下发WR, 仍追加fence以保持与原实现一致的完成语义
+    ASSERT_EQ(PlanAndIssue(transportMem, descs, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE, stat),
+        HCCL_SUCCESS);
+    EXPECT_EQ(stat.wrNum, 0U);
+    EXPECT_EQ(transportMem.fenceNum, 1U);
+
+    std::vector<OneSidedTransfer> transfers;
+    EXPECT_EQ(OneSidedBatchPlanner::Plan(nullptr, 1, OneSidedBatchOp::BATCH_WRITE, TEST_MAX_TRANSFER_SIZE,
+        transfers), HCCL_E_PTR);
+    std::vector<u8> buffer(16);
+    descs.push_back(MakeDesc(buffer, 0, buffer, 8, 2));
+    EXPECT_EQ(OneSidedBatchPlanner::Plan(descs.data(), descs.size(), OneSidedBatchOp::BATCH_WRITE, 0, transfers),
+        HCCL_E_PARA);
+    descs[0].dataType = HCCL_DATA_TYPE_RESERVED;
+    EXPECT_EQ(OneSidedBatchPlanner::Plan(descs.data(), descs.size(), OneSidedBatchOp::BATCH_WRITE,
+        TEST_MAX_TRANSFER_SIZE, transfers), HCCL_E_PARA);
+}
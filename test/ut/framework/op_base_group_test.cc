@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "op_base_group_plan.h"
+#include "group_fusion_mem_cache.h"
+
+using namespace hccl;
+
+namespace {
+HcclComm FakeComm(uintptr_t id)
+{
+    return reinterpret_cast<HcclComm>(id * 0x1000);
+}
+
+rtStream_t FakeStream(uintptr_t id)
+{
+    return reinterpret_cast<rtStream_t>(id * 0x100);
+}
+
+GroupOpRecord MakeOp(HcclCMDType cmdType, u64 count, HcclDataType dataType = HCCL_DATA_TYPE_FP32,
+    HcclReduceOp op = HCCL_REDUCE_SUM, u32 root = 0, uintptr_t stream = 1)
+{
+    GroupOpRecord record;
+    record.cmdType = cmdType;
+    record.count = count;
+    record.dataType = dataType;
+    record.op = (cmdType == HcclCMDType::HCCL_CMD_BROADCAST) ? HCCL_REDUCE_RESERVED : op;
+    record.root = root;
+    record.comm = FakeComm(1);
+    record.stream = FakeStream(stream);
+    return record;
+}
+}
+
+/* HcclGroupEnd的下发计划: 同键的小算子融合为一次下发, 其余算子保持记录顺序; 融合内存按流缓存且总量有界 */
+class OpBaseGroupTest : public testing::Test {
+protected:
+    static std::vector<std::vector<u32>> GetOpIndexes(const std::vector<GroupLaunch> &plan)
+    {
+        std::vector<std::vector<u32>> opIndexes;
+        for (const GroupLaunch &launch : plan) {
+            opIndexes.push_back(launch.opIndexes);
+        }
+        return opIndexes;
+    }
+};
+
+TEST_F(OpBaseGroupTest, same_key_small_allreduce_fuse_into_one_launch)
+{
+    std::vector<GroupOpRecord> ops;
+    u64 totalSize = 0;
+    for (u32 i = 0; i < 300; i++) {
+        ops.push_back(MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 64 + i));
+        totalSize += (64 + i) * sizeof(float);
+    }
+    std::vector<GroupLaunch> plan;
+    ASSERT_EQ(BuildGroupLaunchPlan(ops, plan), HCCL_SUCCESS);
+    ASSERT_EQ(plan.size(), 1U);
+    ASSERT_EQ(plan[0].opIndexes.size(), ops.size());
+    for (u32 i = 0; i < ops.size(); i++) {
+        EXPECT_EQ(plan[0].opIndexes[i], i);
+    }
+    EXPECT_EQ(plan[0].size, totalSize);
+}
+
+TEST_F(OpBaseGroupTest, fusion_key_separates_launches_in_first_record_order)
+{
+    std::vector<GroupOpRecord> ops = {
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16),                                            // 0: sum
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_MAX),     // 1: max
+        MakeOp(HcclCMDType::HCCL_CMD_BROADCAST, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_SUM, 0),  // 2: root0
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16),                                            // 3: sum
+        MakeOp(HcclCMDType::HCCL_CMD_BROADCAST, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_SUM, 1),  // 4: root1
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16, HCCL_DATA_TYPE_INT32),                     // 5: int32
+        MakeOp(HcclCMDType::HCCL_CMD_BROADCAST, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_SUM, 0),  // 6: root0
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_SUM, 0, 2), // 7: stream2
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_MAX),     // 8: max
+    };
+    std::vector<GroupLaunch> plan;
+    ASSERT_EQ(BuildGroupLaunchPlan(ops, plan), HCCL_SUCCESS);
+    std::vector<std::vector<u32>> expect = {{0, 3}, {1, 8}, {2, 6}, {4}, {5}, {7}};
+    EXPECT_EQ(GetOpIndexes(plan), expect);
+}
+
+TEST_F(OpBaseGroupTest, unfusible_ops_keep_record_order)
+{
+    u64 largeCount = GROUP_FUSION_MAX_OP_SIZE / sizeof(float) + 1;
+    std::vector<GroupOpRecord> ops = {
+        MakeOp(HcclCMDType::HCCL_CMD_ALLGATHER, 16),            // 0
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16),            // 1
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, largeCount),    // 2: 超过单算子融合上限
+        MakeOp(HcclCMDType::HCCL_CMD_REDUCE_SCATTER, 16),       // 3
+        MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, 16),            // 4
+    };
+    std::vector<GroupLaunch> plan;
+    ASSERT_EQ(BuildGroupLaunchPlan(ops, plan), HCCL_SUCCESS);
+    std::vector<std::vector<u32>> expect = {{0}, {1, 4}, {2}, {3}};
+    EXPECT_EQ(GetOpIndexes(plan), expect);
+    EXPECT_EQ(plan[2].size, largeCount * sizeof(float));
+}
+
+TEST_F(OpBaseGroupTest, fused_launch_is_split_at_max_size)
+{
+    u64 opCount = GROUP_FUSION_MAX_OP_SIZE / sizeof(float);
+    u32 opNum = GROUP_FUSION_MAX_SIZE / GROUP_FUSION_MAX_OP_SIZE * 2 + 2;
+    std::vector<GroupOpRecord> ops(opNum, MakeOp(HcclCMDType::HCCL_CMD_ALLREDUCE, opCount));
+    std::vector<GroupLaunch> plan;
+    ASSERT_EQ(BuildGroupLaunchPlan(ops, plan), HCCL_SUCCESS);
+    ASSERT_EQ(plan.size(), 3U);
+    u32 next = 0;
+    for (const GroupLaunch &launch : plan) {
+        EXPECT_LE(launch.size, GROUP_FUSION_MAX_SIZE);
+        for (u32 index : launch.opIndexes) {
+            EXPECT_EQ(index, next++);
+        }
+    }
+    EXPECT_EQ(next, opNum);
+    EXPECT_EQ(plan[2].opIndexes.size(), 2U);
+}
+
+TEST_F(OpBaseGroupTest, fusion_mem_reused_on_same_stream_and_bounded_in_total)
+{
+    std::vector<rtStream_t> synced;
+    GroupFusionMemCache cache(4 * 1024 * 1024, [&synced](rtStream_t stream) {
+        synced.push_back(stream);
+        return HCCL_SUCCESS;
+    });
+    DeviceMem mem;
+    ASSERT_EQ(cache.Get(1024 * 1024, FakeStream(1), mem), HCCL_SUCCESS);
+    void *firstPtr = mem.ptr();
+    ASSERT_EQ(cache.Get(512 * 1024, FakeStream(1), mem), HCCL_SUCCESS);
+    EXPECT_EQ(mem.ptr(), firstPtr);
+    EXPECT_EQ(mem.size(), 512U * 1024);
+    EXPECT_TRUE(synced.empty());
+
+    // 同一条流需要更大的内存时, 先同步该流再替换
+    ASSERT_EQ(cache.Get(2 * 1024 * 1024, FakeStream(1), mem), HCCL_SUCCESS);
+    ASSERT_EQ(synced.size(), 1U);
+    EXPECT_EQ(synced[0], FakeStream(1));
+    EXPECT_EQ(cache.GetCachedSize(), 2U * 1024 * 1024);
+
+    // stream2使用后stream1为最久未使用, stream3超出总量时淘汰stream1
+    ASSERT_EQ(cache.Get(1024 * 1024, FakeStream(2), mem), HCCL_SUCCESS);
+    ASSERT_EQ(cache.Get(2 * 1024 * 1024, FakeStream(3), mem), HCCL_SUCCESS);
+    ASSERT_EQ(synced.size(), 2U);
+    EXPECT_EQ(synced[1], FakeStream(1));
+    EXPECT_EQ(cache.GetStreamNum(), 2U);
+    EXPECT_LE(cache.GetCachedSize(), 4U * 1024 * 1024);
+
+    // 访问stream2后再申请, 淘汰的是stream3
+    ASSERT_EQ(cache.Get(1024 * 1024, FakeStream(2), mem), HCCL_SUCCESS);
+    ASSERT_EQ(cache.Get(2 * 1024 * 1024, FakeStream(4), mem), HCCL_SUCCESS);
+    ASSERT_EQ(synced.size(), 3U);
+    EXPECT_EQ(synced[2], FakeStream(3));
+    EXPECT_LE(cache.GetCachedSize(), 4U * 1024 * 1024);
+
+    EXPECT_EQ(cache.Get(4 * 1024 * 1024 + 1, FakeStream(5), mem), HCCL_E_PARA);
+}
+
+TEST_F(OpBaseGroupTest, fusion_mem_kept_when_stream_sync_fails)
+{
+    GroupFusionMemCache cache(2 * 1024 * 1024, [](rtStream_t) { return HCCL_E_RUNTIME; });
+    DeviceMem mem;
+    ASSERT_EQ(cache.Get(2 * 1024 * 1024, FakeStream(1), mem), HCCL_SUCCESS);
+    // 无法确认旧内存不再被使用时不释放, 调用方退化为逐个下发
+    EXPECT_NE(cache.Get(1024 * 1024, FakeStream(2), mem), HCCL_SUCCESS);
+    EXPECT_EQ(cache.GetStreamNum(), 1U);
+    EXPECT_EQ(cache.GetCachedSize(), 2U * 1024 * 1024);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "op_base_persistent.h"
+
+using namespace hccl;
+
+namespace {
+// 登记表只按地址区分通信域, 不解引用, 用占位地址模拟不同通信域
+hcclComm *FakeComm(uintptr_t id)
+{
+    return reinterpret_cast<hcclComm *>(id * 0x1000);
+}
+}
+
+/* 持久化算子句柄登记表: 句柄按通信域记录, 通信域销毁后句柄失效, 已释放的句柄被拒绝 */
+class PersistentOpRegistryTest : public testing::Test {
+protected:
+    static HcclPersistentOp Create(hcclComm *comm, u64 opId, const std::string &tag)
+    {
+        std::unique_ptr<PersistentOpHandle> handle(new PersistentOpHandle());
+        handle->comm = comm;
+        handle->opId = opId;
+        handle->cmdType = HcclCMDType::HCCL_CMD_ALLREDUCE;
+        handle->count = opId * 16;
+        handle->dataType = HCCL_DATA_TYPE_FP32;
+        handle->tag = tag;
+        HcclPersistentOp persistentOp = nullptr;
+        EXPECT_EQ(PersistentOpRegistry::GetInstance().Register(std::move(handle), persistentOp), HCCL_SUCCESS);
+        return persistentOp;
+    }
+};
+
+TEST_F(PersistentOpRegistryTest, register_get_unregister)
+{
+    hcclComm *comm = FakeComm(1);
+    HcclPersistentOp op = Create(comm, 7, "persistent_allreduce");
+    ASSERT_NE(op, nullptr);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(comm), 1U);
+
+    PersistentOpHandle handle;
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Get(op, handle), HCCL_SUCCESS);
+    EXPECT_EQ(handle.comm, comm);
+    EXPECT_EQ(handle.opId, 7U);
+    EXPECT_EQ(handle.count, 112U);
+    EXPECT_EQ(handle.tag, "persistent_allreduce");
+
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Unregister(op, handle), HCCL_SUCCESS);
+    EXPECT_EQ(handle.opId, 7U);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(comm), 0U);
+
+    // 重复释放与释放后使用均返回参数错误
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().Get(op, handle), HCCL_E_PARA);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().Unregister(op, handle), HCCL_E_PARA);
+}
+
+TEST_F(PersistentOpRegistryTest, register_rejects_null_comm)
+{
+    std::unique_ptr<PersistentOpHandle> handle(new PersistentOpHandle());
+    HcclPersistentOp op = nullptr;
+    EXPECT_NE(PersistentOpRegistry::GetInstance().Register(std::move(handle), op), HCCL_SUCCESS);
+    EXPECT_EQ(op, nullptr);
+}
+
+TEST_F(PersistentOpRegistryTest, invalidate_comm_only_affects_its_handles)
+{
+    hcclComm *commA = FakeComm(2);
+    hcclComm *commB = FakeComm(3);
+    std::vector<HcclPersistentOp> opsA;
+    for (u64 opId = 1; opId <= 3; opId++) {
+        opsA.push_back(Create(commA, opId, "commA"));
+    }
+    HcclPersistentOp opB = Create(commB, 1, "commB");
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(commA), 3U);
+
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().InvalidateComm(commA), 3U);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(commA), 0U);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().InvalidateComm(commA), 0U);
+
+    // 失效句柄仍可查询与释放, 但不再指向已销毁的通信域
+    PersistentOpHandle handle;
+    for (HcclPersistentOp op : opsA) {
+        ASSERT_EQ(PersistentOpRegistry::GetInstance().Get(op, handle), HCCL_SUCCESS);
+        EXPECT_EQ(handle.comm, nullptr);
+        ASSERT_EQ(PersistentOpRegistry::GetInstance().Unregister(op, handle), HCCL_SUCCESS);
+        EXPECT_EQ(handle.comm, nullptr);
+    }
+
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Get(opB, handle), HCCL_SUCCESS);
+    EXPECT_EQ(handle.comm, commB);
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Unregister(opB, handle), HCCL_SUCCESS);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(commB), 0U);
+}
+
+TEST_F(PersistentOpRegistryTest, address_reuse_after_invalidate_is_tracked_separately)
+{
+    // 通信域销毁后同一地址被新通信域复用, 旧句柄不能挂到新通信域上
+    hcclComm *comm = FakeComm(4);
+    HcclPersistentOp oldOp = Create(comm, 1, "old");
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().InvalidateComm(comm), 1U);
+    HcclPersistentOp newOp = Create(comm, 2, "new");
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(comm), 1U);
+
+    PersistentOpHandle handle;
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Unregister(oldOp, handle), HCCL_SUCCESS);
+    EXPECT_EQ(handle.comm, nullptr);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(comm), 1U);
+    ASSERT_EQ(PersistentOpRegistry::GetInstance().Unregister(newOp, handle), HCCL_SUCCESS);
+    EXPECT_EQ(handle.comm, comm);
+    EXPECT_EQ(PersistentOpRegistry::GetInstance().GetHandleNum(comm), 0U);
+}
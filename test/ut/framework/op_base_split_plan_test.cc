@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+#include "op_base_split_plan.h"
+
+using namespace hccl;
+
+namespace {
+std::vector<u32> IdentityRankIds(u32 rankSize)
+{
+    std::vector<u32> rankIds(rankSize);
+    std::iota(rankIds.begin(), rankIds.end(), 0);
+    return rankIds;
+}
+
+// 模拟一次子通信域初始化: 建链与资源申请以等待为主
+void SimulateSubCommInit()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+}
+
+/* HcclCommSplitBatchConfig的切分计划: colors/keys按全局rankId取值, 子通信域初始化并发执行 */
+class OpBaseSplitPlanTest : public testing::Test {
+};
+
+TEST_F(OpBaseSplitPlanTest, plan_groups_same_color_ordered_by_key_then_rank)
+{
+    const u32 rankSize = 4;
+    // 切分0: 按奇偶分组; 切分1: 本rank不加入; 切分2: 全部同色, key逆序
+    const std::vector<u32> colors = {
+        0, 1, 0, 1,
+        5, 5, HCCL_SPLIT_NOCOLOR, 5,
+        7, 7, 7, 7,
+    };
+    const std::vector<u32> keys = {
+        9, 0, 3, 0,
+        0, 0, 0, 0,
+        3, 2, 1, 1,
+    };
+    std::vector<SplitBatchPlan> plans;
+    ASSERT_EQ(BuildSplitBatchPlan(IdentityRankIds(rankSize), 2, 3, colors.data(), keys.data(), plans),
+        HCCL_SUCCESS);
+    ASSERT_EQ(plans.size(), 2U);
+
+    EXPECT_EQ(plans[0].splitIdx, 0U);
+    EXPECT_EQ(plans[0].color, 0U);
+    EXPECT_EQ(plans[0].rankIds, std::vector<u32>({2, 0}));
+    EXPECT_EQ(plans[0].subCommRankId, 0U);
+
+    // key相同时按全局rankId排序
+    EXPECT_EQ(plans[1].splitIdx, 2U);
+    EXPECT_EQ(plans[1].color, 7U);
+    EXPECT_EQ(plans[1].rankIds, std::vector<u32>({2, 3, 1, 0}));
+    EXPECT_EQ(plans[1].subCommRankId, 0U);
+}
+
+TEST_F(OpBaseSplitPlanTest, null_keys_order_by_global_rank)
+{
+    const std::vector<u32> colors = {3, 1, 3, 1, 3, 1};
+    std::vector<SplitBatchPlan> plans;
+    ASSERT_EQ(BuildSplitBatchPlan(IdentityRankIds(6), 4, 1, colors.data(), nullptr, plans), HCCL_SUCCESS);
+    ASSERT_EQ(plans.size(), 1U);
+    EXPECT_EQ(plans[0].color, 3U);
+    EXPECT_EQ(plans[0].rankIds, std::vector<u32>({0, 2, 4}));
+    EXPECT_EQ(plans[0].subCommRankId, 2U);
+}
+
+TEST_F(OpBaseSplitPlanTest, permuted_rank_table_is_accepted)
+{
+    // rank table中的位置与rankId不一致时, colors仍按rankId取值
+    const std::vector<u32> globalRankIds = {2, 0, 3, 1};
+    const std::vector<u32> colors = {0, 0, 1, 1};
+    std::vector<SplitBatchPlan> plans;
+    ASSERT_EQ(BuildSplitBatchPlan(globalRankIds, 3, 1, colors.data(), nullptr, plans), HCCL_SUCCESS);
+    ASSERT_EQ(plans.size(), 1U);
+    EXPECT_EQ(plans[0].rankIds, std::vector<u32>({2, 3}));
+    EXPECT_EQ(plans[0].subCommRankId, 1U);
+}
+
+TEST_F(OpBaseSplitPlanTest, rank_table_not_matching_rank_ids_is_rejected)
+{
+    const std::vector<u32> colors = {0, 0, 0, 0};
+    std::vector<SplitBatchPlan> plans(1);
+    // rankId重复
+    EXPECT_EQ(BuildSplitBatchPlan({0, 1, 1, 3}, 0, 1, colors.data(), nullptr, plans), HCCL_E_PARA);
+    EXPECT_TRUE(plans.empty());
+    // rankId越界, colors[rankId]会越界读取
+    EXPECT_EQ(BuildSplitBatchPlan({0, 1, 2, 4}, 0, 1, colors.data(), nullptr, plans), HCCL_E_PARA);
+    // 本rank不在rank table范围内
+    EXPECT_EQ(BuildSplitBatchPlan(IdentityRankIds(4), 4, 1, colors.data(), nullptr, plans), HCCL_E_PARA);
+    EXPECT_EQ(BuildSplitBatchPlan(IdentityRankIds(4), 0, 1, nullptr, nullptr, plans), HCCL_E_PTR);
+}
+
+TEST_F(OpBaseSplitPlanTest, all_nocolor_yields_empty_plan)
+{
+    const std::vector<u32> colors(8, HCCL_SPLIT_NOCOLOR);
+    std::vector<SplitBatchPlan> plans;
+    ASSERT_EQ(BuildSplitBatchPlan(IdentityRankIds(4), 1, 2, colors.data(), nullptr, plans), HCCL_SUCCESS);
+    EXPECT_TRUE(plans.empty());
+}
+
+TEST_F(OpBaseSplitPlanTest, tasks_run_concurrently)
+{
+    // 每个任务等到threadNum个任务同时在执行才返回, 串行执行时会等到超时
+    const u32 threadNum = 4;
+    std::mutex mutex;
+    std::condition_variable cv;
+    u32 entered = 0;
+    std::atomic<u32> timeoutNum{0};
+    HcclResult ret = RunSplitBatchTasks(threadNum, threadNum, [&](u32) -> HcclResult {
+        std::unique_lock<std::mutex> lock(mutex);
+        entered++;
+        cv.notify_all();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (entered < threadNum) {
+            if (cv.wait_until(lock, deadline) == std::cv_status::timeout) {
+                timeoutNum++;
+                break;
+            }
+        }
+        return HCCL_SUCCESS;
+    });
+    EXPECT_EQ(ret, HCCL_SUCCESS);
+    EXPECT_EQ(timeoutNum.load(), 0U);
+}
+
+TEST_F(OpBaseSplitPlanTest, every_task_runs_once_and_first_failure_is_returned)
+{
+    const u32 taskNum = 37;
+    std::vector<std::atomic<u32>> runNum(taskNum);
+    for (auto &num : runNum) {
+        num = 0;
+    }
+    HcclResult ret = RunSplitBatchTasks(taskNum, 5, [&](u32 idx) -> HcclResult {
+        runNum[idx]++;
+        if (idx == 20) {
+            return HCCL_E_TIMEOUT;
+        }
+        return (idx == 9) ? HCCL_E_NETWORK : HCCL_SUCCESS;
+    });
+    // 失败不会打断其余任务, 调用者需据此销毁已创建的子通信域
+    EXPECT_EQ(ret, HCCL_E_NETWORK);
+    for (u32 idx = 0; idx < taskNum; idx++) {
+        EXPECT_EQ(runNum[idx].load(), 1U) << "task " << idx;
+    }
+}
+
+TEST_F(OpBaseSplitPlanTest, zero_tasks_and_zero_threads)
+{
+    bool called = false;
+    EXPECT_EQ(RunSplitBatchTasks(0, 0, [&](u32) -> HcclResult {
+        called = true;
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    EXPECT_FALSE(called);
+    EXPECT_EQ(RunSplitBatchTasks(1, 0, [](u32) { return HCCL_SUCCESS; }), HCCL_E_PARA);
+}
+
+TEST_F(OpBaseSplitPlanTest, benchmark_batch_vs_serial_splits)
+{
+    // 64卡, 16次切分: 基线为逐次单独切分(每次重新生成计划并串行初始化), 批量为一次生成计划后并发初始化
+    const u32 rankSize = 64;
+    const u32 splitNum = 16;
+    const u32 localRank = 5;
+    std::vector<u32> colors(static_cast<u64>(splitNum) * rankSize);
+    for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+        for (u32 rank = 0; rank < rankSize; rank++) {
+            colors[splitIdx * rankSize + rank] = rank % (splitIdx + 2);
+        }
+    }
+    const std::vector<u32> globalRankIds = IdentityRankIds(rankSize);
+
+    std::vector<std::vector<u32>> serialRankIds;
+    auto serialStart = std::chrono::steady_clock::now();
+    for (u32 splitIdx = 0; splitIdx < splitNum; splitIdx++) {
+        std::vector<SplitBatchPlan> plans;
+        ASSERT_EQ(BuildSplitBatchPlan(globalRankIds, localRank, 1, colors.data() + splitIdx * rankSize, nullptr,
+            plans), HCCL_SUCCESS);
+        ASSERT_EQ(plans.size(), 1U);
+        SimulateSubCommInit();
+        serialRankIds.push_back(plans[0].rankIds);
+    }
+    double serialUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - serialStart).count();
+
+    std::vector<std::vector<u32>> batchRankIds(splitNum);
+    auto batchStart = std::chrono::steady_clock::now();
+    std::vector<SplitBatchPlan> plans;
+    ASSERT_EQ(BuildSplitBatchPlan(globalRankIds, localRank, splitNum, colors.data(), nullptr, plans),
+        HCCL_SUCCESS);
+    ASSERT_EQ(plans.size(), splitNum);
+    ASSERT_EQ(RunSplitBatchTasks(plans.size(), SPLIT_BATCH_MAX_THREAD_NUM, [&](u32 i) -> HcclResult {
+        SimulateSubCommInit();
+        batchRankIds[plans[i].splitIdx] = plans[i].rankIds;
+        return HCCL_SUCCESS;
+    }), HCCL_SUCCESS);
+    double batchUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - batchStart).count();
+
+    EXPECT_EQ(batchRankIds, serialRankIds);
+    RecordProperty("serial_split_us", std::to_string(serialUs));
+    RecordProperty("batch_split_us", std::to_string(batchUs));
+}
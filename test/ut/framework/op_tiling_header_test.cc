@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "securec.h"
+#include "op_tiling_header.h"
+
+using namespace hccl;
+
+namespace {
+constexpr u32 ALG_NAME_LEN = 128;
+constexpr u32 TAG_LEN = 256;
+
+// 与OpTilingData中字符串字段布局一致的头部
+struct FakeTilingHeader {
+    char algName[ALG_NAME_LEN];
+    char newTag[TAG_LEN];
+    char tag[TAG_LEN];
+};
+
+struct HeaderStrings {
+    std::string algName;
+    std::string newTag;
+    std::string tag;
+};
+
+HcclResult EncodeHeader(FakeTilingHeader &header, const HeaderStrings &strs)
+{
+    return EncodeOpTilingHeader({header.algName, sizeof(header.algName)}, {header.newTag, sizeof(header.newTag)},
+        {header.tag, sizeof(header.tag)}, strs.algName, strs.newTag, strs.tag);
+}
+
+// AICPU侧按C字符串解析头部
+HeaderStrings DecodeHeader(const FakeTilingHeader &header)
+{
+    return {std::string(header.algName, strnlen(header.algName, ALG_NAME_LEN)),
+        std::string(header.newTag, strnlen(header.newTag, TAG_LEN)),
+        std::string(header.tag, strnlen(header.tag, TAG_LEN))};
+}
+
+void ExpectHeader(const FakeTilingHeader &header, const HeaderStrings &expect)
+{
+    HeaderStrings decoded = DecodeHeader(header);
+    EXPECT_EQ(decoded.algName, expect.algName);
+    EXPECT_EQ(decoded.newTag, expect.newTag);
+    EXPECT_EQ(decoded.tag, expect.tag);
+}
+
+HeaderStrings MakeStrings(const std::string &alg, u32 groupIdx, u32 opIdx)
+{
+    std::string tag = "AllReduce_hcom_group_" + std::to_string(groupIdx) + "_" + std::to_string(opIdx);
+    return {alg, tag + "_device_aicpu_unfold_" + alg, tag};
+}
+
+// 对照实现: 记录上次写入的三元组, 相同时跳过拷贝
+class CompareThenCopyHeader {
+public:
+    HcclResult Encode(FakeTilingHeader &header, const HeaderStrings &strs)
+    {
+        if (valid_ && last_.algName == strs.algName && last_.newTag == strs.newTag && last_.tag == strs.tag) {
+            return HCCL_SUCCESS;
+        }
+        valid_ = false;
+        CHK_RET(EncodeHeader(header, strs));
+        last_ = strs;
+        valid_ = true;
+        return HCCL_SUCCESS;
+    }
+
+private:
+    bool valid_ = false;
+    HeaderStrings last_;
+};
+}
+
+/* AICPU tiling头部的字符串字段: 每次下发都按当前参数完整写入, 解码结果与入参一致 */
+class OpTilingHeaderTest : public testing::Test {
+};
+
+TEST_F(OpTilingHeaderTest, encode_decode_round_trip)
+{
+    // 随机的算子序列中连续重复与切换交替出现, 每次下发后解码结果都与当前参数一致
+    std::mt19937 gen(46);
+    const std::vector<std::string> algs = {"AllReduceMeshExecutor", "AllGatherRingFor91093Executor",
+        "ReduceScatterMeshOpbasePipelineExecutor"};
+    FakeTilingHeader header;
+    memset_s(&header, sizeof(header), 0x5a, sizeof(header));
+    HeaderStrings strs = MakeStrings(algs[0], 0, 0);
+    for (u32 i = 0; i < 2000; i++) {
+        switch (gen() % 6) {
+            case 0:
+                strs.algName = algs[gen() % algs.size()];
+                break;
+            case 1:
+                strs.newTag = MakeStrings(strs.algName, gen() % 4, gen() % 4).newTag;
+                break;
+            case 2:
+                strs.tag = MakeStrings(strs.algName, gen() % 4, gen() % 4).tag;
+                break;
+            default:
+                break;  // 同一算子重复下发
+        }
+        ASSERT_EQ(EncodeHeader(header, strs), HCCL_SUCCESS);
+        HeaderStrings decoded = DecodeHeader(header);
+        ASSERT_EQ(decoded.algName, strs.algName) << "op " << i;
+        ASSERT_EQ(decoded.newTag, strs.newTag) << "op " << i;
+        ASSERT_EQ(decoded.tag, strs.tag) << "op " << i;
+    }
+}
+
+TEST_F(OpTilingHeaderTest, param_change_rewrites_header)
+{
+    FakeTilingHeader header;
+    HeaderStrings base = {"alg", "newTag", "tag"};
+    ASSERT_EQ(EncodeHeader(header, base), HCCL_SUCCESS);
+
+    // 较短的新值需带结束符写入, 不能残留旧值的尾部
+    const std::vector<HeaderStrings> changes = {{"al", "newTag", "tag"}, {"al", "new", "tag"}, {"al", "new", "t"},
+        {"alg", "newTag", "tag"}, {"", "", ""}};
+    for (const HeaderStrings &strs : changes) {
+        ASSERT_EQ(EncodeHeader(header, strs), HCCL_SUCCESS);
+        ExpectHeader(header, strs);
+    }
+}
+
+TEST_F(OpTilingHeaderTest, new_buffer_is_filled_without_history)
+{
+    // tiling buffer扩容后是新内存, 与上一次写入的内容无关
+    FakeTilingHeader header;
+    HeaderStrings strs = {"alg", "newTag", "tag"};
+    ASSERT_EQ(EncodeHeader(header, strs), HCCL_SUCCESS);
+    FakeTilingHeader newHeader;
+    memset_s(&newHeader, sizeof(newHeader), 0, sizeof(newHeader));
+    ASSERT_EQ(EncodeHeader(newHeader, strs), HCCL_SUCCESS);
+    ExpectHeader(newHeader, strs);
+}
+
+TEST_F(OpTilingHeaderTest, oversized_or_null_field_is_rejected)
+{
+    FakeTilingHeader header;
+    EXPECT_EQ(EncodeHeader(header, {"alg", "newTag", std::string(TAG_LEN, 'x')}), HCCL_E_INTERNAL);
+    EXPECT_EQ(EncodeHeader(header, {std::string(ALG_NAME_LEN, 'x'), "newTag", "tag"}), HCCL_E_INTERNAL);
+    // 恰好占满字段(含结束符)时可以写入
+    HeaderStrings full = {std::string(ALG_NAME_LEN - 1, 'a'), std::string(TAG_LEN - 1, 'b'),
+        std::string(TAG_LEN - 1, 'c')};
+    ASSERT_EQ(EncodeHeader(header, full), HCCL_SUCCESS);
+    ExpectHeader(header, full);
+    EXPECT_EQ(EncodeOpTilingHeader({nullptr, 0}, {header.newTag, TAG_LEN}, {header.tag, TAG_LEN}, "a", "b", "c"),
+        HCCL_E_PTR);
+}
+
+TEST_F(OpTilingHeaderTest, benchmark_direct_encode_vs_compare_then_copy)
+{
+    /*
+     * 同一算子连续下发时, 先比较上次写入的三元组再决定是否拷贝并不比直接拷贝快:
+     * 比较与拷贝都要遍历同样长度的字符串, 且不命中时还需额外更新记录。头部因此每次直接写入
+     */
+    constexpr u32 loopNum = 1000000;
+    HeaderStrings strs = MakeStrings("AllReduceMeshOpbaseLoopExecutor", 12, 3);
+    FakeTilingHeader header;
+    u64 checksum = 0;
+    u32 failNum = 0;
+
+    CompareThenCopyHeader cache;
+    auto cacheStart = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < loopNum; i++) {
+        failNum += cache.Encode(header, strs);
+        checksum += static_cast<u8>(header.tag[i % strs.tag.length()]);
+    }
+    double cacheNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - cacheStart).count();
+
+    auto directStart = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < loopNum; i++) {
+        failNum += EncodeHeader(header, strs);
+        checksum -= static_cast<u8>(header.tag[i % strs.tag.length()]);
+    }
+    double directNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - directStart).count();
+
+    EXPECT_EQ(failNum, 0U);
+    EXPECT_EQ(checksum, 0U);
+    ExpectHeader(header, strs);
+    RecordProperty("compare_then_copy_ns_per_op", std::to_string(cacheNs / loopNum));
+    RecordProperty("direct_encode_ns_per_op", std::to_string(directNs / loopNum));
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "sim_comm.h"
+#include "log.h"
+
+namespace hccl {
+SimComm::SimComm(u32 rankSize, u32 streamNum, const SimConfig &config)
+    : rankSize_(rankSize), streamNum_(streamNum), engine_(rankSize, streamNum, config)
+{
+    SimPlatform::GetInstance().Bind(&engine_);
+}
+
+SimComm::~SimComm()
+{
+    SimPlatform::GetInstance().Unbind();
+}
+
+HcclResult SimComm::Init(u64 cclSize, const std::vector<u32> &serverIds)
+{
+    CHK_PRT_RET(!serverIds.empty() && serverIds.size() != rankSize_,
+        HCCL_ERROR("[SimComm][Init]serverIds size[%zu] is not equal to rankSize[%u]", serverIds.size(), rankSize_),
+        HCCL_E_PARA);
+    SimPlatform &platform = SimPlatform::GetInstance();
+    ranks_.resize(rankSize_);
+    for (u32 rank = 0; rank < rankSize_; rank++) {
+        SimRankResource &res = ranks_[rank];
+        res.cclIn = DeviceMem::alloc(cclSize);
+        CHK_PTR_NULL(res.cclIn.ptr());
+        res.cclOut = DeviceMem::alloc(cclSize);
+        CHK_PTR_NULL(res.cclOut.ptr());
+        CHK_RET(platform.CreateStream(rank, 0, res.mainStream, true));
+        res.slaveStreams.resize(streamNum_ - 1);
+        res.notifiesMain.resize(streamNum_ - 1);
+        res.notifiesAux.resize(streamNum_ - 1);
+        for (u32 idx = 1; idx < streamNum_; idx++) {
+            CHK_RET(platform.CreateStream(rank, idx, res.slaveStreams[idx - 1]));
+            CHK_RET(platform.CreateNotify(rank, res.notifiesMain[idx - 1]));
+            CHK_RET(platform.CreateNotify(rank, res.notifiesAux[idx - 1]));
+        }
+        res.links.resize(rankSize_);
+        res.auxLinks.resize(rankSize_);
+    }
+
+    for (u32 rankA = 0; rankA < rankSize_; rankA++) {
+        for (u32 rankB = rankA + 1; rankB < rankSize_; rankB++) {
+            SimRankResource &resA = ranks_[rankA];
+            SimRankResource &resB = ranks_[rankB];
+            SimTransportEnd endA{rankA, resA.cclIn.ptr(), cclSize, resA.cclOut.ptr(), cclSize};
+            SimTransportEnd endB{rankB, resB.cclIn.ptr(), cclSize, resB.cclOut.ptr(), cclSize};
+            bool sameServer = serverIds.empty() || serverIds[rankA] == serverIds[rankB];
+            SimLinkType linkType = sameServer ? SimLinkType::SIM_LINK_SDMA : SimLinkType::SIM_LINK_RDMA;
+            CHK_RET(platform.CreateLinkPair(endA, endB, linkType, resA.links[rankB], resB.links[rankA]));
+            CHK_RET(platform.CreateLinkPair(endA, endB, linkType, resA.auxLinks[rankB], resB.auxLinks[rankA]));
+        }
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimComm::Run(SimReport &report)
+{
+    return engine_.Run(report);
+}
+
+std::vector<LINK> SimComm::GetLinks(u32 rank, const std::vector<u32> &groupRanks, bool isAux) const
+{
+    const std::vector<LINK> &rankLinks = isAux ? ranks_[rank].auxLinks : ranks_[rank].links;
+    std::vector<LINK> links;
+    links.reserve(groupRanks.size());
+    for (u32 peer : groupRanks) {
+        links.push_back(rankLinks[peer]);
+    }
+    return links;
+}
+}  // namespace hccl
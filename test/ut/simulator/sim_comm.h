@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SIM_COMM_H
+#define SIM_COMM_H
+
+#include <memory>
+#include <vector>
+#include "sim_platform.h"
+#include "mem_device_pub.h"
+
+namespace hccl {
+/* 单个仿真rank的通信资源, 与executor下发算法时使用的资源一一对应 */
+struct SimRankResource {
+    DeviceMem cclIn;
+    DeviceMem cclOut;
+    Stream mainStream;
+    std::vector<Stream> slaveStreams;
+    std::vector<std::shared_ptr<LocalNotify>> notifiesMain;   /* 从流通知主流, 主流wait */
+    std::vector<std::shared_ptr<LocalNotify>> notifiesAux;    /* 主流通知从流, 从流wait */
+    std::vector<LINK> links;                                  /* 下标为对端rank, 本rank位置为nullptr */
+    std::vector<LINK> auxLinks;                               /* 另一组独立链路, 对应不同通信平面上的重复建链 */
+};
+
+/*
+ * 仿真通信域: 创建SimEngine并绑定SimPlatform, 为每个rank准备CCL buffer、主从流、notify和全连接链路。
+ * serverIds为空时所有rank在同一server内(SDMA链路), 否则同serverId的rank间为SDMA, 跨server为RDMA。
+ */
+class SimComm {
+public:
+    SimComm(u32 rankSize, u32 streamNum, const SimConfig &config = SimConfig());
+    ~SimComm();
+
+    HcclResult Init(u64 cclSize, const std::vector<u32> &serverIds = std::vector<u32>());
+    HcclResult Run(SimReport &report);
+
+    /* 按groupRanks的顺序取rank到组内各成员的链路, 作为模板RunAsync的links入参; isAux为true时取auxLinks */
+    std::vector<LINK> GetLinks(u32 rank, const std::vector<u32> &groupRanks, bool isAux = false) const;
+
+    SimRankResource &GetRank(u32 rank)
+    {
+        return ranks_[rank];
+    }
+
+    SimEngine &GetEngine()
+    {
+        return engine_;
+    }
+
+    u32 GetRankSize() const
+    {
+        return rankSize_;
+    }
+
+private:
+    u32 rankSize_;
+    u32 streamNum_;
+    SimEngine engine_;
+    std::vector<SimRankResource> ranks_;
+};
+}  // namespace hccl
+
+#endif /* SIM_COMM_H */
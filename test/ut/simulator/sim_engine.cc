@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "sim_engine.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include "log.h"
+#include "sal_pub.h"
+
+namespace hccl {
+namespace {
+template <typename T>
+void ReduceTyped(void *dst, const void *src, u64 count, HcclReduceOp op)
+{
+    T *dstData = static_cast<T *>(dst);
+    const T *srcData = static_cast<const T *>(src);
+    for (u64 i = 0; i < count; i++) {
+        switch (op) {
+            case HCCL_REDUCE_SUM:
+                dstData[i] = dstData[i] + srcData[i];
+                break;
+            case HCCL_REDUCE_PROD:
+                dstData[i] = dstData[i] * srcData[i];
+                break;
+            case HCCL_REDUCE_MAX:
+                dstData[i] = std::max(dstData[i], srcData[i]);
+                break;
+            default:
+                dstData[i] = std::min(dstData[i], srcData[i]);
+                break;
+        }
+    }
+}
+}
+
+SimEngine::SimEngine(u32 rankSize, u32 streamNum, const SimConfig &config)
+    : rankSize_(rankSize), streamNum_(streamNum), config_(config)
+{
+    streams_.resize(static_cast<size_t>(rankSize_) * streamNum_);
+    sdmaEngineFreeUs_.assign(rankSize_, std::vector<double>(std::max(config_.sdmaEngineNum, 1U), 0));
+    rdmaEngineFreeUs_.assign(rankSize_, std::vector<double>(std::max(config_.rdmaEngineNum, 1U), 0));
+}
+
+HcclResult SimEngine::SetLinkParam(u32 srcRank, u32 dstRank, const SimLinkParam &param)
+{
+    CHK_PRT_RET(srcRank >= rankSize_ || dstRank >= rankSize_,
+        HCCL_ERROR("[SimEngine][SetLinkParam]srcRank[%u] or dstRank[%u] is invalid, rankSize[%u]",
+        srcRank, dstRank, rankSize_), HCCL_E_PARA);
+    CHK_PRT_RET(param.bandwidthMB <= 0,
+        HCCL_ERROR("[SimEngine][SetLinkParam]bandwidth[%f] is invalid", param.bandwidthMB), HCCL_E_PARA);
+    linkParams_[std::make_pair(srcRank, dstRank)] = param;
+    return HCCL_SUCCESS;
+}
+
+u32 SimEngine::AllocNotify()
+{
+    return notifyIdCounter_++;
+}
+
+u64 SimEngine::GetPendingNotifyNum() const
+{
+    u64 pendingNum = 0;
+    for (const auto &posts : notifyPosts_) {
+        pendingNum += posts.second.size();
+    }
+    return pendingNum;
+}
+
+HcclResult SimEngine::CheckRankStream(u32 rank, u32 stream) const
+{
+    CHK_PRT_RET(rank >= rankSize_ || stream >= streamNum_,
+        HCCL_ERROR("[SimEngine]rank[%u] or stream[%u] is invalid, rankSize[%u] streamNum[%u]",
+        rank, stream, rankSize_, streamNum_), HCCL_E_PARA);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::PushTask(u32 rank, u32 stream, const SimTask &task)
+{
+    CHK_RET(CheckRankStream(rank, stream));
+    CHK_PRT_RET(task.peerRank >= rankSize_,
+        HCCL_ERROR("[SimEngine][PushTask]peerRank[%u] is invalid, rankSize[%u]", task.peerRank, rankSize_),
+        HCCL_E_PARA);
+    streams_[rank * streamNum_ + stream].tasks.push_back(task);
+    if (taskRecords_ != nullptr) {
+        taskRecords_->push_back({rank, stream, task.type, task.peerRank, task.dst, task.src, task.size,
+            task.notifyId});
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::Memcpy(u32 rank, u32 stream, u32 dstRank, void *dst, const void *src, u64 size,
+    SimLinkType linkType)
+{
+    CHK_PRT_RET(size != 0 && (dst == nullptr || src == nullptr),
+        HCCL_ERROR("[SimEngine][Memcpy]dst or src is nullptr, size[%llu]", size), HCCL_E_PTR);
+    SimTask task{SimTaskType::SIM_TASK_MEMCPY, dstRank, linkType, dst, src, size, HCCL_DATA_TYPE_RESERVED,
+        HCCL_REDUCE_RESERVED, 0};
+    return PushTask(rank, stream, task);
+}
+
+HcclResult SimEngine::Reduce(u32 rank, u32 stream, u32 dstRank, void *dst, const void *src, u64 count,
+    HcclDataType dataType, HcclReduceOp op, SimLinkType linkType)
+{
+    CHK_PRT_RET(count != 0 && (dst == nullptr || src == nullptr),
+        HCCL_ERROR("[SimEngine][Reduce]dst or src is nullptr, count[%llu]", count), HCCL_E_PTR);
+    CHK_PRT_RET(op != HCCL_REDUCE_SUM && op != HCCL_REDUCE_PROD && op != HCCL_REDUCE_MAX && op != HCCL_REDUCE_MIN,
+        HCCL_ERROR("[SimEngine][Reduce]op[%d] is not supported", op), HCCL_E_NOT_SUPPORT);
+    u32 unitSize = 0;
+    CHK_RET(SalGetDataTypeSize(dataType, unitSize));
+    SimTask task{SimTaskType::SIM_TASK_REDUCE, dstRank, linkType, dst, src, count * unitSize, dataType, op, 0};
+    return PushTask(rank, stream, task);
+}
+
+HcclResult SimEngine::Record(u32 rank, u32 stream, u32 notifyRank, u32 notifyId)
+{
+    SimTask task{SimTaskType::SIM_TASK_RECORD, notifyRank, SimLinkType::SIM_LINK_SDMA, nullptr, nullptr, 0,
+        HCCL_DATA_TYPE_RESERVED, HCCL_REDUCE_RESERVED, notifyId};
+    return PushTask(rank, stream, task);
+}
+
+HcclResult SimEngine::Wait(u32 rank, u32 stream, u32 notifyId)
+{
+    SimTask task{SimTaskType::SIM_TASK_WAIT, rank, SimLinkType::SIM_LINK_SDMA, nullptr, nullptr, 0,
+        HCCL_DATA_TYPE_RESERVED, HCCL_REDUCE_RESERVED, notifyId};
+    return PushTask(rank, stream, task);
+}
+
+std::vector<double> &SimEngine::GetEngines(u32 rank, SimLinkType linkType)
+{
+    return (linkType == SimLinkType::SIM_LINK_RDMA) ? rdmaEngineFreeUs_[rank] : sdmaEngineFreeUs_[rank];
+}
+
+const std::vector<double> &SimEngine::GetEngines(u32 rank, SimLinkType linkType) const
+{
+    return (linkType == SimLinkType::SIM_LINK_RDMA) ? rdmaEngineFreeUs_[rank] : sdmaEngineFreeUs_[rank];
+}
+
+double SimEngine::GetDataTaskCost(u32 rank, const SimTask &task) const
+{
+    SimLinkParam param;
+    auto linkIter = linkParams_.find(std::make_pair(rank, task.peerRank));
+    if (linkIter != linkParams_.end()) {
+        param = linkIter->second;
+    } else if (task.linkType == SimLinkType::SIM_LINK_RDMA) {
+        param = config_.rdma;
+    } else {
+        param = config_.sdma;
+        if (task.size > config_.sdmaLargeThreshold) {
+            param.alphaUs = config_.sdmaLargeAlphaUs;
+        }
+    }
+    double costUs = param.alphaUs + task.size / param.bandwidthMB;
+    // 本地reduce走CCE, 片内/片间reduce按inline reduce随搬运完成
+    if (task.type == SimTaskType::SIM_TASK_REDUCE && task.peerRank == rank) {
+        costUs = config_.reduce.alphaUs + task.size / config_.reduce.bandwidthMB;
+    }
+    return costUs;
+}
+
+bool SimEngine::GetStartTime(u32 rank, const SimTask &task, double streamReadyUs, double &startUs) const
+{
+    startUs = streamReadyUs;
+    switch (task.type) {
+        case SimTaskType::SIM_TASK_WAIT: {
+            auto postIter = notifyPosts_.find(std::make_pair(rank, task.notifyId));
+            if (postIter == notifyPosts_.end() || postIter->second.empty()) {
+                return false;
+            }
+            startUs = std::max(startUs, postIter->second.front());
+            return true;
+        }
+        case SimTaskType::SIM_TASK_MEMCPY:
+        case SimTaskType::SIM_TASK_REDUCE: {
+            const std::vector<double> &engines = GetEngines(rank, task.linkType);
+            startUs = std::max(startUs, *std::min_element(engines.begin(), engines.end()));
+            if (task.peerRank != rank) {
+                auto linkIter = linkFreeUs_.find(std::make_pair(rank, task.peerRank));
+                if (linkIter != linkFreeUs_.end()) {
+                    startUs = std::max(startUs, linkIter->second);
+                }
+            }
+            return true;
+        }
+        default:
+            return true;
+    }
+}
+
+HcclResult SimEngine::Execute(u32 rank, SimStream &simStream, SimReport &report)
+{
+    SimTask task = simStream.tasks.front();
+    simStream.tasks.pop_front();
+    double startUs = 0;
+    (void)GetStartTime(rank, task, simStream.readyUs, startUs);
+    // 开始时刻之前已完成的数据task先落盘, 保证本task读到的是此刻真实可见的数据
+    CHK_RET(ApplyDataEffects(startUs));
+
+    double endUs = startUs;
+    double releaseUs = -1; // stream可以执行下一个task的时刻, 默认为本task结束时刻
+    switch (task.type) {
+        case SimTaskType::SIM_TASK_WAIT:
+            notifyPosts_[std::make_pair(rank, task.notifyId)].pop_front();
+            endUs = startUs + config_.notifyWaitUs;
+            break;
+        case SimTaskType::SIM_TASK_RECORD: {
+            endUs = startUs + config_.notifyRecordUs;
+            // 跨rank的record排在同一链路上已下发的数据之后
+            double visibleUs = endUs;
+            auto linkIter = linkFreeUs_.find(std::make_pair(rank, task.peerRank));
+            if (task.peerRank != rank && linkIter != linkFreeUs_.end()) {
+                visibleUs = std::max(visibleUs, linkIter->second + config_.notifyRecordUs);
+            }
+            // 同一notify的多次record按可见时刻有序排队
+            auto &posts = notifyPosts_[std::make_pair(task.peerRank, task.notifyId)];
+            posts.insert(std::upper_bound(posts.begin(), posts.end(), visibleUs), visibleUs);
+            break;
+        }
+        default: {
+            endUs = startUs + GetDataTaskCost(rank, task);
+            std::vector<double> &engines = GetEngines(rank, task.linkType);
+            *std::min_element(engines.begin(), engines.end()) = endUs;
+            if (task.peerRank != rank) {
+                linkFreeUs_[std::make_pair(rank, task.peerRank)] = endUs;
+                report.linkBytes[std::make_pair(rank, task.peerRank)] += task.size;
+            }
+            if (task.linkType == SimLinkType::SIM_LINK_RDMA && task.peerRank != rank) {
+                releaseUs = startUs + std::min(config_.rdmaPostUs, endUs - startUs);
+            }
+            CHK_RET(StartDataEffect(task, endUs));
+            break;
+        }
+    }
+
+    simStream.readyUs = (releaseUs < 0) ? endUs : releaseUs;
+    report.taskNum++;
+    report.rankTimeUs[rank] = std::max(report.rankTimeUs[rank], endUs);
+    report.totalTimeUs = std::max(report.totalTimeUs, endUs);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::StartDataEffect(const SimTask &task, double endUs)
+{
+    if (task.size == 0) {
+        return HCCL_SUCCESS;
+    }
+    SimPendingEffect effect;
+    effect.task = task;
+    const u8 *src = static_cast<const u8 *>(task.src);
+    effect.srcData.assign(src, src + task.size);
+    pendingEffects_.emplace(std::make_pair(endUs, effectSeq_++), std::move(effect));
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::ApplyDataEffects(double untilUs)
+{
+    auto iter = pendingEffects_.begin();
+    while (iter != pendingEffects_.end() && iter->first.first <= untilUs) {
+        const SimTask &task = iter->second.task;
+        const void *src = iter->second.srcData.data();
+        if (task.type == SimTaskType::SIM_TASK_MEMCPY) {
+            std::memcpy(task.dst, src, task.size);
+        } else {
+            CHK_RET(ReduceBuffer(task.dst, src, task.size, task.dataType, task.op));
+        }
+        iter = pendingEffects_.erase(iter);
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::Run(SimReport &report)
+{
+    report = SimReport();
+    report.rankTimeUs.assign(rankSize_, 0);
+
+    while (true) {
+        // 选择可最早开始的task执行, 开始时刻相同时按(rank, stream)顺序, 保证仿真结果确定
+        bool found = false;
+        bool pending = false;
+        double bestStartUs = 0;
+        u32 bestIdx = 0;
+        for (u32 idx = 0; idx < streams_.size(); idx++) {
+            const SimStream &simStream = streams_[idx];
+            if (simStream.tasks.empty()) {
+                continue;
+            }
+            pending = true;
+            double startUs = 0;
+            if (!GetStartTime(idx / streamNum_, simStream.tasks.front(), simStream.readyUs, startUs)) {
+                continue;
+            }
+            if (!found || startUs < bestStartUs) {
+                found = true;
+                bestStartUs = startUs;
+                bestIdx = idx;
+            }
+        }
+        if (!pending) {
+            CHK_RET(ApplyDataEffects(std::numeric_limits<double>::max()));
+            break;
+        }
+        if (!found) {
+            for (u32 idx = 0; idx < streams_.size(); idx++) {
+                if (!streams_[idx].tasks.empty()) {
+                    HCCL_ERROR("[SimEngine][Run]deadlock, rank[%u] stream[%u] waits notify[%u] forever, "
+                        "remain task[%zu]", idx / streamNum_, idx % streamNum_,
+                        streams_[idx].tasks.front().notifyId, streams_[idx].tasks.size());
+                }
+            }
+            return HCCL_E_INTERNAL;
+        }
+        CHK_RET(Execute(bestIdx / streamNum_, streams_[bestIdx], report));
+    }
+
+    HCCL_INFO("[SimEngine][Run]rankSize[%u] streamNum[%u] taskNum[%llu] totalTime[%f]us",
+        rankSize_, streamNum_, report.taskNum, report.totalTimeUs);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimEngine::ReduceBuffer(void *dst, const void *src, u64 size, HcclDataType dataType, HcclReduceOp op)
+{
+    u32 unitSize = 0;
+    CHK_RET(SalGetDataTypeSize(dataType, unitSize));
+    u64 count = size / unitSize;
+    switch (dataType) {
+        case HCCL_DATA_TYPE_INT8:
+            ReduceTyped<s8>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_INT16:
+            ReduceTyped<short>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_INT32:
+            ReduceTyped<s32>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_INT64:
+            ReduceTyped<s64>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_UINT8:
+            ReduceTyped<u8>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_UINT16:
+            ReduceTyped<u16>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_UINT32:
+            ReduceTyped<u32>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_UINT64:
+            ReduceTyped<u64>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_FP32:
+            ReduceTyped<float>(dst, src, count, op);
+            break;
+        case HCCL_DATA_TYPE_FP64:
+            ReduceTyped<double>(dst, src, count, op);
+            break;
+        default:
+            HCCL_ERROR("[SimEngine][ReduceBuffer]dataType[%d] is not supported on host", dataType);
+            return HCCL_E_NOT_SUPPORT;
+    }
+    return HCCL_SUCCESS;
+}
+}  // namespace hccl
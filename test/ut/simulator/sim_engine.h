@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SIM_ENGINE_H
+#define SIM_ENGINE_H
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+#include "base.h"
+
+namespace hccl {
+enum class SimLinkType {
+    SIM_LINK_SDMA = 0,  /* 片内(HCCS/PCIe/SIO), 由SDMA引擎搬运 */
+    SIM_LINK_RDMA       /* 片间(RoCE), 由RDMA引擎搬运 */
+};
+
+/* 单次传输耗时 = alphaUs + size / bandwidthMB, 与TaskProfiling::GetTaskTime的估算口径一致 */
+struct SimLinkParam {
+    double alphaUs;
+    double bandwidthMB;
+};
+
+struct SimConfig {
+    SimLinkParam sdma{0.6, 19.3 * 1000};        /* 小包(<=512KB)SDMA固定开销0.6us, 19.3GB/s */
+    double sdmaLargeAlphaUs{1.5};              /* 大包SDMA固定开销1.5us */
+    u64 sdmaLargeThreshold{512 * 1024};
+    SimLinkParam rdma{7, 12 * 1000};            /* RDMA固定开销7us, 12GB/s */
+    SimLinkParam reduce{0.6, 10 * 1000};        /* 本地CCE reduce, 10GB/s */
+    double notifyRecordUs{1};
+    double notifyWaitUs{0.02};
+    double rdmaPostUs{1};                       /* RDMA任务下发WQE后即释放stream, 传输由网卡异步完成 */
+    u32 sdmaEngineNum{1};                       /* 每个rank可并发的SDMA引擎数 */
+    u32 rdmaEngineNum{1};                       /* 每个rank可并发的RDMA引擎数 */
+};
+
+enum class SimTaskType {
+    SIM_TASK_MEMCPY = 0,
+    SIM_TASK_REDUCE,
+    SIM_TASK_RECORD,
+    SIM_TASK_WAIT
+};
+
+/* 下发顺序记录的单个task, 用于比对不同次下发的task序列 */
+struct SimTaskRecord {
+    u32 rank;
+    u32 stream;
+    SimTaskType type;
+    u32 peerRank;       /* 数据task为目的rank, record为notify所属rank */
+    const void *dst;
+    const void *src;
+    u64 size;
+    u32 notifyId;
+
+    bool operator==(const SimTaskRecord &other) const
+    {
+        return rank == other.rank && stream == other.stream && type == other.type && peerRank == other.peerRank &&
+            dst == other.dst && src == other.src && size == other.size && notifyId == other.notifyId;
+    }
+};
+
+struct SimReport {
+    double totalTimeUs{0};                       /* 所有stream最后一个task完成的时刻 */
+    std::vector<double> rankTimeUs;              /* 各rank最后一个task完成的时刻 */
+    u64 taskNum{0};
+    std::map<std::pair<u32, u32>, u64> linkBytes; /* (源rank, 目的rank) -> 传输字节数 */
+};
+
+/*
+ * host侧离散事件仿真引擎: 在同一进程内模拟rankSize个rank、每个rank streamNum条stream。
+ * 调用方按dispatcher的语义逐条下发task(拷贝/reduce/notify record/notify wait), Run时按仿真时间顺序执行:
+ * 1. 同一stream内task串行; 不同stream之间只通过notify同步;
+ * 2. 数据task需要占用所在rank的SDMA/RDMA引擎以及(源rank, 目的rank)链路, 资源忙时排队;
+ * 3. RDMA任务只占用stream rdmaPostUs, 之后发往同一对端的record在链路上保序, 在数据传输完成后才可见;
+ * 4. 拷贝与reduce在开始时刻读取源数据, 在完成时刻才写入目的内存(与硬件一致, 未同步就读取的数据是旧值),
+ *    Run结束后可直接校验调用方提供的host内存。
+ * 若存在永远等不到的notify wait, Run返回HCCL_E_INTERNAL。
+ */
+class SimEngine {
+public:
+    SimEngine(u32 rankSize, u32 streamNum, const SimConfig &config = SimConfig());
+    ~SimEngine() = default;
+
+    /* 覆盖(srcRank, dstRank)链路的alpha/beta参数, 未设置的链路使用SimConfig中的默认值 */
+    HcclResult SetLinkParam(u32 srcRank, u32 dstRank, const SimLinkParam &param);
+
+    /* 申请一个notify id, 各rank共用同一id空间, notify由(所属rank, id)唯一标识 */
+    u32 AllocNotify();
+
+    /* rank的stream上下发拷贝, dst位于dstRank; dstRank == rank时为本地拷贝 */
+    HcclResult Memcpy(u32 rank, u32 stream, u32 dstRank, void *dst, const void *src, u64 size,
+        SimLinkType linkType = SimLinkType::SIM_LINK_SDMA);
+
+    /* 带reduce的拷贝: dst = op(dst, src), count为元素个数 */
+    HcclResult Reduce(u32 rank, u32 stream, u32 dstRank, void *dst, const void *src, u64 count,
+        HcclDataType dataType, HcclReduceOp op, SimLinkType linkType = SimLinkType::SIM_LINK_SDMA);
+
+    /* rank的stream上record notifyRank的notify */
+    HcclResult Record(u32 rank, u32 stream, u32 notifyRank, u32 notifyId);
+
+    /* rank的stream上wait本rank的notify, 每次wait消耗一次record */
+    HcclResult Wait(u32 rank, u32 stream, u32 notifyId);
+
+    /* 执行已下发的全部task, 执行完成后task队列清空, 仿真时间不归零, 可继续下发并再次Run */
+    HcclResult Run(SimReport &report);
+
+    /* 设置后每个下发的task按下发顺序追加到records, 传nullptr停止记录 */
+    void SetTaskRecords(std::vector<SimTaskRecord> *records)
+    {
+        taskRecords_ = records;
+    }
+
+    u32 GetRankSize() const
+    {
+        return rankSize_;
+    }
+
+    /* 已record但尚未被wait消费的notify记录数, 算法执行完成后应为0, 否则会污染下一次算子的同步 */
+    u64 GetPendingNotifyNum() const;
+
+private:
+    struct SimTask {
+        SimTaskType type;
+        u32 peerRank;
+        SimLinkType linkType;
+        void *dst;
+        const void *src;
+        u64 size;       /* 字节数 */
+        HcclDataType dataType;
+        HcclReduceOp op;
+        u32 notifyId;
+    };
+
+    /* 已开始但尚未完成的数据task, 完成时刻到达后才写入目的内存 */
+    struct SimPendingEffect {
+        SimTask task;
+        std::vector<u8> srcData;   /* 开始时刻的源数据快照 */
+    };
+
+    struct SimStream {
+        std::deque<SimTask> tasks;
+        double readyUs{0};
+    };
+
+    HcclResult CheckRankStream(u32 rank, u32 stream) const;
+    HcclResult PushTask(u32 rank, u32 stream, const SimTask &task);
+    bool GetStartTime(u32 rank, const SimTask &task, double streamReadyUs, double &startUs) const;
+    HcclResult Execute(u32 rank, SimStream &simStream, SimReport &report);
+    double GetDataTaskCost(u32 rank, const SimTask &task) const;
+    std::vector<double> &GetEngines(u32 rank, SimLinkType linkType);
+    const std::vector<double> &GetEngines(u32 rank, SimLinkType linkType) const;
+    HcclResult StartDataEffect(const SimTask &task, double endUs);
+    HcclResult ApplyDataEffects(double untilUs);
+    static HcclResult ReduceBuffer(void *dst, const void *src, u64 size, HcclDataType dataType, HcclReduceOp op);
+
+    u32 rankSize_;
+    u32 streamNum_;
+    SimConfig config_;
+    u32 notifyIdCounter_{0};
+    std::vector<SimStream> streams_;                              /* 下标: rank * streamNum_ + stream */
+    std::vector<std::vector<double>> sdmaEngineFreeUs_;           /* rank -> 各SDMA引擎空闲时刻 */
+    std::vector<std::vector<double>> rdmaEngineFreeUs_;           /* rank -> 各RDMA引擎空闲时刻 */
+    std::map<std::pair<u32, u32>, double> linkFreeUs_;            /* (源rank, 目的rank) -> 链路空闲时刻 */
+    std::map<std::pair<u32, u32>, SimLinkParam> linkParams_;
+    std::map<std::pair<u32, u32>, std::deque<double>> notifyPosts_; /* (rank, notifyId) -> 未消费record的可见时刻 */
+    std::map<std::pair<double, u64>, SimPendingEffect> pendingEffects_; /* (完成时刻, 下发序号) -> 待写入数据 */
+    u64 effectSeq_{0};
+    std::vector<SimTaskRecord> *taskRecords_{nullptr};
+};
+}  // namespace hccl
+
+#endif /* SIM_ENGINE_H */
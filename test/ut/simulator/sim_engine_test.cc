@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "sim_engine.h"
+#include "sim_transport.h"
+
+using namespace hccl;
+
+class SimEngineTest : public testing::Test {
+protected:
+    static constexpr u64 COUNT = 256;
+};
+
+TEST_F(SimEngineTest, memcpy_result_visible_after_run)
+{
+    SimEngine engine(2, 1);
+    std::vector<s32> src(COUNT, 7);
+    std::vector<s32> dst(COUNT, 0);
+    EXPECT_EQ(engine.Memcpy(0, 0, 1, dst.data(), src.data(), COUNT * sizeof(s32)), HCCL_SUCCESS);
+
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(dst, src);
+    EXPECT_EQ(report.taskNum, 1U);
+    EXPECT_EQ(report.linkBytes[std::make_pair(0U, 1U)], COUNT * sizeof(s32));
+}
+
+TEST_F(SimEngineTest, data_written_at_completion_not_at_start)
+{
+    // 两个SDMA引擎, stream0的拷贝与stream1的读取同时开始, stream1读到的应是旧值
+    SimConfig config;
+    config.sdmaEngineNum = 2;
+    SimEngine engine(1, 2, config);
+    EXPECT_EQ(engine.SetLinkParam(0, 0, SimLinkParam{100, 1}), HCCL_SUCCESS);
+    std::vector<s32> bufA(COUNT, 1);
+    std::vector<s32> bufB(COUNT, 2);
+    std::vector<s32> bufC(COUNT, 0);
+    std::vector<s32> bufD(COUNT, 0);
+    u32 notify = engine.AllocNotify();
+    EXPECT_EQ(engine.Memcpy(0, 0, 0, bufB.data(), bufA.data(), COUNT * sizeof(s32)), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Record(0, 0, 0, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Memcpy(0, 1, 0, bufC.data(), bufB.data(), COUNT * sizeof(s32)), HCCL_SUCCESS);
+    // 同步之后再读, 读到的应是新值
+    EXPECT_EQ(engine.Wait(0, 1, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Memcpy(0, 1, 0, bufD.data(), bufB.data(), COUNT * sizeof(s32)), HCCL_SUCCESS);
+
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(bufB, std::vector<s32>(COUNT, 1));
+    EXPECT_EQ(bufC, std::vector<s32>(COUNT, 2));
+    EXPECT_EQ(bufD, std::vector<s32>(COUNT, 1));
+}
+
+TEST_F(SimEngineTest, reduce_uses_source_snapshot)
+{
+    SimEngine engine(2, 1);
+    std::vector<float> src(COUNT, 1.5f);
+    std::vector<float> dst(COUNT, 2.0f);
+    EXPECT_EQ(engine.Reduce(0, 0, 1, dst.data(), src.data(), COUNT, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_SUM),
+        HCCL_SUCCESS);
+    EXPECT_EQ(engine.Reduce(0, 0, 1, dst.data(), src.data(), COUNT, HCCL_DATA_TYPE_FP32, HCCL_REDUCE_MAX),
+        HCCL_SUCCESS);
+
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(dst, std::vector<float>(COUNT, 3.5f));
+}
+
+TEST_F(SimEngineTest, rdma_record_visible_after_data)
+{
+    SimEngine engine(2, 1);
+    std::vector<u8> src(1024 * 1024, 3);
+    std::vector<u8> dst(src.size(), 0);
+    std::vector<u8> copy(src.size(), 0);
+    u32 notify = engine.AllocNotify();
+    EXPECT_EQ(engine.Memcpy(0, 0, 1, dst.data(), src.data(), src.size(), SimLinkType::SIM_LINK_RDMA), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Record(0, 0, 1, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Wait(1, 0, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Memcpy(1, 0, 1, copy.data(), dst.data(), dst.size()), HCCL_SUCCESS);
+
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(copy, src);
+    // record排在同一链路的RDMA数据之后, rank1的wait要等数据传输完成才能结束
+    SimConfig config;
+    double rdmaUs = config.rdma.alphaUs + src.size() / config.rdma.bandwidthMB;
+    EXPECT_GE(report.rankTimeUs[1], rdmaUs + config.notifyRecordUs);
+}
+
+TEST_F(SimEngineTest, wait_without_record_is_deadlock)
+{
+    SimEngine engine(2, 1);
+    EXPECT_EQ(engine.Wait(1, 0, engine.AllocNotify()), HCCL_SUCCESS);
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_E_INTERNAL);
+}
+
+TEST_F(SimEngineTest, unconsumed_record_is_pending)
+{
+    SimEngine engine(2, 1);
+    u32 notify = engine.AllocNotify();
+    EXPECT_EQ(engine.Record(0, 0, 1, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Record(0, 0, 1, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Wait(1, 0, notify), HCCL_SUCCESS);
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    // 多出的一次record没有被wait消费
+    EXPECT_EQ(engine.GetPendingNotifyNum(), 1U);
+    EXPECT_EQ(engine.Wait(1, 0, notify), HCCL_SUCCESS);
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(engine.GetPendingNotifyNum(), 0U);
+}
+
+TEST_F(SimEngineTest, transport_handshake_and_write)
+{
+    SimEngine engine(2, 1);
+    std::vector<s32> inA(COUNT, 5);
+    std::vector<s32> outA(COUNT, 0);
+    std::vector<s32> inB(COUNT, 0);
+    std::vector<s32> outB(COUNT, 0);
+    SimTransportEnd endA{0, inA.data(), COUNT * sizeof(s32), outA.data(), COUNT * sizeof(s32)};
+    SimTransportEnd endB{1, inB.data(), COUNT * sizeof(s32), outB.data(), COUNT * sizeof(s32)};
+    std::unique_ptr<SimTransport> linkA;
+    std::unique_ptr<SimTransport> linkB;
+    EXPECT_EQ(SimTransport::CreatePair(engine, endA, endB, SimLinkType::SIM_LINK_SDMA, linkA, linkB),
+        HCCL_SUCCESS);
+
+    EXPECT_EQ(linkB->TxAck(0), HCCL_SUCCESS);
+    EXPECT_EQ(linkA->RxAck(0), HCCL_SUCCESS);
+    EXPECT_EQ(linkA->TxAsync(SimMemType::SIM_MEM_OUTPUT, 0, inA.data(), COUNT * sizeof(s32), 0), HCCL_SUCCESS);
+    EXPECT_EQ(linkB->RxAsync(0), HCCL_SUCCESS);
+    EXPECT_EQ(linkB->TxWithReduce(SimMemType::SIM_MEM_OUTPUT, 0, outB.data(), COUNT, HCCL_DATA_TYPE_INT32,
+        HCCL_REDUCE_SUM, 0), HCCL_SUCCESS);
+    EXPECT_EQ(linkA->RxAsync(0), HCCL_SUCCESS);
+    // 越界写对端内存直接报错
+    EXPECT_EQ(linkA->TxAsync(SimMemType::SIM_MEM_OUTPUT, 4, inA.data(), COUNT * sizeof(s32), 0), HCCL_E_PARA);
+
+    SimReport report;
+    EXPECT_EQ(engine.Run(report), HCCL_SUCCESS);
+    EXPECT_EQ(outB, inA);
+    EXPECT_EQ(outA, inA);
+}
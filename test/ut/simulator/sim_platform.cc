@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "sim_platform.h"
+#include "log.h"
+#include "sal_pub.h"
+#include "dispatcher.h"
+#include "runtime_quota.h"
+
+namespace hccl {
+namespace {
+/*
+ * 仿真链路: SDMA链路模拟片内P2P transport(支持inline reduce, 对端内存可直接访问),
+ * RDMA链路模拟RoCE transport(不支持inline reduce)。两者都不支持write with reduce。
+ * 对端的INPUT_MEM/OUTPUT_MEM默认对应CCL input/output, 可按建链诉求的内存类型重新映射。
+ */
+class SimLink : public Transport {
+public:
+    explicit SimLink(std::shared_ptr<SimTransport> transport,
+        SimMemType inputMemType = SimMemType::SIM_MEM_INPUT, SimMemType outputMemType = SimMemType::SIM_MEM_OUTPUT)
+        : transport_(transport), inputMemType_(inputMemType), outputMemType_(outputMemType)
+    {
+    }
+    ~SimLink() override = default;
+
+    HcclResult TxAck(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->TxAck(streamIdx);
+    }
+
+    HcclResult RxAck(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->RxAck(streamIdx);
+    }
+
+    HcclResult TxDataSignal(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->TxDataSignal(streamIdx);
+    }
+
+    HcclResult RxDataSignal(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->RxDataSignal(streamIdx);
+    }
+
+    HcclResult TxAsync(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len, Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->TxAsync(ToSimMemType(dstMemType), dstOffset, src, len, streamIdx);
+    }
+
+    HcclResult TxAsync(std::vector<TxMemoryInfo> &txMems, Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        for (const TxMemoryInfo &txMem : txMems) {
+            CHK_RET(transport_->Write(ToSimMemType(txMem.dstMemType), txMem.dstOffset, txMem.src, txMem.len,
+                streamIdx));
+        }
+        return transport_->TxDataSignal(streamIdx);
+    }
+
+    HcclResult RxAsync(UserMemType srcMemType, u64 srcOffset, void *dst, u64 len, Stream &stream) override
+    {
+        (void)srcMemType;
+        (void)srcOffset;
+        (void)dst;
+        (void)len;
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->RxAsync(streamIdx);
+    }
+
+    HcclResult RxAsync(std::vector<RxMemoryInfo> &rxMems, Stream &stream) override
+    {
+        (void)rxMems;
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->RxAsync(streamIdx);
+    }
+
+    HcclResult TxWaitDone(Stream &stream) override
+    {
+        (void)stream;
+        return HCCL_SUCCESS;
+    }
+
+    HcclResult RxWaitDone(Stream &stream) override
+    {
+        (void)stream;
+        return HCCL_SUCCESS;
+    }
+
+    HcclResult PostFin(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->PostFin(streamIdx);
+    }
+
+    HcclResult WaitFin(Stream &stream) override
+    {
+        u32 streamIdx = 0;
+        CHK_RET(GetStreamIdx(stream, streamIdx));
+        return transport_->WaitFin(streamIdx);
+    }
+
+    // RoCE链路上的FinAck与Fin握手语义一致
+    HcclResult PostFinAck(Stream &stream) override
+    {
+        return PostFin(stream);
+    }
+
+    HcclResult WaitFinAck(Stream &stream) override
+    {
+        return WaitFin(stream);
+    }
+
+    HcclResult GetRemoteMem(UserMemType memType, void **remotePtr) override
+    {
+        CHK_PTR_NULL(remotePtr);
+        CHK_PRT_RET(transport_->GetLinkType() != SimLinkType::SIM_LINK_SDMA,
+            HCCL_ERROR("[SimLink][GetRemoteMem]remote memory is not accessible on rdma link"), HCCL_E_NOT_SUPPORT);
+        return transport_->GetRemoteMem(ToSimMemType(memType), *remotePtr);
+    }
+
+    u32 GetRemoteRank() override
+    {
+        return transport_->GetRemoteRank();
+    }
+
+    LinkType GetLinkType() const override
+    {
+        return (transport_->GetLinkType() == SimLinkType::SIM_LINK_RDMA) ? LinkType::LINK_ROCE :
+            LinkType::LINK_HCCS;
+    }
+
+    bool IsSpInlineReduce() const override
+    {
+        return transport_->GetLinkType() == SimLinkType::SIM_LINK_SDMA;
+    }
+
+    bool IsSupportTransportWithReduce() override
+    {
+        return false;
+    }
+
+    bool IsTransportRoce() override
+    {
+        return transport_->GetLinkType() == SimLinkType::SIM_LINK_RDMA;
+    }
+
+    bool GetSupportDataReceivedAck() const override
+    {
+        return false;
+    }
+
+    std::shared_ptr<SimTransport> GetTransport() const
+    {
+        return transport_;
+    }
+
+private:
+    HcclResult GetStreamIdx(const Stream &stream, u32 &streamIdx) const
+    {
+        u32 rank = 0;
+        CHK_RET(SimPlatform::GetInstance().GetStreamInfo(stream, rank, streamIdx));
+        return HCCL_SUCCESS;
+    }
+
+    SimMemType ToSimMemType(UserMemType memType) const
+    {
+        return (memType == UserMemType::INPUT_MEM) ? inputMemType_ : outputMemType_;
+    }
+
+    std::shared_ptr<SimTransport> transport_;
+    SimMemType inputMemType_;
+    SimMemType outputMemType_;
+};
+}
+
+SimPlatform &SimPlatform::GetInstance()
+{
+    static SimPlatform platform;
+    return platform;
+}
+
+void SimPlatform::Bind(SimEngine *engine)
+{
+    engine_ = engine;
+    streams_.clear();
+    mems_.clear();
+}
+
+void SimPlatform::Unbind()
+{
+    engine_ = nullptr;
+    streams_.clear();
+    mems_.clear();
+}
+
+HcclResult SimPlatform::CheckBind() const
+{
+    CHK_PRT_RET(engine_ == nullptr, HCCL_ERROR("[SimPlatform]no SimEngine is bound"), HCCL_E_INTERNAL);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::CreateStream(u32 rank, u32 streamIdx, Stream &stream, bool isMainStream)
+{
+    CHK_RET(CheckBind());
+    void *handle = reinterpret_cast<void *>(handleCounter_);
+    handleCounter_ += 0x10;
+    streams_[handle] = std::make_pair(rank, streamIdx);
+    stream = Stream(handle, isMainStream);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::CreateNotify(u32 rank, std::shared_ptr<LocalNotify> &notify)
+{
+    CHK_RET(CheckBind());
+    CHK_PRT_RET(rank >= engine_->GetRankSize(),
+        HCCL_ERROR("[SimPlatform][CreateNotify]rank[%u] is invalid", rank), HCCL_E_PARA);
+    notify.reset(new (std::nothrow) LocalNotify());
+    CHK_SMART_PTR_NULL(notify);
+    notify->handle_ = reinterpret_cast<void *>(handleCounter_);
+    handleCounter_ += 0x10;
+    notify->simRank_ = rank;
+    notify->simId_ = engine_->AllocNotify();
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::CreateLinkPair(const SimTransportEnd &endA, const SimTransportEnd &endB,
+    SimLinkType linkType, LINK &linkA, LINK &linkB)
+{
+    CHK_RET(CheckBind());
+    std::unique_ptr<SimTransport> transportA;
+    std::unique_ptr<SimTransport> transportB;
+    CHK_RET(SimTransport::CreatePair(*engine_, endA, endB, linkType, transportA, transportB));
+    linkA.reset(new (std::nothrow) SimLink(std::move(transportA)));
+    CHK_SMART_PTR_NULL(linkA);
+    linkB.reset(new (std::nothrow) SimLink(std::move(transportB)));
+    CHK_SMART_PTR_NULL(linkB);
+    CHK_RET(RegisterMem(endA.rank, endA.inputPtr, endA.inputSize));
+    CHK_RET(RegisterMem(endA.rank, endA.outputPtr, endA.outputSize));
+    CHK_RET(RegisterMem(endB.rank, endB.inputPtr, endB.inputSize));
+    CHK_RET(RegisterMem(endB.rank, endB.outputPtr, endB.outputSize));
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::CreateLinkView(const LINK &link, SimMemType inputMemType, SimMemType outputMemType,
+    LINK &view) const
+{
+    std::shared_ptr<SimLink> simLink = std::dynamic_pointer_cast<SimLink>(link);
+    CHK_SMART_PTR_NULL(simLink);
+    view.reset(new (std::nothrow) SimLink(simLink->GetTransport(), inputMemType, outputMemType));
+    CHK_SMART_PTR_NULL(view);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::RegisterMem(u32 rank, const void *ptr, u64 size)
+{
+    if (ptr == nullptr || size == 0) {
+        return HCCL_SUCCESS;
+    }
+    const u8 *begin = static_cast<const u8 *>(ptr);
+    auto iter = mems_.find(begin);
+    CHK_PRT_RET(iter != mems_.end() && (iter->second.second != rank),
+        HCCL_ERROR("[SimPlatform][RegisterMem]mem[%p] is registered by rank[%u] and rank[%u]",
+        ptr, iter->second.second, rank), HCCL_E_PARA);
+    if (iter == mems_.end() || iter->second.first < size) {
+        mems_[begin] = std::make_pair(size, rank);
+    }
+    return HCCL_SUCCESS;
+}
+
+u32 SimPlatform::GetMemOwner(const void *ptr, u32 defaultRank) const
+{
+    const u8 *addr = static_cast<const u8 *>(ptr);
+    auto iter = mems_.upper_bound(addr);
+    if (iter == mems_.begin()) {
+        return defaultRank;
+    }
+    --iter;
+    return (addr < iter->first + iter->second.first) ? iter->second.second : defaultRank;
+}
+
+u32 SimPlatform::GetPeerRank(u32 rank, const void *dst, const void *src) const
+{
+    // 写远端时对端为目的内存所属rank, 读远端(如inline reduce)时对端为源内存所属rank
+    u32 dstRank = GetMemOwner(dst, rank);
+    return (dstRank != rank) ? dstRank : GetMemOwner(src, rank);
+}
+
+HcclResult SimPlatform::GetStreamInfo(const Stream &stream, u32 &rank, u32 &streamIdx) const
+{
+    auto iter = streams_.find(stream.ptr());
+    CHK_PRT_RET(iter == streams_.end(),
+        HCCL_ERROR("[SimPlatform][GetStreamInfo]stream[%p] is not created by SimPlatform", stream.ptr()),
+        HCCL_E_PARA);
+    rank = iter->second.first;
+    streamIdx = iter->second.second;
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimPlatform::Post(Stream &stream, const LocalNotify &notify)
+{
+    CHK_RET(CheckBind());
+    u32 rank = 0;
+    u32 streamIdx = 0;
+    CHK_RET(GetStreamInfo(stream, rank, streamIdx));
+    return engine_->Record(rank, streamIdx, notify.simRank_, notify.simId_);
+}
+
+HcclResult SimPlatform::Wait(Stream &stream, const LocalNotify &notify)
+{
+    CHK_RET(CheckBind());
+    u32 rank = 0;
+    u32 streamIdx = 0;
+    CHK_RET(GetStreamInfo(stream, rank, streamIdx));
+    CHK_PRT_RET(rank != notify.simRank_,
+        HCCL_ERROR("[SimPlatform][Wait]rank[%u] waits notify of rank[%u]", rank, notify.simRank_), HCCL_E_PARA);
+    return engine_->Wait(rank, streamIdx, notify.simId_);
+}
+
+HcclResult SimPlatform::Memcpy(Stream &stream, void *dst, const void *src, u64 size, LinkType linkType)
+{
+    CHK_RET(CheckBind());
+    u32 rank = 0;
+    u32 streamIdx = 0;
+    CHK_RET(GetStreamInfo(stream, rank, streamIdx));
+    SimLinkType simLinkType = (linkType == LinkType::LINK_ROCE || linkType == LinkType::LINK_STANDARD_ROCE) ?
+        SimLinkType::SIM_LINK_RDMA : SimLinkType::SIM_LINK_SDMA;
+    return engine_->Memcpy(rank, streamIdx, GetPeerRank(rank, dst, src), dst, src, size, simLinkType);
+}
+
+HcclResult SimPlatform::Reduce(Stream &stream, void *dst, const void *src, u64 count, HcclDataType dataType,
+    HcclReduceOp op, LinkType linkType)
+{
+    CHK_RET(CheckBind());
+    u32 rank = 0;
+    u32 streamIdx = 0;
+    CHK_RET(GetStreamInfo(stream, rank, streamIdx));
+    SimLinkType simLinkType = (linkType == LinkType::LINK_ROCE || linkType == LinkType::LINK_STANDARD_ROCE) ?
+        SimLinkType::SIM_LINK_RDMA : SimLinkType::SIM_LINK_SDMA;
+    return engine_->Reduce(rank, streamIdx, GetPeerRank(rank, dst, src), dst, src, count, dataType, op,
+        simLinkType);
+}
+
+/* 以下为算法代码依赖的dispatcher/notify接口在UT中的实现, 全部转发给SimPlatform */
+HcclResult LocalNotify::Init(const NotifyLoadType type)
+{
+    (void)type;
+    if (StubRuntimeEnabled() && !quotaHeld_) {
+        CHK_RET(StubRuntimeCreateNotify());
+        quotaHeld_ = true;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult LocalNotify::Destroy()
+{
+    if (quotaHeld_) {
+        StubRuntimeDestroyNotify();
+        quotaHeld_ = false;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult LocalNotify::SetIpc()
+{
+    return HCCL_SUCCESS;
+}
+
+HcclResult LocalNotify::Post(Stream &stream, HcclDispatcher dispatcher, const std::shared_ptr<LocalNotify> &notify,
+    s32 stage)
+{
+    (void)dispatcher;
+    (void)stage;
+    CHK_SMART_PTR_NULL(notify);
+    return SimPlatform::GetInstance().Post(stream, *notify);
+}
+
+HcclResult LocalNotify::Wait(Stream &stream, HcclDispatcher dispatcher, const std::shared_ptr<LocalNotify> &notify,
+    s32 stage, u32 timeOut)
+{
+    (void)dispatcher;
+    (void)stage;
+    (void)timeOut;
+    CHK_SMART_PTR_NULL(notify);
+    return SimPlatform::GetInstance().Wait(stream, *notify);
+}
+}  // namespace hccl
+
+HcclResult HcclD2DMemcpyAsync(HcclDispatcher dispatcherPtr, hccl::DeviceMem &dst, const hccl::DeviceMem &src,
+    hccl::Stream &stream, u32 remoteUserRank, hccl::LinkType inLinkType)
+{
+    (void)dispatcherPtr;
+    (void)remoteUserRank;
+    CHK_PRT_RET(dst.size() < src.size(),
+        HCCL_ERROR("[HcclD2DMemcpyAsync]dst size[%llu] is less than src size[%llu]", dst.size(), src.size()),
+        HCCL_E_PARA);
+    if (dst.ptr() == src.ptr()) {
+        return HCCL_SUCCESS;
+    }
+    return hccl::SimPlatform::GetInstance().Memcpy(stream, dst.ptr(), src.ptr(), src.size(), inLinkType);
+}
+
+HcclResult HcclReduceAsync(HcclDispatcher dispatcherPtr, void *src, u64 count, const HcclDataType datatype,
+    const HcclReduceOp reduceOp, hccl::Stream &stream, void *dst, const u32 remoteUserRank,
+    const hccl::LinkType linkType, const u64 reduceAttr)
+{
+    (void)dispatcherPtr;
+    (void)remoteUserRank;
+    (void)reduceAttr;
+    return hccl::SimPlatform::GetInstance().Reduce(stream, dst, src, count, datatype, reduceOp, linkType);
+}
+
+HcclResult HcclDispatcherWaitValue(HcclDispatcher dispatcherPtr, hccl::Stream &stream, u64 waitAddr, u64 valueAddr,
+    bool reset)
+{
+    (void)dispatcherPtr;
+    (void)stream;
+    (void)waitAddr;
+    (void)valueAddr;
+    (void)reset;
+    HCCL_ERROR("[HcclDispatcherWaitValue]mc2 wait value task is not simulated");
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult HcclDispatcherWriteValue(HcclDispatcher dispatcherPtr, hccl::Stream &stream, u64 writeAddr,
+    u64 valueAddr)
+{
+    (void)dispatcherPtr;
+    (void)stream;
+    (void)writeAddr;
+    (void)valueAddr;
+    HCCL_ERROR("[HcclDispatcherWriteValue]mc2 write value task is not simulated");
+    return HCCL_E_NOT_SUPPORT;
+}
+
+bool IsSupportSDMAReduce(const void *inputPtr, const void *outputPtr, HcclDataType dataType, HcclReduceOp op)
+{
+    (void)inputPtr;
+    (void)outputPtr;
+    return (op != HCCL_REDUCE_PROD) && (dataType != HCCL_DATA_TYPE_INT64);
+}
+
+bool IsSupportRDMAReduce(HcclDataType dataType, HcclReduceOp op)
+{
+    (void)dataType;
+    (void)op;
+    return false;
+}
+
+HcclResult InitTask(HcclDispatcher dispatcherPtr, hccl::Stream &stream, const bool enableCache,
+    const std::string &key, bool useGraphConstructorV2)
+{
+    (void)enableCache;
+    (void)key;
+    (void)useGraphConstructorV2;
+    CHK_PTR_NULL(dispatcherPtr);
+    CHK_PTR_NULL(stream.ptr());
+    return HCCL_SUCCESS;
+}
+
+HcclResult LaunchTask(HcclDispatcher dispatcherPtr, hccl::Stream &stream)
+{
+    CHK_PTR_NULL(dispatcherPtr);
+    CHK_PTR_NULL(stream.ptr());
+    return HCCL_SUCCESS;
+}
+
+HcclResult LaunchTaskExtend(HcclDispatcher dispatcherPtr, hccl::Stream &stream, std::vector<hccl::Stream> &subStream)
+{
+    (void)subStream;
+    return LaunchTask(dispatcherPtr, stream);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SIM_PLATFORM_H
+#define SIM_PLATFORM_H
+
+#include <map>
+#include <memory>
+#include <utility>
+#include "sim_engine.h"
+#include "sim_transport.h"
+#include "stream_pub.h"
+#include "local_notify.h"
+#include "transport_pub.h"
+#include "dispatcher.h"
+
+namespace hccl {
+/*
+ * 仿真平台: 把算法代码看到的Stream/LocalNotify/Transport/dispatcher接口映射到SimEngine上,
+ * 使AlgTemplate与CollExecutor不经修改即可在host上以多rank方式运行。
+ * 用法: Bind(engine)后为每个rank创建stream/notify/link, 逐rank调用算法下发task, 最后engine.Run执行。
+ * 同一时刻只能绑定一个engine, 用例结束时需Unbind。
+ */
+class SimPlatform {
+public:
+    static SimPlatform &GetInstance();
+
+    void Bind(SimEngine *engine);
+    void Unbind();
+
+    /* 为rank创建第streamIdx条stream, streamIdx需小于engine的streamNum */
+    HcclResult CreateStream(u32 rank, u32 streamIdx, Stream &stream, bool isMainStream = false);
+    HcclResult CreateNotify(u32 rank, std::shared_ptr<LocalNotify> &notify);
+    /* 创建一对互为对端的链路, endA/endB的input/output内存为对端可读写的CCL buffer */
+    HcclResult CreateLinkPair(const SimTransportEnd &endA, const SimTransportEnd &endB, SimLinkType linkType,
+        LINK &linkA, LINK &linkB);
+    /* 与link共用收发通道, 对端INPUT_MEM/OUTPUT_MEM分别映射到inputMemType/outputMemType */
+    HcclResult CreateLinkView(const LINK &link, SimMemType inputMemType, SimMemType outputMemType,
+        LINK &view) const;
+    /* 登记rank的内存区间, dispatcher下发的拷贝据此识别跨rank搬运 */
+    HcclResult RegisterMem(u32 rank, const void *ptr, u64 size);
+
+    HcclResult GetStreamInfo(const Stream &stream, u32 &rank, u32 &streamIdx) const;
+
+    /* 算法只校验dispatcher非空, 仿真下发不依赖其内容 */
+    HcclDispatcher GetDispatcher()
+    {
+        return this;
+    }
+
+    HcclResult Post(Stream &stream, const LocalNotify &notify);
+    HcclResult Wait(Stream &stream, const LocalNotify &notify);
+    HcclResult Memcpy(Stream &stream, void *dst, const void *src, u64 size, LinkType linkType);
+    HcclResult Reduce(Stream &stream, void *dst, const void *src, u64 count, HcclDataType dataType,
+        HcclReduceOp op, LinkType linkType);
+
+private:
+    SimPlatform() = default;
+    ~SimPlatform() = default;
+    HcclResult CheckBind() const;
+    u32 GetMemOwner(const void *ptr, u32 defaultRank) const;
+    u32 GetPeerRank(u32 rank, const void *dst, const void *src) const;
+
+    SimEngine *engine_{nullptr};
+    uintptr_t handleCounter_{0x1000};                       /* 伪句柄, 只用于区分不同的stream/notify */
+    std::map<const void *, std::pair<u32, u32>> streams_;   /* 句柄 -> (rank, stream下标) */
+    std::map<const u8 *, std::pair<u64, u32>> mems_;        /* 起始地址 -> (长度, rank) */
+};
+}  // namespace hccl
+
+#endif /* SIM_PLATFORM_H */
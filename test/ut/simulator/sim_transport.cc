@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "sim_transport.h"
+#include "log.h"
+#include "sal_pub.h"
+
+namespace hccl {
+SimTransport::SimTransport(SimEngine &engine, const SimTransportEnd &local, const SimTransportEnd &remote,
+    SimLinkType linkType)
+    : engine_(engine), local_(local), remote_(remote), linkType_(linkType)
+{
+}
+
+HcclResult SimTransport::CreatePair(SimEngine &engine, const SimTransportEnd &endA, const SimTransportEnd &endB,
+    SimLinkType linkType, std::unique_ptr<SimTransport> &transportA, std::unique_ptr<SimTransport> &transportB)
+{
+    CHK_PRT_RET(endA.rank == endB.rank || endA.rank >= engine.GetRankSize() || endB.rank >= engine.GetRankSize(),
+        HCCL_ERROR("[SimTransport][CreatePair]rank pair[%u, %u] is invalid, rankSize[%u]",
+        endA.rank, endB.rank, engine.GetRankSize()), HCCL_E_PARA);
+
+    transportA.reset(new (std::nothrow) SimTransport(engine, endA, endB, linkType));
+    CHK_SMART_PTR_NULL(transportA);
+    transportB.reset(new (std::nothrow) SimTransport(engine, endB, endA, linkType));
+    CHK_SMART_PTR_NULL(transportB);
+
+    transportA->localAckNotify_ = engine.AllocNotify();
+    transportA->localDataNotify_ = engine.AllocNotify();
+    transportB->localAckNotify_ = engine.AllocNotify();
+    transportB->localDataNotify_ = engine.AllocNotify();
+    transportA->localFinNotify_ = engine.AllocNotify();
+    transportB->localFinNotify_ = engine.AllocNotify();
+    transportA->remoteAckNotify_ = transportB->localAckNotify_;
+    transportA->remoteDataNotify_ = transportB->localDataNotify_;
+    transportB->remoteAckNotify_ = transportA->localAckNotify_;
+    transportB->remoteDataNotify_ = transportA->localDataNotify_;
+    transportA->remoteFinNotify_ = transportB->localFinNotify_;
+    transportB->remoteFinNotify_ = transportA->localFinNotify_;
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimTransport::GetRemoteAddr(SimMemType memType, u64 offset, u64 len, void *&addr) const
+{
+    void *base = (memType == SimMemType::SIM_MEM_INPUT) ? remote_.inputPtr : remote_.outputPtr;
+    u64 size = (memType == SimMemType::SIM_MEM_INPUT) ? remote_.inputSize : remote_.outputSize;
+    CHK_PRT_RET(base == nullptr || offset > size || len > size - offset,
+        HCCL_ERROR("[SimTransport][GetRemoteAddr]remote rank[%u] memType[%d] offset[%llu] len[%llu] "
+        "exceeds size[%llu]", remote_.rank, static_cast<s32>(memType), offset, len, size), HCCL_E_PARA);
+    addr = static_cast<u8 *>(base) + offset;
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimTransport::GetRemoteMem(SimMemType memType, void *&addr) const
+{
+    addr = (memType == SimMemType::SIM_MEM_INPUT) ? remote_.inputPtr : remote_.outputPtr;
+    CHK_PTR_NULL(addr);
+    return HCCL_SUCCESS;
+}
+
+HcclResult SimTransport::TxAck(u32 stream)
+{
+    return engine_.Record(local_.rank, stream, remote_.rank, remoteAckNotify_);
+}
+
+HcclResult SimTransport::RxAck(u32 stream)
+{
+    return engine_.Wait(local_.rank, stream, localAckNotify_);
+}
+
+HcclResult SimTransport::Write(SimMemType dstMemType, u64 dstOffset, const void *src, u64 len, u32 stream)
+{
+    void *dst = nullptr;
+    CHK_RET(GetRemoteAddr(dstMemType, dstOffset, len, dst));
+    return engine_.Memcpy(local_.rank, stream, remote_.rank, dst, src, len, linkType_);
+}
+
+HcclResult SimTransport::TxAsync(SimMemType dstMemType, u64 dstOffset, const void *src, u64 len, u32 stream)
+{
+    CHK_RET(Write(dstMemType, dstOffset, src, len, stream));
+    return engine_.Record(local_.rank, stream, remote_.rank, remoteDataNotify_);
+}
+
+HcclResult SimTransport::TxWithReduce(SimMemType dstMemType, u64 dstOffset, const void *src, u64 count,
+    HcclDataType dataType, HcclReduceOp op, u32 stream)
+{
+    u32 unitSize = 0;
+    CHK_RET(SalGetDataTypeSize(dataType, unitSize));
+    void *dst = nullptr;
+    CHK_RET(GetRemoteAddr(dstMemType, dstOffset, count * unitSize, dst));
+    CHK_RET(engine_.Reduce(local_.rank, stream, remote_.rank, dst, src, count, dataType, op, linkType_));
+    return engine_.Record(local_.rank, stream, remote_.rank, remoteDataNotify_);
+}
+
+HcclResult SimTransport::RxAsync(u32 stream)
+{
+    return engine_.Wait(local_.rank, stream, localDataNotify_);
+}
+
+HcclResult SimTransport::TxDataSignal(u32 stream)
+{
+    return engine_.Record(local_.rank, stream, remote_.rank, remoteDataNotify_);
+}
+
+HcclResult SimTransport::RxDataSignal(u32 stream)
+{
+    return engine_.Wait(local_.rank, stream, localDataNotify_);
+}
+
+HcclResult SimTransport::PostFin(u32 stream)
+{
+    return engine_.Record(local_.rank, stream, remote_.rank, remoteFinNotify_);
+}
+
+HcclResult SimTransport::WaitFin(u32 stream)
+{
+    return engine_.Wait(local_.rank, stream, localFinNotify_);
+}
+}  // namespace hccl
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SIM_TRANSPORT_H
+#define SIM_TRANSPORT_H
+
+#include <memory>
+#include "sim_engine.h"
+
+namespace hccl {
+enum class SimMemType {
+    SIM_MEM_INPUT = 0,
+    SIM_MEM_OUTPUT
+};
+
+/* 链路一端的rank及其对端可写的host内存 */
+struct SimTransportEnd {
+    u32 rank;
+    void *inputPtr;
+    u64 inputSize;
+    void *outputPtr;
+    u64 outputSize;
+};
+
+/*
+ * 仿真链路, 接口语义与Transport保持一致:
+ * TxAck/RxAck为接收方就绪握手, TxAsync写对端内存并通知对端, RxAsync等待对端写完,
+ * TxDataSignal/RxDataSignal为不带数据的同步, PostFin/WaitFin为接收方处理完数据后通知发送方的结束握手。
+ * stream为SimEngine中本rank的stream下标。
+ */
+class SimTransport {
+public:
+    static HcclResult CreatePair(SimEngine &engine, const SimTransportEnd &endA, const SimTransportEnd &endB,
+        SimLinkType linkType, std::unique_ptr<SimTransport> &transportA, std::unique_ptr<SimTransport> &transportB);
+    ~SimTransport() = default;
+
+    HcclResult TxAck(u32 stream);
+    HcclResult RxAck(u32 stream);
+    HcclResult TxAsync(SimMemType dstMemType, u64 dstOffset, const void *src, u64 len, u32 stream);
+    HcclResult TxWithReduce(SimMemType dstMemType, u64 dstOffset, const void *src, u64 count,
+        HcclDataType dataType, HcclReduceOp op, u32 stream);
+    HcclResult RxAsync(u32 stream);
+    HcclResult TxDataSignal(u32 stream);
+    HcclResult RxDataSignal(u32 stream);
+    HcclResult PostFin(u32 stream);
+    HcclResult WaitFin(u32 stream);
+    /* 只写对端内存不通知对端, 批量发送时与TxDataSignal配合使用 */
+    HcclResult Write(SimMemType dstMemType, u64 dstOffset, const void *src, u64 len, u32 stream);
+    HcclResult GetRemoteMem(SimMemType memType, void *&addr) const;
+
+    u32 GetRemoteRank() const
+    {
+        return remote_.rank;
+    }
+
+    SimLinkType GetLinkType() const
+    {
+        return linkType_;
+    }
+
+private:
+    SimTransport(SimEngine &engine, const SimTransportEnd &local, const SimTransportEnd &remote,
+        SimLinkType linkType);
+    HcclResult GetRemoteAddr(SimMemType memType, u64 offset, u64 len, void *&addr) const;
+
+    SimEngine &engine_;
+    SimTransportEnd local_;
+    SimTransportEnd remote_;
+    SimLinkType linkType_;
+    u32 localAckNotify_{0};     /* 对端TxAck时record, 本端RxAck时wait */
+    u32 localDataNotify_{0};    /* 对端TxAsync/TxDataSignal时record, 本端RxAsync/RxDataSignal时wait */
+    u32 localFinNotify_{0};     /* 对端PostFin时record, 本端WaitFin时wait */
+    u32 remoteAckNotify_{0};
+    u32 remoteDataNotify_{0};
+    u32 remoteFinNotify_{0};
+};
+}  // namespace hccl
+
+#endif /* SIM_TRANSPORT_H */
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 错误码上报在UT中不生效 */
+#ifndef HCCL_UT_STUB_ADAPTER_ERROR_MANAGER_PUB_H
+#define HCCL_UT_STUB_ADAPTER_ERROR_MANAGER_PUB_H
+
+#include <string>
+#include <vector>
+
+#define GET_SOCKET_TIMEOUT_REASON "socket establish timeout"
+
+#define RPT_INPUT_ERR(result, error_code, key, value) \
+    do {                                              \
+        (void)(result);                               \
+        (void)(error_code);                           \
+        (void)(key);                                  \
+        (void)(value);                                \
+    } while (0)
+
+#endif /* HCCL_UT_STUB_ADAPTER_ERROR_MANAGER_PUB_H */
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_UT_STUB_ADAPTER_RTS_COMMON_H
+#define HCCL_UT_STUB_ADAPTER_RTS_COMMON_H
+
+#include "base.h"
+
+HcclResult hrtGetDevice(s32 *deviceLogicId);
+HcclResult hrtStreamActive(rtStream_t activeStream, rtStream_t stream);
+HcclResult hrtGetStreamId(rtStream_t stream, s32 &streamId);
+HcclResult hrtNotifyReset(void *notify);
+
+enum class HcclRtMemcpyKind {
+    HCCL_RT_MEMCPY_KIND_HOST_TO_HOST = 0,
+    HCCL_RT_MEMCPY_KIND_HOST_TO_DEVICE,
+    HCCL_RT_MEMCPY_KIND_DEVICE_TO_HOST,
+    HCCL_RT_MEMCPY_KIND_DEVICE_TO_DEVICE
+};
+
+/* UT桩: 仿真内存均为主机内存, 同步拷贝直接memcpy */
+HcclResult hrtMemSyncCopy(void *dst, u64 destMax, const void *src, u64 count, HcclRtMemcpyKind kind);
+
+#endif /* HCCL_UT_STUB_ADAPTER_RTS_COMMON_H */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 平台包base.h的host侧最小实现, 只提供算法与框架代码在UT中编译所需的类型与常量 */
+#ifndef HCCL_UT_STUB_BASE_H
+#define HCCL_UT_STUB_BASE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include <algorithm>
+#include <sstream>
+#include <array>
+#include <chrono>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "hccl/hccl_types.h"
+#include "securec.h"
+#include "log.h"
+
+using u8 = uint8_t;
+using u16 = uint16_t;
+using u32 = uint32_t;
+using u64 = unsigned long long;
+using s8 = int8_t;
+using s16 = int16_t;
+using s32 = int32_t;
+using s64 = signed long long;
+using char8 = char;
+
+using rtStream_t = void *;
+using rtModel_t = void *;
+using HcclRtContext = void *;
+
+namespace hccl {
+using HcclRtStream = void *;
+
+/* 引用计数, 用于静态资源的按实例释放 */
+class Referenced {
+public:
+    s32 Ref()
+    {
+        return ++count_;
+    }
+    s32 Unref()
+    {
+        return --count_;
+    }
+    s32 Count() const
+    {
+        return count_;
+    }
+
+private:
+    s32 count_ = 0;
+};
+}
+
+using HcclUs = std::chrono::steady_clock::time_point;
+#define TIME_NOW() std::chrono::steady_clock::now()
+#define DURATION_US(x) (std::chrono::duration_cast<std::chrono::microseconds>(x))
+
+#define LIKELY(x) (__builtin_expect(!!(x), 1))
+#define UNLIKELY(x) (__builtin_expect(!!(x), 0))
+
+struct ErrContextPub {
+    u64 workId{0};
+};
+
+constexpr u32 INVALID_UINT = 0xFFFFFFFF;
+constexpr u64 INVALID_U64 = 0xFFFFFFFFFFFFFFFF;
+constexpr s32 INVALID_INT = 0xFFFFFFFF;
+constexpr u32 INVALID_VALUE_RANKID = 0xFFFFFFFF;
+constexpr u32 INVALID_VALUE_RANKSIZE = 0xFFFFFFFF;
+constexpr s32 INVALID_VALUE_STAGE = -1;
+constexpr u32 HCCL_ALIGN_SIZE = 4096;
+
+#endif /* HCCL_UT_STUB_BASE_H */
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 配置日志统一落到普通日志 */
+#ifndef HCCL_UT_STUB_CONFIG_LOG_H
+#define HCCL_UT_STUB_CONFIG_LOG_H
+
+#include "log.h"
+
+#define HCCL_ALG    (0x1ULL << 0)
+#define HCCL_TASK   (0x1ULL << 1)
+
+#define HCCL_CONFIG_INFO(config, format, ...) HCCL_INFO(format, ##__VA_ARGS__)
+#define HCCL_CONFIG_DEBUG(config, format, ...) HCCL_DEBUG(format, ##__VA_ARGS__)
+
+#endif /* HCCL_UT_STUB_CONFIG_LOG_H */
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 建链异常检测在UT中只记录入队次数 */
+#ifndef HCCL_UT_STUB_DETECT_CONNECT_ANOMALIES_H
+#define HCCL_UT_STUB_DETECT_CONNECT_ANOMALIES_H
+
+#include "base.h"
+#include "common.h"
+#include "hccl_socket.h"
+
+namespace hccl {
+class DetectConnectionAnomalies {
+public:
+    static DetectConnectionAnomalies &GetInstance(s32 deviceLogicID)
+    {
+        (void)deviceLogicID;
+        static DetectConnectionAnomalies instance;
+        return instance;
+    }
+
+    void AddIpQueue(const RankInfo &localRankInfo, const RankInfo &remoteRankInfo, NicType nicType)
+    {
+        (void)localRankInfo;
+        (void)remoteRankInfo;
+        (void)nicType;
+        queueNum_++;
+    }
+
+private:
+    std::atomic<u32> queueNum_{0};
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_DETECT_CONNECT_ANOMALIES_H */
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_UT_STUB_DEVICE_CAPACITY_H
+#define HCCL_UT_STUB_DEVICE_CAPACITY_H
+
+#include "base.h"
+
+namespace hccl {
+/* UT桩: 按level返回单卡带宽(GB/s), 取值可通过SetBandWidthPerNPU覆盖 */
+HcclResult GetBandWidthPerNPU(u32 level, u32 userRankSize, u32 devNumPerAggregation, float &bandWidth);
+void SetBandWidthPerNPU(u32 level, float bandWidth);
+/* UT桩: 仿真平台均按非310P处理 */
+bool Is310PDevice();
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_DEVICE_CAPACITY_H */
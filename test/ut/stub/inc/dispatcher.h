@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: dispatcher在UT中不持有状态, 下发接口按Stream找到仿真rank后转发给SimPlatform */
+#ifndef HCCL_UT_STUB_DISPATCHER_H
+#define HCCL_UT_STUB_DISPATCHER_H
+
+#include "base.h"
+#include "mem_device_pub.h"
+#include "stream_pub.h"
+#include "transport_pub.h"
+
+namespace hccl {
+struct StepData {
+    s32 streamID{-1};
+    s32 planeID{-1};
+    s32 stage{-1};
+    s32 step{-1};
+};
+
+/* task下发的逻辑信息, UT中不使用 */
+struct TaskLogicInfo {
+    u32 taskFuncType{0};
+};
+
+enum class NotifyLoadType {
+    HOST_NOTIFY = 0,
+    DEVICE_NOTIFY
+};
+}
+
+using HcclDispatcher = void *;
+
+constexpr u64 ATTR_POS_INLINE_REDUCE = 0;
+constexpr u64 ATTR_POS_SUPPORT_RDMA_REDUCE = 1;
+
+/* UT桩: 仿真SDMA支持随路规约, 仿真RDMA不支持 */
+bool IsSupportSDMAReduce(const void *inputPtr, const void *outputPtr, HcclDataType dataType, HcclReduceOp op);
+bool IsSupportRDMAReduce(HcclDataType dataType, HcclReduceOp op);
+
+/* UT桩: task直接提交到仿真引擎, 不做缓存和批量下发 */
+HcclResult InitTask(HcclDispatcher dispatcherPtr, hccl::Stream &stream, const bool enableCache,
+    const std::string &key, bool useGraphConstructorV2 = false);
+HcclResult LaunchTask(HcclDispatcher dispatcherPtr, hccl::Stream &stream);
+HcclResult LaunchTaskExtend(HcclDispatcher dispatcherPtr, hccl::Stream &stream, std::vector<hccl::Stream> &subStream);
+
+HcclResult HcclD2DMemcpyAsync(HcclDispatcher dispatcherPtr, hccl::DeviceMem &dst, const hccl::DeviceMem &src,
+    hccl::Stream &stream, u32 remoteUserRank = INVALID_VALUE_RANKID,
+    hccl::LinkType inLinkType = hccl::LinkType::LINK_ONCHIP);
+HcclResult HcclReduceAsync(HcclDispatcher dispatcherPtr, void *src, u64 count, const HcclDataType datatype,
+    const HcclReduceOp reduceOp, hccl::Stream &stream, void *dst, const u32 remoteUserRank,
+    const hccl::LinkType linkType, const u64 reduceAttr);
+
+/* UT桩: MC2细粒度的条件等待/写值task不做仿真, 算法走到该分支时直接失败 */
+HcclResult HcclDispatcherWaitValue(HcclDispatcher dispatcherPtr, hccl::Stream &stream, u64 waitAddr, u64 valueAddr,
+    bool reset);
+HcclResult HcclDispatcherWriteValue(HcclDispatcher dispatcherPtr, hccl::Stream &stream, u64 writeAddr,
+    u64 valueAddr);
+
+#endif /* HCCL_UT_STUB_DISPATCHER_H */
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_UT_STUB_DISPATCHER_TASK_TYPES_H
+#define HCCL_UT_STUB_DISPATCHER_TASK_TYPES_H
+
+#include "base.h"
+#include "transport_pub.h"
+
+namespace hccl {
+enum class TaskType {
+    TASK_SDMA = 0,
+    TASK_RDMA,
+    TASK_REDUCE_INLINE,
+    TASK_REDUCE_TBE,
+    TASK_NOTIFY_RECORD,
+    TASK_NOTIFY_WAIT,
+    TASK_AIV,
+    TASK_HOST
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_DISPATCHER_TASK_TYPES_H */
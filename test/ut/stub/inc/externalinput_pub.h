@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_UT_STUB_EXTERNALINPUT_PUB_H
+#define HCCL_UT_STUB_EXTERNALINPUT_PUB_H
+
+#include "base.h"
+#include "sal_pub.h"
+#include "hccl_common.h"
+
+/* UT桩: 环境变量配置项取默认值, 可通过SetExternalInputHcclAlgoConfig覆盖算法配置 */
+bool GetExternalInputInterHccsDisable();
+u32 GetExternalInputIntraRoceSwitch();
+bool GetExternalInputHcclEnablePipline();
+std::vector<HcclAlgoType> GetExternalInputHcclAlgoConfig(HcclCMDType opType = HcclCMDType::HCCL_CMD_ALL);
+void SetExternalInputHcclAlgoConfig(const std::vector<HcclAlgoType> &algoConfig);
+s32 GetExternalInputHcclLinkTimeOut();
+void SetExternalInputHcclLinkTimeOut(s32 linkTimeOut);
+
+#endif /* HCCL_UT_STUB_EXTERNALINPUT_PUB_H */
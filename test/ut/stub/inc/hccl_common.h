@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 平台包hccl_common.h中算法与框架代码用到的公共类型 */
+#ifndef HCCL_UT_STUB_HCCL_COMMON_H
+#define HCCL_UT_STUB_HCCL_COMMON_H
+
+#include <set>
+#include <string>
+#include "base.h"
+
+enum class DevType {
+    DEV_TYPE_910 = 0,
+    DEV_TYPE_310P3 = 1,
+    DEV_TYPE_910B = 2,
+    DEV_TYPE_310P1 = 3,
+    DEV_TYPE_910_93 = 4,
+    DEV_TYPE_NOSOC = 5,
+    DEV_TYPE_COUNT = 6
+};
+
+enum class LinkMode {
+    LINK_SIMPLEX_MODE = 0,
+    LINK_DUPLEX_MODE,
+    LINK_RESERVED_MODE
+};
+
+enum class SyncMode {
+    DEFAULT_TIMEWAITSYNCMODE = 0,
+    CONFIGURABLE_TIMEWAITSYNCMODE,
+    UNLIMITED_TIMEWAITSYNCMODE
+};
+
+enum class WorkMode {
+    HCCL_MODE_NORMAL = 0,
+    HCCL_MODE_AI_CPU,
+    HCCL_MODE_SCHED_OS
+};
+
+enum class LinkTypeInServer {
+    HCCS_TYPE = 0,
+    PXI_TYPE,
+    SIO_TYPE,
+    HCCS_SW_TYPE,
+    RESERVED_LINK_TYPE
+};
+
+enum class HcclAlgoType {
+    HCCL_ALGO_TYPE_DEFAULT = 0,
+    HCCL_ALGO_TYPE_RING,
+    HCCL_ALGO_TYPE_PIPELINE,
+    HCCL_ALGO_TYPE_FULLMESH,
+    HCCL_ALGO_TYPE_HDR,
+    HCCL_ALGO_TYPE_PAIRWISE,
+    HCCL_ALGO_TYPE_NHR,
+    HCCL_ALGO_TYPE_NHR_V1,
+    HCCL_ALGO_TYPE_NB,
+    HCCL_ALGO_TYPE_AHC,
+    HCCL_ALGO_TYPE_AHC_BROKE,
+    HCCL_ALGO_TYPE_NULL,
+    HCCL_ALGO_TYPE_NA
+};
+
+enum class HcclCMDType {
+    HCCL_CMD_INVALID = 0,
+    HCCL_CMD_BROADCAST = 1,
+    HCCL_CMD_ALLREDUCE,
+    HCCL_CMD_REDUCE,
+    HCCL_CMD_SEND,
+    HCCL_CMD_RECEIVE,
+    HCCL_CMD_ALLGATHER,
+    HCCL_CMD_REDUCE_SCATTER,
+    HCCL_CMD_ALLTOALLV,
+    HCCL_CMD_ALLTOALLVC,
+    HCCL_CMD_ALLTOALL,
+    HCCL_CMD_GATHER,
+    HCCL_CMD_SCATTER,
+    HCCL_CMD_BATCH_SEND_RECV,
+    HCCL_CMD_BATCH_PUT,
+    HCCL_CMD_BATCH_GET,
+    HCCL_CMD_ALLGATHER_V,
+    HCCL_CMD_REDUCE_SCATTER_V,
+    HCCL_CMD_BATCH_WRITE,
+    HCCL_CMD_ALL,
+    HCCL_CMD_MAX
+};
+
+enum class HcclWorkflowMode {
+    HCCL_WORKFLOW_MODE_OPS_KERNEL_INFO_LIB = 0,
+    HCCL_WORKFLOW_MODE_OP_BASE = 1,
+    HCCL_WORKFLOW_MODE_RESERVED = 255
+};
+
+/* 与HcclDataType一一对应的单元素字节数 */
+constexpr u32 SIZE_TABLE[HCCL_DATA_TYPE_RESERVED] = {
+    sizeof(s8), sizeof(s16), sizeof(s32), 2, sizeof(float), sizeof(s64), sizeof(u64), sizeof(u8), sizeof(u16),
+    sizeof(u32), sizeof(double), 2, 16
+};
+
+constexpr u64 INLINE_REDUCE_BITMASK = 0x1;
+constexpr u64 RDMA_REDUCE_BITMASK = 0x2;
+constexpr u64 INLINE_REDUCE_BIT = 0x1;
+constexpr u64 RDMA_SEND_MAX_SIZE = 0x80000000;
+constexpr u64 SDMA_SEND_MAX_SIZE = 0x100000000;
+constexpr u32 MAX_MODULE_DEVICE_NUM = 32;
+constexpr u64 LARGE_PAGE_MEMORY_MIN_SIZE = 2 * 1024 * 1024;
+
+constexpr u32 HCCL_DEVICE_NUM_TWO = 2;
+constexpr u32 HCCL_DEVICE_NUM_FOUR = 4;
+constexpr u32 HCCL_DEVICE_NUM_EIGHT = 8;
+
+constexpr u8 DETERMINISTIC_DISABLE = 0;
+constexpr u8 DETERMINISTIC_ENABLE = 1;
+constexpr u8 DETERMINISTIC_STRICT = 2;
+
+struct OpCounterInfo {
+    bool isEnableCounter{false};
+    u64 headCountMem{0};
+    u64 tailCountMem{0};
+    u64 addOneMem{0};
+    u32 memSize{0};
+};
+
+inline std::string GetDataTypeEnumStr(HcclDataType dataType)
+{
+    return "HcclDataType(" + std::to_string(static_cast<s32>(dataType)) + ")";
+}
+
+inline std::string GetReduceOpEnumStr(HcclReduceOp reduceOp)
+{
+    return "HcclReduceOp(" + std::to_string(static_cast<s32>(reduceOp)) + ")";
+}
+
+struct HcomCollOpInfo {
+    std::string tag;
+    void *inputAddr;
+    void *outputAddr;
+    u64 count;
+    HcclDataType dataType;
+    u32 root;
+    HcclReduceOp reduceOp;
+    u64 strideCount;
+};
+
+#endif /* HCCL_UT_STUB_HCCL_COMMON_H */
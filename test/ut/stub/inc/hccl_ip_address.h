@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: HcclIpAddress只保存可读地址, 比较按字符串进行 */
+#ifndef HCCL_UT_STUB_HCCL_IP_ADDRESS_H
+#define HCCL_UT_STUB_HCCL_IP_ADDRESS_H
+
+#include <string>
+#include <netinet/in.h>
+#include "base.h"
+
+namespace hccl {
+union HcclInAddr {
+    u32 addr;
+    struct in6_addr addr6;
+};
+
+class HcclIpAddress {
+public:
+    HcclIpAddress() = default;
+    explicit HcclIpAddress(const std::string &ip) : ip_(ip)
+    {
+    }
+    explicit HcclIpAddress(u32 addr) : ip_(std::to_string(addr))
+    {
+        binary_.addr = addr;
+    }
+    ~HcclIpAddress() = default;
+
+    const char *GetReadableIP() const
+    {
+        return ip_.c_str();
+    }
+
+    const char *GetReadableAddress() const
+    {
+        return ip_.c_str();
+    }
+
+    HcclInAddr GetBinaryAddress() const
+    {
+        return binary_;
+    }
+
+    bool IsInvalid() const
+    {
+        return ip_.empty();
+    }
+
+    bool IsIPv6() const
+    {
+        return false;
+    }
+
+    bool operator==(const HcclIpAddress &that) const
+    {
+        return ip_ == that.ip_;
+    }
+
+    bool operator!=(const HcclIpAddress &that) const
+    {
+        return ip_ != that.ip_;
+    }
+
+    bool operator<(const HcclIpAddress &that) const
+    {
+        return ip_ < that.ip_;
+    }
+
+private:
+    std::string ip_;
+    HcclInAddr binary_{};
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_HCCL_IP_ADDRESS_H */
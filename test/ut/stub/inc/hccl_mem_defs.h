@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_MEM_DEFS_H
+#define HCCL_MEM_DEFS_H
+
+#include <hccl/base.h>
+
+/* UT桩: 单边通信接口依赖的内存类型定义 */
+typedef enum {
+    HCCL_MEM_TYPE_DEVICE = 0,
+    HCCL_MEM_TYPE_HOST,
+    HCCL_MEM_TYPE_NUM
+} HcclMemType;
+
+typedef struct {
+    HcclMemType type;
+    void *addr;
+    u64 size;
+} HcclMem;
+
+#endif /* HCCL_MEM_DEFS_H */
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: socket相关类型, UT中不建立真实连接, 以本地回环的方式模拟建链过程 */
+#ifndef HCCL_UT_STUB_HCCL_SOCKET_H
+#define HCCL_UT_STUB_HCCL_SOCKET_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "base.h"
+#include "hccl_ip_address.h"
+
+namespace hccl {
+using SocketHandle = void *;
+using HcclNetDevCtx = void *;
+
+constexpr u32 HCCL_INVALID_PORT = 65536;
+
+enum class NICDeployment {
+    NIC_DEPLOYMENT_HOST = 0,
+    NIC_DEPLOYMENT_DEVICE,
+    NIC_DEPLOYMENT_RESERVED
+};
+
+enum class NicType {
+    VNIC_TYPE = 0,
+    DEVICE_NIC_TYPE,
+    HOST_NIC_TYPE
+};
+
+enum class HcclSocketRole {
+    SOCKET_ROLE_SERVER = 0,
+    SOCKET_ROLE_CLIENT,
+    SOCKET_ROLE_RESERVED
+};
+
+enum class HcclSocketStatus {
+    SOCKET_INIT = 0,
+    SOCKET_CONNECTING,
+    SOCKET_OK,
+    SOCKET_TIMEOUT,
+    SOCKET_ERROR
+};
+
+struct HcclRankLinkInfo {
+    u32 userRank;
+    u32 devicePhyId;
+    HcclIpAddress ip;
+    u32 port;
+    u32 socketsPerLink;
+};
+
+struct SocketWlistInfo {
+    u32 connLimit;
+    HcclInAddr remoteIp;
+    char tag[128];
+};
+
+struct HcclSocketInfo {
+    SocketHandle socketHandle;
+    u32 port;
+};
+
+constexpr u32 NIC_SOCKET_CONN_LIMIT = 1;
+constexpr u32 VNIC_SOCKET_CONN_LIMIT = 1;
+constexpr u32 HOST_SOCKET_CONN_LIMIT = 1;
+
+/*
+ * 本地回环socket: Init后经过SetEstablishDelay设置的时长连接才建立完成, 模拟对端异步建链;
+ * 默认构造的socket直接处于建链完成状态
+ */
+class HcclSocket {
+public:
+    HcclSocket() = default;
+    HcclSocket(const std::string &tag, HcclNetDevCtx netDevCtx, const HcclIpAddress &remoteIp, u32 remotePort,
+        HcclSocketRole localRole);
+    HcclSocket(HcclNetDevCtx netDevCtx, u32 localPort);
+    virtual ~HcclSocket();
+
+    HcclResult Init();
+    HcclResult DeInit();
+    HcclResult Listen();
+    HcclResult Connect();
+    void Close();
+    HcclResult AddWhiteList(std::vector<SocketWlistInfo> &wlistInfoVec);
+    HcclResult DelWhiteList(std::vector<SocketWlistInfo> &wlistInfoVec);
+    HcclResult SetStopFlag(bool value);
+
+    HcclSocketStatus GetStatus() const;
+    void SetStatus(HcclSocketStatus status);
+
+    std::string GetTag() const
+    {
+        return tag_;
+    }
+    HcclIpAddress GetLocalIp() const
+    {
+        return localIp_;
+    }
+    HcclIpAddress GetRemoteIp() const
+    {
+        return remoteIp_;
+    }
+    u32 GetLocalPort() const
+    {
+        return localPort_;
+    }
+    u32 GetRemotePort() const
+    {
+        return remotePort_;
+    }
+    HcclSocketRole GetLocalRole() const
+    {
+        return localRole_;
+    }
+    NicType GetSocketType() const
+    {
+        return NicType::DEVICE_NIC_TYPE;
+    }
+
+    // UT: 新建socket从Init到建链完成的时长, 小于0表示永不完成
+    static void SetEstablishDelay(std::chrono::microseconds delay);
+    // UT: 已Init且尚未Close的socket数量
+    static u32 GetOpenSocketNum();
+
+private:
+    std::string tag_;
+    HcclIpAddress localIp_;
+    HcclIpAddress remoteIp_;
+    u32 localPort_ = HCCL_INVALID_PORT;
+    u32 remotePort_ = HCCL_INVALID_PORT;
+    HcclSocketRole localRole_ = HcclSocketRole::SOCKET_ROLE_RESERVED;
+    HcclSocketStatus status_ = HcclSocketStatus::SOCKET_OK;
+    std::chrono::steady_clock::time_point readyTime_;
+    bool neverReady_ = false;
+    bool opened_ = false;
+};
+}  // namespace hccl
+
+HcclResult HcclNetDevGetLocalIp(hccl::HcclNetDevCtx netDevCtx, hccl::HcclIpAddress &localIp);
+HcclResult HcclNetDevGetNicType(hccl::HcclNetDevCtx netDevCtx, hccl::NicType *nicType);
+
+#endif /* HCCL_UT_STUB_HCCL_SOCKET_H */
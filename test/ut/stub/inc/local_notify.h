@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: LocalNotify在UT中由SimPlatform分配, Post/Wait转换为仿真引擎的notify record/wait */
+#ifndef HCCL_UT_STUB_LOCAL_NOTIFY_H
+#define HCCL_UT_STUB_LOCAL_NOTIFY_H
+
+#include <memory>
+#include "base.h"
+#include "stream_pub.h"
+#include "dispatcher.h"
+
+namespace hccl {
+constexpr u32 NOTIFY_DEFAULT_WAIT_TIME = 1800;
+
+class NotifyPool;
+
+class LocalNotify {
+public:
+    LocalNotify() = default;
+    ~LocalNotify() = default;
+
+    HcclResult Init(const NotifyLoadType type = NotifyLoadType::HOST_NOTIFY);
+    HcclResult Destroy();
+    HcclResult SetIpc();
+
+    static HcclResult Post(Stream &stream, HcclDispatcher dispatcher, const std::shared_ptr<LocalNotify> &notify,
+        s32 stage = INVALID_VALUE_STAGE);
+    static HcclResult Wait(Stream &stream, HcclDispatcher dispatcher, const std::shared_ptr<LocalNotify> &notify,
+        s32 stage = INVALID_VALUE_STAGE, u32 timeOut = NOTIFY_DEFAULT_WAIT_TIME);
+
+    void *ptr() const
+    {
+        return handle_;
+    }
+
+private:
+    friend class SimPlatform;
+    void *handle_{nullptr};         /* 仅用于日志打印的伪句柄 */
+    u32 simRank_{INVALID_UINT};     /* notify所属的仿真rank */
+    u32 simId_{INVALID_UINT};       /* 仿真引擎中的notify id */
+    bool quotaHeld_{false};         /* 是否占用runtime_quota.h中的notify配额 */
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_LOCAL_NOTIFY_H */
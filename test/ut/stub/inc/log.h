@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 日志与返回值检查宏, 语义与平台包log.h一致, 日志统一输出到stderr且默认只打印ERROR/WARNING */
+#ifndef HCCL_UT_STUB_LOG_H
+#define HCCL_UT_STUB_LOG_H
+
+#include <cstdio>
+#include <exception>
+#include "hccl/hccl_types.h"
+
+namespace hccl {
+/* UT中设置HCCL_UT_LOG_LEVEL=0可打开INFO/DEBUG日志 */
+bool UtLogEnable(int level);
+}
+
+constexpr int DLOG_DEBUG = 0;
+constexpr int DLOG_INFO = 1;
+constexpr int DLOG_WARN = 2;
+constexpr int DLOG_ERROR = 3;
+constexpr int HCCL_LOG_DEBUG = DLOG_DEBUG;
+constexpr int HCCL_LOG_INFO = DLOG_INFO;
+
+inline bool HcclCheckLogLevel(int level)
+{
+    return hccl::UtLogEnable(level);
+}
+
+#define HCCL_UT_LOG(level, tag, format, ...) \
+    do { \
+        if (hccl::UtLogEnable(level)) { \
+            fprintf(stderr, "[" tag "] %s:%d " format "\n", __FILE__, __LINE__, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define HCCL_DEBUG(format, ...) HCCL_UT_LOG(0, "DEBUG", format, ##__VA_ARGS__)
+#define HCCL_INFO(format, ...) HCCL_UT_LOG(1, "INFO", format, ##__VA_ARGS__)
+#define HCCL_RUN_INFO(format, ...) HCCL_UT_LOG(1, "INFO", format, ##__VA_ARGS__)
+#define HCCL_WARNING(format, ...) HCCL_UT_LOG(2, "WARNING", format, ##__VA_ARGS__)
+#define HCCL_RUN_WARNING(format, ...) HCCL_UT_LOG(2, "WARNING", format, ##__VA_ARGS__)
+#define HCCL_ERROR(format, ...) HCCL_UT_LOG(3, "ERROR", format, ##__VA_ARGS__)
+#define HCCL_USER_CRITICAL_LOG(format, ...) HCCL_UT_LOG(3, "ERROR", format, ##__VA_ARGS__)
+
+#define HCCL_ERROR_CODE(error) (static_cast<unsigned long long>(error))
+#define HCOM_ERROR_CODE(error) HCCL_ERROR_CODE(error)
+
+#define CHK_PRT_RET(result, exeLog, retCode) \
+    do { \
+        if (result) { \
+            exeLog; \
+            return retCode; \
+        } \
+    } while (0)
+
+#define CHK_PRT(result) \
+    do { \
+        HcclResult hcclRet_ = (result); \
+        if (hcclRet_ != HCCL_SUCCESS) { \
+            HCCL_ERROR("call trace: hcclRet -> %d", hcclRet_); \
+        } \
+    } while (0)
+
+#define CHK_PRT_CONT(result, exeLog) \
+    do { \
+        if (result) { \
+            exeLog; \
+        } \
+    } while (0)
+
+#define CHK_PRT_BREAK(result, exeLog, exeCmd) \
+    if (result) { \
+        exeLog; \
+        exeCmd; \
+        break; \
+    }
+
+#define CHK_RET(call) \
+    do { \
+        HcclResult hcclRet_ = (call); \
+        if (hcclRet_ != HCCL_SUCCESS) { \
+            if (hcclRet_ != HCCL_E_AGAIN) { \
+                HCCL_ERROR("call trace: hcclRet -> %d", hcclRet_); \
+            } \
+            return hcclRet_; \
+        } \
+    } while (0)
+
+#define CHK_PTR_NULL(ptr) \
+    do { \
+        if ((ptr) == nullptr) { \
+            HCCL_ERROR("ptr [%s] is nullptr, return HCCL_E_PTR", #ptr); \
+            return HCCL_E_PTR; \
+        } \
+    } while (0)
+
+#define CHK_SMART_PTR_NULL(ptr) \
+    do { \
+        if (!(ptr)) { \
+            HCCL_ERROR("smart ptr [%s] is nullptr, return HCCL_E_PTR", #ptr); \
+            return HCCL_E_PTR; \
+        } \
+    } while (0)
+
+#define CHK_SAFETY_FUNC_RET(call) \
+    do { \
+        int safetyRet_ = (call); \
+        if (safetyRet_ != 0) { \
+            HCCL_ERROR("call safety func failed, ret[%d]", safetyRet_); \
+            return HCCL_E_INTERNAL; \
+        } \
+    } while (0)
+
+#define EXECEPTION_CATCH(expression, retExpression) \
+    do { \
+        try { \
+            expression; \
+        } catch (std::exception &e) { \
+            HCCL_ERROR("exception caught: %s", e.what()); \
+            retExpression; \
+        } \
+    } while (0)
+
+#endif /* HCCL_UT_STUB_LOG_H */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: DeviceMem在UT中以host内存承载, alloc出的内存随最后一个引用释放 */
+#ifndef HCCL_UT_STUB_MEM_DEVICE_PUB_H
+#define HCCL_UT_STUB_MEM_DEVICE_PUB_H
+
+#include <memory>
+#include "base.h"
+
+namespace hccl {
+class DeviceMem {
+public:
+    DeviceMem() = default;
+    DeviceMem(void *ptr, u64 size, std::shared_ptr<u8> owner = nullptr)
+        : ptr_(ptr), size_(size), owner_(owner)
+    {
+    }
+    ~DeviceMem() = default;
+
+    static DeviceMem alloc(u64 size, bool level2Address = false)
+    {
+        (void)level2Address;
+        if (size == 0) {
+            return DeviceMem();
+        }
+        std::shared_ptr<u8> owner(new (std::nothrow) u8[size](), std::default_delete<u8[]>());
+        return (owner == nullptr) ? DeviceMem() : DeviceMem(owner.get(), size, owner);
+    }
+
+    static DeviceMem create(void *ptr, u64 size)
+    {
+        return DeviceMem(ptr, size);
+    }
+
+    DeviceMem range(u64 offset, u64 size) const
+    {
+        if (offset + size > size_) {
+            HCCL_ERROR("[DeviceMem][range]offset[%llu] size[%llu] out of range[%llu]", offset, size, size_);
+            return DeviceMem();
+        }
+        return DeviceMem(static_cast<u8 *>(ptr_) + offset, size, owner_);
+    }
+
+    void free()
+    {
+        owner_ = nullptr;
+        ptr_ = nullptr;
+        size_ = 0;
+    }
+
+    void *ptr() const
+    {
+        return ptr_;
+    }
+
+    u64 size() const
+    {
+        return size_;
+    }
+
+    explicit operator bool() const
+    {
+        return ptr_ != nullptr;
+    }
+
+    bool operator==(const DeviceMem &that) const
+    {
+        return ptr_ == that.ptr_ && size_ == that.size_;
+    }
+
+    bool operator!=(const DeviceMem &that) const
+    {
+        return !(*this == that);
+    }
+
+private:
+    void *ptr_{nullptr};
+    u64 size_{0};
+    std::shared_ptr<u8> owner_;
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_MEM_DEVICE_PUB_H */
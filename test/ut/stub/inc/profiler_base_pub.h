@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 仿真场景不采集profiling */
+#ifndef HCCL_UT_STUB_PROFILER_BASE_PUB_H
+#define HCCL_UT_STUB_PROFILER_BASE_PUB_H
+
+#include "base.h"
+
+#define HCCL_PROFILER_ADD_STREAM_BY_STREAMID(streamId, tag, planeId, algType)
+#define HCCL_PROFILER_ADD_STREAM(streamPtr, tag, planeId, algType)
+#define HCCL_PROFILER_DEL_STREAM(stream)
+#define HCCL_PROFILER_DEL_STREAM_BY_STREAMID(streamId)
+#define HCCL_PROFILER_ADD_TAG(tag, group, workFlowMode)
+#define HCCL_PROFILER_ADD_TAG_AIV(tag, group, workFlowMode)
+#define HCCL_PROFILER_ADD_TAG_SENDRECV(tag, group, workFlowMode)
+#define HCCL_PROFILER_DEL_TAG(tag)
+#define HCCL_PROFILER_ADD_OPDATA(tag, count, src, dst, dataType, rootId, group)
+#define HCCL_PROFILER_ADD_OPDATA_OP(tag, count, src, dst, dataType, rootId, group, reduceType)
+#define HCCL_PROFILER_DEL_OPDATA(tag)
+#define HCCL_PROFILER_ADD_GROUPRANK(group, rankSize, rankId)
+#define HCCL_PROFILER_ADD_GROUPRANK_SENDRECV(group, rankSize, rankId, remoteRankId)
+#define HCCL_PROFILER_DEL_GROUPRANK(group)
+#define HCCL_PROFILER_ADD_GROUP_UDI(group, udi)
+#define HCCL_PROFILER_DEL_GROUP_UDI(group)
+
+#endif /* HCCL_UT_STUB_PROFILER_BASE_PUB_H */
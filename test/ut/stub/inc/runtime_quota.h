@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 模拟runtime的stream/notify配额, 配额为0时不启用, Stream(StreamType)保持不创建stream */
+#ifndef HCCL_UT_STUB_RUNTIME_QUOTA_H
+#define HCCL_UT_STUB_RUNTIME_QUOTA_H
+
+#include "base.h"
+
+namespace hccl {
+struct StubRuntimeStat {
+    u32 streamNum{0};       /* 存活的stream数 */
+    u32 peakStreamNum{0};   /* streamNum的峰值 */
+    u32 notifyNum{0};       /* 存活的notify数 */
+    u32 peakNotifyNum{0};   /* notifyNum的峰值 */
+};
+
+/* 设置配额并清零统计 */
+void SetStubRuntimeQuota(u32 streamQuota, u32 notifyQuota);
+StubRuntimeStat GetStubRuntimeStat();
+
+bool StubRuntimeEnabled();
+HcclResult StubRuntimeCreateStream();
+void StubRuntimeDestroyStream();
+HcclResult StubRuntimeCreateNotify();
+void StubRuntimeDestroyNotify();
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_RUNTIME_QUOTA_H */
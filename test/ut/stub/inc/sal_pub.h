@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HCCL_UT_STUB_SAL_PUB_H
+#define HCCL_UT_STUB_SAL_PUB_H
+
+#include <string>
+#include "base.h"
+#include "hccl_common.h"
+
+inline void SetThreadName(const std::string &threadStr)
+{
+    (void)threadStr;
+}
+
+inline HcclResult SalGetDataTypeSize(HcclDataType dataType, u32 &dataTypeSize)
+{
+    if (dataType >= HCCL_DATA_TYPE_RESERVED || SIZE_TABLE[dataType] == 0) {
+        HCCL_ERROR("[SalGetDataTypeSize]dataType[%d] is invalid", dataType);
+        return HCCL_E_PARA;
+    }
+    dataTypeSize = SIZE_TABLE[dataType];
+    return HCCL_SUCCESS;
+}
+
+inline u32 SalLog2(u64 value)
+{
+    u32 result = 0;
+    while (value > 1) {
+        value >>= 1;
+        result++;
+    }
+    return result;
+}
+
+inline HcclResult SalSetBitOne(u64 &value, u64 index)
+{
+    value |= (1ULL << index);
+    return HCCL_SUCCESS;
+}
+
+#endif /* HCCL_UT_STUB_SAL_PUB_H */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* UT桩: 安全函数库的host侧实现, 只覆盖UT编译用到的接口 */
+#ifndef HCCL_UT_STUB_SECUREC_H
+#define HCCL_UT_STUB_SECUREC_H
+
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdarg>
+
+using errno_t = int;
+constexpr errno_t EOK = 0;
+
+inline errno_t memcpy_s(void *dest, size_t destMax, const void *src, size_t count)
+{
+    if (dest == nullptr || src == nullptr || count > destMax) {
+        return -1;
+    }
+    std::memmove(dest, src, count);
+    return EOK;
+}
+
+inline errno_t memset_s(void *dest, size_t destMax, int c, size_t count)
+{
+    if (dest == nullptr || count > destMax) {
+        return -1;
+    }
+    std::memset(dest, c, count);
+    return EOK;
+}
+
+inline errno_t strncpy_s(char *dest, size_t destMax, const char *src, size_t count)
+{
+    if (dest == nullptr || src == nullptr || destMax == 0) {
+        return -1;
+    }
+    size_t len = strnlen(src, count);
+    if (len >= destMax) {
+        dest[0] = '\0';
+        return -1;
+    }
+    std::memcpy(dest, src, len);
+    dest[len] = '\0';
+    return EOK;
+}
+
+inline errno_t strcpy_s(char *dest, size_t destMax, const char *src)
+{
+    return strncpy_s(dest, destMax, src, destMax);
+}
+
+inline int sprintf_s(char *dest, size_t destMax, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf(dest, destMax, format, args);
+    va_end(args);
+    return (ret < 0 || static_cast<size_t>(ret) >= destMax) ? -1 : ret;
+}
+
+inline int snprintf_s(char *dest, size_t destMax, size_t count, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    size_t limit = (count < destMax) ? count + 1 : destMax;
+    int ret = vsnprintf(dest, limit, format, args);
+    va_end(args);
+    return (ret < 0 || static_cast<size_t>(ret) >= limit) ? -1 : ret;
+}
+
+#endif /* HCCL_UT_STUB_SECUREC_H */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*
+ * UT桩: Stream只保存句柄与id, 句柄到仿真rank/stream的映射由SimPlatform维护;
+ * 启用runtime_quota.h中的配额时, Stream(StreamType)创建的句柄计入配额, 随最后一个引用释放
+ */
+#ifndef HCCL_UT_STUB_STREAM_PUB_H
+#define HCCL_UT_STUB_STREAM_PUB_H
+
+#include <memory>
+#include "base.h"
+
+namespace hccl {
+enum class StreamType {
+    STREAM_TYPE_OFFLINE = 0,
+    STREAM_TYPE_ONLINE = 1,
+    STREAM_TYPE_DEVICE = 2,
+    STREAM_TYPE_RESERVED
+};
+
+class Stream {
+public:
+    Stream() = default;
+    explicit Stream(const StreamType streamType, bool isMainStream = false);
+    explicit Stream(const rtStream_t rtStream, bool isMainStream = true)
+        : stream_(rtStream), isMainStream_(isMainStream)
+    {
+        id_ = static_cast<s32>(reinterpret_cast<uintptr_t>(rtStream) & 0x7FFFFFFF);
+    }
+    ~Stream() = default;
+
+    void *ptr() const
+    {
+        return stream_;
+    }
+
+    s32 id() const
+    {
+        return id_;
+    }
+
+    bool IsMainStream() const
+    {
+        return isMainStream_;
+    }
+
+    HcclResult GetMode(uint64_t *const stackMode)
+    {
+        CHK_PTR_NULL(stackMode);
+        *stackMode = mode_;
+        return HCCL_SUCCESS;
+    }
+
+    HcclResult SetMode(const uint64_t stackMode)
+    {
+        mode_ = stackMode;
+        return HCCL_SUCCESS;
+    }
+
+    explicit operator bool() const
+    {
+        return stream_ != nullptr;
+    }
+
+private:
+    void *stream_{nullptr};
+    s32 id_{-1};
+    bool isMainStream_{false};
+    uint64_t mode_{0};
+    std::shared_ptr<u8> owner_;
+};
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_STREAM_PUB_H */
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*
+ * UT桩: Transport接口在UT中是一个全部返回HCCL_E_NOT_SUPPORT的虚基类,
+ * 仿真链路(SimLink)按需覆写, 其余调用在UT中会直接失败, 便于发现未仿真的协议。
+ */
+#ifndef HCCL_UT_STUB_TRANSPORT_PUB_H
+#define HCCL_UT_STUB_TRANSPORT_PUB_H
+
+#include <memory>
+#include <vector>
+#include "base.h"
+#include "mem_device_pub.h"
+#include "stream_pub.h"
+
+namespace hccl {
+enum class LinkType {
+    LINK_ONCHIP = 0,
+    LINK_HCCS = 1,
+    LINK_PCIE = 2,
+    LINK_ROCE = 3,
+    LINK_SIO = 4,
+    LINK_HCCS_SW = 5,
+    LINK_STANDARD_ROCE = 6,
+    LINK_RESERVED
+};
+
+enum class UserMemType {
+    INPUT_MEM = 0,
+    OUTPUT_MEM = 1,
+    MEM_RESERVED
+};
+
+struct TxMemoryInfo {
+    UserMemType dstMemType;
+    u64 dstOffset;
+    const void *src;
+    u64 len;
+};
+
+struct RxMemoryInfo {
+    UserMemType srcMemType;
+    u64 srcOffset;
+    void *dst;
+    u64 len;
+};
+
+struct RxWithReduceMemoryInfo {
+    UserMemType srcMemType;
+    u64 srcOffset;
+    void *dst;
+    u64 len;
+    void *reduceSrc;
+    void *reduceDst;
+    u64 reduceDataCount;
+};
+
+enum class TransportType {
+    TRANS_TYPE_P2P = 0,
+    TRANS_TYPE_IBV_EXP,
+    TRANS_TYPE_HOST_TCP,
+    TRANS_TYPE_ROCE,
+    TRANS_TYPE_HETEROG_P2P,
+    TRANS_TYPE_HETEROG_ROCE,
+    TRANS_TYPE_RESERVED
+};
+
+enum class MachineType {
+    MACHINE_SERVER_TYPE = 0,
+    MACHINE_CLIENT_TYPE
+};
+
+/* UT中不经过建链流程, 建链参数只需可声明 */
+struct MachinePara {
+    MachineType machineType{MachineType::MACHINE_SERVER_TYPE};
+    std::string tag;
+};
+
+struct TransportPara {
+    u32 timeout{0};
+};
+
+class Transport {
+public:
+    struct Buffer {
+        void *addr;
+        u64 size;
+    };
+
+    Transport() = default;
+    virtual ~Transport() = default;
+
+    virtual HcclResult TxAck(Stream &stream);
+    virtual HcclResult RxAck(Stream &stream);
+    virtual HcclResult TxDataSignal(Stream &stream);
+    virtual HcclResult RxDataSignal(Stream &stream);
+    virtual HcclResult TxAsync(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len, Stream &stream);
+    virtual HcclResult TxAsync(std::vector<TxMemoryInfo> &txMems, Stream &stream);
+    virtual HcclResult RxAsync(UserMemType srcMemType, u64 srcOffset, void *dst, u64 len, Stream &stream);
+    virtual HcclResult RxAsync(std::vector<RxMemoryInfo> &rxMems, Stream &stream);
+    virtual HcclResult TxWithReduce(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len,
+        const HcclDataType datatype, HcclReduceOp redOp, Stream &stream);
+    virtual HcclResult TxWithReduce(const std::vector<TxMemoryInfo> &txWithReduceMems, const HcclDataType datatype,
+        HcclReduceOp redOp, Stream &stream);
+    virtual HcclResult RxWithReduce(UserMemType recvSrcMemType, u64 recvSrcOffset, void *recvDst, u64 recvLen,
+        void *reduceSrc, void *reduceDst, u64 reduceDataCount, HcclDataType reduceDatatype, HcclReduceOp reduceOp,
+        Stream &stream, const u64 reduceAttr);
+    virtual HcclResult RxWithReduce(const std::vector<RxWithReduceMemoryInfo> &rxWithReduceMems,
+        HcclDataType reduceDatatype, HcclReduceOp reduceOp, Stream &stream, const u64 reduceAttr);
+    virtual HcclResult TxPrepare(Stream &stream);
+    virtual HcclResult RxPrepare(Stream &stream);
+    virtual HcclResult TxData(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len, Stream &stream);
+    virtual HcclResult RxData(UserMemType srcMemType, u64 srcOffset, void *dst, u64 len, Stream &stream);
+    virtual HcclResult TxDone(Stream &stream);
+    virtual HcclResult RxDone(Stream &stream);
+    virtual HcclResult TxWaitDone(Stream &stream);
+    virtual HcclResult RxWaitDone(Stream &stream);
+    virtual HcclResult TxEnv(const void *ptr, const u64 len, Stream &stream);
+    virtual HcclResult RxEnv(Stream &stream);
+    virtual HcclResult PostFin(Stream &stream);
+    virtual HcclResult WaitFin(Stream &stream);
+    virtual HcclResult PostFinAck(Stream &stream);
+    virtual HcclResult WaitFinAck(Stream &stream);
+    virtual HcclResult DataReceivedAck(Stream &stream);
+    virtual HcclResult Post(u32 notifyIdx, Stream &stream);
+    virtual HcclResult Wait(u32 notifyIdx, Stream &stream, const u32 timeOut = 0);
+    virtual HcclResult ReadSync(Buffer &localBuf, Buffer &remoteBuf,
+        Stream &stream);
+    virtual HcclResult ReadReduceSync(Buffer &localBuf, Buffer &remoteBuf,
+        const HcclDataType datatype, HcclReduceOp redOp, Stream &stream);
+    virtual HcclResult GetRemoteMem(UserMemType memType, void **remotePtr);
+
+    virtual u32 GetRemoteRank();
+    virtual LinkType GetLinkType() const;
+    virtual bool IsSpInlineReduce() const;
+    virtual bool IsSupportTransportWithReduce();
+    virtual bool IsTransportRoce();
+    virtual bool GetSupportDataReceivedAck() const;
+    virtual void Break();
+};
+
+using LINK = std::shared_ptr<Transport>;
+}  // namespace hccl
+
+#endif /* HCCL_UT_STUB_TRANSPORT_PUB_H */
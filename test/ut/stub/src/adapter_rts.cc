@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "adapter_rts_common.h"
+#include "stream_utils.h"
+
+/* UT桩: 仿真平台只有一张逻辑卡, stream与内存均在主机侧 */
+HcclResult hrtGetDevice(s32 *deviceLogicId)
+{
+    CHK_PTR_NULL(deviceLogicId);
+    *deviceLogicId = 0;
+    return HCCL_SUCCESS;
+}
+
+HcclResult hrtStreamActive(rtStream_t activeStream, rtStream_t stream)
+{
+    (void)activeStream;
+    (void)stream;
+    return HCCL_SUCCESS;
+}
+
+HcclResult hrtGetStreamId(rtStream_t stream, s32 &streamId)
+{
+    streamId = static_cast<s32>(reinterpret_cast<uintptr_t>(stream));
+    return HCCL_SUCCESS;
+}
+
+HcclResult hrtNotifyReset(void *notify)
+{
+    (void)notify;
+    return HCCL_SUCCESS;
+}
+
+HcclResult hrtMemSyncCopy(void *dst, u64 destMax, const void *src, u64 count, HcclRtMemcpyKind kind)
+{
+    (void)kind;
+    CHK_PTR_NULL(dst);
+    CHK_PTR_NULL(src);
+    CHK_PRT_RET(count > destMax, HCCL_ERROR("[hrtMemSyncCopy]count[%llu] exceeds destMax[%llu]", count, destMax),
+        HCCL_E_PARA);
+    std::copy_n(static_cast<const u8 *>(src), count, static_cast<u8 *>(dst));
+    return HCCL_SUCCESS;
+}
+
+HcclResult GetStreamCaptureInfo(rtStream_t stream, rtModel_t &rtModel, bool &isCapture)
+{
+    (void)stream;
+    rtModel = nullptr;
+    isCapture = false;
+    return HCCL_SUCCESS;
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <map>
+#include "device_capacity.h"
+
+namespace hccl {
+namespace {
+std::map<u32, float> g_bandWidthPerNPU = {{0, 50.0f}, {1, 25.0f}};  // level -> GB/s
+}
+
+HcclResult GetBandWidthPerNPU(u32 level, u32 userRankSize, u32 devNumPerAggregation, float &bandWidth)
+{
+    (void)userRankSize;
+    (void)devNumPerAggregation;
+    auto iter = g_bandWidthPerNPU.find(level);
+    CHK_PRT_RET(iter == g_bandWidthPerNPU.end(),
+        HCCL_ERROR("[GetBandWidthPerNPU]level[%u] is not supported", level), HCCL_E_PARA);
+    bandWidth = iter->second;
+    return HCCL_SUCCESS;
+}
+
+void SetBandWidthPerNPU(u32 level, float bandWidth)
+{
+    g_bandWidthPerNPU[level] = bandWidth;
+}
+
+bool Is310PDevice()
+{
+    return false;
+}
+}  // namespace hccl
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "externalinput_pub.h"
+#include "workflow_pub.h"
+
+namespace {
+constexpr u32 ALGO_LEVEL_NUM = 4;  // level0~level3
+std::vector<HcclAlgoType> g_algoConfig(ALGO_LEVEL_NUM, HcclAlgoType::HCCL_ALGO_TYPE_DEFAULT);
+HcclWorkflowMode g_workflowMode = HcclWorkflowMode::HCCL_WORKFLOW_MODE_OP_BASE;
+constexpr s32 LINK_TIMEOUT_DEFAULT_S = 120;
+s32 g_linkTimeOut = LINK_TIMEOUT_DEFAULT_S;
+}
+
+bool GetExternalInputInterHccsDisable()
+{
+    return false;
+}
+
+u32 GetExternalInputIntraRoceSwitch()
+{
+    return 0;
+}
+
+bool GetExternalInputHcclEnablePipline()
+{
+    return false;
+}
+
+std::vector<HcclAlgoType> GetExternalInputHcclAlgoConfig(HcclCMDType opType)
+{
+    (void)opType;
+    return g_algoConfig;
+}
+
+void SetExternalInputHcclAlgoConfig(const std::vector<HcclAlgoType> &algoConfig)
+{
+    g_algoConfig = algoConfig;
+}
+
+s32 GetExternalInputHcclLinkTimeOut()
+{
+    return g_linkTimeOut;
+}
+
+void SetExternalInputHcclLinkTimeOut(s32 linkTimeOut)
+{
+    g_linkTimeOut = linkTimeOut;
+}
+
+HcclWorkflowMode GetWorkflowMode()
+{
+    return g_workflowMode;
+}
+
+HcclResult SetWorkflowMode(HcclWorkflowMode mode)
+{
+    g_workflowMode = mode;
+    return HCCL_SUCCESS;
+}
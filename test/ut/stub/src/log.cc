@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdlib>
+#include "log.h"
+
+namespace hccl {
+namespace {
+constexpr int UT_LOG_LEVEL_DEFAULT = 2; // 默认只打印WARNING及以上
+
+int GetUtLogLevel()
+{
+    const char *level = getenv("HCCL_UT_LOG_LEVEL");
+    return (level == nullptr) ? UT_LOG_LEVEL_DEFAULT : atoi(level);
+}
+}
+
+bool UtLogEnable(int level)
+{
+    static const int utLogLevel = GetUtLogLevel();
+    return level >= utLogLevel;
+}
+}  // namespace hccl
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "runtime_quota.h"
+#include <algorithm>
+#include <mutex>
+#include "log.h"
+
+namespace hccl {
+namespace {
+std::mutex g_runtimeMutex;
+u32 g_streamQuota = 0;
+u32 g_notifyQuota = 0;
+StubRuntimeStat g_runtimeStat;
+}
+
+void SetStubRuntimeQuota(u32 streamQuota, u32 notifyQuota)
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    g_streamQuota = streamQuota;
+    g_notifyQuota = notifyQuota;
+    g_runtimeStat = StubRuntimeStat();
+}
+
+StubRuntimeStat GetStubRuntimeStat()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    return g_runtimeStat;
+}
+
+bool StubRuntimeEnabled()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    return g_streamQuota != 0 || g_notifyQuota != 0;
+}
+
+HcclResult StubRuntimeCreateStream()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    CHK_PRT_RET(g_runtimeStat.streamNum >= g_streamQuota,
+        HCCL_ERROR("[StubRuntime]stream quota[%u] is exhausted", g_streamQuota), HCCL_E_RUNTIME);
+    g_runtimeStat.streamNum++;
+    g_runtimeStat.peakStreamNum = std::max(g_runtimeStat.peakStreamNum, g_runtimeStat.streamNum);
+    return HCCL_SUCCESS;
+}
+
+void StubRuntimeDestroyStream()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    if (g_runtimeStat.streamNum > 0) {
+        g_runtimeStat.streamNum--;
+    }
+}
+
+HcclResult StubRuntimeCreateNotify()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    CHK_PRT_RET(g_runtimeStat.notifyNum >= g_notifyQuota,
+        HCCL_ERROR("[StubRuntime]notify quota[%u] is exhausted", g_notifyQuota), HCCL_E_RUNTIME);
+    g_runtimeStat.notifyNum++;
+    g_runtimeStat.peakNotifyNum = std::max(g_runtimeStat.peakNotifyNum, g_runtimeStat.notifyNum);
+    return HCCL_SUCCESS;
+}
+
+void StubRuntimeDestroyNotify()
+{
+    std::unique_lock<std::mutex> lock(g_runtimeMutex);
+    if (g_runtimeStat.notifyNum > 0) {
+        g_runtimeStat.notifyNum--;
+    }
+}
+}  // namespace hccl
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "hccl_socket.h"
+
+namespace hccl {
+namespace {
+std::atomic<s64> g_establishDelayUs{0};
+std::atomic<u32> g_openSocketNum{0};
+const std::string LOOPBACK_IP = "127.0.0.1";
+}
+
+HcclSocket::HcclSocket(const std::string &tag, HcclNetDevCtx netDevCtx, const HcclIpAddress &remoteIp,
+    u32 remotePort, HcclSocketRole localRole)
+    : tag_(tag), localIp_(LOOPBACK_IP), remoteIp_(remoteIp), remotePort_(remotePort), localRole_(localRole),
+      status_(HcclSocketStatus::SOCKET_INIT)
+{
+    (void)netDevCtx;
+}
+
+HcclSocket::HcclSocket(HcclNetDevCtx netDevCtx, u32 localPort)
+    : localIp_(LOOPBACK_IP), localPort_(localPort), localRole_(HcclSocketRole::SOCKET_ROLE_SERVER)
+{
+    (void)netDevCtx;
+}
+
+HcclSocket::~HcclSocket()
+{
+    Close();
+}
+
+HcclResult HcclSocket::Init()
+{
+    if (status_ == HcclSocketStatus::SOCKET_INIT) {
+        s64 delayUs = g_establishDelayUs.load();
+        neverReady_ = delayUs < 0;
+        readyTime_ = std::chrono::steady_clock::now() + std::chrono::microseconds(neverReady_ ? 0 : delayUs);
+        status_ = HcclSocketStatus::SOCKET_CONNECTING;
+    }
+    if (!opened_) {
+        opened_ = true;
+        g_openSocketNum++;
+    }
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclSocket::DeInit()
+{
+    Close();
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclSocket::Listen()
+{
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclSocket::Connect()
+{
+    return HCCL_SUCCESS;
+}
+
+void HcclSocket::Close()
+{
+    if (opened_) {
+        opened_ = false;
+        g_openSocketNum--;
+    }
+}
+
+HcclResult HcclSocket::AddWhiteList(std::vector<SocketWlistInfo> &wlistInfoVec)
+{
+    (void)wlistInfoVec;
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclSocket::DelWhiteList(std::vector<SocketWlistInfo> &wlistInfoVec)
+{
+    (void)wlistInfoVec;
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclSocket::SetStopFlag(bool value)
+{
+    (void)value;
+    return HCCL_SUCCESS;
+}
+
+HcclSocketStatus HcclSocket::GetStatus() const
+{
+    if (status_ == HcclSocketStatus::SOCKET_CONNECTING && !neverReady_ &&
+        std::chrono::steady_clock::now() >= readyTime_) {
+        return HcclSocketStatus::SOCKET_OK;
+    }
+    return status_;
+}
+
+void HcclSocket::SetStatus(HcclSocketStatus status)
+{
+    status_ = status;
+}
+
+void HcclSocket::SetEstablishDelay(std::chrono::microseconds delay)
+{
+    g_establishDelayUs.store(delay.count());
+}
+
+u32 HcclSocket::GetOpenSocketNum()
+{
+    return g_openSocketNum.load();
+}
+}  // namespace hccl
+
+HcclResult HcclNetDevGetLocalIp(hccl::HcclNetDevCtx netDevCtx, hccl::HcclIpAddress &localIp)
+{
+    (void)netDevCtx;
+    localIp = hccl::HcclIpAddress(hccl::LOOPBACK_IP);
+    return HCCL_SUCCESS;
+}
+
+HcclResult HcclNetDevGetNicType(hccl::HcclNetDevCtx netDevCtx, hccl::NicType *nicType)
+{
+    (void)netDevCtx;
+    CHK_PTR_NULL(nicType);
+    *nicType = hccl::NicType::DEVICE_NIC_TYPE;
+    return HCCL_SUCCESS;
+}
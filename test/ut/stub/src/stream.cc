@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "stream_pub.h"
+#include "runtime_quota.h"
+
+namespace hccl {
+/* UT中不向runtime申请stream, 仿真stream统一由SimPlatform::CreateStream创建; 启用配额时按配额创建伪句柄 */
+Stream::Stream(const StreamType streamType, bool isMainStream) : isMainStream_(isMainStream)
+{
+    (void)streamType;
+    if (!StubRuntimeEnabled() || StubRuntimeCreateStream() != HCCL_SUCCESS) {
+        return;
+    }
+    owner_.reset(new (std::nothrow) u8(0), [](u8 *handle) {
+        delete handle;
+        StubRuntimeDestroyStream();
+    });
+    if (owner_ == nullptr) {
+        StubRuntimeDestroyStream();
+        return;
+    }
+    stream_ = owner_.get();
+    id_ = static_cast<s32>(reinterpret_cast<uintptr_t>(stream_) & 0x7FFFFFFF);
+}
+}  // namespace hccl
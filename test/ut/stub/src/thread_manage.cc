@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "threadManage.h"
+
+/* UT桩: 仿真场景下资源中不创建ThreadManage, 多线程下发路径直接报不支持 */
+namespace hccl {
+HcclResult ThreadManage::Prepare(DeviceMem &inputMem, DeviceMem &outputMem, DeviceMem &scratchMem, const u64 count,
+    const HcclDataType dataType, const Stream &stream, const HcclReduceOp reductionOp, const u32 root,
+    const std::vector<Slice> &slices, const u64 baseOffset, std::vector<u32> nicRankList, const std::string &tag,
+    s32 profStage, const SubCommInfo &ringSubCommInfo, std::shared_ptr<LocalNotify> &signalAux,
+    std::shared_ptr<LocalNotify> &signalMain, u32 ringIndex, ExecutorType type, u64 reduceAttr,
+    const HcomCollOpInfo *opInfo, std::vector<Stream> subStreamsInOneRing,
+    std::vector<std::shared_ptr<LocalNotify>> mainSignalsInOneRing,
+    std::vector<std::shared_ptr<LocalNotify>> subSignalsInOneRing, std::vector<u32> ringsOrder,
+    std::vector<Slice> userMemInputSlices)
+{
+    HCCL_ERROR("[ThreadManage][Prepare]multi-thread launch is not supported in simulator, tag[%s]", tag.c_str());
+    return HCCL_E_NOT_SUPPORT;
+}
+
+void ThreadManage::NotifyStart()
+{
+}
+
+void ThreadManage::WaitDone()
+{
+}
+}  // namespace hccl
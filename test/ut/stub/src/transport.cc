@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "transport_pub.h"
+
+namespace hccl {
+/* 未被仿真链路覆写的接口在UT中一律返回不支持, 便于发现算法使用了未仿真的协议 */
+HcclResult Transport::TxAck(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxAck(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxDataSignal(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxDataSignal(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxAsync(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len, Stream &stream)
+{
+    (void)dstMemType;
+    (void)dstOffset;
+    (void)src;
+    (void)len;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxAsync(std::vector<TxMemoryInfo> &txMems, Stream &stream)
+{
+    (void)txMems;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxAsync(UserMemType srcMemType, u64 srcOffset, void *dst, u64 len, Stream &stream)
+{
+    (void)srcMemType;
+    (void)srcOffset;
+    (void)dst;
+    (void)len;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxAsync(std::vector<RxMemoryInfo> &rxMems, Stream &stream)
+{
+    (void)rxMems;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxWithReduce(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len,
+    const HcclDataType datatype, HcclReduceOp redOp, Stream &stream)
+{
+    (void)dstMemType;
+    (void)dstOffset;
+    (void)src;
+    (void)len;
+    (void)datatype;
+    (void)redOp;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxWithReduce(const std::vector<TxMemoryInfo> &txWithReduceMems, const HcclDataType datatype,
+    HcclReduceOp redOp, Stream &stream)
+{
+    (void)txWithReduceMems;
+    (void)datatype;
+    (void)redOp;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxWithReduce(UserMemType recvSrcMemType, u64 recvSrcOffset, void *recvDst, u64 recvLen,
+    void *reduceSrc, void *reduceDst, u64 reduceDataCount, HcclDataType reduceDatatype, HcclReduceOp reduceOp,
+    Stream &stream, const u64 reduceAttr)
+{
+    (void)recvSrcMemType;
+    (void)recvSrcOffset;
+    (void)recvDst;
+    (void)recvLen;
+    (void)reduceSrc;
+    (void)reduceDst;
+    (void)reduceDataCount;
+    (void)reduceDatatype;
+    (void)reduceOp;
+    (void)stream;
+    (void)reduceAttr;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxWithReduce(const std::vector<RxWithReduceMemoryInfo> &rxWithReduceMems,
+    HcclDataType reduceDatatype, HcclReduceOp reduceOp, Stream &stream, const u64 reduceAttr)
+{
+    (void)rxWithReduceMems;
+    (void)reduceDatatype;
+    (void)reduceOp;
+    (void)stream;
+    (void)reduceAttr;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxPrepare(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxPrepare(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxData(UserMemType dstMemType, u64 dstOffset, const void *src, u64 len, Stream &stream)
+{
+    (void)dstMemType;
+    (void)dstOffset;
+    (void)src;
+    (void)len;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxData(UserMemType srcMemType, u64 srcOffset, void *dst, u64 len, Stream &stream)
+{
+    (void)srcMemType;
+    (void)srcOffset;
+    (void)dst;
+    (void)len;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxDone(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxDone(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxWaitDone(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxWaitDone(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::TxEnv(const void *ptr, const u64 len, Stream &stream)
+{
+    (void)ptr;
+    (void)len;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::RxEnv(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::PostFin(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::WaitFin(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::PostFinAck(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::WaitFinAck(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::DataReceivedAck(Stream &stream)
+{
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::Post(u32 notifyIdx, Stream &stream)
+{
+    (void)notifyIdx;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::Wait(u32 notifyIdx, Stream &stream, const u32 timeOut)
+{
+    (void)notifyIdx;
+    (void)stream;
+    (void)timeOut;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::ReadSync(Buffer &localBuf, Buffer &remoteBuf, Stream &stream)
+{
+    (void)localBuf;
+    (void)remoteBuf;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::ReadReduceSync(Buffer &localBuf, Buffer &remoteBuf, const HcclDataType datatype,
+    HcclReduceOp redOp, Stream &stream)
+{
+    (void)localBuf;
+    (void)remoteBuf;
+    (void)datatype;
+    (void)redOp;
+    (void)stream;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+HcclResult Transport::GetRemoteMem(UserMemType memType, void **remotePtr)
+{
+    (void)memType;
+    (void)remotePtr;
+    return HCCL_E_NOT_SUPPORT;
+}
+
+u32 Transport::GetRemoteRank()
+{
+    return INVALID_VALUE_RANKID;
+}
+
+LinkType Transport::GetLinkType() const
+{
+    return LinkType::LINK_RESERVED;
+}
+
+bool Transport::IsSpInlineReduce() const
+{
+    return false;
+}
+
+bool Transport::IsSupportTransportWithReduce()
+{
+    return false;
+}
+
+bool Transport::IsTransportRoce()
+{
+    return false;
+}
+
+bool Transport::GetSupportDataReceivedAck() const
+{
+    return false;
+}
+
+void Transport::Break()
+{
+}
+}  // namespace hccl